@@ -0,0 +1,152 @@
+#ifndef FONT_PACK_H_
+#define FONT_PACK_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Font_Pack Packed fonts
+ ** @{
+ * @brief Compressed fonts and icons, decoded a row at a time
+ *
+ * Packed fonts are generated on the PC by tools/fontpack from the fonts and
+ * icons of fonts.h and icons.h. They keep only the character ranges that are
+ * used (e.g. just the digits of a large font). Glyphs can be 1 bpp, or 2 or
+ * 4 bpp anti-aliased (each pixel is a coverage level).
+ *
+ * Each glyph is a stream of runs over its pixels, row after row. One byte
+ * holds the level in the low bpp bits and the run length minus 1 in the rest
+ * (up to 128, 64 or 16 pixels). When runs would take more room, the glyph is
+ * stored raw (FONT_PACK_RAW): rows of bpp bit pixels, MSB first, each row
+ * starting on a byte, as fonts.h for 1 bpp.
+ *
+ * A packed font holds up to 64 KB of glyph data, as fonts.h.
+ *
+ * The decoder writes RGB565 pixels (display byte order, as framebuffer.h)
+ * straight into the output buffer, a row per call. The levels are mapped to
+ * colors by a palette computed once per color pair (FontPackPalette()).
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 19/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define FONT_PACK_RAW			0x01	/*!< Glyph flag: stored raw, not as runs */
+#define FONT_PACK_MAX_LEVELS	16		/*!< Levels of 4 bpp, size of a palette */
+/*==================[typedef]================================================*/
+/**
+ * @brief Glyph of a packed font
+ */
+typedef struct {
+	uint8_t width;			/*!< Width in pixels */
+	uint8_t flags;			/*!< FONT_PACK_RAW */
+	uint16_t offset;		/*!< Position of its stream in the font data */
+} font_pack_glyph_t;
+
+/**
+ * @brief Consecutive characters of a packed font
+ */
+typedef struct {
+	uint8_t first;			/*!< First character (icon_t for icons) */
+	uint8_t count;			/*!< Number of characters */
+	uint16_t glyph;			/*!< Index of the glyph of first */
+} font_pack_range_t;
+
+/**
+ * @brief Packed font
+ */
+typedef struct {
+	uint8_t height;						/*!< Height in pixels */
+	uint8_t bpp;						/*!< Bits per pixel: 1, 2 or 4 */
+	uint8_t n_ranges;					/*!< Number of ranges */
+	const font_pack_range_t *ranges;	/*!< Ranges, in increasing order */
+	const font_pack_glyph_t *glyphs;	/*!< Glyphs */
+	const uint8_t *data;				/*!< Glyph streams */
+} font_pack_t;
+
+/**
+ * @brief Decoder of a glyph
+ */
+typedef struct {
+	const uint8_t *src;			/*!< Next byte of the stream */
+	const uint16_t *palette;	/*!< Colors of the levels */
+	uint8_t width;				/*!< Glyph width */
+	uint8_t bpp;				/*!< Bits per pixel */
+	bool raw;					/*!< Stored raw */
+	uint8_t level;				/*!< Level of the current run */
+	uint16_t run;				/*!< Pixels left in the current run */
+} font_pack_decoder_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Finds the glyph of a character
+ * @param[in]  	font: Packed font
+ * @param[in]  	code: Character (or icon)
+ * @retval 		Glyph, NULL if the font does not have it
+ */
+const font_pack_glyph_t * FontPackGlyph(const font_pack_t *font, uint8_t code);
+
+/**
+ * @brief  		Width of a text, with 1 pixel gaps between characters. Characters
+ * 				the font does not have are skipped.
+ * @param[in]  	font: Packed font
+ * @param[in]  	str: Text
+ * @param[in]  	n: Number of characters
+ * @retval 		Width in pixels
+ */
+uint16_t FontPackWidth(const font_pack_t *font, const char *str, uint16_t n);
+
+/**
+ * @brief  		Colors of the levels of a font, from background to foreground
+ * @param[in]  	font: Packed font
+ * @param[in]  	foreground: Color (RGB565)
+ * @param[in]  	background: Color (RGB565)
+ * @param[out] 	palette: FONT_PACK_MAX_LEVELS colors (display byte order)
+ * @retval 		None
+ */
+void FontPackPalette(const font_pack_t *font, uint16_t foreground, uint16_t background, uint16_t *palette);
+
+/**
+ * @brief  		Starts decoding a glyph from its first row
+ * @param[out] 	decoder: Decoder
+ * @param[in]  	font: Packed font
+ * @param[in]  	glyph: Glyph of the font
+ * @param[in]  	palette: Palette of FontPackPalette(), kept by the decoder
+ * @retval 		None
+ */
+void FontPackDecoderInit(font_pack_decoder_t *decoder, const font_pack_t *font,
+						 const font_pack_glyph_t *glyph, const uint16_t *palette);
+
+/**
+ * @brief  		Decodes the next row of the glyph
+ * @param[in]  	decoder: Decoder
+ * @param[out] 	row: Glyph width pixels (display byte order)
+ * @retval 		None
+ */
+void FontPackRow(font_pack_decoder_t *decoder, uint16_t *row);
+
+/**
+ * @brief  		Skips rows of the glyph
+ * @param[in]  	decoder: Decoder
+ * @param[in]  	rows: Number of rows
+ * @retval 		None
+ */
+void FontPackSkip(font_pack_decoder_t *decoder, uint16_t rows);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FONT_PACK_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,53 @@
+#ifndef FONTS_PACK_H_
+#define FONTS_PACK_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Font_Pack Packed fonts
+ ** @{ */
+/** \brief Packed fonts and icons, generated by tools/fontpack. Do not edit.
+ *
+ *   fontpack -s fonts_pack.c -i fonts_pack.h font_pack_22=font_22 font_pack_30=font_30 font_pack_30_aa=font_59:4:2 font_pack_59_digits=font_59:1:1:-0-9.: font_pack_89_digits=font_89:1:1:-0-9.: icon_pack_30=icon_30
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include "font_pack.h"
+/*==================[external data declaration]==============================*/
+/**
+ * @brief  Packed font_22 (22 pixels, 1 bpp, 95 glyphs, 3172 bytes; 3900 in the source)
+ */
+extern const font_pack_t font_pack_22;
+
+/**
+ * @brief  Packed font_30 (30 pixels, 1 bpp, 95 glyphs, 4476 bytes; 5750 in the source)
+ */
+extern const font_pack_t font_pack_30;
+
+/**
+ * @brief  Packed font_59:4:2 (30 pixels, 4 bpp, 95 glyphs, 9570 bytes; 19732 in the source)
+ */
+extern const font_pack_t font_pack_30_aa;
+
+/**
+ * @brief  Packed font_59:1:1:-0-9.: (59 pixels, 1 bpp, 13 glyphs, 1160 bytes; 2589 in the source)
+ */
+extern const font_pack_t font_pack_59_digits;
+
+/**
+ * @brief  Packed font_89:1:1:-0-9.: (89 pixels, 1 bpp, 13 glyphs, 1792 bytes; 5392 in the source)
+ */
+extern const font_pack_t font_pack_89_digits;
+
+/**
+ * @brief  Packed icon_30 (30 pixels, 1 bpp, 64 glyphs, 6472 bytes; 7680 in the source)
+ */
+extern const font_pack_t icon_pack_30;
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FONTS_PACK_H_ */
+
+/*==================[end of file]============================================*/
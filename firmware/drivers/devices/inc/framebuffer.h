@@ -0,0 +1,310 @@
+#ifndef FRAMEBUFFER_H_
+#define FRAMEBUFFER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Framebuffer Framebuffer
+ ** @{
+ * @brief Off-screen RGB565 framebuffer with dirty rectangle tracking
+ *
+ * The drawing functions write into RAM and record the rectangles they touch.
+ * FbRender() sends only those rectangles to the display through the flush
+ * function (ILI9341FbInit() uses queued DMA SPI transfers).
+ *
+ * Two ways of using it, depending on the RAM given:
+ * - Full framebuffer (buffer of width * height pixels): draw at any time,
+ *   FbRender() sends the dirty rectangles.
+ * - Strips (smaller buffers, e.g. 240 * 40 pixels): the drawing functions only
+ *   record the dirty rectangles. FbRender() splits each one in strips that fit
+ *   the buffer and, for each strip, calls a draw function that redraws the
+ *   scene (clipped to the strip) and flushes it. With two buffers the CPU draws
+ *   the next strip while the previous one is being transferred.
+ *
+ * Pixels are stored in the byte order of the display (RGB565, high byte first),
+ * so the buffers are sent as they are. The colors of the API are plain RGB565.
+ *
+ * This module has no hardware dependencies and is also built on the host tests,
+ * FbWritePpm() dumps the frames there.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 19/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define FB_DIRTY_MAX		8		/*!< Max dirty rectangles, further ones are merged */
+/*==================[typedef]================================================*/
+/**
+ * @brief Rectangle, corners included
+ */
+typedef struct {
+	int16_t x0;		/*!< Left column */
+	int16_t y0;		/*!< Top row */
+	int16_t x1;		/*!< Right column */
+	int16_t y1;		/*!< Bottom row */
+} fb_rect_t;
+
+/**
+ * @brief Point
+ */
+typedef struct {
+	int16_t x;		/*!< Column */
+	int16_t y;		/*!< Row */
+} fb_point_t;
+
+typedef struct fb_s fb_t;
+
+/**
+ * @brief Send an area to the display (it may return before the transfer ends)
+ *
+ * @param area Area of the display
+ * @param pixels First pixel of the area, display byte order
+ * @param stride Pixels between the start of two rows
+ * @param param Parameter of the configuration
+ */
+typedef void (*fb_flush_t)(const fb_rect_t *area, const uint16_t *pixels, uint16_t stride, void *param);
+
+/**
+ * @brief Wait until every transfer started by the flush function has ended
+ */
+typedef void (*fb_wait_t)(void *param);
+
+/**
+ * @brief Draw the scene, called by FbRender() for each strip
+ */
+typedef void (*fb_draw_t)(fb_t *fb, void *param);
+
+/**
+ * @brief Framebuffer configuration
+ */
+typedef struct {
+	uint16_t width;				/*!< Display width in pixels */
+	uint16_t height;			/*!< Display height in pixels */
+	uint16_t *buffers[2];		/*!< Pixel buffers (buffers[1] NULL: single buffer), DMA capable */
+	uint32_t buffer_pixels;		/*!< Size of each buffer, at least width pixels */
+	fb_flush_t flush_p;			/*!< Sends an area to the display */
+	fb_wait_t wait_p;			/*!< Waits for the flushes to end (NULL if flush_p is synchronous) */
+	void *param_p;				/*!< Parameter of flush_p and wait_p */
+} fb_config_t;
+
+/**
+ * @brief Framebuffer statistics
+ */
+typedef struct {
+	uint32_t frames;			/*!< Calls to FbRender() that sent something */
+	uint32_t flushes;			/*!< Calls to the flush function */
+	uint32_t pixels;			/*!< Pixels sent */
+	uint32_t merges;			/*!< Dirty rectangles merged */
+	uint32_t waits;				/*!< Times a buffer was still being sent when needed */
+} fb_stats_t;
+
+/**
+ * @brief Framebuffer state
+ */
+struct fb_s {
+	fb_config_t config;				/*!< Configuration */
+	bool full;						/*!< The buffer holds the whole display */
+	fb_rect_t area;					/*!< Area held by the active buffer (clip of the drawing) */
+	uint16_t *pixels;				/*!< Active buffer, first pixel of area */
+	uint16_t stride;				/*!< Pixels between the start of two rows */
+	uint8_t active;					/*!< Index of the active buffer */
+	bool pending[2];				/*!< The buffer is being sent */
+	bool rendering;					/*!< Inside FbRender(), drawing does not add dirty rectangles */
+	fb_rect_t dirty[FB_DIRTY_MAX];	/*!< Dirty rectangles */
+	uint8_t n_dirty;				/*!< Number of dirty rectangles */
+	fb_stats_t stats;				/*!< Statistics */
+};
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Initializes a framebuffer, the whole display is dirty
+ * @param[out]	fb: Framebuffer
+ * @param[in]  	config: Configuration (copied)
+ * @retval 		true when success, false on invalid configuration
+ */
+bool FbInit(fb_t *fb, const fb_config_t *config);
+
+/**
+ * @brief  		Marks a rectangle to be sent (and redrawn in strip mode)
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	x0, y0, x1, y1: Corners (any order, clipped to the display)
+ * @retval 		None
+ */
+void FbInvalidate(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+/**
+ * @brief  		Sends the dirty rectangles to the display
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	draw_p: Draws the scene for each strip (NULL with a full framebuffer)
+ * @param[in]  	param: Parameter of draw_p
+ * @retval 		None
+ */
+void FbRender(fb_t *fb, fb_draw_t draw_p, void *param);
+
+/**
+ * @brief  		Waits until every flush has ended
+ * @param[in]  	fb: Framebuffer
+ * @retval 		None
+ */
+void FbWait(fb_t *fb);
+
+/**
+ * @brief  		Fills the whole display with a color
+ * @param[in]  	fb: Framebuffer
+ * @param[in]	color: Color (RGB565)
+ * @retval 		None
+ */
+void FbFill(fb_t *fb, uint16_t color);
+
+/**
+ * @brief  		Draws a single pixel
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	x, y: Position
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void FbDrawPixel(fb_t *fb, int16_t x, int16_t y, uint16_t color);
+
+/**
+ * @brief  		Draws a filled rectangle
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	x0, y0, x1, y1: Corners (any order)
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void FbFillRect(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Draws the outline of a rectangle
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	x0, y0, x1, y1: Corners (any order)
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void FbDrawRect(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Draws a RGB565 picture (same format as ILI9341DrawPicture())
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	x, y: Top left corner
+ * @param[in]  	width, height: Size in pixels
+ * @param[in]  	pic: 2 bytes per pixel, high byte first
+ * @retval 		None
+ */
+void FbDrawPicture(fb_t *fb, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t *pic);
+
+/**
+ * @brief  		Draws a 1 bit per pixel bitmap (format of the fonts and icons)
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	x, y: Top left corner
+ * @param[in]  	width, height: Size in pixels
+ * @param[in]  	bits: Rows of (width + 7) / 8 bytes, MSB first
+ * @param[in]  	foreground: Color of the 1 bits (RGB565)
+ * @param[in]  	background: Color of the 0 bits (RGB565)
+ * @retval 		None
+ */
+void FbDrawBitmap(fb_t *fb, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t *bits,
+				  uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Draws a line (spans, see raster.h)
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	x0, y0, x1, y1: Ends, both included
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void FbDrawLine(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Draws an anti-aliased line, blended with the pixels under it
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	x0, y0, x1, y1: Ends, both included
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void FbDrawLineAA(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Draws the outline of a circle
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	x0, y0: Center
+ * @param[in]  	r: Radius
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void FbDrawCircle(fb_t *fb, int16_t x0, int16_t y0, int16_t r, uint16_t color);
+
+/**
+ * @brief  		Draws a filled circle
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	x0, y0: Center
+ * @param[in]  	r: Radius
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void FbFillCircle(fb_t *fb, int16_t x0, int16_t y0, int16_t r, uint16_t color);
+
+/**
+ * @brief  		Draws the outline of a triangle
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	x0, y0, x1, y1, x2, y2: Vertices
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void FbDrawTriangle(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
+/**
+ * @brief  		Draws a filled triangle
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	x0, y0, x1, y1, x2, y2: Vertices
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void FbFillTriangle(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
+/**
+ * @brief  		Draws a filled polygon (even-odd rule)
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	points: Vertices
+ * @param[in]  	n: Number of vertices (3 to RASTER_MAX_VERTICES)
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void FbFillPolygon(fb_t *fb, const fb_point_t *points, uint8_t n, uint16_t color);
+
+/**
+ * @brief  		Draws an anti-aliased filled polygon, blended with the pixels under it
+ * @param[in]  	fb: Framebuffer
+ * @param[in]  	points: Vertices
+ * @param[in]  	n: Number of vertices (3 to RASTER_MAX_VERTICES)
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void FbFillPolygonAA(fb_t *fb, const fb_point_t *points, uint8_t n, uint16_t color);
+
+/**
+ * @brief  		Writes pixels in display byte order to a binary PPM (P6) image file
+ * @param[in]  	path: File path
+ * @param[in]  	pixels: First pixel
+ * @param[in]  	width, height: Size in pixels
+ * @param[in]  	stride: Pixels between the start of two rows
+ * @retval 		true when success
+ */
+bool FbWritePpm(const char *path, const uint16_t *pixels, uint16_t width, uint16_t height, uint16_t stride);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FRAMEBUFFER_H_ */
+
+/*==================[end of file]============================================*/
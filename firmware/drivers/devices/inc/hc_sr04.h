@@ -14,6 +14,14 @@
  * 
  * @note When disconnected return 0.
  * 
+ * HcSr04ReadDistanceInCentimeters() blocks the task until the echo ends, in
+ * 10 us steps. HcSr04InitAsync() measures several sensors in turns from the
+ * interrupts of a timer (one slot per sensor, it triggers it) and of the echo
+ * edges, timestamped with the same timer (1 us). The readings, with the median
+ * of the last distances of the sensor (hc_sr04_ranger.h), go into a queue
+ * (HcSr04GetReading()) and the last one of each sensor can be read at any time
+ * (HcSr04LastDistanceMm()).
+ * 
  * @note When ussing dedicated connector in ESP-EDU:
  * |   HC_SR04      |   EDU-CIAA	|
  * |:--------------:|:-------------:|
@@ -29,6 +37,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | Several sensors measured from edge interrupts (HcSr04InitAsync)		|
  * 
  **/
 
@@ -36,9 +45,33 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "gpio_mcu.h"
+#include "timer_mcu.h"
+#include "hc_sr04_ranger.h"
 /*==================[macros]=================================================*/
+#define HC_SR04_GUARD_US		10000		/*!< Default time for the echoes of a sensor to die out */
+#define HC_SR04_QUEUE_LENGTH	8			/*!< Readings waiting for HcSr04GetReading() */
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Pins of a sensor
+ */
+typedef struct {
+	gpio_t echo;				/*!< GPIO number where echo pin is connected */
+	gpio_t trigger;				/*!< GPIO number where trigger pin is connected */
+} hc_sr04_pins_t;
+
+/**
+ * @brief Configuration of the sensors measured in turns
+ */
+typedef struct {
+	hc_sr04_pins_t sensors[HC_SR04_MAX_SENSORS];	/*!< Pins of each sensor */
+	uint8_t n_sensors;			/*!< Sensors (1 to HC_SR04_MAX_SENSORS) */
+	timer_mcu_t timer;			/*!< Timer of the slots, used only by this driver */
+	uint32_t guard_us;			/*!< Time after the longest echo before the next trigger, 0 for HC_SR04_GUARD_US */
+	uint16_t outlier_mm;		/*!< Distance to the median of an outlier, 0 for no check */
+	void *func_p;				/*!< Pointer to callback function for each reading (called from the ISR), NULL for none */
+	void *param_p;				/*!< Pointer to callback parameter */
+} hc_sr04_config_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -73,6 +106,39 @@ uint16_t HcSr04ReadDistanceInInches(void);
  */
 bool HcSr04Deinit(void);
 
+/**
+ * @brief Starts measuring several sensors in turns, from interrupts.
+ * 
+ * @note Each slot lasts HC_SR04_MAX_ECHO_US plus the guard time, and a sensor
+ * is triggered every n_sensors slots (the datasheet suggests at least 60 ms).
+ * @param config Sensors, timer, guard time, outliers and callback
+ * @return true if the configuration is valid and the timer could be initialized
+ */
+bool HcSr04InitAsync(const hc_sr04_config_t *config);
+
+/**
+ * @brief Take the oldest reading of the queue.
+ * 
+ * @param reading Sensor, result, distance and median
+ * @param wait_ms Time to wait for a reading
+ * @return true if there was a reading
+ */
+bool HcSr04GetReading(hc_sr04_reading_t *reading, uint32_t wait_ms);
+
+/**
+ * @brief Median of the last distances of a sensor, it does not wait.
+ * 
+ * @param sensor Sensor
+ * @return uint16_t distance in mm (0 until the first echo)
+ */
+uint16_t HcSr04LastDistanceMm(uint8_t sensor);
+
+/**
+ * @brief Stop the measurements of HcSr04InitAsync().
+ * 
+ */
+void HcSr04StopAsync(void);
+
 /*==================[end of file]============================================*/
 #endif /* #ifndef HC_SR04_H */
 
@@ -0,0 +1,130 @@
+#ifndef HC_SR04_RANGER_H
+#define HC_SR04_RANGER_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup HC_SR04_Ranger HC-SR04 ranger
+ ** @{
+ * @brief Echoes of several HC-SR04 measured from the times of their edges
+ *
+ * The sensors are triggered in turns (round robin), one per slot. A slot lasts
+ * the longest echo plus a guard time, so the echoes of a sensor have died out
+ * before the next one is triggered, and only the edges of the sensor of the
+ * slot are taken (crosstalk). The width of the echo comes from the times of
+ * its edges (1 us resolution), taken by the interrupts of HcSr04InitAsync().
+ *
+ * Each reading carries the median of the last HC_SR04_MEDIAN distances of its
+ * sensor, and it is marked as an outlier when it is further than outlier_mm
+ * from that median.
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 19/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define HC_SR04_MAX_SENSORS		4		/*!< Sensors triggered in turns */
+#define HC_SR04_MEDIAN			5		/*!< Distances of the median */
+#define HC_SR04_MAX_ECHO_US		17700	/*!< Echo of the maximum distance (300 cm) */
+#define HC_SR04_US_PER_CM		59		/*!< Echo width of a cm (there and back) */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Result of a measurement
+ */
+typedef enum {
+	HC_SR04_OK,					/*!< Distance measured */
+	HC_SR04_OUTLIER,			/*!< Distance measured, too far from the median */
+	HC_SR04_NO_ECHO,			/*!< The echo did not start (sensor disconnected) */
+	HC_SR04_OUT_OF_RANGE,		/*!< The echo lasted over HC_SR04_MAX_ECHO_US */
+} hc_sr04_status_t;
+
+/**
+ * @brief Reading of a sensor
+ */
+typedef struct {
+	uint8_t sensor;				/*!< Sensor */
+	hc_sr04_status_t status;	/*!< Result */
+	uint16_t width_us;			/*!< Echo width */
+	uint16_t mm;				/*!< Distance (0 with no echo) */
+	uint16_t median_mm;			/*!< Median of the last distances of the sensor */
+} hc_sr04_reading_t;
+
+/**
+ * @brief Distances of a sensor
+ */
+typedef struct {
+	uint16_t mm[HC_SR04_MEDIAN];	/*!< Last distances */
+	uint8_t count;					/*!< Distances stored */
+	uint8_t next;					/*!< Next one written */
+	uint16_t median_mm;				/*!< Median of mm */
+} hc_sr04_history_t;
+
+/**
+ * @brief Measurement of the sensors in turns
+ */
+typedef struct {
+	uint8_t n_sensors;			/*!< Sensors */
+	uint8_t current;			/*!< Sensor of the slot */
+	bool active;				/*!< A sensor was triggered and its reading is pending */
+	bool rising;				/*!< The echo of the slot started */
+	uint32_t rise_us;			/*!< Time of the start of the echo */
+	uint16_t outlier_mm;		/*!< Distance to the median of an outlier, 0 for no check */
+	hc_sr04_history_t history[HC_SR04_MAX_SENSORS];	/*!< Distances of each sensor */
+} hc_sr04_ranger_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Initializes the measurement, the first slot is of sensor 0
+ * @param[out] 	ranger: Ranger
+ * @param[in]  	n_sensors: Sensors (1 to HC_SR04_MAX_SENSORS)
+ * @param[in]  	outlier_mm: Distance to the median of an outlier, 0 for no check
+ * @retval 		false for an invalid number of sensors
+ */
+bool HcSr04RangerInit(hc_sr04_ranger_t *ranger, uint8_t n_sensors, uint16_t outlier_mm);
+
+/**
+ * @brief  		Starts a slot: ends the one before and gives the sensor to trigger
+ * @param[in]  	ranger: Ranger
+ * @param[out] 	reading: Reading of the slot before, when it ended with no complete echo
+ * @retval 		true if reading was written
+ */
+bool HcSr04RangerSlot(hc_sr04_ranger_t *ranger, hc_sr04_reading_t *reading);
+
+/**
+ * @brief  		Edge of the echo of a sensor
+ * @param[in]  	ranger: Ranger
+ * @param[in]  	sensor: Sensor, edges of the other sensors are ignored
+ * @param[in]  	level: Level after the edge
+ * @param[in]  	time_us: Time of the edge
+ * @param[out] 	reading: Reading, when the echo ends
+ * @retval 		true if reading was written
+ */
+bool HcSr04RangerEdge(hc_sr04_ranger_t *ranger, uint8_t sensor, bool level, uint32_t time_us,
+					  hc_sr04_reading_t *reading);
+
+/**
+ * @brief  		Distance of an echo, as HcSr04ReadDistanceInCentimeters() (59 us per cm)
+ * @param[in]  	width_us: Echo width
+ * @retval 		Distance in mm
+ */
+uint16_t HcSr04EchoToMm(uint32_t width_us);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* HC_SR04_RANGER_H */
+
+/*==================[end of file]============================================*/
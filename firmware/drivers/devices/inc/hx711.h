@@ -10,6 +10,13 @@
 /** \brief The HX711 amplifier is a breakout board that allows you to easily read load cells to measure weight. It communicates with the EDU-ESP
  * board via I2C.
  * 
+ * HX711_read() waits for the conversion with the CPU busy. HX711_InitAsync()
+ * reads an HX711 from the falling edge of DOUT (data ready): the interrupt
+ * clocks the sample out and pushes it, with its time, into the ring of the
+ * instance (hx711_filter.h). The average, the tare and the value in units are
+ * then read at any time, without waiting. Each hx711_t is an HX711, with its
+ * own pins.
+ * 
  * @author Juan Ignacio Cerrudo
  *
  * @section changelog
@@ -17,14 +24,36 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 30/01/2024 | Document creation		                         						|
+ * | 19/10/2026 | Several HX711 read from the data ready interrupt (HX711_InitAsync)	|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <gpio_mcu.h>
+#include "hx711_filter.h"
 /*==================[macros]=================================================*/
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Configuration of an HX711 read from its interrupt
+ */
+typedef struct {
+	gpio_t pd_sck;			/*!< Clock pin */
+	gpio_t dout;			/*!< Data pin */
+	uint8_t gain;			/*!< 128 or 64 (channel A), 32 (channel B) */
+	uint8_t window;			/*!< Samples averaged (1 to HX711_RING_SIZE) */
+	void *func_p;			/*!< Pointer to callback function for each sample (called from the ISR), NULL for none */
+	void *param_p;			/*!< Pointer to callback parameter */
+} hx711_config_t;
+
+/**
+ * @brief HX711 read from its interrupt
+ */
+typedef struct {
+	hx711_config_t config;	/*!< Configuration */
+	uint8_t pulses;			/*!< PD_SCK pulses of each sample (gain of the next one) */
+	hx711_filter_t filter;	/*!< Samples */
+} hx711_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -120,6 +149,63 @@ void HX711_powerDown(void);
  */
 void HX711_powerUp(void);
 
+/** @fn bool HX711_InitAsync(hx711_t *hx711, const hx711_config_t *config)
+ * @brief Starts reading an HX711 from the falling edge of DOUT
+ * @param[out] hx711 HX711, kept by the driver (it must not be a local variable)
+ * @param[in] config Pins, gain, average and callback
+ * @return false for an invalid gain or window
+ */
+bool HX711_InitAsync(hx711_t *hx711, const hx711_config_t *config);
+
+/** @fn void HX711_setGainAsync(hx711_t *hx711, uint8_t gain)
+ * @brief Set the gain factor; it applies from the second sample on
+ * @param[in] hx711 HX711
+ * @param[in] gain Gain
+ */
+void HX711_setGainAsync(hx711_t *hx711, uint8_t gain);
+
+/** @fn bool HX711_readAsync(hx711_t *hx711, hx711_sample_t *sample)
+ * @brief Last sample, it does not wait
+ * @param[in] hx711 HX711
+ * @param[out] sample Reading and time of the conversion
+ * @return false if there are no samples yet
+ */
+bool HX711_readAsync(hx711_t *hx711, hx711_sample_t *sample);
+
+/** @fn uint32_t HX711_countAsync(hx711_t *hx711)
+ * @brief Samples read since the initialization, to know if there is a new one
+ * @param[in] hx711 HX711
+ * @return Samples
+ */
+uint32_t HX711_countAsync(hx711_t *hx711);
+
+/** @fn int32_t HX711_averageAsync(hx711_t *hx711)
+ * @brief Average of the last window samples
+ * @param[in] hx711 HX711
+ * @return Average
+ */
+int32_t HX711_averageAsync(hx711_t *hx711);
+
+/** @fn void HX711_tareAsync(hx711_t *hx711)
+ * @brief Take the average as the tare weight
+ * @param[in] hx711 HX711
+ */
+void HX711_tareAsync(hx711_t *hx711);
+
+/** @fn void HX711_setScaleAsync(hx711_t *hx711, float scale)
+ * @brief Set the SCALE value (counts per unit)
+ * @param[in] hx711 HX711
+ * @param[in] scale Scale value
+ */
+void HX711_setScaleAsync(hx711_t *hx711, float scale);
+
+/** @fn float HX711_getUnitsAsync(hx711_t *hx711)
+ * @brief Average without the tare weight, divided by SCALE
+ * @param[in] hx711 HX711
+ * @return Value in units
+ */
+float HX711_getUnitsAsync(hx711_t *hx711);
+
 /*==================[internal functions declaration]=========================*/
 // Sends/receives data. 
 uint8_t shiftIn(void);
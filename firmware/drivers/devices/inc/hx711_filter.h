@@ -0,0 +1,138 @@
+#ifndef HX711_FILTER_H
+#define HX711_FILTER_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup HX711_Filter HX711 filter
+ ** @{
+ * @brief Samples of the HX711: decoding, ring with timestamps and filtering
+ *
+ * The interrupt of each HX711 (see HX711_InitAsync()) decodes the 24 bits it
+ * clocks out and pushes the sample into a ring. A running sum of the last
+ * samples gives the average without going through them, so the average,
+ * the tare and the value in units are O(1).
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 19/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define HX711_RING_SIZE		16		/*!< Samples kept, power of 2 */
+#define HX711_DATA_BITS		24		/*!< Bits of a sample */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Sample
+ */
+typedef struct {
+	int32_t value;				/*!< Reading, two's complement */
+	uint32_t time_us;			/*!< Time of the conversion */
+} hx711_sample_t;
+
+/**
+ * @brief Ring of samples and its running average
+ */
+typedef struct {
+	hx711_sample_t samples[HX711_RING_SIZE];	/*!< Last samples */
+	uint8_t head;				/*!< Next sample written */
+	uint8_t count;				/*!< Samples in the ring */
+	uint8_t window;				/*!< Samples averaged */
+	int64_t sum;				/*!< Sum of the last window samples */
+	uint32_t total;				/*!< Samples pushed since the initialization */
+	int32_t offset;				/*!< Tare */
+	float scale;				/*!< Counts per unit */
+	float inv_scale;			/*!< 1 / scale */
+} hx711_filter_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Sign of the 24 bits of a sample
+ * @param[in]  	raw: Bits clocked out, MSB first
+ * @retval 		Reading (-8388608 to 8388607)
+ */
+int32_t Hx711Decode(uint32_t raw);
+
+/**
+ * @brief  		PD_SCK pulses of a conversion, they select the channel and gain of the next one
+ * @param[in]  	gain: 128 (channel A), 64 (channel A) or 32 (channel B)
+ * @retval 		25, 27 or 26 pulses, 0 for other gains
+ */
+uint8_t Hx711Pulses(uint8_t gain);
+
+/**
+ * @brief  		Initializes an empty filter, with no tare and scale 1
+ * @param[out] 	filter: Filter
+ * @param[in]  	window: Samples averaged (1 to HX711_RING_SIZE)
+ * @retval 		false if the window does not fit in the ring
+ */
+bool Hx711FilterInit(hx711_filter_t *filter, uint8_t window);
+
+/**
+ * @brief  		Adds a sample, the oldest one leaves the average
+ * @param[in]  	filter: Filter
+ * @param[in]  	value: Reading
+ * @param[in]  	time_us: Time of the conversion
+ */
+void Hx711FilterPush(hx711_filter_t *filter, int32_t value, uint32_t time_us);
+
+/**
+ * @brief  		Last sample
+ * @param[in]  	filter: Filter
+ * @param[out] 	sample: Sample
+ * @retval 		false if there are no samples yet
+ */
+bool Hx711FilterLast(const hx711_filter_t *filter, hx711_sample_t *sample);
+
+/**
+ * @brief  		Average of the last window samples (or of the ones pushed, if less)
+ * @param[in]  	filter: Filter
+ * @retval 		Average, 0 with no samples
+ */
+int32_t Hx711FilterAverage(const hx711_filter_t *filter);
+
+/**
+ * @brief  		Takes the average as the tare
+ * @param[in]  	filter: Filter
+ */
+void Hx711FilterTare(hx711_filter_t *filter);
+
+/**
+ * @brief  		Sets the tare
+ * @param[in]  	filter: Filter
+ * @param[in]  	offset: Reading with no load
+ */
+void Hx711FilterSetOffset(hx711_filter_t *filter, int32_t offset);
+
+/**
+ * @brief  		Sets the scale
+ * @param[in]  	filter: Filter
+ * @param[in]  	scale: Counts per unit, obtained by calibration (not 0)
+ */
+void Hx711FilterSetScale(hx711_filter_t *filter, float scale);
+
+/**
+ * @brief  		Average without the tare, in units
+ * @param[in]  	filter: Filter
+ * @retval 		(average - offset) / scale
+ */
+float Hx711FilterUnits(const hx711_filter_t *filter);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* HX711_FILTER_H */
+
+/*==================[end of file]============================================*/
@@ -33,6 +33,10 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 18/01/2024 | Document creation		                         |
+ * | 19/10/2026 | Framebuffer flushed by queued DMA transfers	 |
+ * | 19/10/2026 | Lines, circles and triangles drawn by spans	 |
+ * | 19/10/2026 | Text by lines from a glyph cache, numeric fields |
+ * | 19/10/2026 | Text and icons in packed fonts (fonts_pack.h)	 |
  *
  */
 
@@ -41,6 +45,9 @@
 #include "spi_mcu.h"
 #include "fonts.h"
 #include "icons.h"
+#include "text.h"
+#include "fonts_pack.h"
+#include "framebuffer.h"
 /*==================[macros]=================================================*/
 /* LCD settings */
 #define ILI9341_WIDTH       240			/*!< LCD width in pixels */
@@ -141,6 +148,7 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 
 /**
  * @brief  		Draw an integer on the LCD
+ * @note		The digits are drawn in cells as wide as the widest digit, in one window
  * @param[in]  	x: X position of top left corner
  * @param[in]  	y: Y position of top left corner
  * @param[in] 	num: Number to be displayed
@@ -164,6 +172,76 @@ void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* f
  */
 void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background);
 
+/**
+ * @brief  		Draw a string on the LCD in a packed font (see font_pack.h)
+ * @note		Characters the font does not have are skipped
+ * @param[in] 	x: X position of top left corner of first character in string
+ * @param[in]  	y: Y position of top left corner of first character in string
+ * @param[in]  	str: Pointer to first character
+ * @param[in]  	font: Packed font (e.g. &font_pack_30_aa)
+ * @param[in]  	foreground: Color for string (RGB565)
+ * @param[in]  	background: Color for string background (RGB565)
+ * @retval 		None
+ */
+void ILI9341DrawPackedString(uint16_t x, uint16_t y, const char* str, const font_pack_t *font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Draw an icon of a packed icon set on the LCD
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in] 	icon: Icon to be displayed
+ * @param[in]  	icon_font: Packed icons (e.g. &icon_pack_30)
+ * @param[in]  	foreground: Color for icon (RGB565)
+ * @param[in]  	background: Color for icon background (RGB565)
+ * @retval		None
+ */
+void ILI9341DrawPackedIcon(uint16_t x, uint16_t y, icon_t icon, const font_pack_t *icon_font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Initializes a field for a value that is redrawn often (see text.h)
+ * @note		Nothing is drawn until ILI9341DrawField() or ILI9341DrawFieldInt()
+ * @param[out] 	field: Field
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	length: Number of characters (up to TEXT_FIELD_MAX)
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Color for text (RGB565)
+ * @param[in]  	background: Color for text background (RGB565)
+ * @retval 		None
+ */
+void ILI9341FieldInit(text_field_t *field, uint16_t x, uint16_t y, uint8_t length, Font_t *font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Initializes a field in a packed font, as ILI9341FieldInit()
+ * @param[out] 	field: Field
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	length: Number of characters (up to TEXT_FIELD_MAX)
+ * @param[in]  	font: Packed font (e.g. &font_pack_89_digits)
+ * @param[in]  	foreground: Color for text (RGB565)
+ * @param[in]  	background: Color for text background (RGB565)
+ * @retval 		None
+ */
+void ILI9341FieldInitPacked(text_field_t *field, uint16_t x, uint16_t y, uint8_t length, const font_pack_t *font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Draws a string in a field, right aligned. Only the characters
+ * 				that changed since the last call are sent to the LCD.
+ * @param[in]  	field: Field
+ * @param[in]  	str: String
+ * @retval 		None
+ */
+void ILI9341DrawField(text_field_t *field, const char *str);
+
+/**
+ * @brief  		Draws an integer in a field, right aligned. Only the digits
+ * 				that changed since the last call are sent to the LCD.
+ * @param[in]  	field: Field
+ * @param[in]  	num: Number to be displayed
+ * @retval 		None
+ */
+void ILI9341DrawFieldInt(text_field_t *field, int32_t num);
+
 /**
  * @brief  		Gets width and height of box with text
  * @param[in]  	str: Pointer to first character
@@ -185,6 +263,18 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
  */
 void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 
+/**
+ * @brief  		Draws anti-aliased line on the LCD
+ * @param[in]  	x0: X coordinate of starting point
+ * @param[in]  	y0: Y coordinate of starting point
+ * @param[in]  	x1: X coordinate of ending point
+ * @param[in]  	y1: Y coordinate of ending point
+ * @param[in]  	color: Line color (RGB565)
+ * @param[in]  	background: Color under the line, mixed on its edges (RGB565)
+ * @retval 		None
+ */
+void ILI9341DrawLineAA(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color, uint16_t background);
+
 /**
  * @brief  		Draws rectangle on the LCD
  * @param[in]  	x0: X coordinate of top left point
@@ -253,6 +343,25 @@ void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t
  */
 void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
 
+/**
+ * @brief  		Draws filled polygon on the LCD
+ * @param[in]  	points: Vertices
+ * @param[in]  	n: Number of vertices (3 to RASTER_MAX_VERTICES)
+ * @param[in]  	color: Polygon color (RGB565)
+ * @retval 		None
+ */
+void ILI9341FillPolygon(const fb_point_t *points, uint8_t n, uint16_t color);
+
+/**
+ * @brief  		Draws anti-aliased filled polygon on the LCD
+ * @param[in]  	points: Vertices
+ * @param[in]  	n: Number of vertices (3 to RASTER_MAX_VERTICES)
+ * @param[in]  	color: Polygon color (RGB565)
+ * @param[in]  	background: Color under the polygon, mixed on its edges (RGB565)
+ * @retval 		None
+ */
+void ILI9341FillPolygonAA(const fb_point_t *points, uint8_t n, uint16_t color, uint16_t background);
+
 /**
  * @brief  		Draw a picture on the LCD
  * @note		Pictures must be converted to uint8_t array. 
@@ -267,6 +376,36 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
  */
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic);
 
+/**
+ * @brief  		Initializes a framebuffer for the LCD (see framebuffer.h)
+ * @note		Call it after ILI9341Init() and ILI9341Rotate(). Each strip or dirty
+ * 				rectangle is sent with one address window and queued DMA writes, the
+ * 				CPU goes on drawing meanwhile. Static buffers are DMA capable.
+ * @param[out] 	fb: Framebuffer
+ * @param[in]  	buffer_1: Pixel buffer
+ * @param[in]  	buffer_2: Second pixel buffer to draw while the first is sent (NULL if not used)
+ * @param[in]  	buffer_pixels: Size of each buffer in pixels (ILI9341_PIXEL_MAX for a full framebuffer)
+ * @retval 		1 when success, 0 when fails
+ */
+uint8_t ILI9341FbInit(fb_t *fb, uint16_t *buffer_1, uint16_t *buffer_2, uint32_t buffer_pixels);
+
+/**
+ * @brief  		Sends an area of a framebuffer to the LCD (flush function of the framebuffer)
+ * @param[in]  	area: LCD area
+ * @param[in]  	pixels: First pixel of the area, LCD byte order
+ * @param[in]  	stride: Pixels between the start of two rows
+ * @param[in]  	param: Not used
+ * @retval 		None
+ */
+void ILI9341FbFlush(const fb_rect_t *area, const uint16_t *pixels, uint16_t stride, void *param);
+
+/**
+ * @brief  		Waits for the transfers started by ILI9341FbFlush() (wait function of the framebuffer)
+ * @param[in]  	param: Not used
+ * @retval 		None
+ */
+void ILI9341FbWait(void *param);
+
 /**
  * @brief  	De-initializes ILI9341 LCD
  * @param	None
@@ -10,6 +10,11 @@
 /** \brief MPU6050 sensor module is a 6-axis Motion Tracking Device. It combines 3-axis Accelerometer and 3-axis Gyroscope. It communicates with the EDU-ESP
  * board via I2C.
  * 
+ * MPU6050_fifoStart() takes the samples through the FIFO of the sensor: the
+ * data ready interrupt counts them and, every batch samples, wakes up
+ * MPU6050_fifoRead(), that reads all the frames of the FIFO in a single
+ * transaction and unpacks them into an array per axis (mpu6050_fifo.h).
+ * 
  * @author Juan Ignacio Cerrudo
  *
  * @section changelog
@@ -17,11 +22,14 @@
  * |   Date	| Description                                    			|
  * |:----------:|:----------------------------------------------------------------------|
  * | 30/01/2024 | Document creation		                         		|
+ * | 19/10/2026 | Samples read in bursts from the FIFO (MPU6050_fifoStart)		|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "i2c_mcu.h"
+#include "gpio_mcu.h"
+#include "mpu6050_fifo.h"
 /*==================[macros]=================================================*/
 #undef pgm_read_byte
 #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
@@ -407,9 +415,23 @@
 #define MPU6050_DMP_MEMORY_BANKS        8
 #define MPU6050_DMP_MEMORY_BANK_SIZE    256
 #define MPU6050_DMP_MEMORY_CHUNK_SIZE   16
+
+#define MPU6050_FIFO_MAX_FRAMES     (MPU6050_FIFO_SIZE / MPU6050_FIFO_FRAME)    // frames that fit in the FIFO
 // note: DMP code memory blocks defined at end of header file
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Configuration of the samples read from the FIFO
+ */
+typedef struct {
+	gpio_t int_pin;			/*!< Pin of INT (data ready) */
+	uint16_t rate_hz;		/*!< Samples per second (4 to 1000) */
+	uint8_t accel_range;	/*!< MPU6050_ACCEL_FS_2 to MPU6050_ACCEL_FS_16 */
+	uint8_t gyro_range;		/*!< MPU6050_GYRO_FS_250 to MPU6050_GYRO_FS_2000 */
+	uint16_t batch;			/*!< Samples of each read (1 to MPU6050_FIFO_MAX_FRAMES) */
+	void *func_p;			/*!< Pointer to callback function for each batch (called from the ISR), NULL for none */
+	void *param_p;			/*!< Pointer to callback parameter */
+} mpu6050_fifo_config_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -2669,6 +2691,37 @@ uint8_t MPU6050_getDeviceID();
  */
 void MPU6050_setDeviceID(uint8_t id);
 
+// FIFO read in bursts
+/** Start taking the samples through the FIFO.
+ * Wakes up the sensor with the clock of the X gyroscope, sets the rate and
+ * the full scale ranges, and enables the accelerometer, the temperature and
+ * the gyroscope in the FIFO, with the data ready and the FIFO overflow
+ * interrupts. The MPU6050 must be initialized with MPU6050_initialize().
+ * @param config Pin, rate, ranges, batch and callback
+ * @return false for an invalid rate or batch, or if the sensor does not answer
+ */
+bool MPU6050_fifoStart(const mpu6050_fifo_config_t *config);
+
+/** Read the samples in the FIFO.
+ * Waits for a batch, then reads FIFO_COUNT and all the complete frames in a
+ * single transaction. After an overflow the FIFO is reset and nothing is
+ * read.
+ * @param samples Arrays of the samples, filled from the first one
+ * @param wait_ms Longest wait for a batch, 0 to read what there is
+ * @return Samples read
+ */
+uint16_t MPU6050_fifoRead(mpu6050_samples_t *samples, uint32_t wait_ms);
+
+/** Counters of the FIFO.
+ * @return Samples read and overflows
+ */
+mpu6050_fifo_t MPU6050_fifoCounters(void);
+
+/** Stop taking the samples through the FIFO.
+ * Disables the interrupts of the sensor and its FIFO.
+ */
+void MPU6050_fifoStop(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -0,0 +1,121 @@
+#ifndef MPU6050_FIFO_H
+#define MPU6050_FIFO_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup MPU6050_FIFO MPU6050 FIFO
+ ** @{
+ * @brief Frames of the MPU6050 FIFO to arrays of samples
+ *
+ * With the accelerometer, the temperature and the gyroscope in the FIFO
+ * (FIFO_EN = 0xF8), each sample is a frame of 14 bytes, in the order of
+ * their registers: ACCEL_X, Y, Z, TEMP, GYRO_X, Y, Z, big endian. The frames
+ * read in a burst are unpacked into an array per axis (structure of arrays),
+ * multiplied by scales computed once for the full scale ranges.
+ *
+ * When the FIFO overflows the oldest bytes are dropped and the frames are no
+ * longer aligned with the reads: Mpu6050FifoCheck() asks for a reset.
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 19/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define MPU6050_FIFO_SIZE			1024	/*!< Bytes of the FIFO */
+#define MPU6050_FIFO_FRAME			14		/*!< Bytes of a sample */
+#define MPU6050_FIFO_SOURCES		0xF8	/*!< FIFO_EN: temperature, gyroscope and accelerometer */
+#define MPU6050_FIFO_OFLOW_INT		0x10	/*!< FIFO overflow in INT_STATUS */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Scales of the raw values
+ */
+typedef struct {
+	float accel;				/*!< g per count */
+	float gyro;					/*!< deg/s per count */
+} mpu6050_scale_t;
+
+/**
+ * @brief Samples, an array per axis
+ */
+typedef struct {
+	float *ax;					/*!< Acceleration X (g) */
+	float *ay;					/*!< Acceleration Y (g) */
+	float *az;					/*!< Acceleration Z (g) */
+	float *gx;					/*!< Angular rate X (deg/s) */
+	float *gy;					/*!< Angular rate Y (deg/s) */
+	float *gz;					/*!< Angular rate Z (deg/s) */
+	float *temp;				/*!< Temperature (C), NULL to skip it */
+	uint16_t size;				/*!< Length of the arrays */
+} mpu6050_samples_t;
+
+/**
+ * @brief Action after reading FIFO_COUNT and INT_STATUS
+ */
+typedef enum {
+	MPU6050_FIFO_EMPTY,			/*!< No complete frames */
+	MPU6050_FIFO_READ,			/*!< Read the frames */
+	MPU6050_FIFO_RESET,			/*!< Overflow, reset the FIFO */
+} mpu6050_fifo_action_t;
+
+/**
+ * @brief Counters of the FIFO
+ */
+typedef struct {
+	uint32_t frames;			/*!< Frames unpacked */
+	uint32_t overflows;			/*!< Resets after an overflow */
+} mpu6050_fifo_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Computes the scales of the raw values
+ * @param[out] 	scale: Scales
+ * @param[in]  	accel_range: MPU6050_ACCEL_FS_2 to MPU6050_ACCEL_FS_16 (0 to 3)
+ * @param[in]  	gyro_range: MPU6050_GYRO_FS_250 to MPU6050_GYRO_FS_2000 (0 to 3)
+ */
+void Mpu6050ScaleInit(mpu6050_scale_t *scale, uint8_t accel_range, uint8_t gyro_range);
+
+/**
+ * @brief  		Decides what to read from the FIFO
+ * @param[in]  	fifo: Counters, overflows is incremented
+ * @param[in]  	count: FIFO_COUNT
+ * @param[in]  	int_status: INT_STATUS (read once, it is cleared by the read)
+ * @param[in]  	max_frames: Frames that fit in the buffer and in the samples
+ * @param[out] 	frames: Frames to read
+ * @retval 		Action
+ */
+mpu6050_fifo_action_t Mpu6050FifoCheck(mpu6050_fifo_t *fifo, uint16_t count, uint8_t int_status,
+									   uint16_t max_frames, uint16_t *frames);
+
+/**
+ * @brief  		Unpacks frames into the samples
+ * @param[in]  	fifo: Counters, frames is incremented
+ * @param[in]  	scale: Scales
+ * @param[in]  	bytes: n_frames * MPU6050_FIFO_FRAME bytes of the FIFO
+ * @param[in]  	n_frames: Frames
+ * @param[out] 	samples: Samples
+ * @param[in]  	first: Index of the first sample written
+ * @retval 		Samples written (limited by the size of the arrays)
+ */
+uint16_t Mpu6050FifoUnpack(mpu6050_fifo_t *fifo, const mpu6050_scale_t *scale, const uint8_t *bytes,
+						   uint16_t n_frames, mpu6050_samples_t *samples, uint16_t first);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MPU6050_FIFO_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,182 @@
+#ifndef NEOPIXEL_FRAME_H
+#define NEOPIXEL_FRAME_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup NeoPixel_Frame NeoPixel frame
+ ** @{
+ * @brief Colors of a NeoPixel strip, edited before being sent
+ *
+ * A frame holds the colors of the strip and whether they changed since they
+ * were last sent (dirty). The pixels are edited freely and the strip is sent
+ * once (NeoPixelCommit() in neopixel_stripe.h).
+ *
+ * The brightness and the gamma correction are not applied to the colors: a
+ * table of 256 components (gamma of the component scaled by the brightness)
+ * is built once after each brightness change and the encoder looks every
+ * component up in it (Ws2812bEncodeColors()).
+ *
+ * The effects (rainbow, shift and fade) compute the next frame with integer
+ * math.
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 19/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define NEOPIXEL_MAX_BRIGHT		255		/*!< Default brightness */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief 24 bits color
+ *
+ * 0x00FF0000 -> Red
+ * 0x0000FF00 -> Green
+ * 0x000000FF -> Blue
+ */
+typedef uint32_t neopixel_color_t;
+
+/**
+ * @brief Frame
+ */
+typedef struct {
+	neopixel_color_t *colors;	/*!< Colors of the strip */
+	uint16_t length;			/*!< Number of NeoPixels */
+	uint8_t bright;				/*!< Brightness (0 to 255) */
+	bool dirty;					/*!< The colors changed since they were sent */
+	bool lut_valid;				/*!< lut corresponds to bright */
+	uint8_t lut[256];			/*!< Component sent for each component of the colors */
+} neopixel_frame_t;
+
+/**
+ * @brief Effects
+ */
+typedef enum {
+	NEOPIXEL_EFFECT_RAINBOW,	/*!< Gradient of colors, moved by step hues each frame */
+	NEOPIXEL_EFFECT_SHIFT,		/*!< Colors shifted step positions each frame (upwards if positive) */
+	NEOPIXEL_EFFECT_FADE,		/*!< Colors scaled by fade each frame */
+} neopixel_effect_type_t;
+
+/**
+ * @brief State of an effect
+ */
+typedef struct {
+	neopixel_effect_type_t type;	/*!< Effect */
+	int16_t step;					/*!< Hues (rainbow) or positions (shift) per frame */
+	uint16_t hue;					/*!< Rainbow: hue of the first NeoPixel, advanced each frame */
+	uint8_t sat;					/*!< Rainbow: saturation */
+	uint8_t val;					/*!< Rainbow: value */
+	uint8_t reps;					/*!< Rainbow: repetitions of the gradient */
+	uint8_t fade;					/*!< Fade: scale per frame (255 keeps the colors) */
+} neopixel_effect_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Initializes a frame, at full brightness and dirty
+ * @param[out] 	frame: Frame
+ * @param[in]  	colors: Array of length colors, kept as they are
+ * @param[in]  	length: Number of NeoPixels
+ */
+void NeoPixelFrameInit(neopixel_frame_t *frame, neopixel_color_t *colors, uint16_t length);
+
+/**
+ * @brief  		Sets a pixel, pixels out of the strip are ignored
+ * @param[in]  	frame: Frame
+ * @param[in]  	pixel: NeoPixel number on the strip
+ * @param[in]  	color: 24 bits color
+ */
+void NeoPixelFrameSetPixel(neopixel_frame_t *frame, uint16_t pixel, neopixel_color_t color);
+
+/**
+ * @brief  		Sets every pixel to the same color
+ * @param[in]  	frame: Frame
+ * @param[in]  	color: 24 bits color
+ */
+void NeoPixelFrameFill(neopixel_frame_t *frame, neopixel_color_t color);
+
+/**
+ * @brief  		Shifts the colors 1 position, the last one is moved to the other end
+ * @param[in]  	frame: Frame
+ * @param[in]  	upwards: true: upwards, false: downwards
+ */
+void NeoPixelFrameShift(neopixel_frame_t *frame, bool upwards);
+
+/**
+ * @brief  		Changes the brightness, the table is rebuilt by the next NeoPixelFrameLut()
+ * @param[in]  	frame: Frame
+ * @param[in]  	bright: Brightness level (0 to 255)
+ */
+void NeoPixelFrameBrightness(neopixel_frame_t *frame, uint8_t bright);
+
+/**
+ * @brief  		Sets a gradient of colors (see NeoPixelRainbow())
+ * @param[in]  	frame: Frame
+ * @param[in]  	first_hue: Hue of the first NeoPixel
+ * @param[in]  	sat: Saturation of every NeoPixel
+ * @param[in]  	val: Value of every NeoPixel
+ * @param[in]  	reps: Repetitions of the gradient
+ */
+void NeoPixelFrameRainbow(neopixel_frame_t *frame, uint16_t first_hue, uint8_t sat, uint8_t val, uint8_t reps);
+
+/**
+ * @brief  		Scales every component
+ * @param[in]  	frame: Frame
+ * @param[in]  	scale: Scale, 255 keeps the colors and 0 turns them off
+ */
+void NeoPixelFrameFade(neopixel_frame_t *frame, uint8_t scale);
+
+/**
+ * @brief  		Advances an effect one frame
+ * @param[in]  	frame: Frame
+ * @param[inout] effect: Effect, its state is updated
+ */
+void NeoPixelFrameEffect(neopixel_frame_t *frame, neopixel_effect_t *effect);
+
+/**
+ * @brief  		Table of the components sent, gamma[(component * bright) >> 8]
+ * 				as ws2812bSend() did after the brightness of NeoPixelSetArray()
+ * @param[in]  	frame: Frame
+ * @retval 		Table, built only if the brightness changed
+ */
+const uint8_t *NeoPixelFrameLut(neopixel_frame_t *frame);
+
+/**
+ * @brief Convert 3 individual color levels (R, G, B) to a 24bits color data.
+ *
+ * @param red       Red level
+ * @param green     Green level
+ * @param blue      Blue level
+ * @return neopixel_color_t 24 bits color
+ */
+neopixel_color_t NeoPixelRgb2Color(uint8_t red, uint8_t green, uint8_t blue);
+
+/**
+ * @brief Convert hue, value and saturation values to 24 bits color
+ * (using the HSV color model)
+ *
+ * @param hue 16 bits color or shade (HSV color model)
+ * @param sat color saturation (HSV color model)
+ * @param val color value or brightness (HSV color model)
+ * @return neopixel_color_t 24 bits color
+ */
+neopixel_color_t NeoPixelHSV2Color(uint16_t hue, uint8_t sat, uint8_t val);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* NEOPIXEL_FRAME_H */
+
+/*==================[end of file]============================================*/
@@ -14,6 +14,13 @@
  * 
  * @note ESP-EDU have one individual NeoPixel connected to GPIO_8, that can be used with this driver.
  * 
+ * The colors are kept in a frame (neopixel_frame.h). By default every function
+ * sends the stripe, as it always did. With NeoPixelAutoCommit(false) the
+ * functions only change the frame and NeoPixelCommit() sends it once, if it
+ * changed. The brightness and the gamma correction are a table built once
+ * per brightness change. After NeoPixelInitAsync() the stripe is encoded into
+ * a symbol buffer and sent by the RMT (ws2812bSendColorsAsync()).
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -21,6 +28,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | Frame with deferred commit, brightness table, effects, RMT output		|
  * 
  **/
 
@@ -29,6 +37,8 @@
 #include "sdkconfig.h"
 #include "esp_err.h"
 #include "gpio_mcu.h"
+#include "neopixel_frame.h"
+#include "ws2812b_encoder.h"
 /*==================[macros]=================================================*/
 #define BUILT_IN_RGB_LED_PIN          GPIO_8        /*> ESP32-C6-DevKitC-1 NeoPixel it's connected at GPIO_8 */
 #define BUILT_IN_RGB_LED_LENGTH       1             /*> ESP32-C6-DevKitC-1 NeoPixel has one pixel */
@@ -61,14 +71,7 @@
 #define NEOPIXEL_HUE_ROSE             0xEAAA      /*> Hue rose */
 
 /*==================[typedef]================================================*/
-/**
- * @brief 24 bits color
- * 
- * 0x00FF0000 -> Red
- * 0x0000FF00 -> Green
- * 0x000000FF -> Blue
- */
-typedef uint32_t neopixel_color_t;
+
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -82,6 +85,32 @@ typedef uint32_t neopixel_color_t;
  */
 void NeoPixelInit(gpio_t pin, uint16_t len, neopixel_color_t *color_array);
 
+/**
+ * @brief NeoPixel array initialization, sending by the RMT.
+ * 
+ * @param pin           GPIO number where NeoPixel data pin (DIN) will be connected
+ * @param len           Number of NeoPixels in the stripe
+ * @param color_array   Array of len length, to store each NeoPixel color
+ * @param symbols       Array of WS2812B_SYMBOLS(len) symbols the stripe is encoded into
+ * @param next_symbols  Another one, to encode a stripe while the last one is sent (can be NULL)
+ * @return true if the RMT channel could be created
+ */
+bool NeoPixelInitAsync(gpio_t pin, uint16_t len, neopixel_color_t *color_array,
+                       ws2812b_symbol_t *symbols, ws2812b_symbol_t *next_symbols);
+
+/**
+ * @brief Send the stripe after every change (default) or only on NeoPixelCommit().
+ * 
+ * @param enable true: every function sends the stripe, false: they only change the frame
+ */
+void NeoPixelAutoCommit(bool enable);
+
+/**
+ * @brief Send the stripe, if the frame changed since it was last sent.
+ * 
+ */
+void NeoPixelCommit(void);
+
 /**
  * @brief Turn off all NeoPixels.
  * 
@@ -106,6 +135,8 @@ void NeoPixelSetPixel(uint16_t pixel, neopixel_color_t color);
 /**
  * @brief Set all NeoPixels in the array with the color stored in an array.
  * 
+ * @note It is sent at once, with the brightness of the stripe. The frame is
+ * not changed and the next commit sends it again.
  * @param color_array Array of 24 bits color
  */
 void NeoPixelSetArray(neopixel_color_t *color_array);
@@ -126,27 +157,6 @@ void NeoPixelShift(bool upwards);
  */
 void NeoPixelBrightness(uint8_t bright);
 
-/**
- * @brief Convert 3 individual color levels (R, G, B) to a 24bits color data.
- * 
- * @param red       Red level
- * @param green     Green level
- * @param blue      Blue level
- * @return neopixel_color_t 24 bits color
- */
-neopixel_color_t NeoPixelRgb2Color(uint8_t red, uint8_t green, uint8_t blue);
-
-/**
- * @brief Convert hue, value and saturation values to 24 bits color
- * (using the HSV color model)
- * 
- * @param hue 16 bits color or shade (HSV color model)
- * @param sat color saturation (HSV color model)
- * @param val color value or brightness (HSV color model)
- * @return neopixel_color_t 24 bits color
- */
-neopixel_color_t NeoPixelHSV2Color(uint16_t hue, uint8_t sat, uint8_t val);
-
 /**
  * @brief Set all NeoPixels with a gradient of colors. 
  * 
@@ -157,6 +167,13 @@ neopixel_color_t NeoPixelHSV2Color(uint16_t hue, uint8_t sat, uint8_t val);
  */
 void NeoPixelRainbow(uint16_t first_hue, uint8_t sat, uint8_t val, uint8_t reps);
 
+/**
+ * @brief Advance an effect (rainbow, shift or fade) one frame.
+ * 
+ * @param effect Effect, its state is updated (see neopixel_frame.h)
+ */
+void NeoPixelEffect(neopixel_effect_t *effect);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -0,0 +1,173 @@
+#ifndef RASTER_H_
+#define RASTER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Raster Raster
+ ** @{
+ * @brief Span rasteriser for lines, circles and polygons
+ *
+ * The primitives are turned into horizontal runs of pixels (spans). Spans of
+ * the same color are merged while they form a rectangle: consecutive pixels of
+ * a row, or equal spans in consecutive rows (e.g. vertical segments). Each
+ * rectangle is passed to a fill function, so a display needs one address
+ * window and one burst per rectangle instead of one per pixel
+ * (see ILI9341DrawLine()), and a framebuffer fills whole rows (see FbDrawLine()).
+ *
+ * The anti-aliased primitives give each span an alpha (coverage of the pixels),
+ * RasterBlend() mixes the color with what is under it.
+ *
+ * Points are pixel coordinates, the pixel centers. Only the spans inside the
+ * clip rectangle are passed on.
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 19/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "framebuffer.h"
+/*==================[macros]=================================================*/
+#define RASTER_OPAQUE			255		/*!< Alpha of fully covered pixels */
+#define RASTER_MAX_VERTICES		16		/*!< Max vertices of a polygon */
+#define RASTER_MAX_WIDTH		320		/*!< Max width of the clip rectangle for anti-aliased polygons */
+/*==================[typedef]================================================*/
+/**
+ * @brief Fill a rectangle
+ *
+ * @param rect Rectangle, inside the clip rectangle
+ * @param color Color (RGB565)
+ * @param alpha Coverage, RASTER_OPAQUE for solid pixels
+ * @param param Parameter given to RasterInit()
+ */
+typedef void (*raster_fill_t)(const fb_rect_t *rect, uint16_t color, uint8_t alpha, void *param);
+
+/**
+ * @brief Rasteriser state
+ */
+typedef struct {
+	raster_fill_t fill_p;	/*!< Fill function */
+	void *param_p;			/*!< Parameter of fill_p */
+	fb_rect_t clip;			/*!< Clip rectangle */
+	fb_rect_t run;			/*!< Rectangle being merged */
+	uint16_t color;			/*!< Color of run */
+	uint8_t alpha;			/*!< Alpha of run */
+	bool pending;			/*!< run holds spans not yet filled */
+	uint32_t spans;			/*!< Spans inside the clip rectangle */
+	uint32_t fills;			/*!< Calls to fill_p */
+} raster_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Initializes a rasteriser
+ * @param[out]	raster: Rasteriser
+ * @param[in]  	clip: Clip rectangle
+ * @param[in]  	fill_p: Fill function
+ * @param[in]  	param: Parameter of fill_p
+ * @retval 		None
+ */
+void RasterInit(raster_t *raster, const fb_rect_t *clip, raster_fill_t fill_p, void *param);
+
+/**
+ * @brief  		Adds a span, merged with the previous ones when possible
+ * @param[in]  	raster: Rasteriser
+ * @param[in]  	x0, x1: First and last column
+ * @param[in]  	y: Row
+ * @param[in]  	color: Color (RGB565)
+ * @param[in]  	alpha: Coverage
+ * @retval 		None
+ */
+void RasterSpan(raster_t *raster, int16_t x0, int16_t x1, int16_t y, uint16_t color, uint8_t alpha);
+
+/**
+ * @brief  		Fills the spans still being merged (the primitives call it when they end)
+ * @param[in]  	raster: Rasteriser
+ * @retval 		None
+ */
+void RasterFlush(raster_t *raster);
+
+/**
+ * @brief  		Line, both ends included (Bresenham)
+ * @param[in]  	raster: Rasteriser
+ * @param[in]  	x0, y0, x1, y1: Ends
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void RasterLine(raster_t *raster, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Anti-aliased line, both ends included (Wu)
+ * @param[in]  	raster: Rasteriser
+ * @param[in]  	x0, y0, x1, y1: Ends
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void RasterLineAA(raster_t *raster, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Circle outline
+ * @param[in]  	raster: Rasteriser
+ * @param[in]  	xc, yc: Center
+ * @param[in]  	r: Radius
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void RasterCircle(raster_t *raster, int16_t xc, int16_t yc, int16_t r, uint16_t color);
+
+/**
+ * @brief  		Filled circle, same pixels as the outline and its inside
+ * @param[in]  	raster: Rasteriser
+ * @param[in]  	xc, yc: Center
+ * @param[in]  	r: Radius
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void RasterFillCircle(raster_t *raster, int16_t xc, int16_t yc, int16_t r, uint16_t color);
+
+/**
+ * @brief  		Filled polygon (even-odd rule), the pixels on the edges included
+ * @param[in]  	raster: Rasteriser
+ * @param[in]  	points: Vertices
+ * @param[in]  	n: Number of vertices (3 to RASTER_MAX_VERTICES)
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void RasterFillPolygon(raster_t *raster, const fb_point_t *points, uint8_t n, uint16_t color);
+
+/**
+ * @brief  		Anti-aliased filled polygon (even-odd rule, 4x16 samples per pixel)
+ * @note		Not reentrant, it uses a static coverage row
+ * @param[in]  	raster: Rasteriser
+ * @param[in]  	points: Vertices
+ * @param[in]  	n: Number of vertices (3 to RASTER_MAX_VERTICES)
+ * @param[in]  	color: Color (RGB565)
+ * @retval 		None
+ */
+void RasterFillPolygonAA(raster_t *raster, const fb_point_t *points, uint8_t n, uint16_t color);
+
+/**
+ * @brief  		Mixes two colors
+ * @param[in]  	foreground: Color (RGB565)
+ * @param[in]  	background: Color (RGB565)
+ * @param[in]  	alpha: Weight of foreground, RASTER_OPAQUE gives foreground
+ * @retval 		Color (RGB565)
+ */
+uint16_t RasterBlend(uint16_t foreground, uint16_t background, uint8_t alpha);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RASTER_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,238 @@
+#ifndef TEXT_H_
+#define TEXT_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Text Text
+ ** @{
+ * @brief Text rendering with a glyph cache, for displays with address windows
+ *
+ * Glyphs of the 1 bpp fonts (fonts.h) are expanded once to RGB565 and kept in
+ * a cache, least recently used first out, keyed by font, character and colors.
+ * A text line is laid out whole: the display gets one address window for the
+ * line and the pixels are streamed in bands of rows, the 1 pixel gaps between
+ * characters drawn with the background color.
+ *
+ * Fields (text_field_t) are fixed pitch texts, for numeric readouts: every
+ * character is centered in a cell as wide as the widest digit, so a new value
+ * only redraws the cells that changed, one window per run of changed cells.
+ *
+ * Pixels are in display byte order, as in the framebuffer (framebuffer.h).
+ * Glyphs larger than the cache are expanded straight into the band each time.
+ * Packed fonts (font_pack.h) are not cached, their glyphs are decoded row by
+ * row into the band.
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 19/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fonts.h"
+#include "font_pack.h"
+#include "framebuffer.h"
+/*==================[macros]=================================================*/
+#define TEXT_CACHE_ENTRIES	48		/*!< Max glyphs in the cache */
+#define TEXT_FIELD_MAX		12		/*!< Max characters of a field */
+/*==================[typedef]================================================*/
+/**
+ * @brief Sets the address window of the display and starts a memory write
+ *
+ * @param area Window, inside the display
+ * @param param Parameter of the configuration
+ */
+typedef void (*text_window_t)(const fb_rect_t *area, void *param);
+
+/**
+ * @brief Sends pixels to the window, row by row
+ *
+ * @param pixels Pixels (display byte order)
+ * @param count Number of pixels
+ * @param param Parameter of the configuration
+ */
+typedef void (*text_write_t)(const uint16_t *pixels, uint32_t count, void *param);
+
+/**
+ * @brief Text renderer configuration
+ */
+typedef struct {
+	uint16_t width;				/*!< Display width */
+	uint16_t height;			/*!< Display height */
+	uint16_t *cache;			/*!< Glyph cache memory, NULL for none */
+	uint32_t cache_pixels;		/*!< Size of cache, in pixels */
+	uint16_t *band;				/*!< Band buffer, at least a display row */
+	uint32_t band_pixels;		/*!< Size of band, in pixels */
+	text_window_t window_p;		/*!< Window function */
+	text_write_t write_p;		/*!< Write function */
+	void *param_p;				/*!< Parameter of window_p and write_p */
+} text_config_t;
+
+/**
+ * @brief Glyph in the cache
+ */
+typedef struct {
+	const Font_t *font;			/*!< Font */
+	char code;					/*!< Character */
+	uint16_t foreground;		/*!< Color of the set bits */
+	uint16_t background;		/*!< Color of the clear bits */
+	uint32_t offset;			/*!< Position in the cache */
+	uint32_t pixels;			/*!< Width x font height */
+	uint32_t used;				/*!< Last use (tick) */
+} text_glyph_t;
+
+/**
+ * @brief Counters, to measure the cache and the traffic to the display
+ */
+typedef struct {
+	uint32_t windows;			/*!< Address windows */
+	uint32_t pixels;			/*!< Pixels written */
+	uint32_t hits;				/*!< Lookups found in the cache (one per glyph and band) */
+	uint32_t misses;			/*!< Lookups not found */
+	uint32_t evictions;			/*!< Glyphs dropped from the cache */
+} text_stats_t;
+
+/**
+ * @brief Text renderer
+ */
+typedef struct {
+	text_config_t config;		/*!< Configuration */
+	text_glyph_t glyphs[TEXT_CACHE_ENTRIES];	/*!< Cached glyphs, in cache order */
+	uint8_t n_glyphs;			/*!< Glyphs in the cache */
+	uint32_t cache_used;		/*!< Pixels of the cache in use */
+	uint32_t tick;				/*!< Lookups counter, for the LRU order */
+	text_stats_t stats;			/*!< Counters */
+} text_t;
+
+/**
+ * @brief Fixed pitch text, redrawn by cells
+ */
+typedef struct {
+	int16_t x;					/*!< Left column */
+	int16_t y;					/*!< Top row */
+	const Font_t *font;			/*!< Font (NULL for a packed font) */
+	const font_pack_t *pack;	/*!< Packed font (NULL for a font) */
+	uint16_t foreground;		/*!< Text color */
+	uint16_t background;		/*!< Background color */
+	uint8_t length;				/*!< Number of cells */
+	uint8_t cell;				/*!< Cell width (widest digit) */
+	bool shown;					/*!< text is on the display */
+	char text[TEXT_FIELD_MAX];	/*!< Characters on the display */
+} text_field_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Initializes a text renderer, with an empty cache
+ * @param[out]	text: Text renderer
+ * @param[in]  	config: Configuration
+ * @retval 		true if the configuration is valid
+ */
+bool TextInit(text_t *text, const text_config_t *config);
+
+/**
+ * @brief  		Draws a line of text, one window for all of it
+ * @param[in]  	text: Text renderer
+ * @param[in]  	x, y: Top left corner
+ * @param[in]  	str: Text, it ends at '\0' or '\n'
+ * @param[in]  	font: Font
+ * @param[in]  	foreground: Text color (RGB565)
+ * @param[in]  	background: Background color (RGB565)
+ * @retval 		Characters drawn, the ones that fit up to the right edge
+ */
+uint16_t TextDraw(text_t *text, int16_t x, int16_t y, const char *str, const Font_t *font,
+				  uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Draws a line of text in a packed font, one window for all of it
+ * @note		Characters the font does not have are skipped
+ * @param[in]  	text: Text renderer
+ * @param[in]  	x, y: Top left corner
+ * @param[in]  	str: Text, it ends at '\0' or '\n'
+ * @param[in]  	font: Packed font
+ * @param[in]  	foreground: Text color (RGB565)
+ * @param[in]  	background: Background color (RGB565)
+ * @retval 		Characters drawn, the ones that fit up to the right edge
+ */
+uint16_t TextDrawPacked(text_t *text, int16_t x, int16_t y, const char *str, const font_pack_t *font,
+						uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Draws a glyph of a packed font (e.g. an icon)
+ * @param[in]  	text: Text renderer
+ * @param[in]  	x, y: Top left corner
+ * @param[in]  	code: Character or icon_t
+ * @param[in]  	font: Packed font
+ * @param[in]  	foreground: Color (RGB565)
+ * @param[in]  	background: Background color (RGB565)
+ * @retval 		None
+ */
+void TextDrawPackedGlyph(text_t *text, int16_t x, int16_t y, uint8_t code, const font_pack_t *font,
+						 uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Width of a text, with the gaps between characters
+ * @param[in]  	font: Font
+ * @param[in]  	str: Text
+ * @param[in]  	n: Number of characters
+ * @retval 		Width in pixels
+ */
+uint16_t TextWidth(const Font_t *font, const char *str, uint16_t n);
+
+/**
+ * @brief  		Initializes a field, nothing is drawn until TextFieldDraw()
+ * @param[out]	field: Field
+ * @param[in]  	x, y: Top left corner
+ * @param[in]  	length: Number of cells (up to TEXT_FIELD_MAX)
+ * @param[in]  	font: Font
+ * @param[in]  	foreground: Text color (RGB565)
+ * @param[in]  	background: Background color (RGB565)
+ * @retval 		true if the length is valid
+ */
+bool TextFieldInit(text_field_t *field, int16_t x, int16_t y, uint8_t length, const Font_t *font,
+				   uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Initializes a field in a packed font, as TextFieldInit()
+ * @param[out]	field: Field
+ * @param[in]  	x, y: Top left corner
+ * @param[in]  	length: Number of cells (up to TEXT_FIELD_MAX)
+ * @param[in]  	font: Packed font
+ * @param[in]  	foreground: Text color (RGB565)
+ * @param[in]  	background: Background color (RGB565)
+ * @retval 		true if the length is valid
+ */
+bool TextFieldInitPacked(text_field_t *field, int16_t x, int16_t y, uint8_t length, const font_pack_t *font,
+						 uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Shows a text in a field, only the cells that changed are drawn
+ * @param[in]  	text: Text renderer
+ * @param[in]  	field: Field
+ * @param[in]  	str: Text, right aligned, only its last characters if it is longer than the field
+ * @retval 		None
+ */
+void TextFieldDraw(text_t *text, text_field_t *field, const char *str);
+
+/**
+ * @brief  		Makes the next TextFieldDraw() draw all the cells (e.g. after clearing the display)
+ * @param[in]  	field: Field
+ * @retval 		None
+ */
+void TextFieldInvalidate(text_field_t *field);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TEXT_H_ */
+
+/*==================[end of file]============================================*/
@@ -11,6 +11,12 @@
 /** \brief Driver for handling WS2812B RGB leds.
  *
  * @note For handling NeoPixels arrays use "neopixel_stripe.h".
+ *
+ * ws2812bSend() sends a LED bit-banging the pin, with the CPU busy (and the
+ * interrupts breaking the timing). ws2812bSendAsync() encodes a whole strip
+ * into a symbol buffer (ws2812b_encoder.h) and the RMT sends it while the CPU
+ * goes on. With two buffers the next frame is encoded while the last one is
+ * being sent.
  * 
  * @author Albano Peñalva
  *
@@ -19,6 +25,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | Strips sent by the RMT from a symbol buffer (ws2812bSendAsync)		|
+ * | 19/10/2026 | 24 bits colors (ws2812bSendColorsAsync), ws2812bSendRaw			|
  * 
  **/
 
@@ -27,18 +35,21 @@
 #include "sdkconfig.h"
 #include "esp_err.h"
 #include "gpio_mcu.h"
+#include "ws2812b_encoder.h"
 /*==================[macros]=================================================*/
+#define WS2812B_RMT_RESOLUTION	10000000	/*!< RMT tick frequency (100 ns) */
 
 /*==================[typedef]================================================*/
 /**
- * @brief NeoPixel color
- * 
+ * @brief Configuration of the RMT output
  */
-typedef struct rgb_led{
-	 uint8_t green;  		// Green
-	 uint8_t red;  			// Red
-	 uint8_t blue;  		// Blue
-} rgb_led_t;
+typedef struct {
+	gpio_t pin;							/*!< GPIO of the data pin (DIN) */
+	uint16_t max_leds;					/*!< LEDs of the longest strip */
+	ws2812b_symbol_t *buffers[2];		/*!< WS2812B_SYMBOLS(max_leds) symbols each. The second one can be NULL (no double buffering) */
+	void *func_p;						/*!< Pointer to callback function for the end of a strip (called from the ISR), NULL for none */
+	void *param_p;						/*!< Pointer to callback parameter */
+} ws2812b_config_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -57,12 +68,53 @@ void ws2812bInit(gpio_t pin);
  */
 void ws2812bSend(rgb_led_t led_color);
 
+/**
+ * @brief Send color information to NeoPixel, without gamma correction.
+ * 
+ * @param data NeoPixel color, as it is sent
+ */
+void ws2812bSendRaw(rgb_led_t led_color);
+
 /**
  * @brief Send a ret command to NeoPixel.
  * 
  */
 void ws2812bSendRet(void);
 
+/**
+ * @brief NeoPixel initialization, sending by the RMT.
+ * 
+ * @param config Pin, buffers and callback
+ * @return true if the RMT channel could be created
+ */
+bool ws2812bInitAsync(const ws2812b_config_t *config);
+
+/**
+ * @brief Send the colors of a strip, and the ret command. It returns once the
+ * strip is encoded, before it is sent.
+ * 
+ * @note When every buffer is being sent it waits for the oldest one.
+ * @param leds Colors of the strip, they can be changed as soon as it returns
+ * @param n Number of LEDs (up to max_leds)
+ * @param lut Table applied to every component, NULL for the gamma correction of ws2812bSend()
+ */
+void ws2812bSendAsync(const rgb_led_t *leds, uint16_t n, const uint8_t *lut);
+
+/**
+ * @brief Send the 24 bits colors of a strip (0x00RRGGBB), as ws2812bSendAsync().
+ * 
+ * @param colors Colors of the strip, they can be changed as soon as it returns
+ * @param n Number of LEDs (up to max_leds)
+ * @param lut Table applied to every component, NULL for the gamma correction of ws2812bSend()
+ */
+void ws2812bSendColorsAsync(const uint32_t *colors, uint16_t n, const uint8_t *lut);
+
+/**
+ * @brief Wait until every strip sent with ws2812bSendAsync() has been sent.
+ * 
+ */
+void ws2812bWaitAsync(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -0,0 +1,115 @@
+#ifndef WS2812B_ENCODER_H
+#define WS2812B_ENCODER_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup WS2812B_Encoder WS2812B encoder
+ ** @{
+ * @brief Colors of a WS2812B strip to the pulses the RMT sends
+ *
+ * Each bit of a LED (green, red and blue, MSB first) is one symbol: a high
+ * and a low level with their durations in ticks of the RMT clock. The symbols
+ * have the layout of rmt_symbol_word_t, so a whole strip is encoded once into
+ * a buffer that the RMT sends on its own (see ws2812bSendAsync()). A last
+ * symbol keeps the line low to latch the colors.
+ *
+ * The symbols of the 16 nibbles are computed at initialization, a byte is
+ * encoded with two copies of 4 symbols.
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 19/10/2026 | Document creation		                         |
+ * | 19/10/2026 | 24 bits colors, gamma table from ws2812b.c	 |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define WS2812B_T0H_NS			400		/*!< High time of a 0 */
+#define WS2812B_T0L_NS			850		/*!< Low time of a 0 */
+#define WS2812B_T1H_NS			800		/*!< High time of a 1 */
+#define WS2812B_T1L_NS			450		/*!< Low time of a 1 */
+#define WS2812B_RESET_US		280		/*!< Low time that latches the colors (50 us on older parts) */
+#define WS2812B_BITS_PER_LED	24		/*!< Green, red and blue */
+
+/**
+ * @brief Symbols of a strip of n LEDs, with the reset
+ */
+#define WS2812B_SYMBOLS(n)		((uint32_t)(n) * WS2812B_BITS_PER_LED + 1)
+/*==================[typedef]================================================*/
+/**
+ * @brief NeoPixel color
+ *
+ */
+typedef struct rgb_led{
+	 uint8_t green;  		// Green
+	 uint8_t red;  			// Red
+	 uint8_t blue;  		// Blue
+} rgb_led_t;
+
+/**
+ * @brief RMT symbol: duration0 (bits 0-14), level0 (15), duration1 (16-30), level1 (31)
+ */
+typedef uint32_t ws2812b_symbol_t;
+
+/**
+ * @brief Encoder
+ */
+typedef struct {
+	ws2812b_symbol_t nibble[16][4];	/*!< Symbols of each nibble, MSB first */
+	ws2812b_symbol_t reset;			/*!< Low level that latches the colors */
+} ws2812b_encoder_t;
+/*==================[external data declaration]==============================*/
+/**
+ * @brief Gamma correction of a color component
+ */
+extern const uint8_t ws2812b_gamma[256];
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Computes the symbols of a clock
+ * @param[out] 	encoder: Encoder
+ * @param[in]  	resolution_hz: RMT tick frequency (at least 10 MHz)
+ * @retval 		false if the timings do not fit in the symbols at that frequency
+ */
+bool Ws2812bEncoderInit(ws2812b_encoder_t *encoder, uint32_t resolution_hz);
+
+/**
+ * @brief  		Encodes the colors of a strip
+ * @param[in]  	encoder: Encoder
+ * @param[in]  	leds: Colors
+ * @param[in]  	n: Number of LEDs
+ * @param[in]  	lut: Table applied to every component (e.g. gamma), NULL for none
+ * @param[out] 	symbols: WS2812B_SYMBOLS(n) symbols
+ * @retval 		Number of symbols, WS2812B_SYMBOLS(n)
+ */
+uint32_t Ws2812bEncode(const ws2812b_encoder_t *encoder, const rgb_led_t *leds, uint16_t n,
+					   const uint8_t *lut, ws2812b_symbol_t *symbols);
+
+/**
+ * @brief  		Encodes 24 bits colors (0x00RRGGBB, as neopixel_color_t)
+ * @param[in]  	encoder: Encoder
+ * @param[in]  	colors: Colors
+ * @param[in]  	n: Number of LEDs
+ * @param[in]  	lut: Table applied to every component (e.g. gamma and brightness)
+ * @param[out] 	symbols: WS2812B_SYMBOLS(n) symbols
+ * @retval 		Number of symbols, WS2812B_SYMBOLS(n)
+ */
+uint32_t Ws2812bEncodeColors(const ws2812b_encoder_t *encoder, const uint32_t *colors, uint16_t n,
+							 const uint8_t *lut, ws2812b_symbol_t *symbols);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* WS2812B_ENCODER_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,143 @@
+/**
+ * @file font_pack.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include "font_pack.h"
+#include "raster.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static inline uint16_t Swap(uint16_t color){
+	return (uint16_t)(color << 8 | color >> 8);
+}
+
+static inline uint16_t RowBytes(const font_pack_decoder_t *decoder){
+	return (decoder->width * decoder->bpp + 7) / 8;
+}
+
+static void RawRow(font_pack_decoder_t *decoder, uint16_t *row){
+	const uint8_t *src = decoder->src;
+	uint8_t bpp = decoder->bpp;
+	uint8_t per_byte = 8 / bpp;
+
+	/* A byte at a time, as the 1 bpp fonts are expanded */
+	for(uint16_t j = 0; j < decoder->width; j += per_byte){
+		uint8_t bits = *src++;
+		uint16_t n = (decoder->width - j < per_byte) ? decoder->width - j : per_byte;
+		for(uint16_t k = 0; k < n; k++, bits <<= bpp){
+			*row++ = decoder->palette[bits >> (8 - bpp)];
+		}
+	}
+	decoder->src += RowBytes(decoder);
+}
+/*==================[external functions definition]==========================*/
+const font_pack_glyph_t * FontPackGlyph(const font_pack_t *font, uint8_t code){
+	for(uint8_t i = 0; i < font->n_ranges; i++){
+		const font_pack_range_t *range = &font->ranges[i];
+		if(code >= range->first && code - range->first < range->count){
+			return &font->glyphs[range->glyph + code - range->first];
+		}
+	}
+	return NULL;
+}
+
+uint16_t FontPackWidth(const font_pack_t *font, const char *str, uint16_t n){
+	uint16_t width = 0;
+	for(uint16_t i = 0; i < n; i++){
+		const font_pack_glyph_t *glyph = FontPackGlyph(font, (uint8_t)str[i]);
+		if(glyph != NULL){
+			width += glyph->width + 1;
+		}
+	}
+	/* No gap after the last character */
+	return width ? width - 1 : 0;
+}
+
+void FontPackPalette(const font_pack_t *font, uint16_t foreground, uint16_t background, uint16_t *palette){
+	uint8_t levels = 1 << font->bpp;
+	for(uint8_t i = 0; i < levels; i++){
+		palette[i] = Swap(RasterBlend(foreground, background, i * RASTER_OPAQUE / (levels - 1)));
+	}
+}
+
+void FontPackDecoderInit(font_pack_decoder_t *decoder, const font_pack_t *font,
+						 const font_pack_glyph_t *glyph, const uint16_t *palette){
+	decoder->src = &font->data[glyph->offset];
+	decoder->palette = palette;
+	decoder->width = glyph->width;
+	decoder->bpp = font->bpp;
+	decoder->raw = glyph->flags & FONT_PACK_RAW;
+	decoder->level = 0;
+	decoder->run = 0;
+}
+
+void FontPackRow(font_pack_decoder_t *decoder, uint16_t *row){
+	const uint8_t *src = decoder->src;
+	uint16_t run = decoder->run;
+	uint16_t color = decoder->palette[decoder->level];
+	uint8_t mask = (1 << decoder->bpp) - 1;
+	uint16_t n = decoder->width;
+
+	if(decoder->raw){
+		RawRow(decoder, row);
+		return;
+	}
+	/* Runs go on from one row to the next. The state is kept in locals, the
+	 * rows written could alias it. */
+	while(n > 0){
+		uint16_t count;
+		if(run == 0){
+			uint8_t byte = *src++;
+			decoder->level = byte & mask;
+			color = decoder->palette[decoder->level];
+			run = (byte >> decoder->bpp) + 1;
+		}
+		count = (run < n) ? run : n;
+		run -= count;
+		n -= count;
+		while(count--){
+			*row++ = color;
+		}
+	}
+	decoder->src = src;
+	decoder->run = run;
+}
+
+void FontPackSkip(font_pack_decoder_t *decoder, uint16_t rows){
+	uint32_t n = (uint32_t)rows * decoder->width;
+
+	if(decoder->raw){
+		decoder->src += rows * RowBytes(decoder);
+		return;
+	}
+	while(n > 0){
+		uint16_t count;
+		if(decoder->run == 0){
+			uint8_t byte = *decoder->src++;
+			decoder->level = byte & ((1 << decoder->bpp) - 1);
+			decoder->run = (byte >> decoder->bpp) + 1;
+		}
+		count = (decoder->run < n) ? decoder->run : n;
+		decoder->run -= count;
+		n -= count;
+	}
+}
+
+/*==================[end of file]============================================*/
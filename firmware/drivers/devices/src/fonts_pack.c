@@ -0,0 +1,2622 @@
+/**
+ * @file fonts_pack.c
+ * @brief Packed fonts and icons, generated by tools/fontpack. Do not edit.
+ *
+ *   fontpack -s fonts_pack.c -i fonts_pack.h font_pack_22=font_22 font_pack_30=font_30 font_pack_30_aa=font_59:4:2 font_pack_59_digits=font_59:1:1:-0-9.: font_pack_89_digits=font_89:1:1:-0-9.: icon_pack_30=icon_30
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "fonts_pack.h"
+/*==================[internal data definition]===============================*/
+static const uint8_t font_pack_22_data[] = {
+	/* ' ', 2 pixels wide */
+	0x56,
+	/* '!', 3 pixels wide */
+	0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0xC0,
+	0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+	/* '"', 6 pixels wide */
+	0x16, 0x03, 0x02, 0x07, 0x02, 0x07, 0x02, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x03, 0xA6,
+	/* '#', 11 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x7F, 0xE0, 0x7F, 0xE0,
+	0x18, 0xC0, 0x10, 0x80, 0x10, 0x80, 0x31, 0x80, 0xFF, 0xE0, 0xFF, 0xE0, 0x31, 0x80, 0x31, 0x80,
+	0x31, 0x80, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* '$', 10 pixels wide */
+	0x06, 0x00, 0x04, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x7F, 0x80, 0x60, 0x80, 0xC0, 0x00, 0xE0, 0x00,
+	0x60, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0xC1, 0x80,
+	0xFF, 0x80, 0x7E, 0x00, 0x18, 0x00, 0x18, 0x00, 0x10, 0x00, 0x00, 0x00,
+	/* '%', 16 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x3C, 0x18, 0x44, 0x10, 0xC6, 0x30, 0xC6, 0x60, 0xC6, 0x40, 0xC6, 0xC0,
+	0x45, 0x80, 0x7B, 0x00, 0x03, 0x1E, 0x06, 0x22, 0x0C, 0x63, 0x08, 0x63, 0x18, 0x63, 0x30, 0x63,
+	0x20, 0x22, 0x60, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* '&', 14 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x31, 0x80,
+	0x1F, 0x00, 0x1C, 0x18, 0x3E, 0x18, 0x67, 0x18, 0xE3, 0x98, 0xC1, 0xF0, 0xE0, 0xF0, 0x60, 0xF8,
+	0x7F, 0xDC, 0x1F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ''', 2 pixels wide */
+	0x06, 0x11, 0x00, 0x01, 0x38,
+	/* '(', 4 pixels wide */
+	0x00, 0x30, 0x30, 0x20, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+	0x60, 0x60, 0x60, 0x20, 0x30, 0x30,
+	/* ')', 4 pixels wide */
+	0x00, 0xC0, 0xC0, 0x40, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x60, 0x60, 0x60, 0x40, 0xC0, 0xC0,
+	/* '*', 8 pixels wide */
+	0x00, 0x18, 0x18, 0xDB, 0x76, 0x18, 0x76, 0xDB, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* '+', 10 pixels wide */
+	0x6A, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x06, 0x27, 0x06, 0x03, 0x0E, 0x03,
+	0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x6A,
+	/* ',', 3 pixels wide */
+	0x5A, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x08,
+	/* '-', 6 pixels wide */
+	0x82, 0x17, 0x6A,
+	/* '.', 3 pixels wide */
+	0x58, 0x03, 0x00, 0x09, 0x18,
+	/* '/', 9 pixels wide */
+	0x1E, 0x03, 0x0C, 0x03, 0x0A, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0A, 0x03, 0x0C, 0x03, 0x0C, 0x01,
+	0x0C, 0x03, 0x0C, 0x03, 0x0A, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0A, 0x03, 0x0C, 0x03, 0x0C, 0x01,
+	0x0C, 0x03, 0x0C, 0x03, 0x0A, 0x03, 0x0C, 0x03, 0x1E,
+	/* '0', 10 pixels wide */
+	0x40, 0x07, 0x08, 0x0D, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x06, 0x09, 0x0A, 0x07, 0x0A, 0x07,
+	0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x09, 0x06, 0x03, 0x02, 0x03, 0x06, 0x03,
+	0x02, 0x0D, 0x08, 0x07, 0x54,
+	/* '1', 9 pixels wide */
+	0x3C, 0x03, 0x08, 0x07, 0x04, 0x05, 0x00, 0x03, 0x04, 0x03, 0x02, 0x03, 0x0C, 0x03, 0x0C, 0x03,
+	0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x04, 0x23,
+	0x46,
+	/* '2', 10 pixels wide */
+	0x3E, 0x09, 0x04, 0x0F, 0x02, 0x03, 0x06, 0x05, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0C, 0x03,
+	0x0E, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x27, 0x4E,
+	/* '3', 10 pixels wide */
+	0x3E, 0x09, 0x04, 0x0F, 0x02, 0x03, 0x06, 0x05, 0x0E, 0x03, 0x0E, 0x03, 0x0C, 0x03, 0x06, 0x09,
+	0x08, 0x0B, 0x10, 0x03, 0x10, 0x03, 0x0E, 0x03, 0x0E, 0x07, 0x08, 0x17, 0x04, 0x09, 0x54,
+	/* '4', 11 pixels wide */
+	0x4C, 0x05, 0x0C, 0x07, 0x0C, 0x07, 0x0A, 0x03, 0x00, 0x03, 0x08, 0x03, 0x02, 0x03, 0x08, 0x03,
+	0x02, 0x03, 0x06, 0x03, 0x04, 0x03, 0x06, 0x01, 0x06, 0x03, 0x04, 0x03, 0x06, 0x03, 0x02, 0x03,
+	0x08, 0x03, 0x02, 0x2B, 0x0C, 0x03, 0x10, 0x03, 0x10, 0x03, 0x5A,
+	/* '5', 10 pixels wide */
+	0x3C, 0x0F, 0x02, 0x0F, 0x02, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x0D, 0x04, 0x0F, 0x0E, 0x05,
+	0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x07, 0x08, 0x03, 0x00, 0x0F, 0x04, 0x0B, 0x54,
+	/* '6', 10 pixels wide */
+	0x42, 0x07, 0x06, 0x0D, 0x02, 0x05, 0x0C, 0x03, 0x0C, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x00, 0x09,
+	0x02, 0x11, 0x00, 0x05, 0x06, 0x09, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x03, 0x00, 0x03, 0x06, 0x03,
+	0x02, 0x0F, 0x04, 0x09, 0x54,
+	/* '7', 10 pixels wide */
+	0x3A, 0x27, 0x0E, 0x03, 0x0C, 0x03, 0x0E, 0x03, 0x0C, 0x03, 0x0E, 0x03, 0x0C, 0x03, 0x0E, 0x03,
+	0x0C, 0x05, 0x0C, 0x03, 0x0C, 0x05, 0x0C, 0x03, 0x0C, 0x05, 0x0C, 0x03, 0x5A,
+	/* '8', 10 pixels wide */
+	0x40, 0x07, 0x08, 0x0D, 0x02, 0x05, 0x02, 0x05, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x06, 0x03,
+	0x02, 0x05, 0x02, 0x03, 0x06, 0x09, 0x0A, 0x07, 0x08, 0x03, 0x02, 0x05, 0x02, 0x03, 0x06, 0x09,
+	0x0A, 0x07, 0x0A, 0x09, 0x06, 0x05, 0x00, 0x0F, 0x04, 0x0B, 0x52,
+	/* '9', 10 pixels wide */
+	0x40, 0x07, 0x06, 0x0F, 0x00, 0x05, 0x06, 0x03, 0x00, 0x03, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x09,
+	0x06, 0x05, 0x00, 0x11, 0x02, 0x09, 0x00, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0C, 0x03, 0x00, 0x01,
+	0x08, 0x05, 0x00, 0x0F, 0x04, 0x09, 0x56,
+	/* ':', 3 pixels wide */
+	0x28, 0x11, 0x1C, 0x11, 0x16,
+	/* ';', 5 pixels wide */
+	0x48, 0x05, 0x02, 0x05, 0x02, 0x05, 0x34, 0x03, 0x04, 0x03, 0x04, 0x03, 0x02, 0x03, 0x04, 0x01,
+	0x04, 0x03, 0x0E,
+	/* '<', 10 pixels wide */
+	0x86, 0x03, 0x0A, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x0A, 0x03, 0x0E, 0x07, 0x0E, 0x07,
+	0x0E, 0x07, 0x0E, 0x07, 0x0E, 0x03, 0x62,
+	/* '=', 10 pixels wide */
+	0x9E, 0x27, 0x3A, 0x27, 0x8A,
+	/* '>', 10 pixels wide */
+	0x76, 0x03, 0x0E, 0x07, 0x0E, 0x07, 0x0E, 0x07, 0x0E, 0x07, 0x0E, 0x03, 0x0A, 0x07, 0x06, 0x07,
+	0x06, 0x07, 0x06, 0x07, 0x0A, 0x03, 0x72,
+	/* '?', 9 pixels wide */
+	0x24, 0x0B, 0x02, 0x0F, 0x00, 0x01, 0x08, 0x05, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03,
+	0x0A, 0x03, 0x06, 0x07, 0x08, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x1E, 0x03, 0x0C, 0x03, 0x0C, 0x03,
+	0x4E,
+	/* '@', 17 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x1C,
+	0x07, 0x00, 0x38, 0x03, 0x80, 0x73, 0xB1, 0x80, 0x67, 0xF1, 0x80, 0x66, 0x71, 0x80, 0xCC, 0x71,
+	0x80, 0xCC, 0x61, 0x80, 0xCC, 0x61, 0x80, 0xCC, 0xE3, 0x00, 0xCF, 0xFE, 0x00, 0xC7, 0x3C, 0x00,
+	0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x78, 0x10, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x00,
+	0x00, 0x00,
+	/* 'A', 13 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0D, 0x80, 0x0C, 0xC0,
+	0x0C, 0xC0, 0x18, 0x60, 0x18, 0x60, 0x10, 0x60, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0x30, 0x60, 0x18,
+	0x60, 0x18, 0xE0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'B', 10 pixels wide */
+	0x3A, 0x0D, 0x04, 0x0F, 0x02, 0x03, 0x06, 0x05, 0x00, 0x03, 0x08, 0x03, 0x00, 0x03, 0x08, 0x03,
+	0x00, 0x03, 0x06, 0x03, 0x02, 0x0D, 0x04, 0x11, 0x00, 0x03, 0x08, 0x09, 0x0A, 0x07, 0x0A, 0x07,
+	0x0A, 0x07, 0x08, 0x17, 0x00, 0x0D, 0x54,
+	/* 'C', 11 pixels wide */
+	0x48, 0x0B, 0x04, 0x11, 0x00, 0x05, 0x08, 0x03, 0x00, 0x03, 0x0E, 0x05, 0x0E, 0x03, 0x10, 0x03,
+	0x10, 0x03, 0x10, 0x03, 0x10, 0x03, 0x10, 0x05, 0x10, 0x03, 0x10, 0x05, 0x08, 0x03, 0x02, 0x11,
+	0x06, 0x0B, 0x58,
+	/* 'D', 12 pixels wide */
+	0x46, 0x0F, 0x06, 0x13, 0x02, 0x03, 0x08, 0x07, 0x00, 0x03, 0x0C, 0x03, 0x00, 0x03, 0x0C, 0x09,
+	0x0E, 0x07, 0x0E, 0x07, 0x0E, 0x07, 0x0E, 0x07, 0x0E, 0x07, 0x0C, 0x09, 0x0C, 0x03, 0x00, 0x03,
+	0x08, 0x07, 0x00, 0x11, 0x04, 0x0F, 0x66,
+	/* 'E', 8 pixels wide */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	/* 'F', 8 pixels wide */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+	/* 'G', 12 pixels wide */
+	0x4E, 0x0D, 0x06, 0x11, 0x02, 0x05, 0x08, 0x03, 0x00, 0x03, 0x12, 0x03, 0x10, 0x03, 0x12, 0x03,
+	0x12, 0x03, 0x06, 0x0F, 0x06, 0x0F, 0x0E, 0x09, 0x0C, 0x03, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x05,
+	0x08, 0x03, 0x02, 0x13, 0x06, 0x0B, 0x62,
+	/* 'H', 11 pixels wide */
+	0x40, 0x03, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x33, 0x0C, 0x07,
+	0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x03, 0x56,
+	/* 'I', 2 pixels wide */
+	0x0A, 0x3B, 0x0E,
+	/* 'J', 6 pixels wide */
+	0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x8C,
+	0xFC, 0x78, 0x00, 0x00, 0x00, 0x00,
+	/* 'K', 10 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xC0, 0xC3, 0x80, 0xC3, 0x00, 0xC6, 0x00, 0xCC, 0x00,
+	0xD8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xD8, 0x00, 0xCC, 0x00, 0xCE, 0x00, 0xC7, 0x00, 0xC3, 0x00,
+	0xC1, 0x80, 0xC1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'L', 8 pixels wide */
+	0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	/* 'M', 16 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0xF0, 0x0F, 0xF0, 0x0F, 0xD8, 0x1B, 0xD8, 0x1B,
+	0xD8, 0x13, 0xCC, 0x33, 0xCC, 0x33, 0xC6, 0x63, 0xC6, 0x63, 0xC6, 0x63, 0xC3, 0xC3, 0xC3, 0xC3,
+	0xC1, 0x83, 0xC1, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'N', 11 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x60, 0xF0, 0x60, 0xF0, 0x60, 0xD8, 0x60, 0xD8, 0x60,
+	0xCC, 0x60, 0xCC, 0x60, 0xC6, 0x60, 0xC6, 0x60, 0xC3, 0x60, 0xC3, 0x60, 0xC1, 0xE0, 0xC1, 0xE0,
+	0xC0, 0xE0, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'O', 14 pixels wide */
+	0x5A, 0x0B, 0x0A, 0x13, 0x04, 0x07, 0x08, 0x05, 0x02, 0x03, 0x0E, 0x03, 0x00, 0x05, 0x0E, 0x09,
+	0x12, 0x07, 0x12, 0x07, 0x12, 0x07, 0x12, 0x07, 0x12, 0x09, 0x0E, 0x05, 0x00, 0x03, 0x0E, 0x03,
+	0x02, 0x05, 0x08, 0x07, 0x04, 0x13, 0x0A, 0x0B, 0x76,
+	/* 'P', 9 pixels wide */
+	0x34, 0x0D, 0x02, 0x0F, 0x00, 0x03, 0x06, 0x09, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x06, 0x15,
+	0x00, 0x0B, 0x04, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x54,
+	/* 'Q', 16 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xF0, 0x78, 0x38, 0x60, 0x18, 0xE0, 0x1C,
+	0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xE0, 0x1C, 0x60, 0x18, 0x70, 0x78,
+	0x3F, 0xF8, 0x0F, 0xDC, 0x00, 0x0F, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+	/* 'R', 10 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xC3, 0x80, 0xC1, 0x80, 0xC1, 0x80,
+	0xC1, 0x80, 0xC3, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xC7, 0x00, 0xC3, 0x00, 0xC3, 0x80, 0xC1, 0x80,
+	0xC1, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'S', 9 pixels wide */
+	0x38, 0x09, 0x04, 0x0D, 0x00, 0x05, 0x06, 0x01, 0x00, 0x03, 0x0C, 0x03, 0x0C, 0x05, 0x0C, 0x07,
+	0x0C, 0x07, 0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x03, 0x0C, 0x07, 0x06, 0x15, 0x02, 0x0B, 0x4A,
+	/* 'T', 12 pixels wide */
+	0x46, 0x2F, 0x08, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03,
+	0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x12, 0x03, 0x68,
+	/* 'U', 11 pixels wide */
+	0x40, 0x03, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07,
+	0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x09, 0x08, 0x05, 0x00, 0x05, 0x04, 0x05, 0x02, 0x11,
+	0x06, 0x09, 0x5C,
+	/* 'V', 12 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0x60, 0x60, 0x60, 0x60,
+	0x60, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x31, 0x80, 0x19, 0x80, 0x19, 0x80, 0x1F, 0x00, 0x0F, 0x00,
+	0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'W', 20 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0x30, 0xC0, 0xE0, 0x60, 0xC0,
+	0xE0, 0x60, 0x60, 0xB0, 0x60, 0x61, 0xB0, 0x40, 0x61, 0xB0, 0xC0, 0x71, 0xB0, 0xC0, 0x31, 0x18,
+	0xC0, 0x33, 0x19, 0x80, 0x33, 0x19, 0x80, 0x1B, 0x0D, 0x80, 0x1A, 0x0D, 0x00, 0x1E, 0x0F, 0x00,
+	0x0E, 0x0F, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00,
+	/* 'X', 11 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xC0, 0x61, 0x80, 0x31, 0x80, 0x33, 0x00,
+	0x1B, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1B, 0x00, 0x33, 0x00, 0x71, 0x80, 0x61, 0xC0,
+	0xC0, 0xC0, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'Y', 10 pixels wide */
+	0x3A, 0x03, 0x0A, 0x07, 0x0A, 0x03, 0x00, 0x03, 0x06, 0x03, 0x02, 0x03, 0x06, 0x03, 0x04, 0x03,
+	0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x08, 0x07, 0x0A, 0x07, 0x0C, 0x03, 0x0E, 0x03, 0x0E, 0x03,
+	0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x56,
+	/* 'Z', 10 pixels wide */
+	0x3A, 0x11, 0x00, 0x11, 0x0E, 0x03, 0x0C, 0x03, 0x0C, 0x05, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x05,
+	0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x05, 0x0C, 0x03, 0x0C, 0x03, 0x0E, 0x27, 0x4E,
+	/* '[', 4 pixels wide */
+	0x00, 0x00, 0xF0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0xF0,
+	/* '\', 9 pixels wide */
+	0x10, 0x03, 0x0E, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0E, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0E, 0x03,
+	0x0C, 0x03, 0x0E, 0x01, 0x0E, 0x03, 0x0C, 0x03, 0x0E, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0E, 0x03,
+	0x0C, 0x03, 0x0C, 0x03, 0x0E, 0x03, 0x0C, 0x03, 0x10,
+	/* ']', 4 pixels wide */
+	0x00, 0x00, 0xF0, 0xF0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0xF0, 0xF0,
+	/* '^', 10 pixels wide */
+	0x42, 0x03, 0x0C, 0x07, 0x0A, 0x07, 0x08, 0x03, 0x02, 0x01, 0x08, 0x03, 0x02, 0x03, 0x06, 0x01,
+	0x04, 0x03, 0x04, 0x03, 0x06, 0x03, 0x02, 0x03, 0x06, 0x03, 0x00, 0x03, 0x0A, 0x03, 0xC6,
+	/* '_', 12 pixels wide */
+	0xFE, 0xDE, 0x2F,
+	/* '`', 4 pixels wide */
+	0x06, 0x03, 0x04, 0x03, 0x02, 0x03, 0x04, 0x03, 0x86,
+	/* 'a', 9 pixels wide */
+	0x80, 0x09, 0x04, 0x0D, 0x02, 0x01, 0x08, 0x03, 0x0C, 0x03, 0x02, 0x0D, 0x00, 0x15, 0x06, 0x07,
+	0x08, 0x07, 0x06, 0x05, 0x00, 0x0F, 0x02, 0x07, 0x00, 0x03, 0x46,
+	/* 'b', 10 pixels wide */
+	0x26, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x02, 0x07, 0x02, 0x11,
+	0x00, 0x05, 0x06, 0x03, 0x00, 0x03, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x09,
+	0x06, 0x03, 0x00, 0x11, 0x00, 0x03, 0x00, 0x09, 0x52,
+	/* 'c', 8 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0x61, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x61,
+	0x7F, 0x3E, 0x00, 0x00, 0x00, 0x00,
+	/* 'd', 10 pixels wide */
+	0x36, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x02, 0x09, 0x00, 0x03, 0x00, 0x11,
+	0x00, 0x03, 0x06, 0x09, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x03, 0x00, 0x03,
+	0x06, 0x05, 0x00, 0x11, 0x02, 0x07, 0x02, 0x03, 0x4E,
+	/* 'e', 10 pixels wide */
+	0x90, 0x09, 0x04, 0x0F, 0x02, 0x03, 0x06, 0x09, 0x0A, 0x2F, 0x0E, 0x03, 0x10, 0x03, 0x08, 0x03,
+	0x00, 0x11, 0x04, 0x0B, 0x50,
+	/* 'f', 7 pixels wide */
+	0x00, 0x00, 0x1E, 0x3E, 0x30, 0x30, 0x30, 0xFE, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x00, 0x00, 0x00, 0x00,
+	/* 'g', 10 pixels wide */
+	0x90, 0x0D, 0x02, 0x0F, 0x00, 0x05, 0x02, 0x05, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x06, 0x03,
+	0x02, 0x05, 0x02, 0x05, 0x04, 0x0B, 0x02, 0x0D, 0x04, 0x03, 0x10, 0x0D, 0x04, 0x15, 0x0A, 0x07,
+	0x0A, 0x15, 0x04, 0x0B, 0x02,
+	/* 'h', 9 pixels wide */
+	0x22, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x00, 0x07, 0x02, 0x0F,
+	0x00, 0x05, 0x04, 0x09, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+	0x08, 0x07, 0x08, 0x03, 0x46,
+	/* 'i', 2 pixels wide */
+	0x0A, 0x07, 0x06, 0x2B, 0x0E,
+	/* 'j', 5 pixels wide */
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0xF8, 0xF0,
+	/* 'k', 9 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC3, 0x80,
+	0xC7, 0x00, 0xCE, 0x00, 0xD8, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xDC, 0x00, 0xCC, 0x00, 0xC6, 0x00,
+	0xC3, 0x00, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'l', 2 pixels wide */
+	0x06, 0x3F, 0x0E,
+	/* 'm', 16 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x3C,
+	0xFF, 0x7E, 0xE3, 0xC7, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83, 0xC1, 0x83,
+	0xC1, 0x83, 0xC1, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'n', 9 pixels wide */
+	0x7C, 0x03, 0x00, 0x07, 0x02, 0x0F, 0x00, 0x05, 0x04, 0x09, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+	0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x03, 0x46,
+	/* 'o', 11 pixels wide */
+	0x9E, 0x09, 0x06, 0x11, 0x02, 0x03, 0x08, 0x03, 0x00, 0x03, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07,
+	0x0C, 0x07, 0x0C, 0x03, 0x00, 0x03, 0x08, 0x03, 0x02, 0x11, 0x06, 0x09, 0x5C,
+	/* 'p', 10 pixels wide */
+	0x8A, 0x03, 0x02, 0x07, 0x02, 0x11, 0x00, 0x05, 0x06, 0x09, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x07,
+	0x0A, 0x07, 0x0A, 0x09, 0x06, 0x03, 0x00, 0x11, 0x00, 0x03, 0x00, 0x09, 0x02, 0x03, 0x0E, 0x03,
+	0x0E, 0x03, 0x0E, 0x03, 0x0E,
+	/* 'q', 10 pixels wide */
+	0x8E, 0x09, 0x00, 0x03, 0x00, 0x11, 0x00, 0x03, 0x06, 0x09, 0x0A, 0x07, 0x0A, 0x07, 0x0A, 0x07,
+	0x0A, 0x07, 0x0A, 0x03, 0x00, 0x03, 0x06, 0x05, 0x00, 0x11, 0x02, 0x07, 0x02, 0x03, 0x0E, 0x03,
+	0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03,
+	/* 'r', 6 pixels wide */
+	0x52, 0x03, 0x00, 0x17, 0x04, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03,
+	0x06, 0x03, 0x06, 0x03, 0x36,
+	/* 's', 7 pixels wide */
+	0x64, 0x07, 0x00, 0x11, 0x06, 0x05, 0x08, 0x07, 0x08, 0x07, 0x08, 0x05, 0x08, 0x05, 0x06, 0x11,
+	0x00, 0x07, 0x3A,
+	/* 't', 7 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0xFE, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x3E, 0x1E, 0x00, 0x00, 0x00, 0x00,
+	/* 'u', 9 pixels wide */
+	0x7C, 0x03, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+	0x08, 0x09, 0x04, 0x05, 0x00, 0x0F, 0x02, 0x07, 0x00, 0x03, 0x46,
+	/* 'v', 10 pixels wide */
+	0x8A, 0x03, 0x0A, 0x07, 0x0A, 0x03, 0x00, 0x03, 0x06, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03,
+	0x06, 0x01, 0x06, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x06, 0x03, 0x00, 0x03, 0x0A, 0x07,
+	0x0A, 0x07, 0x0C, 0x03, 0x56,
+	/* 'w', 16 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x83,
+	0xC1, 0x83, 0x63, 0xC6, 0x63, 0xC6, 0x63, 0xC6, 0x32, 0x64, 0x36, 0x6C, 0x36, 0x6C, 0x1C, 0x28,
+	0x1C, 0x38, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'x', 10 pixels wide */
+	0x8C, 0x03, 0x06, 0x05, 0x00, 0x05, 0x04, 0x03, 0x04, 0x03, 0x02, 0x03, 0x08, 0x03, 0x00, 0x03,
+	0x08, 0x07, 0x0C, 0x05, 0x0A, 0x07, 0x08, 0x03, 0x02, 0x03, 0x06, 0x03, 0x02, 0x03, 0x04, 0x03,
+	0x06, 0x03, 0x00, 0x05, 0x06, 0x05, 0x4E,
+	/* 'y', 10 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xC0,
+	0x60, 0xC0, 0x60, 0xC0, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x1B, 0x00, 0x1B, 0x00, 0x1B, 0x00,
+	0x0E, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00,
+	/* 'z', 7 pixels wide */
+	0x60, 0x1B, 0x06, 0x03, 0x08, 0x03, 0x06, 0x03, 0x06, 0x03, 0x08, 0x03, 0x06, 0x03, 0x06, 0x03,
+	0x08, 0x1B, 0x36,
+	/* '{', 6 pixels wide */
+	0x00, 0x1C, 0x3C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xE0, 0x70, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x3C, 0x1C,
+	/* '|', 1 pixels wide */
+	0x00, 0x29,
+	/* '}', 6 pixels wide */
+	0x00, 0xE0, 0xF0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x1C, 0x1C, 0x18, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0xF0, 0xE0,
+	/* '~', 11 pixels wide */
+	0x58, 0x07, 0x06, 0x03, 0x00, 0x09, 0x04, 0x07, 0x04, 0x01, 0x04, 0x07, 0x04, 0x09, 0x00, 0x03,
+	0x06, 0x05, 0xFE, 0x20,
+};
+
+static const font_pack_glyph_t font_pack_22_glyphs[] = {
+	{2, 0, 0},
+	{3, 1, 1},
+	{6, 0, 23},
+	{11, 1, 38},
+	{10, 1, 82},
+	{16, 1, 126},
+	{14, 1, 170},
+	{2, 0, 214},
+	{4, 1, 219},
+	{4, 1, 241},
+	{8, 1, 263},
+	{10, 0, 285},
+	{3, 0, 308},
+	{6, 0, 321},
+	{3, 0, 324},
+	{9, 0, 329},
+	{10, 0, 370},
+	{9, 0, 407},
+	{10, 0, 440},
+	{10, 0, 471},
+	{11, 0, 502},
+	{10, 0, 545},
+	{10, 0, 576},
+	{10, 0, 613},
+	{10, 0, 642},
+	{10, 0, 685},
+	{3, 0, 724},
+	{5, 0, 729},
+	{10, 0, 748},
+	{10, 0, 771},
+	{10, 0, 776},
+	{9, 0, 799},
+	{17, 1, 832},
+	{13, 1, 898},
+	{10, 0, 942},
+	{11, 0, 981},
+	{12, 0, 1016},
+	{8, 1, 1055},
+	{8, 1, 1077},
+	{12, 0, 1099},
+	{11, 0, 1138},
+	{2, 0, 1167},
+	{6, 1, 1170},
+	{10, 1, 1192},
+	{8, 1, 1236},
+	{16, 1, 1258},
+	{11, 1, 1302},
+	{14, 0, 1346},
+	{9, 0, 1387},
+	{16, 1, 1418},
+	{10, 1, 1462},
+	{9, 0, 1506},
+	{12, 0, 1537},
+	{11, 0, 1566},
+	{12, 1, 1601},
+	{20, 1, 1645},
+	{11, 1, 1711},
+	{10, 0, 1755},
+	{10, 0, 1796},
+	{4, 1, 1825},
+	{9, 0, 1847},
+	{4, 1, 1888},
+	{10, 0, 1910},
+	{12, 0, 1941},
+	{4, 0, 1944},
+	{9, 0, 1953},
+	{10, 0, 1980},
+	{8, 1, 2021},
+	{10, 0, 2043},
+	{10, 0, 2084},
+	{7, 1, 2105},
+	{10, 0, 2127},
+	{9, 0, 2164},
+	{2, 0, 2201},
+	{5, 1, 2206},
+	{9, 1, 2228},
+	{2, 0, 2272},
+	{16, 1, 2275},
+	{9, 0, 2319},
+	{11, 0, 2346},
+	{10, 0, 2375},
+	{10, 0, 2412},
+	{6, 0, 2450},
+	{7, 0, 2471},
+	{7, 1, 2490},
+	{9, 0, 2512},
+	{10, 0, 2539},
+	{16, 1, 2576},
+	{10, 0, 2620},
+	{10, 1, 2659},
+	{7, 0, 2703},
+	{6, 1, 2722},
+	{1, 0, 2744},
+	{6, 1, 2746},
+	{11, 0, 2768},
+};
+
+static const font_pack_range_t font_pack_22_ranges[] = {
+	{32, 95, 0},
+};
+
+static const uint8_t font_pack_30_data[] = {
+	/* ' ', 2 pixels wide */
+	0x76,
+	/* '!', 3 pixels wide */
+	0x0A, 0x2F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+	0x00, 0x03, 0x0A, 0x17, 0x22,
+	/* '"', 8 pixels wide */
+	0x1E, 0x05, 0x04, 0x09, 0x04, 0x09, 0x04, 0x09, 0x04, 0x09, 0x04, 0x09, 0x04, 0x09, 0x04, 0x03,
+	0x00, 0x03, 0x04, 0x03, 0xFE, 0x3E,
+	/* '#', 14 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x38, 0x0C, 0x38, 0x1C, 0x30, 0x1C, 0x30,
+	0x18, 0x30, 0xFF, 0xFC, 0xFF, 0xFC, 0x18, 0x70, 0x18, 0x70, 0x18, 0x60, 0x38, 0x60, 0x38, 0x60,
+	0xFF, 0xF8, 0xFF, 0xF8, 0x30, 0x60, 0x30, 0xE0, 0x30, 0xE0, 0x30, 0xC0, 0x70, 0xC0, 0x70, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* '$', 13 pixels wide */
+	0x0C, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x0E, 0x0D, 0x06, 0x13, 0x04, 0x05, 0x08, 0x03,
+	0x02, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x07, 0x12, 0x09, 0x10, 0x0D, 0x0E, 0x0D,
+	0x10, 0x09, 0x12, 0x05, 0x12, 0x05, 0x14, 0x03, 0x14, 0x03, 0x12, 0x09, 0x0C, 0x05, 0x00, 0x15,
+	0x06, 0x0D, 0x0E, 0x05, 0x12, 0x03, 0x14, 0x03, 0x14, 0x03, 0x40,
+	/* '%', 21 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x3E, 0x00, 0xC0, 0x7F,
+	0x01, 0xC0, 0xE3, 0x83, 0x80, 0xC1, 0x83, 0x00, 0xC1, 0x87, 0x00, 0xC1, 0x8E, 0x00, 0xC1, 0x8C,
+	0x00, 0xE3, 0x98, 0x00, 0x7F, 0x38, 0x00, 0x3E, 0x30, 0x00, 0x00, 0x63, 0xE0, 0x00, 0xE7, 0xF0,
+	0x00, 0xCE, 0x38, 0x01, 0x8C, 0x18, 0x03, 0x8C, 0x18, 0x07, 0x0C, 0x18, 0x06, 0x0C, 0x18, 0x0C,
+	0x0E, 0x38, 0x1C, 0x07, 0xF0, 0x18, 0x03, 0xE0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* '&', 18 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x38, 0x78, 0x00, 0x38,
+	0x38, 0x00, 0x30, 0x38, 0x00, 0x30, 0x38, 0x00, 0x38, 0x70, 0x00, 0x38, 0xF0, 0x00, 0x1D, 0xE0,
+	0x00, 0x1F, 0x80, 0x00, 0x1F, 0x03, 0x80, 0x3F, 0x03, 0x80, 0x73, 0x83, 0x80, 0xE1, 0xC3, 0x00,
+	0xE0, 0xE3, 0x00, 0xE0, 0x77, 0x00, 0xE0, 0x3E, 0x00, 0xE0, 0x1E, 0x00, 0xE0, 0x1F, 0x00, 0x70,
+	0x7F, 0x80, 0x3F, 0xF3, 0xC0, 0x1F, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ''', 3 pixels wide */
+	0x0A, 0x29, 0x00, 0x03, 0x76,
+	/* '(', 6 pixels wide */
+	0x00, 0x00, 0x1C, 0x18, 0x38, 0x30, 0x30, 0x70, 0x70, 0x60, 0x60, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+	0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x60, 0x60, 0x70, 0x70, 0x30, 0x38, 0x38, 0x18, 0x1C,
+	/* ')', 6 pixels wide */
+	0x00, 0x00, 0xE0, 0x60, 0x70, 0x30, 0x30, 0x38, 0x38, 0x18, 0x18, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+	0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x38, 0x38, 0x30, 0x70, 0x70, 0x60, 0xE0,
+	/* '*', 10 pixels wide */
+	0x2E, 0x03, 0x0E, 0x03, 0x06, 0x01, 0x04, 0x03, 0x04, 0x07, 0x00, 0x03, 0x00, 0x19, 0x02, 0x09,
+	0x08, 0x09, 0x04, 0x19, 0x00, 0x03, 0x00, 0x07, 0x04, 0x03, 0x04, 0x01, 0x06, 0x03, 0x0E, 0x03,
+	0xFE, 0x46,
+	/* '+', 14 pixels wide */
+	0xEA, 0x03, 0x16, 0x03, 0x16, 0x03, 0x16, 0x03, 0x16, 0x03, 0x16, 0x03, 0x0A, 0x37, 0x0A, 0x03,
+	0x16, 0x03, 0x16, 0x03, 0x16, 0x03, 0x16, 0x03, 0x16, 0x03, 0xEA,
+	/* ',', 5 pixels wide */
+	0xCA, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x03, 0x02, 0x05, 0x02, 0x03, 0x02, 0x03, 0x04, 0x03,
+	0x18,
+	/* '-', 8 pixels wide */
+	0xEE, 0x1F, 0xCE,
+	/* '.', 3 pixels wide */
+	0x76, 0x17, 0x22,
+	/* '/', 12 pixels wide */
+	0x2A, 0x03, 0x10, 0x05, 0x10, 0x03, 0x10, 0x05, 0x10, 0x05, 0x10, 0x03, 0x10, 0x05, 0x10, 0x05,
+	0x10, 0x03, 0x10, 0x05, 0x10, 0x03, 0x12, 0x03, 0x10, 0x05, 0x10, 0x03, 0x10, 0x05, 0x10, 0x05,
+	0x10, 0x03, 0x10, 0x05, 0x10, 0x05, 0x10, 0x03, 0x10, 0x05, 0x10, 0x03, 0x10, 0x05, 0x10, 0x05,
+	0x10, 0x03, 0x10, 0x05, 0x10, 0x05, 0x40,
+	/* '0', 14 pixels wide */
+	0x76, 0x0B, 0x0C, 0x11, 0x06, 0x05, 0x06, 0x05, 0x04, 0x05, 0x0A, 0x05, 0x02, 0x05, 0x0A, 0x05,
+	0x00, 0x05, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x0B,
+	0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x05, 0x00, 0x05, 0x0A, 0x05, 0x02, 0x05, 0x0A, 0x05, 0x04, 0x05,
+	0x06, 0x05, 0x06, 0x11, 0x0C, 0x0B, 0xAE,
+	/* '1', 12 pixels wide */
+	0x68, 0x05, 0x0C, 0x09, 0x08, 0x0D, 0x06, 0x07, 0x00, 0x05, 0x06, 0x03, 0x04, 0x05, 0x10, 0x05,
+	0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05,
+	0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x06, 0x2F, 0x8E,
+	/* '2', 13 pixels wide */
+	0x6C, 0x0B, 0x08, 0x11, 0x04, 0x05, 0x06, 0x07, 0x02, 0x01, 0x0C, 0x07, 0x12, 0x05, 0x12, 0x05,
+	0x12, 0x05, 0x12, 0x05, 0x10, 0x05, 0x12, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x07, 0x10, 0x05,
+	0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x33, 0x9A,
+	/* '3', 13 pixels wide */
+	0x6C, 0x0B, 0x0A, 0x11, 0x04, 0x05, 0x06, 0x05, 0x04, 0x01, 0x0C, 0x05, 0x12, 0x05, 0x12, 0x05,
+	0x12, 0x05, 0x10, 0x05, 0x10, 0x07, 0x06, 0x0D, 0x0A, 0x11, 0x12, 0x07, 0x12, 0x07, 0x12, 0x05,
+	0x12, 0x05, 0x12, 0x07, 0x0E, 0x0D, 0x08, 0x07, 0x00, 0x15, 0x06, 0x0D, 0xA2,
+	/* '4', 15 pixels wide */
+	0x86, 0x07, 0x12, 0x09, 0x10, 0x0B, 0x10, 0x03, 0x00, 0x05, 0x0E, 0x05, 0x00, 0x05, 0x0E, 0x03,
+	0x02, 0x05, 0x0C, 0x03, 0x04, 0x05, 0x0A, 0x05, 0x04, 0x05, 0x0A, 0x03, 0x06, 0x05, 0x08, 0x05,
+	0x06, 0x05, 0x06, 0x05, 0x08, 0x05, 0x06, 0x03, 0x0A, 0x05, 0x04, 0x05, 0x0A, 0x05, 0x04, 0x3B,
+	0x10, 0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x05, 0xB8,
+	/* '5', 13 pixels wide */
+	0x68, 0x15, 0x02, 0x15, 0x02, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05,
+	0x12, 0x11, 0x06, 0x13, 0x12, 0x07, 0x12, 0x07, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05,
+	0x10, 0x05, 0x00, 0x03, 0x0A, 0x07, 0x00, 0x15, 0x06, 0x0D, 0xA2,
+	/* '6', 13 pixels wide */
+	0x70, 0x0B, 0x08, 0x11, 0x04, 0x07, 0x08, 0x01, 0x04, 0x05, 0x10, 0x05, 0x12, 0x05, 0x10, 0x05,
+	0x12, 0x05, 0x12, 0x05, 0x02, 0x09, 0x04, 0x17, 0x00, 0x07, 0x08, 0x05, 0x00, 0x05, 0x0C, 0x0B,
+	0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x05, 0x00, 0x05, 0x08, 0x05, 0x02, 0x07, 0x04, 0x07,
+	0x04, 0x11, 0x0A, 0x09, 0xA2,
+	/* '7', 13 pixels wide */
+	0x66, 0x33, 0x12, 0x05, 0x10, 0x05, 0x12, 0x05, 0x12, 0x03, 0x12, 0x05, 0x12, 0x05, 0x10, 0x05,
+	0x12, 0x05, 0x10, 0x05, 0x12, 0x05, 0x12, 0x03, 0x12, 0x05, 0x12, 0x05, 0x10, 0x05, 0x12, 0x05,
+	0x10, 0x05, 0x12, 0x05, 0x12, 0x03, 0xAA,
+	/* '8', 14 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xF0, 0x38, 0x78, 0x70, 0x38,
+	0x70, 0x38, 0x70, 0x38, 0x78, 0x38, 0x3C, 0x70, 0x1F, 0xE0, 0x0F, 0x80, 0x1F, 0xE0, 0x3C, 0xF0,
+	0x70, 0x38, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0x70, 0x38, 0x7F, 0xF0, 0x1F, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* '9', 13 pixels wide */
+	0x6E, 0x09, 0x0A, 0x11, 0x04, 0x07, 0x04, 0x07, 0x02, 0x05, 0x08, 0x05, 0x00, 0x05, 0x0A, 0x05,
+	0x00, 0x05, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x05, 0x00, 0x05, 0x08, 0x07, 0x00, 0x17,
+	0x04, 0x0B, 0x00, 0x05, 0x12, 0x05, 0x12, 0x05, 0x10, 0x05, 0x12, 0x05, 0x10, 0x05, 0x04, 0x01,
+	0x08, 0x07, 0x04, 0x11, 0x08, 0x0B, 0xA4,
+	/* ':', 3 pixels wide */
+	0x34, 0x17, 0x28, 0x17, 0x22,
+	/* ';', 5 pixels wide */
+	0x66, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x3E, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05,
+	0x00, 0x05, 0x02, 0x03, 0x02, 0x05, 0x02, 0x03, 0x18,
+	/* '<', 13 pixels wide */
+	0xCC, 0x01, 0x12, 0x05, 0x0E, 0x09, 0x0A, 0x0B, 0x08, 0x09, 0x0A, 0x09, 0x0A, 0x09, 0x0E, 0x05,
+	0x12, 0x09, 0x12, 0x09, 0x12, 0x09, 0x12, 0x0B, 0x10, 0x09, 0x12, 0x05, 0x16, 0x01, 0xCE,
+	/* '=', 13 pixels wide */
+	0xFE, 0x1C, 0x33, 0x66, 0x33, 0xFE, 0x1C,
+	/* '>', 13 pixels wide */
+	0xB4, 0x01, 0x16, 0x05, 0x12, 0x09, 0x10, 0x0B, 0x12, 0x09, 0x12, 0x09, 0x12, 0x09, 0x12, 0x05,
+	0x0E, 0x09, 0x0A, 0x09, 0x08, 0x0B, 0x08, 0x0B, 0x0A, 0x09, 0x0E, 0x05, 0x12, 0x01, 0xE6,
+	/* '?', 11 pixels wide */
+	0x2E, 0x0B, 0x04, 0x11, 0x02, 0x03, 0x06, 0x07, 0x0E, 0x07, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05,
+	0x0E, 0x05, 0x0C, 0x07, 0x0A, 0x07, 0x06, 0x0B, 0x08, 0x09, 0x0A, 0x05, 0x0E, 0x05, 0x0E, 0x05,
+	0x0E, 0x05, 0x3A, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x8C,
+	/* '@', 23 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0xF0, 0x07,
+	0x80, 0xF8, 0x0E, 0x00, 0x3C, 0x1C, 0x00, 0x1C, 0x38, 0x00, 0x0E, 0x30, 0x79, 0x8E, 0x70, 0xFF,
+	0x0E, 0x61, 0xC7, 0x06, 0x61, 0x87, 0x06, 0xE3, 0x83, 0x0E, 0xE3, 0x87, 0x0E, 0xE3, 0x86, 0x0E,
+	0xC3, 0x06, 0x0C, 0xC3, 0x0E, 0x1C, 0xC3, 0x9F, 0x38, 0xC1, 0xFB, 0xF0, 0xE1, 0xE1, 0xE0, 0xE0,
+	0x00, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1E, 0x01, 0x80, 0x0F, 0xFF,
+	0x80, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'A', 17 pixels wide */
+	0x94, 0x05, 0x18, 0x07, 0x18, 0x09, 0x14, 0x0B, 0x14, 0x05, 0x00, 0x03, 0x14, 0x03, 0x02, 0x05,
+	0x10, 0x05, 0x02, 0x05, 0x10, 0x05, 0x04, 0x05, 0x0E, 0x03, 0x06, 0x05, 0x0C, 0x05, 0x06, 0x05,
+	0x0C, 0x03, 0x0A, 0x05, 0x08, 0x05, 0x0A, 0x05, 0x08, 0x05, 0x0A, 0x05, 0x08, 0x19, 0x04, 0x1B,
+	0x04, 0x05, 0x10, 0x05, 0x02, 0x03, 0x12, 0x05, 0x00, 0x05, 0x12, 0x05, 0x00, 0x05, 0x14, 0x09,
+	0x16, 0x05, 0xCA,
+	/* 'B', 13 pixels wide */
+	0x66, 0x11, 0x06, 0x15, 0x02, 0x05, 0x08, 0x05, 0x02, 0x05, 0x0A, 0x05, 0x00, 0x05, 0x0A, 0x05,
+	0x00, 0x05, 0x0A, 0x05, 0x00, 0x05, 0x0A, 0x05, 0x00, 0x05, 0x0A, 0x05, 0x00, 0x05, 0x08, 0x05,
+	0x02, 0x13, 0x04, 0x15, 0x02, 0x05, 0x08, 0x07, 0x00, 0x05, 0x0A, 0x0D, 0x0C, 0x0B, 0x0C, 0x0B,
+	0x0C, 0x0B, 0x0C, 0x0B, 0x0A, 0x05, 0x00, 0x15, 0x02, 0x11, 0xA2,
+	/* 'C', 14 pixels wide */
+	0x7A, 0x09, 0x0C, 0x11, 0x06, 0x05, 0x08, 0x05, 0x02, 0x05, 0x0E, 0x01, 0x00, 0x05, 0x14, 0x05,
+	0x12, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05, 0x14, 0x05,
+	0x16, 0x05, 0x14, 0x05, 0x14, 0x07, 0x0E, 0x01, 0x02, 0x07, 0x08, 0x05, 0x04, 0x13, 0x0A, 0x0B,
+	0xAC,
+	/* 'D', 16 pixels wide */
+	0x7E, 0x13, 0x0A, 0x17, 0x06, 0x05, 0x0A, 0x07, 0x04, 0x05, 0x0E, 0x05, 0x02, 0x05, 0x10, 0x05,
+	0x00, 0x05, 0x10, 0x05, 0x00, 0x05, 0x12, 0x0B, 0x12, 0x0B, 0x12, 0x0B, 0x12, 0x0B, 0x12, 0x0B,
+	0x12, 0x0B, 0x12, 0x0B, 0x12, 0x0B, 0x10, 0x05, 0x00, 0x05, 0x10, 0x05, 0x00, 0x05, 0x0E, 0x05,
+	0x02, 0x05, 0x0A, 0x07, 0x04, 0x17, 0x06, 0x13, 0xCA,
+	/* 'E', 11 pixels wide */
+	0x56, 0x31, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x13,
+	0x00, 0x13, 0x00, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05,
+	0x0E, 0x2B, 0x82,
+	/* 'F', 11 pixels wide */
+	0x56, 0x31, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x31,
+	0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05,
+	0x92,
+	/* 'G', 16 pixels wide */
+	0x8A, 0x0D, 0x0C, 0x15, 0x06, 0x07, 0x0A, 0x05, 0x02, 0x07, 0x10, 0x01, 0x00, 0x07, 0x16, 0x05,
+	0x18, 0x05, 0x16, 0x05, 0x18, 0x05, 0x18, 0x05, 0x08, 0x15, 0x08, 0x15, 0x12, 0x0B, 0x12, 0x0D,
+	0x10, 0x05, 0x00, 0x05, 0x10, 0x05, 0x00, 0x07, 0x0E, 0x05, 0x02, 0x05, 0x0E, 0x05, 0x04, 0x07,
+	0x08, 0x07, 0x06, 0x17, 0x0A, 0x0D, 0xC4,
+	/* 'H', 15 pixels wide */
+	0x76, 0x05, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B,
+	0x10, 0x0B, 0x10, 0x47, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B,
+	0x10, 0x0B, 0x10, 0x0B, 0x10, 0x05, 0xB2,
+	/* 'I', 3 pixels wide */
+	0x16, 0x77, 0x22,
+	/* 'J', 8 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x8F, 0xFE, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'K', 13 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0xE0, 0x78, 0xE0, 0x70, 0xE0, 0xE0,
+	0xE1, 0xC0, 0xE3, 0x80, 0xE7, 0x00, 0xEE, 0x00, 0xEE, 0x00, 0xFC, 0x00, 0xEE, 0x00, 0xEF, 0x00,
+	0xE7, 0x00, 0xE3, 0x80, 0xE1, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0xE0, 0x38, 0xE0, 0x38,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'L', 10 pixels wide */
+	0x4E, 0x05, 0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x05,
+	0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x05,
+	0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x27, 0x76,
+	/* 'M', 22 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x7C, 0xF8,
+	0x00, 0x7C, 0xFC, 0x00, 0xFC, 0xEC, 0x00, 0xDC, 0xEE, 0x00, 0xDC, 0xEE, 0x01, 0xDC, 0xE6, 0x01,
+	0x9C, 0xE7, 0x03, 0x9C, 0xE7, 0x03, 0x9C, 0xE3, 0x03, 0x1C, 0xE3, 0x87, 0x1C, 0xE1, 0x86, 0x1C,
+	0xE1, 0xCE, 0x1C, 0xE1, 0xCE, 0x1C, 0xE0, 0xCC, 0x1C, 0xE0, 0xFC, 0x1C, 0xE0, 0xF8, 0x1C, 0xE0,
+	0x78, 0x1C, 0xE0, 0x78, 0x1C, 0xE0, 0x30, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'N', 15 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0E, 0xF8, 0x0E, 0xFC, 0x0E, 0xFC, 0x0E,
+	0xEC, 0x0E, 0xEE, 0x0E, 0xE6, 0x0E, 0xE7, 0x0E, 0xE3, 0x0E, 0xE3, 0x8E, 0xE1, 0x8E, 0xE1, 0xCE,
+	0xE0, 0xCE, 0xE0, 0xEE, 0xE0, 0xEE, 0xE0, 0x7E, 0xE0, 0x7E, 0xE0, 0x3E, 0xE0, 0x3E, 0xE0, 0x1E,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'O', 18 pixels wide */
+	0x9A, 0x0D, 0x10, 0x15, 0x0A, 0x05, 0x0A, 0x07, 0x06, 0x05, 0x0E, 0x07, 0x02, 0x05, 0x12, 0x05,
+	0x02, 0x05, 0x12, 0x05, 0x00, 0x05, 0x16, 0x0B, 0x16, 0x0B, 0x16, 0x0B, 0x16, 0x0B, 0x16, 0x0B,
+	0x16, 0x0B, 0x16, 0x0B, 0x16, 0x05, 0x00, 0x05, 0x12, 0x05, 0x02, 0x05, 0x12, 0x05, 0x02, 0x07,
+	0x0E, 0x05, 0x06, 0x07, 0x0A, 0x05, 0x0A, 0x15, 0x10, 0x0D, 0xE2,
+	/* 'P', 12 pixels wide */
+	0x5E, 0x11, 0x04, 0x13, 0x02, 0x05, 0x06, 0x07, 0x00, 0x05, 0x08, 0x0D, 0x0A, 0x0B, 0x0A, 0x0B,
+	0x0A, 0x0B, 0x0A, 0x0B, 0x08, 0x05, 0x00, 0x05, 0x06, 0x07, 0x00, 0x13, 0x02, 0x0F, 0x06, 0x05,
+	0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0xA0,
+	/* 'Q', 20 pixels wide */
+	0xAA, 0x0D, 0x14, 0x15, 0x0E, 0x05, 0x0A, 0x07, 0x0A, 0x05, 0x0E, 0x05, 0x08, 0x05, 0x12, 0x05,
+	0x06, 0x05, 0x12, 0x05, 0x04, 0x05, 0x16, 0x05, 0x02, 0x05, 0x16, 0x05, 0x02, 0x05, 0x16, 0x05,
+	0x02, 0x05, 0x16, 0x05, 0x02, 0x05, 0x16, 0x05, 0x02, 0x05, 0x16, 0x05, 0x02, 0x05, 0x16, 0x05,
+	0x02, 0x05, 0x16, 0x05, 0x04, 0x05, 0x12, 0x05, 0x06, 0x05, 0x12, 0x05, 0x06, 0x07, 0x0E, 0x05,
+	0x0A, 0x07, 0x0A, 0x05, 0x0E, 0x1B, 0x0E, 0x0D, 0x02, 0x07, 0x20, 0x09, 0x1E, 0x07, 0x22, 0x03,
+	0x76,
+	/* 'R', 13 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0xE0, 0xE0, 0xE0, 0x70,
+	0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0xF0, 0xE1, 0xE0, 0xFF, 0xC0, 0xFF, 0x80, 0xE1, 0xC0,
+	0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x60, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'S', 12 pixels wide */
+	0x64, 0x0D, 0x06, 0x11, 0x02, 0x05, 0x08, 0x03, 0x00, 0x05, 0x10, 0x05, 0x10, 0x05, 0x10, 0x07,
+	0x10, 0x07, 0x0E, 0x0B, 0x0E, 0x0B, 0x0C, 0x0B, 0x10, 0x07, 0x10, 0x07, 0x10, 0x05, 0x10, 0x05,
+	0x10, 0x07, 0x0C, 0x0D, 0x06, 0x07, 0x02, 0x11, 0x08, 0x09, 0x96,
+	/* 'T', 15 pixels wide */
+	0x76, 0x3B, 0x0A, 0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x05,
+	0x16, 0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x05, 0x16, 0x05,
+	0x16, 0x05, 0x16, 0x05, 0x16, 0x05, 0xBE,
+	/* 'U', 15 pixels wide */
+	0x76, 0x05, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B,
+	0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0B, 0x10, 0x0D,
+	0x0E, 0x05, 0x00, 0x05, 0x0C, 0x05, 0x02, 0x07, 0x08, 0x05, 0x06, 0x13, 0x0C, 0x0D, 0xBA,
+	/* 'V', 17 pixels wide */
+	0x86, 0x05, 0x16, 0x03, 0x00, 0x05, 0x12, 0x05, 0x00, 0x05, 0x12, 0x05, 0x00, 0x05, 0x12, 0x03,
+	0x04, 0x05, 0x0E, 0x05, 0x04, 0x05, 0x0E, 0x05, 0x04, 0x05, 0x0E, 0x03, 0x08, 0x05, 0x0A, 0x05,
+	0x08, 0x05, 0x0A, 0x05, 0x0A, 0x03, 0x0A, 0x03, 0x0C, 0x05, 0x06, 0x05, 0x0C, 0x05, 0x06, 0x03,
+	0x10, 0x03, 0x06, 0x03, 0x10, 0x05, 0x02, 0x05, 0x10, 0x05, 0x02, 0x03, 0x14, 0x03, 0x02, 0x03,
+	0x14, 0x0B, 0x14, 0x09, 0x18, 0x07, 0x18, 0x07, 0xD6,
+	/* 'W', 26 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0x0E, 0x00, 0xC0, 0xE0, 0x1E, 0x00, 0xC0, 0xE0, 0x1E, 0x01, 0xC0, 0x70, 0x1E, 0x01, 0xC0,
+	0x70, 0x1F, 0x01, 0x80, 0x70, 0x3F, 0x03, 0x80, 0x30, 0x33, 0x03, 0x80, 0x38, 0x33, 0x83, 0x80,
+	0x38, 0x33, 0x83, 0x00, 0x18, 0x71, 0x87, 0x00, 0x1C, 0x61, 0x87, 0x00, 0x1C, 0x61, 0xC6, 0x00,
+	0x1C, 0x61, 0xC6, 0x00, 0x0C, 0xE0, 0xCE, 0x00, 0x0E, 0xC0, 0xEC, 0x00, 0x0E, 0xC0, 0xEC, 0x00,
+	0x06, 0xC0, 0x6C, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x07, 0x80, 0x78, 0x00, 0x07, 0x80, 0x78, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'X', 15 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x70, 0x1C, 0x70, 0x18, 0x38, 0x38,
+	0x38, 0x70, 0x1C, 0x70, 0x0E, 0xE0, 0x0E, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x07, 0xC0, 0x07, 0xC0,
+	0x0E, 0xE0, 0x1C, 0xE0, 0x1C, 0x70, 0x38, 0x78, 0x30, 0x38, 0x70, 0x1C, 0xE0, 0x1C, 0xE0, 0x0E,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'Y', 15 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x70, 0x0C, 0x70, 0x1C, 0x30, 0x18,
+	0x38, 0x38, 0x18, 0x30, 0x1C, 0x70, 0x0C, 0x60, 0x0E, 0xE0, 0x06, 0xC0, 0x07, 0xC0, 0x03, 0x80,
+	0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'Z', 13 pixels wide */
+	0x66, 0x33, 0x12, 0x05, 0x10, 0x05, 0x10, 0x05, 0x12, 0x05, 0x10, 0x05, 0x10, 0x05, 0x12, 0x05,
+	0x10, 0x05, 0x12, 0x05, 0x10, 0x05, 0x10, 0x05, 0x12, 0x05, 0x10, 0x05, 0x10, 0x05, 0x12, 0x05,
+	0x10, 0x05, 0x12, 0x33, 0x9A,
+	/* '[', 5 pixels wide */
+	0x00, 0x00, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0x00,
+	/* '\', 12 pixels wide */
+	0x16, 0x05, 0x12, 0x03, 0x12, 0x05, 0x10, 0x05, 0x12, 0x03, 0x12, 0x05, 0x10, 0x05, 0x12, 0x03,
+	0x12, 0x05, 0x10, 0x05, 0x12, 0x03, 0x12, 0x05, 0x12, 0x03, 0x12, 0x05, 0x10, 0x05, 0x12, 0x03,
+	0x12, 0x05, 0x10, 0x05, 0x12, 0x03, 0x12, 0x05, 0x12, 0x03, 0x12, 0x05, 0x10, 0x05, 0x12, 0x03,
+	0x12, 0x05, 0x10, 0x05, 0x12, 0x03, 0x2E,
+	/* ']', 6 pixels wide */
+	0x00, 0x00, 0xFC, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+	0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0x00,
+	/* '^', 12 pixels wide */
+	0x66, 0x05, 0x10, 0x07, 0x0C, 0x09, 0x0C, 0x03, 0x00, 0x05, 0x0A, 0x03, 0x02, 0x03, 0x08, 0x05,
+	0x02, 0x05, 0x06, 0x03, 0x04, 0x05, 0x04, 0x05, 0x06, 0x05, 0x02, 0x03, 0x08, 0x05, 0x00, 0x05,
+	0x0A, 0x03, 0x00, 0x05, 0x0A, 0x09, 0x0C, 0x05, 0xFE, 0x4E,
+	/* '_', 16 pixels wide */
+	0xFE, 0xFE, 0xFE, 0x7E, 0x3F,
+	/* '`', 5 pixels wide */
+	0x12, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x03, 0x06, 0x03, 0xE4,
+	/* 'a', 12 pixels wide */
+	0xDC, 0x0B, 0x06, 0x13, 0x02, 0x03, 0x08, 0x07, 0x10, 0x05, 0x10, 0x05, 0x10, 0x05, 0x04, 0x11,
+	0x00, 0x15, 0x00, 0x05, 0x08, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x08, 0x0F, 0x04, 0x09, 0x00, 0x15,
+	0x02, 0x09, 0x02, 0x05, 0x8E,
+	/* 'b', 13 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+	0xE0, 0x00, 0xE7, 0xC0, 0xEF, 0xE0, 0xF8, 0xF0, 0xF0, 0x70, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38,
+	0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xF0, 0x70, 0xF8, 0xF0, 0xEF, 0xE0, 0xE7, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'c', 11 pixels wide */
+	0xCC, 0x09, 0x06, 0x0F, 0x02, 0x07, 0x06, 0x03, 0x00, 0x05, 0x0A, 0x07, 0x0E, 0x05, 0x0E, 0x05,
+	0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x10, 0x05, 0x0A, 0x01, 0x00, 0x07, 0x06, 0x03,
+	0x02, 0x11, 0x06, 0x09, 0x86,
+	/* 'd', 13 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
+	0x00, 0x38, 0x1F, 0x38, 0x3F, 0xB8, 0x78, 0xF8, 0x70, 0x78, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38,
+	0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0x70, 0x78, 0x78, 0xF8, 0x3F, 0xB8, 0x1F, 0x38,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'e', 13 pixels wide */
+	0xF0, 0x0B, 0x08, 0x11, 0x04, 0x07, 0x06, 0x05, 0x02, 0x05, 0x08, 0x0D, 0x0C, 0x0B, 0x0C, 0x3F,
+	0x12, 0x05, 0x12, 0x05, 0x14, 0x05, 0x12, 0x07, 0x08, 0x03, 0x04, 0x13, 0x08, 0x0B, 0xA0,
+	/* 'f', 9 pixels wide */
+	0x2A, 0x09, 0x04, 0x0B, 0x02, 0x07, 0x08, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x06, 0x23,
+	0x02, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05,
+	0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x72,
+	/* 'g', 13 pixels wide */
+	0xF0, 0x11, 0x02, 0x15, 0x02, 0x03, 0x06, 0x03, 0x06, 0x03, 0x0A, 0x03, 0x04, 0x03, 0x0A, 0x03,
+	0x04, 0x03, 0x0A, 0x03, 0x04, 0x03, 0x0A, 0x03, 0x06, 0x03, 0x06, 0x03, 0x08, 0x0F, 0x06, 0x03,
+	0x00, 0x07, 0x0A, 0x03, 0x14, 0x03, 0x14, 0x11, 0x08, 0x13, 0x02, 0x05, 0x08, 0x0D, 0x0C, 0x0B,
+	0x0C, 0x0B, 0x0C, 0x0D, 0x08, 0x05, 0x02, 0x13, 0x08, 0x0D, 0x04,
+	/* 'h', 13 pixels wide */
+	0x32, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05,
+	0x02, 0x09, 0x04, 0x05, 0x00, 0x0F, 0x00, 0x09, 0x06, 0x05, 0x00, 0x07, 0x0A, 0x0B, 0x0C, 0x0B,
+	0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B,
+	0x0C, 0x0B, 0x0C, 0x05, 0x9A,
+	/* 'i', 3 pixels wide */
+	0x10, 0x11, 0x10, 0x59, 0x22,
+	/* 'j', 6 pixels wide */
+	0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+	0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0xF8, 0xF0,
+	/* 'k', 12 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+	0xE0, 0x00, 0xE0, 0xE0, 0xE1, 0xC0, 0xE3, 0xC0, 0xE7, 0x80, 0xE7, 0x00, 0xEE, 0x00, 0xFC, 0x00,
+	0xEE, 0x00, 0xEF, 0x00, 0xE7, 0x00, 0xE3, 0x80, 0xE1, 0xC0, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'l', 3 pixels wide */
+	0x0A, 0x83, 0x22,
+	/* 'm', 21 pixels wide */
+	0xFE, 0x78, 0x05, 0x02, 0x09, 0x06, 0x09, 0x02, 0x05, 0x00, 0x0D, 0x02, 0x0D, 0x00, 0x09, 0x04,
+	0x0B, 0x04, 0x05, 0x00, 0x07, 0x08, 0x07, 0x08, 0x0B, 0x0A, 0x05, 0x0A, 0x0B, 0x0A, 0x05, 0x0A,
+	0x0B, 0x0A, 0x05, 0x0A, 0x0B, 0x0A, 0x05, 0x0A, 0x0B, 0x0A, 0x05, 0x0A, 0x0B, 0x0A, 0x05, 0x0A,
+	0x0B, 0x0A, 0x05, 0x0A, 0x0B, 0x0A, 0x05, 0x0A, 0x0B, 0x0A, 0x05, 0x0A, 0x0B, 0x0A, 0x05, 0x0A,
+	0x0B, 0x0A, 0x05, 0x0A, 0x05, 0xFA,
+	/* 'n', 13 pixels wide */
+	0xE8, 0x05, 0x02, 0x09, 0x04, 0x05, 0x00, 0x0F, 0x00, 0x09, 0x06, 0x05, 0x00, 0x07, 0x0A, 0x0B,
+	0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B,
+	0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x05, 0x9A,
+	/* 'o', 14 pixels wide */
+	0xFE, 0x02, 0x0B, 0x0A, 0x13, 0x04, 0x07, 0x06, 0x07, 0x02, 0x05, 0x0A, 0x05, 0x00, 0x05, 0x0E,
+	0x0B, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x05, 0x00, 0x05, 0x0A,
+	0x05, 0x02, 0x07, 0x06, 0x05, 0x06, 0x13, 0x0A, 0x0B, 0xAE,
+	/* 'p', 13 pixels wide */
+	0xE8, 0x05, 0x02, 0x09, 0x04, 0x05, 0x00, 0x0D, 0x02, 0x09, 0x04, 0x07, 0x00, 0x07, 0x08, 0x05,
+	0x00, 0x05, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0D,
+	0x08, 0x05, 0x00, 0x09, 0x04, 0x07, 0x00, 0x05, 0x00, 0x0D, 0x02, 0x05, 0x02, 0x09, 0x04, 0x05,
+	0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12,
+	/* 'q', 13 pixels wide */
+	0xEE, 0x09, 0x02, 0x05, 0x02, 0x0D, 0x00, 0x05, 0x00, 0x07, 0x04, 0x09, 0x00, 0x05, 0x08, 0x0D,
+	0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x05, 0x00, 0x05,
+	0x08, 0x07, 0x00, 0x07, 0x04, 0x09, 0x02, 0x0D, 0x00, 0x05, 0x04, 0x09, 0x02, 0x05, 0x12, 0x05,
+	0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05, 0x12, 0x05,
+	/* 'r', 8 pixels wide */
+	0x8E, 0x05, 0x02, 0x1F, 0x04, 0x07, 0x06, 0x05, 0x08, 0x05, 0x08, 0x05, 0x08, 0x05, 0x08, 0x05,
+	0x08, 0x05, 0x08, 0x05, 0x08, 0x05, 0x08, 0x05, 0x08, 0x05, 0x08, 0x05, 0x68,
+	/* 's', 10 pixels wide */
+	0xB6, 0x0B, 0x04, 0x0F, 0x00, 0x07, 0x06, 0x01, 0x00, 0x05, 0x0C, 0x05, 0x0C, 0x07, 0x0C, 0x09,
+	0x0A, 0x0B, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x05, 0x0C, 0x09, 0x06, 0x19, 0x02, 0x0B, 0x7C,
+	/* 't', 9 pixels wide */
+	0x5C, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x06, 0x23, 0x02, 0x05, 0x0A, 0x05, 0x0A, 0x05,
+	0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x07,
+	0x0A, 0x0B, 0x06, 0x09, 0x6A,
+	/* 'u', 12 pixels wide */
+	0xD6, 0x05, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B,
+	0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x08, 0x07, 0x00, 0x05, 0x04, 0x09, 0x00, 0x0D,
+	0x00, 0x05, 0x02, 0x09, 0x02, 0x05, 0x8E,
+	/* 'v', 14 pixels wide */
+	0xFA, 0x05, 0x0E, 0x0B, 0x0E, 0x03, 0x02, 0x05, 0x0A, 0x05, 0x02, 0x05, 0x0A, 0x05, 0x04, 0x03,
+	0x0A, 0x03, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x08, 0x03, 0x06, 0x03, 0x0A, 0x05,
+	0x02, 0x05, 0x0A, 0x05, 0x02, 0x03, 0x0E, 0x03, 0x02, 0x03, 0x0E, 0x0B, 0x0E, 0x09, 0x12, 0x07,
+	0x12, 0x07, 0xB0,
+	/* 'w', 21 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x60, 0x38, 0xE0, 0xF0,
+	0x30, 0xE0, 0xF0, 0x30, 0xE0, 0xF0, 0x70, 0x60, 0xF8, 0x70, 0x71, 0xF8, 0x60, 0x71, 0x98, 0xE0,
+	0x31, 0x98, 0xE0, 0x39, 0x9C, 0xC0, 0x3B, 0x8D, 0xC0, 0x1B, 0x0D, 0xC0, 0x1B, 0x0F, 0x80, 0x1F,
+	0x0F, 0x80, 0x1E, 0x07, 0x80, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 'x', 12 pixels wide */
+	0xD6, 0x05, 0x0A, 0x05, 0x00, 0x05, 0x08, 0x05, 0x00, 0x05, 0x06, 0x05, 0x04, 0x05, 0x04, 0x03,
+	0x08, 0x05, 0x00, 0x05, 0x08, 0x0B, 0x0C, 0x07, 0x0E, 0x07, 0x0E, 0x09, 0x0A, 0x0B, 0x08, 0x05,
+	0x02, 0x05, 0x06, 0x03, 0x06, 0x05, 0x02, 0x05, 0x06, 0x05, 0x00, 0x05, 0x0A, 0x0B, 0x0A, 0x05,
+	0x8E,
+	/* 'y', 13 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xC0, 0x38, 0xE0, 0x38, 0xE0, 0x30, 0x60, 0x70, 0x70, 0x70, 0x70, 0x60, 0x30, 0xE0,
+	0x38, 0xC0, 0x38, 0xC0, 0x19, 0xC0, 0x1D, 0x80, 0x0D, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x07, 0x00,
+	0x07, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+	/* 'z', 10 pixels wide */
+	0xB2, 0x27, 0x0A, 0x05, 0x0C, 0x05, 0x0A, 0x05, 0x0C, 0x03, 0x0C, 0x05, 0x0A, 0x05, 0x0C, 0x05,
+	0x0A, 0x05, 0x0C, 0x03, 0x0C, 0x05, 0x0A, 0x05, 0x0C, 0x27, 0x76,
+	/* '{', 8 pixels wide */
+	0x00, 0x00, 0x07, 0x0F, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0xF0, 0xF0,
+	0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x1C, 0x0F, 0x07, 0x00,
+	/* '|', 3 pixels wide */
+	0x0A, 0xA7,
+	/* '}', 8 pixels wide */
+	0x00, 0x00, 0xE0, 0xF0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x18, 0x1C, 0x0F, 0x0F,
+	0x1C, 0x18, 0x18, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xF0, 0xE0, 0x00,
+	/* '~', 14 pixels wide */
+	0xAA, 0x07, 0x0A, 0x03, 0x00, 0x0B, 0x08, 0x09, 0x02, 0x05, 0x06, 0x07, 0x06, 0x05, 0x02, 0x09,
+	0x08, 0x0B, 0x10, 0x07, 0xFE, 0xFA,
+};
+
+static const font_pack_glyph_t font_pack_30_glyphs[] = {
+	{2, 0, 0},
+	{3, 0, 1},
+	{8, 0, 22},
+	{14, 1, 44},
+	{13, 0, 104},
+	{21, 1, 163},
+	{18, 1, 253},
+	{3, 0, 343},
+	{6, 1, 348},
+	{6, 1, 378},
+	{10, 0, 408},
+	{14, 0, 442},
+	{5, 0, 469},
+	{8, 0, 486},
+	{3, 0, 489},
+	{12, 0, 492},
+	{14, 0, 547},
+	{12, 0, 602},
+	{13, 0, 645},
+	{13, 0, 688},
+	{15, 0, 733},
+	{13, 0, 792},
+	{13, 0, 835},
+	{13, 0, 888},
+	{14, 1, 927},
+	{13, 0, 987},
+	{3, 0, 1042},
+	{5, 0, 1047},
+	{13, 0, 1072},
+	{13, 0, 1103},
+	{13, 0, 1110},
+	{11, 0, 1141},
+	{23, 1, 1184},
+	{17, 0, 1274},
+	{13, 0, 1341},
+	{14, 0, 1400},
+	{16, 0, 1449},
+	{11, 0, 1506},
+	{11, 0, 1541},
+	{16, 0, 1574},
+	{15, 0, 1629},
+	{3, 0, 1668},
+	{8, 1, 1671},
+	{13, 1, 1701},
+	{10, 0, 1761},
+	{22, 1, 1800},
+	{15, 1, 1890},
+	{18, 0, 1950},
+	{12, 0, 2009},
+	{20, 0, 2056},
+	{13, 1, 2137},
+	{12, 0, 2197},
+	{15, 0, 2240},
+	{15, 0, 2279},
+	{17, 0, 2326},
+	{26, 1, 2399},
+	{15, 1, 2519},
+	{15, 1, 2579},
+	{13, 0, 2639},
+	{5, 1, 2676},
+	{12, 0, 2706},
+	{6, 1, 2761},
+	{12, 0, 2791},
+	{16, 0, 2833},
+	{5, 0, 2838},
+	{12, 0, 2849},
+	{13, 1, 2886},
+	{11, 0, 2946},
+	{13, 1, 2983},
+	{13, 0, 3043},
+	{9, 0, 3074},
+	{13, 0, 3117},
+	{13, 0, 3176},
+	{3, 0, 3229},
+	{6, 1, 3234},
+	{12, 1, 3264},
+	{3, 0, 3324},
+	{21, 0, 3327},
+	{13, 0, 3397},
+	{14, 0, 3436},
+	{13, 0, 3478},
+	{13, 0, 3537},
+	{8, 0, 3595},
+	{10, 0, 3624},
+	{9, 0, 3655},
+	{12, 0, 3692},
+	{14, 0, 3731},
+	{21, 1, 3782},
+	{12, 0, 3872},
+	{13, 1, 3921},
+	{10, 0, 3981},
+	{8, 1, 4008},
+	{3, 0, 4038},
+	{8, 1, 4040},
+	{14, 0, 4070},
+};
+
+static const font_pack_range_t font_pack_30_ranges[] = {
+	{32, 95, 0},
+};
+
+static const uint8_t font_pack_30_aa_data[] = {
+	/* ' ', 1 pixels wide */
+	0xF0, 0xD0,
+	/* '!', 4 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0,
+	0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0,
+	0x8F, 0xF0, 0x8F, 0xF0, 0x48, 0x80, 0x00, 0x00, 0x48, 0x80, 0xBF, 0xF8, 0xFF, 0xF8, 0x8F, 0xF4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* '"', 9 pixels wide */
+	0x80, 0x04, 0x18, 0x20, 0x18, 0x04, 0x2F, 0x10, 0x04, 0x1F, 0x08, 0x0B, 0x1F, 0x20, 0x1F, 0x18,
+	0x0F, 0x08, 0x20, 0x1F, 0x18, 0x0F, 0x08, 0x20, 0x1F, 0x00, 0x08, 0x0F, 0x08, 0x20, 0x1F, 0x00,
+	0x08, 0x0F, 0x08, 0x20, 0x1F, 0x00, 0x08, 0x0F, 0x08, 0x20, 0x1F, 0x00, 0x04, 0x08, 0x04, 0x20,
+	0x18, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x40,
+	/* '#', 15 pixels wide */
+	0xF0, 0xF0, 0xF0, 0x00, 0x04, 0x08, 0x04, 0x30, 0x18, 0x50, 0x1F, 0x08, 0x20, 0x04, 0x1F, 0x50,
+	0x1F, 0x08, 0x20, 0x08, 0x1F, 0x50, 0x1F, 0x30, 0x08, 0x1F, 0x40, 0x04, 0x1F, 0x30, 0x08, 0x0F,
+	0x08, 0x40, 0x08, 0x1F, 0x30, 0x0B, 0x0F, 0x08, 0x20, 0xCF, 0x0B, 0x00, 0xCF, 0x0B, 0x20, 0x0B,
+	0x0F, 0x08, 0x30, 0x1F, 0x04, 0x40, 0x1F, 0x08, 0x30, 0x1F, 0x50, 0x1F, 0x08, 0x20, 0x08, 0x1F,
+	0x50, 0x1F, 0x30, 0x08, 0x1F, 0x40, 0x04, 0x1F, 0x30, 0x08, 0x0F, 0x0B, 0x20, 0xDF, 0x00, 0xDF,
+	0x20, 0x08, 0x0F, 0x08, 0x30, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x30, 0x1F, 0x50, 0x1F, 0x08, 0x20,
+	0x04, 0x1F, 0x50, 0x1F, 0x08, 0x20, 0x08, 0x1F, 0x50, 0x1F, 0x30, 0x08, 0x1F, 0x50, 0x18, 0x30,
+	0x04, 0x08, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xD0,
+	/* '$', 13 pixels wide */
+	0x50, 0x08, 0x0F, 0x08, 0x90, 0x08, 0x0F, 0x08, 0x90, 0x1F, 0x08, 0x70, 0x04, 0x08, 0x1F, 0x08,
+	0x04, 0x40, 0x08, 0x7F, 0x04, 0x10, 0x0B, 0x2F, 0x28, 0x0B, 0x1F, 0x0B, 0x00, 0x04, 0x1F, 0x0B,
+	0x50, 0x08, 0x0B, 0x00, 0x08, 0x1F, 0x90, 0x08, 0x1F, 0x90, 0x08, 0x1F, 0x04, 0x80, 0x08, 0x1F,
+	0x0B, 0x90, 0x0B, 0x2F, 0x08, 0x80, 0x0B, 0x3F, 0x0B, 0x08, 0x60, 0x08, 0x0B, 0x4F, 0x08, 0x60,
+	0x04, 0x08, 0x3F, 0x0B, 0x80, 0x08, 0x2F, 0x08, 0x80, 0x04, 0x1F, 0x0B, 0x90, 0x2F, 0x90, 0x2F,
+	0x80, 0x04, 0x1F, 0x08, 0x0F, 0x08, 0x50, 0x04, 0x0B, 0x1F, 0x04, 0x2F, 0x0B, 0x28, 0x0B, 0x2F,
+	0x04, 0x00, 0x08, 0x7F, 0x0B, 0x04, 0x40, 0x08, 0x1F, 0x18, 0x80, 0x1F, 0xA0, 0x1F, 0x90, 0x04,
+	0x1F, 0x90, 0x04, 0x08, 0x04, 0xF0, 0xF0, 0x00,
+	/* '%', 20 pixels wide */
+	0xF0, 0xF0, 0xF0, 0x70, 0x18, 0x30, 0x04, 0x28, 0x80, 0x0B, 0x0F, 0x0B, 0x20, 0x0B, 0x4F, 0x04,
+	0x50, 0x04, 0x1F, 0x20, 0x04, 0x1F, 0x18, 0x0B, 0x1F, 0x40, 0x04, 0x1F, 0x04, 0x20, 0x0B, 0x0F,
+	0x08, 0x20, 0x1F, 0x04, 0x30, 0x0B, 0x0F, 0x0B, 0x30, 0x1F, 0x04, 0x20, 0x0B, 0x0F, 0x08, 0x20,
+	0x08, 0x1F, 0x40, 0x1F, 0x30, 0x08, 0x0F, 0x08, 0x10, 0x04, 0x1F, 0x04, 0x40, 0x1F, 0x04, 0x20,
+	0x0B, 0x0F, 0x08, 0x10, 0x0B, 0x0F, 0x08, 0x50, 0x0B, 0x0F, 0x08, 0x20, 0x1F, 0x04, 0x00, 0x08,
+	0x0F, 0x0B, 0x60, 0x08, 0x1F, 0x18, 0x0B, 0x0F, 0x0B, 0x00, 0x04, 0x1F, 0x04, 0x70, 0x0B, 0x4F,
+	0x04, 0x00, 0x1F, 0x08, 0x90, 0x04, 0x28, 0x10, 0x0B, 0x0F, 0x0B, 0x20, 0x28, 0x04, 0x80, 0x04,
+	0x1F, 0x10, 0x04, 0x4F, 0x0B, 0x70, 0x1F, 0x04, 0x10, 0x0B, 0x0F, 0x0B, 0x18, 0x1F, 0x08, 0x50,
+	0x0B, 0x0F, 0x0B, 0x10, 0x04, 0x1F, 0x20, 0x08, 0x0F, 0x0B, 0x40, 0x04, 0x1F, 0x20, 0x08, 0x0F,
+	0x0B, 0x20, 0x04, 0x1F, 0x30, 0x04, 0x1F, 0x04, 0x20, 0x08, 0x0F, 0x08, 0x30, 0x1F, 0x30, 0x0B,
+	0x0F, 0x0B, 0x30, 0x08, 0x0F, 0x0B, 0x20, 0x04, 0x1F, 0x20, 0x08, 0x0F, 0x0B, 0x40, 0x04, 0x1F,
+	0x20, 0x08, 0x0F, 0x0B, 0x10, 0x04, 0x1F, 0x04, 0x50, 0x1F, 0x0B, 0x18, 0x1F, 0x04, 0x10, 0x0B,
+	0x0F, 0x08, 0x60, 0x04, 0x4F, 0x0B, 0x10, 0x08, 0x0F, 0x0B, 0x90, 0x28, 0x04, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0x90,
+	/* '&', 19 pixels wide */
+	0xF0, 0xF0, 0x90, 0x04, 0x08, 0x3F, 0x0B, 0x04, 0x90, 0x08, 0x7F, 0x04, 0x70, 0x04, 0x1F, 0x0B,
+	0x04, 0x10, 0x04, 0x2F, 0x70, 0x0B, 0x1F, 0x40, 0x08, 0x1F, 0x08, 0x60, 0x2F, 0x40, 0x08, 0x1F,
+	0x08, 0x60, 0x2F, 0x40, 0x08, 0x1F, 0x08, 0x60, 0x0B, 0x1F, 0x04, 0x20, 0x04, 0x2F, 0x70, 0x04,
+	0x1F, 0x0B, 0x10, 0x04, 0x2F, 0x04, 0x80, 0x0B, 0x1F, 0x18, 0x2F, 0x04, 0xA0, 0x4F, 0x0B, 0xB0,
+	0x04, 0x0B, 0x2F, 0x04, 0x40, 0x04, 0x1F, 0x30, 0x04, 0x4F, 0x0B, 0x40, 0x08, 0x1F, 0x20, 0x04,
+	0x1F, 0x0B, 0x00, 0x0B, 0x1F, 0x0B, 0x30, 0x08, 0x1F, 0x10, 0x04, 0x1F, 0x0B, 0x20, 0x0B, 0x1F,
+	0x0B, 0x20, 0x08, 0x1F, 0x10, 0x08, 0x1F, 0x04, 0x30, 0x0B, 0x1F, 0x0B, 0x10, 0x1F, 0x08, 0x10,
+	0x0B, 0x1F, 0x50, 0x0B, 0x1F, 0x0B, 0x04, 0x1F, 0x04, 0x10, 0x2F, 0x60, 0x0B, 0x3F, 0x0B, 0x20,
+	0x08, 0x1F, 0x04, 0x60, 0x0B, 0x2F, 0x04, 0x20, 0x08, 0x1F, 0x0B, 0x60, 0x0B, 0x3F, 0x04, 0x20,
+	0x0B, 0x1F, 0x0B, 0x04, 0x20, 0x08, 0x2F, 0x08, 0x2F, 0x04, 0x20, 0x0B, 0x7F, 0x0B, 0x04, 0x00,
+	0x04, 0x3F, 0x20, 0x04, 0x0B, 0x3F, 0x08, 0x04, 0x40, 0x0B, 0x1F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x10,
+	/* ''', 3 pixels wide */
+	0x20, 0x04, 0x18, 0x2F, 0x0B, 0x1F, 0x08, 0x0F, 0x0B, 0x08, 0x0F, 0x18, 0x0F, 0x18, 0x0F, 0x18,
+	0x0F, 0x08, 0x04, 0x08, 0x04, 0xF0, 0xF0, 0xF0, 0xB0,
+	/* '(', 6 pixels wide */
+	0x80, 0x04, 0x08, 0x04, 0x20, 0x1F, 0x08, 0x10, 0x04, 0x1F, 0x20, 0x0B, 0x0F, 0x08, 0x10, 0x04,
+	0x1F, 0x04, 0x10, 0x08, 0x1F, 0x20, 0x1F, 0x0B, 0x20, 0x1F, 0x08, 0x10, 0x08, 0x1F, 0x04, 0x10,
+	0x08, 0x1F, 0x20, 0x0B, 0x1F, 0x20, 0x2F, 0x20, 0x2F, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20,
+	0x1F, 0x0B, 0x20, 0x2F, 0x20, 0x2F, 0x20, 0x08, 0x1F, 0x20, 0x08, 0x1F, 0x20, 0x04, 0x1F, 0x08,
+	0x20, 0x1F, 0x08, 0x20, 0x0B, 0x1F, 0x20, 0x08, 0x1F, 0x04, 0x20, 0x1F, 0x08, 0x20, 0x08, 0x1F,
+	0x20, 0x04, 0x1F, 0x04, 0x20, 0x0B, 0x0F, 0x08, 0x50,
+	/* ')', 6 pixels wide */
+	0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x8F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x0B,
+	0xFB, 0x00, 0x08, 0xFF, 0x00, 0x04, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x8F,
+	0xF0, 0x00, 0x8F, 0xF4, 0x00, 0x8F, 0xF8, 0x00, 0x4F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8,
+	0x00, 0x0F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00,
+	0xFF, 0xB0, 0x00, 0xFF, 0x80, 0x08, 0xFF, 0x40, 0x08, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x8F, 0xF0,
+	0x00, 0xBF, 0xB0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+	/* '*', 11 pixels wide */
+	0xE0, 0x04, 0x08, 0x04, 0x70, 0x08, 0x0F, 0x08, 0x40, 0x04, 0x10, 0x08, 0x0F, 0x08, 0x10, 0x04,
+	0x00, 0x0B, 0x0F, 0x08, 0x00, 0x08, 0x0F, 0x08, 0x00, 0x0B, 0x0F, 0x08, 0x0B, 0x1F, 0x1B, 0x0F,
+	0x04, 0x2F, 0x0B, 0x00, 0x04, 0x08, 0x4F, 0x08, 0x40, 0x08, 0x2F, 0x08, 0x20, 0x04, 0x0B, 0x3F,
+	0x0B, 0x1F, 0x08, 0x04, 0x2F, 0x04, 0x08, 0x0F, 0x04, 0x08, 0x1F, 0x0B, 0x04, 0x0B, 0x10, 0x08,
+	0x0F, 0x08, 0x00, 0x04, 0x0B, 0x04, 0x30, 0x08, 0x0F, 0x08, 0x70, 0x08, 0x0F, 0x08, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+	/* '+', 14 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x18, 0xB0, 0x1F, 0xB0, 0x1F, 0xB0, 0x1F, 0xB0, 0x1F,
+	0xB0, 0x1F, 0x50, 0x04, 0x48, 0x1F, 0x48, 0x04, 0xDF, 0x04, 0x48, 0x1F, 0x48, 0x04, 0x50, 0x1F,
+	0xB0, 0x1F, 0xB0, 0x1F, 0xB0, 0x1F, 0xB0, 0x1F, 0xB0, 0x18, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x50,
+	/* ',', 6 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x90, 0x08, 0x1F, 0x04, 0x10, 0x08, 0x1F, 0x08, 0x10,
+	0x08, 0x1F, 0x20, 0x0B, 0x0F, 0x0B, 0x10, 0x04, 0x1F, 0x04, 0x10, 0x0B, 0x0F, 0x0B, 0x10, 0x04,
+	0x1F, 0x20, 0x0B, 0x0F, 0x04, 0xE0,
+	/* '-', 8 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x68, 0x04, 0x6F, 0x78, 0x04, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x70,
+	/* '.', 4 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x0B, 0x1F, 0x00, 0x2F, 0x08, 0x2F, 0x14, 0x18, 0xF0, 0x80,
+	/* '/', 12 pixels wide */
+	0x90, 0x18, 0x80, 0x08, 0x1F, 0x80, 0x1F, 0x08, 0x70, 0x04, 0x1F, 0x04, 0x70, 0x0B, 0x1F, 0x80,
+	0x1F, 0x08, 0x70, 0x08, 0x1F, 0x04, 0x70, 0x0B, 0x0F, 0x0B, 0x80, 0x1F, 0x08, 0x70, 0x08, 0x1F,
+	0x80, 0x0B, 0x0F, 0x0B, 0x70, 0x04, 0x1F, 0x08, 0x70, 0x08, 0x1F, 0x80, 0x1F, 0x08, 0x70, 0x04,
+	0x1F, 0x04, 0x70, 0x08, 0x1F, 0x80, 0x1F, 0x08, 0x70, 0x08, 0x1F, 0x04, 0x70, 0x0B, 0x1F, 0x80,
+	0x1F, 0x08, 0x70, 0x08, 0x1F, 0x80, 0x0B, 0x0F, 0x0B, 0x70, 0x04, 0x1F, 0x08, 0x70, 0x08, 0x1F,
+	0x80, 0x1F, 0x0B, 0x70, 0x04, 0x1F, 0x04, 0x70, 0x08, 0x1F, 0x80, 0x1F, 0x08, 0xF0, 0xF0, 0x00,
+	/* '0', 14 pixels wide */
+	0xF0, 0xF0, 0xD0, 0x08, 0x3F, 0x0B, 0x04, 0x40, 0x04, 0x7F, 0x0B, 0x20, 0x04, 0x1F, 0x0B, 0x04,
+	0x10, 0x04, 0x0B, 0x1F, 0x04, 0x10, 0x0B, 0x0F, 0x0B, 0x50, 0x0B, 0x1F, 0x10, 0x1F, 0x04, 0x50,
+	0x04, 0x1F, 0x04, 0x08, 0x1F, 0x70, 0x1F, 0x18, 0x0F, 0x0B, 0x70, 0x0B, 0x0F, 0x0B, 0x1F, 0x08,
+	0x70, 0x08, 0x3F, 0x08, 0x70, 0x08, 0x3F, 0x08, 0x70, 0x08, 0x3F, 0x08, 0x70, 0x08, 0x3F, 0x08,
+	0x70, 0x08, 0x3F, 0x08, 0x70, 0x08, 0x3F, 0x08, 0x70, 0x08, 0x1F, 0x0B, 0x0F, 0x0B, 0x70, 0x0B,
+	0x0F, 0x18, 0x1F, 0x70, 0x1F, 0x08, 0x04, 0x1F, 0x04, 0x50, 0x04, 0x1F, 0x10, 0x1F, 0x0B, 0x50,
+	0x0B, 0x0F, 0x0B, 0x10, 0x04, 0x1F, 0x0B, 0x04, 0x10, 0x04, 0x0B, 0x1F, 0x04, 0x20, 0x0B, 0x7F,
+	0x04, 0x40, 0x04, 0x0B, 0x3F, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70,
+	/* '1', 12 pixels wide */
+	0xF0, 0xF0, 0x80, 0x18, 0x04, 0x60, 0x04, 0x0B, 0x1F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x30, 0x04,
+	0x0B, 0x1F, 0x0B, 0x1F, 0x08, 0x30, 0x2F, 0x08, 0x00, 0x1F, 0x08, 0x30, 0x0F, 0x0B, 0x20, 0x1F,
+	0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08,
+	0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80,
+	0x1F, 0x08, 0x80, 0x1F, 0x08, 0x30, 0x48, 0x1F, 0x0B, 0x28, 0x04, 0xAF, 0xB8, 0x04, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x70,
+	/* '2', 13 pixels wide */
+	0xF0, 0xF0, 0x80, 0x04, 0x08, 0x3F, 0x08, 0x40, 0x0B, 0x7F, 0x04, 0x10, 0x08, 0x2F, 0x28, 0x2F,
+	0x0B, 0x10, 0x08, 0x0B, 0x04, 0x40, 0x0B, 0x1F, 0x04, 0x80, 0x04, 0x1F, 0x08, 0x90, 0x1F, 0x08,
+	0x90, 0x1F, 0x08, 0x80, 0x04, 0x1F, 0x04, 0x80, 0x0B, 0x1F, 0x80, 0x04, 0x1F, 0x08, 0x80, 0x0B,
+	0x0F, 0x0B, 0x80, 0x0B, 0x1F, 0x04, 0x70, 0x0B, 0x1F, 0x04, 0x70, 0x08, 0x1F, 0x0B, 0x70, 0x04,
+	0x1F, 0x0B, 0x70, 0x04, 0x1F, 0x0B, 0x70, 0x04, 0x1F, 0x0B, 0x70, 0x04, 0x1F, 0x0B, 0x80, 0xBF,
+	0x08, 0xBF, 0xC8, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xD0,
+	/* '3', 13 pixels wide */
+	0xF0, 0xF0, 0x80, 0x04, 0x08, 0x3F, 0x08, 0x40, 0x0B, 0x7F, 0x04, 0x10, 0x08, 0x1F, 0x08, 0x20,
+	0x08, 0x2F, 0x10, 0x08, 0x0B, 0x50, 0x08, 0x1F, 0x04, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90,
+	0x1F, 0x08, 0x80, 0x08, 0x1F, 0x80, 0x04, 0x1F, 0x08, 0x30, 0x38, 0x2F, 0x08, 0x40, 0x5F, 0x08,
+	0x04, 0x40, 0x48, 0x2F, 0x0B, 0x90, 0x08, 0x1F, 0x0B, 0x90, 0x08, 0x1F, 0x04, 0x90, 0x1F, 0x08,
+	0x90, 0x1F, 0x08, 0x80, 0x04, 0x1F, 0x18, 0x70, 0x0B, 0x1F, 0x00, 0x1F, 0x08, 0x04, 0x20, 0x04,
+	0x0B, 0x1F, 0x08, 0x00, 0x0B, 0x8F, 0x08, 0x20, 0x04, 0x08, 0x4F, 0x08, 0x04, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x00,
+	/* '4', 15 pixels wide */
+	0xF0, 0xF0, 0xF0, 0x40, 0x28, 0x04, 0x90, 0x0B, 0x2F, 0x08, 0x80, 0x04, 0x3F, 0x08, 0x80, 0x0B,
+	0x0F, 0x08, 0x1F, 0x08, 0x70, 0x08, 0x1F, 0x00, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x00, 0x1F, 0x08,
+	0x60, 0x0B, 0x0F, 0x0B, 0x10, 0x1F, 0x08, 0x50, 0x04, 0x1F, 0x04, 0x10, 0x1F, 0x08, 0x50, 0x0B,
+	0x0F, 0x0B, 0x20, 0x1F, 0x08, 0x40, 0x04, 0x1F, 0x30, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x30, 0x1F,
+	0x08, 0x30, 0x08, 0x1F, 0x40, 0x1F, 0x08, 0x20, 0x04, 0x1F, 0x04, 0x40, 0x1F, 0x08, 0x20, 0x0B,
+	0x0F, 0x0B, 0x50, 0x1F, 0x08, 0x20, 0xDF, 0x04, 0xDF, 0x04, 0x80, 0x1F, 0x08, 0xB0, 0x1F, 0x08,
+	0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x18, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0,
+	/* '5', 13 pixels wide */
+	0xF0, 0xF0, 0x70, 0x98, 0x04, 0x10, 0x9F, 0x08, 0x10, 0x9F, 0x08, 0x10, 0x1F, 0x08, 0x90, 0x1F,
+	0x08, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x0B, 0x38, 0x04, 0x40,
+	0x8F, 0x08, 0x20, 0x58, 0x0B, 0x2F, 0x0B, 0x90, 0x0B, 0x1F, 0x04, 0x90, 0x1F, 0x0B, 0x90, 0x08,
+	0x1F, 0x90, 0x08, 0x1F, 0x90, 0x08, 0x1F, 0x90, 0x1F, 0x0B, 0x08, 0x70, 0x08, 0x1F, 0x04, 0x1F,
+	0x08, 0x04, 0x20, 0x04, 0x0B, 0x1F, 0x0B, 0x00, 0x9F, 0x08, 0x20, 0x18, 0x3F, 0x0B, 0x08, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0x10,
+	/* '6', 14 pixels wide */
+	0xF0, 0xF0, 0xE0, 0x08, 0x4F, 0x08, 0x04, 0x30, 0x08, 0x7F, 0x08, 0x20, 0x08, 0x1F, 0x0B, 0x04,
+	0x20, 0x04, 0x08, 0x04, 0x10, 0x04, 0x1F, 0x04, 0x90, 0x0B, 0x0F, 0x0B, 0x90, 0x04, 0x1F, 0x04,
+	0x90, 0x08, 0x1F, 0xA0, 0x08, 0x0F, 0x08, 0xA0, 0x1F, 0x08, 0x04, 0x08, 0x3F, 0x0B, 0x08, 0x20,
+	0xAF, 0x0B, 0x10, 0x2F, 0x0B, 0x08, 0x30, 0x0B, 0x1F, 0x0B, 0x00, 0x1F, 0x0B, 0x60, 0x0B, 0x1F,
+	0x00, 0x1F, 0x08, 0x60, 0x04, 0x1F, 0x08, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x1F, 0x08, 0x70, 0x1F,
+	0x18, 0x1F, 0x70, 0x1F, 0x18, 0x1F, 0x04, 0x50, 0x08, 0x1F, 0x10, 0x1F, 0x0B, 0x50, 0x1F, 0x0B,
+	0x10, 0x08, 0x1F, 0x0B, 0x20, 0x04, 0x2F, 0x04, 0x20, 0x0B, 0x7F, 0x04, 0x40, 0x08, 0x0B, 0x2F,
+	0x0B, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70,
+	/* '7', 13 pixels wide */
+	0xF0, 0xF0, 0x60, 0xC8, 0xFF, 0x9F, 0x90, 0x1F, 0x0B, 0x80, 0x08, 0x1F, 0x04, 0x80, 0x1F, 0x0B,
+	0x80, 0x08, 0x1F, 0x04, 0x80, 0x2F, 0x80, 0x04, 0x1F, 0x08, 0x80, 0x0B, 0x1F, 0x80, 0x04, 0x1F,
+	0x08, 0x80, 0x0B, 0x1F, 0x04, 0x70, 0x04, 0x1F, 0x0B, 0x80, 0x08, 0x1F, 0x04, 0x80, 0x1F, 0x0B,
+	0x80, 0x08, 0x1F, 0x08, 0x80, 0x2F, 0x80, 0x08, 0x1F, 0x08, 0x80, 0x0B, 0x1F, 0x80, 0x04, 0x1F,
+	0x0B, 0x80, 0x04, 0x18, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x50,
+	/* '8', 14 pixels wide */
+	0xF0, 0xF0, 0xC0, 0x08, 0x0B, 0x3F, 0x08, 0x04, 0x40, 0x0B, 0x7F, 0x0B, 0x20, 0x0B, 0x1F, 0x08,
+	0x20, 0x04, 0x0B, 0x1F, 0x08, 0x00, 0x04, 0x1F, 0x04, 0x50, 0x0B, 0x1F, 0x00, 0x08, 0x1F, 0x60,
+	0x08, 0x1F, 0x00, 0x08, 0x1F, 0x60, 0x08, 0x1F, 0x00, 0x04, 0x1F, 0x08, 0x50, 0x1F, 0x08, 0x10,
+	0x0B, 0x1F, 0x04, 0x30, 0x0B, 0x1F, 0x04, 0x10, 0x04, 0x2F, 0x0B, 0x14, 0x0B, 0x1F, 0x04, 0x40,
+	0x0B, 0x4F, 0x0B, 0x04, 0x50, 0x04, 0x0B, 0x3F, 0x0B, 0x04, 0x40, 0x08, 0x1F, 0x0B, 0x08, 0x0B,
+	0x2F, 0x04, 0x20, 0x0B, 0x1F, 0x08, 0x20, 0x04, 0x2F, 0x04, 0x00, 0x04, 0x1F, 0x04, 0x50, 0x0B,
+	0x1F, 0x00, 0x0B, 0x0F, 0x0B, 0x60, 0x04, 0x1F, 0x08, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x1F, 0x08,
+	0x70, 0x1F, 0x08, 0x0B, 0x1F, 0x60, 0x08, 0x1F, 0x14, 0x1F, 0x0B, 0x08, 0x20, 0x04, 0x08, 0x1F,
+	0x0B, 0x10, 0x04, 0x8F, 0x0B, 0x30, 0x04, 0x08, 0x4F, 0x08, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0x60,
+	/* '9', 14 pixels wide */
+	0xF0, 0xF0, 0xC0, 0x04, 0x0B, 0x3F, 0x08, 0x50, 0x0B, 0x7F, 0x04, 0x20, 0x0B, 0x1F, 0x08, 0x20,
+	0x08, 0x2F, 0x10, 0x04, 0x1F, 0x08, 0x40, 0x04, 0x1F, 0x08, 0x00, 0x08, 0x1F, 0x60, 0x0B, 0x1F,
+	0x00, 0x1F, 0x08, 0x60, 0x08, 0x1F, 0x00, 0x1F, 0x08, 0x60, 0x04, 0x1F, 0x08, 0x1F, 0x08, 0x70,
+	0x1F, 0x08, 0x1F, 0x0B, 0x70, 0x1F, 0x18, 0x1F, 0x04, 0x60, 0x1F, 0x08, 0x04, 0x2F, 0x08, 0x20,
+	0x04, 0x08, 0x2F, 0x08, 0x00, 0x04, 0xAF, 0x08, 0x10, 0x04, 0x08, 0x3F, 0x0B, 0x08, 0x00, 0x1F,
+	0x08, 0xA0, 0x1F, 0xA0, 0x08, 0x1F, 0xA0, 0x0B, 0x0F, 0x08, 0x90, 0x04, 0x1F, 0x04, 0x80, 0x04,
+	0x1F, 0x0B, 0x10, 0x04, 0x18, 0x30, 0x08, 0x1F, 0x0B, 0x20, 0x08, 0x7F, 0x0B, 0x40, 0x08, 0x0B,
+	0x3F, 0x08, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x80,
+	/* ':', 4 pixels wide */
+	0xF0, 0xF0, 0x04, 0x18, 0x00, 0x2F, 0x08, 0x2F, 0x08, 0x0B, 0x1F, 0x04, 0xF0, 0xF0, 0x0B, 0x1F,
+	0x04, 0x2F, 0x08, 0x2F, 0x08, 0x04, 0x18, 0xF0, 0x80,
+	/* ';', 5 pixels wide */
+	0xF0, 0xF0, 0xD0, 0x04, 0x1F, 0x0B, 0x00, 0x08, 0x2F, 0x00, 0x08, 0x2F, 0x10, 0x18, 0x04, 0xF0,
+	0xF0, 0x40, 0x0B, 0x0F, 0x0B, 0x10, 0x2F, 0x10, 0x2F, 0x10, 0x1F, 0x08, 0x00, 0x08, 0x1F, 0x10,
+	0x1F, 0x04, 0x00, 0x08, 0x0F, 0x0B, 0x10, 0x1F, 0xC0,
+	/* '<', 14 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0, 0x04, 0x0F, 0x08, 0x80, 0x04, 0x0B, 0x1F, 0x08, 0x60,
+	0x04, 0x0B, 0x2F, 0x0B, 0x50, 0x04, 0x0B, 0x2F, 0x0B, 0x04, 0x40, 0x04, 0x0B, 0x2F, 0x0B, 0x04,
+	0x40, 0x04, 0x0B, 0x2F, 0x0B, 0x04, 0x50, 0x0B, 0x2F, 0x0B, 0x04, 0x70, 0x2F, 0x04, 0x90, 0x0B,
+	0x2F, 0x08, 0x90, 0x04, 0x0B, 0x2F, 0x08, 0x90, 0x04, 0x0B, 0x2F, 0x08, 0x90, 0x04, 0x0B, 0x2F,
+	0x08, 0x90, 0x04, 0x0B, 0x2F, 0x08, 0x90, 0x04, 0x0B, 0x1F, 0x08, 0xA0, 0x04, 0x0F, 0x08, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	/* '=', 13 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x10, 0xC8, 0xCF, 0xC8, 0xF0, 0xF0, 0x60, 0xC8,
+	0xCF, 0xC8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+	/* '>', 14 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x10, 0x0F, 0x08, 0xB0, 0x2F, 0x08, 0x90, 0x04, 0x3F, 0x08,
+	0x90, 0x08, 0x3F, 0x08, 0x90, 0x08, 0x3F, 0x08, 0x90, 0x04, 0x0B, 0x2F, 0x08, 0x90, 0x04, 0x0B,
+	0x2F, 0x04, 0x90, 0x0B, 0x1F, 0x08, 0x70, 0x08, 0x3F, 0x04, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08,
+	0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x04, 0x3F, 0x08, 0x70, 0x2F, 0x08, 0x90, 0x0F, 0x08,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB0,
+	/* '?', 11 pixels wide */
+	0xF0, 0x60, 0x08, 0x0B, 0x3F, 0x08, 0x20, 0x0B, 0x7F, 0x04, 0x00, 0x1F, 0x08, 0x20, 0x08, 0x2F,
+	0x00, 0x08, 0x50, 0x04, 0x1F, 0x08, 0x70, 0x0B, 0x1F, 0x70, 0x08, 0x1F, 0x70, 0x08, 0x1F, 0x70,
+	0x0B, 0x1F, 0x60, 0x04, 0x1F, 0x08, 0x50, 0x04, 0x0B, 0x1F, 0x04, 0x20, 0x04, 0x4F, 0x04, 0x30,
+	0x08, 0x2F, 0x0B, 0x04, 0x40, 0x08, 0x1F, 0x70, 0x08, 0x1F, 0x70, 0x08, 0x1F, 0x70, 0x08, 0x1F,
+	0x70, 0x04, 0x18, 0xF0, 0x20, 0x04, 0x08, 0x04, 0x70, 0x2F, 0x70, 0x2F, 0x70, 0x0B, 0x0F, 0x0B,
+	0xF0, 0xF0, 0xF0, 0xF0, 0x60,
+	/* '@', 23 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xC0, 0x04, 0x08, 0x5F, 0x18, 0xA0, 0x08, 0xBF, 0x08, 0x60, 0x04, 0x0B,
+	0x1F, 0x0B, 0x08, 0x04, 0x30, 0x04, 0x08, 0x2F, 0x0B, 0x40, 0x04, 0x2F, 0x04, 0x90, 0x0B, 0x1F,
+	0x0B, 0x30, 0x0B, 0x0F, 0x0B, 0xC0, 0x0B, 0x1F, 0x04, 0x10, 0x0B, 0x1F, 0x30, 0x04, 0x18, 0x04,
+	0x10, 0x04, 0x08, 0x20, 0x1F, 0x08, 0x00, 0x04, 0x1F, 0x04, 0x20, 0x0B, 0x3F, 0x0B, 0x00, 0x1F,
+	0x20, 0x0B, 0x1F, 0x00, 0x08, 0x0F, 0x0B, 0x20, 0x0B, 0x1F, 0x0B, 0x08, 0x0B, 0x0F, 0x0B, 0x1F,
+	0x20, 0x08, 0x1F, 0x00, 0x1F, 0x08, 0x10, 0x04, 0x1F, 0x08, 0x20, 0x0B, 0x1F, 0x08, 0x20, 0x08,
+	0x1F, 0x04, 0x1F, 0x20, 0x0B, 0x0F, 0x0B, 0x40, 0x1F, 0x08, 0x20, 0x08, 0x1F, 0x08, 0x1F, 0x20,
+	0x1F, 0x08, 0x40, 0x1F, 0x04, 0x20, 0x08, 0x1F, 0x0B, 0x0F, 0x08, 0x10, 0x04, 0x1F, 0x40, 0x04,
+	0x1F, 0x30, 0x08, 0x0F, 0x0B, 0x1F, 0x08, 0x10, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x30, 0x1F, 0x08,
+	0x1F, 0x08, 0x10, 0x08, 0x1F, 0x40, 0x08, 0x0F, 0x08, 0x30, 0x1F, 0x04, 0x1F, 0x08, 0x10, 0x08,
+	0x1F, 0x30, 0x08, 0x1F, 0x08, 0x20, 0x0B, 0x1F, 0x00, 0x1F, 0x08, 0x10, 0x04, 0x1F, 0x08, 0x10,
+	0x0B, 0x3F, 0x10, 0x08, 0x1F, 0x04, 0x00, 0x1F, 0x08, 0x20, 0x5F, 0x0B, 0x00, 0x5F, 0x0B, 0x10,
+	0x0B, 0x0F, 0x0B, 0x20, 0x04, 0x0B, 0x1F, 0x0B, 0x04, 0x10, 0x04, 0x0B, 0x1F, 0x0B, 0x04, 0x20,
+	0x08, 0x1F, 0xF0, 0x30, 0x04, 0x1F, 0x08, 0xF0, 0x30, 0x0B, 0x1F, 0x04, 0xF0, 0x30, 0x0B, 0x1F,
+	0x0B, 0x04, 0x70, 0x14, 0x80, 0x0B, 0x3F, 0x48, 0x0B, 0x1F, 0x08, 0x90, 0x04, 0x0B, 0x8F, 0x0B,
+	0x04, 0xC0, 0x04, 0x48, 0x04, 0xF0, 0xF0, 0xF0, 0x60,
+	/* 'A', 18 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xC0, 0x28, 0x04, 0xC0, 0x04, 0x2F, 0x0B, 0xC0, 0x08, 0x3F, 0xC0, 0x1F, 0x0B,
+	0x1F, 0x08, 0xA0, 0x04, 0x1F, 0x00, 0x1F, 0x0B, 0xA0, 0x0B, 0x0F, 0x0B, 0x00, 0x08, 0x1F, 0x04,
+	0x90, 0x1F, 0x08, 0x10, 0x1F, 0x08, 0x80, 0x08, 0x1F, 0x20, 0x0B, 0x1F, 0x80, 0x0B, 0x0F, 0x0B,
+	0x20, 0x08, 0x1F, 0x04, 0x70, 0x1F, 0x08, 0x30, 0x1F, 0x0B, 0x60, 0x08, 0x1F, 0x40, 0x0B, 0x1F,
+	0x60, 0x1F, 0x08, 0x40, 0x08, 0x1F, 0x08, 0x40, 0x04, 0x1F, 0x04, 0x50, 0x1F, 0x0B, 0x40, 0x08,
+	0xBF, 0x40, 0xCF, 0x08, 0x20, 0x08, 0x1F, 0x04, 0x70, 0x2F, 0x20, 0x0B, 0x1F, 0x80, 0x08, 0x1F,
+	0x04, 0x10, 0x1F, 0x08, 0x80, 0x04, 0x1F, 0x08, 0x00, 0x08, 0x1F, 0x04, 0x90, 0x2F, 0x00, 0x0B,
+	0x1F, 0xA0, 0x08, 0x1F, 0x28, 0x04, 0xA0, 0x04, 0x18, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xB0,
+	/* 'B', 14 pixels wide */
+	0xF0, 0xF0, 0x90, 0x04, 0x68, 0x50, 0x8F, 0x0B, 0x04, 0x20, 0x1F, 0x0B, 0x38, 0x0B, 0x2F, 0x20,
+	0x1F, 0x08, 0x40, 0x04, 0x1F, 0x08, 0x10, 0x1F, 0x08, 0x50, 0x0B, 0x1F, 0x10, 0x1F, 0x08, 0x50,
+	0x08, 0x1F, 0x10, 0x1F, 0x08, 0x50, 0x08, 0x1F, 0x10, 0x1F, 0x08, 0x50, 0x0B, 0x0F, 0x0B, 0x10,
+	0x1F, 0x08, 0x40, 0x04, 0x1F, 0x04, 0x10, 0x1F, 0x0B, 0x38, 0x0B, 0x1F, 0x04, 0x20, 0x9F, 0x08,
+	0x20, 0x1F, 0x0B, 0x48, 0x0B, 0x2F, 0x04, 0x00, 0x1F, 0x08, 0x50, 0x04, 0x1F, 0x0B, 0x00, 0x1F,
+	0x08, 0x60, 0x04, 0x1F, 0x04, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x1F,
+	0x08, 0x60, 0x04, 0x1F, 0x04, 0x1F, 0x08, 0x50, 0x04, 0x1F, 0x0B, 0x00, 0x1F, 0x0B, 0x48, 0x0B,
+	0x2F, 0x04, 0x00, 0x9F, 0x0B, 0x04, 0x10, 0x04, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x80,
+	/* 'C', 15 pixels wide */
+	0xF0, 0xF0, 0xF0, 0x10, 0x08, 0x0B, 0x3F, 0x08, 0x04, 0x40, 0x04, 0x0B, 0x7F, 0x0B, 0x20, 0x04,
+	0x3F, 0x28, 0x0B, 0x2F, 0x08, 0x10, 0x2F, 0x04, 0x50, 0x08, 0x0F, 0x08, 0x00, 0x0B, 0x1F, 0x04,
+	0x70, 0x14, 0x00, 0x1F, 0x0B, 0xA0, 0x08, 0x1F, 0x04, 0xA0, 0x08, 0x1F, 0xB0, 0x1F, 0x08, 0xB0,
+	0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x0B, 0xB0, 0x08,
+	0x1F, 0xB0, 0x04, 0x1F, 0x08, 0xB0, 0x2F, 0x04, 0x70, 0x14, 0x00, 0x04, 0x2F, 0x04, 0x50, 0x08,
+	0x0F, 0x08, 0x10, 0x0B, 0x3F, 0x28, 0x0B, 0x2F, 0x08, 0x20, 0x08, 0x8F, 0x0B, 0x50, 0x08, 0x3F,
+	0x0B, 0x08, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB0,
+	/* 'D', 16 pixels wide */
+	0xF0, 0xF0, 0xF0, 0x04, 0x68, 0x04, 0x60, 0x9F, 0x08, 0x40, 0x1F, 0x0B, 0x48, 0x3F, 0x04, 0x20,
+	0x1F, 0x08, 0x50, 0x04, 0x2F, 0x04, 0x10, 0x1F, 0x08, 0x70, 0x0B, 0x1F, 0x10, 0x1F, 0x08, 0x70,
+	0x04, 0x1F, 0x08, 0x00, 0x1F, 0x08, 0x80, 0x08, 0x1F, 0x00, 0x1F, 0x08, 0x80, 0x04, 0x1F, 0x04,
+	0x1F, 0x08, 0x90, 0x1F, 0x08, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x1F,
+	0x08, 0x90, 0x1F, 0x08, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x1F, 0x08, 0x80, 0x08, 0x1F, 0x00, 0x1F,
+	0x08, 0x80, 0x0B, 0x1F, 0x00, 0x1F, 0x08, 0x70, 0x04, 0x1F, 0x08, 0x00, 0x1F, 0x08, 0x60, 0x04,
+	0x2F, 0x10, 0x1F, 0x08, 0x40, 0x08, 0x0B, 0x2F, 0x04, 0x10, 0xBF, 0x04, 0x20, 0x9F, 0x08, 0x40,
+	0x04, 0x68, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70,
+	/* 'E', 12 pixels wide */
+	0xF0, 0xF0, 0x30, 0x04, 0x98, 0x04, 0xAF, 0x08, 0x1F, 0x0B, 0x78, 0x04, 0x1F, 0x08, 0x80, 0x1F,
+	0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x9F, 0x10,
+	0x9F, 0x10, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08,
+	0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x0B, 0x78, 0x04, 0xAF, 0x08, 0x04, 0x98, 0x04,
+	0xF0, 0xF0, 0xF0, 0xF0, 0x70,
+	/* 'F', 11 pixels wide */
+	0xF0, 0xF0, 0x00, 0x04, 0x88, 0x04, 0x9F, 0x08, 0x9F, 0x08, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70,
+	0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x0B, 0x68, 0x00,
+	0x9F, 0x00, 0x1F, 0x0B, 0x68, 0x00, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F,
+	0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x18, 0x04,
+	0xF0, 0xF0, 0xF0, 0xF0, 0x90,
+	/* 'G', 17 pixels wide */
+	0xF0, 0xF0, 0xF0, 0x80, 0x08, 0x0B, 0x3F, 0x0B, 0x08, 0x60, 0x08, 0x9F, 0x04, 0x30, 0x0B, 0x3F,
+	0x38, 0x3F, 0x04, 0x10, 0x0B, 0x1F, 0x0B, 0x04, 0x50, 0x04, 0x0B, 0x0F, 0x08, 0x00, 0x08, 0x1F,
+	0x0B, 0x90, 0x14, 0x00, 0x1F, 0x0B, 0xC0, 0x08, 0x1F, 0x04, 0xC0, 0x08, 0x1F, 0xD0, 0x1F, 0x08,
+	0xD0, 0x1F, 0x08, 0x40, 0x04, 0x68, 0x00, 0x1F, 0x08, 0x40, 0x08, 0x6F, 0x08, 0x1F, 0x08, 0x40,
+	0x04, 0x48, 0x1F, 0x08, 0x1F, 0x08, 0xA0, 0x1F, 0x08, 0x0B, 0x1F, 0xA0, 0x1F, 0x18, 0x1F, 0x04,
+	0x90, 0x1F, 0x08, 0x00, 0x1F, 0x0B, 0x90, 0x1F, 0x08, 0x00, 0x08, 0x1F, 0x0B, 0x80, 0x1F, 0x08,
+	0x10, 0x0B, 0x1F, 0x0B, 0x04, 0x50, 0x04, 0x1F, 0x08, 0x10, 0x04, 0x4F, 0x38, 0x3F, 0x08, 0x30,
+	0x0B, 0x9F, 0x0B, 0x04, 0x40, 0x04, 0x08, 0x0B, 0x3F, 0x0B, 0x08, 0x04, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x70,
+	/* 'H', 15 pixels wide */
+	0xF0, 0xF0, 0xC0, 0x18, 0x04, 0x80, 0x18, 0x04, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x1F, 0x08, 0x80,
+	0x1F, 0x08, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x1F, 0x08, 0x80, 0x1F,
+	0x08, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x1F, 0x0B, 0x88, 0x1F, 0x08,
+	0xDF, 0x08, 0xDF, 0x08, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x1F, 0x08,
+	0x80, 0x1F, 0x08, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x1F, 0x08, 0x80,
+	0x1F, 0x08, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x1F, 0x08, 0x80, 0x1F,
+	0x28, 0x04, 0x80, 0x18, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x90,
+	/* 'I', 3 pixels wide */
+	0x80, 0x18, 0x04, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F,
+	0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F,
+	0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x28, 0x04, 0xF0, 0x10,
+	/* 'J', 8 pixels wide */
+	0xF0, 0xC0, 0x18, 0x04, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08,
+	0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40,
+	0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F,
+	0x08, 0x40, 0x1F, 0x18, 0x20, 0x04, 0x1F, 0x08, 0x1F, 0x18, 0x2F, 0x00, 0x5F, 0x08, 0x00, 0x04,
+	0x0B, 0x2F, 0x08, 0xF0, 0xF0, 0xF0, 0x10,
+	/* 'K', 13 pixels wide */
+	0xF0, 0xF0, 0x60, 0x18, 0x04, 0x60, 0x18, 0x04, 0x1F, 0x08, 0x50, 0x0B, 0x1F, 0x08, 0x1F, 0x08,
+	0x40, 0x0B, 0x1F, 0x0B, 0x00, 0x1F, 0x08, 0x30, 0x04, 0x1F, 0x0B, 0x10, 0x1F, 0x08, 0x20, 0x04,
+	0x1F, 0x0B, 0x20, 0x1F, 0x08, 0x20, 0x2F, 0x04, 0x20, 0x1F, 0x08, 0x10, 0x0B, 0x1F, 0x04, 0x30,
+	0x1F, 0x08, 0x00, 0x0B, 0x1F, 0x04, 0x40, 0x1F, 0x08, 0x04, 0x1F, 0x08, 0x50, 0x1F, 0x0B, 0x1F,
+	0x0B, 0x60, 0x1F, 0x0B, 0x2F, 0x60, 0x1F, 0x18, 0x1F, 0x0B, 0x50, 0x1F, 0x08, 0x00, 0x0B, 0x1F,
+	0x08, 0x40, 0x1F, 0x08, 0x10, 0x2F, 0x04, 0x30, 0x1F, 0x08, 0x10, 0x04, 0x2F, 0x30, 0x1F, 0x08,
+	0x20, 0x08, 0x1F, 0x0B, 0x20, 0x1F, 0x08, 0x30, 0x0B, 0x1F, 0x08, 0x10, 0x1F, 0x08, 0x40, 0x2F,
+	0x04, 0x00, 0x1F, 0x08, 0x40, 0x04, 0x2F, 0x04, 0x1F, 0x08, 0x50, 0x08, 0x1F, 0x0B, 0x18, 0x04,
+	0x60, 0x28, 0xF0, 0xF0, 0xF0, 0xF0, 0xD0,
+	/* 'L', 11 pixels wide */
+	0xF0, 0xF0, 0x00, 0x18, 0x04, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F,
+	0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08,
+	0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70,
+	0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x9F, 0x08, 0x9F, 0x08, 0x04, 0x88, 0x04,
+	0xF0, 0xF0, 0xF0, 0xF0, 0x10,
+	/* 'M', 22 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0x10, 0x04, 0x28, 0xD0, 0x28, 0x04, 0x3F, 0x0B, 0xB0, 0x08, 0x8F, 0xB0,
+	0x6F, 0x08, 0x1F, 0x08, 0x90, 0x04, 0x1F, 0x08, 0x3F, 0x08, 0x0B, 0x1F, 0x90, 0x0B, 0x0F, 0x0B,
+	0x08, 0x3F, 0x08, 0x04, 0x1F, 0x08, 0x70, 0x04, 0x1F, 0x04, 0x08, 0x3F, 0x08, 0x00, 0x1F, 0x0B,
+	0x70, 0x08, 0x1F, 0x00, 0x08, 0x3F, 0x08, 0x00, 0x08, 0x1F, 0x04, 0x60, 0x1F, 0x08, 0x00, 0x08,
+	0x3F, 0x08, 0x10, 0x1F, 0x08, 0x50, 0x08, 0x1F, 0x10, 0x08, 0x3F, 0x08, 0x10, 0x0B, 0x1F, 0x50,
+	0x1F, 0x08, 0x10, 0x08, 0x3F, 0x08, 0x10, 0x04, 0x1F, 0x08, 0x30, 0x04, 0x1F, 0x04, 0x10, 0x08,
+	0x3F, 0x08, 0x20, 0x2F, 0x30, 0x0B, 0x0F, 0x0B, 0x20, 0x08, 0x3F, 0x08, 0x20, 0x08, 0x1F, 0x04,
+	0x10, 0x04, 0x1F, 0x08, 0x20, 0x08, 0x3F, 0x08, 0x30, 0x1F, 0x0B, 0x10, 0x08, 0x1F, 0x30, 0x08,
+	0x3F, 0x08, 0x30, 0x0B, 0x1F, 0x04, 0x00, 0x1F, 0x08, 0x30, 0x08, 0x3F, 0x08, 0x30, 0x04, 0x1F,
+	0x18, 0x1F, 0x40, 0x08, 0x3F, 0x08, 0x40, 0x4F, 0x0B, 0x40, 0x08, 0x3F, 0x08, 0x40, 0x08, 0x3F,
+	0x04, 0x40, 0x08, 0x3F, 0x08, 0x50, 0x3F, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x1F, 0x08, 0x50,
+	0x08, 0x1F, 0x18, 0x04, 0x50, 0x04, 0x18, 0x60, 0x04, 0x18, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x30,
+	/* 'N', 16 pixels wide */
+	0xF0, 0xF0, 0xF0, 0x04, 0x18, 0x04, 0x80, 0x18, 0x04, 0x3F, 0x04, 0x70, 0x1F, 0x08, 0x3F, 0x0B,
+	0x70, 0x1F, 0x08, 0x4F, 0x08, 0x60, 0x1F, 0x08, 0x1F, 0x08, 0x2F, 0x60, 0x1F, 0x08, 0x1F, 0x18,
+	0x1F, 0x08, 0x50, 0x1F, 0x08, 0x1F, 0x08, 0x00, 0x0B, 0x1F, 0x04, 0x40, 0x1F, 0x08, 0x1F, 0x08,
+	0x00, 0x04, 0x1F, 0x0B, 0x40, 0x1F, 0x08, 0x1F, 0x08, 0x10, 0x0B, 0x1F, 0x04, 0x30, 0x1F, 0x08,
+	0x1F, 0x08, 0x10, 0x04, 0x2F, 0x30, 0x1F, 0x08, 0x1F, 0x08, 0x20, 0x08, 0x1F, 0x08, 0x20, 0x1F,
+	0x08, 0x1F, 0x08, 0x30, 0x2F, 0x20, 0x1F, 0x08, 0x1F, 0x08, 0x30, 0x04, 0x1F, 0x0B, 0x10, 0x1F,
+	0x08, 0x1F, 0x08, 0x40, 0x0B, 0x1F, 0x04, 0x00, 0x1F, 0x08, 0x1F, 0x08, 0x40, 0x04, 0x1F, 0x0B,
+	0x00, 0x1F, 0x08, 0x1F, 0x08, 0x50, 0x0B, 0x1F, 0x04, 0x1F, 0x08, 0x1F, 0x08, 0x60, 0x1F, 0x0B,
+	0x1F, 0x08, 0x1F, 0x08, 0x60, 0x08, 0x3F, 0x08, 0x1F, 0x08, 0x70, 0x0B, 0x2F, 0x08, 0x1F, 0x08,
+	0x70, 0x04, 0x2F, 0x28, 0x04, 0x80, 0x04, 0x18, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00,
+	/* 'O', 18 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xA0, 0x08, 0x0B, 0x3F, 0x0B, 0x08, 0x04, 0x60, 0x04, 0x9F, 0x08, 0x40, 0x04,
+	0x3F, 0x38, 0x3F, 0x0B, 0x20, 0x04, 0x2F, 0x08, 0x50, 0x04, 0x2F, 0x08, 0x10, 0x0B, 0x1F, 0x04,
+	0x70, 0x04, 0x2F, 0x00, 0x04, 0x1F, 0x08, 0x90, 0x08, 0x1F, 0x18, 0x1F, 0xB0, 0x1F, 0x08, 0x0B,
+	0x1F, 0xB0, 0x0B, 0x3F, 0x08, 0xB0, 0x08, 0x3F, 0x08, 0xB0, 0x08, 0x3F, 0x08, 0xB0, 0x08, 0x3F,
+	0x08, 0xB0, 0x08, 0x3F, 0x08, 0xB0, 0x08, 0x3F, 0x0B, 0xB0, 0x1F, 0x0B, 0x08, 0x1F, 0xB0, 0x1F,
+	0x18, 0x1F, 0x08, 0x90, 0x08, 0x1F, 0x04, 0x00, 0x2F, 0x04, 0x70, 0x04, 0x1F, 0x0B, 0x10, 0x08,
+	0x2F, 0x04, 0x50, 0x08, 0x2F, 0x04, 0x20, 0x0B, 0x3F, 0x38, 0x3F, 0x04, 0x40, 0x08, 0x9F, 0x04,
+	0x60, 0x04, 0x08, 0x0B, 0x3F, 0x0B, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00,
+	/* 'P', 13 pixels wide */
+	0xF0, 0xF0, 0x60, 0x04, 0x68, 0x40, 0x8F, 0x0B, 0x04, 0x10, 0x1F, 0x0B, 0x38, 0x0B, 0x2F, 0x04,
+	0x00, 0x1F, 0x08, 0x40, 0x04, 0x1F, 0x0B, 0x00, 0x1F, 0x08, 0x50, 0x08, 0x1F, 0x04, 0x1F, 0x08,
+	0x60, 0x1F, 0x08, 0x1F, 0x08, 0x60, 0x1F, 0x08, 0x1F, 0x08, 0x60, 0x1F, 0x08, 0x1F, 0x08, 0x50,
+	0x08, 0x1F, 0x04, 0x1F, 0x08, 0x50, 0x1F, 0x0B, 0x00, 0x1F, 0x08, 0x30, 0x08, 0x2F, 0x04, 0x00,
+	0x9F, 0x04, 0x10, 0x6F, 0x0B, 0x08, 0x30, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90,
+	0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90, 0x18, 0x04, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0x70,
+	/* 'Q', 21 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0x30, 0x08, 0x0B, 0x3F, 0x0B, 0x08, 0xA0, 0x04, 0x9F, 0x08, 0x70, 0x04,
+	0x3F, 0x38, 0x3F, 0x0B, 0x50, 0x04, 0x2F, 0x08, 0x50, 0x04, 0x2F, 0x04, 0x40, 0x0B, 0x1F, 0x04,
+	0x70, 0x04, 0x2F, 0x30, 0x04, 0x1F, 0x08, 0x90, 0x08, 0x1F, 0x04, 0x20, 0x08, 0x1F, 0xB0, 0x1F,
+	0x08, 0x20, 0x0B, 0x1F, 0xB0, 0x0B, 0x1F, 0x20, 0x1F, 0x08, 0xB0, 0x08, 0x1F, 0x20, 0x1F, 0x08,
+	0xB0, 0x08, 0x1F, 0x20, 0x1F, 0x08, 0xB0, 0x08, 0x1F, 0x20, 0x1F, 0x08, 0xB0, 0x08, 0x1F, 0x20,
+	0x1F, 0x08, 0xB0, 0x08, 0x1F, 0x20, 0x1F, 0x0B, 0xB0, 0x1F, 0x0B, 0x20, 0x08, 0x1F, 0xB0, 0x1F,
+	0x08, 0x20, 0x08, 0x1F, 0x08, 0x90, 0x08, 0x1F, 0x04, 0x30, 0x2F, 0x04, 0x70, 0x04, 0x1F, 0x0B,
+	0x40, 0x08, 0x2F, 0x04, 0x50, 0x08, 0x2F, 0x04, 0x50, 0x0B, 0x3F, 0x38, 0x3F, 0x0B, 0x70, 0x08,
+	0xBF, 0x0B, 0x04, 0x60, 0x04, 0x08, 0x0B, 0x3F, 0x08, 0x04, 0x00, 0x0B, 0x2F, 0x0B, 0x04, 0xF0,
+	0x08, 0x3F, 0x08, 0xF0, 0x00, 0x08, 0x1F, 0x08, 0xF0, 0x20, 0x08, 0x04, 0xF0, 0xF0, 0xF0, 0xE0,
+	/* 'R', 14 pixels wide */
+	0xF0, 0xF0, 0x90, 0x04, 0x68, 0x04, 0x40, 0x8F, 0x0B, 0x04, 0x20, 0x1F, 0x0B, 0x38, 0x0B, 0x2F,
+	0x04, 0x10, 0x1F, 0x08, 0x40, 0x04, 0x0B, 0x1F, 0x10, 0x1F, 0x08, 0x50, 0x04, 0x1F, 0x08, 0x00,
+	0x1F, 0x08, 0x60, 0x1F, 0x08, 0x00, 0x1F, 0x08, 0x60, 0x1F, 0x08, 0x00, 0x1F, 0x08, 0x50, 0x04,
+	0x1F, 0x04, 0x00, 0x1F, 0x08, 0x40, 0x04, 0x1F, 0x0B, 0x10, 0x1F, 0x0B, 0x38, 0x0B, 0x1F, 0x0B,
+	0x20, 0x7F, 0x0B, 0x04, 0x30, 0x1F, 0x0B, 0x28, 0x2F, 0x0B, 0x30, 0x1F, 0x08, 0x30, 0x0B, 0x1F,
+	0x04, 0x20, 0x1F, 0x08, 0x40, 0x2F, 0x20, 0x1F, 0x08, 0x40, 0x08, 0x1F, 0x08, 0x10, 0x1F, 0x08,
+	0x50, 0x1F, 0x0B, 0x10, 0x1F, 0x08, 0x50, 0x0B, 0x1F, 0x04, 0x00, 0x1F, 0x08, 0x50, 0x04, 0x1F,
+	0x08, 0x00, 0x1F, 0x08, 0x60, 0x2F, 0x00, 0x1F, 0x08, 0x60, 0x08, 0x1F, 0x28, 0x04, 0x70, 0x18,
+	0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x30,
+	/* 'S', 13 pixels wide */
+	0xF0, 0xF0, 0x90, 0x04, 0x0B, 0x3F, 0x18, 0x30, 0x0B, 0x7F, 0x08, 0x10, 0x0B, 0x1F, 0x08, 0x20,
+	0x04, 0x0B, 0x0F, 0x08, 0x00, 0x04, 0x1F, 0x08, 0x50, 0x14, 0x00, 0x08, 0x1F, 0x90, 0x08, 0x1F,
+	0x90, 0x08, 0x1F, 0x04, 0x90, 0x2F, 0x04, 0x80, 0x08, 0x2F, 0x0B, 0x04, 0x70, 0x08, 0x3F, 0x0B,
+	0x04, 0x60, 0x04, 0x0B, 0x3F, 0x0B, 0x04, 0x60, 0x04, 0x08, 0x3F, 0x04, 0x80, 0x0B, 0x2F, 0x90,
+	0x0B, 0x1F, 0x04, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x80, 0x04, 0x1F, 0x08, 0x0F, 0x08, 0x50,
+	0x04, 0x0B, 0x1F, 0x00, 0x3F, 0x28, 0x0B, 0x2F, 0x04, 0x00, 0x0B, 0x8F, 0x04, 0x20, 0x04, 0x08,
+	0x4F, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x10,
+	/* 'T', 15 pixels wide */
+	0xF0, 0xF0, 0xC0, 0xD8, 0x04, 0xDF, 0x08, 0xDF, 0x08, 0x50, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0,
+	0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F,
+	0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08,
+	0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x18, 0x04, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	/* 'U', 15 pixels wide */
+	0xF0, 0xF0, 0xC0, 0x18, 0x04, 0x80, 0x04, 0x18, 0x1F, 0x08, 0x80, 0x08, 0x3F, 0x08, 0x80, 0x08,
+	0x3F, 0x08, 0x80, 0x08, 0x3F, 0x08, 0x80, 0x08, 0x3F, 0x08, 0x80, 0x08, 0x3F, 0x08, 0x80, 0x08,
+	0x3F, 0x08, 0x80, 0x08, 0x3F, 0x08, 0x80, 0x08, 0x3F, 0x08, 0x80, 0x08, 0x3F, 0x08, 0x80, 0x08,
+	0x3F, 0x08, 0x80, 0x08, 0x3F, 0x08, 0x80, 0x08, 0x3F, 0x08, 0x80, 0x08, 0x3F, 0x08, 0x80, 0x08,
+	0x4F, 0x80, 0x1F, 0x0B, 0x08, 0x1F, 0x04, 0x60, 0x04, 0x1F, 0x08, 0x04, 0x2F, 0x04, 0x40, 0x04,
+	0x2F, 0x10, 0x08, 0x2F, 0x0B, 0x28, 0x0B, 0x2F, 0x04, 0x20, 0x08, 0x8F, 0x04, 0x40, 0x04, 0x08,
+	0x3F, 0x0B, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xD0,
+	/* 'V', 17 pixels wide */
+	0xF0, 0xF0, 0xF0, 0x20, 0x18, 0x04, 0xA0, 0x04, 0x18, 0x2F, 0xA0, 0x1F, 0x1B, 0x1F, 0x04, 0x80,
+	0x08, 0x1F, 0x08, 0x04, 0x1F, 0x08, 0x80, 0x0B, 0x1F, 0x10, 0x2F, 0x80, 0x1F, 0x0B, 0x10, 0x08,
+	0x1F, 0x04, 0x60, 0x08, 0x1F, 0x04, 0x10, 0x04, 0x1F, 0x08, 0x60, 0x0B, 0x1F, 0x30, 0x2F, 0x60,
+	0x1F, 0x08, 0x30, 0x08, 0x1F, 0x04, 0x40, 0x08, 0x1F, 0x04, 0x30, 0x04, 0x1F, 0x08, 0x40, 0x0B,
+	0x1F, 0x50, 0x0B, 0x1F, 0x40, 0x1F, 0x08, 0x50, 0x08, 0x1F, 0x08, 0x20, 0x08, 0x1F, 0x04, 0x60,
+	0x1F, 0x0B, 0x20, 0x0B, 0x0F, 0x0B, 0x70, 0x0B, 0x1F, 0x20, 0x1F, 0x08, 0x70, 0x08, 0x1F, 0x08,
+	0x00, 0x08, 0x1F, 0x90, 0x1F, 0x0B, 0x00, 0x0B, 0x0F, 0x0B, 0x90, 0x08, 0x1F, 0x00, 0x1F, 0x08,
+	0x90, 0x04, 0x4F, 0xB0, 0x3F, 0x08, 0xB0, 0x08, 0x2F, 0x04, 0xC0, 0x28, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xC0,
+	/* 'W', 27 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x18, 0x04, 0x80, 0x18, 0x04, 0x80, 0x18, 0x04, 0x2F, 0x70,
+	0x08, 0x1F, 0x0B, 0x70, 0x08, 0x1F, 0x18, 0x1F, 0x04, 0x60, 0x0B, 0x2F, 0x70, 0x08, 0x1F, 0x00,
+	0x08, 0x1F, 0x08, 0x60, 0x3F, 0x08, 0x60, 0x2F, 0x10, 0x1F, 0x0B, 0x50, 0x04, 0x3F, 0x08, 0x60,
+	0x1F, 0x08, 0x10, 0x0B, 0x1F, 0x50, 0x08, 0x1F, 0x0B, 0x1F, 0x50, 0x08, 0x1F, 0x04, 0x10, 0x08,
+	0x1F, 0x04, 0x40, 0x0B, 0x0F, 0x18, 0x1F, 0x04, 0x40, 0x08, 0x1F, 0x20, 0x04, 0x1F, 0x08, 0x40,
+	0x1F, 0x08, 0x00, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x30, 0x2F, 0x30, 0x04, 0x1F, 0x10, 0x1F, 0x0B,
+	0x30, 0x04, 0x1F, 0x08, 0x30, 0x08, 0x1F, 0x30, 0x08, 0x1F, 0x10, 0x08, 0x1F, 0x30, 0x08, 0x1F,
+	0x40, 0x04, 0x1F, 0x08, 0x20, 0x0B, 0x0F, 0x08, 0x10, 0x08, 0x1F, 0x04, 0x20, 0x0B, 0x0F, 0x0B,
+	0x50, 0x1F, 0x08, 0x20, 0x1F, 0x04, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x50, 0x0B, 0x1F, 0x10,
+	0x04, 0x1F, 0x30, 0x0B, 0x1F, 0x10, 0x04, 0x1F, 0x04, 0x50, 0x08, 0x1F, 0x04, 0x00, 0x08, 0x0F,
+	0x0B, 0x30, 0x08, 0x1F, 0x10, 0x08, 0x1F, 0x70, 0x1F, 0x08, 0x00, 0x1F, 0x08, 0x30, 0x04, 0x1F,
+	0x08, 0x00, 0x0B, 0x0F, 0x08, 0x70, 0x1F, 0x0B, 0x00, 0x1F, 0x04, 0x40, 0x1F, 0x0B, 0x00, 0x1F,
+	0x04, 0x70, 0x08, 0x1F, 0x08, 0x1F, 0x50, 0x08, 0x1F, 0x08, 0x1F, 0x80, 0x04, 0x1F, 0x0B, 0x0F,
+	0x0B, 0x50, 0x08, 0x1F, 0x0B, 0x0F, 0x0B, 0x90, 0x3F, 0x08, 0x60, 0x3F, 0x08, 0x90, 0x0B, 0x2F,
+	0x04, 0x60, 0x0B, 0x2F, 0xA0, 0x04, 0x28, 0x70, 0x04, 0x28, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0x70,
+	/* 'X', 15 pixels wide */
+	0xF0, 0xF0, 0xC0, 0x28, 0x80, 0x18, 0x04, 0x0B, 0x1F, 0x04, 0x60, 0x08, 0x1F, 0x14, 0x2F, 0x50,
+	0x04, 0x1F, 0x0B, 0x10, 0x08, 0x1F, 0x08, 0x40, 0x0B, 0x1F, 0x04, 0x20, 0x2F, 0x04, 0x20, 0x04,
+	0x1F, 0x08, 0x30, 0x04, 0x1F, 0x0B, 0x20, 0x2F, 0x50, 0x0B, 0x1F, 0x04, 0x00, 0x08, 0x1F, 0x04,
+	0x50, 0x04, 0x1F, 0x0B, 0x00, 0x1F, 0x0B, 0x70, 0x08, 0x4F, 0x04, 0x80, 0x3F, 0x08, 0x90, 0x08,
+	0x2F, 0x04, 0x80, 0x04, 0x3F, 0x0B, 0x80, 0x0B, 0x1F, 0x08, 0x1F, 0x08, 0x60, 0x04, 0x1F, 0x08,
+	0x00, 0x2F, 0x60, 0x2F, 0x10, 0x04, 0x1F, 0x0B, 0x40, 0x08, 0x1F, 0x04, 0x20, 0x0B, 0x1F, 0x04,
+	0x20, 0x04, 0x1F, 0x0B, 0x30, 0x04, 0x1F, 0x0B, 0x20, 0x0B, 0x1F, 0x04, 0x40, 0x0B, 0x1F, 0x04,
+	0x00, 0x04, 0x1F, 0x08, 0x60, 0x2F, 0x00, 0x2F, 0x70, 0x08, 0x1F, 0x28, 0x04, 0x80, 0x28, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0x90,
+	/* 'Y', 15 pixels wide */
+	0xF0, 0xF0, 0xC0, 0x28, 0x70, 0x04, 0x18, 0x04, 0x0B, 0x1F, 0x04, 0x60, 0x0B, 0x1F, 0x14, 0x1F,
+	0x0B, 0x50, 0x04, 0x1F, 0x0B, 0x10, 0x0B, 0x1F, 0x04, 0x40, 0x0B, 0x1F, 0x04, 0x10, 0x04, 0x1F,
+	0x0B, 0x30, 0x04, 0x1F, 0x0B, 0x30, 0x0B, 0x1F, 0x04, 0x20, 0x0B, 0x1F, 0x04, 0x30, 0x04, 0x1F,
+	0x0B, 0x20, 0x1F, 0x0B, 0x50, 0x0B, 0x1F, 0x04, 0x00, 0x08, 0x1F, 0x04, 0x50, 0x04, 0x1F, 0x08,
+	0x00, 0x1F, 0x0B, 0x70, 0x0B, 0x1F, 0x08, 0x1F, 0x04, 0x70, 0x04, 0x3F, 0x0B, 0x90, 0x08, 0x2F,
+	0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0,
+	0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x1F, 0x08, 0xB0, 0x18, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0,
+	/* 'Z', 14 pixels wide */
+	0xF0, 0xF0, 0x90, 0x04, 0xA8, 0x04, 0x00, 0xCF, 0x00, 0x0B, 0xBF, 0x90, 0x04, 0x1F, 0x08, 0x90,
+	0x1F, 0x0B, 0x90, 0x0B, 0x1F, 0x04, 0x80, 0x04, 0x1F, 0x08, 0x90, 0x1F, 0x0B, 0x90, 0x0B, 0x1F,
+	0x04, 0x80, 0x04, 0x1F, 0x08, 0x90, 0x1F, 0x0B, 0x90, 0x0B, 0x1F, 0x04, 0x80, 0x04, 0x1F, 0x08,
+	0x80, 0x04, 0x1F, 0x0B, 0x90, 0x0B, 0x1F, 0x04, 0x80, 0x08, 0x1F, 0x08, 0x80, 0x04, 0x1F, 0x0B,
+	0x90, 0x0B, 0x1F, 0x04, 0x90, 0xCF, 0x04, 0xCF, 0xD8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x40,
+	/* '[', 6 pixels wide */
+	0x50, 0x04, 0x38, 0x04, 0x4F, 0x08, 0x1F, 0x0B, 0x18, 0x04, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20,
+	0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F,
+	0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08,
+	0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20,
+	0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x0B, 0x18, 0x04,
+	0x4F, 0x08, 0x04, 0x38, 0x04, 0x50,
+	/* '\', 13 pixels wide */
+	0x18, 0x04, 0x90, 0x08, 0x1F, 0x90, 0x04, 0x1F, 0x04, 0x90, 0x1F, 0x0B, 0x90, 0x08, 0x1F, 0x90,
+	0x04, 0x1F, 0x08, 0x90, 0x1F, 0x0B, 0x90, 0x08, 0x1F, 0xA0, 0x1F, 0x08, 0x90, 0x0B, 0x1F, 0x90,
+	0x08, 0x1F, 0x04, 0x90, 0x1F, 0x08, 0x90, 0x0B, 0x1F, 0x90, 0x04, 0x1F, 0x04, 0x90, 0x1F, 0x08,
+	0x90, 0x08, 0x1F, 0x90, 0x04, 0x1F, 0x08, 0x90, 0x1F, 0x0B, 0x90, 0x08, 0x1F, 0x90, 0x04, 0x1F,
+	0x08, 0x90, 0x0B, 0x0F, 0x0B, 0x90, 0x08, 0x1F, 0x04, 0x90, 0x1F, 0x08, 0x90, 0x0B, 0x1F, 0x90,
+	0x08, 0x1F, 0x04, 0x90, 0x1F, 0x08, 0x90, 0x08, 0x1F, 0x90, 0x04, 0x1F, 0x08, 0xF0, 0x90,
+	/* ']', 6 pixels wide */
+	0x50, 0x48, 0x00, 0x4F, 0x38, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08,
+	0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20,
+	0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F,
+	0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08,
+	0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x38, 0x1F, 0x08, 0x4F, 0x58, 0x60,
+	/* '^', 13 pixels wide */
+	0xF0, 0xF0, 0xB0, 0x28, 0x80, 0x08, 0x2F, 0x04, 0x70, 0x3F, 0x0B, 0x60, 0x04, 0x1F, 0x08, 0x1F,
+	0x60, 0x0B, 0x0F, 0x0B, 0x00, 0x1F, 0x08, 0x40, 0x04, 0x1F, 0x04, 0x00, 0x08, 0x1F, 0x40, 0x0B,
+	0x1F, 0x10, 0x04, 0x1F, 0x08, 0x30, 0x1F, 0x08, 0x20, 0x0B, 0x1F, 0x20, 0x08, 0x1F, 0x30, 0x04,
+	0x1F, 0x08, 0x10, 0x1F, 0x0B, 0x40, 0x1F, 0x0B, 0x00, 0x08, 0x1F, 0x04, 0x40, 0x08, 0x1F, 0x04,
+	0x1F, 0x0B, 0x60, 0x1F, 0x08, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x20,
+	/* '_', 16 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xF8,
+	/* '`', 5 pixels wide */
+	0x40, 0x18, 0x04, 0x10, 0x0B, 0x1F, 0x20, 0x1F, 0x08, 0x10, 0x04, 0x1F, 0x04, 0x10, 0x08, 0x0F,
+	0x0B, 0x20, 0x18, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x20,
+	/* 'a', 12 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x04, 0x08, 0x0B, 0x3F, 0x08, 0x04, 0x10, 0x04, 0x8F,
+	0x04, 0x00, 0x08, 0x0F, 0x0B, 0x08, 0x20, 0x04, 0x2F, 0x00, 0x14, 0x50, 0x04, 0x1F, 0x08, 0x80,
+	0x1F, 0x08, 0x80, 0x1F, 0x08, 0x30, 0x04, 0x38, 0x1F, 0x08, 0x10, 0x08, 0x7F, 0x08, 0x00, 0x2F,
+	0x0B, 0x38, 0x1F, 0x18, 0x1F, 0x04, 0x40, 0x1F, 0x08, 0x1F, 0x08, 0x50, 0x1F, 0x08, 0x1F, 0x08,
+	0x50, 0x1F, 0x08, 0x1F, 0x0B, 0x40, 0x0B, 0x1F, 0x18, 0x1F, 0x08, 0x10, 0x04, 0x0B, 0x0F, 0x0B,
+	0x0F, 0x08, 0x00, 0x0B, 0x5F, 0x04, 0x08, 0x0F, 0x08, 0x10, 0x08, 0x2F, 0x0B, 0x04, 0x00, 0x04,
+	0x08, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0x70,
+	/* 'b', 13 pixels wide */
+	0xF0, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08,
+	0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x00, 0x04, 0x0B, 0x2F, 0x08, 0x20, 0x1F, 0x18, 0x6F, 0x04,
+	0x00, 0x3F, 0x0B, 0x04, 0x10, 0x08, 0x1F, 0x0B, 0x00, 0x2F, 0x0B, 0x40, 0x08, 0x1F, 0x04, 0x2F,
+	0x60, 0x1F, 0x08, 0x1F, 0x08, 0x60, 0x0B, 0x3F, 0x08, 0x60, 0x08, 0x3F, 0x08, 0x60, 0x08, 0x3F,
+	0x08, 0x60, 0x08, 0x3F, 0x08, 0x60, 0x08, 0x3F, 0x08, 0x60, 0x0B, 0x0F, 0x0B, 0x1F, 0x0B, 0x60,
+	0x1F, 0x08, 0x2F, 0x0B, 0x40, 0x0B, 0x1F, 0x04, 0x1F, 0x0B, 0x0F, 0x0B, 0x04, 0x10, 0x08, 0x1F,
+	0x0B, 0x00, 0x1F, 0x00, 0x0B, 0x5F, 0x0B, 0x10, 0x18, 0x10, 0x08, 0x2F, 0x0B, 0x08, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0x00,
+	/* 'c', 11 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xA0, 0x04, 0x0B, 0x2F, 0x0B, 0x08, 0x20, 0x0B, 0x6F, 0x0B, 0x00,
+	0x08, 0x1F, 0x08, 0x20, 0x08, 0x1F, 0x00, 0x1F, 0x08, 0x50, 0x18, 0x1F, 0x70, 0x0B, 0x0F, 0x0B,
+	0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x70, 0x1F, 0x0B, 0x70,
+	0x08, 0x1F, 0x70, 0x04, 0x1F, 0x08, 0x40, 0x04, 0x0F, 0x00, 0x0B, 0x1F, 0x08, 0x20, 0x08, 0x1F,
+	0x10, 0x0B, 0x6F, 0x04, 0x20, 0x08, 0x0B, 0x2F, 0x08, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0x20,
+	/* 'd', 13 pixels wide */
+	0xF0, 0xF0, 0x30, 0x08, 0x1F, 0x90, 0x08, 0x1F, 0x90, 0x08, 0x1F, 0x90, 0x08, 0x1F, 0x90, 0x08,
+	0x1F, 0x90, 0x08, 0x1F, 0x20, 0x08, 0x0B, 0x1F, 0x0B, 0x08, 0x00, 0x08, 0x1F, 0x10, 0x0B, 0x5F,
+	0x0B, 0x08, 0x1F, 0x00, 0x0B, 0x1F, 0x08, 0x10, 0x04, 0x0B, 0x3F, 0x04, 0x1F, 0x0B, 0x40, 0x0B,
+	0x2F, 0x08, 0x1F, 0x60, 0x0B, 0x1F, 0x0B, 0x0F, 0x0B, 0x60, 0x08, 0x3F, 0x08, 0x60, 0x08, 0x3F,
+	0x08, 0x60, 0x08, 0x3F, 0x08, 0x60, 0x08, 0x3F, 0x08, 0x60, 0x08, 0x3F, 0x0B, 0x60, 0x08, 0x1F,
+	0x08, 0x1F, 0x60, 0x2F, 0x04, 0x1F, 0x08, 0x40, 0x0B, 0x2F, 0x00, 0x0B, 0x1F, 0x08, 0x10, 0x04,
+	0x0B, 0x0F, 0x0B, 0x1F, 0x00, 0x04, 0x6F, 0x0B, 0x00, 0x1F, 0x20, 0x08, 0x2F, 0x0B, 0x04, 0x10,
+	0x18, 0xF0, 0xF0, 0xF0, 0xF0, 0xD0,
+	/* 'e', 13 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xA0, 0x04, 0x08, 0x3F, 0x08, 0x40, 0x08, 0x7F, 0x04, 0x10,
+	0x04, 0x1F, 0x08, 0x20, 0x08, 0x1F, 0x0B, 0x10, 0x1F, 0x08, 0x40, 0x04, 0x1F, 0x18, 0x1F, 0x60,
+	0x0B, 0x0F, 0x1B, 0x0F, 0x08, 0x60, 0x08, 0x3F, 0x0B, 0x68, 0x0B, 0xFF, 0x0F, 0x0B, 0x88, 0x04,
+	0x1F, 0x08, 0x90, 0x0B, 0x0F, 0x08, 0x90, 0x08, 0x1F, 0x90, 0x04, 0x1F, 0x0B, 0x90, 0x0B, 0x1F,
+	0x0B, 0x04, 0x20, 0x04, 0x08, 0x0F, 0x08, 0x10, 0x0B, 0x8F, 0x08, 0x20, 0x04, 0x08, 0x3F, 0x0B,
+	0x08, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+	/* 'f', 10 pixels wide */
+	0xE0, 0x28, 0x04, 0x30, 0x04, 0x4F, 0x08, 0x20, 0x0B, 0x1F, 0x18, 0x0B, 0x08, 0x10, 0x04, 0x1F,
+	0x08, 0x50, 0x08, 0x1F, 0x60, 0x08, 0x1F, 0x60, 0x08, 0x1F, 0x40, 0x18, 0x0B, 0x1F, 0x28, 0x04,
+	0x00, 0x7F, 0x08, 0x00, 0x18, 0x0B, 0x1F, 0x28, 0x04, 0x20, 0x08, 0x1F, 0x60, 0x08, 0x1F, 0x60,
+	0x08, 0x1F, 0x60, 0x08, 0x1F, 0x60, 0x08, 0x1F, 0x60, 0x08, 0x1F, 0x60, 0x08, 0x1F, 0x60, 0x08,
+	0x1F, 0x60, 0x08, 0x1F, 0x60, 0x08, 0x1F, 0x60, 0x08, 0x1F, 0x60, 0x08, 0x1F, 0x60, 0x04, 0x18,
+	0xF0, 0xF0, 0xF0, 0xF0, 0x00,
+	/* 'g', 14 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x20, 0x04, 0x0B, 0x2F, 0x48, 0x04, 0x10, 0x0B, 0x9F,
+	0x08, 0x00, 0x04, 0x1F, 0x0B, 0x20, 0x0B, 0x1F, 0x18, 0x04, 0x00, 0x0B, 0x1F, 0x40, 0x0B, 0x0F,
+	0x0B, 0x20, 0x1F, 0x08, 0x40, 0x08, 0x1F, 0x20, 0x1F, 0x08, 0x40, 0x08, 0x1F, 0x20, 0x1F, 0x08,
+	0x40, 0x0B, 0x1F, 0x20, 0x08, 0x1F, 0x04, 0x20, 0x04, 0x1F, 0x08, 0x30, 0x2F, 0x28, 0x2F, 0x30,
+	0x0B, 0x6F, 0x0B, 0x04, 0x20, 0x04, 0x1F, 0x10, 0x28, 0x04, 0x40, 0x08, 0x1F, 0xA0, 0x04, 0x2F,
+	0x48, 0x04, 0x40, 0x0B, 0x8F, 0x0B, 0x20, 0x0B, 0x1F, 0x48, 0x2F, 0x0B, 0x00, 0x08, 0x1F, 0x04,
+	0x50, 0x04, 0x1F, 0x08, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x1F, 0x08, 0x70, 0x1F, 0x08, 0x2F, 0x04,
+	0x50, 0x0B, 0x1F, 0x00, 0x08, 0x2F, 0x0B, 0x28, 0x0B, 0x2F, 0x04, 0x10, 0x04, 0x7F, 0x0B, 0x04,
+	0x40, 0x04, 0x48, 0x40,
+	/* 'h', 12 pixels wide */
+	0xF0, 0x70, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08,
+	0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x00, 0x04, 0x0B, 0x2F, 0x08, 0x10, 0x1F, 0x08, 0x0B, 0x5F,
+	0x0B, 0x00, 0x3F, 0x0B, 0x04, 0x00, 0x04, 0x0B, 0x1F, 0x04, 0x2F, 0x0B, 0x40, 0x1F, 0x0B, 0x1F,
+	0x0B, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F,
+	0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F,
+	0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x1F, 0x18, 0x04, 0x50, 0x04,
+	0x18, 0xF0, 0xF0, 0xF0, 0xF0, 0x70,
+	/* 'i', 3 pixels wide */
+	0x80, 0x0B, 0x0F, 0x0B, 0x2F, 0x0B, 0x0F, 0x0B, 0x50, 0x04, 0x28, 0x1F, 0x08, 0x1F, 0x08, 0x1F,
+	0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F,
+	0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x04, 0x18, 0xF0, 0x10,
+	/* 'j', 6 pixels wide */
+	0xF0, 0x40, 0x0B, 0x0F, 0x0B, 0x20, 0x2F, 0x20, 0x0B, 0x0F, 0x0B, 0xE0, 0x04, 0x18, 0x20, 0x08,
+	0x1F, 0x20, 0x08, 0x1F, 0x20, 0x08, 0x1F, 0x20, 0x08, 0x1F, 0x20, 0x08, 0x1F, 0x20, 0x08, 0x1F,
+	0x20, 0x08, 0x1F, 0x20, 0x08, 0x1F, 0x20, 0x08, 0x1F, 0x20, 0x08, 0x1F, 0x20, 0x08, 0x1F, 0x20,
+	0x08, 0x1F, 0x20, 0x08, 0x1F, 0x20, 0x08, 0x1F, 0x20, 0x08, 0x1F, 0x20, 0x08, 0x1F, 0x20, 0x08,
+	0x1F, 0x20, 0x1F, 0x0B, 0x18, 0x0B, 0x1F, 0x04, 0x3F, 0x0B, 0x00, 0x04, 0x18, 0x04, 0x10,
+	/* 'k', 12 pixels wide */
+	0xF0, 0x70, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08,
+	0x80, 0x1F, 0x08, 0x80, 0x1F, 0x08, 0x40, 0x28, 0x00, 0x1F, 0x08, 0x30, 0x0B, 0x1F, 0x0B, 0x00,
+	0x1F, 0x08, 0x20, 0x04, 0x1F, 0x0B, 0x10, 0x1F, 0x08, 0x10, 0x04, 0x1F, 0x0B, 0x20, 0x1F, 0x08,
+	0x00, 0x04, 0x1F, 0x0B, 0x30, 0x1F, 0x08, 0x04, 0x1F, 0x08, 0x40, 0x1F, 0x0B, 0x1F, 0x04, 0x50,
+	0x1F, 0x0B, 0x1F, 0x08, 0x50, 0x1F, 0x18, 0x1F, 0x04, 0x40, 0x1F, 0x08, 0x00, 0x0B, 0x1F, 0x04,
+	0x30, 0x1F, 0x08, 0x10, 0x2F, 0x30, 0x1F, 0x08, 0x10, 0x04, 0x1F, 0x0B, 0x20, 0x1F, 0x08, 0x20,
+	0x08, 0x1F, 0x0B, 0x10, 0x1F, 0x08, 0x30, 0x0B, 0x1F, 0x08, 0x00, 0x1F, 0x08, 0x40, 0x0B, 0x1F,
+	0x04, 0x18, 0x04, 0x40, 0x04, 0x18, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0x70,
+	/* 'l', 3 pixels wide */
+	0x50, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F,
+	0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F,
+	0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x28, 0x04, 0xF0, 0x10,
+	/* 'm', 21 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x18, 0x10, 0x04, 0x0B, 0x1F,
+	0x0B, 0x08, 0x30, 0x08, 0x2F, 0x08, 0x10, 0x1F, 0x08, 0x04, 0x5F, 0x0B, 0x00, 0x04, 0x0B, 0x4F,
+	0x0B, 0x00, 0x1F, 0x0B, 0x0F, 0x0B, 0x04, 0x10, 0x0B, 0x1F, 0x04, 0x1F, 0x04, 0x10, 0x0B, 0x1F,
+	0x08, 0x2F, 0x0B, 0x40, 0x3F, 0x04, 0x30, 0x1F, 0x0B, 0x1F, 0x0B, 0x50, 0x08, 0x1F, 0x04, 0x40,
+	0x08, 0x3F, 0x08, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x3F,
+	0x08, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x3F, 0x08, 0x50,
+	0x08, 0x1F, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x1F,
+	0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x1F, 0x50, 0x08,
+	0x3F, 0x08, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x1F, 0x18, 0x04, 0x50, 0x04, 0x18, 0x50, 0x04, 0x18,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xD0,
+	/* 'n', 12 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x18, 0x10, 0x04, 0x0B, 0x2F, 0x08, 0x10, 0x1F, 0x18, 0x5F,
+	0x0B, 0x00, 0x1F, 0x0B, 0x0F, 0x0B, 0x04, 0x00, 0x04, 0x0B, 0x1F, 0x04, 0x2F, 0x0B, 0x40, 0x1F,
+	0x0B, 0x1F, 0x0B, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50,
+	0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50,
+	0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x1F, 0x18, 0x04,
+	0x50, 0x04, 0x18, 0xF0, 0xF0, 0xF0, 0xF0, 0x70,
+	/* 'o', 14 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x20, 0x04, 0x08, 0x3F, 0x0B, 0x04, 0x40, 0x04, 0x7F,
+	0x0B, 0x20, 0x04, 0x1F, 0x0B, 0x04, 0x10, 0x04, 0x0B, 0x1F, 0x0B, 0x10, 0x1F, 0x0B, 0x50, 0x0B,
+	0x1F, 0x04, 0x08, 0x1F, 0x04, 0x60, 0x1F, 0x08, 0x0B, 0x0F, 0x0B, 0x70, 0x0B, 0x0F, 0x0B, 0x1F,
+	0x08, 0x70, 0x08, 0x3F, 0x08, 0x70, 0x08, 0x3F, 0x08, 0x70, 0x08, 0x3F, 0x08, 0x70, 0x08, 0x1F,
+	0x0B, 0x0F, 0x0B, 0x70, 0x0B, 0x0F, 0x0B, 0x08, 0x1F, 0x70, 0x1F, 0x08, 0x04, 0x1F, 0x0B, 0x50,
+	0x0B, 0x1F, 0x10, 0x0B, 0x1F, 0x0B, 0x04, 0x10, 0x04, 0x0B, 0x1F, 0x04, 0x20, 0x0B, 0x7F, 0x04,
+	0x40, 0x04, 0x0B, 0x3F, 0x08, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60,
+	/* 'p', 13 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x18, 0x10, 0x04, 0x0B, 0x2F, 0x08, 0x20, 0x1F, 0x00,
+	0x08, 0x6F, 0x04, 0x00, 0x1F, 0x0B, 0x0F, 0x0B, 0x04, 0x10, 0x08, 0x1F, 0x0B, 0x00, 0x2F, 0x0B,
+	0x40, 0x08, 0x1F, 0x04, 0x2F, 0x60, 0x1F, 0x08, 0x1F, 0x08, 0x60, 0x0B, 0x3F, 0x08, 0x60, 0x08,
+	0x3F, 0x08, 0x60, 0x08, 0x3F, 0x08, 0x60, 0x08, 0x3F, 0x08, 0x60, 0x08, 0x3F, 0x08, 0x60, 0x0B,
+	0x0F, 0x0B, 0x1F, 0x0B, 0x60, 0x1F, 0x08, 0x2F, 0x0B, 0x40, 0x0B, 0x1F, 0x04, 0x3F, 0x0B, 0x04,
+	0x10, 0x0B, 0x1F, 0x0B, 0x00, 0x1F, 0x08, 0x0B, 0x5F, 0x0B, 0x10, 0x1F, 0x08, 0x00, 0x08, 0x2F,
+	0x0B, 0x08, 0x20, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90, 0x1F, 0x08, 0x90, 0x1F,
+	0x08, 0x90, 0x18, 0x04, 0x90,
+	/* 'q', 13 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xA0, 0x08, 0x0B, 0x1F, 0x0B, 0x08, 0x10, 0x18, 0x10, 0x0B,
+	0x5F, 0x0B, 0x00, 0x1F, 0x00, 0x0B, 0x1F, 0x08, 0x10, 0x04, 0x0B, 0x0F, 0x0B, 0x1F, 0x04, 0x1F,
+	0x0B, 0x40, 0x0B, 0x2F, 0x08, 0x1F, 0x60, 0x0B, 0x1F, 0x0B, 0x0F, 0x0B, 0x60, 0x08, 0x3F, 0x08,
+	0x60, 0x08, 0x3F, 0x08, 0x60, 0x08, 0x3F, 0x08, 0x60, 0x08, 0x3F, 0x08, 0x60, 0x08, 0x3F, 0x0B,
+	0x60, 0x08, 0x1F, 0x08, 0x1F, 0x60, 0x2F, 0x04, 0x1F, 0x08, 0x40, 0x0B, 0x2F, 0x00, 0x0B, 0x1F,
+	0x08, 0x10, 0x04, 0x0B, 0x3F, 0x00, 0x04, 0x6F, 0x18, 0x1F, 0x20, 0x08, 0x2F, 0x0B, 0x04, 0x00,
+	0x08, 0x1F, 0x90, 0x08, 0x1F, 0x90, 0x08, 0x1F, 0x90, 0x08, 0x1F, 0x90, 0x08, 0x1F, 0x90, 0x08,
+	0x1F, 0x90, 0x04, 0x18,
+	/* 'r', 8 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0x18, 0x10, 0x08, 0x1F, 0x0B, 0x1F, 0x08, 0x0B, 0x5F, 0x0B, 0x1F, 0x18,
+	0x4F, 0x04, 0x20, 0x2F, 0x04, 0x30, 0x1F, 0x0B, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F,
+	0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08, 0x40, 0x1F, 0x08,
+	0x40, 0x1F, 0x08, 0x40, 0x18, 0x04, 0xF0, 0xF0, 0xF0, 0x40,
+	/* 's', 10 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x10, 0x04, 0x0B, 0x2F, 0x0B, 0x08, 0x10, 0x04, 0x6F, 0x08, 0x00,
+	0x1F, 0x0B, 0x20, 0x04, 0x0B, 0x18, 0x1F, 0x60, 0x08, 0x1F, 0x60, 0x08, 0x1F, 0x0B, 0x60, 0x2F,
+	0x0B, 0x04, 0x40, 0x04, 0x0B, 0x3F, 0x08, 0x40, 0x08, 0x3F, 0x0B, 0x50, 0x04, 0x0B, 0x1F, 0x08,
+	0x60, 0x0B, 0x1F, 0x60, 0x08, 0x1F, 0x08, 0x50, 0x0B, 0x3F, 0x08, 0x20, 0x08, 0x1F, 0x08, 0x0B,
+	0x6F, 0x0B, 0x10, 0x08, 0x0B, 0x2F, 0x0B, 0x08, 0xF0, 0xF0, 0xF0, 0xD0,
+	/* 't', 9 pixels wide */
+	0xF0, 0xF0, 0x50, 0x04, 0x18, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x1F, 0x30, 0x18,
+	0x0B, 0x1F, 0x38, 0x8F, 0x18, 0x0B, 0x1F, 0x38, 0x10, 0x08, 0x1F, 0x50, 0x08, 0x1F, 0x50, 0x08,
+	0x1F, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x1F, 0x50, 0x08, 0x1F,
+	0x50, 0x08, 0x1F, 0x50, 0x08, 0x1F, 0x50, 0x04, 0x1F, 0x0B, 0x10, 0x08, 0x20, 0x0B, 0x4F, 0x30,
+	0x08, 0x2F, 0x08, 0xF0, 0xF0, 0xF0, 0x50,
+	/* 'u', 12 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x18, 0x04, 0x50, 0x04, 0x18, 0x1F, 0x08, 0x50, 0x08, 0x3F,
+	0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F,
+	0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x08, 0x3F,
+	0x08, 0x50, 0x08, 0x3F, 0x08, 0x50, 0x2F, 0x0B, 0x1F, 0x40, 0x0B, 0x2F, 0x04, 0x1F, 0x0B, 0x04,
+	0x00, 0x04, 0x0B, 0x0F, 0x0B, 0x1F, 0x00, 0x0B, 0x5F, 0x18, 0x1F, 0x10, 0x08, 0x2F, 0x0B, 0x04,
+	0x10, 0x18, 0xF0, 0xF0, 0xF0, 0xF0, 0x70,
+	/* 'v', 14 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x04, 0x18, 0x70, 0x18, 0x04, 0x0B, 0x1F, 0x60, 0x04,
+	0x1F, 0x08, 0x04, 0x1F, 0x08, 0x50, 0x08, 0x1F, 0x10, 0x1F, 0x0B, 0x50, 0x1F, 0x0B, 0x10, 0x08,
+	0x1F, 0x04, 0x30, 0x04, 0x1F, 0x08, 0x10, 0x04, 0x1F, 0x08, 0x30, 0x08, 0x1F, 0x30, 0x2F, 0x30,
+	0x1F, 0x0B, 0x30, 0x08, 0x1F, 0x04, 0x10, 0x04, 0x1F, 0x08, 0x30, 0x04, 0x1F, 0x08, 0x10, 0x08,
+	0x1F, 0x50, 0x0B, 0x1F, 0x10, 0x1F, 0x08, 0x50, 0x08, 0x1F, 0x14, 0x1F, 0x04, 0x60, 0x1F, 0x18,
+	0x1F, 0x70, 0x0B, 0x3F, 0x08, 0x70, 0x08, 0x3F, 0x04, 0x80, 0x2F, 0x0B, 0x90, 0x04, 0x18, 0x04,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x80,
+	/* 'w', 21 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x18, 0x04, 0x50, 0x04, 0x18,
+	0x50, 0x04, 0x18, 0x2F, 0x50, 0x2F, 0x50, 0x08, 0x1F, 0x08, 0x1F, 0x50, 0x2F, 0x04, 0x40, 0x1F,
+	0x0B, 0x04, 0x1F, 0x08, 0x30, 0x08, 0x2F, 0x08, 0x40, 0x1F, 0x08, 0x00, 0x1F, 0x0B, 0x30, 0x0B,
+	0x3F, 0x30, 0x08, 0x1F, 0x10, 0x08, 0x1F, 0x30, 0x1F, 0x08, 0x1F, 0x04, 0x20, 0x0B, 0x1F, 0x10,
+	0x08, 0x1F, 0x08, 0x10, 0x04, 0x1F, 0x00, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x20, 0x1F, 0x08, 0x10,
+	0x08, 0x0F, 0x0B, 0x00, 0x0B, 0x0F, 0x0B, 0x10, 0x04, 0x1F, 0x04, 0x20, 0x0B, 0x1F, 0x10, 0x0B,
+	0x0F, 0x08, 0x00, 0x08, 0x1F, 0x10, 0x08, 0x1F, 0x30, 0x08, 0x1F, 0x04, 0x00, 0x1F, 0x20, 0x1F,
+	0x08, 0x00, 0x1F, 0x08, 0x40, 0x1F, 0x18, 0x1F, 0x20, 0x0B, 0x0F, 0x08, 0x04, 0x1F, 0x04, 0x40,
+	0x0B, 0x1F, 0x08, 0x0F, 0x08, 0x20, 0x08, 0x1F, 0x08, 0x1F, 0x50, 0x08, 0x3F, 0x08, 0x20, 0x04,
+	0x1F, 0x0B, 0x0F, 0x0B, 0x50, 0x04, 0x3F, 0x40, 0x3F, 0x08, 0x60, 0x3F, 0x40, 0x08, 0x2F, 0x70,
+	0x04, 0x18, 0x04, 0x40, 0x04, 0x18, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x10,
+	/* 'x', 13 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x28, 0x50, 0x04, 0x18, 0x00, 0x0B, 0x1F, 0x04, 0x40,
+	0x1F, 0x0B, 0x10, 0x2F, 0x30, 0x08, 0x1F, 0x04, 0x10, 0x04, 0x1F, 0x08, 0x10, 0x04, 0x1F, 0x08,
+	0x30, 0x0B, 0x1F, 0x04, 0x00, 0x0B, 0x1F, 0x40, 0x04, 0x1F, 0x0B, 0x08, 0x1F, 0x04, 0x50, 0x08,
+	0x3F, 0x0B, 0x70, 0x0B, 0x2F, 0x80, 0x3F, 0x04, 0x60, 0x0B, 0x4F, 0x50, 0x04, 0x1F, 0x14, 0x1F,
+	0x08, 0x40, 0x1F, 0x0B, 0x10, 0x0B, 0x1F, 0x04, 0x20, 0x0B, 0x1F, 0x04, 0x10, 0x04, 0x1F, 0x0B,
+	0x10, 0x04, 0x1F, 0x08, 0x30, 0x08, 0x1F, 0x08, 0x00, 0x0B, 0x1F, 0x50, 0x2F, 0x00, 0x18, 0x04,
+	0x50, 0x04, 0x18, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xD0,
+	/* 'y', 14 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x18, 0x04, 0x70, 0x18, 0x04, 0x2F, 0x60, 0x08, 0x1F,
+	0x04, 0x08, 0x1F, 0x04, 0x50, 0x0B, 0x1F, 0x10, 0x1F, 0x0B, 0x50, 0x1F, 0x08, 0x10, 0x0B, 0x1F,
+	0x40, 0x08, 0x1F, 0x04, 0x10, 0x08, 0x1F, 0x08, 0x30, 0x0B, 0x1F, 0x30, 0x1F, 0x0B, 0x30, 0x1F,
+	0x08, 0x30, 0x08, 0x1F, 0x20, 0x08, 0x1F, 0x04, 0x30, 0x04, 0x1F, 0x08, 0x10, 0x0B, 0x0F, 0x0B,
+	0x50, 0x1F, 0x0B, 0x10, 0x1F, 0x08, 0x50, 0x08, 0x1F, 0x04, 0x08, 0x1F, 0x70, 0x1F, 0x08, 0x0B,
+	0x0F, 0x0B, 0x70, 0x0B, 0x3F, 0x08, 0x70, 0x08, 0x3F, 0x90, 0x2F, 0x08, 0x90, 0x08, 0x1F, 0x04,
+	0x90, 0x0B, 0x1F, 0xA0, 0x1F, 0x08, 0x90, 0x08, 0x1F, 0x04, 0x90, 0x2F, 0x90, 0x04, 0x1F, 0x08,
+	0x90, 0x04, 0x18, 0x70,
+	/* 'z', 10 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x04, 0x78, 0x04, 0x8F, 0x08, 0x04, 0x48, 0x0B, 0x1F, 0x08, 0x50,
+	0x0B, 0x1F, 0x50, 0x08, 0x1F, 0x04, 0x50, 0x1F, 0x0B, 0x50, 0x0B, 0x1F, 0x50, 0x04, 0x1F, 0x08,
+	0x50, 0x0B, 0x0F, 0x0B, 0x50, 0x08, 0x1F, 0x04, 0x40, 0x04, 0x1F, 0x0B, 0x50, 0x0B, 0x1F, 0x50,
+	0x04, 0x1F, 0x08, 0x50, 0x2F, 0x68, 0x9F, 0x98, 0xF0, 0xF0, 0xF0, 0xB0,
+	/* '{', 8 pixels wide */
+	0xB0, 0x04, 0x18, 0x04, 0x20, 0x04, 0x2F, 0x08, 0x20, 0x1F, 0x0B, 0x08, 0x04, 0x10, 0x04, 0x1F,
+	0x04, 0x30, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F,
+	0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x1F, 0x08, 0x20, 0x08, 0x1F, 0x0B, 0x30, 0x2F, 0x40,
+	0x08, 0x1F, 0x0B, 0x50, 0x1F, 0x08, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40,
+	0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x04,
+	0x1F, 0x04, 0x40, 0x1F, 0x0B, 0x08, 0x04, 0x20, 0x04, 0x2F, 0x08, 0x30, 0x04, 0x18, 0x04, 0x70,
+	/* '|', 3 pixels wide */
+	0x20, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F,
+	0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F,
+	0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F,
+	0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x28, 0x04,
+	/* '}', 8 pixels wide */
+	0x70, 0x28, 0x40, 0x2F, 0x0B, 0x30, 0x18, 0x1F, 0x08, 0x40, 0x0B, 0x0F, 0x08, 0x40, 0x08, 0x1F,
+	0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40,
+	0x08, 0x1F, 0x40, 0x04, 0x1F, 0x04, 0x40, 0x0B, 0x1F, 0x08, 0x04, 0x30, 0x08, 0x1F, 0x08, 0x20,
+	0x04, 0x1F, 0x0B, 0x04, 0x20, 0x1F, 0x08, 0x30, 0x04, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F,
+	0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x1F, 0x40, 0x08, 0x0F, 0x0B,
+	0x40, 0x0B, 0x0F, 0x08, 0x20, 0x18, 0x1F, 0x08, 0x20, 0x2F, 0x0B, 0x30, 0x28, 0xC0,
+	/* '~', 14 pixels wide */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x40, 0x04, 0x0B, 0x1F, 0x0B, 0x04, 0x40, 0x18, 0x04, 0x5F, 0x04,
+	0x30, 0x1F, 0x0B, 0x0F, 0x0B, 0x10, 0x0B, 0x1F, 0x04, 0x10, 0x04, 0x3F, 0x30, 0x0B, 0x1F, 0x18,
+	0x1F, 0x08, 0x1F, 0x40, 0x0B, 0x3F, 0x0B, 0x80, 0x04, 0x18, 0x04, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xD0,
+};
+
+static const font_pack_glyph_t font_pack_30_aa_glyphs[] = {
+	{1, 0, 0},
+	{4, 1, 2},
+	{9, 0, 62},
+	{15, 0, 123},
+	{13, 0, 244},
+	{20, 0, 364},
+	{19, 0, 577},
+	{3, 0, 756},
+	{6, 0, 781},
+	{6, 1, 870},
+	{11, 0, 960},
+	{14, 0, 1050},
+	{6, 0, 1100},
+	{8, 0, 1138},
+	{4, 0, 1157},
+	{12, 0, 1172},
+	{14, 0, 1268},
+	{12, 0, 1392},
+	{13, 0, 1475},
+	{13, 0, 1564},
+	{15, 0, 1663},
+	{13, 0, 1774},
+	{14, 0, 1859},
+	{13, 0, 1979},
+	{14, 0, 2053},
+	{14, 0, 2198},
+	{4, 0, 2319},
+	{5, 0, 2344},
+	{14, 0, 2385},
+	{13, 0, 2471},
+	{14, 0, 2498},
+	{11, 0, 2570},
+	{23, 0, 2655},
+	{18, 0, 2904},
+	{14, 0, 3033},
+	{15, 0, 3160},
+	{16, 0, 3265},
+	{12, 0, 3386},
+	{11, 0, 3455},
+	{17, 0, 3524},
+	{15, 0, 3655},
+	{3, 0, 3762},
+	{8, 0, 3806},
+	{13, 0, 3877},
+	{11, 0, 4012},
+	{22, 0, 4081},
+	{16, 0, 4276},
+	{18, 0, 4435},
+	{13, 0, 4562},
+	{21, 0, 4662},
+	{14, 0, 4822},
+	{13, 0, 4957},
+	{15, 0, 5061},
+	{15, 0, 5130},
+	{17, 0, 5235},
+	{27, 0, 5366},
+	{15, 0, 5611},
+	{15, 0, 5744},
+	{14, 0, 5857},
+	{6, 0, 5936},
+	{13, 0, 6022},
+	{6, 0, 6117},
+	{13, 0, 6195},
+	{16, 0, 6277},
+	{5, 0, 6307},
+	{12, 0, 6334},
+	{13, 0, 6437},
+	{11, 0, 6553},
+	{13, 0, 6632},
+	{13, 0, 6750},
+	{10, 0, 6837},
+	{14, 0, 6922},
+	{12, 0, 7054},
+	{3, 0, 7156},
+	{6, 0, 7198},
+	{12, 0, 7277},
+	{3, 0, 7401},
+	{21, 0, 7447},
+	{12, 0, 7599},
+	{14, 0, 7687},
+	{13, 0, 7795},
+	{13, 0, 7912},
+	{8, 0, 8028},
+	{10, 0, 8086},
+	{9, 0, 8162},
+	{12, 0, 8233},
+	{14, 0, 8320},
+	{21, 0, 8422},
+	{13, 0, 8598},
+	{14, 0, 8703},
+	{10, 0, 8819},
+	{8, 0, 8879},
+	{3, 0, 8975},
+	{8, 0, 9033},
+	{14, 0, 9127},
+};
+
+static const font_pack_range_t font_pack_30_aa_ranges[] = {
+	{32, 95, 0},
+};
+
+static const uint8_t font_pack_59_digits_data[] = {
+	/* '-', 15 pixels wide */
+	0xFE, 0xFE, 0xFE, 0x64, 0x77, 0xFE, 0xFE, 0xFE, 0x0A,
+	/* '.', 7 pixels wide */
+	0xFE, 0xFE, 0x30, 0x09, 0x00, 0x0B, 0x00, 0x35, 0x02, 0x09, 0xA8,
+	/* '0', 28 pixels wide */
+	0xFE, 0x62, 0x11, 0x20, 0x19, 0x18, 0x21, 0x12, 0x25, 0x0E, 0x0D, 0x0A, 0x0D, 0x0C, 0x0B, 0x12,
+	0x0B, 0x0A, 0x09, 0x16, 0x0B, 0x06, 0x09, 0x1A, 0x09, 0x06, 0x09, 0x1A, 0x09, 0x06, 0x07, 0x1E,
+	0x09, 0x02, 0x09, 0x1E, 0x09, 0x02, 0x09, 0x1E, 0x09, 0x02, 0x09, 0x1E, 0x09, 0x02, 0x07, 0x22,
+	0x13, 0x22, 0x13, 0x22, 0x13, 0x22, 0x13, 0x22, 0x13, 0x22, 0x13, 0x22, 0x13, 0x22, 0x13, 0x22,
+	0x13, 0x22, 0x13, 0x22, 0x13, 0x22, 0x13, 0x22, 0x13, 0x22, 0x13, 0x22, 0x13, 0x22, 0x07, 0x02,
+	0x09, 0x1E, 0x09, 0x02, 0x09, 0x1E, 0x09, 0x02, 0x09, 0x1E, 0x09, 0x02, 0x09, 0x1E, 0x07, 0x06,
+	0x09, 0x1A, 0x09, 0x06, 0x09, 0x1A, 0x09, 0x06, 0x0B, 0x16, 0x09, 0x0A, 0x0B, 0x12, 0x0B, 0x0C,
+	0x0D, 0x0A, 0x0D, 0x0E, 0x25, 0x12, 0x21, 0x18, 0x19, 0x20, 0x11, 0xFE, 0xFE, 0x7A,
+	/* '1', 23 pixels wide */
+	0xFE, 0x54, 0x09, 0x20, 0x0B, 0x1C, 0x0F, 0x1A, 0x11, 0x16, 0x15, 0x14, 0x17, 0x10, 0x0F, 0x00,
+	0x09, 0x0E, 0x0F, 0x02, 0x09, 0x0E, 0x0B, 0x06, 0x09, 0x0E, 0x07, 0x0A, 0x09, 0x0E, 0x05, 0x0C,
+	0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22,
+	0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22,
+	0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22, 0x09, 0x22,
+	0x09, 0x22, 0x09, 0x0E, 0xB7, 0xFE, 0xFE, 0x26,
+	/* '2', 25 pixels wide */
+	0xFE, 0x3A, 0x0F, 0x1A, 0x19, 0x12, 0x21, 0x0C, 0x25, 0x08, 0x27, 0x08, 0x0D, 0x0A, 0x0F, 0x06,
+	0x07, 0x14, 0x0B, 0x06, 0x03, 0x1A, 0x0B, 0x24, 0x0B, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26,
+	0x09, 0x26, 0x09, 0x26, 0x09, 0x24, 0x09, 0x26, 0x09, 0x24, 0x0B, 0x24, 0x09, 0x24, 0x0B, 0x24,
+	0x09, 0x24, 0x09, 0x24, 0x0B, 0x22, 0x0B, 0x22, 0x0B, 0x22, 0x0B, 0x22, 0x0D, 0x22, 0x0B, 0x22,
+	0x0B, 0x22, 0x0B, 0x22, 0x0B, 0x22, 0x0B, 0x22, 0x0B, 0x22, 0x0B, 0x22, 0x0B, 0x22, 0x0B, 0x22,
+	0xF9, 0xFE, 0xFE, 0x56,
+	/* '3', 25 pixels wide */
+	0xFE, 0x3A, 0x0F, 0x1A, 0x19, 0x12, 0x21, 0x0C, 0x25, 0x08, 0x0D, 0x0A, 0x0F, 0x06, 0x09, 0x12,
+	0x0B, 0x06, 0x05, 0x18, 0x09, 0x06, 0x03, 0x1A, 0x0B, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26,
+	0x09, 0x26, 0x09, 0x26, 0x09, 0x24, 0x09, 0x26, 0x09, 0x24, 0x09, 0x24, 0x0B, 0x1E, 0x0F, 0x10,
+	0x1B, 0x14, 0x17, 0x18, 0x1D, 0x12, 0x21, 0x22, 0x0F, 0x24, 0x0D, 0x26, 0x0B, 0x26, 0x09, 0x26,
+	0x0B, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x26, 0x09, 0x24, 0x0B, 0x24, 0x09, 0x00,
+	0x03, 0x1E, 0x0B, 0x00, 0x07, 0x18, 0x0B, 0x02, 0x0D, 0x0E, 0x0F, 0x02, 0x2B, 0x06, 0x25, 0x0E,
+	0x1F, 0x16, 0x13, 0xFE, 0xFE, 0x36,
+	/* '4', 29 pixels wide */
+	0xFE, 0xB4, 0x0D, 0x28, 0x0F, 0x26, 0x11, 0x26, 0x11, 0x24, 0x13, 0x24, 0x07, 0x00, 0x09, 0x22,
+	0x09, 0x00, 0x09, 0x20, 0x09, 0x02, 0x09, 0x20, 0x09, 0x02, 0x09, 0x1E, 0x09, 0x04, 0x09, 0x1E,
+	0x09, 0x04, 0x09, 0x1C, 0x09, 0x06, 0x09, 0x1A, 0x09, 0x08, 0x09, 0x1A, 0x09, 0x08, 0x09, 0x18,
+	0x09, 0x0A, 0x09, 0x18, 0x09, 0x0A, 0x09, 0x16, 0x09, 0x0C, 0x09, 0x16, 0x07, 0x0E, 0x09, 0x14,
+	0x09, 0x0E, 0x09, 0x12, 0x09, 0x10, 0x09, 0x12, 0x09, 0x10, 0x09, 0x10, 0x09, 0x12, 0x09, 0x10,
+	0x09, 0x12, 0x09, 0x0E, 0x09, 0x14, 0x09, 0x0C, 0x09, 0x16, 0x09, 0x0C, 0x09, 0x16, 0x09, 0x0A,
+	0x09, 0x18, 0x09, 0x0A, 0x37, 0x00, 0xAB, 0x24, 0x09, 0x2E, 0x09, 0x2E, 0x09, 0x2E, 0x09, 0x2E,
+	0x09, 0x2E, 0x09, 0x2E, 0x09, 0x2E, 0x09, 0x2E, 0x09, 0xFE, 0xFE, 0xC2,
+	/* '5', 26 pixels wide */
+	0xFE, 0x6E, 0x29, 0x08, 0x29, 0x08, 0x29, 0x08, 0x29, 0x08, 0x29, 0x08, 0x09, 0x28, 0x09, 0x28,
+	0x09, 0x28, 0x09, 0x28, 0x09, 0x28, 0x09, 0x28, 0x09, 0x28, 0x09, 0x28, 0x09, 0x28, 0x09, 0x28,
+	0x09, 0x28, 0x1D, 0x14, 0x23, 0x0E, 0x27, 0x0A, 0x29, 0x22, 0x11, 0x26, 0x0B, 0x28, 0x0B, 0x28,
+	0x09, 0x28, 0x0B, 0x28, 0x09, 0x28, 0x09, 0x28, 0x09, 0x28, 0x09, 0x28, 0x09, 0x28, 0x09, 0x26,
+	0x0B, 0x26, 0x09, 0x26, 0x0B, 0x00, 0x03, 0x20, 0x09, 0x02, 0x07, 0x18, 0x0D, 0x02, 0x0D, 0x0E,
+	0x0F, 0x04, 0x2B, 0x06, 0x27, 0x0E, 0x1F, 0x1A, 0x11, 0xFE, 0xFE, 0x50,
+	/* '6', 27 pixels wide */
+	0xFE, 0x5A, 0x13, 0x1C, 0x1D, 0x12, 0x21, 0x0E, 0x25, 0x0C, 0x0F, 0x0E, 0x07, 0x0C, 0x0B, 0x26,
+	0x09, 0x28, 0x09, 0x2A, 0x09, 0x28, 0x09, 0x2A, 0x09, 0x28, 0x09, 0x2A, 0x09, 0x2A, 0x09, 0x2A,
+	0x07, 0x2C, 0x07, 0x2A, 0x09, 0x08, 0x11, 0x0E, 0x09, 0x02, 0x1D, 0x08, 0x2D, 0x06, 0x2F, 0x04,
+	0x13, 0x0E, 0x0D, 0x02, 0x0D, 0x16, 0x0D, 0x00, 0x0B, 0x1A, 0x0B, 0x00, 0x09, 0x1E, 0x09, 0x00,
+	0x09, 0x1E, 0x15, 0x20, 0x13, 0x20, 0x13, 0x20, 0x13, 0x20, 0x13, 0x20, 0x09, 0x00, 0x09, 0x1E,
+	0x09, 0x00, 0x09, 0x1E, 0x09, 0x00, 0x09, 0x1C, 0x09, 0x02, 0x0B, 0x1A, 0x09, 0x04, 0x09, 0x18,
+	0x0B, 0x04, 0x0B, 0x16, 0x09, 0x08, 0x0B, 0x10, 0x0D, 0x08, 0x0D, 0x0C, 0x0D, 0x0C, 0x25, 0x10,
+	0x21, 0x14, 0x1B, 0x1E, 0x0F, 0xFE, 0xFE, 0x64,
+	/* '7', 26 pixels wide */
+	0xFE, 0x6A, 0xFF, 0x03, 0x26, 0x0B, 0x26, 0x09, 0x26, 0x0B, 0x26, 0x09, 0x26, 0x0B, 0x26, 0x09,
+	0x26, 0x0B, 0x26, 0x09, 0x26, 0x0B, 0x26, 0x0B, 0x26, 0x09, 0x26, 0x0B, 0x26, 0x09, 0x26, 0x0B,
+	0x26, 0x09, 0x26, 0x0B, 0x26, 0x0B, 0x24, 0x0B, 0x26, 0x0B, 0x24, 0x0B, 0x26, 0x0B, 0x26, 0x09,
+	0x26, 0x0B, 0x26, 0x09, 0x26, 0x0B, 0x26, 0x0B, 0x24, 0x0B, 0x26, 0x0B, 0x24, 0x0B, 0x26, 0x0B,
+	0x26, 0x09, 0x26, 0x0B, 0x26, 0x0B, 0x24, 0x0B, 0x26, 0x09, 0xFE, 0xFE, 0x8E,
+	/* '8', 27 pixels wide */
+	0xFE, 0x54, 0x11, 0x1C, 0x1D, 0x14, 0x23, 0x0E, 0x27, 0x0A, 0x0D, 0x0C, 0x0F, 0x06, 0x0B, 0x14,
+	0x0B, 0x06, 0x09, 0x18, 0x0B, 0x02, 0x09, 0x1C, 0x09, 0x02, 0x09, 0x1C, 0x09, 0x02, 0x09, 0x1C,
+	0x09, 0x02, 0x09, 0x1C, 0x09, 0x02, 0x09, 0x1C, 0x09, 0x02, 0x0B, 0x18, 0x09, 0x06, 0x09, 0x18,
+	0x09, 0x06, 0x0B, 0x14, 0x0B, 0x08, 0x0B, 0x10, 0x0B, 0x0A, 0x0F, 0x0A, 0x0B, 0x0E, 0x11, 0x02,
+	0x0D, 0x14, 0x1D, 0x18, 0x17, 0x20, 0x13, 0x1C, 0x1B, 0x16, 0x1F, 0x10, 0x0D, 0x06, 0x0F, 0x0C,
+	0x0D, 0x0C, 0x0D, 0x08, 0x0B, 0x12, 0x0D, 0x06, 0x09, 0x18, 0x0B, 0x02, 0x09, 0x1C, 0x09, 0x02,
+	0x09, 0x1C, 0x15, 0x20, 0x13, 0x20, 0x13, 0x20, 0x13, 0x20, 0x13, 0x20, 0x15, 0x1C, 0x0B, 0x00,
+	0x09, 0x1C, 0x09, 0x02, 0x0B, 0x18, 0x0B, 0x04, 0x0F, 0x0C, 0x0F, 0x08, 0x29, 0x0C, 0x25, 0x10,
+	0x1F, 0x1A, 0x13, 0xFE, 0xFE, 0x62,
+	/* '9', 27 pixels wide */
+	0xFE, 0x54, 0x11, 0x1E, 0x19, 0x16, 0x21, 0x10, 0x25, 0x0C, 0x0D, 0x0A, 0x0F, 0x08, 0x0B, 0x12,
+	0x0B, 0x08, 0x09, 0x16, 0x0B, 0x04, 0x0B, 0x18, 0x09, 0x04, 0x09, 0x1A, 0x0B, 0x02, 0x09, 0x1C,
+	0x09, 0x00, 0x09, 0x1E, 0x09, 0x00, 0x09, 0x1E, 0x09, 0x00, 0x09, 0x1E, 0x15, 0x20, 0x13, 0x20,
+	0x13, 0x20, 0x13, 0x20, 0x15, 0x1E, 0x09, 0x00, 0x09, 0x1E, 0x09, 0x00, 0x0B, 0x1C, 0x09, 0x00,
+	0x0D, 0x16, 0x0D, 0x02, 0x0F, 0x0C, 0x13, 0x04, 0x2F, 0x06, 0x2D, 0x08, 0x1D, 0x02, 0x09, 0x0E,
+	0x11, 0x08, 0x09, 0x2A, 0x07, 0x2C, 0x07, 0x2A, 0x09, 0x2A, 0x09, 0x2A, 0x07, 0x2A, 0x09, 0x2A,
+	0x09, 0x28, 0x09, 0x28, 0x0B, 0x26, 0x0B, 0x26, 0x0B, 0x0A, 0x09, 0x0E, 0x0D, 0x0C, 0x25, 0x0E,
+	0x23, 0x12, 0x1D, 0x1C, 0x11, 0xFE, 0xFE, 0x6A,
+	/* ':', 7 pixels wide */
+	0xEE, 0x09, 0x00, 0x45, 0x00, 0x09, 0xE2, 0x09, 0x00, 0x45, 0x00, 0x09, 0xA8,
+};
+
+static const font_pack_glyph_t font_pack_59_digits_glyphs[] = {
+	{15, 0, 0},
+	{7, 0, 9},
+	{28, 0, 20},
+	{23, 0, 146},
+	{25, 0, 234},
+	{25, 0, 318},
+	{29, 0, 420},
+	{26, 0, 544},
+	{27, 0, 636},
+	{26, 0, 756},
+	{27, 0, 833},
+	{27, 0, 967},
+	{7, 0, 1087},
+};
+
+static const font_pack_range_t font_pack_59_digits_ranges[] = {
+	{45, 2, 0},
+	{48, 11, 2},
+};
+
+static const uint8_t font_pack_89_digits_data[] = {
+	/* '-', 23 pixels wide */
+	0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x44, 0x29, 0x00, 0xB7, 0x00, 0x29, 0xFE, 0xFE,
+	0xFE, 0xFE, 0xFE, 0xFE, 0xA6,
+	/* '.', 10 pixels wide */
+	0xFE, 0xFE, 0xFE, 0xFE, 0xC6, 0x0B, 0x04, 0x0F, 0x00, 0x8B, 0x00, 0x0F, 0x04, 0x0B, 0xFE, 0x56,
+	/* '0', 43 pixels wide */
+	0xFE, 0xFE, 0xFE, 0x7C, 0x13, 0x38, 0x23, 0x2C, 0x2B, 0x26, 0x2F, 0x22, 0x35, 0x1A, 0x3B, 0x18,
+	0x3B, 0x16, 0x17, 0x0C, 0x19, 0x12, 0x15, 0x16, 0x15, 0x0E, 0x15, 0x1A, 0x13, 0x0E, 0x13, 0x1E,
+	0x13, 0x0A, 0x13, 0x20, 0x13, 0x0A, 0x11, 0x24, 0x13, 0x08, 0x11, 0x24, 0x13, 0x06, 0x11, 0x28,
+	0x11, 0x06, 0x11, 0x28, 0x11, 0x06, 0x11, 0x2A, 0x11, 0x02, 0x11, 0x2C, 0x11, 0x02, 0x11, 0x2C,
+	0x11, 0x02, 0x11, 0x2C, 0x11, 0x02, 0x11, 0x2C, 0x11, 0x02, 0x11, 0x2C, 0x11, 0x02, 0x0F, 0x30,
+	0x23, 0x30, 0x23, 0x30, 0x23, 0x30, 0x23, 0x30, 0x23, 0x30, 0x23, 0x30, 0x23, 0x30, 0x23, 0x30,
+	0x23, 0x30, 0x23, 0x30, 0x23, 0x30, 0x23, 0x30, 0x23, 0x30, 0x23, 0x30, 0x23, 0x30, 0x23, 0x30,
+	0x23, 0x30, 0x23, 0x30, 0x0F, 0x02, 0x11, 0x2C, 0x11, 0x02, 0x11, 0x2C, 0x11, 0x02, 0x11, 0x2C,
+	0x11, 0x02, 0x11, 0x2C, 0x11, 0x02, 0x11, 0x2C, 0x11, 0x02, 0x11, 0x2A, 0x11, 0x06, 0x11, 0x28,
+	0x11, 0x06, 0x11, 0x28, 0x11, 0x06, 0x13, 0x24, 0x11, 0x08, 0x13, 0x24, 0x11, 0x0A, 0x13, 0x20,
+	0x13, 0x0A, 0x13, 0x1E, 0x13, 0x0E, 0x13, 0x1A, 0x15, 0x0E, 0x15, 0x16, 0x15, 0x12, 0x19, 0x0C,
+	0x17, 0x16, 0x3B, 0x18, 0x3B, 0x1A, 0x35, 0x22, 0x2F, 0x26, 0x2B, 0x2C, 0x23, 0x38, 0x13, 0xFE,
+	0xFE, 0xFE, 0xFE, 0xFE, 0x80,
+	/* '1', 37 pixels wide */
+	0xFE, 0xFE, 0xFE, 0x4C, 0x0F, 0x34, 0x13, 0x32, 0x15, 0x2E, 0x19, 0x2A, 0x1D, 0x28, 0x1F, 0x24,
+	0x23, 0x20, 0x27, 0x1E, 0x15, 0x00, 0x11, 0x1A, 0x15, 0x04, 0x11, 0x18, 0x15, 0x06, 0x11, 0x18,
+	0x11, 0x0A, 0x11, 0x18, 0x0D, 0x0E, 0x11, 0x18, 0x0B, 0x10, 0x11, 0x18, 0x07, 0x14, 0x11, 0x1A,
+	0x01, 0x18, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36,
+	0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36,
+	0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36,
+	0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36,
+	0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36,
+	0x11, 0x1C, 0x43, 0x02, 0x47, 0x00, 0x47, 0x00, 0x47, 0x00, 0x47, 0x02, 0x43, 0xFE, 0xFE, 0xFE,
+	0xFE, 0xEA,
+	/* '2', 38 pixels wide */
+	0xFE, 0xFE, 0xFE, 0x0E, 0x15, 0x2E, 0x21, 0x22, 0x2B, 0x1A, 0x31, 0x16, 0x35, 0x12, 0x39, 0x0E,
+	0x3D, 0x0C, 0x15, 0x0E, 0x19, 0x0A, 0x0F, 0x18, 0x15, 0x0A, 0x0B, 0x1E, 0x15, 0x08, 0x07, 0x24,
+	0x13, 0x08, 0x05, 0x28, 0x11, 0x38, 0x13, 0x36, 0x13, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38,
+	0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x36, 0x11, 0x38, 0x11, 0x38, 0x11, 0x36,
+	0x11, 0x38, 0x11, 0x36, 0x13, 0x36, 0x11, 0x36, 0x13, 0x36, 0x11, 0x36, 0x11, 0x36, 0x13, 0x36,
+	0x11, 0x36, 0x11, 0x36, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x36, 0x11, 0x36, 0x11, 0x36,
+	0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34,
+	0x13, 0x34, 0x13, 0x34, 0x13, 0x36, 0x11, 0x36, 0x11, 0x36, 0x11, 0x36, 0x49, 0x00, 0xFF, 0x7B,
+	0x00, 0x47, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x0C,
+	/* '3', 38 pixels wide */
+	0xFE, 0xFE, 0xFE, 0x10, 0x13, 0x2E, 0x23, 0x22, 0x2B, 0x1A, 0x31, 0x16, 0x35, 0x12, 0x39, 0x0E,
+	0x3D, 0x0C, 0x15, 0x0C, 0x19, 0x0C, 0x0F, 0x16, 0x17, 0x0A, 0x0B, 0x1C, 0x15, 0x0A, 0x07, 0x22,
+	0x13, 0x0A, 0x03, 0x28, 0x13, 0x36, 0x13, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38,
+	0x11, 0x38, 0x11, 0x38, 0x11, 0x36, 0x11, 0x38, 0x11, 0x36, 0x13, 0x36, 0x11, 0x36, 0x11, 0x36,
+	0x13, 0x32, 0x15, 0x2E, 0x19, 0x1C, 0x29, 0x1E, 0x27, 0x22, 0x25, 0x24, 0x2D, 0x1C, 0x31, 0x1A,
+	0x31, 0x30, 0x1B, 0x34, 0x17, 0x36, 0x15, 0x38, 0x13, 0x38, 0x13, 0x36, 0x13, 0x38, 0x11, 0x38,
+	0x13, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x36,
+	0x11, 0x38, 0x11, 0x00, 0x03, 0x30, 0x13, 0x00, 0x07, 0x2A, 0x13, 0x02, 0x0B, 0x24, 0x15, 0x02,
+	0x11, 0x1C, 0x15, 0x04, 0x17, 0x10, 0x1B, 0x04, 0x43, 0x06, 0x41, 0x0A, 0x3D, 0x0E, 0x37, 0x16,
+	0x31, 0x1E, 0x25, 0x2C, 0x17, 0xFE, 0xFE, 0xFE, 0xFE, 0xDC,
+	/* '4', 44 pixels wide */
+	0xFE, 0xFE, 0xFE, 0xF4, 0x15, 0x3E, 0x19, 0x3A, 0x1B, 0x3A, 0x1B, 0x38, 0x1D, 0x38, 0x1D, 0x36,
+	0x1F, 0x34, 0x21, 0x34, 0x0D, 0x00, 0x11, 0x32, 0x0F, 0x00, 0x11, 0x32, 0x0D, 0x02, 0x11, 0x30,
+	0x0D, 0x04, 0x11, 0x30, 0x0D, 0x04, 0x11, 0x2E, 0x0D, 0x06, 0x11, 0x2C, 0x0F, 0x06, 0x11, 0x2C,
+	0x0D, 0x08, 0x11, 0x2A, 0x0F, 0x08, 0x11, 0x2A, 0x0D, 0x0A, 0x11, 0x28, 0x0D, 0x0C, 0x11, 0x28,
+	0x0D, 0x0C, 0x11, 0x26, 0x0D, 0x0E, 0x11, 0x24, 0x0F, 0x0E, 0x11, 0x24, 0x0D, 0x10, 0x11, 0x22,
+	0x0F, 0x10, 0x11, 0x22, 0x0D, 0x12, 0x11, 0x20, 0x0F, 0x12, 0x11, 0x20, 0x0D, 0x14, 0x11, 0x1E,
+	0x0D, 0x16, 0x11, 0x1C, 0x0F, 0x16, 0x11, 0x1C, 0x0D, 0x18, 0x11, 0x1A, 0x0F, 0x18, 0x11, 0x1A,
+	0x0D, 0x1A, 0x11, 0x18, 0x0F, 0x1A, 0x11, 0x18, 0x0D, 0x1C, 0x11, 0x16, 0x0D, 0x1E, 0x11, 0x14,
+	0x0F, 0x1E, 0x11, 0x14, 0x0D, 0x20, 0x11, 0x12, 0x0F, 0x20, 0x11, 0x12, 0x0D, 0x22, 0x11, 0x10,
+	0x0F, 0x22, 0x11, 0x10, 0x55, 0x00, 0x55, 0x00, 0xFF, 0x5D, 0x02, 0x53, 0x34, 0x11, 0x44, 0x11,
+	0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11,
+	0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x46, 0x0D, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xEA,
+	/* '5', 38 pixels wide */
+	0xFE, 0xFE, 0xFE, 0x4A, 0x39, 0x0E, 0x3D, 0x0C, 0x3D, 0x0C, 0x3D, 0x0C, 0x3D, 0x0C, 0x3D, 0x0C,
+	0x3B, 0x0E, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38,
+	0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38,
+	0x11, 0x38, 0x11, 0x38, 0x29, 0x20, 0x31, 0x18, 0x35, 0x14, 0x39, 0x10, 0x3B, 0x0E, 0x3D, 0x10,
+	0x03, 0x18, 0x1D, 0x32, 0x17, 0x36, 0x15, 0x36, 0x13, 0x38, 0x13, 0x38, 0x11, 0x38, 0x11, 0x38,
+	0x13, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38, 0x11, 0x38,
+	0x11, 0x36, 0x13, 0x36, 0x11, 0x38, 0x11, 0x36, 0x13, 0x34, 0x13, 0x02, 0x05, 0x2A, 0x15, 0x02,
+	0x07, 0x26, 0x15, 0x04, 0x0D, 0x1E, 0x17, 0x04, 0x13, 0x12, 0x1B, 0x06, 0x41, 0x08, 0x3F, 0x0A,
+	0x3D, 0x0E, 0x37, 0x16, 0x2F, 0x20, 0x25, 0x2C, 0x15, 0xFE, 0xFE, 0xFE, 0xFE, 0xE0,
+	/* '6', 40 pixels wide */
+	0xFE, 0xFE, 0xFE, 0x46, 0x15, 0x30, 0x25, 0x24, 0x2B, 0x1E, 0x31, 0x18, 0x35, 0x16, 0x37, 0x14,
+	0x19, 0x10, 0x0D, 0x12, 0x17, 0x1C, 0x05, 0x12, 0x13, 0x38, 0x13, 0x38, 0x13, 0x3A, 0x11, 0x3A,
+	0x11, 0x3C, 0x11, 0x3A, 0x11, 0x3C, 0x11, 0x3A, 0x11, 0x3C, 0x11, 0x3C, 0x0F, 0x3E, 0x0F, 0x3C,
+	0x11, 0x3C, 0x11, 0x3C, 0x11, 0x3C, 0x0F, 0x3E, 0x0F, 0x3C, 0x11, 0x10, 0x13, 0x16, 0x11, 0x08,
+	0x21, 0x10, 0x11, 0x04, 0x29, 0x0C, 0x11, 0x00, 0x31, 0x08, 0x47, 0x06, 0x49, 0x04, 0x21, 0x0E,
+	0x17, 0x04, 0x19, 0x1A, 0x15, 0x02, 0x15, 0x20, 0x13, 0x02, 0x13, 0x24, 0x13, 0x00, 0x11, 0x28,
+	0x11, 0x00, 0x11, 0x28, 0x11, 0x00, 0x11, 0x28, 0x25, 0x2A, 0x23, 0x2A, 0x23, 0x2A, 0x23, 0x2A,
+	0x23, 0x2A, 0x11, 0x00, 0x0F, 0x2A, 0x11, 0x00, 0x11, 0x28, 0x11, 0x00, 0x11, 0x28, 0x11, 0x00,
+	0x11, 0x28, 0x11, 0x00, 0x11, 0x26, 0x13, 0x00, 0x13, 0x24, 0x11, 0x04, 0x11, 0x24, 0x11, 0x04,
+	0x11, 0x22, 0x13, 0x04, 0x13, 0x20, 0x11, 0x08, 0x11, 0x1E, 0x13, 0x08, 0x13, 0x1A, 0x13, 0x0C,
+	0x13, 0x16, 0x15, 0x0C, 0x19, 0x0A, 0x19, 0x10, 0x3B, 0x14, 0x37, 0x18, 0x33, 0x1C, 0x2F, 0x20,
+	0x29, 0x28, 0x21, 0x32, 0x15, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x1C,
+	/* '7', 40 pixels wide */
+	0xFE, 0xFE, 0xFE, 0x70, 0x4B, 0x00, 0xFF, 0x8F, 0x00, 0x4D, 0x3C, 0x0F, 0x3E, 0x0F, 0x3C, 0x11,
+	0x3C, 0x0F, 0x3C, 0x11, 0x3C, 0x0F, 0x3C, 0x11, 0x3C, 0x0F, 0x3C, 0x11, 0x3C, 0x0F, 0x3E, 0x0F,
+	0x3C, 0x11, 0x3C, 0x0F, 0x3C, 0x11, 0x3C, 0x0F, 0x3C, 0x11, 0x3C, 0x0F, 0x3C, 0x11, 0x3C, 0x11,
+	0x3A, 0x11, 0x3C, 0x11, 0x3C, 0x0F, 0x3C, 0x11, 0x3C, 0x0F, 0x3C, 0x11, 0x3C, 0x0F, 0x3C, 0x11,
+	0x3C, 0x11, 0x3A, 0x11, 0x3C, 0x11, 0x3C, 0x0F, 0x3C, 0x11, 0x3C, 0x0F, 0x3C, 0x11, 0x3C, 0x11,
+	0x3A, 0x11, 0x3C, 0x11, 0x3A, 0x11, 0x3C, 0x11, 0x3A, 0x11, 0x3C, 0x11, 0x3C, 0x0F, 0x3C, 0x11,
+	0x3C, 0x11, 0x3A, 0x11, 0x3C, 0x11, 0x3A, 0x11, 0x3C, 0x11, 0x3A, 0x11, 0x3C, 0x11, 0x3C, 0x11,
+	0x3A, 0x11, 0x3C, 0x11, 0x3C, 0x0F, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x7E,
+	/* '8', 41 pixels wide */
+	0xFE, 0xFE, 0xFE, 0x50, 0x17, 0x32, 0x23, 0x28, 0x2B, 0x20, 0x33, 0x1A, 0x37, 0x16, 0x3B, 0x12,
+	0x17, 0x0E, 0x17, 0x0E, 0x15, 0x16, 0x13, 0x0E, 0x11, 0x1E, 0x11, 0x0A, 0x13, 0x1E, 0x11, 0x0A,
+	0x11, 0x22, 0x11, 0x06, 0x13, 0x22, 0x11, 0x06, 0x11, 0x26, 0x0F, 0x06, 0x11, 0x26, 0x0F, 0x06,
+	0x11, 0x26, 0x0F, 0x06, 0x11, 0x26, 0x0F, 0x06, 0x11, 0x26, 0x0F, 0x06, 0x11, 0x26, 0x0F, 0x06,
+	0x13, 0x22, 0x0F, 0x0A, 0x11, 0x22, 0x0F, 0x0A, 0x13, 0x1E, 0x11, 0x0A, 0x15, 0x1C, 0x0F, 0x0E,
+	0x15, 0x18, 0x0F, 0x12, 0x15, 0x14, 0x11, 0x12, 0x17, 0x0E, 0x13, 0x16, 0x19, 0x08, 0x13, 0x1A,
+	0x1B, 0x00, 0x15, 0x1E, 0x2D, 0x26, 0x27, 0x2A, 0x21, 0x32, 0x1D, 0x32, 0x21, 0x2A, 0x29, 0x22,
+	0x2F, 0x1E, 0x15, 0x02, 0x1B, 0x16, 0x15, 0x0A, 0x19, 0x12, 0x15, 0x0E, 0x19, 0x0E, 0x13, 0x16,
+	0x17, 0x0A, 0x13, 0x1A, 0x15, 0x0A, 0x11, 0x1E, 0x15, 0x06, 0x11, 0x22, 0x15, 0x02, 0x13, 0x24,
+	0x13, 0x02, 0x11, 0x28, 0x11, 0x02, 0x11, 0x28, 0x25, 0x2C, 0x23, 0x2C, 0x23, 0x2C, 0x23, 0x2C,
+	0x23, 0x2C, 0x23, 0x2C, 0x23, 0x2C, 0x25, 0x28, 0x11, 0x02, 0x11, 0x28, 0x11, 0x02, 0x13, 0x24,
+	0x13, 0x02, 0x15, 0x20, 0x13, 0x06, 0x15, 0x1C, 0x13, 0x0A, 0x19, 0x10, 0x19, 0x0C, 0x41, 0x10,
+	0x3D, 0x14, 0x37, 0x1C, 0x31, 0x22, 0x27, 0x30, 0x17, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x3C,
+	/* '9', 40 pixels wide */
+	0xFE, 0xFE, 0xFE, 0x3C, 0x13, 0x32, 0x23, 0x26, 0x29, 0x22, 0x2F, 0x1A, 0x35, 0x16, 0x39, 0x12,
+	0x17, 0x0C, 0x17, 0x10, 0x13, 0x14, 0x13, 0x0E, 0x13, 0x18, 0x13, 0x0A, 0x13, 0x1C, 0x13, 0x08,
+	0x11, 0x20, 0x11, 0x06, 0x13, 0x20, 0x11, 0x06, 0x11, 0x24, 0x11, 0x04, 0x11, 0x24, 0x11, 0x04,
+	0x11, 0x26, 0x0F, 0x02, 0x11, 0x28, 0x11, 0x00, 0x11, 0x28, 0x11, 0x00, 0x11, 0x28, 0x11, 0x00,
+	0x11, 0x28, 0x11, 0x00, 0x11, 0x2A, 0x0F, 0x00, 0x11, 0x2A, 0x23, 0x2A, 0x23, 0x2A, 0x23, 0x2A,
+	0x25, 0x28, 0x25, 0x28, 0x11, 0x00, 0x11, 0x28, 0x11, 0x00, 0x13, 0x26, 0x11, 0x00, 0x13, 0x24,
+	0x13, 0x02, 0x13, 0x20, 0x15, 0x02, 0x15, 0x1A, 0x19, 0x04, 0x19, 0x0E, 0x1F, 0x06, 0x47, 0x06,
+	0x47, 0x0A, 0x43, 0x0C, 0x2B, 0x02, 0x11, 0x10, 0x21, 0x08, 0x11, 0x16, 0x15, 0x0E, 0x0F, 0x3E,
+	0x0F, 0x3E, 0x0F, 0x3E, 0x0F, 0x3C, 0x11, 0x3C, 0x11, 0x3C, 0x0F, 0x3C, 0x11, 0x3C, 0x11, 0x3C,
+	0x0F, 0x3C, 0x11, 0x3C, 0x11, 0x3A, 0x11, 0x3A, 0x13, 0x38, 0x13, 0x38, 0x15, 0x36, 0x15, 0x0E,
+	0x07, 0x1C, 0x17, 0x10, 0x0D, 0x12, 0x19, 0x12, 0x3B, 0x12, 0x37, 0x16, 0x35, 0x18, 0x33, 0x1C,
+	0x2D, 0x24, 0x25, 0x30, 0x15, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x26,
+	/* ':', 10 pixels wide */
+	0xFE, 0xFE, 0x1E, 0x0B, 0x04, 0x0F, 0x00, 0x8B, 0x00, 0x0F, 0x04, 0x0B, 0xFE, 0xD2, 0x0B, 0x04,
+	0x0F, 0x00, 0x8B, 0x00, 0x0F, 0x04, 0x0B, 0xFE, 0x56,
+};
+
+static const font_pack_glyph_t font_pack_89_digits_glyphs[] = {
+	{23, 0, 0},
+	{10, 0, 21},
+	{43, 0, 37},
+	{37, 0, 234},
+	{38, 0, 380},
+	{38, 0, 516},
+	{44, 0, 670},
+	{38, 0, 860},
+	{40, 0, 1002},
+	{40, 0, 1189},
+	{41, 0, 1313},
+	{40, 0, 1520},
+	{10, 0, 1707},
+};
+
+static const font_pack_range_t font_pack_89_digits_ranges[] = {
+	{45, 2, 0},
+	{48, 11, 2},
+};
+
+static const uint8_t icon_pack_30_data[] = {
+	/* icon 0, 30 pixels wide */
+	0xFE, 0x34, 0x21, 0x14, 0x29, 0x10, 0x2B, 0x0C, 0x03, 0x24, 0x03, 0x0C, 0x03, 0x24, 0x03, 0x0C,
+	0x03, 0x24, 0x07, 0x08, 0x03, 0x24, 0x09, 0x06, 0x03, 0x24, 0x09, 0x06, 0x03, 0x24, 0x09, 0x06,
+	0x03, 0x24, 0x09, 0x06, 0x03, 0x24, 0x09, 0x06, 0x03, 0x24, 0x09, 0x06, 0x03, 0x24, 0x09, 0x06,
+	0x03, 0x24, 0x09, 0x06, 0x03, 0x24, 0x05, 0x0A, 0x03, 0x24, 0x03, 0x0C, 0x03, 0x24, 0x03, 0x0E,
+	0x2B, 0x0E, 0x29, 0x14, 0x21, 0xFE, 0x3A,
+	/* icon 1, 30 pixels wide */
+	0xFE, 0x34, 0x21, 0x14, 0x29, 0x10, 0x2B, 0x0C, 0x03, 0x24, 0x03, 0x0C, 0x03, 0x04, 0x03, 0x1A,
+	0x03, 0x0C, 0x03, 0x02, 0x07, 0x18, 0x07, 0x08, 0x03, 0x02, 0x07, 0x18, 0x09, 0x06, 0x03, 0x02,
+	0x07, 0x18, 0x09, 0x06, 0x03, 0x02, 0x07, 0x18, 0x09, 0x06, 0x03, 0x02, 0x07, 0x18, 0x09, 0x06,
+	0x03, 0x02, 0x07, 0x18, 0x09, 0x06, 0x03, 0x02, 0x07, 0x18, 0x09, 0x06, 0x03, 0x02, 0x07, 0x18,
+	0x09, 0x06, 0x03, 0x02, 0x07, 0x18, 0x09, 0x06, 0x03, 0x02, 0x07, 0x18, 0x05, 0x0A, 0x03, 0x04,
+	0x03, 0x1A, 0x03, 0x0C, 0x03, 0x24, 0x03, 0x0E, 0x2B, 0x0E, 0x29, 0x14, 0x21, 0xFE, 0x3A,
+	/* icon 2, 30 pixels wide */
+	0xFE, 0x34, 0x21, 0x14, 0x29, 0x10, 0x2B, 0x0C, 0x03, 0x24, 0x03, 0x0C, 0x03, 0x04, 0x0B, 0x12,
+	0x03, 0x0C, 0x03, 0x02, 0x0F, 0x10, 0x07, 0x08, 0x03, 0x02, 0x0F, 0x10, 0x09, 0x06, 0x03, 0x02,
+	0x0F, 0x10, 0x09, 0x06, 0x03, 0x02, 0x0F, 0x10, 0x09, 0x06, 0x03, 0x02, 0x0F, 0x10, 0x09, 0x06,
+	0x03, 0x02, 0x0F, 0x10, 0x09, 0x06, 0x03, 0x02, 0x0F, 0x10, 0x09, 0x06, 0x03, 0x02, 0x0F, 0x10,
+	0x09, 0x06, 0x03, 0x02, 0x0F, 0x10, 0x09, 0x06, 0x03, 0x02, 0x0F, 0x10, 0x05, 0x0A, 0x03, 0x04,
+	0x0B, 0x12, 0x03, 0x0C, 0x03, 0x24, 0x03, 0x0E, 0x2B, 0x0E, 0x29, 0x14, 0x21, 0xFE, 0x3A,
+	/* icon 3, 30 pixels wide */
+	0xFE, 0x34, 0x21, 0x14, 0x29, 0x10, 0x2B, 0x0C, 0x03, 0x24, 0x03, 0x0C, 0x03, 0x04, 0x11, 0x0C,
+	0x03, 0x0C, 0x03, 0x02, 0x15, 0x0A, 0x07, 0x08, 0x03, 0x02, 0x15, 0x0A, 0x09, 0x06, 0x03, 0x02,
+	0x15, 0x0A, 0x09, 0x06, 0x03, 0x02, 0x15, 0x0A, 0x09, 0x06, 0x03, 0x02, 0x15, 0x0A, 0x09, 0x06,
+	0x03, 0x02, 0x15, 0x0A, 0x09, 0x06, 0x03, 0x02, 0x15, 0x0A, 0x09, 0x06, 0x03, 0x02, 0x15, 0x0A,
+	0x09, 0x06, 0x03, 0x02, 0x15, 0x0A, 0x09, 0x06, 0x03, 0x02, 0x15, 0x0A, 0x05, 0x0A, 0x03, 0x04,
+	0x11, 0x0C, 0x03, 0x0C, 0x03, 0x24, 0x03, 0x0E, 0x2B, 0x0E, 0x29, 0x14, 0x21, 0xFE, 0x3A,
+	/* icon 4, 30 pixels wide */
+	0xFE, 0x34, 0x21, 0x14, 0x29, 0x10, 0x2B, 0x0C, 0x03, 0x24, 0x03, 0x0C, 0x03, 0x04, 0x19, 0x04,
+	0x03, 0x0C, 0x03, 0x02, 0x1D, 0x02, 0x07, 0x08, 0x03, 0x02, 0x1D, 0x02, 0x09, 0x06, 0x03, 0x02,
+	0x1D, 0x02, 0x09, 0x06, 0x03, 0x02, 0x1D, 0x02, 0x09, 0x06, 0x03, 0x02, 0x1D, 0x02, 0x09, 0x06,
+	0x03, 0x02, 0x1D, 0x02, 0x09, 0x06, 0x03, 0x02, 0x1D, 0x02, 0x09, 0x06, 0x03, 0x02, 0x1D, 0x02,
+	0x09, 0x06, 0x03, 0x02, 0x1D, 0x02, 0x09, 0x06, 0x03, 0x02, 0x1D, 0x02, 0x05, 0x0A, 0x03, 0x04,
+	0x19, 0x04, 0x03, 0x0C, 0x03, 0x24, 0x03, 0x0E, 0x2B, 0x0E, 0x29, 0x14, 0x21, 0xFE, 0x3A,
+	/* icon 5, 30 pixels wide */
+	0xFE, 0x34, 0x21, 0x14, 0x29, 0x10, 0x2B, 0x0C, 0x03, 0x24, 0x03, 0x0C, 0x03, 0x24, 0x03, 0x0C,
+	0x03, 0x24, 0x07, 0x08, 0x03, 0x24, 0x09, 0x06, 0x03, 0x0E, 0x05, 0x0E, 0x09, 0x06, 0x03, 0x0E,
+	0x07, 0x0C, 0x09, 0x06, 0x03, 0x06, 0x05, 0x00, 0x0B, 0x08, 0x09, 0x06, 0x03, 0x0A, 0x09, 0x00,
+	0x05, 0x06, 0x09, 0x06, 0x03, 0x0C, 0x07, 0x0E, 0x09, 0x06, 0x03, 0x10, 0x03, 0x0E, 0x09, 0x06,
+	0x03, 0x12, 0x01, 0x0E, 0x09, 0x06, 0x03, 0x24, 0x05, 0x0A, 0x03, 0x24, 0x03, 0x0C, 0x03, 0x24,
+	0x03, 0x0E, 0x2B, 0x0E, 0x29, 0x14, 0x21, 0xFE, 0x3A,
+	/* icon 6, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x0C, 0xC0,
+	0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x07, 0x8C, 0xC0, 0x00, 0x0F, 0xCC, 0xC0,
+	0x00, 0x0C, 0xCC, 0xC0, 0x00, 0x0C, 0xCC, 0xC0, 0x00, 0x0C, 0xCC, 0xC0, 0x00, 0x0C, 0xCC, 0xC0,
+	0x03, 0x0C, 0xCC, 0xC0, 0x0F, 0x8C, 0xCC, 0xC0, 0x0D, 0xCC, 0xCC, 0xC0, 0x0C, 0xCC, 0xCC, 0xC0,
+	0x0C, 0xCC, 0xCC, 0xC0, 0x0C, 0xCC, 0xCC, 0xC0, 0x0C, 0xCC, 0xCC, 0xC0, 0x0C, 0xCC, 0xCC, 0xC0,
+	0x0C, 0xCC, 0xCC, 0xC0, 0x0F, 0xCF, 0xCF, 0xC0, 0x07, 0x87, 0x87, 0x80, 0x02, 0x03, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 7, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x0C, 0xC0,
+	0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x07, 0x8C, 0xC0, 0x00, 0x0F, 0xCC, 0xC0,
+	0x00, 0x0C, 0xCC, 0xC0, 0x00, 0x0C, 0xCC, 0xC0, 0x00, 0x0C, 0xCC, 0xC0, 0x00, 0x0C, 0xCC, 0xC0,
+	0x07, 0x8C, 0xCC, 0xC0, 0x0F, 0xCC, 0xCC, 0xC0, 0x0F, 0xCC, 0xCC, 0xC0, 0x0F, 0xCC, 0xCC, 0xC0,
+	0x0F, 0xCC, 0xCC, 0xC0, 0x0F, 0xCC, 0xCC, 0xC0, 0x0F, 0xCC, 0xCC, 0xC0, 0x0F, 0xCC, 0xCC, 0xC0,
+	0x0F, 0xCC, 0xCC, 0xC0, 0x0F, 0xCF, 0xCF, 0xC0, 0x07, 0x87, 0x87, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 8, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x0C, 0xC0,
+	0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x07, 0x8C, 0xC0, 0x00, 0x0F, 0xCC, 0xC0,
+	0x00, 0x0F, 0xCC, 0xC0, 0x00, 0x0F, 0xCC, 0xC0, 0x00, 0x0F, 0xCC, 0xC0, 0x00, 0x0F, 0xCC, 0xC0,
+	0x07, 0x8F, 0xCC, 0xC0, 0x0F, 0xCF, 0xCC, 0xC0, 0x0F, 0xCF, 0xCC, 0xC0, 0x0F, 0xCF, 0xCC, 0xC0,
+	0x0F, 0xCF, 0xCC, 0xC0, 0x0F, 0xCF, 0xCC, 0xC0, 0x0F, 0xCF, 0xCC, 0xC0, 0x0F, 0xCF, 0xCC, 0xC0,
+	0x0F, 0xCF, 0xCC, 0xC0, 0x0F, 0xCF, 0xCF, 0xC0, 0x07, 0x87, 0x87, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 9, 30 pixels wide */
+	0xDE, 0x03, 0x34, 0x09, 0x2E, 0x0B, 0x2E, 0x0B, 0x2E, 0x0B, 0x2E, 0x0B, 0x2E, 0x0B, 0x20, 0x07,
+	0x04, 0x0B, 0x1E, 0x0B, 0x02, 0x0B, 0x1E, 0x0B, 0x02, 0x0B, 0x1E, 0x0B, 0x02, 0x0B, 0x1E, 0x0B,
+	0x02, 0x0B, 0x1E, 0x0B, 0x02, 0x0B, 0x10, 0x07, 0x04, 0x0B, 0x02, 0x0B, 0x0E, 0x0B, 0x02, 0x0B,
+	0x02, 0x0B, 0x0E, 0x0B, 0x02, 0x0B, 0x02, 0x0B, 0x0E, 0x0B, 0x02, 0x0B, 0x02, 0x0B, 0x0E, 0x0B,
+	0x02, 0x0B, 0x02, 0x0B, 0x0E, 0x0B, 0x02, 0x0B, 0x02, 0x0B, 0x0E, 0x0B, 0x02, 0x0B, 0x02, 0x0B,
+	0x0E, 0x0B, 0x02, 0x0B, 0x02, 0x0B, 0x0E, 0x0B, 0x02, 0x0B, 0x02, 0x0B, 0x0E, 0x0B, 0x02, 0x0B,
+	0x02, 0x0B, 0x10, 0x07, 0x06, 0x07, 0x06, 0x07, 0xBC,
+	/* icon 10, 30 pixels wide */
+	0xCE, 0x03, 0x34, 0x07, 0x32, 0x07, 0x30, 0x03, 0x02, 0x03, 0x2E, 0x03, 0x02, 0x03, 0x2C, 0x03,
+	0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x28, 0x03, 0x0A, 0x03, 0x26, 0x03, 0x0A, 0x03, 0x24, 0x03,
+	0x0E, 0x03, 0x22, 0x03, 0x0E, 0x03, 0x20, 0x03, 0x12, 0x03, 0x1E, 0x03, 0x12, 0x03, 0x1C, 0x03,
+	0x16, 0x03, 0x1A, 0x03, 0x16, 0x03, 0x18, 0x03, 0x1A, 0x03, 0x16, 0x03, 0x1A, 0x03, 0x14, 0x03,
+	0x0C, 0x03, 0x0C, 0x03, 0x12, 0x03, 0x06, 0x0F, 0x06, 0x03, 0x10, 0x05, 0x00, 0x0B, 0x02, 0x0B,
+	0x00, 0x05, 0x10, 0x0B, 0x0E, 0x0B, 0x14, 0x03, 0x1A, 0x03, 0xFE, 0x36,
+	/* icon 11, 30 pixels wide */
+	0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x04, 0x07, 0x32, 0x07, 0x30, 0x0B, 0x30, 0x07, 0x34, 0x03, 0xFE,
+	0x0A,
+	/* icon 12, 30 pixels wide */
+	0xFE, 0xFE, 0xFE, 0x9C, 0x07, 0x2E, 0x0F, 0x26, 0x07, 0x06, 0x05, 0x24, 0x03, 0x0E, 0x03, 0xA2,
+	0x07, 0x32, 0x07, 0x30, 0x0B, 0x30, 0x07, 0x34, 0x03, 0xFE, 0x0A,
+	/* icon 13, 30 pixels wide */
+	0xFE, 0xFE, 0x6A, 0x13, 0x22, 0x1B, 0x1A, 0x09, 0x0E, 0x07, 0x16, 0x05, 0x18, 0x05, 0x14, 0x03,
+	0x1E, 0x03, 0x22, 0x07, 0x2E, 0x0F, 0x26, 0x07, 0x06, 0x05, 0x24, 0x03, 0x0E, 0x03, 0xA2, 0x07,
+	0x32, 0x07, 0x30, 0x0B, 0x30, 0x07, 0x34, 0x03, 0xFE, 0x0A,
+	/* icon 14, 30 pixels wide */
+	0xFE, 0x04, 0x0F, 0x22, 0x1D, 0x18, 0x0B, 0x0E, 0x09, 0x12, 0x07, 0x1A, 0x07, 0x0C, 0x05, 0x22,
+	0x05, 0x06, 0x07, 0x26, 0x05, 0x04, 0x03, 0x0C, 0x13, 0x0A, 0x05, 0x10, 0x1B, 0x1A, 0x09, 0x0E,
+	0x07, 0x16, 0x05, 0x18, 0x05, 0x14, 0x03, 0x1E, 0x03, 0x22, 0x07, 0x2E, 0x0F, 0x26, 0x07, 0x06,
+	0x05, 0x24, 0x03, 0x0E, 0x03, 0xA2, 0x07, 0x32, 0x07, 0x30, 0x0B, 0x30, 0x07, 0x34, 0x03, 0xFE,
+	0x0A,
+	/* icon 15, 30 pixels wide */
+	0xAA, 0x01, 0x36, 0x03, 0x1A, 0x0F, 0x08, 0x03, 0x14, 0x19, 0x04, 0x03, 0x12, 0x0B, 0x14, 0x05,
+	0x10, 0x07, 0x18, 0x09, 0x0C, 0x05, 0x1A, 0x03, 0x02, 0x05, 0x06, 0x07, 0x1A, 0x03, 0x06, 0x05,
+	0x04, 0x03, 0x0C, 0x09, 0x04, 0x05, 0x08, 0x05, 0x10, 0x0B, 0x04, 0x09, 0x1A, 0x07, 0x0A, 0x0D,
+	0x16, 0x05, 0x0C, 0x03, 0x06, 0x05, 0x14, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x22, 0x07, 0x30, 0x0D,
+	0x2A, 0x03, 0x06, 0x05, 0x26, 0x03, 0x0C, 0x03, 0x22, 0x03, 0x34, 0x03, 0x34, 0x03, 0x06, 0x07,
+	0x24, 0x03, 0x08, 0x07, 0x22, 0x03, 0x08, 0x0B, 0x1E, 0x03, 0x0C, 0x07, 0x1E, 0x03, 0x10, 0x03,
+	0x1E, 0x03, 0xE6,
+	/* icon 16, 30 pixels wide */
+	0xCC, 0x03, 0x36, 0x05, 0x34, 0x07, 0x32, 0x09, 0x30, 0x03, 0x00, 0x05, 0x2E, 0x03, 0x02, 0x05,
+	0x24, 0x01, 0x04, 0x03, 0x04, 0x05, 0x22, 0x03, 0x02, 0x03, 0x04, 0x05, 0x22, 0x05, 0x00, 0x03,
+	0x02, 0x05, 0x26, 0x09, 0x00, 0x05, 0x2A, 0x0D, 0x2E, 0x09, 0x32, 0x05, 0x32, 0x09, 0x2E, 0x0D,
+	0x2A, 0x09, 0x00, 0x05, 0x26, 0x05, 0x00, 0x03, 0x02, 0x05, 0x24, 0x03, 0x02, 0x03, 0x04, 0x05,
+	0x22, 0x01, 0x04, 0x03, 0x04, 0x05, 0x2A, 0x03, 0x02, 0x05, 0x2C, 0x03, 0x00, 0x05, 0x2E, 0x09,
+	0x30, 0x07, 0x32, 0x05, 0x34, 0x03, 0x94,
+	/* icon 17, 30 pixels wide */
+	0xFE, 0xA6, 0x0F, 0x02, 0x1F, 0x06, 0x0F, 0x1C, 0x07, 0x04, 0x03, 0x00, 0x03, 0x00, 0x03, 0x20,
+	0x03, 0x04, 0x03, 0x00, 0x03, 0x00, 0x03, 0x20, 0x03, 0x04, 0x03, 0x06, 0x03, 0x20, 0x03, 0x04,
+	0x03, 0x06, 0x03, 0x20, 0x03, 0x04, 0x0F, 0x20, 0x03, 0x04, 0x0F, 0x20, 0x03, 0x0A, 0x03, 0x26,
+	0x03, 0x0A, 0x03, 0x26, 0x03, 0x0A, 0x03, 0x26, 0x03, 0x0A, 0x03, 0x26, 0x03, 0x0A, 0x03, 0x26,
+	0x03, 0x0A, 0x03, 0x26, 0x03, 0x0A, 0x03, 0x26, 0x03, 0x0A, 0x03, 0x02, 0x27, 0x0A, 0x03, 0x02,
+	0x25, 0x0C, 0x03, 0x08, 0x03, 0x08, 0x03, 0x1A, 0x03, 0x08, 0x03, 0x08, 0x03, 0x1A, 0x03, 0x08,
+	0x03, 0x08, 0x03, 0x1A, 0x03, 0x02, 0x1B, 0x16, 0x03, 0x02, 0x1D, 0x46,
+	/* icon 18, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xFF, 0xF0, 0x3F, 0xCF, 0xFF, 0xF0,
+	0x36, 0xC0, 0x00, 0x18, 0x36, 0xC0, 0x00, 0x18, 0x30, 0xC0, 0x00, 0x18, 0x30, 0xC0, 0x00, 0x18,
+	0x3F, 0xC0, 0x00, 0x18, 0x3F, 0xC0, 0x00, 0x18, 0x06, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x18,
+	0x06, 0x00, 0x00, 0x18, 0x06, 0x00, 0x3F, 0x98, 0x06, 0x00, 0x7F, 0xC8, 0x06, 0x00, 0xFF, 0xE0,
+	0x06, 0x00, 0xCF, 0x30, 0x06, 0x01, 0xE6, 0x78, 0x06, 0x7D, 0xF0, 0xF8, 0x06, 0x7D, 0xF9, 0xF8,
+	0x06, 0x0D, 0xF0, 0xF8, 0x06, 0x0D, 0xE6, 0x78, 0x06, 0x1C, 0xCF, 0x70, 0x06, 0x7E, 0xFF, 0xF0,
+	0x04, 0x7E, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0x80,
+	/* icon 19, 30 pixels wide */
+	0xFE, 0x0A, 0x03, 0x34, 0x07, 0x32, 0x07, 0x30, 0x0B, 0x2E, 0x0B, 0x32, 0x03, 0x06, 0x09, 0x24,
+	0x03, 0x04, 0x0B, 0x16, 0x05, 0x06, 0x03, 0x04, 0x03, 0x02, 0x03, 0x14, 0x09, 0x04, 0x03, 0x04,
+	0x03, 0x02, 0x03, 0x14, 0x03, 0x00, 0x03, 0x04, 0x03, 0x04, 0x0B, 0x14, 0x03, 0x00, 0x03, 0x04,
+	0x03, 0x06, 0x09, 0x14, 0x09, 0x04, 0x03, 0x08, 0x03, 0x1A, 0x05, 0x06, 0x03, 0x08, 0x03, 0x1A,
+	0x05, 0x06, 0x11, 0x1C, 0x03, 0x06, 0x0F, 0x1E, 0x11, 0x2A, 0x0D, 0x34, 0x05, 0x34, 0x05, 0x32,
+	0x0B, 0x2C, 0x05, 0x02, 0x05, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2C, 0x03, 0x02,
+	0x03, 0x2E, 0x0B, 0x30, 0x07, 0x18,
+	/* icon 20, 30 pixels wide */
+	0xFE, 0xFE, 0x00, 0x03, 0x36, 0x05, 0x34, 0x07, 0x32, 0x09, 0x30, 0x03, 0x00, 0x05, 0x14, 0x1D,
+	0x02, 0x05, 0x12, 0x1B, 0x06, 0x05, 0x10, 0x03, 0x20, 0x05, 0x0E, 0x03, 0x22, 0x03, 0x0E, 0x03,
+	0x20, 0x05, 0x0E, 0x1B, 0x06, 0x05, 0x10, 0x1D, 0x02, 0x05, 0x14, 0x1B, 0x00, 0x05, 0x2E, 0x09,
+	0x30, 0x07, 0x32, 0x05, 0x34, 0x03, 0xFE, 0x40,
+	/* icon 21, 30 pixels wide */
+	0xFE, 0xBA, 0x01, 0x36, 0x05, 0x32, 0x07, 0x30, 0x09, 0x2E, 0x05, 0x00, 0x03, 0x2A, 0x07, 0x02,
+	0x03, 0x28, 0x05, 0x06, 0x1D, 0x0C, 0x05, 0x08, 0x1F, 0x08, 0x05, 0x26, 0x03, 0x08, 0x03, 0x28,
+	0x03, 0x08, 0x05, 0x26, 0x03, 0x0A, 0x05, 0x0A, 0x1D, 0x0C, 0x05, 0x06, 0x1F, 0x0E, 0x05, 0x04,
+	0x1D, 0x12, 0x05, 0x02, 0x03, 0x2E, 0x0B, 0x30, 0x09, 0x34, 0x05, 0x36, 0x03, 0xFE, 0x0E,
+	/* icon 22, 30 pixels wide */
+	0xFE, 0x06, 0x0B, 0x2C, 0x0F, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06,
+	0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06,
+	0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06,
+	0x03, 0x2A, 0x03, 0x06, 0x03, 0x20, 0x0D, 0x06, 0x0D, 0x16, 0x0D, 0x06, 0x0D, 0x18, 0x03, 0x16,
+	0x03, 0x1C, 0x03, 0x12, 0x03, 0x1E, 0x05, 0x0E, 0x05, 0x20, 0x05, 0x0A, 0x05, 0x24, 0x05, 0x06,
+	0x05, 0x28, 0x05, 0x02, 0x05, 0x2C, 0x0B, 0x30, 0x07, 0x34, 0x03, 0x56,
+	/* icon 23, 30 pixels wide */
+	0xFE, 0x0A, 0x03, 0x34, 0x07, 0x30, 0x0B, 0x2C, 0x05, 0x02, 0x05, 0x2A, 0x03, 0x06, 0x03, 0x28,
+	0x03, 0x0A, 0x03, 0x24, 0x03, 0x0E, 0x03, 0x20, 0x05, 0x0E, 0x05, 0x1C, 0x05, 0x12, 0x05, 0x18,
+	0x0B, 0x0A, 0x0B, 0x16, 0x0D, 0x06, 0x0D, 0x16, 0x0D, 0x06, 0x0D, 0x20, 0x03, 0x06, 0x03, 0x2A,
+	0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A,
+	0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A,
+	0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x0F, 0x2A, 0x0F, 0x50,
+	/* icon 24, 30 pixels wide */
+	0xF8, 0x07, 0x32, 0x0B, 0x2C, 0x03, 0x02, 0x09, 0x28, 0x03, 0x06, 0x07, 0x26, 0x03, 0x0A, 0x07,
+	0x22, 0x03, 0x0E, 0x07, 0x1E, 0x03, 0x12, 0x07, 0x1A, 0x03, 0x16, 0x07, 0x16, 0x03, 0x18, 0x09,
+	0x12, 0x03, 0x1C, 0x07, 0x10, 0x03, 0x20, 0x07, 0x0C, 0x03, 0x24, 0x03, 0x0C, 0x03, 0x24, 0x03,
+	0x0C, 0x03, 0x22, 0x05, 0x0C, 0x03, 0x20, 0x05, 0x0E, 0x03, 0x1C, 0x07, 0x10, 0x03, 0x18, 0x07,
+	0x14, 0x03, 0x14, 0x07, 0x18, 0x03, 0x10, 0x07, 0x1C, 0x03, 0x0E, 0x07, 0x1E, 0x03, 0x0A, 0x07,
+	0x22, 0x03, 0x06, 0x07, 0x26, 0x05, 0x00, 0x07, 0x2C, 0x09, 0x32, 0x05, 0x64,
+	/* icon 25, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0xC0, 0x0F, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x0C, 0x30, 0x30, 0xC0, 0x0C, 0x38, 0x70, 0xC0,
+	0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0,
+	0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0,
+	0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0,
+	0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0,
+	0x0C, 0x38, 0x70, 0xC0, 0x0C, 0x38, 0x70, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x07, 0xF0, 0x3F, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 26, 30 pixels wide */
+	0xFE, 0x0A, 0x03, 0x34, 0x07, 0x30, 0x0B, 0x2C, 0x05, 0x02, 0x05, 0x28, 0x05, 0x06, 0x05, 0x26,
+	0x03, 0x0A, 0x03, 0x24, 0x03, 0x0E, 0x03, 0x20, 0x05, 0x0E, 0x05, 0x1C, 0x05, 0x12, 0x05, 0x18,
+	0x05, 0x16, 0x05, 0x14, 0x05, 0x1A, 0x05, 0x12, 0x03, 0x1E, 0x03, 0x10, 0x03, 0x22, 0x03, 0x0E,
+	0x2B, 0x0E, 0x2B, 0x12, 0x23, 0x8C, 0x27, 0x10, 0x2B, 0x0E, 0x03, 0x22, 0x03, 0x0E, 0x03, 0x22,
+	0x03, 0x0E, 0x2B, 0x10, 0x27, 0x80,
+	/* icon 27, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x01, 0xC0, 0x00, 0x1F, 0x03, 0xF0, 0x00,
+	0x33, 0x83, 0x38, 0x00, 0x31, 0xC3, 0x1C, 0x00, 0x30, 0xE3, 0x0E, 0x00, 0x30, 0x73, 0x07, 0x00,
+	0x30, 0x1B, 0x03, 0xC0, 0x30, 0x0F, 0x00, 0xE0, 0x30, 0x07, 0x00, 0x70, 0x30, 0x03, 0x00, 0x38,
+	0x30, 0x03, 0x00, 0x18, 0x30, 0x03, 0x00, 0x70, 0x30, 0x07, 0x00, 0xE0, 0x30, 0x1F, 0x01, 0xC0,
+	0x30, 0x3B, 0x03, 0x80, 0x30, 0x73, 0x07, 0x00, 0x30, 0xE3, 0x0E, 0x00, 0x31, 0xC3, 0x3C, 0x00,
+	0x37, 0x03, 0x70, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x1C, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 28, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xE0, 0x00, 0x3F, 0x03, 0xE0,
+	0x00, 0x73, 0x07, 0x30, 0x00, 0xE3, 0x0E, 0x30, 0x01, 0xC3, 0x1C, 0x30, 0x03, 0x83, 0x38, 0x30,
+	0x07, 0x03, 0x60, 0x30, 0x1E, 0x03, 0xC0, 0x30, 0x38, 0x03, 0x80, 0x30, 0x70, 0x03, 0x00, 0x30,
+	0x60, 0x03, 0x00, 0x30, 0x38, 0x03, 0x00, 0x30, 0x1C, 0x03, 0xC0, 0x30, 0x0E, 0x03, 0xE0, 0x30,
+	0x07, 0x03, 0x70, 0x30, 0x03, 0x83, 0x38, 0x30, 0x01, 0xC3, 0x1C, 0x30, 0x00, 0xF3, 0x0E, 0x30,
+	0x00, 0x3B, 0x03, 0xB0, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x0E, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 29, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0xC0, 0x0D, 0xC0, 0x0C, 0xC0,
+	0x0C, 0xF0, 0x0C, 0xC0, 0x0C, 0x3C, 0x0C, 0xC0, 0x0C, 0x0E, 0x0C, 0xC0, 0x0C, 0x07, 0x8C, 0xC0,
+	0x0C, 0x01, 0xEC, 0xC0, 0x0C, 0x00, 0xFC, 0xC0, 0x0C, 0x00, 0x3C, 0xC0, 0x0C, 0x00, 0x0C, 0xC0,
+	0x0C, 0x00, 0x0C, 0xC0, 0x0C, 0x00, 0x1C, 0xC0, 0x0C, 0x00, 0x7C, 0xC0, 0x0C, 0x00, 0xFC, 0xC0,
+	0x0C, 0x03, 0xCC, 0xC0, 0x0C, 0x07, 0x0C, 0xC0, 0x0C, 0x1E, 0x0C, 0xC0, 0x0C, 0x78, 0x0C, 0xC0,
+	0x0C, 0xF0, 0x0C, 0xC0, 0x0F, 0xC0, 0x0C, 0xC0, 0x0F, 0x00, 0x0F, 0xC0, 0x06, 0x00, 0x07, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 30, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x01, 0x80, 0x0F, 0xC0, 0x07, 0xC0, 0x0C, 0xC0, 0x0E, 0xC0,
+	0x0C, 0xC0, 0x3C, 0xC0, 0x0C, 0xC0, 0xF0, 0xC0, 0x0C, 0xC1, 0xE0, 0xC0, 0x0C, 0xC7, 0x80, 0xC0,
+	0x0C, 0xDE, 0x00, 0xC0, 0x0C, 0xFC, 0x00, 0xC0, 0x0C, 0xF0, 0x00, 0xC0, 0x0C, 0xC0, 0x00, 0xC0,
+	0x0C, 0xC0, 0x00, 0xC0, 0x0C, 0xE0, 0x00, 0xC0, 0x0C, 0xF8, 0x00, 0xC0, 0x0C, 0xFC, 0x00, 0xC0,
+	0x0C, 0xCF, 0x00, 0xC0, 0x0C, 0xC3, 0x80, 0xC0, 0x0C, 0xC1, 0xE0, 0xC0, 0x0C, 0xC0, 0x78, 0xC0,
+	0x0C, 0xC0, 0x3C, 0xC0, 0x0C, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x01, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 31, 30 pixels wide */
+	0xFE, 0x0A, 0x03, 0x36, 0x03, 0x36, 0x03, 0x2E, 0x03, 0x02, 0x03, 0x02, 0x03, 0x22, 0x07, 0x02,
+	0x03, 0x02, 0x07, 0x1C, 0x05, 0x06, 0x03, 0x06, 0x05, 0x18, 0x05, 0x08, 0x03, 0x08, 0x05, 0x16,
+	0x03, 0x0A, 0x03, 0x0A, 0x03, 0x14, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x10, 0x05, 0x0C, 0x03, 0x0C,
+	0x05, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x22,
+	0x03, 0x0E, 0x03, 0x22, 0x03, 0x0E, 0x03, 0x22, 0x03, 0x0E, 0x03, 0x22, 0x03, 0x0E, 0x03, 0x22,
+	0x03, 0x0E, 0x05, 0x1E, 0x05, 0x10, 0x03, 0x1E, 0x03, 0x12, 0x05, 0x1A, 0x05, 0x14, 0x05, 0x16,
+	0x05, 0x18, 0x05, 0x12, 0x05, 0x1C, 0x07, 0x0A, 0x07, 0x22, 0x13, 0x2A, 0x0B, 0x52,
+	/* icon 32, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1C, 0xE0, 0x00, 0x00, 0x18, 0x60, 0x00, 0x03, 0x18, 0x61, 0x00,
+	0x07, 0xF0, 0x7F, 0x80, 0x0F, 0xE0, 0x3F, 0xC0, 0x0C, 0x00, 0x00, 0xC0, 0x18, 0x07, 0x80, 0xE0,
+	0x1C, 0x0F, 0xC0, 0x60, 0x1E, 0x18, 0x61, 0xE0, 0x06, 0x30, 0x31, 0x80, 0x06, 0x30, 0x31, 0x80,
+	0x06, 0x30, 0x31, 0x00, 0x06, 0x30, 0x31, 0x80, 0x1E, 0x18, 0x61, 0xC0, 0x18, 0x1F, 0xE0, 0xE0,
+	0x1C, 0x07, 0x80, 0x60, 0x0C, 0x00, 0x00, 0xC0, 0x0F, 0xF0, 0x1F, 0xC0, 0x07, 0xF8, 0x3F, 0x80,
+	0x02, 0x18, 0x63, 0x00, 0x00, 0x18, 0x60, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 33, 30 pixels wide */
+	0xFE, 0x06, 0x0B, 0x2A, 0x13, 0x24, 0x07, 0x06, 0x07, 0x20, 0x05, 0x0E, 0x03, 0x20, 0x03, 0x34,
+	0x03, 0x16, 0x03, 0x1A, 0x03, 0x14, 0x07, 0x18, 0x03, 0x12, 0x0B, 0x16, 0x03, 0x10, 0x0F, 0x14,
+	0x03, 0x10, 0x03, 0x00, 0x03, 0x00, 0x05, 0x12, 0x03, 0x10, 0x01, 0x02, 0x03, 0x02, 0x03, 0x12,
+	0x03, 0x16, 0x03, 0x1A, 0x03, 0x16, 0x03, 0x14, 0x01, 0x02, 0x03, 0x02, 0x01, 0x10, 0x03, 0x12,
+	0x05, 0x00, 0x03, 0x00, 0x03, 0x10, 0x03, 0x14, 0x0F, 0x10, 0x03, 0x16, 0x0B, 0x12, 0x03, 0x18,
+	0x07, 0x14, 0x03, 0x1A, 0x03, 0x16, 0x03, 0x34, 0x03, 0x22, 0x01, 0x0E, 0x05, 0x20, 0x07, 0x06,
+	0x07, 0x24, 0x13, 0x2A, 0x0B, 0x8E,
+	/* icon 34, 30 pixels wide */
+	0xFE, 0x46, 0x03, 0x36, 0x03, 0x36, 0x03, 0x36, 0x03, 0x36, 0x03, 0x36, 0x03, 0x36, 0x03, 0x36,
+	0x03, 0x36, 0x03, 0x36, 0x03, 0x36, 0x03, 0x36, 0x03, 0x2E, 0x05, 0x00, 0x03, 0x00, 0x05, 0x28,
+	0x0F, 0x2C, 0x0B, 0x30, 0x07, 0x0E, 0x01, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x22,
+	0x03, 0x0E, 0x03, 0x22, 0x03, 0x0E, 0x03, 0x22, 0x03, 0x0E, 0x2B, 0x10, 0x27, 0xBC,
+	/* icon 35, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0C, 0xC0, 0x3E, 0x00,
+	0x0C, 0xC0, 0x37, 0x00, 0x0C, 0xC0, 0x33, 0xC0, 0x0C, 0xFF, 0xF0, 0xC0, 0x0C, 0x7F, 0xE0, 0xC0,
+	0x0C, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0xC0,
+	0x0C, 0xFF, 0xFC, 0xC0, 0x0C, 0xFF, 0xFC, 0xC0, 0x0D, 0xC0, 0x0E, 0xC0, 0x0D, 0xC0, 0x0E, 0xC0,
+	0x0D, 0xC0, 0x0E, 0xC0, 0x0D, 0xC0, 0x0E, 0xC0, 0x0D, 0xC0, 0x0E, 0xC0, 0x0D, 0xC0, 0x0E, 0xC0,
+	0x0D, 0xC0, 0x0E, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 36, 30 pixels wide */
+	0xFE, 0x10, 0x09, 0x2C, 0x0F, 0x26, 0x07, 0x02, 0x05, 0x28, 0x03, 0x06, 0x03, 0x28, 0x05, 0x04,
+	0x03, 0x08, 0x01, 0x1E, 0x03, 0x04, 0x03, 0x08, 0x05, 0x1C, 0x03, 0x02, 0x03, 0x08, 0x07, 0x1A,
+	0x05, 0x02, 0x03, 0x06, 0x09, 0x1C, 0x03, 0x02, 0x05, 0x02, 0x03, 0x02, 0x03, 0x1C, 0x03, 0x04,
+	0x09, 0x04, 0x03, 0x1A, 0x05, 0x06, 0x05, 0x04, 0x03, 0x1A, 0x05, 0x14, 0x03, 0x18, 0x05, 0x14,
+	0x03, 0x18, 0x05, 0x08, 0x11, 0x16, 0x05, 0x08, 0x0F, 0x18, 0x05, 0x08, 0x05, 0x02, 0x01, 0x1C,
+	0x05, 0x08, 0x05, 0x22, 0x05, 0x08, 0x05, 0x22, 0x05, 0x08, 0x05, 0x24, 0x03, 0x08, 0x05, 0x26,
+	0x03, 0x06, 0x05, 0x28, 0x05, 0x02, 0x05, 0x2C, 0x0B, 0x30, 0x07, 0xA0,
+	/* icon 37, 30 pixels wide */
+	0xC0, 0x11, 0x26, 0x17, 0x20, 0x05, 0x0A, 0x09, 0x1E, 0x03, 0x0E, 0x09, 0x1C, 0x03, 0x0E, 0x03,
+	0x00, 0x05, 0x1A, 0x03, 0x0E, 0x03, 0x02, 0x05, 0x18, 0x03, 0x0E, 0x03, 0x04, 0x05, 0x16, 0x03,
+	0x0E, 0x03, 0x06, 0x05, 0x14, 0x03, 0x0E, 0x05, 0x04, 0x05, 0x14, 0x03, 0x10, 0x11, 0x12, 0x03,
+	0x12, 0x0F, 0x12, 0x03, 0x1E, 0x03, 0x12, 0x03, 0x1E, 0x03, 0x12, 0x03, 0x1E, 0x03, 0x12, 0x03,
+	0x1E, 0x03, 0x12, 0x03, 0x1E, 0x03, 0x12, 0x03, 0x1E, 0x03, 0x12, 0x03, 0x1E, 0x03, 0x12, 0x03,
+	0x1E, 0x03, 0x12, 0x03, 0x1E, 0x03, 0x12, 0x03, 0x1E, 0x03, 0x12, 0x03, 0x1E, 0x03, 0x12, 0x03,
+	0x1E, 0x03, 0x12, 0x05, 0x1A, 0x05, 0x14, 0x23, 0x18, 0x1F, 0x48,
+	/* icon 38, 30 pixels wide */
+	0xFE, 0x6E, 0x0F, 0x28, 0x13, 0x24, 0x05, 0x0A, 0x05, 0x22, 0x03, 0x0E, 0x1B, 0x0A, 0x03, 0x10,
+	0x1B, 0x08, 0x03, 0x0C, 0x07, 0x12, 0x05, 0x06, 0x15, 0x18, 0x03, 0x06, 0x13, 0x1A, 0x03, 0x06,
+	0x05, 0x28, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06,
+	0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06,
+	0x03, 0x2A, 0x03, 0x06, 0x05, 0x26, 0x05, 0x08, 0x2F, 0x0C, 0x2B, 0xF6,
+	/* icon 39, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1C, 0xE0, 0x00, 0x00, 0x38, 0x78, 0x00,
+	0x00, 0xE0, 0x1C, 0x00, 0x01, 0xC0, 0x0E, 0x00, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x03, 0x80,
+	0x0E, 0x00, 0x01, 0xC0, 0x0C, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0xC0,
+	0x0C, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0xC0, 0x0C, 0x0F, 0xC0, 0xC0, 0x0C, 0x1F, 0xE0, 0xC0,
+	0x0C, 0x18, 0x60, 0xC0, 0x0C, 0x18, 0x60, 0xC0, 0x0C, 0x18, 0x60, 0xC0, 0x0C, 0x18, 0x60, 0xC0,
+	0x0C, 0x18, 0x60, 0xC0, 0x0C, 0x18, 0x60, 0xC0, 0x0F, 0xF8, 0x7F, 0xC0, 0x0F, 0xF8, 0x7F, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 40, 30 pixels wide */
+	0xCC, 0x07, 0x2E, 0x0F, 0x28, 0x05, 0x06, 0x05, 0x26, 0x03, 0x0A, 0x03, 0x24, 0x03, 0x0E, 0x03,
+	0x22, 0x03, 0x0E, 0x03, 0x22, 0x03, 0x0E, 0x03, 0x22, 0x03, 0x0E, 0x03, 0x22, 0x03, 0x0E, 0x03,
+	0x24, 0x03, 0x0A, 0x03, 0x26, 0x07, 0x02, 0x07, 0x28, 0x0F, 0x2E, 0x07, 0x9C, 0x23, 0x14, 0x27,
+	0x12, 0x03, 0x1E, 0x03, 0x12, 0x03, 0x1E, 0x03, 0x12, 0x03, 0x1E, 0x03, 0x12, 0x05, 0x1A, 0x05,
+	0x14, 0x05, 0x16, 0x05, 0x18, 0x05, 0x12, 0x05, 0x1C, 0x1B, 0x22, 0x13, 0x8A,
+	/* icon 41, 30 pixels wide */
+	0xFE, 0x9C, 0x01, 0x36, 0x03, 0x34, 0x03, 0x34, 0x03, 0x34, 0x03, 0x34, 0x03, 0x34, 0x03, 0x34,
+	0x03, 0x34, 0x03, 0x34, 0x03, 0x16, 0x03, 0x18, 0x03, 0x18, 0x05, 0x14, 0x03, 0x1C, 0x05, 0x10,
+	0x03, 0x20, 0x05, 0x0C, 0x03, 0x24, 0x05, 0x08, 0x03, 0x28, 0x05, 0x04, 0x03, 0x2C, 0x0B, 0x30,
+	0x07, 0x34, 0x03, 0xFE, 0x50,
+	/* icon 42, 30 pixels wide */
+	0xFE, 0x32, 0x03, 0x22, 0x03, 0x10, 0x03, 0x1E, 0x03, 0x14, 0x03, 0x1A, 0x03, 0x18, 0x03, 0x16,
+	0x03, 0x1C, 0x03, 0x12, 0x03, 0x20, 0x03, 0x0E, 0x03, 0x24, 0x03, 0x0A, 0x03, 0x28, 0x03, 0x06,
+	0x03, 0x2C, 0x03, 0x02, 0x03, 0x30, 0x07, 0x32, 0x07, 0x32, 0x07, 0x30, 0x03, 0x02, 0x03, 0x2C,
+	0x03, 0x06, 0x03, 0x28, 0x03, 0x0A, 0x03, 0x24, 0x03, 0x0E, 0x03, 0x20, 0x03, 0x12, 0x03, 0x1C,
+	0x03, 0x16, 0x03, 0x18, 0x03, 0x1A, 0x03, 0x14, 0x03, 0x1E, 0x03, 0x10, 0x03, 0x22, 0x03, 0xF6,
+	/* icon 43, 30 pixels wide */
+	0xFE, 0x08, 0x07, 0x30, 0x0B, 0x2E, 0x03, 0x02, 0x03, 0x2C, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06,
+	0x03, 0x28, 0x03, 0x0A, 0x03, 0x26, 0x03, 0x0A, 0x03, 0x24, 0x03, 0x04, 0x03, 0x04, 0x03, 0x20,
+	0x05, 0x04, 0x03, 0x04, 0x05, 0x1E, 0x03, 0x06, 0x03, 0x06, 0x03, 0x1C, 0x05, 0x06, 0x03, 0x06,
+	0x05, 0x1A, 0x03, 0x08, 0x03, 0x08, 0x03, 0x18, 0x05, 0x08, 0x03, 0x08, 0x05, 0x16, 0x03, 0x0A,
+	0x03, 0x0A, 0x03, 0x14, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x12, 0x03, 0x1E, 0x03, 0x10, 0x03, 0x22,
+	0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0C, 0x03, 0x10, 0x03, 0x10, 0x03, 0x0A, 0x03, 0x26,
+	0x03, 0x0A, 0x03, 0x26, 0x03, 0x0A, 0x2F, 0x0C, 0x2B, 0xBA,
+	/* icon 44, 30 pixels wide */
+	0xCA, 0x0B, 0x28, 0x17, 0x20, 0x07, 0x0A, 0x07, 0x1A, 0x07, 0x12, 0x07, 0x14, 0x05, 0x1A, 0x05,
+	0x12, 0x03, 0x1E, 0x03, 0x10, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x03,
+	0x0C, 0x03, 0x10, 0x03, 0x10, 0x03, 0x0A, 0x03, 0x10, 0x03, 0x10, 0x03, 0x0A, 0x03, 0x10, 0x03,
+	0x10, 0x03, 0x0A, 0x01, 0x12, 0x03, 0x12, 0x01, 0x08, 0x03, 0x12, 0x03, 0x12, 0x03, 0x06, 0x03,
+	0x12, 0x03, 0x12, 0x01, 0x0A, 0x03, 0x10, 0x03, 0x10, 0x03, 0x0A, 0x03, 0x26, 0x03, 0x0A, 0x03,
+	0x26, 0x03, 0x0A, 0x05, 0x0E, 0x03, 0x0E, 0x05, 0x0C, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0E, 0x05,
+	0x1E, 0x05, 0x10, 0x05, 0x1A, 0x05, 0x14, 0x05, 0x16, 0x05, 0x18, 0x07, 0x0E, 0x07, 0x1E, 0x17,
+	0x26, 0x0F, 0x8C,
+	/* icon 45, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+	0x00, 0x7F, 0xF8, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x07, 0x00, 0x03, 0x80,
+	0x06, 0x00, 0x01, 0x80, 0x0C, 0x07, 0x80, 0xC0, 0x0C, 0x0F, 0xC0, 0xC0, 0x18, 0x1C, 0xE0, 0x60,
+	0x18, 0x18, 0x60, 0x60, 0x18, 0x08, 0x60, 0x60, 0x10, 0x00, 0xC0, 0x20, 0x30, 0x01, 0xC0, 0x30,
+	0x30, 0x03, 0x80, 0x20, 0x18, 0x03, 0x00, 0x60, 0x18, 0x03, 0x00, 0x60, 0x18, 0x00, 0x00, 0x60,
+	0x1C, 0x00, 0x00, 0xE0, 0x0C, 0x03, 0x00, 0xC0, 0x0E, 0x03, 0x01, 0xC0, 0x07, 0x00, 0x03, 0x80,
+	0x03, 0x80, 0x07, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 46, 30 pixels wide */
+	0xCA, 0x0B, 0x28, 0x17, 0x20, 0x07, 0x0A, 0x07, 0x1A, 0x07, 0x12, 0x07, 0x14, 0x05, 0x1A, 0x05,
+	0x12, 0x03, 0x1E, 0x03, 0x10, 0x03, 0x22, 0x03, 0x0E, 0x03, 0x22, 0x03, 0x0C, 0x03, 0x26, 0x03,
+	0x0A, 0x03, 0x02, 0x1F, 0x02, 0x03, 0x0A, 0x03, 0x02, 0x1F, 0x02, 0x03, 0x0A, 0x01, 0x04, 0x03,
+	0x16, 0x03, 0x04, 0x01, 0x08, 0x03, 0x04, 0x03, 0x16, 0x03, 0x04, 0x03, 0x06, 0x03, 0x04, 0x03,
+	0x16, 0x03, 0x04, 0x01, 0x0A, 0x03, 0x02, 0x1F, 0x02, 0x03, 0x0A, 0x03, 0x04, 0x1B, 0x04, 0x03,
+	0x0A, 0x03, 0x26, 0x03, 0x0A, 0x05, 0x22, 0x05, 0x0C, 0x03, 0x22, 0x03, 0x0E, 0x05, 0x1E, 0x05,
+	0x10, 0x05, 0x1A, 0x05, 0x14, 0x05, 0x16, 0x05, 0x18, 0x07, 0x0E, 0x07, 0x1E, 0x17, 0x26, 0x0F,
+	0x8C,
+	/* icon 47, 30 pixels wide */
+	0xCE, 0x01, 0x36, 0x05, 0x32, 0x09, 0x2E, 0x05, 0x00, 0x03, 0x2C, 0x05, 0x02, 0x03, 0x2C, 0x03,
+	0x04, 0x03, 0x2A, 0x03, 0x04, 0x03, 0x2A, 0x05, 0x04, 0x03, 0x28, 0x05, 0x06, 0x0F, 0x1C, 0x03,
+	0x08, 0x13, 0x16, 0x03, 0x1A, 0x03, 0x16, 0x03, 0x1A, 0x03, 0x16, 0x01, 0x1C, 0x03, 0x16, 0x01,
+	0x1C, 0x03, 0x16, 0x01, 0x1C, 0x03, 0x16, 0x01, 0x1C, 0x03, 0x16, 0x01, 0x1C, 0x03, 0x16, 0x03,
+	0x1A, 0x03, 0x16, 0x03, 0x1A, 0x03, 0x16, 0x03, 0x18, 0x03, 0x1A, 0x03, 0x16, 0x03, 0x1A, 0x07,
+	0x10, 0x05, 0x1C, 0x1B, 0x22, 0x15, 0xC4,
+	/* icon 48, 30 pixels wide */
+	0xC8, 0x0F, 0x26, 0x17, 0x1E, 0x07, 0x0E, 0x07, 0x18, 0x05, 0x16, 0x05, 0x14, 0x05, 0x1A, 0x05,
+	0x10, 0x05, 0x0A, 0x03, 0x0E, 0x05, 0x0E, 0x03, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x05, 0x0C, 0x03,
+	0x10, 0x05, 0x0A, 0x03, 0x0E, 0x03, 0x12, 0x03, 0x0A, 0x03, 0x0E, 0x03, 0x12, 0x03, 0x0A, 0x03,
+	0x0E, 0x03, 0x12, 0x03, 0x08, 0x03, 0x10, 0x03, 0x14, 0x01, 0x08, 0x03, 0x10, 0x03, 0x14, 0x03,
+	0x08, 0x01, 0x12, 0x03, 0x12, 0x01, 0x0A, 0x03, 0x12, 0x03, 0x0E, 0x03, 0x0A, 0x03, 0x14, 0x03,
+	0x0C, 0x03, 0x0A, 0x03, 0x16, 0x01, 0x0C, 0x03, 0x0C, 0x03, 0x22, 0x03, 0x0E, 0x03, 0x22, 0x03,
+	0x10, 0x03, 0x1E, 0x03, 0x12, 0x05, 0x1A, 0x05, 0x14, 0x07, 0x12, 0x07, 0x1A, 0x07, 0x0A, 0x07,
+	0x20, 0x17, 0x28, 0x0B, 0x8E,
+	/* icon 49, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x40, 0x1C, 0x00, 0x00, 0xE0, 0x0C, 0x1F, 0xE0, 0xC0,
+	0x00, 0x3F, 0xF0, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0xE0, 0x1C, 0x00, 0x01, 0xC0, 0x0E, 0x00,
+	0x01, 0x80, 0x06, 0x00, 0x03, 0x80, 0x07, 0x00, 0xF3, 0x00, 0x03, 0x3C, 0x63, 0x00, 0x03, 0x18,
+	0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x80, 0x06, 0x00, 0x01, 0x80, 0x06, 0x00,
+	0x00, 0xC0, 0x0C, 0x00, 0x0C, 0xE0, 0x1C, 0xC0, 0x1C, 0x60, 0x18, 0xE0, 0x18, 0x30, 0x30, 0x60,
+	0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+	0x00, 0x18, 0x60, 0x00, 0x00, 0x18, 0x60, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 50, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x30,
+	0x00, 0x3F, 0xF0, 0x60, 0x00, 0x70, 0x38, 0xC0, 0x00, 0xE0, 0x01, 0x80, 0x01, 0xC0, 0x03, 0x00,
+	0x01, 0x80, 0x06, 0x00, 0x03, 0x80, 0x0F, 0x00, 0x03, 0x00, 0x1B, 0x00, 0x03, 0x00, 0x33, 0x00,
+	0x03, 0x00, 0x63, 0x00, 0x03, 0x00, 0xC3, 0x00, 0x01, 0x81, 0x86, 0x00, 0x01, 0x83, 0x06, 0x00,
+	0x00, 0xC6, 0x0C, 0x00, 0x00, 0x0C, 0x1C, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x30, 0x38, 0x00,
+	0x00, 0x70, 0x30, 0x00, 0x00, 0xF0, 0x30, 0x00, 0x01, 0xBF, 0xF0, 0x00, 0x03, 0x3F, 0xF0, 0x00,
+	0x06, 0x18, 0x60, 0x00, 0x0C, 0x18, 0x60, 0x00, 0x18, 0x1F, 0xE0, 0x00, 0x10, 0x0F, 0xC0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 51, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+	0x00, 0x1C, 0xE0, 0x00, 0x00, 0x18, 0x60, 0x00, 0x00, 0x18, 0x60, 0x00, 0x00, 0x18, 0x78, 0x00,
+	0x00, 0x18, 0x78, 0x00, 0x00, 0x18, 0x60, 0x00, 0x00, 0x18, 0x78, 0x00, 0x00, 0x1B, 0x78, 0x00,
+	0x00, 0x1B, 0x60, 0x00, 0x00, 0x1B, 0x78, 0x00, 0x00, 0x1B, 0x78, 0x00, 0x00, 0x1B, 0x70, 0x00,
+	0x00, 0x1B, 0x60, 0x00, 0x00, 0x1B, 0x60, 0x00, 0x00, 0x3B, 0x70, 0x00, 0x00, 0x77, 0xB8, 0x00,
+	0x00, 0x6F, 0xD8, 0x00, 0x00, 0x6F, 0xD8, 0x00, 0x00, 0x6F, 0xD8, 0x00, 0x00, 0x6F, 0xD8, 0x00,
+	0x00, 0x67, 0x98, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 52, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x07, 0xC0, 0x00, 0x78, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x60, 0x00, 0xCC, 0x00, 0x60,
+	0x01, 0x8E, 0x00, 0x60, 0x03, 0x86, 0x01, 0xE0, 0x03, 0x03, 0x01, 0xE0, 0x07, 0x03, 0x00, 0x60,
+	0x07, 0xFF, 0x80, 0x60, 0x0F, 0xFF, 0xC0, 0x60, 0x0C, 0x00, 0xC0, 0xE0, 0x0C, 0x00, 0xC1, 0xE0,
+	0x18, 0x00, 0xE0, 0x60, 0x18, 0x00, 0x60, 0x60, 0x18, 0x00, 0x60, 0x60, 0x18, 0x00, 0x60, 0xE0,
+	0x18, 0x00, 0x61, 0xE0, 0x0C, 0x00, 0xC0, 0xE0, 0x0C, 0x01, 0xC0, 0x60, 0x07, 0x03, 0x80, 0x60,
+	0x03, 0x8F, 0x00, 0xE0, 0x01, 0xFE, 0x07, 0xC0, 0x00, 0x78, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 53, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x73, 0x38, 0x00,
+	0x00, 0x63, 0x38, 0x00, 0x00, 0xC3, 0x3C, 0x00, 0x01, 0xC3, 0xBE, 0x00, 0x01, 0x81, 0xF6, 0x00,
+	0x03, 0x00, 0xE3, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x03, 0x80, 0x06, 0x03, 0x01, 0x80,
+	0x06, 0x07, 0x81, 0x80, 0x06, 0x0F, 0xC1, 0x80, 0x06, 0x1C, 0xE1, 0x80, 0x06, 0x18, 0x61, 0x80,
+	0x06, 0x38, 0x71, 0x80, 0x03, 0x30, 0x33, 0x00, 0x03, 0x30, 0x33, 0x00, 0x01, 0xB0, 0x36, 0x00,
+	0x01, 0xF0, 0x3E, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 54, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x38, 0x70, 0x00,
+	0x00, 0x70, 0x38, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00, 0x60, 0x18, 0x00,
+	0x00, 0x60, 0x18, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00,
+	0x00, 0xF0, 0x3C, 0x00, 0x01, 0xC0, 0x0E, 0x00, 0x03, 0x80, 0x07, 0x00, 0x03, 0x03, 0x03, 0x00,
+	0x03, 0x07, 0x83, 0x00, 0x06, 0x0F, 0xC1, 0x80, 0x06, 0x0F, 0xC1, 0x80, 0x06, 0x0F, 0xC1, 0x80,
+	0x06, 0x07, 0x81, 0x80, 0x06, 0x03, 0x01, 0x80, 0x06, 0x03, 0x01, 0x80, 0x03, 0x03, 0x03, 0x00,
+	0x03, 0x83, 0x07, 0x00, 0x01, 0x80, 0x06, 0x00, 0x00, 0xE0, 0x1C, 0x00, 0x00, 0x78, 0x78, 0x00,
+	0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00,
+	/* icon 55, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x38, 0x70, 0x00,
+	0x00, 0x70, 0x38, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00, 0x60, 0x18, 0x00,
+	0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00,
+	0x00, 0xF0, 0x3C, 0x00, 0x01, 0xC0, 0x0E, 0x00, 0x03, 0x80, 0x07, 0x00, 0x03, 0x03, 0x03, 0x00,
+	0x03, 0x07, 0x83, 0x00, 0x06, 0x0F, 0xC1, 0x80, 0x06, 0x0F, 0xC1, 0x80, 0x06, 0x0F, 0xC1, 0x80,
+	0x06, 0x07, 0x81, 0x80, 0x06, 0x03, 0x01, 0x80, 0x06, 0x03, 0x01, 0x80, 0x03, 0x03, 0x03, 0x00,
+	0x03, 0x83, 0x07, 0x00, 0x01, 0x80, 0x06, 0x00, 0x00, 0xE0, 0x1C, 0x00, 0x00, 0x78, 0x78, 0x00,
+	0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00,
+	/* icon 56, 30 pixels wide */
+	0xFE, 0x05, 0x0E, 0x05, 0x18, 0x0F, 0x06, 0x0F, 0x10, 0x07, 0x04, 0x05, 0x02, 0x05, 0x04, 0x07,
+	0x0E, 0x03, 0x0A, 0x0B, 0x0A, 0x03, 0x0C, 0x03, 0x0E, 0x07, 0x0E, 0x03, 0x0A, 0x03, 0x10, 0x03,
+	0x10, 0x03, 0x08, 0x03, 0x2A, 0x01, 0x08, 0x03, 0x2A, 0x03, 0x08, 0x03, 0x26, 0x03, 0x0A, 0x03,
+	0x26, 0x03, 0x0A, 0x05, 0x22, 0x05, 0x0C, 0x05, 0x1E, 0x05, 0x10, 0x03, 0x1E, 0x03, 0x14, 0x03,
+	0x1A, 0x03, 0x16, 0x05, 0x16, 0x05, 0x18, 0x05, 0x12, 0x05, 0x1C, 0x05, 0x0E, 0x05, 0x20, 0x05,
+	0x0A, 0x05, 0x26, 0x05, 0x02, 0x07, 0x2A, 0x0B, 0x30, 0x07, 0x34, 0x03, 0xFE, 0x0A,
+	/* icon 57, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00,
+	0x00, 0xC3, 0x0C, 0x00, 0x00, 0xC3, 0x0C, 0x00, 0x01, 0xC3, 0x0E, 0x00, 0x07, 0x83, 0x07, 0x80,
+	0x0E, 0x1B, 0x61, 0xC0, 0x1C, 0x1B, 0x60, 0xE0, 0x18, 0x7B, 0x78, 0x60, 0x18, 0x63, 0x18, 0x60,
+	0x10, 0x03, 0x00, 0x30, 0x1B, 0xE3, 0x1F, 0x60, 0x1F, 0xF3, 0x3F, 0xE0, 0x1C, 0x33, 0x30, 0xE0,
+	0x0C, 0x03, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x18, 0xE3, 0x1C, 0x60, 0x18, 0xF3, 0x3C, 0x60,
+	0x0C, 0x33, 0x30, 0xC0, 0x0C, 0x3B, 0x70, 0xC0, 0x07, 0x13, 0x23, 0x80, 0x03, 0xC3, 0x0F, 0x80,
+	0x01, 0xC3, 0x0E, 0x00, 0x00, 0xC3, 0x0C, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 58, 30 pixels wide */
+	0xFE, 0x80, 0x07, 0x2C, 0x13, 0x22, 0x09, 0x06, 0x09, 0x1C, 0x07, 0x10, 0x05, 0x18, 0x05, 0x02,
+	0x0F, 0x02, 0x07, 0x10, 0x07, 0x00, 0x17, 0x02, 0x05, 0x08, 0x09, 0x04, 0x05, 0x0A, 0x05, 0x04,
+	0x09, 0x02, 0x07, 0x26, 0x07, 0x48, 0x23, 0x16, 0x21, 0x0E, 0x05, 0x2A, 0x05, 0x02, 0x09, 0x04,
+	0x03, 0x0E, 0x03, 0x04, 0x09, 0x08, 0x05, 0x02, 0x17, 0x02, 0x05, 0x10, 0x07, 0x02, 0x11, 0x02,
+	0x05, 0x16, 0x05, 0x12, 0x07, 0x1A, 0x07, 0x0A, 0x07, 0x22, 0x15, 0x28, 0x0B, 0xFE, 0x42,
+	/* icon 59, 30 pixels wide */
+	0xFE, 0x7A, 0x13, 0x20, 0x0D, 0x02, 0x0D, 0x18, 0x07, 0x12, 0x07, 0x14, 0x05, 0x1A, 0x05, 0x10,
+	0x05, 0x1E, 0x05, 0x0C, 0x03, 0x0C, 0x0B, 0x0A, 0x05, 0x08, 0x05, 0x0A, 0x0F, 0x0A, 0x05, 0x04,
+	0x05, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x05, 0x02, 0x03, 0x0A, 0x05, 0x0A, 0x05, 0x0A, 0x03, 0x00,
+	0x05, 0x0A, 0x03, 0x0E, 0x03, 0x0A, 0x09, 0x0C, 0x03, 0x0E, 0x03, 0x0C, 0x07, 0x0C, 0x03, 0x0E,
+	0x03, 0x0C, 0x03, 0x10, 0x03, 0x0E, 0x03, 0x24, 0x03, 0x0A, 0x03, 0x26, 0x07, 0x02, 0x07, 0x28,
+	0x0F, 0x2E, 0x07, 0xFE, 0xBC,
+	/* icon 60, 30 pixels wide */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x3F, 0xE3, 0x80, 0x01, 0xFC, 0xE7, 0x00,
+	0x03, 0xC0, 0x0F, 0x00, 0x07, 0x00, 0x1F, 0x80, 0x1E, 0x00, 0x39, 0xC0, 0x1C, 0x0E, 0x70, 0xE0,
+	0x38, 0x1C, 0xF0, 0x70, 0x70, 0x31, 0xF0, 0x38, 0x60, 0x73, 0xB8, 0x18, 0xE0, 0x67, 0x18, 0x1C,
+	0xC0, 0x4E, 0x18, 0x0C, 0xC0, 0x1C, 0x18, 0x0C, 0x00, 0x38, 0x18, 0x00, 0x00, 0x70, 0x30, 0x00,
+	0x00, 0xFC, 0xF0, 0x00, 0x01, 0xDF, 0xE0, 0x00, 0x03, 0x87, 0x80, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x0E, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* icon 61, 30 pixels wide */
+	0xFE, 0x42, 0x0B, 0x2A, 0x13, 0x24, 0x05, 0x0A, 0x05, 0x20, 0x05, 0x0E, 0x05, 0x1C, 0x05, 0x12,
+	0x05, 0x1A, 0x03, 0x16, 0x03, 0x18, 0x03, 0x1A, 0x03, 0x16, 0x03, 0x1A, 0x03, 0x12, 0x07, 0x1A,
+	0x07, 0x0A, 0x0B, 0x1A, 0x0B, 0x04, 0x05, 0x2A, 0x05, 0x00, 0x05, 0x2E, 0x09, 0x32, 0x07, 0x32,
+	0x07, 0x32, 0x07, 0x32, 0x03, 0x00, 0x03, 0x2E, 0x03, 0x02, 0x07, 0x26, 0x07, 0x04, 0x33, 0xFE,
+	0x6A,
+	/* icon 62, 30 pixels wide */
+	0xCE, 0x03, 0x36, 0x03, 0x36, 0x03, 0x26, 0x03, 0x1A, 0x03, 0x16, 0x05, 0x16, 0x05, 0x18, 0x03,
+	0x06, 0x07, 0x06, 0x03, 0x22, 0x0F, 0x28, 0x05, 0x06, 0x05, 0x24, 0x05, 0x0A, 0x05, 0x22, 0x03,
+	0x0E, 0x03, 0x20, 0x03, 0x12, 0x03, 0x14, 0x05, 0x02, 0x03, 0x12, 0x03, 0x02, 0x05, 0x0A, 0x05,
+	0x02, 0x03, 0x12, 0x03, 0x02, 0x05, 0x14, 0x03, 0x12, 0x03, 0x20, 0x03, 0x0E, 0x03, 0x22, 0x05,
+	0x0A, 0x05, 0x24, 0x05, 0x06, 0x05, 0x28, 0x0F, 0x22, 0x03, 0x06, 0x07, 0x06, 0x03, 0x18, 0x05,
+	0x16, 0x05, 0x16, 0x03, 0x1A, 0x03, 0x26, 0x03, 0x36, 0x03, 0x36, 0x03, 0xCE,
+	/* icon 63, 30 pixels wide */
+	0xFE, 0x06, 0x0B, 0x2A, 0x13, 0x24, 0x05, 0x0A, 0x05, 0x22, 0x03, 0x0E, 0x03, 0x20, 0x03, 0x12,
+	0x03, 0x1E, 0x03, 0x12, 0x03, 0x1C, 0x05, 0x12, 0x05, 0x14, 0x09, 0x14, 0x0B, 0x0C, 0x0B, 0x16,
+	0x0B, 0x08, 0x05, 0x26, 0x05, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x03, 0x2A,
+	0x03, 0x06, 0x03, 0x2A, 0x03, 0x06, 0x05, 0x26, 0x05, 0x08, 0x2F, 0x0C, 0x2B, 0x14, 0x03, 0x08,
+	0x03, 0x06, 0x05, 0x1A, 0x03, 0x06, 0x05, 0x06, 0x05, 0x18, 0x03, 0x08, 0x03, 0x08, 0x03, 0x18,
+	0x05, 0x06, 0x03, 0x08, 0x03, 0x1A, 0x03, 0x08, 0x03, 0x08, 0x03, 0xFE, 0x00,
+};
+
+static const font_pack_glyph_t icon_pack_30_glyphs[] = {
+	{30, 0, 0},
+	{30, 0, 71},
+	{30, 0, 166},
+	{30, 0, 261},
+	{30, 0, 356},
+	{30, 0, 451},
+	{30, 1, 540},
+	{30, 1, 660},
+	{30, 1, 780},
+	{30, 0, 900},
+	{30, 0, 1005},
+	{30, 0, 1097},
+	{30, 0, 1114},
+	{30, 0, 1141},
+	{30, 0, 1183},
+	{30, 0, 1248},
+	{30, 0, 1347},
+	{30, 0, 1434},
+	{30, 1, 1542},
+	{30, 0, 1662},
+	{30, 0, 1764},
+	{30, 0, 1820},
+	{30, 0, 1883},
+	{30, 0, 1975},
+	{30, 0, 2067},
+	{30, 1, 2160},
+	{30, 0, 2280},
+	{30, 1, 2350},
+	{30, 1, 2470},
+	{30, 1, 2590},
+	{30, 1, 2710},
+	{30, 0, 2830},
+	{30, 1, 2940},
+	{30, 0, 3060},
+	{30, 0, 3162},
+	{30, 1, 3224},
+	{30, 0, 3344},
+	{30, 0, 3452},
+	{30, 0, 3559},
+	{30, 1, 3635},
+	{30, 0, 3755},
+	{30, 0, 3832},
+	{30, 0, 3885},
+	{30, 0, 3965},
+	{30, 0, 4071},
+	{30, 1, 4186},
+	{30, 0, 4306},
+	{30, 0, 4419},
+	{30, 0, 4506},
+	{30, 1, 4623},
+	{30, 1, 4743},
+	{30, 1, 4863},
+	{30, 1, 4983},
+	{30, 1, 5103},
+	{30, 1, 5223},
+	{30, 1, 5343},
+	{30, 0, 5463},
+	{30, 1, 5557},
+	{30, 0, 5677},
+	{30, 0, 5756},
+	{30, 1, 5841},
+	{30, 0, 5961},
+	{30, 0, 6026},
+	{30, 0, 6119},
+};
+
+static const font_pack_range_t icon_pack_30_ranges[] = {
+	{0, 64, 0},
+};
+
+/*==================[external data definition]===============================*/
+const font_pack_t font_pack_22 = {
+	22,
+	1,
+	1,
+	font_pack_22_ranges,
+	font_pack_22_glyphs,
+	font_pack_22_data
+};
+
+const font_pack_t font_pack_30 = {
+	30,
+	1,
+	1,
+	font_pack_30_ranges,
+	font_pack_30_glyphs,
+	font_pack_30_data
+};
+
+const font_pack_t font_pack_30_aa = {
+	30,
+	4,
+	1,
+	font_pack_30_aa_ranges,
+	font_pack_30_aa_glyphs,
+	font_pack_30_aa_data
+};
+
+const font_pack_t font_pack_59_digits = {
+	59,
+	1,
+	2,
+	font_pack_59_digits_ranges,
+	font_pack_59_digits_glyphs,
+	font_pack_59_digits_data
+};
+
+const font_pack_t font_pack_89_digits = {
+	89,
+	1,
+	2,
+	font_pack_89_digits_ranges,
+	font_pack_89_digits_glyphs,
+	font_pack_89_digits_data
+};
+
+const font_pack_t icon_pack_30 = {
+	30,
+	1,
+	1,
+	icon_pack_30_ranges,
+	icon_pack_30_glyphs,
+	icon_pack_30_data
+};
+
+/*==================[end of file]============================================*/
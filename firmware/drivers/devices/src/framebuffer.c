@@ -0,0 +1,447 @@
+/**
+ * @file framebuffer.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "framebuffer.h"
+#include "raster.h"
+/*==================[macros and definitions]=================================*/
+#define MSK_BIT8	0x80		/*!< 8th bit mask */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief RGB565 color to display byte order (and back)
+ */
+static inline uint16_t Swap(uint16_t color){
+	return (uint16_t)((color >> 8) | (color << 8));
+}
+
+static uint32_t Area(const fb_rect_t *r){
+	return (uint32_t)(r->x1 - r->x0 + 1) * (uint32_t)(r->y1 - r->y0 + 1);
+}
+
+static fb_rect_t Union(const fb_rect_t *a, const fb_rect_t *b){
+	fb_rect_t u = {
+		.x0 = a->x0 < b->x0 ? a->x0 : b->x0,
+		.y0 = a->y0 < b->y0 ? a->y0 : b->y0,
+		.x1 = a->x1 > b->x1 ? a->x1 : b->x1,
+		.y1 = a->y1 > b->y1 ? a->y1 : b->y1,
+	};
+	return u;
+}
+
+/**
+ * @brief Intersect r with clip, false if nothing is left
+ */
+static bool Clip(const fb_rect_t *clip, fb_rect_t *r){
+	if(r->x0 < clip->x0){
+		r->x0 = clip->x0;
+	}
+	if(r->y0 < clip->y0){
+		r->y0 = clip->y0;
+	}
+	if(r->x1 > clip->x1){
+		r->x1 = clip->x1;
+	}
+	if(r->y1 > clip->y1){
+		r->y1 = clip->y1;
+	}
+	return r->x0 <= r->x1 && r->y0 <= r->y1;
+}
+
+static fb_rect_t Rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+	fb_rect_t r = {
+		.x0 = x0 < x1 ? x0 : x1,
+		.y0 = y0 < y1 ? y0 : y1,
+		.x1 = x0 < x1 ? x1 : x0,
+		.y1 = y0 < y1 ? y1 : y0,
+	};
+	return r;
+}
+
+static void RemoveDirty(fb_t *fb, uint8_t i){
+	fb->dirty[i] = fb->dirty[--fb->n_dirty];
+}
+
+/**
+ * @brief Add a dirty rectangle, merging it while the union does not cost more
+ * pixels than sending both. When the list is full it is merged with the one
+ * that grows the least.
+ */
+static void AddDirty(fb_t *fb, fb_rect_t r){
+	bool merged;
+	do{
+		merged = false;
+		for(uint8_t i = 0; i < fb->n_dirty; i++){
+			fb_rect_t u = Union(&fb->dirty[i], &r);
+			if(Area(&u) <= Area(&fb->dirty[i]) + Area(&r)){
+				RemoveDirty(fb, i);
+				r = u;
+				fb->stats.merges++;
+				merged = true;
+				break;
+			}
+		}
+		if(!merged && fb->n_dirty == FB_DIRTY_MAX){
+			uint8_t best = 0;
+			uint32_t best_growth = UINT32_MAX;
+			for(uint8_t i = 0; i < fb->n_dirty; i++){
+				fb_rect_t u = Union(&fb->dirty[i], &r);
+				uint32_t growth = Area(&u) - Area(&fb->dirty[i]);
+				if(growth < best_growth){
+					best_growth = growth;
+					best = i;
+				}
+			}
+			r = Union(&fb->dirty[best], &r);
+			RemoveDirty(fb, best);
+			fb->stats.merges++;
+			merged = true;
+		}
+	} while(merged);
+	fb->dirty[fb->n_dirty++] = r;
+}
+
+/**
+ * @brief Pixel of the active buffer at (x, y), inside the area
+ */
+static uint16_t * Pixels(fb_t *fb, int16_t x, int16_t y){
+	/* The buffer may still be on its way to the display */
+	if(fb->pending[fb->active]){
+		fb->stats.waits++;
+		FbWait(fb);
+	}
+	return &fb->pixels[(y - fb->area.y0) * fb->stride + (x - fb->area.x0)];
+}
+
+/**
+ * @brief Record the rectangle touched by a drawing function and clip it to
+ * the area of the active buffer
+ *
+ * @return Pixel of the buffer at the top left corner of r, NULL if r is not
+ * in the area
+ */
+static uint16_t * Touch(fb_t *fb, fb_rect_t *r){
+	if(!fb->rendering){
+		FbInvalidate(fb, r->x0, r->y0, r->x1, r->y1);
+	}
+	if(!Clip(&fb->area, r)){
+		return NULL;
+	}
+	return Pixels(fb, r->x0, r->y0);
+}
+
+/**
+ * @brief Fill function of the rasteriser, the rectangles are inside the area
+ */
+static void RasterFill(const fb_rect_t *rect, uint16_t color, uint8_t alpha, void *param){
+	fb_t *fb = param;
+	uint16_t *row = Pixels(fb, rect->x0, rect->y0);
+	uint16_t width = rect->x1 - rect->x0 + 1;
+	color = Swap(color);
+	for(int16_t y = rect->y0; y <= rect->y1; y++){
+		if(alpha == RASTER_OPAQUE){
+			for(uint16_t i = 0; i < width; i++){
+				row[i] = color;
+			}
+		}
+		else{
+			for(uint16_t i = 0; i < width; i++){
+				row[i] = Swap(RasterBlend(Swap(color), Swap(row[i]), alpha));
+			}
+		}
+		row += fb->stride;
+	}
+}
+
+/**
+ * @brief Record the box of a primitive and prepare a rasteriser for the area
+ *
+ * @return false if nothing can be drawn now (strip mode outside FbRender())
+ */
+static bool RasterBegin(fb_t *fb, raster_t *raster, int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+	if(!fb->rendering){
+		FbInvalidate(fb, x0, y0, x1, y1);
+	}
+	if(fb->area.x0 > fb->area.x1){
+		return false;
+	}
+	RasterInit(raster, &fb->area, RasterFill, fb);
+	return true;
+}
+
+static void Flush(fb_t *fb, const fb_rect_t *area, const uint16_t *pixels, uint16_t stride){
+	fb->stats.flushes++;
+	fb->stats.pixels += Area(area);
+	fb->config.flush_p(area, pixels, stride, fb->config.param_p);
+	fb->pending[fb->active] = fb->config.wait_p != NULL;
+}
+/*==================[external functions definition]==========================*/
+bool FbInit(fb_t *fb, const fb_config_t *config){
+	if(config == NULL || config->width == 0 || config->height == 0 || config->buffers[0] == NULL ||
+	   config->buffer_pixels < config->width || config->flush_p == NULL){
+		return false;
+	}
+	memset(fb, 0, sizeof(fb_t));
+	fb->config = *config;
+	fb->full = config->buffer_pixels >= (uint32_t)config->width * config->height;
+	if(fb->full){
+		fb->area = Rect(0, 0, config->width - 1, config->height - 1);
+		fb->pixels = config->buffers[0];
+		fb->stride = config->width;
+	}
+	else{
+		/* Nothing is drawn outside FbRender() */
+		fb->area.x1 = fb->area.y1 = -1;
+	}
+	FbInvalidate(fb, 0, 0, config->width - 1, config->height - 1);
+	return true;
+}
+
+void FbInvalidate(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+	fb_rect_t r = Rect(x0, y0, x1, y1);
+	fb_rect_t screen = Rect(0, 0, fb->config.width - 1, fb->config.height - 1);
+	if(fb->rendering || !Clip(&screen, &r)){
+		return;
+	}
+	AddDirty(fb, r);
+}
+
+void FbRender(fb_t *fb, fb_draw_t draw_p, void *param){
+	if(fb->full){
+		if(draw_p != NULL){
+			draw_p(fb, param);
+		}
+		if(fb->n_dirty > 0){
+			fb->stats.frames++;
+		}
+		for(uint8_t i = 0; i < fb->n_dirty; i++){
+			fb_rect_t *d = &fb->dirty[i];
+			Flush(fb, d, &fb->pixels[d->y0 * fb->stride + d->x0], fb->stride);
+		}
+		fb->n_dirty = 0;
+		return;
+	}
+	if(fb->n_dirty == 0){
+		return;
+	}
+	fb->stats.frames++;
+	fb->rendering = true;
+	for(uint8_t i = 0; i < fb->n_dirty; i++){
+		fb_rect_t *d = &fb->dirty[i];
+		uint16_t width = d->x1 - d->x0 + 1;
+		uint32_t fit = fb->config.buffer_pixels / width;
+		int16_t rows = d->y1 - d->y0 + 1;
+		/* Clamped first, a narrow rectangle may fit more rows than an int16_t holds */
+		if(fit < (uint32_t)rows){
+			rows = fit;
+		}
+		for(int16_t y = d->y0; y <= d->y1; y += rows){
+			if(fb->pending[fb->active]){
+				fb->stats.waits++;
+				FbWait(fb);
+			}
+			fb->area = Rect(d->x0, y, d->x1, (y + rows - 1 < d->y1) ? y + rows - 1 : d->y1);
+			fb->pixels = fb->config.buffers[fb->active];
+			fb->stride = width;
+			if(draw_p != NULL){
+				draw_p(fb, param);
+			}
+			Flush(fb, &fb->area, fb->pixels, fb->stride);
+			/* Draw the next strip in the other buffer while this one is sent */
+			if(fb->config.buffers[1] != NULL){
+				fb->active ^= 1;
+			}
+		}
+	}
+	fb->area.x0 = fb->area.y0 = 0;
+	fb->area.x1 = fb->area.y1 = -1;
+	fb->rendering = false;
+	fb->n_dirty = 0;
+}
+
+void FbWait(fb_t *fb){
+	if(fb->pending[0] || fb->pending[1]){
+		fb->config.wait_p(fb->config.param_p);
+		fb->pending[0] = fb->pending[1] = false;
+	}
+}
+
+void FbFill(fb_t *fb, uint16_t color){
+	FbFillRect(fb, 0, 0, fb->config.width - 1, fb->config.height - 1, color);
+}
+
+void FbDrawPixel(fb_t *fb, int16_t x, int16_t y, uint16_t color){
+	fb_rect_t r = Rect(x, y, x, y);
+	uint16_t *pixel = Touch(fb, &r);
+	if(pixel != NULL){
+		*pixel = Swap(color);
+	}
+}
+
+void FbFillRect(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	fb_rect_t r = Rect(x0, y0, x1, y1);
+	uint16_t *row = Touch(fb, &r);
+	uint16_t *first = row;
+	uint16_t width;
+	if(row == NULL){
+		return;
+	}
+	width = r.x1 - r.x0 + 1;
+	color = Swap(color);
+	for(uint16_t i = 0; i < width; i++){
+		row[i] = color;
+	}
+	for(int16_t y = r.y0 + 1; y <= r.y1; y++){
+		row += fb->stride;
+		memcpy(row, first, width * sizeof(uint16_t));
+	}
+}
+
+void FbDrawRect(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	fb_rect_t r = Rect(x0, y0, x1, y1);
+	FbFillRect(fb, r.x0, r.y0, r.x1, r.y0, color);		/* Draw top line */
+	FbFillRect(fb, r.x0, r.y1, r.x1, r.y1, color);		/* Draw bottom line */
+	FbFillRect(fb, r.x0, r.y0, r.x0, r.y1, color);		/* Draw left line */
+	FbFillRect(fb, r.x1, r.y0, r.x1, r.y1, color);		/* Draw right line */
+}
+
+void FbDrawPicture(fb_t *fb, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t *pic){
+	fb_rect_t r = Rect(x, y, x + width - 1, y + height - 1);
+	uint16_t *row = Touch(fb, &r);
+	if(row == NULL || width == 0 || height == 0){
+		return;
+	}
+	/* The picture is already in display byte order */
+	pic += ((r.y0 - y) * width + (r.x0 - x)) * 2;
+	for(int16_t i = r.y0; i <= r.y1; i++){
+		memcpy(row, pic, (r.x1 - r.x0 + 1) * sizeof(uint16_t));
+		row += fb->stride;
+		pic += width * 2;
+	}
+}
+
+void FbDrawBitmap(fb_t *fb, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t *bits,
+				  uint16_t foreground, uint16_t background){
+	fb_rect_t r = Rect(x, y, x + width - 1, y + height - 1);
+	uint16_t *row = Touch(fb, &r);
+	uint16_t bytes_row = (width + 7) / 8;
+	if(row == NULL || width == 0 || height == 0){
+		return;
+	}
+	foreground = Swap(foreground);
+	background = Swap(background);
+	bits += (r.y0 - y) * bytes_row;
+	for(int16_t i = r.y0; i <= r.y1; i++){
+		uint16_t *pixel = row;
+		for(int16_t j = r.x0 - x; j <= r.x1 - x; j++){
+			*pixel++ = (bits[j / 8] & (MSK_BIT8 >> (j % 8))) ? foreground : background;
+		}
+		row += fb->stride;
+		bits += bytes_row;
+	}
+}
+
+void FbDrawLine(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	raster_t raster;
+	if(RasterBegin(fb, &raster, x0, y0, x1, y1)){
+		RasterLine(&raster, x0, y0, x1, y1, color);
+	}
+}
+
+void FbDrawLineAA(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	raster_t raster;
+	/* The coverage may reach the next row or column */
+	fb_rect_t box = Rect(x0, y0, x1, y1);
+	if(RasterBegin(fb, &raster, box.x0 - 1, box.y0 - 1, box.x1 + 1, box.y1 + 1)){
+		RasterLineAA(&raster, x0, y0, x1, y1, color);
+	}
+}
+
+void FbDrawCircle(fb_t *fb, int16_t x0, int16_t y0, int16_t r, uint16_t color){
+	raster_t raster;
+	if(RasterBegin(fb, &raster, x0 - r, y0 - r, x0 + r, y0 + r)){
+		RasterCircle(&raster, x0, y0, r, color);
+	}
+}
+
+void FbFillCircle(fb_t *fb, int16_t x0, int16_t y0, int16_t r, uint16_t color){
+	raster_t raster;
+	if(RasterBegin(fb, &raster, x0 - r, y0 - r, x0 + r, y0 + r)){
+		RasterFillCircle(&raster, x0, y0, r, color);
+	}
+}
+
+void FbDrawTriangle(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
+	FbDrawLine(fb, x0, y0, x1, y1, color);
+	FbDrawLine(fb, x1, y1, x2, y2, color);
+	FbDrawLine(fb, x2, y2, x0, y0, color);
+}
+
+void FbFillTriangle(fb_t *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
+	fb_point_t points[] = {{x0, y0}, {x1, y1}, {x2, y2}};
+	FbFillPolygon(fb, points, 3, color);
+}
+
+void FbFillPolygon(fb_t *fb, const fb_point_t *points, uint8_t n, uint16_t color){
+	raster_t raster;
+	fb_rect_t box = Rect(points[0].x, points[0].y, points[0].x, points[0].y);
+	for(uint8_t i = 1; i < n; i++){
+		fb_rect_t point = Rect(points[i].x, points[i].y, points[i].x, points[i].y);
+		box = Union(&box, &point);
+	}
+	if(RasterBegin(fb, &raster, box.x0, box.y0, box.x1, box.y1)){
+		RasterFillPolygon(&raster, points, n, color);
+	}
+}
+
+void FbFillPolygonAA(fb_t *fb, const fb_point_t *points, uint8_t n, uint16_t color){
+	raster_t raster;
+	fb_rect_t box = Rect(points[0].x, points[0].y, points[0].x, points[0].y);
+	for(uint8_t i = 1; i < n; i++){
+		fb_rect_t point = Rect(points[i].x, points[i].y, points[i].x, points[i].y);
+		box = Union(&box, &point);
+	}
+	if(RasterBegin(fb, &raster, box.x0, box.y0, box.x1, box.y1)){
+		RasterFillPolygonAA(&raster, points, n, color);
+	}
+}
+
+bool FbWritePpm(const char *path, const uint16_t *pixels, uint16_t width, uint16_t height, uint16_t stride){
+	FILE *file = fopen(path, "wb");
+	bool ok;
+	if(file == NULL){
+		return false;
+	}
+	ok = fprintf(file, "P6\n%u %u\n255\n", width, height) > 0;
+	for(uint16_t i = 0; ok && i < height; i++){
+		for(uint16_t j = 0; ok && j < width; j++){
+			uint16_t color = Swap(pixels[i * stride + j]);
+			uint8_t rgb[3] = {
+				((color >> 11) & 0x1F) * 255 / 31,
+				((color >> 5) & 0x3F) * 255 / 63,
+				(color & 0x1F) * 255 / 31,
+			};
+			ok = fwrite(rgb, 1, sizeof(rgb), file) == sizeof(rgb);
+		}
+	}
+	return (fclose(file) == 0) && ok;
+}
+
+/*==================[end of file]============================================*/
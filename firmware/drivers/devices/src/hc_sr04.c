@@ -12,6 +12,9 @@
 /*==================[inclusions]=============================================*/
 #include "hc_sr04.h"
 #include "delay_mcu.h"
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
 /*==================[macros and definitions]=================================*/
 #define MAX_US		17700	/* maximun distance time in us (300cm or 118inch) */
 #define MAX_CM		300		/* maximun distance time in cm */
@@ -19,8 +22,15 @@
 #define US2CM		59		/* scale factor to conver pulse width to cm */
 #define US2INCH		150		/* scale factor to conver pulse width to inch */
 #define WAIT_MAX	5900	/* maximun time to wait for echo signal */
+#define TRIGGER_US	10		/* trigger pulse width */
 /*==================[internal data declaration]==============================*/
 static gpio_t echo_st, trigger_st; /**<  Stores the pin inicilization*/
+static hc_sr04_config_t async_config;               /*!< Sensors of HcSr04InitAsync() */
+static hc_sr04_ranger_t ranger;                     /*!< Slots and echoes */
+static uint8_t sensor_index[HC_SR04_MAX_SENSORS];   /*!< Parameter of each echo interrupt */
+static uint16_t last_mm[HC_SR04_MAX_SENSORS];       /*!< Last median of each sensor */
+static QueueHandle_t readings;
+static portMUX_TYPE ranger_lock = portMUX_INITIALIZER_UNLOCKED;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -28,6 +38,51 @@ static gpio_t echo_st, trigger_st; /**<  Stores the pin inicilization*/
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void IRAM_ATTR HcSr04Deliver(const hc_sr04_reading_t *reading, BaseType_t *woken){
+	if(reading->status != HC_SR04_NO_ECHO){
+		last_mm[reading->sensor] = reading->median_mm;
+	}
+	xQueueSendFromISR(readings, reading, woken);
+	if(async_config.func_p != NULL){
+		((void (*)(void*))async_config.func_p)(async_config.param_p);
+	}
+}
+
+/* Start of a slot: the timer restarts from 0, the echo edges are timed from the trigger */
+static void IRAM_ATTR HcSr04SlotIsr(void *param){
+	hc_sr04_reading_t reading;
+	BaseType_t woken = pdFALSE;
+	bool ended;
+	gpio_t trigger;
+
+	portENTER_CRITICAL_SAFE(&ranger_lock);
+	ended = HcSr04RangerSlot(&ranger, &reading);
+	trigger = async_config.sensors[ranger.current].trigger;
+	portEXIT_CRITICAL_SAFE(&ranger_lock);
+	GPIOOn(trigger);
+	DelayUs(TRIGGER_US);
+	GPIOOff(trigger);
+	if(ended){
+		HcSr04Deliver(&reading, &woken);
+	}
+	portYIELD_FROM_ISR(woken);
+}
+
+static void IRAM_ATTR HcSr04EchoIsr(void *param){
+	uint8_t sensor = *(uint8_t *)param;
+	hc_sr04_reading_t reading;
+	BaseType_t woken = pdFALSE;
+	bool ended;
+
+	portENTER_CRITICAL_SAFE(&ranger_lock);
+	ended = HcSr04RangerEdge(&ranger, sensor, GPIORead(async_config.sensors[sensor].echo),
+							 TimerRead(async_config.timer), &reading);
+	portEXIT_CRITICAL_SAFE(&ranger_lock);
+	if(ended){
+		HcSr04Deliver(&reading, &woken);
+	}
+	portYIELD_FROM_ISR(woken);
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -86,6 +141,53 @@ uint16_t HcSr04ReadDistanceInInches(void){
 	return (distance/US2INCH);
 }
 
+bool HcSr04InitAsync(const hc_sr04_config_t *config){
+	timer_config_t slots = {
+		.timer = config->timer,
+		.period = HC_SR04_MAX_ECHO_US + (config->guard_us ? config->guard_us : HC_SR04_GUARD_US),
+		.func_p = HcSr04SlotIsr,
+		.param_p = NULL,
+	};
+
+	if(!HcSr04RangerInit(&ranger, config->n_sensors, config->outlier_mm)){
+		return false;
+	}
+	async_config = *config;
+	if(readings == NULL){
+		readings = xQueueCreate(HC_SR04_QUEUE_LENGTH, sizeof(hc_sr04_reading_t));
+		if(readings == NULL){
+			return false;
+		}
+	}
+	xQueueReset(readings);
+	for(uint8_t i = 0; i < config->n_sensors; i++){
+		sensor_index[i] = i;
+		last_mm[i] = 0;
+		GPIOInit(config->sensors[i].trigger, GPIO_OUTPUT);
+		GPIOOff(config->sensors[i].trigger);
+		GPIOInit(config->sensors[i].echo, GPIO_INPUT);
+		GPIOActivIntBothEdges(config->sensors[i].echo, HcSr04EchoIsr, &sensor_index[i]);
+	}
+	/* Without the timer no sensor is ever triggered */
+	if(!TimerInit(&slots)){
+		return false;
+	}
+	TimerStart(config->timer);
+	return true;
+}
+
+bool HcSr04GetReading(hc_sr04_reading_t *reading, uint32_t wait_ms){
+	return xQueueReceive(readings, reading, pdMS_TO_TICKS(wait_ms)) == pdTRUE;
+}
+
+uint16_t HcSr04LastDistanceMm(uint8_t sensor){
+	return (sensor < HC_SR04_MAX_SENSORS) ? last_mm[sensor] : 0;
+}
+
+void HcSr04StopAsync(void){
+	TimerStop(async_config.timer);
+}
+
 bool HcSr04Deinit(void){
 	GPIODeinit();
 	return true;
@@ -0,0 +1,129 @@
+/**
+ * @file hc_sr04_ranger.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "hc_sr04_ranger.h"
+/*==================[macros and definitions]=================================*/
+#define MM_PER_CM		10
+#define MIN_HISTORY		(HC_SR04_MEDIAN / 2 + 1)	/*!< Distances of a median that outliers are checked against */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint16_t Median(const hc_sr04_history_t *history){
+	uint16_t sorted[HC_SR04_MEDIAN];
+
+	for(uint8_t i = 0; i < history->count; i++){
+		uint16_t mm = history->mm[i];
+		uint8_t j = i;
+		for(; j > 0 && sorted[j - 1] > mm; j--){
+			sorted[j] = sorted[j - 1];
+		}
+		sorted[j] = mm;
+	}
+	return sorted[history->count / 2];
+}
+
+static void Push(hc_sr04_history_t *history, uint16_t mm){
+	history->mm[history->next] = mm;
+	history->next = (history->next + 1) % HC_SR04_MEDIAN;
+	if(history->count < HC_SR04_MEDIAN){
+		history->count++;
+	}
+	history->median_mm = Median(history);
+}
+
+static void Reading(hc_sr04_ranger_t *ranger, hc_sr04_status_t status, uint32_t width_us,
+					hc_sr04_reading_t *reading){
+	hc_sr04_history_t *history = &ranger->history[ranger->current];
+	uint16_t diff;
+
+	reading->sensor = ranger->current;
+	reading->status = status;
+	reading->width_us = (width_us > UINT16_MAX) ? UINT16_MAX : width_us;
+	reading->mm = 0;
+	if(status == HC_SR04_OUT_OF_RANGE){
+		reading->mm = HcSr04EchoToMm(HC_SR04_MAX_ECHO_US);
+	}
+	else if(status == HC_SR04_OK){
+		reading->mm = HcSr04EchoToMm(width_us);
+		diff = (reading->mm > history->median_mm) ? reading->mm - history->median_mm : history->median_mm - reading->mm;
+		if(ranger->outlier_mm != 0 && history->count >= MIN_HISTORY && diff > ranger->outlier_mm){
+			reading->status = HC_SR04_OUTLIER;
+		}
+		/* Also the outliers, the median follows a target that really moved */
+		Push(history, reading->mm);
+	}
+	reading->median_mm = history->median_mm;
+	ranger->active = false;
+}
+
+/*==================[external functions definition]==========================*/
+bool HcSr04RangerInit(hc_sr04_ranger_t *ranger, uint8_t n_sensors, uint16_t outlier_mm){
+	if(n_sensors == 0 || n_sensors > HC_SR04_MAX_SENSORS){
+		return false;
+	}
+	ranger->n_sensors = n_sensors;
+	ranger->current = n_sensors - 1;
+	ranger->active = false;
+	ranger->rising = false;
+	ranger->outlier_mm = outlier_mm;
+	for(uint8_t i = 0; i < n_sensors; i++){
+		ranger->history[i].count = 0;
+		ranger->history[i].next = 0;
+		ranger->history[i].median_mm = 0;
+	}
+	return true;
+}
+
+bool HcSr04RangerSlot(hc_sr04_ranger_t *ranger, hc_sr04_reading_t *reading){
+	bool ended = ranger->active;
+
+	if(ended){
+		Reading(ranger, ranger->rising ? HC_SR04_OUT_OF_RANGE : HC_SR04_NO_ECHO, 0, reading);
+	}
+	ranger->current = (ranger->current + 1) % ranger->n_sensors;
+	ranger->active = true;
+	ranger->rising = false;
+	return ended;
+}
+
+bool HcSr04RangerEdge(hc_sr04_ranger_t *ranger, uint8_t sensor, bool level, uint32_t time_us,
+					  hc_sr04_reading_t *reading){
+	uint32_t width_us;
+
+	if(!ranger->active || sensor != ranger->current){
+		return false;
+	}
+	if(level){
+		ranger->rising = true;
+		ranger->rise_us = time_us;
+		return false;
+	}
+	/* An echo that started before the slot */
+	if(!ranger->rising){
+		return false;
+	}
+	width_us = time_us - ranger->rise_us;
+	Reading(ranger, (width_us > HC_SR04_MAX_ECHO_US) ? HC_SR04_OUT_OF_RANGE : HC_SR04_OK, width_us, reading);
+	return true;
+}
+
+uint16_t HcSr04EchoToMm(uint32_t width_us){
+	return width_us * MM_PER_CM / HC_SR04_US_PER_CM;
+}
+
+/*==================[end of file]============================================*/
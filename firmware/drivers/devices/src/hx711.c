@@ -7,11 +7,14 @@
 
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "hx711.h"
 
 #include <delay_mcu.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
 
 /*==================[macros and definitions]=================================*/
 
@@ -24,6 +27,8 @@ float SCALE;	                 /*!<  Used to return weight in grams, kg, ounces,
 gpio_t internal_pd_sck;
 gpio_t internal_dout;
 
+static portMUX_TYPE hx711_lock = portMUX_INITIALIZER_UNLOCKED;	/*!< Filters of the interrupt driven HX711 */
+
 /*==================[internal functions declaration]=========================*/
 
 uint8_t shiftIn(void)
@@ -42,6 +47,41 @@ uint8_t shiftIn(void)
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/* Falling edge of DOUT: clocks the sample out. PD_SCK must not stay high
+ * over 60 us (power down), so nothing interrupts it. */
+static void IRAM_ATTR HX711_isr(void *param)
+{
+	hx711_t *hx711 = param;
+	uint32_t raw = 0;
+	uint8_t i;
+
+	/* Checked in the critical section: also called from HX711_InitAsync(), the
+	   interrupt may read the conversion between the check and the pulses */
+	portENTER_CRITICAL_SAFE(&hx711_lock);
+	/* DOUT goes high after the last pulse, the edges while clocking out end here */
+	if(GPIORead(hx711->config.dout))
+	{
+		portEXIT_CRITICAL_SAFE(&hx711_lock);
+		return;
+	}
+	for(i = 0; i < HX711_DATA_BITS; i++)
+	{
+		GPIOOn(hx711->config.pd_sck);
+		GPIOOff(hx711->config.pd_sck);
+		raw = raw << 1 | GPIORead(hx711->config.dout);
+	}
+	for(; i < hx711->pulses; i++)
+	{
+		GPIOOn(hx711->config.pd_sck);
+		GPIOOff(hx711->config.pd_sck);
+	}
+	Hx711FilterPush(&hx711->filter, Hx711Decode(raw), (uint32_t)esp_timer_get_time());
+	portEXIT_CRITICAL_SAFE(&hx711_lock);
+	if(hx711->config.func_p != NULL)
+	{
+		((void (*)(void*))hx711->config.func_p)(hx711->config.param_p);
+	}
+}
 
 /*==================[external functions definition]==========================*/
 void HX711_Init(uint8_t gain, gpio_t pd_sck, gpio_t dout)
@@ -173,4 +213,76 @@ void HX711_powerUp(void)
 	GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
 }
 
+bool HX711_InitAsync(hx711_t *hx711, const hx711_config_t *config)
+{
+	hx711->pulses = Hx711Pulses(config->gain);
+	if(hx711->pulses == 0 || !Hx711FilterInit(&hx711->filter, config->window))
+	{
+		return false;
+	}
+	hx711->config = *config;
+	GPIOInit(config->pd_sck, GPIO_OUTPUT);
+	GPIOInit(config->dout, GPIO_INPUT);
+	GPIOOff(config->pd_sck);
+	GPIOActivInt(config->dout, HX711_isr, false, hx711);
+	/* A conversion ready before the interrupt had no edge */
+	HX711_isr(hx711);
+	return true;
+}
+
+void HX711_setGainAsync(hx711_t *hx711, uint8_t gain)
+{
+	uint8_t pulses = Hx711Pulses(gain);
+	if(pulses != 0)
+	{
+		hx711->pulses = pulses;
+	}
+}
+
+bool HX711_readAsync(hx711_t *hx711, hx711_sample_t *sample)
+{
+	bool ready;
+	portENTER_CRITICAL_SAFE(&hx711_lock);
+	ready = Hx711FilterLast(&hx711->filter, sample);
+	portEXIT_CRITICAL_SAFE(&hx711_lock);
+	return ready;
+}
+
+uint32_t HX711_countAsync(hx711_t *hx711)
+{
+	return hx711->filter.total;
+}
+
+int32_t HX711_averageAsync(hx711_t *hx711)
+{
+	int32_t average;
+	portENTER_CRITICAL_SAFE(&hx711_lock);
+	average = Hx711FilterAverage(&hx711->filter);
+	portEXIT_CRITICAL_SAFE(&hx711_lock);
+	return average;
+}
+
+void HX711_tareAsync(hx711_t *hx711)
+{
+	portENTER_CRITICAL_SAFE(&hx711_lock);
+	Hx711FilterTare(&hx711->filter);
+	portEXIT_CRITICAL_SAFE(&hx711_lock);
+}
+
+void HX711_setScaleAsync(hx711_t *hx711, float scale)
+{
+	portENTER_CRITICAL_SAFE(&hx711_lock);
+	Hx711FilterSetScale(&hx711->filter, scale);
+	portEXIT_CRITICAL_SAFE(&hx711_lock);
+}
+
+float HX711_getUnitsAsync(hx711_t *hx711)
+{
+	float units;
+	portENTER_CRITICAL_SAFE(&hx711_lock);
+	units = Hx711FilterUnits(&hx711->filter);
+	portEXIT_CRITICAL_SAFE(&hx711_lock);
+	return units;
+}
+
 
@@ -0,0 +1,114 @@
+/**
+ * @file hx711_filter.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "hx711_filter.h"
+/*==================[macros and definitions]=================================*/
+#define RING_MASK		(HX711_RING_SIZE - 1)
+#define SIGN_BIT		(1UL << (HX711_DATA_BITS - 1))
+#define DATA_MASK		((1UL << HX711_DATA_BITS) - 1)
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int32_t Hx711Decode(uint32_t raw){
+	return (int32_t)((raw & DATA_MASK) ^ SIGN_BIT) - (int32_t)SIGN_BIT;
+}
+
+uint8_t Hx711Pulses(uint8_t gain){
+	switch(gain){
+	case 128:
+		return HX711_DATA_BITS + 1;
+	case 32:
+		return HX711_DATA_BITS + 2;
+	case 64:
+		return HX711_DATA_BITS + 3;
+	default:
+		return 0;
+	}
+}
+
+bool Hx711FilterInit(hx711_filter_t *filter, uint8_t window){
+	if(window == 0 || window > HX711_RING_SIZE){
+		return false;
+	}
+	filter->head = 0;
+	filter->count = 0;
+	filter->window = window;
+	filter->sum = 0;
+	filter->total = 0;
+	filter->offset = 0;
+	filter->scale = 1.0f;
+	filter->inv_scale = 1.0f;
+	return true;
+}
+
+void Hx711FilterPush(hx711_filter_t *filter, int32_t value, uint32_t time_us){
+	uint8_t head = filter->head;
+
+	/* The sample that leaves the window is still in the ring, even if it is the one overwritten */
+	if(filter->count >= filter->window){
+		filter->sum -= filter->samples[(head - filter->window) & RING_MASK].value;
+	}
+	filter->samples[head].value = value;
+	filter->samples[head].time_us = time_us;
+	filter->sum += value;
+	filter->head = (head + 1) & RING_MASK;
+	if(filter->count < HX711_RING_SIZE){
+		filter->count++;
+	}
+	filter->total++;
+}
+
+bool Hx711FilterLast(const hx711_filter_t *filter, hx711_sample_t *sample){
+	if(filter->count == 0){
+		return false;
+	}
+	*sample = filter->samples[(filter->head - 1) & RING_MASK];
+	return true;
+}
+
+int32_t Hx711FilterAverage(const hx711_filter_t *filter){
+	uint8_t n = (filter->count < filter->window) ? filter->count : filter->window;
+
+	if(n == 0){
+		return 0;
+	}
+	return (int32_t)(filter->sum / n);
+}
+
+void Hx711FilterTare(hx711_filter_t *filter){
+	filter->offset = Hx711FilterAverage(filter);
+}
+
+void Hx711FilterSetOffset(hx711_filter_t *filter, int32_t offset){
+	filter->offset = offset;
+}
+
+void Hx711FilterSetScale(hx711_filter_t *filter, float scale){
+	if(scale != 0.0f){
+		filter->scale = scale;
+		filter->inv_scale = 1.0f / scale;
+	}
+}
+
+float Hx711FilterUnits(const hx711_filter_t *filter){
+	return (float)(Hx711FilterAverage(filter) - filter->offset) * filter->inv_scale;
+}
+
+/*==================[end of file]============================================*/
@@ -15,6 +15,9 @@
 #include "spi_mcu.h"
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
+#include "raster.h"
+#include "text.h"
+#include "format_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define NULL 0
 
@@ -23,10 +26,8 @@
 #define MSK_BIT16 0x8000			/*!< 16th bit mask */
 #define MSK_BIT8 0x80				/*!< 8th bit mask */
 #define MAX_VALUE_SIZE 256			/*!< Maximum length of a data array to prevent excessive use of memory */
-#define LEFT -1						/*!< Horizontal grow direction */
-#define RIGHT 1						/*!< Horizontal grow direction */
-#define DOWN 1						/*!< Vertical grow direction */
-#define UP -1						/*!< Vertical grow direction */
+#define MIN_ROW_TRANSFER 128		/*!< Narrower framebuffer rows are packed before sending */
+#define GLYPH_CACHE_PIXELS 8192		/*!< Glyph cache size (16 KB), about 25 digits of font_30 */
 
 /* Command List */
 #define RESET				0x01 	/*!< Resets the commands and parameters to their S/W Reset default values */
@@ -185,6 +186,12 @@ spi_mcu_config_t spi_conf = {
 static spi_dev_t ili9341_spi;				/*!< uC SPI port */
 static gpio_t ili9341_dc, ili9341_rst;		/*!< uC GPIO ports to use as CS, DC and RST */
 
+static uint8_t fb_rows[SPI_MAX_TRANSFER];	/*!< Packed rows of narrow framebuffer areas */
+
+static uint16_t glyph_cache[GLYPH_CACHE_PIXELS];		/*!< Glyphs expanded to RGB565 */
+static uint16_t text_band[SPI_MAX_TRANSFER / 2];		/*!< Rows of a text line being sent */
+static text_t lcd_text;									/*!< Text renderer of the display */
+
 static orientation_properties_t lcd_orientation = {
 		ILI9341_WIDTH,
 		ILI9341_HEIGHT,
@@ -194,7 +201,8 @@ static orientation_properties_t lcd_orientation = {
 /*==================[internal functions definition]==========================*/
 
 void WriteLCD(lcd_cmd_t * data){
-	SpiInit(&spi_conf);
+	/* Queued pixel writes of the framebuffer must end before a new command */
+	SpiWaitAsync(ili9341_spi);
 	/* If command is NULL don't send command */
 	if (data->cmd != NULL){
 		/* Send command */
@@ -267,12 +275,67 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	WriteLCD(&lcd_pixel);
 }
 
+/**
+ * @brief Fill function of the rasteriser, anti-aliased spans are mixed with
+ * the background color
+ */
+static void RasterFill(const fb_rect_t *rect, uint16_t color, uint8_t alpha, void *param){
+	if (alpha != RASTER_OPAQUE){
+		color = RasterBlend(color, *(uint16_t *)param, alpha);
+	}
+	Fill(rect->x0, rect->y0, rect->x1, rect->y1, color);
+}
+
+static void ScreenRaster(raster_t *raster, uint16_t *background){
+	fb_rect_t screen = {0, 0, lcd_orientation.width - 1, lcd_orientation.height - 1};
+	RasterInit(raster, &screen, RasterFill, background);
+}
+
+/**
+ * @brief Window function of the text renderer
+ */
+static void TextWindow(const fb_rect_t *area, void *param){
+	SetCursorPosition(area->x0, area->y0, area->x1, area->y1);
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	WriteLCD(&lcd_write);
+}
+
+/**
+ * @brief Write function of the text renderer, the band is already in display byte order
+ */
+static void TextWrite(const uint16_t *pixels, uint32_t count, void *param){
+	lcd_cmd_t lcd_pixels = {NULL, count * 2, (uint8_t *)pixels};
+	WriteLCD(&lcd_pixels);
+}
+
+/**
+ * @brief Text renderer of the current orientation (the cache is emptied when it changes)
+ */
+static text_t * ScreenText(void){
+	if (lcd_text.config.width != lcd_orientation.width || lcd_text.config.height != lcd_orientation.height){
+		text_config_t config = {
+			.width = lcd_orientation.width,
+			.height = lcd_orientation.height,
+			.cache = glyph_cache,
+			.cache_pixels = GLYPH_CACHE_PIXELS,
+			.band = text_band,
+			.band_pixels = SPI_MAX_TRANSFER / 2,
+			.window_p = TextWindow,
+			.write_p = TextWrite,
+			.param_p = NULL
+		};
+		TextInit(&lcd_text, &config);
+	}
+	return &lcd_text;
+}
+
 /*==================[external functions definition]==========================*/
 
 uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 	/* SPI configuration */
 	spi_conf.device = spi_dev;
 	ili9341_spi = spi_dev;
+	SpiInit(&spi_conf);
 	/* GPIOs configuration and initialization */
 	ili9341_dc = gpio_dc;
 	ili9341_rst = gpio_rst;
@@ -350,65 +413,14 @@ void ILI9341Rotate(ili9341_orientation_t orientation){
 }
 
 void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
-	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
-
-	/* Set coordinates */
-	lcd_x = x;
-	lcd_y = y;
+	char str[] = {data, '\0'};
 
 	/* If at the end of a line of display, go to new line and set x to 0 position */
-	if ((lcd_x + font->info[data - ' '].width) > lcd_orientation.width)	{
-		lcd_y += font->font_height;
-		lcd_x = 0;
+	if ((x + font->info[data - ' '].width) > lcd_orientation.width)	{
+		y += font->font_height;
+		x = 0;
 	}
-
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + font->info[data - ' '].width - 1, lcd_y + font->font_height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = font->font_height * font->info[data - ' '].width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < font->font_height; i++)	{
-		/* */
-		char_row = font->info[data - ' '].offset + i * ((font->info[data - ' '].width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < font->info[data - ' '].width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
-		}
-	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	TextDraw(ScreenText(), x, y, str, font, foreground, background);
 }
 
 void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background){
@@ -474,22 +486,22 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 }
 
 void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint16_t i;
-	static uint16_t lcd_x, lcd_y;
-
-	/* Set coordinates */
-	lcd_x = x;
-	lcd_y = y;
+	text_field_t field;
+	char digits[FORMAT_MAX_LEN + TEXT_FIELD_MAX];
 
-	for (i=0; i<dig; i++){
-		lcd_x = x + font->info[num%10 + '0' - ' '].width * (dig-1-i) + 1;
-		ILI9341DrawChar(lcd_x, lcd_y, num%10 + '0', font, foreground, background);
-		num = num/10;
+	/* The last dig digits, zero padded, in fixed cells: one window */
+	if (TextFieldInit(&field, x, y, dig, font, foreground, background)){
+		FormatU32(digits, num, dig, '0');
+		TextFieldDraw(ScreenText(), &field, digits);
 	}
 }
 
-void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background){
+/* Lines of a string, each one in one window, in a font or a packed font */
+static void DrawLines(uint16_t x, uint16_t y, const char* str, const Font_t *font, const font_pack_t *pack,
+					  uint16_t foreground, uint16_t background){
 	static uint16_t lcd_x, lcd_y;
+	uint16_t height = pack ? pack->height : font->font_height;
+	uint16_t drawn;
 
 	/* Set coordinates */
 	lcd_x = x;
@@ -498,7 +510,7 @@ void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t
 	while (*str != '\0'){	/* End of string */
 		/* New line */
 		if (*str == '\n'){
-			lcd_y += font->font_height + 1;
+			lcd_y += height + 1;
 			/* if after \n is also \r, than go to the left of the screen */
 			if (*(str + 1) == '\r'){
 				lcd_x = 0;
@@ -508,19 +520,61 @@ void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t
 				lcd_x = x;
 			}
 			str++;
+			continue;
 		}
 		else if (*str == '\r'){
+			str++;
+			continue;
+		}
+		/* Whole line in one window, up to the right edge */
+		if (pack){
+			drawn = TextDrawPacked(ScreenText(), lcd_x, lcd_y, str, pack, foreground, background);
+		}
+		else{
+			drawn = TextDraw(ScreenText(), lcd_x, lcd_y, str, font, foreground, background);
+		}
+		str += drawn;
+		if (*str != '\0' && *str != '\n'){
+			/* It does not fit: the rest goes to a new line, from the left of the screen */
+			if (drawn == 0 && lcd_x == 0){
 				str++;
 			}
-
-		/* Put character to LCD */
-		ILI9341DrawChar(lcd_x, lcd_y, *str, font, foreground, background);
-		lcd_x += font->info[*str - ' '].width + 1;
-		/* Next character */
-		str++;
+			lcd_y += height;
+			lcd_x = 0;
+		}
 	}
 }
 
+void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t foreground, uint16_t background){
+	DrawLines(x, y, str, font, NULL, foreground, background);
+}
+
+void ILI9341DrawPackedString(uint16_t x, uint16_t y, const char* str, const font_pack_t *font, uint16_t foreground, uint16_t background){
+	DrawLines(x, y, str, NULL, font, foreground, background);
+}
+
+void ILI9341DrawPackedIcon(uint16_t x, uint16_t y, icon_t icon, const font_pack_t *icon_font, uint16_t foreground, uint16_t background){
+	TextDrawPackedGlyph(ScreenText(), x, y, icon, icon_font, foreground, background);
+}
+
+void ILI9341FieldInit(text_field_t *field, uint16_t x, uint16_t y, uint8_t length, Font_t *font, uint16_t foreground, uint16_t background){
+	TextFieldInit(field, x, y, length, font, foreground, background);
+}
+
+void ILI9341FieldInitPacked(text_field_t *field, uint16_t x, uint16_t y, uint8_t length, const font_pack_t *font, uint16_t foreground, uint16_t background){
+	TextFieldInitPacked(field, x, y, length, font, foreground, background);
+}
+
+void ILI9341DrawField(text_field_t *field, const char *str){
+	TextFieldDraw(ScreenText(), field, str);
+}
+
+void ILI9341DrawFieldInt(text_field_t *field, int32_t num){
+	char digits[FORMAT_MAX_LEN];
+	FormatI32(digits, num, 0, ' ');
+	TextFieldDraw(ScreenText(), field, digits);
+}
+
 void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* height){
 	static uint16_t w;
 
@@ -535,68 +589,16 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
 }
 
 void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
-	static int16_t x_dist, y_dist, x_grow, y_grow, error, error_2;
-
-	/* Check for overflow */
-	if (x0 >= lcd_orientation.width){
-		x0 = lcd_orientation.width - 1;
-	}
-	if (x1 >= lcd_orientation.width){
-		x1 = lcd_orientation.width - 1;
-	}
-	if (y0 >= lcd_orientation.height){
-		y0 = lcd_orientation.height - 1;
-	}
-	if (y1 >= lcd_orientation.height){
-		y1 = lcd_orientation.height - 1;
-	}
-
-	/* Calculate x y distances and determine grow direction */
-	x_dist = x1 - x0;
-	y_dist = y1 - y0;
-	if (x0 > x1){
-		x_dist = -x_dist;
-		x_grow = LEFT;
-	}
-	else{
-		x_grow = RIGHT;
-	}
-	if (y0 > y1){
-		y_dist = -y_dist;
-		y_grow = UP;
-	}
-	else{
-		y_grow = DOWN;
-	}
+	raster_t raster;
+	/* One window per run of pixels instead of one per pixel */
+	ScreenRaster(&raster, NULL);
+	RasterLine(&raster, x0, y0, x1, y1, color);
+}
 
-	/* Vertical or horizontal line */
-	if (x_dist == 0 || y_dist == 0){
-		Fill(x0, y0, x1, y1, color);
-	}
-	/* Diagonal line */
-	else{
-		error = x_dist - y_dist;
-
-		while (1){
-			/* Draw start point */
-			ILI9341DrawPixel(x0, y0, color);
-			/* Loop ends when start point reaches end point */
-			if (x0 == x1 && y0 == y1){
-				break;
-			}
-			error_2 = 2 * error;
-			/* Determine if line must grow in x direction */
-			if (error_2 > -y_dist){
-				error -= y_dist;
-				x0 += x_grow;	/* Move start point */
-			}
-			/* Determine if line must grow in y direction */
-			if (error_2 < x_dist){
-				error += x_dist;
-				y0 += y_grow;	/* Move start point */
-			}
-		}
-	}
+void ILI9341DrawLineAA(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color, uint16_t background){
+	raster_t raster;
+	ScreenRaster(&raster, &background);
+	RasterLineAA(&raster, x0, y0, x1, y1, color);
 }
 
 void ILI9341DrawRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
@@ -611,72 +613,15 @@ void ILI9341DrawFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t
 }
 
 void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
-	static int16_t f, ddF_x, ddF_y, x, y;
-
-	f = 1 - r;
-	ddF_x = 1;
-	ddF_y = -2 * r;
-	x = 0;
-	y = r;
-
-	ILI9341DrawPixel(x0, y0 + r, color);
-	ILI9341DrawPixel(x0, y0 - r, color);
-	ILI9341DrawPixel(x0 + r, y0, color);
-	ILI9341DrawPixel(x0 - r, y0, color);
-
-    while (x < y){
-        if (f >= 0){
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
-
-        ILI9341DrawPixel(x0 + x, y0 + y, color);
-        ILI9341DrawPixel(x0 - x, y0 + y, color);
-        ILI9341DrawPixel(x0 + x, y0 - y, color);
-        ILI9341DrawPixel(x0 - x, y0 - y, color);
-
-        ILI9341DrawPixel(x0 + y, y0 + x, color);
-        ILI9341DrawPixel(x0 - y, y0 + x, color);
-        ILI9341DrawPixel(x0 + y, y0 - x, color);
-        ILI9341DrawPixel(x0 - y, y0 - x, color);
-    }
+	raster_t raster;
+	ScreenRaster(&raster, NULL);
+	RasterCircle(&raster, x0, y0, r, color);
 }
 
 void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
-	static int16_t f, ddF_x, ddF_y, x, y;
-
-	f = 1 - r;
-	ddF_x = 1;
-	ddF_y = -2 * r;
-	x = 0;
-	y = r;
-
-    ILI9341DrawPixel(x0, y0 + r, color);
-    ILI9341DrawPixel(x0, y0 - r, color);
-    ILI9341DrawPixel(x0 + r, y0, color);
-    ILI9341DrawPixel(x0 - r, y0, color);
-    ILI9341DrawLine(x0 - r, y0, x0 + r, y0, color);
-
-    while (x < y){
-        if (f >= 0){
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
-
-        ILI9341DrawLine(x0 - x, y0 + y, x0 + x, y0 + y, color);
-        ILI9341DrawLine(x0 + x, y0 - y, x0 - x, y0 - y, color);
-
-        ILI9341DrawLine(x0 + y, y0 + x, x0 - y, y0 + x, color);
-        ILI9341DrawLine(x0 + y, y0 - x, x0 - y, y0 - x, color);
-    }
+	raster_t raster;
+	ScreenRaster(&raster, NULL);
+	RasterFillCircle(&raster, x0, y0, r, color);
 }
 
 void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
@@ -686,117 +631,20 @@ void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t
 }
 
 void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
-	static int16_t x_0 = 0;
-	static int16_t y_0 = 0;
-	static int16_t x_1 = 0;
-	static int16_t y_1 = 0;
-	static int16_t x_2 = 0;
-	static int16_t y_2 = 0;
-	static int16_t x_aux = 0;
-	static int16_t y_aux = 0;
-	static int16_t scanline_y = 0;
-	float invslope1, invslope2, curx1, curx2;
-	if((y0 <= y1) && (y0 <= y2)){
-		x_0 = x0;
-		y_0 = y0;
-		if(y1 <= y2){
-			x_1 = x1;
-			y_1 = y1;
-			x_2 = x2;
-			y_2 = y2;
-		} else{
-			x_1 = x2;
-			y_1 = y2;
-			x_2 = x1;
-			y_2 = y1;
-		}
-	}else if((y1 <= y2) && (y1 <= y0)){
-		x_0 = x1;
-		y_0 = y1;
-		if(y0 <= y2){
-			x_1 = x0;
-			y_1 = y0;
-			x_2 = x2;
-			y_2 = y2;
-		} else{
-			x_1 = x2;
-			y_1 = y2;
-			x_2 = x0;
-			y_2 = y0;
-		}
-	}else if((y2 <= y1) && (y2 <= y0)){
-		x_0 = x2;
-		y_0 = y2;
-		if(y0 <= y1){
-			x_1 = x0;
-			y_1 = y0;
-			x_2 = x1;
-			y_2 = y1;
-		} else{
-			x_1 = x1;
-			y_1 = y1;
-			x_2 = x0;
-			y_2 = y0;
-		}
-	}
-	if(y_1 == y_2){
-		// Bottom flat triangle
-		invslope1 = (float)(x_1 - x_0) / (float)(y_1 - y_0);
-		invslope2 = (float)(x_2 - x_0) / (float)(y_2 - y_0);
-		curx1 = x_0;
-		curx2 = x_0;
-		scanline_y = y_0;
-		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 += invslope1;
-			curx2 += invslope2;
-			scanline_y++;
-		}
-  	}
-  	else if (y_0 == y_1){
-		// Top flat triangle
-		invslope1 = (float)(x_2 - x_0) / (float)(y_2 - y_0);
-		invslope2 = (float)(x_2 - x_1) / (float)(y_2 - y_1);
-		curx1 = x_2;
-		curx2 = x_2;
-		scanline_y = y_2;
-		while(scanline_y > y_0){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 -= invslope1;
-			curx2 -= invslope2;
-			scanline_y--;
-		}
-  	}
-  	else{
-		// Split in a flat top triangle and a bottom flat triangle
-		x_aux = (int)(x_0 + (float)(y_1 - y_0) / (float)(y_2 - y_0) * (x_2 - x_0));
-		y_aux = y_1;
-		// Bottom flat triangle
-		invslope1 = (float)(x_1 - x_0) / (float)(y_1 - y_0);
-		invslope2 = (float)(x_aux - x_0) / (float)(y_aux - y_0);
-		curx1 = x_0;
-		curx2 = x_0;
-		scanline_y = y_0;
-		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 += invslope1;
-			curx2 += invslope2;
-			scanline_y++;
-		}
-		// Top flat triangle
-		invslope1 = (float)(x_2 - x_1) / (float)(y_2 - y_1);
-		invslope2 = (float)(x_2 - x_aux) / (float)(y_2 - y_aux);
-		curx1 = x_2;
-		curx2 = x_2;
-		scanline_y = y_2;
-		while(scanline_y > y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
-			curx1 -= invslope1;
-			curx2 -= invslope2;
-			scanline_y--;
-		}
-		ILI9341DrawLine(x_1, y_1, x_aux, y_aux, color);
-  	}
+	fb_point_t points[] = {{x0, y0}, {x1, y1}, {x2, y2}};
+	ILI9341FillPolygon(points, 3, color);
+}
+
+void ILI9341FillPolygon(const fb_point_t *points, uint8_t n, uint16_t color){
+	raster_t raster;
+	ScreenRaster(&raster, NULL);
+	RasterFillPolygon(&raster, points, n, color);
+}
+
+void ILI9341FillPolygonAA(const fb_point_t *points, uint8_t n, uint16_t color, uint16_t background){
+	raster_t raster;
+	ScreenRaster(&raster, &background);
+	RasterFillPolygonAA(&raster, points, n, color);
 }
 
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
@@ -830,6 +678,61 @@ void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
 	WriteLCD(&lcd_pixel);
 }
 
+uint8_t ILI9341FbInit(fb_t *fb, uint16_t *buffer_1, uint16_t *buffer_2, uint32_t buffer_pixels){
+	fb_config_t config = {
+		.width = lcd_orientation.width,
+		.height = lcd_orientation.height,
+		.buffers = {buffer_1, buffer_2},
+		.buffer_pixels = buffer_pixels,
+		.flush_p = ILI9341FbFlush,
+		.wait_p = ILI9341FbWait,
+		.param_p = NULL
+	};
+	return FbInit(fb, &config);
+}
+
+void ILI9341FbFlush(const fb_rect_t *area, const uint16_t *pixels, uint16_t stride, void *param){
+	uint16_t width = area->x1 - area->x0 + 1;
+	uint16_t height = area->y1 - area->y0 + 1;
+	const uint8_t *data = (const uint8_t *)pixels;
+
+	SetCursorPosition(area->x0, area->y0, area->x1, area->y1);
+	/* Start writing LCD memory, the pixels follow as data */
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	WriteLCD(&lcd_write);
+	GPIOOn(ili9341_dc);
+	if (stride == width){
+		/* Contiguous rows: sent from the framebuffer in as few transfers as possible */
+		SpiWriteAsync(ili9341_spi, data, width * height * 2);
+	}
+	else if (width * 2 >= MIN_ROW_TRANSFER){
+		/* The LCD fills the window row by row, so the rows go back to back */
+		for (uint16_t i = 0; i < height; i++){
+			SpiWriteAsync(ili9341_spi, data, width * 2);
+			data += stride * 2;
+		}
+	}
+	else{
+		/* Narrow areas (e.g. vertical lines): pack the rows, one transfer for many rows */
+		uint16_t i = 0;
+		while (i < height){
+			uint32_t len = 0;
+			SpiWaitAsync(ili9341_spi);
+			for (; i < height && len + width * 2 <= SPI_MAX_TRANSFER; i++){
+				for (uint16_t j = 0; j < width * 2; j++){
+					fb_rows[len++] = data[j];
+				}
+				data += stride * 2;
+			}
+			SpiWriteAsync(ili9341_spi, fb_rows, len);
+		}
+	}
+}
+
+void ILI9341FbWait(void *param){
+	SpiWaitAsync(ili9341_spi);
+}
+
 uint8_t ILI9341DeInit(void){
 	return 0;
 }
@@ -13,12 +13,24 @@
 #include "mpu6050.h"
 #include "math.h"
 #include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 /*==================[macros and definitions]=================================*/
 #define I2C_NUM I2C_NUM_0
+#define FIFO_GYRO_RATE_HZ   1000    // gyroscope output rate with the DLPF on
+#define FIFO_MIN_RATE_HZ    4       // SMPLRT_DIV is 8 bits
+#define FIFO_INTERRUPTS     ((1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT) | (1 << MPU6050_INTERRUPT_DATA_RDY_BIT))
 
 /*==================[internal data definition]===============================*/
 uint8_t devAddr;
 uint8_t buffer[14];
+static uint8_t fifo_buffer[MPU6050_FIFO_MAX_FRAMES * MPU6050_FIFO_FRAME];  // frames of a burst
+static mpu6050_fifo_config_t fifo_config;
+static mpu6050_scale_t fifo_scale;
+static mpu6050_fifo_t fifo_counters;
+static uint16_t fifo_pending;           // data ready interrupts since the last batch
+static SemaphoreHandle_t fifo_batch;    // given every batch samples
+static i2c_device_t fifo_device;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[external functions definition]==========================*/
@@ -2766,4 +2778,109 @@ void MPU6050_setDeviceID(uint8_t id) {
     I2C_writeBits(devAddr, MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH, id);
 }
 
+// FIFO read in bursts
+
+/* Data ready (rising edge of INT, a 50 us pulse): counts the samples of the batch */
+static void IRAM_ATTR MPU6050_fifoIsr(void *param) {
+    BaseType_t woken = pdFALSE;
+
+    if(++fifo_pending >= fifo_config.batch){
+        fifo_pending = 0;
+        xSemaphoreGiveFromISR(fifo_batch, &woken);
+        if(fifo_config.func_p != NULL){
+            ((void (*)(void*))fifo_config.func_p)(fifo_config.param_p);
+        }
+    }
+    portYIELD_FROM_ISR(woken);
+}
+
+/* Disables, empties and enables the FIFO */
+static void MPU6050_fifoReset(void) {
+    I2C_writeByte(devAddr, MPU6050_RA_USER_CTRL, 1 << MPU6050_USERCTRL_FIFO_RESET_BIT);
+    I2C_writeByte(devAddr, MPU6050_RA_USER_CTRL, 1 << MPU6050_USERCTRL_FIFO_EN_BIT);
+}
+
+bool MPU6050_fifoStart(const mpu6050_fifo_config_t *config) {
+    if(config->rate_hz < FIFO_MIN_RATE_HZ || config->rate_hz > FIFO_GYRO_RATE_HZ ||
+       config->batch == 0 || config->batch > MPU6050_FIFO_MAX_FRAMES){
+        return false;
+    }
+    if(fifo_batch == NULL){
+        fifo_batch = xSemaphoreCreateBinary();
+    }
+    fifo_config = *config;
+    fifo_pending = 0;
+    fifo_counters.frames = 0;
+    fifo_counters.overflows = 0;
+    Mpu6050ScaleInit(&fifo_scale, config->accel_range, config->gyro_range);
+
+    /* A single script: SMPLRT_DIV to ACCEL_CONFIG go in one transfer */
+    uint8_t status;
+    i2c_op_t ops[] = {
+        I2C_OP_WRITE_REG(MPU6050_RA_INT_ENABLE, 0),
+        I2C_OP_WRITE_REG(MPU6050_RA_PWR_MGMT_1, MPU6050_CLOCK_PLL_XGYRO),
+        I2C_OP_WRITE_REG(MPU6050_RA_SMPLRT_DIV, FIFO_GYRO_RATE_HZ / config->rate_hz - 1),
+        I2C_OP_WRITE_REG(MPU6050_RA_CONFIG, MPU6050_DLPF_BW_188),
+        I2C_OP_WRITE_REG(MPU6050_RA_GYRO_CONFIG, config->gyro_range << (MPU6050_GCONFIG_FS_SEL_BIT - 1)),
+        I2C_OP_WRITE_REG(MPU6050_RA_ACCEL_CONFIG, config->accel_range << (MPU6050_ACONFIG_AFS_SEL_BIT - 1)),
+        I2C_OP_WRITE_REG(MPU6050_RA_FIFO_EN, MPU6050_FIFO_SOURCES),
+        /* Active high, push-pull, 50 us pulse, cleared reading INT_STATUS */
+        I2C_OP_WRITE_REG(MPU6050_RA_INT_PIN_CFG, 0),
+        I2C_OP_WRITE_REG(MPU6050_RA_USER_CTRL, 1 << MPU6050_USERCTRL_FIFO_RESET_BIT),
+        I2C_OP_WRITE_REG(MPU6050_RA_USER_CTRL, 1 << MPU6050_USERCTRL_FIFO_EN_BIT),
+        I2C_OP_READ_BYTES(MPU6050_RA_INT_STATUS, &status, 1),
+    };
+    i2c_transaction_t setup = {
+        .device = &fifo_device,
+        .ops = ops,
+        .n_ops = sizeof(ops) / sizeof(ops[0]),
+    };
+    I2cDeviceInit(&fifo_device, devAddr, true);
+    if(!I2C_run(&setup, I2C_MASTER_TIMEOUT_MS)){
+        return false;
+    }
+    xSemaphoreTake(fifo_batch, 0);
+
+    GPIOInit(config->int_pin, GPIO_INPUT);
+    GPIOActivInt(config->int_pin, MPU6050_fifoIsr, true, NULL);
+    I2C_writeByte(devAddr, MPU6050_RA_INT_ENABLE, FIFO_INTERRUPTS);
+    return true;
+}
+
+uint16_t MPU6050_fifoRead(mpu6050_samples_t *samples, uint32_t wait_ms) {
+    uint16_t count, frames, max_frames;
+    uint8_t status;
+
+    if(wait_ms > 0){
+        xSemaphoreTake(fifo_batch, pdMS_TO_TICKS(wait_ms));
+    }
+    status = MPU6050_getIntStatus();
+    count = MPU6050_getFIFOCount();
+    max_frames = (samples->size < MPU6050_FIFO_MAX_FRAMES) ? samples->size : MPU6050_FIFO_MAX_FRAMES;
+    switch(Mpu6050FifoCheck(&fifo_counters, count, status, max_frames, &frames)){
+    case MPU6050_FIFO_RESET:
+        MPU6050_fifoReset();
+        fifo_pending = 0;
+        return 0;
+    case MPU6050_FIFO_EMPTY:
+        return 0;
+    default:
+        break;
+    }
+    if(!I2C_readBurst(devAddr, MPU6050_RA_FIFO_R_W, frames * MPU6050_FIFO_FRAME, fifo_buffer)){
+        return 0;
+    }
+    return Mpu6050FifoUnpack(&fifo_counters, &fifo_scale, fifo_buffer, frames, samples, 0);
+}
+
+mpu6050_fifo_t MPU6050_fifoCounters(void) {
+    return fifo_counters;
+}
+
+void MPU6050_fifoStop(void) {
+    I2C_writeByte(devAddr, MPU6050_RA_INT_ENABLE, 0);
+    I2C_writeByte(devAddr, MPU6050_RA_USER_CTRL, 0);
+    I2C_writeByte(devAddr, MPU6050_RA_FIFO_EN, 0);
+}
+
 /*==================[end of file]============================================*/
@@ -0,0 +1,81 @@
+/**
+ * @file mpu6050_fifo.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include "mpu6050_fifo.h"
+/*==================[macros and definitions]=================================*/
+#define ACCEL_COUNTS_2G		16384.0f	/*!< Counts per g at +-2 g */
+#define GYRO_COUNTS_250		131.0f		/*!< Counts per deg/s at +-250 deg/s */
+#define TEMP_COUNTS			340.0f		/*!< Counts per C */
+#define TEMP_OFFSET			36.53f		/*!< C at 0 counts */
+#define RANGE_MASK			0x03
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static inline int16_t Word(const uint8_t *bytes){
+	return (int16_t)((bytes[0] << 8) | bytes[1]);
+}
+
+/*==================[external functions definition]==========================*/
+void Mpu6050ScaleInit(mpu6050_scale_t *scale, uint8_t accel_range, uint8_t gyro_range){
+	/* Each range doubles the one before */
+	scale->accel = (float)(1 << (accel_range & RANGE_MASK)) / ACCEL_COUNTS_2G;
+	scale->gyro = (float)(1 << (gyro_range & RANGE_MASK)) / GYRO_COUNTS_250;
+}
+
+mpu6050_fifo_action_t Mpu6050FifoCheck(mpu6050_fifo_t *fifo, uint16_t count, uint8_t int_status,
+									   uint16_t max_frames, uint16_t *frames){
+	uint16_t available = count / MPU6050_FIFO_FRAME;
+
+	/* A full FIFO drops bytes with the next sample */
+	if((int_status & MPU6050_FIFO_OFLOW_INT) || count >= MPU6050_FIFO_SIZE){
+		fifo->overflows++;
+		*frames = 0;
+		return MPU6050_FIFO_RESET;
+	}
+	*frames = (available < max_frames) ? available : max_frames;
+	return (*frames == 0) ? MPU6050_FIFO_EMPTY : MPU6050_FIFO_READ;
+}
+
+uint16_t Mpu6050FifoUnpack(mpu6050_fifo_t *fifo, const mpu6050_scale_t *scale, const uint8_t *bytes,
+						   uint16_t n_frames, mpu6050_samples_t *samples, uint16_t first){
+	const float accel = scale->accel;
+	const float gyro = scale->gyro;
+	uint16_t n;
+
+	if(first >= samples->size){
+		return 0;
+	}
+	n = (n_frames < samples->size - first) ? n_frames : samples->size - first;
+	for(uint16_t i = 0; i < n; i++, bytes += MPU6050_FIFO_FRAME){
+		uint16_t s = first + i;
+		samples->ax[s] = Word(&bytes[0]) * accel;
+		samples->ay[s] = Word(&bytes[2]) * accel;
+		samples->az[s] = Word(&bytes[4]) * accel;
+		samples->gx[s] = Word(&bytes[8]) * gyro;
+		samples->gy[s] = Word(&bytes[10]) * gyro;
+		samples->gz[s] = Word(&bytes[12]) * gyro;
+		if(samples->temp != NULL){
+			samples->temp[s] = Word(&bytes[6]) / TEMP_COUNTS + TEMP_OFFSET;
+		}
+	}
+	fifo->frames += n;
+	return n;
+}
+
+/*==================[end of file]============================================*/
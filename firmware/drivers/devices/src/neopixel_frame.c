@@ -0,0 +1,206 @@
+/**
+ * @file neopixel_frame.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "neopixel_frame.h"
+#include "ws2812b_encoder.h"
+/*==================[macros and definitions]=================================*/
+#define RED_OFFSET      16
+#define GREEN_OFFSET    8
+#define BLUE_OFFSET     0
+#define RED_BLUE_MSK	0x00FF00FF
+#define GREEN_MSK		0x0000FF00
+#define BRIGHT_OFFSET   8
+#define HUE_TURN		65536UL		/*!< Hues of a whole gradient */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void NeoPixelFrameInit(neopixel_frame_t *frame, neopixel_color_t *colors, uint16_t length){
+	frame->colors = colors;
+	frame->length = length;
+	frame->bright = NEOPIXEL_MAX_BRIGHT;
+	frame->dirty = true;
+	frame->lut_valid = false;
+}
+
+void NeoPixelFrameSetPixel(neopixel_frame_t *frame, uint16_t pixel, neopixel_color_t color){
+	if(pixel < frame->length && frame->colors[pixel] != color){
+		frame->colors[pixel] = color;
+		frame->dirty = true;
+	}
+}
+
+void NeoPixelFrameFill(neopixel_frame_t *frame, neopixel_color_t color){
+	for(uint16_t i = 0; i < frame->length; i++){
+		frame->colors[i] = color;
+	}
+	frame->dirty = true;
+}
+
+void NeoPixelFrameShift(neopixel_frame_t *frame, bool upwards){
+	neopixel_color_t *colors = frame->colors;
+	uint16_t last = frame->length - 1;
+	neopixel_color_t carry;
+
+	if(frame->length < 2){
+		return;
+	}
+	if(upwards){
+		carry = colors[last];
+		memmove(&colors[1], &colors[0], last * sizeof(neopixel_color_t));
+		colors[0] = carry;
+	}
+	else{
+		carry = colors[0];
+		memmove(&colors[0], &colors[1], last * sizeof(neopixel_color_t));
+		colors[last] = carry;
+	}
+	frame->dirty = true;
+}
+
+void NeoPixelFrameBrightness(neopixel_frame_t *frame, uint8_t bright){
+	if(bright != frame->bright){
+		frame->bright = bright;
+		frame->lut_valid = false;
+		frame->dirty = true;
+	}
+}
+
+void NeoPixelFrameRainbow(neopixel_frame_t *frame, uint16_t first_hue, uint8_t sat, uint8_t val, uint8_t reps){
+	uint32_t turn = reps * HUE_TURN;
+	uint16_t hue = first_hue;
+	uint16_t step, rest;
+	uint32_t error = 0;
+
+	if(frame->length == 0){
+		return;
+	}
+	/* hue of pixel i: first_hue + (i * reps * 65536) / length, without dividing per pixel */
+	step = turn / frame->length;
+	rest = turn % frame->length;
+	for(uint16_t i = 0; i < frame->length; i++){
+		frame->colors[i] = NeoPixelHSV2Color(hue, sat, val);
+		hue += step;
+		error += rest;
+		if(error >= frame->length){
+			error -= frame->length;
+			hue++;
+		}
+	}
+	frame->dirty = true;
+}
+
+void NeoPixelFrameFade(neopixel_frame_t *frame, uint8_t scale){
+	uint32_t s = scale + 1;
+
+	/* Red and blue scaled together, 8 bits apart */
+	for(uint16_t i = 0; i < frame->length; i++){
+		uint32_t color = frame->colors[i];
+		frame->colors[i] = (((color & RED_BLUE_MSK) * s >> BRIGHT_OFFSET) & RED_BLUE_MSK) |
+						   (((color & GREEN_MSK) * s >> BRIGHT_OFFSET) & GREEN_MSK);
+	}
+	frame->dirty = true;
+}
+
+void NeoPixelFrameEffect(neopixel_frame_t *frame, neopixel_effect_t *effect){
+	uint16_t positions;
+
+	switch(effect->type){
+	case NEOPIXEL_EFFECT_RAINBOW:
+		NeoPixelFrameRainbow(frame, effect->hue, effect->sat, effect->val, effect->reps);
+		effect->hue += effect->step;
+		break;
+	case NEOPIXEL_EFFECT_SHIFT:
+		if(frame->length == 0){
+			break;
+		}
+		positions = (effect->step < 0 ? -effect->step : effect->step) % frame->length;
+		for(uint16_t i = 0; i < positions; i++){
+			NeoPixelFrameShift(frame, effect->step > 0);
+		}
+		break;
+	case NEOPIXEL_EFFECT_FADE:
+		NeoPixelFrameFade(frame, effect->fade);
+		break;
+	}
+}
+
+const uint8_t *NeoPixelFrameLut(neopixel_frame_t *frame){
+	if(!frame->lut_valid){
+		for(uint16_t c = 0; c < 256; c++){
+			frame->lut[c] = ws2812b_gamma[(c * frame->bright) >> BRIGHT_OFFSET];
+		}
+		frame->lut_valid = true;
+	}
+	return frame->lut;
+}
+
+neopixel_color_t NeoPixelRgb2Color(uint8_t red, uint8_t green, uint8_t blue){
+	return (red << RED_OFFSET) | (green << GREEN_OFFSET) | (blue << BLUE_OFFSET);
+}
+
+neopixel_color_t NeoPixelHSV2Color(uint16_t hue, uint8_t sat, uint8_t val){
+
+  uint8_t r, g, b;
+
+  hue = (hue * 1530L + 32768) / 65536;
+  // Convert hue to R,G,B (nested ifs faster than divide+mod+switch):
+  if (hue < 510) { // Red to Green-1
+    b = 0;
+    if (hue < 255) { //   Red to Yellow-1
+      r = 255;
+      g = hue;       //     g = 0 to 254
+    } else {         //   Yellow to Green-1
+      r = 510 - hue; //     r = 255 to 1
+      g = 255;
+    }
+  } else if (hue < 1020) { // Green to Blue-1
+    r = 0;
+    if (hue < 765) { //   Green to Cyan-1
+      g = 255;
+      b = hue - 510;  //     b = 0 to 254
+    } else {          //   Cyan to Blue-1
+      g = 1020 - hue; //     g = 255 to 1
+      b = 255;
+    }
+  } else if (hue < 1530) { // Blue to Red-1
+    g = 0;
+    if (hue < 1275) { //   Blue to Magenta-1
+      r = hue - 1020; //     r = 0 to 254
+      b = 255;
+    } else { //   Magenta to Red-1
+      r = 255;
+      b = 1530 - hue; //     b = 255 to 1
+    }
+  } else { // Last 0.5 Red (quicker than % operator)
+    r = 255;
+    g = b = 0;
+  }
+
+  // Apply saturation and value to R,G,B, pack into 32-bit result:
+  uint32_t v1 = 1 + val;  // 1 to 256; allows >>8 instead of /255
+  uint16_t s1 = 1 + sat;  // 1 to 256; same reason
+  uint8_t s2 = 255 - sat; // 255 to 0
+  return ((((((r * s1) >> 8) + s2) * v1) & 0xff00) << 8) |
+         (((((g * s1) >> 8) + s2) * v1) & 0xff00) |
+         (((((b * s1) >> 8) + s2) * v1) >> 8);
+}
+
+/*==================[end of file]============================================*/
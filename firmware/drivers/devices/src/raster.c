@@ -0,0 +1,424 @@
+/**
+ * @file raster.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include "raster.h"
+/*==================[macros and definitions]=================================*/
+#define FP_SHIFT		16			/*!< Fixed point 16.16 */
+#define FP_ONE			(1L << FP_SHIFT)
+#define AA_ROWS			4			/*!< Sub-rows per pixel of the anti-aliased polygons */
+#define AA_COLS			16			/*!< Sub-columns per pixel of the anti-aliased polygons */
+#define AA_FULL			(AA_ROWS * AA_COLS)
+#define RGB565_SPREAD	0x07E0F81F	/*!< G in the high half, R and B in the low half */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static uint8_t coverage[RASTER_MAX_WIDTH];		/*!< Coverage of a row (anti-aliased polygons) */
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief The box of a primitive touches the clip rectangle
+ */
+static bool Visible(const raster_t *raster, int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+	return x1 >= raster->clip.x0 && x0 <= raster->clip.x1 && y1 >= raster->clip.y0 && y0 <= raster->clip.y1;
+}
+
+static uint32_t Sqrt(uint32_t value){
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30;
+	while(bit > value){
+		bit >>= 2;
+	}
+	while(bit != 0){
+		if(value >= root + bit){
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return root;
+}
+
+/**
+ * @brief Half width of a circle at a distance dy of the center, rounded
+ * (-1 outside the circle)
+ */
+static int16_t HalfWidth(int16_t r, int16_t dy){
+	if(dy > r){
+		return -1;
+	}
+	return Sqrt((uint32_t)r * r - (uint32_t)dy * dy + r);
+}
+
+static bool PolygonBox(const fb_point_t *points, uint8_t n, fb_rect_t *box){
+	if(n < 3 || n > RASTER_MAX_VERTICES){
+		return false;
+	}
+	box->x0 = box->x1 = points[0].x;
+	box->y0 = box->y1 = points[0].y;
+	for(uint8_t i = 1; i < n; i++){
+		if(points[i].x < box->x0){
+			box->x0 = points[i].x;
+		}
+		if(points[i].x > box->x1){
+			box->x1 = points[i].x;
+		}
+		if(points[i].y < box->y0){
+			box->y0 = points[i].y;
+		}
+		if(points[i].y > box->y1){
+			box->y1 = points[i].y;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Columns (16.16) where the edges cross the row y (16.16), sorted
+ *
+ * An edge counts from its top end to just before its bottom end, so a vertex
+ * shared by two edges is crossed once. With bottom, from just after its top
+ * end to its bottom end (last row of a polygon).
+ */
+static uint8_t Crossings(const fb_point_t *points, uint8_t n, int32_t y, bool bottom, int32_t *xs){
+	uint8_t count = 0;
+	for(uint8_t i = 0; i < n; i++){
+		const fb_point_t *a = &points[i];
+		const fb_point_t *b = &points[(i + 1) % n];
+		int32_t top, end, x;
+		if(a->y == b->y){
+			continue;
+		}
+		if(a->y > b->y){
+			const fb_point_t *aux = a;
+			a = b;
+			b = aux;
+		}
+		top = (int32_t)a->y << FP_SHIFT;
+		end = (int32_t)b->y << FP_SHIFT;
+		if(bottom ? (y <= top || y > end) : (y < top || y >= end)){
+			continue;
+		}
+		x = ((int32_t)a->x << FP_SHIFT) + (int32_t)((int64_t)(y - top) * (b->x - a->x) / (b->y - a->y));
+		/* Insertion sort, a few crossings */
+		uint8_t j = count++;
+		while(j > 0 && xs[j - 1] > x){
+			xs[j] = xs[j - 1];
+			j--;
+		}
+		xs[j] = x;
+	}
+	return count;
+}
+
+/**
+ * @brief Add a span from xa to xb (16.16) to the coverage row
+ */
+static void Cover(const raster_t *raster, int32_t xa, int32_t xb, int16_t *min, int16_t *max){
+	/* In sub-columns from the left edge of the clip rectangle */
+	int32_t origin = (int32_t)raster->clip.x0 * AA_COLS;
+	int32_t limit = ((int32_t)raster->clip.x1 + 1) * AA_COLS - origin;
+	int32_t ua = ((xa + FP_ONE / 2) >> (FP_SHIFT - 4)) - origin;
+	int32_t ub = ((xb + FP_ONE / 2) >> (FP_SHIFT - 4)) - origin;
+	int32_t pa, pb;
+	if(ua < 0){
+		ua = 0;
+	}
+	if(ub > limit){
+		ub = limit;
+	}
+	if(ua >= ub){
+		return;
+	}
+	pa = ua / AA_COLS;
+	pb = ub / AA_COLS;
+	if(pa < *min){
+		*min = pa;
+	}
+	if(pb - (ub % AA_COLS == 0) > *max){
+		*max = pb - (ub % AA_COLS == 0);
+	}
+	if(pa == pb){
+		coverage[pa] += ub - ua;
+		return;
+	}
+	coverage[pa] += AA_COLS - ua % AA_COLS;
+	for(int32_t p = pa + 1; p < pb; p++){
+		coverage[p] += AA_COLS;
+	}
+	if(ub % AA_COLS){
+		coverage[pb] += ub % AA_COLS;
+	}
+}
+/*==================[external functions definition]==========================*/
+void RasterInit(raster_t *raster, const fb_rect_t *clip, raster_fill_t fill_p, void *param){
+	memset(raster, 0, sizeof(raster_t));
+	raster->clip = *clip;
+	raster->fill_p = fill_p;
+	raster->param_p = param;
+}
+
+void RasterSpan(raster_t *raster, int16_t x0, int16_t x1, int16_t y, uint16_t color, uint8_t alpha){
+	fb_rect_t *run = &raster->run;
+	if(y < raster->clip.y0 || y > raster->clip.y1 || alpha == 0){
+		return;
+	}
+	if(x0 < raster->clip.x0){
+		x0 = raster->clip.x0;
+	}
+	if(x1 > raster->clip.x1){
+		x1 = raster->clip.x1;
+	}
+	if(x0 > x1){
+		return;
+	}
+	raster->spans++;
+	if(raster->pending && color == raster->color && alpha == raster->alpha){
+		/* Same span in the next row */
+		if(x0 == run->x0 && x1 == run->x1 && y == run->y1 + 1){
+			run->y1 = y;
+			return;
+		}
+		/* Next to it in the same row */
+		if(run->y0 == run->y1 && y == run->y0){
+			if(x0 == run->x1 + 1){
+				run->x1 = x1;
+				return;
+			}
+			if(x1 + 1 == run->x0){
+				run->x0 = x0;
+				return;
+			}
+		}
+	}
+	RasterFlush(raster);
+	run->x0 = x0;
+	run->x1 = x1;
+	run->y0 = run->y1 = y;
+	raster->color = color;
+	raster->alpha = alpha;
+	raster->pending = true;
+}
+
+void RasterFlush(raster_t *raster){
+	if(raster->pending){
+		raster->fills++;
+		raster->fill_p(&raster->run, raster->color, raster->alpha, raster->param_p);
+		raster->pending = false;
+	}
+}
+
+void RasterLine(raster_t *raster, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	int16_t dx, dy, sx, err, start;
+	/* Always downwards, so the rows come in order */
+	if(y0 > y1){
+		int16_t aux = x0;
+		x0 = x1;
+		x1 = aux;
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	if(!Visible(raster, x0 < x1 ? x0 : x1, y0, x0 < x1 ? x1 : x0, y1)){
+		return;
+	}
+	dx = abs(x1 - x0);
+	dy = -(y1 - y0);
+	sx = x0 < x1 ? 1 : -1;
+	err = dx + dy;
+	start = x0;
+	while(1){
+		int16_t e2 = 2 * err;
+		if(x0 == x1 && y0 == y1){
+			break;
+		}
+		if(e2 <= dx){
+			/* The row ends here: the pixels since start are a span */
+			RasterSpan(raster, start < x0 ? start : x0, start < x0 ? x0 : start, y0, color, RASTER_OPAQUE);
+			if(e2 >= dy){
+				err += dy;
+				x0 += sx;
+			}
+			err += dx;
+			y0++;
+			start = x0;
+			/* Past the clip rectangle nothing else is visible */
+			if(y0 > raster->clip.y1){
+				RasterFlush(raster);
+				return;
+			}
+		}
+		else{
+			err += dy;
+			x0 += sx;
+		}
+	}
+	RasterSpan(raster, start < x0 ? start : x0, start < x0 ? x0 : start, y0, color, RASTER_OPAQUE);
+	RasterFlush(raster);
+}
+
+void RasterLineAA(raster_t *raster, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	bool steep = abs(y1 - y0) > abs(x1 - x0);
+	int32_t gradient, inter;
+	int16_t aux;
+	if(!Visible(raster, (x0 < x1 ? x0 : x1) - 1, (y0 < y1 ? y0 : y1) - 1,
+				(x0 < x1 ? x1 : x0) + 1, (y0 < y1 ? y1 : y0) + 1)){
+		return;
+	}
+	/* Walk along the major axis, one or two pixels across it */
+	if(steep){
+		aux = x0; x0 = y0; y0 = aux;
+		aux = x1; x1 = y1; y1 = aux;
+	}
+	if(x0 > x1){
+		aux = x0; x0 = x1; x1 = aux;
+		aux = y0; y0 = y1; y1 = aux;
+	}
+	gradient = (x1 == x0) ? 0 : ((int32_t)(y1 - y0) << FP_SHIFT) / (x1 - x0);
+	inter = (int32_t)y0 << FP_SHIFT;
+	for(int16_t x = x0; x <= x1; x++){
+		int16_t y = inter >> FP_SHIFT;
+		uint8_t frac = (inter >> (FP_SHIFT - 8)) & 0xFF;
+		if(steep){
+			RasterSpan(raster, y, y, x, color, 255 - frac);
+			RasterSpan(raster, y + 1, y + 1, x, color, frac);
+		}
+		else{
+			RasterSpan(raster, x, x, y, color, 255 - frac);
+			RasterSpan(raster, x, x, y + 1, color, frac);
+		}
+		inter += gradient;
+	}
+	RasterFlush(raster);
+}
+
+void RasterCircle(raster_t *raster, int16_t xc, int16_t yc, int16_t r, uint16_t color){
+	if(r < 0 || !Visible(raster, xc - r, yc - r, xc + r, yc + r)){
+		return;
+	}
+	for(int16_t dy = -r; dy <= r; dy++){
+		int16_t a = abs(dy);
+		int16_t end, start;
+		if(yc + dy < raster->clip.y0 || yc + dy > raster->clip.y1){
+			continue;
+		}
+		/* From just inside the next row outwards to this row's edge */
+		end = HalfWidth(r, a);
+		start = HalfWidth(r, a + 1) + 1;
+		if(start > end){
+			start = end;
+		}
+		if(start == 0){
+			RasterSpan(raster, xc - end, xc + end, yc + dy, color, RASTER_OPAQUE);
+		}
+		else{
+			RasterSpan(raster, xc - end, xc - start, yc + dy, color, RASTER_OPAQUE);
+			RasterSpan(raster, xc + start, xc + end, yc + dy, color, RASTER_OPAQUE);
+		}
+	}
+	RasterFlush(raster);
+}
+
+void RasterFillCircle(raster_t *raster, int16_t xc, int16_t yc, int16_t r, uint16_t color){
+	if(r < 0 || !Visible(raster, xc - r, yc - r, xc + r, yc + r)){
+		return;
+	}
+	for(int16_t dy = -r; dy <= r; dy++){
+		int16_t half;
+		if(yc + dy < raster->clip.y0 || yc + dy > raster->clip.y1){
+			continue;
+		}
+		half = HalfWidth(r, abs(dy));
+		RasterSpan(raster, xc - half, xc + half, yc + dy, color, RASTER_OPAQUE);
+	}
+	RasterFlush(raster);
+}
+
+void RasterFillPolygon(raster_t *raster, const fb_point_t *points, uint8_t n, uint16_t color){
+	int32_t xs[RASTER_MAX_VERTICES];
+	fb_rect_t box;
+	int16_t first, last;
+	if(!PolygonBox(points, n, &box) || !Visible(raster, box.x0, box.y0, box.x1, box.y1)){
+		return;
+	}
+	first = box.y0 > raster->clip.y0 ? box.y0 : raster->clip.y0;
+	last = box.y1 < raster->clip.y1 ? box.y1 : raster->clip.y1;
+	for(int16_t y = first; y <= last; y++){
+		uint8_t count = Crossings(points, n, (int32_t)y << FP_SHIFT, y == box.y1, xs);
+		for(uint8_t i = 0; i + 1 < count; i += 2){
+			/* Pixel centers between the crossings, both included */
+			int16_t x0 = (xs[i] + FP_ONE - 1) >> FP_SHIFT;
+			int16_t x1 = xs[i + 1] >> FP_SHIFT;
+			if(x0 <= x1){
+				RasterSpan(raster, x0, x1, y, color, RASTER_OPAQUE);
+			}
+		}
+	}
+	RasterFlush(raster);
+}
+
+void RasterFillPolygonAA(raster_t *raster, const fb_point_t *points, uint8_t n, uint16_t color){
+	int32_t xs[RASTER_MAX_VERTICES];
+	fb_rect_t box;
+	int16_t first, last;
+	if(!PolygonBox(points, n, &box) || !Visible(raster, box.x0, box.y0, box.x1, box.y1) ||
+	   raster->clip.x1 - raster->clip.x0 + 1 > RASTER_MAX_WIDTH){
+		return;
+	}
+	first = box.y0 > raster->clip.y0 ? box.y0 : raster->clip.y0;
+	last = box.y1 < raster->clip.y1 ? box.y1 : raster->clip.y1;
+	for(int16_t y = first; y <= last; y++){
+		int16_t min = RASTER_MAX_WIDTH;
+		int16_t max = -1;
+		for(uint8_t s = 0; s < AA_ROWS; s++){
+			/* Sub-row centers: y - 3/8, y - 1/8, y + 1/8, y + 3/8 */
+			int32_t sub_y = ((int32_t)y << FP_SHIFT) + (2 * s + 1 - AA_ROWS) * (FP_ONE / (2 * AA_ROWS));
+			uint8_t count = Crossings(points, n, sub_y, false, xs);
+			for(uint8_t i = 0; i + 1 < count; i += 2){
+				Cover(raster, xs[i], xs[i + 1], &min, &max);
+			}
+		}
+		/* Runs of pixels with the same coverage */
+		for(int16_t x = min; x <= max;){
+			int16_t end = x;
+			uint8_t value = coverage[x];
+			while(end + 1 <= max && coverage[end + 1] == value){
+				end++;
+			}
+			RasterSpan(raster, raster->clip.x0 + x, raster->clip.x0 + end, y, color,
+					   (uint16_t)value * RASTER_OPAQUE / AA_FULL);
+			x = end + 1;
+		}
+		if(max >= min){
+			memset(&coverage[min], 0, max - min + 1);
+		}
+	}
+	RasterFlush(raster);
+}
+
+uint16_t RasterBlend(uint16_t foreground, uint16_t background, uint8_t alpha){
+	/* The three channels at once, with 5 bits of alpha */
+	uint32_t a = (alpha + 4) >> 3;
+	uint32_t fg = (foreground | ((uint32_t)foreground << 16)) & RGB565_SPREAD;
+	uint32_t bg = (background | ((uint32_t)background << 16)) & RGB565_SPREAD;
+	uint32_t mix = ((((fg - bg) * a) >> 5) + bg) & RGB565_SPREAD;
+	return (uint16_t)((mix >> 16) | mix);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,414 @@
+/**
+ * @file text.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "text.h"
+/*==================[macros and definitions]=================================*/
+#define FIRST_CHAR		' '			/*!< First character of the fonts */
+#define LAST_CHAR		'~'			/*!< Last character of the fonts */
+#define FIELD_CHARS		"0123456789+-. "	/*!< Characters that set the cell width of a field */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static inline uint16_t Swap(uint16_t color){
+	return (uint16_t)(color << 8 | color >> 8);
+}
+
+/**
+ * @brief Characters out of the fonts are drawn as spaces
+ */
+static inline char Code(char c){
+	return (c < FIRST_CHAR || c > LAST_CHAR) ? FIRST_CHAR : c;
+}
+
+static inline const char_info_t * Info(const Font_t *font, char c){
+	return &font->info[Code(c) - FIRST_CHAR];
+}
+
+/**
+ * @brief Expands rows of a glyph to RGB565, the first columns of each row
+ */
+static void Expand(const Font_t *font, char code, uint16_t foreground, uint16_t background,
+				   uint16_t row, uint16_t rows, uint16_t columns, uint16_t *dst, uint16_t stride){
+	const char_info_t *info = Info(font, code);
+	uint16_t row_bytes = (info->width + 7) / 8;
+	const uint8_t *src = &font->data[info->offset + row * row_bytes];
+	const uint16_t colors[2] = {Swap(background), Swap(foreground)};
+
+	for(uint16_t i = 0; i < rows; i++, src += row_bytes, dst += stride){
+		uint16_t *pixel = dst;
+		for(uint16_t j = 0; j < columns; j += 8){
+			uint8_t bits = src[j / 8];
+			uint16_t n = (columns - j < 8) ? columns - j : 8;
+			for(uint16_t k = 0; k < n; k++, bits <<= 1){
+				*pixel++ = colors[bits >> 7];
+			}
+		}
+	}
+}
+
+static void Evict(text_t *text, uint8_t index){
+	text_glyph_t *glyph = &text->glyphs[index];
+	uint32_t end = glyph->offset + glyph->pixels;
+	uint32_t pixels = glyph->pixels;
+
+	/* Compacts the cache, the free space stays at the end */
+	memmove(&text->config.cache[glyph->offset], &text->config.cache[end],
+			(text->cache_used - end) * sizeof(uint16_t));
+	for(uint8_t i = index + 1; i < text->n_glyphs; i++){
+		text->glyphs[i - 1] = text->glyphs[i];
+		text->glyphs[i - 1].offset -= pixels;
+	}
+	text->n_glyphs--;
+	text->cache_used -= pixels;
+	text->stats.evictions++;
+}
+
+/**
+ * @brief Glyph pixels from the cache, expanded on a miss. NULL if the glyph
+ * does not fit in the cache. Valid until the next lookup.
+ */
+static const uint16_t * Lookup(text_t *text, const Font_t *font, char code, uint16_t foreground, uint16_t background){
+	uint32_t pixels = Info(font, code)->width * font->font_height;
+	text_glyph_t *glyph;
+
+	text->tick++;
+	for(uint8_t i = 0; i < text->n_glyphs; i++){
+		glyph = &text->glyphs[i];
+		if(glyph->code == code && glyph->font == font && glyph->foreground == foreground &&
+		   glyph->background == background){
+			glyph->used = text->tick;
+			text->stats.hits++;
+			return &text->config.cache[glyph->offset];
+		}
+	}
+	text->stats.misses++;
+	if(pixels == 0 || pixels > text->config.cache_pixels){
+		return NULL;
+	}
+	/* Least recently used out, until there is room */
+	while(text->n_glyphs == TEXT_CACHE_ENTRIES || text->cache_used + pixels > text->config.cache_pixels){
+		uint8_t lru = 0;
+		for(uint8_t i = 1; i < text->n_glyphs; i++){
+			if(text->glyphs[i].used < text->glyphs[lru].used){
+				lru = i;
+			}
+		}
+		Evict(text, lru);
+	}
+	glyph = &text->glyphs[text->n_glyphs++];
+	glyph->font = font;
+	glyph->code = code;
+	glyph->foreground = foreground;
+	glyph->background = background;
+	glyph->offset = text->cache_used;
+	glyph->pixels = pixels;
+	glyph->used = text->tick;
+	text->cache_used += pixels;
+	Expand(font, code, foreground, background, 0, font->font_height, Info(font, code)->width,
+		   &text->config.cache[glyph->offset], Info(font, code)->width);
+	return &text->config.cache[glyph->offset];
+}
+
+/**
+ * @brief Width of a text in a font or a packed font (pack not NULL)
+ */
+static uint16_t Width(const Font_t *font, const font_pack_t *pack, const char *str, uint16_t n){
+	return pack ? FontPackWidth(pack, str, n) : TextWidth(font, str, n);
+}
+
+/**
+ * @brief Draws characters in one window. Proportional (cell = 0, 1 pixel gaps)
+ * or fixed pitch (each character centered in cell pixels). Glyphs come from the
+ * cache for fonts, and are decoded row by row into the band for packed fonts.
+ */
+static void DrawRun(text_t *text, int16_t x, int16_t y, const char *str, uint16_t n, const Font_t *font,
+					const font_pack_t *pack, uint16_t foreground, uint16_t background, uint8_t cell){
+	uint16_t width = cell ? n * cell : Width(font, pack, str, n);
+	uint16_t rows = pack ? pack->height : font->font_height;
+	uint16_t palette[FONT_PACK_MAX_LEVELS];
+	uint16_t clipped[UINT8_MAX];
+	uint16_t band_rows;
+	uint16_t last;
+	fb_rect_t area;
+
+	if(x < 0 || y < 0 || y >= text->config.height){
+		return;
+	}
+	while(n > 0 && x + width > text->config.width){
+		n--;
+		width = cell ? n * cell : Width(font, pack, str, n);
+	}
+	if(width == 0){
+		return;
+	}
+	if(y + rows > text->config.height){
+		rows = text->config.height - y;
+	}
+	/* Last character drawn, the only one without a gap after it */
+	last = n - 1;
+	while(pack && last > 0 && FontPackGlyph(pack, (uint8_t)str[last]) == NULL){
+		last--;
+	}
+	if(pack){
+		FontPackPalette(pack, foreground, background, palette);
+	}
+	area.x0 = x;
+	area.y0 = y;
+	area.x1 = x + width - 1;
+	area.y1 = y + rows - 1;
+	text->config.window_p(&area, text->config.param_p);
+	text->stats.windows++;
+
+	band_rows = text->config.band_pixels / width;
+	for(uint16_t row = 0; row < rows; row += band_rows){
+		uint16_t band = (rows - row < band_rows) ? rows - row : band_rows;
+		uint16_t *line = text->config.band;
+		uint16_t bg = Swap(background);
+		uint16_t column = 0;
+
+		for(uint16_t i = 0; i < n; i++){
+			const font_pack_glyph_t *packed = NULL;
+			char code = Code(str[i]);
+			uint16_t w;
+			uint16_t visible, margin, step;
+
+			if(pack){
+				packed = FontPackGlyph(pack, (uint8_t)str[i]);
+				if(packed == NULL && !cell){
+					continue;
+				}
+				w = packed ? packed->width : 0;
+			}
+			else{
+				w = Info(font, code)->width;
+			}
+			visible = (cell && w > cell) ? cell : w;
+			margin = (cell && w < cell) ? (cell - w) / 2 : 0;
+			step = cell ? cell : (i < last ? w + 1 : w);
+
+			if(packed != NULL){
+				font_pack_decoder_t decoder;
+				FontPackDecoderInit(&decoder, pack, packed, palette);
+				FontPackSkip(&decoder, row);
+				for(uint16_t j = 0; j < band; j++){
+					uint16_t *pixel = &line[j * width + column + margin];
+					if(visible == w){
+						FontPackRow(&decoder, pixel);
+					}
+					else{
+						/* Wider than the cell */
+						FontPackRow(&decoder, clipped);
+						memcpy(pixel, clipped, visible * sizeof(uint16_t));
+					}
+				}
+			}
+			else if(!pack){
+				const uint16_t *glyph = Lookup(text, font, code, foreground, background);
+				if(glyph != NULL){
+					glyph += row * w;
+					/* Rows of a few pixels: a loop is faster than memcpy() calls */
+					for(uint16_t j = 0; j < band; j++, glyph += w){
+						uint16_t *pixel = &line[j * width + column + margin];
+						for(uint16_t k = 0; k < visible; k++){
+							pixel[k] = glyph[k];
+						}
+					}
+				}
+				else{
+					Expand(font, code, foreground, background, row, band, visible, &line[column + margin], width);
+				}
+			}
+			/* Cell margins and the gap to the next character */
+			for(uint16_t j = 0; j < band; j++){
+				uint16_t *pixel = &line[j * width + column];
+				for(uint16_t k = 0; k < margin; k++){
+					pixel[k] = bg;
+				}
+				for(uint16_t k = margin + visible; k < step; k++){
+					pixel[k] = bg;
+				}
+			}
+			column += step;
+		}
+		text->config.write_p(line, (uint32_t)band * width, text->config.param_p);
+		text->stats.pixels += (uint32_t)band * width;
+	}
+}
+/*==================[external functions definition]==========================*/
+bool TextInit(text_t *text, const text_config_t *config){
+	if(config->band == NULL || config->band_pixels < config->width || config->width == 0 ||
+	   config->window_p == NULL || config->write_p == NULL){
+		return false;
+	}
+	memset(text, 0, sizeof(text_t));
+	text->config = *config;
+	if(text->config.cache == NULL){
+		text->config.cache_pixels = 0;
+	}
+	return true;
+}
+
+uint16_t TextWidth(const Font_t *font, const char *str, uint16_t n){
+	uint16_t width = 0;
+	for(uint16_t i = 0; i < n; i++){
+		width += Info(font, str[i])->width + 1;
+	}
+	/* No gap after the last character */
+	return width ? width - 1 : 0;
+}
+
+/**
+ * @brief Characters of a line that fit up to the right edge
+ */
+static uint16_t Fit(const text_t *text, int16_t x, const char *str, const Font_t *font, const font_pack_t *pack){
+	uint16_t n = 0;
+	int32_t right = x;
+
+	while(str[n] != '\0' && str[n] != '\n'){
+		uint16_t w;
+		if(pack){
+			const font_pack_glyph_t *glyph = FontPackGlyph(pack, (uint8_t)str[n]);
+			if(glyph == NULL){
+				n++;
+				continue;
+			}
+			w = glyph->width;
+		}
+		else{
+			w = Info(font, str[n])->width;
+		}
+		right += w;
+		if(right > text->config.width){
+			break;
+		}
+		right++;
+		n++;
+	}
+	return n;
+}
+
+uint16_t TextDraw(text_t *text, int16_t x, int16_t y, const char *str, const Font_t *font,
+				  uint16_t foreground, uint16_t background){
+	uint16_t n;
+
+	if(x < 0 || y < 0){
+		return 0;
+	}
+	n = Fit(text, x, str, font, NULL);
+	if(n > 0){
+		DrawRun(text, x, y, str, n, font, NULL, foreground, background, 0);
+	}
+	return n;
+}
+
+uint16_t TextDrawPacked(text_t *text, int16_t x, int16_t y, const char *str, const font_pack_t *font,
+						uint16_t foreground, uint16_t background){
+	uint16_t n;
+
+	if(x < 0 || y < 0){
+		return 0;
+	}
+	n = Fit(text, x, str, NULL, font);
+	if(n > 0){
+		DrawRun(text, x, y, str, n, NULL, font, foreground, background, 0);
+	}
+	return n;
+}
+
+void TextDrawPackedGlyph(text_t *text, int16_t x, int16_t y, uint8_t code, const font_pack_t *font,
+						 uint16_t foreground, uint16_t background){
+	char str[] = {(char)code};
+	DrawRun(text, x, y, str, 1, NULL, font, foreground, background, 0);
+}
+
+/**
+ * @brief Field in a font or a packed font: cells as wide as the widest digit
+ */
+static bool FieldInit(text_field_t *field, int16_t x, int16_t y, uint8_t length, const Font_t *font,
+					  const font_pack_t *pack, uint16_t foreground, uint16_t background){
+	if(length == 0 || length > TEXT_FIELD_MAX){
+		return false;
+	}
+	field->x = x;
+	field->y = y;
+	field->font = font;
+	field->pack = pack;
+	field->foreground = foreground;
+	field->background = background;
+	field->length = length;
+	field->cell = 0;
+	for(const char *c = FIELD_CHARS; *c != '\0'; c++){
+		uint16_t w = Width(font, pack, c, 1);
+		if(w > field->cell){
+			field->cell = w;
+		}
+	}
+	/* Digits of the same width: a one pixel gap, as proportional text */
+	field->cell++;
+	field->shown = false;
+	return true;
+}
+
+bool TextFieldInit(text_field_t *field, int16_t x, int16_t y, uint8_t length, const Font_t *font,
+				   uint16_t foreground, uint16_t background){
+	return FieldInit(field, x, y, length, font, NULL, foreground, background);
+}
+
+bool TextFieldInitPacked(text_field_t *field, int16_t x, int16_t y, uint8_t length, const font_pack_t *font,
+						 uint16_t foreground, uint16_t background){
+	return FieldInit(field, x, y, length, NULL, font, foreground, background);
+}
+
+void TextFieldDraw(text_t *text, text_field_t *field, const char *str){
+	char next[TEXT_FIELD_MAX];
+	size_t len = strlen(str);
+	uint8_t i = 0;
+
+	/* Right aligned */
+	if(len > field->length){
+		str += len - field->length;
+		len = field->length;
+	}
+	memset(next, ' ', field->length - len);
+	memcpy(&next[field->length - len], str, len);
+
+	/* One window per run of changed cells */
+	while(i < field->length){
+		uint8_t start;
+		while(i < field->length && field->shown && Code(next[i]) == Code(field->text[i])){
+			i++;
+		}
+		start = i;
+		while(i < field->length && (!field->shown || Code(next[i]) != Code(field->text[i]))){
+			i++;
+		}
+		if(i > start){
+			DrawRun(text, field->x + start * field->cell, field->y, &next[start], i - start, field->font,
+					field->pack, field->foreground, field->background, field->cell);
+		}
+	}
+	memcpy(field->text, next, field->length);
+	field->shown = true;
+}
+
+void TextFieldInvalidate(text_field_t *field){
+	field->shown = false;
+}
+
+/*==================[end of file]============================================*/
@@ -16,34 +16,24 @@
 #include "freertos/task.h"
 #include "gpio_fast_out_mcu.h"
 #include "delay_mcu.h"
+#include "freertos/semphr.h"
+#include "driver/rmt_tx.h"
+#include "soc/soc_caps.h"
 /*==================[macros and definitions]=================================*/
 #define RET_CMD (50)    // ret command 50us low
 #define BIT_0   (1)     // bit 0
 #define BIT_7   (1<<7)  // bit 0
 /*==================[internal data declaration]==============================*/
 gpio_t pin_number;
+static rmt_channel_handle_t rmt_channel;           /*!< RMT output of ws2812bSendAsync() */
+static rmt_encoder_handle_t copy_encoder;          /*!< Copies the symbols as they are */
+static ws2812b_encoder_t encoder;                  /*!< Colors to symbols */
+static ws2812b_config_t async_config;
+static SemaphoreHandle_t free_buffers;             /*!< Buffers not being sent */
+static uint8_t next_buffer;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
-static const uint8_t gamma_table[256] = {
-    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-    0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,
-    1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   3,
-    3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   5,   6,
-    6,   6,   6,   7,   7,   7,   8,   8,   8,   9,   9,   9,   10,  10,  10,
-    11,  11,  11,  12,  12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,
-    17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  23,  24,  24,  25,
-    25,  26,  27,  27,  28,  29,  29,  30,  31,  31,  32,  33,  34,  34,  35,
-    36,  37,  38,  38,  39,  40,  41,  42,  42,  43,  44,  45,  46,  47,  48,
-    49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
-    64,  65,  66,  68,  69,  70,  71,  72,  73,  75,  76,  77,  78,  80,  81,
-    82,  84,  85,  86,  88,  89,  90,  92,  93,  94,  96,  97,  99,  100, 102,
-    103, 105, 106, 108, 109, 111, 112, 114, 115, 117, 119, 120, 122, 124, 125,
-    127, 129, 130, 132, 134, 136, 137, 139, 141, 143, 145, 146, 148, 150, 152,
-    154, 156, 158, 160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180, 182,
-    184, 186, 188, 191, 193, 195, 197, 199, 202, 204, 206, 209, 211, 213, 215,
-    218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252,
-    255};
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
@@ -326,8 +316,47 @@ void IRAM_ATTR ws2812bSendLow(gpio_t pin){
     __asm__ __volatile__ ("nop");   // 94
 }
 
+void IRAM_ATTR ws2812bSendByte(uint8_t byte){
+    uint8_t i;
+    for(i=0; i<=7; i++){
+        if(byte & (BIT_7>>i)){
+            ws2812bSendHigh(pin_number);
+        }
+        else{
+            ws2812bSendLow(pin_number);
+        }
+    }
+}
+
 uint8_t ws2812bGammaCorrection(uint8_t component){
-    return gamma_table[component];
+    return ws2812b_gamma[component];
+}
+
+static bool IRAM_ATTR TransDone(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *event, void *param){
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(free_buffers, &woken);
+    if(async_config.func_p != NULL){
+        ((void (*)(void*))async_config.func_p)(async_config.param_p);
+    }
+    return woken == pdTRUE;
+}
+
+/* Buffer to encode the next strip into, once the one sent two strips ago is free */
+static ws2812b_symbol_t * NextBuffer(void){
+    ws2812b_symbol_t *symbols;
+    xSemaphoreTake(free_buffers, portMAX_DELAY);
+    symbols = async_config.buffers[next_buffer];
+    if(async_config.buffers[1] != NULL){
+        next_buffer ^= 1;
+    }
+    return symbols;
+}
+
+static void Transmit(const ws2812b_symbol_t *symbols, uint32_t count){
+    rmt_transmit_config_t transmit_config = {
+        .loop_count = 0,
+    };
+    rmt_transmit(rmt_channel, copy_encoder, symbols, count * sizeof(ws2812b_symbol_t), &transmit_config);
 }
 
 /*==================[external functions definition]==========================*/
@@ -338,34 +367,15 @@ void ws2812bInit(gpio_t pin){
 }
 
 void ws2812bSend(rgb_led_t led_color){
-    uint8_t i;
-	// Blue
-	for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.green) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
-    }
-	// Red
-    for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.red) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
-    }
-	// Green
-    for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.blue) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
-    }
+    ws2812bSendByte(ws2812bGammaCorrection(led_color.green));
+    ws2812bSendByte(ws2812bGammaCorrection(led_color.red));
+    ws2812bSendByte(ws2812bGammaCorrection(led_color.blue));
+}
+
+void ws2812bSendRaw(rgb_led_t led_color){
+    ws2812bSendByte(led_color.green);
+    ws2812bSendByte(led_color.red);
+    ws2812bSendByte(led_color.blue);
 }
 
 void ws2812bSendRet(void){
@@ -373,4 +383,58 @@ void ws2812bSendRet(void){
     DelayUs(RET_CMD);
 }
 
+bool ws2812bInitAsync(const ws2812b_config_t *config){
+    uint8_t n_buffers = (config->buffers[1] != NULL) ? 2 : 1;
+    rmt_tx_channel_config_t channel_config = {
+        .gpio_num = config->pin,
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = WS2812B_RMT_RESOLUTION,
+        .mem_block_symbols = SOC_RMT_MEM_WORDS_PER_CHANNEL,
+        .trans_queue_depth = 2,
+    };
+    rmt_copy_encoder_config_t copy_config = {};
+    rmt_tx_event_callbacks_t callbacks = {
+        .on_trans_done = TransDone,
+    };
+
+    _Static_assert(sizeof(ws2812b_symbol_t) == sizeof(rmt_symbol_word_t), "ws2812b_symbol_t is not an RMT symbol");
+    if(config->buffers[0] == NULL || !Ws2812bEncoderInit(&encoder, WS2812B_RMT_RESOLUTION)){
+        return false;
+    }
+    async_config = *config;
+    next_buffer = 0;
+    free_buffers = xSemaphoreCreateCounting(n_buffers, n_buffers);
+    if(free_buffers == NULL ||
+       rmt_new_tx_channel(&channel_config, &rmt_channel) != ESP_OK ||
+       rmt_new_copy_encoder(&copy_config, &copy_encoder) != ESP_OK ||
+       rmt_tx_register_event_callbacks(rmt_channel, &callbacks, NULL) != ESP_OK){
+        return false;
+    }
+    return rmt_enable(rmt_channel) == ESP_OK;
+}
+
+void ws2812bSendAsync(const rgb_led_t *leds, uint16_t n, const uint8_t *lut){
+    ws2812b_symbol_t *symbols;
+
+    if(n > async_config.max_leds){
+        n = async_config.max_leds;
+    }
+    symbols = NextBuffer();
+    Transmit(symbols, Ws2812bEncode(&encoder, leds, n, lut ? lut : ws2812b_gamma, symbols));
+}
+
+void ws2812bSendColorsAsync(const uint32_t *colors, uint16_t n, const uint8_t *lut){
+    ws2812b_symbol_t *symbols;
+
+    if(n > async_config.max_leds){
+        n = async_config.max_leds;
+    }
+    symbols = NextBuffer();
+    Transmit(symbols, Ws2812bEncodeColors(&encoder, colors, n, lut ? lut : ws2812b_gamma, symbols));
+}
+
+void ws2812bWaitAsync(void){
+    rmt_tx_wait_all_done(rmt_channel, -1);
+}
+
 /*==================[end of file]============================================*/
@@ -0,0 +1,125 @@
+/**
+ * @file ws2812b_encoder.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include "ws2812b_encoder.h"
+/*==================[macros and definitions]=================================*/
+#define MAX_DURATION	0x7FFF		/*!< 15 bits */
+#define LEVEL0			(1UL << 15)
+#define LEVEL1			(1UL << 31)
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+const uint8_t ws2812b_gamma[256] = {
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,
+    1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   3,
+    3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   5,   6,
+    6,   6,   6,   7,   7,   7,   8,   8,   8,   9,   9,   9,   10,  10,  10,
+    11,  11,  11,  12,  12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,
+    17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  23,  24,  24,  25,
+    25,  26,  27,  27,  28,  29,  29,  30,  31,  31,  32,  33,  34,  34,  35,
+    36,  37,  38,  38,  39,  40,  41,  42,  42,  43,  44,  45,  46,  47,  48,
+    49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
+    64,  65,  66,  68,  69,  70,  71,  72,  73,  75,  76,  77,  78,  80,  81,
+    82,  84,  85,  86,  88,  89,  90,  92,  93,  94,  96,  97,  99,  100, 102,
+    103, 105, 106, 108, 109, 111, 112, 114, 115, 117, 119, 120, 122, 124, 125,
+    127, 129, 130, 132, 134, 136, 137, 139, 141, 143, 145, 146, 148, 150, 152,
+    154, 156, 158, 160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180, 182,
+    184, 186, 188, 191, 193, 195, 197, 199, 202, 204, 206, 209, 211, 213, 215,
+    218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252,
+    255};
+
+/*==================[internal functions definition]==========================*/
+/* Rounded to the nearest tick */
+static uint32_t Ticks(uint32_t ns, uint32_t resolution_hz){
+	return (uint32_t)(((uint64_t)ns * resolution_hz + 500000000) / 1000000000);
+}
+
+static inline void Byte(const ws2812b_encoder_t *encoder, uint8_t byte, ws2812b_symbol_t *symbols){
+	const ws2812b_symbol_t *high = encoder->nibble[byte >> 4];
+	const ws2812b_symbol_t *low = encoder->nibble[byte & 0x0F];
+	symbols[0] = high[0];
+	symbols[1] = high[1];
+	symbols[2] = high[2];
+	symbols[3] = high[3];
+	symbols[4] = low[0];
+	symbols[5] = low[1];
+	symbols[6] = low[2];
+	symbols[7] = low[3];
+}
+/*==================[external functions definition]==========================*/
+bool Ws2812bEncoderInit(ws2812b_encoder_t *encoder, uint32_t resolution_hz){
+	uint32_t t0h = Ticks(WS2812B_T0H_NS, resolution_hz);
+	uint32_t t0l = Ticks(WS2812B_T0L_NS, resolution_hz);
+	uint32_t t1h = Ticks(WS2812B_T1H_NS, resolution_hz);
+	uint32_t t1l = Ticks(WS2812B_T1L_NS, resolution_hz);
+	uint32_t reset = Ticks(WS2812B_RESET_US * 1000, resolution_hz);
+	ws2812b_symbol_t bit[2];
+
+	/* The pulses must be told apart (150 ns tolerance) and the reset must fit
+	 * in one symbol, as two halves */
+	if(resolution_hz < 10000000 || reset / 2 > MAX_DURATION){
+		return false;
+	}
+	bit[0] = LEVEL0 | t0h | t0l << 16;
+	bit[1] = LEVEL0 | t1h | t1l << 16;
+	for(uint8_t nibble = 0; nibble < 16; nibble++){
+		for(uint8_t i = 0; i < 4; i++){
+			encoder->nibble[nibble][i] = bit[(nibble >> (3 - i)) & 1];
+		}
+	}
+	encoder->reset = reset / 2 | (reset - reset / 2) << 16;
+	return true;
+}
+
+uint32_t Ws2812bEncode(const ws2812b_encoder_t *encoder, const rgb_led_t *leds, uint16_t n,
+					   const uint8_t *lut, ws2812b_symbol_t *symbols){
+	ws2812b_symbol_t *symbol = symbols;
+
+	if(lut != NULL){
+		for(uint16_t i = 0; i < n; i++, symbol += WS2812B_BITS_PER_LED){
+			Byte(encoder, lut[leds[i].green], &symbol[0]);
+			Byte(encoder, lut[leds[i].red], &symbol[8]);
+			Byte(encoder, lut[leds[i].blue], &symbol[16]);
+		}
+	}
+	else{
+		for(uint16_t i = 0; i < n; i++, symbol += WS2812B_BITS_PER_LED){
+			Byte(encoder, leds[i].green, &symbol[0]);
+			Byte(encoder, leds[i].red, &symbol[8]);
+			Byte(encoder, leds[i].blue, &symbol[16]);
+		}
+	}
+	*symbol = encoder->reset;
+	return WS2812B_SYMBOLS(n);
+}
+
+uint32_t Ws2812bEncodeColors(const ws2812b_encoder_t *encoder, const uint32_t *colors, uint16_t n,
+							 const uint8_t *lut, ws2812b_symbol_t *symbols){
+	ws2812b_symbol_t *symbol = symbols;
+
+	for(uint16_t i = 0; i < n; i++, symbol += WS2812B_BITS_PER_LED){
+		uint32_t color = colors[i];
+		Byte(encoder, lut[(color >> 8) & 0xFF], &symbol[0]);
+		Byte(encoder, lut[(color >> 16) & 0xFF], &symbol[8]);
+		Byte(encoder, lut[color & 0xFF], &symbol[16]);
+	}
+	*symbol = encoder->reset;
+	return WS2812B_SYMBOLS(n);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,121 @@
+/**
+ * @file test_font_pack.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the packed font decoder
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "unity.h"
+#include "font_pack.h"
+#include "raster.h"
+/*==================[macros and definitions]=================================*/
+#define FG			0xFFE0
+#define BG			0x001F
+/*==================[internal data definition]===============================*/
+/* 1 bpp: 'A' as runs, 'B' raw, 3 rows
+ *   A: .##.   B: #........#
+ *      ####      ##########
+ *      #..#      .#.#.#.#.#
+ */
+static const uint8_t data_1bpp[] = {
+	0x00, 0x03, 0x00, 0x09, 0x02, 0x01,
+	0x80, 0x40, 0xFF, 0xC0, 0x55, 0x40,
+};
+static const font_pack_glyph_t glyphs_1bpp[] = {{4, 0, 0}, {10, FONT_PACK_RAW, 6}};
+static const font_pack_range_t ranges_1bpp[] = {{'A', 2, 0}};
+static const font_pack_t font_1bpp = {3, 1, 1, ranges_1bpp, glyphs_1bpp, data_1bpp};
+
+/* 4 bpp: 'x' raw, 'y' as runs, 2 rows
+ *   x: 0 8 15   y: 5 5 5
+ *      15 8 0      5 2 2
+ */
+static const uint8_t data_4bpp[] = {
+	0x08, 0xF0, 0xF8, 0x00,
+	0x35, 0x12,
+};
+static const font_pack_glyph_t glyphs_4bpp[] = {{3, FONT_PACK_RAW, 0}, {3, 0, 4}};
+static const font_pack_range_t ranges_4bpp[] = {{'x', 2, 0}};
+static const font_pack_t font_4bpp = {2, 4, 1, ranges_4bpp, glyphs_4bpp, data_4bpp};
+
+/* Every level mapped to itself */
+static const uint16_t identity[FONT_PACK_MAX_LEVELS] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+/*==================[internal functions definition]==========================*/
+static uint16_t Swap(uint16_t color){
+	return (uint16_t)(color << 8 | color >> 8);
+}
+
+TEST_CASE("Packed glyphs decoded by rows", "[font_pack]")
+{
+	static const uint16_t a[] = {0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 1};
+	static const uint16_t b[] = {1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+								 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+								 0, 1, 0, 1, 0, 1, 0, 1, 0, 1};
+	font_pack_decoder_t decoder;
+	uint16_t row[10];
+
+	TEST_ASSERT(FontPackGlyph(&font_1bpp, '@') == NULL);
+	TEST_ASSERT(FontPackGlyph(&font_1bpp, 'C') == NULL);
+	TEST_ASSERT(FontPackGlyph(&font_1bpp, 'B') == &glyphs_1bpp[1]);
+	TEST_ASSERT_EQUAL(4 + 1 + 10, FontPackWidth(&font_1bpp, "AB", 2));
+	TEST_ASSERT_EQUAL(4 + 1 + 10, FontPackWidth(&font_1bpp, "A?B", 3));
+
+	/* Runs go on from one row to the next */
+	FontPackDecoderInit(&decoder, &font_1bpp, FontPackGlyph(&font_1bpp, 'A'), identity);
+	for(int y = 0; y < 3; y++){
+		FontPackRow(&decoder, row);
+		TEST_ASSERT_EQUAL_UINT8_ARRAY(&a[y * 4], row, 4 * sizeof(uint16_t));
+	}
+	FontPackDecoderInit(&decoder, &font_1bpp, FontPackGlyph(&font_1bpp, 'A'), identity);
+	FontPackSkip(&decoder, 1);
+	FontPackRow(&decoder, row);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(&a[4], row, 4 * sizeof(uint16_t));
+
+	/* Raw rows start on a byte */
+	FontPackDecoderInit(&decoder, &font_1bpp, FontPackGlyph(&font_1bpp, 'B'), identity);
+	FontPackSkip(&decoder, 1);
+	FontPackRow(&decoder, row);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(&b[10], row, 10 * sizeof(uint16_t));
+	FontPackRow(&decoder, row);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(&b[20], row, 10 * sizeof(uint16_t));
+}
+
+TEST_CASE("Packed anti-aliased glyphs and palette", "[font_pack]")
+{
+	static const uint16_t x[] = {0, 8, 15, 15, 8, 0};
+	static const uint16_t y[] = {5, 5, 5, 5, 2, 2};
+	uint16_t palette[FONT_PACK_MAX_LEVELS];
+	font_pack_decoder_t decoder;
+	uint16_t row[3];
+
+	FontPackDecoderInit(&decoder, &font_4bpp, FontPackGlyph(&font_4bpp, 'x'), identity);
+	FontPackRow(&decoder, row);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(&x[0], row, 3 * sizeof(uint16_t));
+	FontPackRow(&decoder, row);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(&x[3], row, 3 * sizeof(uint16_t));
+	FontPackDecoderInit(&decoder, &font_4bpp, FontPackGlyph(&font_4bpp, 'y'), identity);
+	FontPackRow(&decoder, row);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(&y[0], row, 3 * sizeof(uint16_t));
+	FontPackRow(&decoder, row);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(&y[3], row, 3 * sizeof(uint16_t));
+
+	/* From the background to the foreground, in display byte order */
+	FontPackPalette(&font_4bpp, FG, BG, palette);
+	TEST_ASSERT_EQUAL(Swap(BG), palette[0]);
+	TEST_ASSERT_EQUAL(Swap(FG), palette[15]);
+	TEST_ASSERT_EQUAL(Swap(RasterBlend(FG, BG, 8 * RASTER_OPAQUE / 15)), palette[8]);
+	FontPackPalette(&font_1bpp, FG, BG, palette);
+	TEST_ASSERT_EQUAL(Swap(BG), palette[0]);
+	TEST_ASSERT_EQUAL(Swap(FG), palette[1]);
+
+	FontPackDecoderInit(&decoder, &font_4bpp, FontPackGlyph(&font_4bpp, 'x'), palette);
+	FontPackPalette(&font_4bpp, FG, BG, palette);
+	FontPackRow(&decoder, row);
+	TEST_ASSERT_EQUAL(Swap(BG), row[0]);
+	TEST_ASSERT_EQUAL(palette[8], row[1]);
+	TEST_ASSERT_EQUAL(Swap(FG), row[2]);
+}
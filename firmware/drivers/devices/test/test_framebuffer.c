@@ -0,0 +1,222 @@
+/**
+ * @file test_framebuffer.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the framebuffer, dirty rectangles and strip rendering
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "unity.h"
+#include "framebuffer.h"
+/*==================[macros and definitions]=================================*/
+#define WIDTH		64
+#define HEIGHT		48
+#define STRIP		(WIDTH * 5)
+#define TALL_WIDTH	240
+#define TALL_HEIGHT	320
+#define TALL_STRIP	40000
+/*==================[internal data definition]===============================*/
+/* Display memory, written by the flush function */
+static uint16_t screen[WIDTH * HEIGHT];
+static uint16_t full_buffer[WIDTH * HEIGHT];
+static uint16_t strips[2][STRIP];
+static bool busy[2];
+static bool drew_busy;
+static uint32_t flushed_pixels;
+static fb_rect_t areas[8];
+static int n_areas;
+
+static const uint8_t arrow[] = {
+	0x18, 0x3C, 0x7E, 0xFF, 0x18, 0x18, 0x18, 0x18,
+};
+
+static const uint8_t picture[] = {
+	0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F,
+	0xFF, 0xFF, 0x00, 0x00, 0x84, 0x10,
+};
+/*==================[internal functions definition]==========================*/
+static int BufferIndex(const uint16_t *pixels){
+	return (pixels >= strips[1] && pixels < strips[1] + STRIP) ? 1 : 0;
+}
+
+static void Flush(const fb_rect_t *area, const uint16_t *pixels, uint16_t stride, void *param){
+	(void)param;
+	for(int16_t y = area->y0; y <= area->y1; y++){
+		memcpy(&screen[y * WIDTH + area->x0], &pixels[(y - area->y0) * stride],
+			   (area->x1 - area->x0 + 1) * sizeof(uint16_t));
+	}
+	flushed_pixels += (area->x1 - area->x0 + 1) * (area->y1 - area->y0 + 1);
+	busy[BufferIndex(pixels)] = true;
+}
+
+static void FlushArea(const fb_rect_t *area, const uint16_t *pixels, uint16_t stride, void *param){
+	(void)pixels;
+	(void)stride;
+	(void)param;
+	if(n_areas < 8){
+		areas[n_areas] = *area;
+	}
+	n_areas++;
+}
+
+static void Wait(void *param){
+	(void)param;
+	busy[0] = busy[1] = false;
+}
+
+static void Scene(fb_t *fb, void *param){
+	(void)param;
+	if(fb->pixels != NULL && busy[BufferIndex(fb->pixels)]){
+		drew_busy = true;
+	}
+	FbFill(fb, 0x001F);
+	FbFillRect(fb, 50, 40, 80, 60, 0xF800);
+	FbDrawRect(fb, 2, 2, 30, 20, 0xFFFF);
+	FbDrawBitmap(fb, -3, 30, 8, 8, arrow, 0x07E0, 0x0000);
+	FbDrawPicture(fb, 40, 10, 3, 2, picture);
+	FbDrawPixel(fb, 63, 47, 0xFFE0);
+}
+
+static void Init(fb_t *fb, uint16_t *buffer_1, uint16_t *buffer_2, uint32_t pixels){
+	fb_config_t config = {
+		.width = WIDTH, .height = HEIGHT,
+		.buffers = {buffer_1, buffer_2}, .buffer_pixels = pixels,
+		.flush_p = Flush, .wait_p = Wait,
+	};
+	memset(screen, 0, sizeof(screen));
+	busy[0] = busy[1] = drew_busy = false;
+	flushed_pixels = 0;
+	TEST_ASSERT_TRUE(FbInit(fb, &config));
+}
+
+TEST_CASE("Framebuffer configuration", "[framebuffer]")
+{
+	fb_t fb;
+	fb_config_t config = {.width = WIDTH, .height = HEIGHT, .buffers = {strips[0], NULL},
+						  .buffer_pixels = WIDTH - 1, .flush_p = Flush};
+	TEST_ASSERT_FALSE(FbInit(&fb, &config));
+	config.buffer_pixels = WIDTH;
+	config.flush_p = NULL;
+	TEST_ASSERT_FALSE(FbInit(&fb, &config));
+	config.flush_p = Flush;
+	TEST_ASSERT_TRUE(FbInit(&fb, &config));
+	TEST_ASSERT_FALSE(fb.full);
+	TEST_ASSERT_EQUAL(1, fb.n_dirty);
+}
+
+TEST_CASE("Framebuffer pixels in display byte order", "[framebuffer]")
+{
+	fb_t fb;
+	Init(&fb, full_buffer, NULL, WIDTH * HEIGHT);
+	TEST_ASSERT_TRUE(fb.full);
+	FbDrawPixel(&fb, 1, 0, 0xF81F);
+	TEST_ASSERT_EQUAL(0xF8, ((uint8_t*)full_buffer)[2]);
+	TEST_ASSERT_EQUAL(0x1F, ((uint8_t*)full_buffer)[3]);
+	/* Outside the display: clipped */
+	FbDrawPixel(&fb, -1, 0, 0xFFFF);
+	FbDrawPixel(&fb, WIDTH, 0, 0xFFFF);
+	FbFillRect(&fb, -10, -10, -1, 100, 0xFFFF);
+	TEST_ASSERT_EQUAL(0, full_buffer[0]);
+}
+
+TEST_CASE("Framebuffer dirty rectangles", "[framebuffer]")
+{
+	fb_t fb;
+	Init(&fb, full_buffer, NULL, WIDTH * HEIGHT);
+	FbRender(&fb, NULL, NULL);
+	TEST_ASSERT_EQUAL(WIDTH * HEIGHT, flushed_pixels);
+	TEST_ASSERT_EQUAL(0, fb.n_dirty);
+
+	/* Adjacent halves become one rectangle, one inside another disappears */
+	FbFillRect(&fb, 0, 0, 9, 9, 0x1234);
+	FbFillRect(&fb, 10, 0, 19, 9, 0x1234);
+	FbFillRect(&fb, 5, 5, 6, 6, 0x4321);
+	TEST_ASSERT_EQUAL(1, fb.n_dirty);
+	TEST_ASSERT_EQUAL(0, fb.dirty[0].x0);
+	TEST_ASSERT_EQUAL(19, fb.dirty[0].x1);
+
+	/* Far apart: merging would send many more pixels */
+	FbDrawPixel(&fb, 60, 45, 0xFFFF);
+	TEST_ASSERT_EQUAL(2, fb.n_dirty);
+
+	flushed_pixels = 0;
+	FbRender(&fb, NULL, NULL);
+	TEST_ASSERT_EQUAL(200 + 1, flushed_pixels);
+	TEST_ASSERT_EQUAL(0x4321, (uint16_t)(screen[5 * WIDTH + 5] << 8 | screen[5 * WIDTH + 5] >> 8));
+
+	/* More rectangles than FB_DIRTY_MAX: the closest ones are merged */
+	for(int i = 0; i < FB_DIRTY_MAX + 4; i++){
+		FbDrawPixel(&fb, i * 5, i * 4, 0xFFFF);
+	}
+	TEST_ASSERT(fb.n_dirty <= FB_DIRTY_MAX);
+	flushed_pixels = 0;
+	FbRender(&fb, NULL, NULL);
+	TEST_ASSERT(flushed_pixels < WIDTH * HEIGHT / 4);
+	for(int i = 0; i < FB_DIRTY_MAX + 4; i++){
+		TEST_ASSERT_EQUAL(0xFFFF, screen[i * 4 * WIDTH + i * 5]);
+	}
+}
+
+TEST_CASE("Framebuffer strips render the same frame as a full buffer", "[framebuffer]")
+{
+	static uint16_t expected[WIDTH * HEIGHT];
+	fb_t fb;
+
+	Init(&fb, full_buffer, NULL, WIDTH * HEIGHT);
+	Scene(&fb, NULL);
+	FbRender(&fb, NULL, NULL);
+	memcpy(expected, screen, sizeof(screen));
+
+	/* Two buffers: the next strip is never drawn in the one being sent */
+	Init(&fb, strips[0], strips[1], STRIP);
+	FbRender(&fb, Scene, NULL);
+	FbWait(&fb);
+	TEST_ASSERT_FALSE(drew_busy);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, screen, sizeof(screen));
+	TEST_ASSERT_EQUAL((HEIGHT + 4) / 5, fb.stats.flushes);
+
+	/* Only the dirty rectangle is redrawn and sent */
+	memset(screen, 0, sizeof(screen));
+	flushed_pixels = 0;
+	FbFillRect(&fb, 50, 40, 80, 60, 0xF800);
+	FbRender(&fb, Scene, NULL);
+	TEST_ASSERT_EQUAL(14 * 8, flushed_pixels);
+	TEST_ASSERT_EQUAL(expected[45 * WIDTH + 55], screen[45 * WIDTH + 55]);
+	TEST_ASSERT_EQUAL(0, screen[0]);
+
+	/* Single buffer: waits for each strip before drawing the next one */
+	Init(&fb, strips[0], NULL, STRIP);
+	FbRender(&fb, Scene, NULL);
+	TEST_ASSERT_FALSE(drew_busy);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, screen, sizeof(screen));
+}
+
+TEST_CASE("Framebuffer strip of more than 32767 pixels on a narrow rectangle", "[framebuffer]")
+{
+	static uint16_t tall_strip[TALL_STRIP];
+	fb_t fb;
+	fb_config_t config = {
+		.width = TALL_WIDTH, .height = TALL_HEIGHT,
+		.buffers = {tall_strip, NULL}, .buffer_pixels = TALL_STRIP,
+		.flush_p = FlushArea, .wait_p = Wait,
+	};
+
+	TEST_ASSERT_TRUE(FbInit(&fb, &config));
+	TEST_ASSERT_FALSE(fb.full);
+	FbRender(&fb, NULL, NULL);
+
+	/* One pixel wide: the whole column fits in one strip */
+	n_areas = 0;
+	FbFillRect(&fb, 10, 0, 10, TALL_HEIGHT - 1, 0xFFFF);
+	FbRender(&fb, NULL, NULL);
+	TEST_ASSERT_EQUAL(1, n_areas);
+	TEST_ASSERT_EQUAL(10, areas[0].x0);
+	TEST_ASSERT_EQUAL(0, areas[0].y0);
+	TEST_ASSERT_EQUAL(10, areas[0].x1);
+	TEST_ASSERT_EQUAL(TALL_HEIGHT - 1, areas[0].y1);
+}
@@ -0,0 +1,127 @@
+/**
+ * @file test_hc_sr04_ranger.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the HC-SR04 ranger, on a simulated echo timeline
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include "unity.h"
+#include "hc_sr04_ranger.h"
+/*==================[macros and definitions]=================================*/
+#define SLOT_US			(HC_SR04_MAX_ECHO_US + 10000)
+#define ECHO_DELAY_US	450			/*!< Trigger to start of the echo */
+#define MAX_READINGS	16
+/*==================[internal data definition]===============================*/
+static hc_sr04_ranger_t ranger;
+static hc_sr04_reading_t readings[MAX_READINGS];
+static int n_readings;
+static uint32_t now_us;
+/*==================[internal functions definition]==========================*/
+static void Slot(void){
+	hc_sr04_reading_t reading;
+	now_us += SLOT_US;
+	if(HcSr04RangerSlot(&ranger, &reading)){
+		readings[n_readings++] = reading;
+	}
+}
+
+static void Edge(uint8_t sensor, bool level, uint32_t time_us){
+	hc_sr04_reading_t reading;
+	if(HcSr04RangerEdge(&ranger, sensor, level, time_us, &reading)){
+		readings[n_readings++] = reading;
+	}
+}
+
+/* Echo of a target at mm, from the trigger of the slot */
+static void Echo(uint8_t sensor, uint16_t mm){
+	uint32_t rise = now_us + ECHO_DELAY_US;
+	Edge(sensor, true, rise);
+	Edge(sensor, false, rise + (uint32_t)mm * HC_SR04_US_PER_CM / 10);
+}
+
+TEST_CASE("HC-SR04 echo timeline", "[hc_sr04]")
+{
+	n_readings = 0;
+	now_us = 0xFFFF0000;		/* The timer wraps during the test */
+	TEST_ASSERT_FALSE(HcSr04RangerInit(&ranger, 0, 0));
+	TEST_ASSERT_FALSE(HcSr04RangerInit(&ranger, HC_SR04_MAX_SENSORS + 1, 0));
+	TEST_ASSERT_TRUE(HcSr04RangerInit(&ranger, 3, 0));
+
+	/* Edges before the first slot are ignored */
+	Echo(0, 500);
+	TEST_ASSERT_EQUAL(0, n_readings);
+
+	/* Sensor 0: 500 mm. The echo of sensor 0 on sensor 1 is ignored */
+	Slot();
+	TEST_ASSERT_EQUAL(0, ranger.current);
+	Echo(1, 800);
+	Echo(0, 500);
+	TEST_ASSERT_EQUAL(1, n_readings);
+	TEST_ASSERT_EQUAL(0, readings[0].sensor);
+	TEST_ASSERT_EQUAL(HC_SR04_OK, readings[0].status);
+	TEST_ASSERT_EQUAL(2950, readings[0].width_us);
+	TEST_ASSERT_EQUAL(500, readings[0].mm);
+	TEST_ASSERT_EQUAL(500, readings[0].median_mm);
+	/* A second fall in the same slot gives nothing */
+	Edge(0, false, now_us + 5000);
+	TEST_ASSERT_EQUAL(1, n_readings);
+
+	/* Sensor 1 disconnected: no echo, known when the next slot starts */
+	Slot();
+	Slot();
+	TEST_ASSERT_EQUAL(2, n_readings);
+	TEST_ASSERT_EQUAL(1, readings[1].sensor);
+	TEST_ASSERT_EQUAL(HC_SR04_NO_ECHO, readings[1].status);
+	TEST_ASSERT_EQUAL(0, readings[1].mm);
+
+	/* Sensor 2: nothing in range, the echo lasts over the maximum */
+	Edge(2, true, now_us + ECHO_DELAY_US);
+	Edge(2, false, now_us + ECHO_DELAY_US + HC_SR04_MAX_ECHO_US + 1);
+	TEST_ASSERT_EQUAL(3, n_readings);
+	TEST_ASSERT_EQUAL(HC_SR04_OUT_OF_RANGE, readings[2].status);
+	TEST_ASSERT_EQUAL(3000, readings[2].mm);
+
+	/* Back to sensor 0, its echo is still high when the slot ends */
+	Slot();
+	TEST_ASSERT_EQUAL(0, ranger.current);
+	Edge(0, true, now_us + ECHO_DELAY_US);
+	Slot();
+	TEST_ASSERT_EQUAL(4, n_readings);
+	TEST_ASSERT_EQUAL(0, readings[3].sensor);
+	TEST_ASSERT_EQUAL(HC_SR04_OUT_OF_RANGE, readings[3].status);
+	/* A fall from the slot before is not an echo */
+	Edge(1, false, now_us + 100);
+	Echo(1, 1234);
+	TEST_ASSERT_EQUAL(5, n_readings);
+	TEST_ASSERT_EQUAL(1, readings[4].sensor);
+	TEST_ASSERT_EQUAL(HcSr04EchoToMm(1234 * HC_SR04_US_PER_CM / 10), readings[4].mm);
+	/* The median only takes distances */
+	TEST_ASSERT_EQUAL(500, ranger.history[0].median_mm);
+}
+
+TEST_CASE("HC-SR04 median and outliers", "[hc_sr04]")
+{
+	const uint16_t mm[] = {1000, 1020, 990, 3000, 1010, 2500, 2510, 2490};
+	const hc_sr04_status_t status[] = {HC_SR04_OK, HC_SR04_OK, HC_SR04_OK, HC_SR04_OUTLIER, HC_SR04_OK,
+									   HC_SR04_OUTLIER, HC_SR04_OUTLIER, HC_SR04_OK};
+	const uint16_t median[] = {1000, 1020, 1000, 1020, 1010, 1020, 2500, 2500};
+
+	n_readings = 0;
+	now_us = 0;
+	HcSr04RangerInit(&ranger, 1, 200);
+	for(int i = 0; i < 8; i++){
+		Slot();
+		Echo(0, mm[i]);
+		TEST_ASSERT_EQUAL(i + 1, n_readings);
+		TEST_ASSERT_EQUAL(status[i], readings[i].status);
+		/* 59 us per cm, the distance rounds down */
+		TEST_ASSERT(mm[i] - readings[i].mm <= 1);
+		TEST_ASSERT(abs(median[i] - readings[i].median_mm) <= 1);
+	}
+}
@@ -0,0 +1,101 @@
+/**
+ * @file test_hx711_filter.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the HX711 decoding and filter
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "unity.h"
+#include "hx711_filter.h"
+/*==================[macros and definitions]=================================*/
+#define WINDOW			4
+/*==================[internal data definition]===============================*/
+static hx711_filter_t filter;
+/*==================[internal functions definition]==========================*/
+TEST_CASE("HX711 decoding", "[hx711]")
+{
+	TEST_ASSERT_EQUAL(0, Hx711Decode(0x000000));
+	TEST_ASSERT_EQUAL(1, Hx711Decode(0x000001));
+	TEST_ASSERT_EQUAL(8388607, Hx711Decode(0x7FFFFF));
+	TEST_ASSERT_EQUAL(-8388608, Hx711Decode(0x800000));
+	TEST_ASSERT_EQUAL(-1, Hx711Decode(0xFFFFFF));
+	/* Only 24 bits */
+	TEST_ASSERT_EQUAL(-1, Hx711Decode(0xABFFFFFF));
+
+	TEST_ASSERT_EQUAL(25, Hx711Pulses(128));
+	TEST_ASSERT_EQUAL(26, Hx711Pulses(32));
+	TEST_ASSERT_EQUAL(27, Hx711Pulses(64));
+	TEST_ASSERT_EQUAL(0, Hx711Pulses(100));
+}
+
+TEST_CASE("HX711 running average", "[hx711]")
+{
+	hx711_sample_t sample;
+	int64_t sum;
+
+	TEST_ASSERT_FALSE(Hx711FilterInit(&filter, 0));
+	TEST_ASSERT_FALSE(Hx711FilterInit(&filter, HX711_RING_SIZE + 1));
+	TEST_ASSERT_TRUE(Hx711FilterInit(&filter, WINDOW));
+	TEST_ASSERT_FALSE(Hx711FilterLast(&filter, &sample));
+	TEST_ASSERT_EQUAL(0, Hx711FilterAverage(&filter));
+
+	/* Fewer samples than the window */
+	Hx711FilterPush(&filter, 100, 1000);
+	Hx711FilterPush(&filter, -50, 1100);
+	TEST_ASSERT_EQUAL(25, Hx711FilterAverage(&filter));
+	TEST_ASSERT_TRUE(Hx711FilterLast(&filter, &sample));
+	TEST_ASSERT_EQUAL(-50, sample.value);
+	TEST_ASSERT_EQUAL(1100, sample.time_us);
+
+	/* Over several turns of the ring, against the sum of the last samples */
+	Hx711FilterInit(&filter, WINDOW);
+	for(int32_t i = 0; i < 3 * HX711_RING_SIZE; i++){
+		int32_t value = (i * 7919) % 2001 - 1000 + 8000000;
+		Hx711FilterPush(&filter, value, 1200 + i * 100);
+		if(i < WINDOW - 1){
+			continue;
+		}
+		sum = 0;
+		for(int32_t j = i; j > i - WINDOW; j--){
+			sum += (j * 7919) % 2001 - 1000 + 8000000;
+		}
+		TEST_ASSERT_EQUAL((int32_t)(sum / WINDOW), Hx711FilterAverage(&filter));
+	}
+	TEST_ASSERT_EQUAL(3 * HX711_RING_SIZE, filter.total);
+	TEST_ASSERT_EQUAL(HX711_RING_SIZE, filter.count);
+
+	/* Window of the whole ring */
+	Hx711FilterInit(&filter, HX711_RING_SIZE);
+	for(int32_t i = 0; i < 2 * HX711_RING_SIZE; i++){
+		Hx711FilterPush(&filter, i, i);
+	}
+	TEST_ASSERT_EQUAL((HX711_RING_SIZE + 2 * HX711_RING_SIZE - 1) / 2, Hx711FilterAverage(&filter));
+}
+
+TEST_CASE("HX711 tare and scale", "[hx711]")
+{
+	Hx711FilterInit(&filter, WINDOW);
+	for(int i = 0; i < WINDOW; i++){
+		Hx711FilterPush(&filter, 84000 + i, i);
+	}
+	Hx711FilterTare(&filter);
+	TEST_ASSERT_EQUAL(84001, filter.offset);
+	TEST_ASSERT_EQUAL_FLOAT(0.0f, Hx711FilterUnits(&filter));
+
+	/* 420 counts per gram */
+	Hx711FilterSetScale(&filter, 420.0f);
+	for(int i = 0; i < WINDOW; i++){
+		Hx711FilterPush(&filter, 84001 + 42000, i);
+	}
+	TEST_ASSERT_FLOAT_WITHIN(0.001f, 100.0f, Hx711FilterUnits(&filter));
+	/* A scale of 0 is ignored */
+	Hx711FilterSetScale(&filter, 0.0f);
+	TEST_ASSERT_EQUAL_FLOAT(420.0f, filter.scale);
+	Hx711FilterSetOffset(&filter, 84001 + 42000 + 420);
+	TEST_ASSERT_FLOAT_WITHIN(0.001f, -1.0f, Hx711FilterUnits(&filter));
+}
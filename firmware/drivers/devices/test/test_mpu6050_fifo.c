@@ -0,0 +1,89 @@
+/**
+ * @file test_mpu6050_fifo.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the MPU6050 FIFO, on recorded frames
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include "unity.h"
+#include "mpu6050_fifo.h"
+/*==================[macros and definitions]=================================*/
+#define N_SAMPLES		4
+/*==================[internal data definition]===============================*/
+/* Three frames read from the FIFO: ACCEL_X, Y, Z, TEMP, GYRO_X, Y, Z, big endian */
+static const uint8_t stream[3 * MPU6050_FIFO_FRAME] = {
+	0x40, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0xF7, 0x00, 0x83, 0xFE, 0xFA, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+	0x80, 0x00, 0x20, 0x00, 0xC0, 0x00, 0xFC, 0x04, 0xFF, 0x7D, 0x00, 0x00, 0x80, 0x00,
+};
+static float ax[N_SAMPLES], ay[N_SAMPLES], az[N_SAMPLES];
+static float gx[N_SAMPLES], gy[N_SAMPLES], gz[N_SAMPLES];
+static float temp[N_SAMPLES];
+/*==================[internal functions definition]==========================*/
+TEST_CASE("MPU6050 FIFO unpack", "[mpu6050]")
+{
+	mpu6050_samples_t samples = {ax, ay, az, gx, gy, gz, temp, N_SAMPLES};
+	mpu6050_fifo_t fifo = {0, 0};
+	mpu6050_scale_t scale;
+
+	Mpu6050ScaleInit(&scale, 0, 0);
+	TEST_ASSERT_EQUAL(3, Mpu6050FifoUnpack(&fifo, &scale, stream, 3, &samples, 0));
+	TEST_ASSERT_EQUAL(3, fifo.frames);
+	TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, ax[0]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-6f, -0.5f, ay[0]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, az[0]);
+	TEST_ASSERT_FLOAT_WITHIN(0.01f, 35.0f, temp[0]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f, gx[0]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-5f, -2.0f, gy[0]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, az[1]);
+	TEST_ASSERT_FLOAT_WITHIN(0.01f, 36.53f, temp[1]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-4f, 32767.0f / 131.0f, gz[1]);
+	/* The ends of the range */
+	TEST_ASSERT_FLOAT_WITHIN(1e-6f, -2.0f, ax[2]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.5f, ay[2]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-6f, -1.0f, az[2]);
+	TEST_ASSERT_FLOAT_WITHIN(0.01f, 33.53f, temp[2]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-5f, -1.0f, gx[2]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-4f, -32768.0f / 131.0f, gz[2]);
+
+	/* Larger ranges, from the second sample on, with no temperature */
+	Mpu6050ScaleInit(&scale, 3, 3);
+	samples.temp = NULL;
+	temp[1] = 0.0f;
+	TEST_ASSERT_EQUAL(1, Mpu6050FifoUnpack(&fifo, &scale, stream, 1, &samples, 1));
+	TEST_ASSERT_FLOAT_WITHIN(1e-6f, 8.0f, ax[1]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-4f, 131.0f / 16.375f, gx[1]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, temp[1]);
+	TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, ax[0]);
+
+	/* Only the frames that fit in the arrays */
+	TEST_ASSERT_EQUAL(1, Mpu6050FifoUnpack(&fifo, &scale, stream, 3, &samples, N_SAMPLES - 1));
+	TEST_ASSERT_EQUAL(0, Mpu6050FifoUnpack(&fifo, &scale, stream, 3, &samples, N_SAMPLES));
+	TEST_ASSERT_EQUAL(5, fifo.frames);
+}
+
+TEST_CASE("MPU6050 FIFO overflow", "[mpu6050]")
+{
+	/* FIFO_COUNT and INT_STATUS recorded on consecutive reads */
+	const uint16_t count[] = {0, 10, 20, 42, 1022, 1008, 1024, 14};
+	const uint8_t status[] = {0x01, 0x01, 0x01, 0x00, 0x01, 0x11, 0x01, 0x01};
+	const mpu6050_fifo_action_t action[] = {MPU6050_FIFO_EMPTY, MPU6050_FIFO_EMPTY, MPU6050_FIFO_READ,
+											MPU6050_FIFO_READ, MPU6050_FIFO_READ, MPU6050_FIFO_RESET,
+											MPU6050_FIFO_RESET, MPU6050_FIFO_READ};
+	const uint16_t frames[] = {0, 0, 1, 3, 8, 0, 0, 1};
+	mpu6050_fifo_t fifo = {0, 0};
+	uint16_t n;
+
+	for(int i = 0; i < 8; i++){
+		TEST_ASSERT_EQUAL(action[i], Mpu6050FifoCheck(&fifo, count[i], status[i], 8, &n));
+		TEST_ASSERT_EQUAL(frames[i], n);
+	}
+	TEST_ASSERT_EQUAL(2, fifo.overflows);
+	TEST_ASSERT_EQUAL(0, fifo.frames);
+}
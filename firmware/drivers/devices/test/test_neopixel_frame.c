@@ -0,0 +1,125 @@
+/**
+ * @file test_neopixel_frame.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the NeoPixel frame, its brightness table and effects
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include "unity.h"
+#include "neopixel_frame.h"
+#include "ws2812b_encoder.h"
+/*==================[macros and definitions]=================================*/
+#define N_PIXELS		60
+/*==================[internal data definition]===============================*/
+static neopixel_color_t colors[N_PIXELS];
+static neopixel_frame_t frame;
+/*==================[internal functions definition]==========================*/
+/* Component sent by NeoPixelSetArray() and ws2812bSend() before the table */
+static uint8_t Sent(uint8_t component, uint8_t bright){
+	return ws2812b_gamma[(component * bright) >> 8];
+}
+
+TEST_CASE("NeoPixel frame brightness table", "[neopixel]")
+{
+	const uint8_t *lut;
+
+	NeoPixelFrameInit(&frame, colors, N_PIXELS);
+	TEST_ASSERT_TRUE(frame.dirty);
+	TEST_ASSERT_EQUAL(NEOPIXEL_MAX_BRIGHT, frame.bright);
+	lut = NeoPixelFrameLut(&frame);
+	for(int c = 0; c < 256; c++){
+		TEST_ASSERT_EQUAL(Sent(c, 255), lut[c]);
+	}
+
+	/* Built again only after a change */
+	frame.dirty = false;
+	frame.lut[0] = 0xAA;
+	NeoPixelFrameBrightness(&frame, 255);
+	TEST_ASSERT_FALSE(frame.dirty);
+	TEST_ASSERT_EQUAL(0xAA, NeoPixelFrameLut(&frame)[0]);
+	NeoPixelFrameBrightness(&frame, 100);
+	TEST_ASSERT_TRUE(frame.dirty);
+	TEST_ASSERT_FALSE(frame.lut_valid);
+	lut = NeoPixelFrameLut(&frame);
+	for(int c = 0; c < 256; c++){
+		TEST_ASSERT_EQUAL(Sent(c, 100), lut[c]);
+	}
+	NeoPixelFrameBrightness(&frame, 0);
+	TEST_ASSERT_EACH_EQUAL_UINT8(0, NeoPixelFrameLut(&frame), 256);
+}
+
+TEST_CASE("NeoPixel frame edits", "[neopixel]")
+{
+	NeoPixelFrameInit(&frame, colors, N_PIXELS);
+	NeoPixelFrameFill(&frame, 0x0000FF);
+	for(int i = 0; i < N_PIXELS; i++){
+		TEST_ASSERT_EQUAL(0x0000FF, colors[i]);
+	}
+
+	/* Only changes make the frame dirty, pixels out of the strip are ignored */
+	frame.dirty = false;
+	NeoPixelFrameSetPixel(&frame, 3, 0x0000FF);
+	TEST_ASSERT_FALSE(frame.dirty);
+	NeoPixelFrameSetPixel(&frame, N_PIXELS, 0x123456);
+	TEST_ASSERT_FALSE(frame.dirty);
+	NeoPixelFrameSetPixel(&frame, 0, NeoPixelRgb2Color(0x12, 0x34, 0x56));
+	NeoPixelFrameSetPixel(&frame, N_PIXELS - 1, 0xFF0000);
+	TEST_ASSERT_TRUE(frame.dirty);
+	TEST_ASSERT_EQUAL(0x123456, colors[0]);
+
+	/* The last color moves to the other end */
+	NeoPixelFrameShift(&frame, true);
+	TEST_ASSERT_EQUAL(0xFF0000, colors[0]);
+	TEST_ASSERT_EQUAL(0x123456, colors[1]);
+	NeoPixelFrameShift(&frame, false);
+	NeoPixelFrameShift(&frame, false);
+	TEST_ASSERT_EQUAL(0x123456, colors[N_PIXELS - 1]);
+	TEST_ASSERT_EQUAL(0xFF0000, colors[N_PIXELS - 2]);
+
+	/* Each component scaled by (scale + 1) / 256 */
+	NeoPixelFrameFade(&frame, 255);
+	TEST_ASSERT_EQUAL(0x123456, colors[N_PIXELS - 1]);
+	NeoPixelFrameFade(&frame, 127);
+	TEST_ASSERT_EQUAL(0x091A2B, colors[N_PIXELS - 1]);
+	TEST_ASSERT_EQUAL(0x7F0000, colors[N_PIXELS - 2]);
+	NeoPixelFrameFade(&frame, 0);
+	TEST_ASSERT_EQUAL(0, colors[N_PIXELS - 2]);
+}
+
+TEST_CASE("NeoPixel frame effects", "[neopixel]")
+{
+	neopixel_effect_t rainbow = {.type = NEOPIXEL_EFFECT_RAINBOW, .step = 0x1000, .hue = 0x8000,
+								 .sat = 200, .val = 150, .reps = 3};
+	neopixel_effect_t shift = {.type = NEOPIXEL_EFFECT_SHIFT, .step = -2};
+	neopixel_effect_t fade = {.type = NEOPIXEL_EFFECT_FADE, .fade = 127};
+	neopixel_color_t first;
+
+	/* The same hues as first_hue + (i * reps * 65536) / length */
+	NeoPixelFrameInit(&frame, colors, N_PIXELS);
+	NeoPixelFrameEffect(&frame, &rainbow);
+	for(uint32_t i = 0; i < N_PIXELS; i++){
+		uint16_t hue = 0x8000 + (i * 3 * 65536) / N_PIXELS;
+		TEST_ASSERT_EQUAL(NeoPixelHSV2Color(hue, 200, 150), colors[i]);
+	}
+	TEST_ASSERT_EQUAL(0x9000, rainbow.hue);
+	NeoPixelFrameEffect(&frame, &rainbow);
+	TEST_ASSERT_EQUAL(NeoPixelHSV2Color(0x9000, 200, 150), colors[0]);
+	NeoPixelFrameRainbow(&frame, 0, 255, 255, 1);
+	TEST_ASSERT_EQUAL(0xFF0000, colors[0]);
+
+	/* Downwards */
+	first = colors[0];
+	NeoPixelFrameEffect(&frame, &shift);
+	TEST_ASSERT_EQUAL(first, colors[N_PIXELS - 2]);
+
+	NeoPixelFrameFill(&frame, 0xFF8040);
+	NeoPixelFrameEffect(&frame, &fade);
+	NeoPixelFrameEffect(&frame, &fade);
+	TEST_ASSERT_EQUAL(0x3F2010, colors[0]);
+}
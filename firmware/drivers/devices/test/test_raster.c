@@ -0,0 +1,215 @@
+/**
+ * @file test_raster.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the span rasteriser
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "raster.h"
+/*==================[macros and definitions]=================================*/
+#define SIZE		64
+/*==================[internal data definition]===============================*/
+/* Alpha of each pixel, as filled by the rasteriser */
+static uint8_t canvas[SIZE][SIZE];
+static uint32_t overlaps;
+/*==================[internal functions definition]==========================*/
+static void Fill(const fb_rect_t *rect, uint16_t color, uint8_t alpha, void *param){
+	(void)color;
+	(void)param;
+	for(int16_t y = rect->y0; y <= rect->y1; y++){
+		for(int16_t x = rect->x0; x <= rect->x1; x++){
+			overlaps += canvas[y][x] != 0;
+			canvas[y][x] = alpha;
+		}
+	}
+}
+
+static void Init(raster_t *raster){
+	fb_rect_t clip = {0, 0, SIZE - 1, SIZE - 1};
+	memset(canvas, 0, sizeof(canvas));
+	overlaps = 0;
+	RasterInit(raster, &clip, Fill, NULL);
+}
+
+static uint32_t Count(void){
+	uint32_t count = 0;
+	for(int y = 0; y < SIZE; y++){
+		for(int x = 0; x < SIZE; x++){
+			count += canvas[y][x] != 0;
+		}
+	}
+	return count;
+}
+
+/* Sum of the alpha of the pixels, in pixels */
+static float Coverage(void){
+	uint32_t sum = 0;
+	for(int y = 0; y < SIZE; y++){
+		for(int x = 0; x < SIZE; x++){
+			sum += canvas[y][x];
+		}
+	}
+	return sum / 255.0f;
+}
+
+TEST_CASE("Raster lines merge their runs", "[raster]")
+{
+	raster_t raster;
+
+	/* Horizontal and vertical: one rectangle */
+	Init(&raster);
+	RasterLine(&raster, 3, 5, 40, 5, 1);
+	TEST_ASSERT_EQUAL(1, raster.fills);
+	TEST_ASSERT_EQUAL(38, Count());
+	Init(&raster);
+	RasterLine(&raster, 7, 50, 7, 2, 1);
+	TEST_ASSERT_EQUAL(1, raster.fills);
+	TEST_ASSERT_EQUAL(49, Count());
+
+	/* Shallow: one run per row, the ends included */
+	Init(&raster);
+	RasterLine(&raster, 0, 0, 59, 5, 1);
+	TEST_ASSERT_EQUAL(6, raster.fills);
+	TEST_ASSERT_EQUAL(60, Count());
+	TEST_ASSERT_TRUE(canvas[0][0] && canvas[5][59]);
+
+	/* Diagonal: a pixel per row, in any direction */
+	Init(&raster);
+	RasterLine(&raster, 20, 20, 10, 30, 1);
+	TEST_ASSERT_EQUAL(11, raster.fills);
+	TEST_ASSERT_EQUAL(11, Count());
+	TEST_ASSERT_TRUE(canvas[20][20] && canvas[30][10] && canvas[25][15]);
+	TEST_ASSERT_EQUAL(0, overlaps);
+}
+
+TEST_CASE("Raster clipping", "[raster]")
+{
+	raster_t raster;
+	fb_rect_t clip = {10, 10, 19, 19};
+
+	Init(&raster);
+	RasterInit(&raster, &clip, Fill, NULL);
+	RasterLine(&raster, -100, 15, 100, 15, 1);
+	RasterFillCircle(&raster, 10, 10, 3, 1);
+	RasterCircle(&raster, 200, 200, 5, 1);
+	TEST_ASSERT_EQUAL(10 + 13, Count());
+	for(int i = 0; i < SIZE; i++){
+		TEST_ASSERT_EQUAL(0, canvas[9][i] + canvas[20][i] + canvas[i][9] + canvas[i][20]);
+	}
+}
+
+TEST_CASE("Raster circles", "[raster]")
+{
+	static uint8_t outline[SIZE][SIZE];
+	raster_t raster;
+	uint32_t filled;
+
+	Init(&raster);
+	RasterFillCircle(&raster, 30, 30, 20, 1);
+	filled = Count();
+	/* pi * (20.5)^2 = 1320 */
+	TEST_ASSERT(filled > 1280 && filled < 1360);
+	/* At most a rectangle per row, equal rows merged */
+	TEST_ASSERT(raster.fills < 41);
+	for(int d = 0; d <= 20; d++){
+		TEST_ASSERT_EQUAL(canvas[30 - d][30], canvas[30 + d][30]);
+		TEST_ASSERT_EQUAL(canvas[30][30 - d], canvas[30][30 + d]);
+	}
+
+	/* The outline is the edge of the filled circle, without holes */
+	memcpy(outline, canvas, sizeof(canvas));
+	Init(&raster);
+	RasterCircle(&raster, 30, 30, 20, 1);
+	for(int y = 0; y < SIZE; y++){
+		for(int x = 0; x < SIZE; x++){
+			if(canvas[y][x]){
+				TEST_ASSERT(outline[y][x]);
+			}
+		}
+	}
+	TEST_ASSERT_TRUE(canvas[10][30] && canvas[50][30] && canvas[30][10] && canvas[30][50]);
+	TEST_ASSERT_FALSE(canvas[30][30]);
+	TEST_ASSERT_EQUAL(0, overlaps);
+}
+
+TEST_CASE("Raster polygons", "[raster]")
+{
+	raster_t raster;
+	fb_point_t square[] = {{5, 5}, {14, 5}, {14, 14}, {5, 14}};
+	fb_point_t triangle[] = {{0, 0}, {20, 0}, {0, 20}};
+	fb_point_t bow[] = {{0, 0}, {10, 10}, {10, 0}, {0, 10}};
+
+	/* Edges included: 10 x 10 pixels, one rectangle */
+	Init(&raster);
+	RasterFillPolygon(&raster, square, 4, 1);
+	TEST_ASSERT_EQUAL(100, Count());
+	TEST_ASSERT_EQUAL(1, raster.fills);
+
+	Init(&raster);
+	RasterFillPolygon(&raster, triangle, 3, 1);
+	TEST_ASSERT_EQUAL(21 * 22 / 2, Count());
+	TEST_ASSERT_EQUAL(0, overlaps);
+
+	/* Too few or too many vertices */
+	Init(&raster);
+	RasterFillPolygon(&raster, square, 2, 1);
+	RasterFillPolygon(&raster, square, RASTER_MAX_VERTICES + 1, 1);
+	TEST_ASSERT_EQUAL(0, Count());
+
+	/* Self intersecting: both halves of the bow tie */
+	Init(&raster);
+	RasterFillPolygon(&raster, bow, 4, 1);
+	TEST_ASSERT_TRUE(canvas[5][1] && canvas[5][9] && canvas[5][5]);
+	TEST_ASSERT_FALSE(canvas[1][5]);
+}
+
+TEST_CASE("Raster anti-aliasing", "[raster]")
+{
+	raster_t raster;
+	fb_point_t square[] = {{5, 5}, {15, 5}, {15, 15}, {5, 15}};
+	fb_point_t triangle[] = {{0, 0}, {40, 0}, {0, 30}};
+
+	/* Vertices on the pixel centers: half covered edges, area 10 x 10 */
+	Init(&raster);
+	RasterFillPolygonAA(&raster, square, 4, 1);
+	TEST_ASSERT_FLOAT_WITHIN(0.5f, 100.0f, Coverage());
+	TEST_ASSERT_EQUAL(RASTER_OPAQUE, canvas[10][10]);
+	TEST_ASSERT(abs(canvas[10][5] - 128) <= 4);
+	TEST_ASSERT(abs(canvas[5][5] - 64) <= 4);
+
+	Init(&raster);
+	RasterFillPolygonAA(&raster, triangle, 3, 1);
+	TEST_ASSERT_FLOAT_WITHIN(3.0f, 600.0f, Coverage());
+
+	/* Lines: horizontal is solid, otherwise each column adds up to one pixel */
+	Init(&raster);
+	RasterLineAA(&raster, 2, 3, 50, 3, 1);
+	TEST_ASSERT_EQUAL(1, raster.fills);
+	TEST_ASSERT_EQUAL(49, Count());
+	Init(&raster);
+	RasterLineAA(&raster, 0, 0, 40, 13, 1);
+	for(int x = 0; x <= 40; x++){
+		int sum = 0;
+		for(int y = 0; y < SIZE; y++){
+			sum += canvas[y][x];
+		}
+		TEST_ASSERT(abs(sum - 255) <= 2);
+	}
+}
+
+TEST_CASE("Raster color blending", "[raster]")
+{
+	TEST_ASSERT_EQUAL(0xF800, RasterBlend(0xF800, 0x001F, RASTER_OPAQUE));
+	TEST_ASSERT_EQUAL(0x001F, RasterBlend(0xF800, 0x001F, 0));
+	/* Half white over black: mid grey */
+	TEST_ASSERT_EQUAL(0x7BEF, RasterBlend(0xFFFF, 0x0000, 128));
+	TEST_ASSERT_EQUAL(0x07E0, RasterBlend(0x07E0, 0x07E0, 77));
+}
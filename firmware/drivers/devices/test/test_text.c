@@ -0,0 +1,245 @@
+/**
+ * @file test_text.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the glyph cache, text lines and fields
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "unity.h"
+#include "text.h"
+#include "icons.h"
+#include "fonts_pack.h"
+/*==================[macros and definitions]=================================*/
+#define WIDTH		160
+#define HEIGHT		64
+#define FG			0xFFE0
+#define BG			0x001F
+/*==================[internal data definition]===============================*/
+/* Display memory, written through the window and write functions (display byte order) */
+static uint16_t screen[WIDTH * HEIGHT];
+static uint16_t expected[WIDTH * HEIGHT];
+static fb_rect_t window;
+static uint32_t cursor;
+static uint16_t cache[2048];
+static uint16_t band[WIDTH * 4];
+/*==================[internal functions definition]==========================*/
+static void Window(const fb_rect_t *area, void *param){
+	(void)param;
+	window = *area;
+	cursor = 0;
+}
+
+static void Write(const uint16_t *pixels, uint32_t count, void *param){
+	uint16_t width = window.x1 - window.x0 + 1;
+	(void)param;
+	for(uint32_t i = 0; i < count; i++, cursor++){
+		TEST_ASSERT(window.y0 + cursor / width <= window.y1);
+		screen[(window.y0 + cursor / width) * WIDTH + window.x0 + cursor % width] = pixels[i];
+	}
+}
+
+static void Init(text_t *text, uint16_t *cache_memory, uint32_t cache_pixels){
+	text_config_t config = {
+		.width = WIDTH, .height = HEIGHT,
+		.cache = cache_memory, .cache_pixels = cache_pixels,
+		.band = band, .band_pixels = sizeof(band) / sizeof(band[0]),
+		.window_p = Window, .write_p = Write,
+	};
+	memset(screen, 0, sizeof(screen));
+	TEST_ASSERT_TRUE(TextInit(text, &config));
+}
+
+static uint16_t Swap(uint16_t color){
+	return (uint16_t)(color << 8 | color >> 8);
+}
+
+/* Reference: a character decoded bit by bit, as ILI9341DrawChar() did */
+static void Reference(int x, int y, char c, const Font_t *font){
+	const char_info_t *info = &font->info[c - ' '];
+	for(int i = 0; i < font->font_height; i++){
+		for(int j = 0; j < info->width; j++){
+			uint8_t byte = font->data[info->offset + i * ((info->width + 7) / 8) + j / 8];
+			expected[(y + i) * WIDTH + x + j] = Swap((byte & (0x80 >> (j % 8))) ? FG : BG);
+		}
+	}
+}
+
+static void ReferenceFill(int x0, int y0, int x1, int y1){
+	for(int y = y0; y <= y1; y++){
+		for(int x = x0; x <= x1; x++){
+			expected[y * WIDTH + x] = Swap(BG);
+		}
+	}
+}
+
+TEST_CASE("Text line in one window", "[text]")
+{
+	const char *str = "Dist: 12.5 cm";
+	text_t text;
+	int x = 3;
+
+	/* Same pixels with and without cache */
+	for(int pass = 0; pass < 2; pass++){
+		Init(&text, pass ? cache : NULL, pass ? sizeof(cache) / sizeof(cache[0]) : 0);
+		memset(expected, 0, sizeof(expected));
+		TEST_ASSERT_EQUAL(strlen(str), TextDraw(&text, 3, 10, str, &font_22, FG, BG));
+		TEST_ASSERT_EQUAL(1, text.stats.windows);
+		TEST_ASSERT_EQUAL(TextWidth(&font_22, str, strlen(str)), window.x1 - window.x0 + 1);
+
+		/* Gaps between characters in the background color */
+		x = 3;
+		ReferenceFill(3, 10, window.x1, 10 + 22 - 1);
+		for(const char *c = str; *c != '\0'; c++){
+			Reference(x, 10, *c, &font_22);
+			x += font_22.info[*c - ' '].width + 1;
+		}
+		TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, screen, sizeof(screen));
+	}
+
+	/* Up to the right edge, and the end of the line */
+	TEST_ASSERT_EQUAL(5, TextDraw(&text, 0, 0, "12345\n678", &font_11, FG, BG));
+	TEST_ASSERT(TextDraw(&text, WIDTH - 40, 0, "0123456789", &font_22, FG, BG) < 10);
+	TEST_ASSERT(window.x1 < WIDTH);
+	/* Rows below the display are not sent */
+	TextDraw(&text, 0, HEIGHT - 5, "A", &font_22, FG, BG);
+	TEST_ASSERT_EQUAL(HEIGHT - 1, window.y1);
+}
+
+TEST_CASE("Text glyph cache", "[text]")
+{
+	text_t text;
+	uint32_t digit = font_22.info['0' - ' '].width * 22;
+
+	Init(&text, cache, sizeof(cache) / sizeof(cache[0]));
+	TextDraw(&text, 0, 0, "1010", &font_22, FG, BG);
+	TEST_ASSERT_EQUAL(2, text.n_glyphs);
+	TEST_ASSERT_EQUAL(2, text.stats.misses);
+
+	/* Same text: no glyph expanded */
+	TextDraw(&text, 0, 30, "0110", &font_22, FG, BG);
+	TEST_ASSERT_EQUAL(2, text.stats.misses);
+	/* Other colors are other glyphs */
+	TextDraw(&text, 0, 30, "0", &font_22, BG, FG);
+	TEST_ASSERT_EQUAL(3, text.n_glyphs);
+
+	/* Room for three digits: the least recently used one is dropped */
+	Init(&text, cache, 3 * digit);
+	TextDraw(&text, 0, 0, "0", &font_22, FG, BG);
+	TextDraw(&text, 0, 0, "2", &font_22, FG, BG);
+	TextDraw(&text, 0, 0, "3", &font_22, FG, BG);
+	TextDraw(&text, 0, 0, "0", &font_22, FG, BG);
+	TextDraw(&text, 0, 0, "5", &font_22, FG, BG);
+	TEST_ASSERT_EQUAL(1, text.stats.evictions);
+	TEST_ASSERT_EQUAL(3, text.n_glyphs);
+	text.stats.misses = 0;
+	TextDraw(&text, 0, 0, "0", &font_22, FG, BG);
+	TextDraw(&text, 0, 0, "3", &font_22, FG, BG);
+	TEST_ASSERT_EQUAL(0, text.stats.misses);
+	TextDraw(&text, 0, 0, "2", &font_22, FG, BG);
+	TEST_ASSERT_EQUAL(1, text.stats.misses);
+
+	/* The cache is compacted: what is drawn is still right */
+	memset(expected, 0, sizeof(expected));
+	memset(screen, 0, sizeof(screen));
+	TextDraw(&text, 0, 0, "2", &font_22, FG, BG);
+	TextDraw(&text, 20, 0, "5", &font_22, FG, BG);
+	TextDraw(&text, 40, 0, "3", &font_22, FG, BG);
+	Reference(0, 0, '2', &font_22);
+	Reference(20, 0, '5', &font_22);
+	Reference(40, 0, '3', &font_22);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, screen, sizeof(screen));
+
+	/* Larger than the cache: expanded each time */
+	TextDraw(&text, 0, 0, "W", &font_59, FG, BG);
+	TEST_ASSERT_EQUAL(3, text.n_glyphs);
+}
+
+TEST_CASE("Text fields redraw the changed cells", "[text]")
+{
+	static uint16_t full[WIDTH * HEIGHT];
+	text_field_t field;
+	text_t text;
+
+	TEST_ASSERT_FALSE(TextFieldInit(&field, 0, 0, TEXT_FIELD_MAX + 1, &font_30, FG, BG));
+	TEST_ASSERT_TRUE(TextFieldInit(&field, 10, 5, 6, &font_30, FG, BG));
+	TEST_ASSERT_EQUAL(15 + 1, field.cell);
+
+	/* The whole field the first time */
+	Init(&text, cache, sizeof(cache) / sizeof(cache[0]));
+	TextFieldDraw(&text, &field, "123.4");
+	TEST_ASSERT_EQUAL(1, text.stats.windows);
+	TEST_ASSERT_EQUAL(6 * field.cell * 30, text.stats.pixels);
+
+	/* Only the last digit, then a run of two */
+	text.stats.windows = text.stats.pixels = 0;
+	TextFieldDraw(&text, &field, "123.7");
+	TEST_ASSERT_EQUAL(1, text.stats.windows);
+	TEST_ASSERT_EQUAL(field.cell * 30, text.stats.pixels);
+	TEST_ASSERT_EQUAL(10 + 5 * field.cell, window.x0);
+	TextFieldDraw(&text, &field, "145.7");
+	TEST_ASSERT_EQUAL(2, text.stats.windows);
+	TextFieldDraw(&text, &field, "145.7");
+	TEST_ASSERT_EQUAL(2, text.stats.windows);
+	/* Two runs */
+	TextFieldDraw(&text, &field, "-945.1");
+	TEST_ASSERT_EQUAL(4, text.stats.windows);
+	memcpy(full, screen, sizeof(screen));
+
+	/* Same pixels as drawing the last value at once */
+	Init(&text, cache, sizeof(cache) / sizeof(cache[0]));
+	TextFieldInvalidate(&field);
+	TextFieldDraw(&text, &field, "-945.1");
+	TEST_ASSERT_EQUAL(1, text.stats.windows);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(full, screen, sizeof(screen));
+
+	/* Longer than the field: the last characters */
+	TextFieldDraw(&text, &field, "12345678");
+	TEST_ASSERT_EQUAL(0, memcmp(field.text, "345678", 6));
+}
+
+TEST_CASE("Packed text matches the font", "[text]")
+{
+	static uint16_t font[WIDTH * HEIGHT];
+	const char *str = "Dist: 12.5 cm";
+	text_field_t field;
+	text_t text;
+
+	/* font_pack_22 is font_22 at 1 bpp: same pixels, decoded by bands */
+	Init(&text, cache, sizeof(cache) / sizeof(cache[0]));
+	TextDraw(&text, 3, 10, str, &font_22, FG, BG);
+	memcpy(font, screen, sizeof(screen));
+	Init(&text, NULL, 0);
+	TEST_ASSERT_EQUAL(strlen(str), TextDrawPacked(&text, 3, 10, str, &font_pack_22, FG, BG));
+	TEST_ASSERT_EQUAL(1, text.stats.windows);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(font, screen, sizeof(screen));
+
+	/* Icons */
+	Init(&text, NULL, 0);
+	memset(expected, 0, sizeof(expected));
+	TextDrawPackedGlyph(&text, 7, 2, ICON_BAT_3, &icon_pack_30, FG, BG);
+	for(int i = 0; i < icon_30.height; i++){
+		for(int j = 0; j < icon_30.width; j++){
+			uint8_t byte = icon_30.data[ICON_BAT_3 * icon_30.offset + i * ((icon_30.width + 7) / 8) + j / 8];
+			expected[(2 + i) * WIDTH + 7 + j] = Swap((byte & (0x80 >> (j % 8))) ? FG : BG);
+		}
+	}
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, screen, sizeof(screen));
+
+	/* Fields: characters the font does not have are left blank */
+	TEST_ASSERT_TRUE(TextFieldInitPacked(&field, 0, 0, 4, &font_pack_59_digits, FG, BG));
+	for(const char *c = "0123456789-."; *c != '\0'; c++){
+		TEST_ASSERT(FontPackWidth(&font_pack_59_digits, c, 1) < field.cell);
+	}
+	TextFieldDraw(&text, &field, "12.5");
+	text.stats.windows = 0;
+	TextFieldDraw(&text, &field, "12.6");
+	TEST_ASSERT_EQUAL(1, text.stats.windows);
+	TextFieldDraw(&text, &field, "1A.6");
+	TEST_ASSERT_EQUAL(2, text.stats.windows);
+}
@@ -0,0 +1,113 @@
+/**
+ * @file test_ws2812b_encoder.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the WS2812B symbol encoder
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include "unity.h"
+#include "ws2812b_encoder.h"
+/*==================[macros and definitions]=================================*/
+#define RESOLUTION		10000000	/*!< 100 ns ticks */
+#define N_LEDS			4
+/*==================[internal data definition]===============================*/
+static ws2812b_symbol_t symbols[WS2812B_SYMBOLS(N_LEDS)];
+/*==================[internal functions definition]==========================*/
+static uint32_t Duration0(ws2812b_symbol_t symbol){
+	return symbol & 0x7FFF;
+}
+
+static uint32_t Duration1(ws2812b_symbol_t symbol){
+	return (symbol >> 16) & 0x7FFF;
+}
+
+static bool Level0(ws2812b_symbol_t symbol){
+	return (symbol >> 15) & 1;
+}
+
+static bool Level1(ws2812b_symbol_t symbol){
+	return symbol >> 31;
+}
+
+/* Bit sent by a symbol: a 1 is high longer than low */
+static uint8_t Bit(ws2812b_symbol_t symbol){
+	return Duration0(symbol) > Duration1(symbol);
+}
+
+static uint8_t Byte(const ws2812b_symbol_t *symbol){
+	uint8_t byte = 0;
+	for(int i = 0; i < 8; i++){
+		byte = byte << 1 | Bit(symbol[i]);
+	}
+	return byte;
+}
+
+TEST_CASE("WS2812B symbol timing", "[ws2812b]")
+{
+	ws2812b_encoder_t encoder;
+	ws2812b_symbol_t zero, one;
+
+	TEST_ASSERT_FALSE(Ws2812bEncoderInit(&encoder, 1000000));
+	TEST_ASSERT_TRUE(Ws2812bEncoderInit(&encoder, RESOLUTION));
+	zero = encoder.nibble[0x0][0];
+	one = encoder.nibble[0xF][0];
+
+	/* High then low, within 150 ns of the datasheet */
+	TEST_ASSERT(Level0(zero) && !Level1(zero) && Level0(one) && !Level1(one));
+	TEST_ASSERT(abs((int)Duration0(zero) * 100 - WS2812B_T0H_NS) <= 150);
+	TEST_ASSERT(abs((int)Duration1(zero) * 100 - WS2812B_T0L_NS) <= 150);
+	TEST_ASSERT(abs((int)Duration0(one) * 100 - WS2812B_T1H_NS) <= 150);
+	TEST_ASSERT(abs((int)Duration1(one) * 100 - WS2812B_T1L_NS) <= 150);
+	/* Nibbles MSB first */
+	TEST_ASSERT_EQUAL(one, encoder.nibble[0x8][0]);
+	TEST_ASSERT_EQUAL(zero, encoder.nibble[0x8][3]);
+	TEST_ASSERT_EQUAL(one, encoder.nibble[0x1][3]);
+	/* The reset is low for both halves */
+	TEST_ASSERT(!Level0(encoder.reset) && !Level1(encoder.reset));
+	TEST_ASSERT_EQUAL(WS2812B_RESET_US * 10, Duration0(encoder.reset) + Duration1(encoder.reset));
+
+	/* 80 MHz: the reset still fits */
+	TEST_ASSERT_TRUE(Ws2812bEncoderInit(&encoder, 80000000));
+	TEST_ASSERT_EQUAL(WS2812B_RESET_US * 80, Duration0(encoder.reset) + Duration1(encoder.reset));
+}
+
+TEST_CASE("WS2812B strip encoding", "[ws2812b]")
+{
+	const rgb_led_t leds[N_LEDS] = {
+		{.green = 0xFF, .red = 0x00, .blue = 0x80},
+		{.green = 0x01, .red = 0xA5, .blue = 0x5A},
+		{.green = 0x00, .red = 0x00, .blue = 0x00},
+		{.green = 0x12, .red = 0x34, .blue = 0x56},
+	};
+	uint8_t lut[256];
+	ws2812b_encoder_t encoder;
+
+	Ws2812bEncoderInit(&encoder, RESOLUTION);
+	TEST_ASSERT_EQUAL(WS2812B_SYMBOLS(N_LEDS), Ws2812bEncode(&encoder, leds, N_LEDS, NULL, symbols));
+	/* Green, red and blue, MSB first */
+	for(int i = 0; i < N_LEDS; i++){
+		TEST_ASSERT_EQUAL(leds[i].green, Byte(&symbols[i * 24]));
+		TEST_ASSERT_EQUAL(leds[i].red, Byte(&symbols[i * 24 + 8]));
+		TEST_ASSERT_EQUAL(leds[i].blue, Byte(&symbols[i * 24 + 16]));
+	}
+	TEST_ASSERT_EQUAL(encoder.reset, symbols[N_LEDS * 24]);
+
+	/* Through a table */
+	for(int i = 0; i < 256; i++){
+		lut[i] = 255 - i;
+	}
+	Ws2812bEncode(&encoder, leds, N_LEDS, lut, symbols);
+	TEST_ASSERT_EQUAL(0x00, Byte(&symbols[0]));
+	TEST_ASSERT_EQUAL(0x5A, Byte(&symbols[24 + 8]));
+	TEST_ASSERT_EQUAL(0xFF, Byte(&symbols[2 * 24 + 16]));
+
+	/* No LEDs: only the reset */
+	TEST_ASSERT_EQUAL(1, Ws2812bEncode(&encoder, leds, 0, NULL, symbols));
+	TEST_ASSERT_EQUAL(encoder.reset, symbols[0]);
+}
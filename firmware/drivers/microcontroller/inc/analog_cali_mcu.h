@@ -0,0 +1,139 @@
+#ifndef ANALOG_CALI_MCU_H
+#define ANALOG_CALI_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Analog_IO Analog IO
+ ** @{ */
+
+/** \brief Raw to mV conversion of the analog inputs.
+ *
+ * The calibration curve of each channel (given as a raw -> mV function, on the
+ * target the ADC calibration scheme) is sampled once at init and then applied
+ * to whole blocks of samples:
+ *
+ * - LUT mode: one entry per raw value (ANALOG_CALI_LUT_SIZE * 2 bytes per channel).
+ * - Polynomial mode: least squares fit of order 1 (linear) to ANALOG_CALI_POLY_MAX_ORDER,
+ *   evaluated in fixed point. For memory constrained builds, define
+ *   ANALOG_CALI_USE_LUT to 0 to use it in the analog driver.
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ * | 19/10/2026 | Conversion of decimated values (fractional bits)						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#ifndef ANALOG_CALI_USE_LUT
+#define ANALOG_CALI_USE_LUT			1
+#endif
+
+#define ANALOG_CALI_BITS			12									/*!< ADC resolution */
+#define ANALOG_CALI_LUT_SIZE		(1 << ANALOG_CALI_BITS)				/*!< Entries of a LUT */
+#define ANALOG_CALI_RAW_MASK		(ANALOG_CALI_LUT_SIZE - 1)
+#define ANALOG_CALI_POLY_MAX_ORDER	3
+#define ANALOG_CALI_POLY_Q			16									/*!< Fractional bits of the coefficients */
+/*==================[typedef]================================================*/
+/**
+ * @brief Calibration curve: raw value -> mV
+ */
+typedef int (*analog_cali_curve_t)(uint16_t raw, void *param);
+
+/**
+ * @brief Calibration of a channel
+ */
+typedef struct {
+	const uint16_t *lut;		/*!< raw -> mV table, NULL in polynomial mode */
+	uint8_t order;				/*!< Polynomial order */
+	int32_t coef[ANALOG_CALI_POLY_MAX_ORDER + 1];	/*!< mV * 2^Q for x = raw / 2^ANALOG_CALI_BITS, coef[0] first */
+} analog_cali_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Build the LUT of a channel from its calibration curve
+ *
+ * @param cali Calibration to initialize
+ * @param lut Buffer of ANALOG_CALI_LUT_SIZE entries
+ * @param curve Calibration curve
+ * @param param Calibration curve parameter
+ * @return true on success
+ */
+bool AnalogCaliInitLut(analog_cali_t *cali, uint16_t *lut, analog_cali_curve_t curve, void *param);
+
+/**
+ * @brief Fit a polynomial to the calibration curve of a channel
+ *
+ * @param cali Calibration to initialize
+ * @param order Polynomial order (1 for linear, up to ANALOG_CALI_POLY_MAX_ORDER)
+ * @param curve Calibration curve
+ * @param param Calibration curve parameter
+ * @return true on success
+ */
+bool AnalogCaliInitPoly(analog_cali_t *cali, uint8_t order, analog_cali_curve_t curve, void *param);
+
+/**
+ * @brief Evaluate the polynomial of a calibration
+ *
+ * @param cali Calibration (polynomial mode)
+ * @param raw Raw value
+ * @return Value in mV
+ */
+uint16_t AnalogCaliPoly(const analog_cali_t *cali, uint16_t raw);
+
+/**
+ * @brief Convert a raw value
+ *
+ * @param cali Calibration
+ * @param raw Raw value (the bits above ANALOG_CALI_BITS are ignored)
+ * @return Value in mV
+ */
+static inline uint16_t AnalogCaliConvert(const analog_cali_t *cali, uint16_t raw){
+	raw &= ANALOG_CALI_RAW_MASK;
+	return (cali->lut != NULL) ? cali->lut[raw] : AnalogCaliPoly(cali, raw);
+}
+
+/**
+ * @brief Convert a block of raw values of the same channel
+ *
+ * @note The conversion can be done in place (raw == mv)
+ *
+ * @param cali Calibration
+ * @param raw Raw values (the bits above ANALOG_CALI_BITS are ignored)
+ * @param mv Converted values (in mV)
+ * @param n Number of values
+ */
+void AnalogCaliConvertBlock(const analog_cali_t *cali, const uint16_t *raw, uint16_t *mv, uint32_t n);
+
+/**
+ * @brief Convert a block of values with fractional bits (decimator outputs)
+ *
+ * The curve is interpolated linearly between consecutive raw values.
+ *
+ * @note The conversion can be done in place (value == mv)
+ *
+ * @param cali Calibration
+ * @param value Values with frac_bits fractional bits
+ * @param frac_bits Fractional bits
+ * @param mv Converted values (in mV)
+ * @param n Number of values
+ */
+void AnalogCaliConvertFrac(const analog_cali_t *cali, const uint16_t *value, uint8_t frac_bits, uint16_t *mv, uint32_t n);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef ANALOG_CALI_MCU_H */
+
+/*==================[end of file]============================================*/
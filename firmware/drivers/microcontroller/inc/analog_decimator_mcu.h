@@ -0,0 +1,106 @@
+#ifndef ANALOG_DECIMATOR_MCU_H
+#define ANALOG_DECIMATOR_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Analog_IO Analog IO
+ ** @{ */
+
+/** \brief Oversampling and decimation of the analog inputs.
+ *
+ * CIC decimator: order integrators at the ADC rate and order combs at the
+ * decimated rate, so each input sample costs O(order) additions whatever the
+ * ratio. Order 1 is the moving sum (average of ratio samples).
+ *
+ * The sum of ratio^order samples is returned with extra_bits fractional bits
+ * (12 + extra_bits bits). Oversampling by 4^k gives up to k extra effective
+ * bits when the input has at least 1 LSB of noise. The sum is rounded to the
+ * output resolution, or with dither enabled, truncated after adding a pseudo
+ * random value of up to 1 output LSB, so the requantization error is
+ * unbiased and uncorrelated with the signal.
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define ANALOG_DECIMATOR_MAX_ORDER		3		/*!< Max CIC order */
+#define ANALOG_DECIMATOR_MAX_GROWTH		20		/*!< Max order * log2(ratio) (32 bit registers) */
+#define ANALOG_DECIMATOR_MAX_EXTRA		4		/*!< Max extra bits (16 bit output) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Decimator state
+ */
+typedef struct {
+	uint8_t order;				/*!< CIC order (1 = moving sum) */
+	uint8_t log2_ratio;			/*!< log2 of the decimation ratio */
+	uint8_t shift;				/*!< Right shift from the sum to the output */
+	bool dither;				/*!< Dithered truncation instead of rounding */
+	uint16_t phase;				/*!< Samples since the last output */
+	uint32_t lfsr;				/*!< Dither generator state */
+	uint32_t integrator[ANALOG_DECIMATOR_MAX_ORDER];	/*!< Integrators (modulo 2^32) */
+	uint32_t comb[ANALOG_DECIMATOR_MAX_ORDER];			/*!< Previous input of each comb */
+} analog_decimator_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a decimator
+ *
+ * @param dec Decimator
+ * @param order CIC order: 1 (moving sum) to ANALOG_DECIMATOR_MAX_ORDER
+ * @param ratio Decimation ratio (power of 2, order * log2(ratio) <= ANALOG_DECIMATOR_MAX_GROWTH)
+ * @param extra_bits Fractional bits of the output (up to ANALOG_DECIMATOR_MAX_EXTRA and order * log2(ratio))
+ * @param dither Dithered truncation of the output
+ * @return true on success, false if the parameters are not valid
+ */
+bool AnalogDecimatorInit(analog_decimator_t *dec, uint8_t order, uint16_t ratio, uint8_t extra_bits, bool dither);
+
+/**
+ * @brief Clear the state of a decimator (keeps its configuration)
+ *
+ * @param dec Decimator
+ */
+void AnalogDecimatorReset(analog_decimator_t *dec);
+
+/**
+ * @brief Process one sample
+ *
+ * @param dec Decimator
+ * @param sample Raw value (the bits above 12 are ignored, packed samples can be used)
+ * @param out Output, only written when the function returns true
+ * @return true when an output is ready (every ratio samples)
+ */
+bool AnalogDecimatorPush(analog_decimator_t *dec, uint16_t sample, uint16_t *out);
+
+/**
+ * @brief Process a block of samples of a single channel
+ *
+ * @note In place processing is allowed (out == in)
+ *
+ * @param dec Decimator
+ * @param in Raw values (the bits above 12 are ignored)
+ * @param n Number of input samples
+ * @param out Outputs, room for n / ratio + 1 values
+ * @return Number of outputs
+ */
+uint16_t AnalogDecimatorProcess(analog_decimator_t *dec, const uint16_t *in, uint16_t n, uint16_t *out);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef ANALOG_DECIMATOR_MCU_H */
+
+/*==================[end of file]============================================*/
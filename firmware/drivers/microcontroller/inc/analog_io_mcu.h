@@ -13,6 +13,23 @@
  * 
  * @note The ESP-EDU have 4 analog inputs and 1 analog output, but the designated pin for 
  * the latter is shared with analog output 0 (CH0).
+ * 
+ * In continuous mode the selected channels are scanned by the ADC and the DMA
+ * results are stored in a ring of frames owned by the caller (see analog_ring_mcu.h).
+ * Each frame is handed to a callback (pointer and length, no copy) from the ADC
+ * task, or kept in the ring until it is read with AnalogContinuousRead().
+ * 
+ * A scan group (AnalogScanGroupInit()) converts a set of channels at a common
+ * rate and deinterleaves each frame into one lock-free ring per channel, the
+ * consumer tasks drain their channel in blocks with AnalogScanRead(). Each channel
+ * of a group can be oversampled through a decimator (see analog_decimator_mcu.h),
+ * its ring then receives one value with extra resolution every ratio samples.
+ * 
+ * The calibration curve of each channel is sampled once at init into a raw -> mV
+ * LUT (see analog_cali_mcu.h), used by AnalogInputReadSingle() and by the block
+ * conversions AnalogRawToMv() and AnalogRawToMvChannel().
+ * 
+ * @note Single and continuous modes use the same ADC unit, they can not be used at the same time.
  *
  * @author Albano Peñalva
  *
@@ -21,11 +38,17 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 24/02/2024 | Document creation		                         						|
+ * | 19/10/2026 | DMA continuous mode with a ring of frames       						|
+ * | 19/10/2026 | Scan groups with a sample ring per channel      						|
+ * | 19/10/2026 | Calibrated reads through a per channel LUT      						|
+ * | 19/10/2026 | Oversampling and decimation of scan groups      						|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include "analog_ring_mcu.h"
+#include "analog_decimator_mcu.h"
 /*==================[macros]=================================================*/
 typedef enum adc_ch {
 	CH0 = 0,				/*!< Channel 0 */
@@ -40,6 +63,8 @@ typedef enum adc_mode {
 } adc_mode_t;
 
 #define DAC	0    			/*!< DAC pin. Override CH0 declaration*/
+
+#define ANALOG_CH_MASK(ch)	(1 << (ch))	/*!< Channel bit for analog_continuous_config_t.channels */
 /*==================[typedef]================================================*/
 /**
  * @brief Analog inputs config structure
@@ -50,9 +75,49 @@ typedef struct {
 	adc_mode_t mode;		/*!< Mode: single read or continuous read */
 	void *func_p;			/*!< Pointer to callback function for convertion end (only for continuous mode) */
 	void *param_p;			/*!< Pointer to callback function parameters (only for continuous mode) */
-	uint16_t sample_frec;	/*!< Sample frequency min: 20kHz - max: 2MHz (only for continuous mode)  */
+	uint32_t sample_frec;	/*!< Sample frequency (SOC_ADC_SAMPLE_FREQ_THRES_LOW - SOC_ADC_SAMPLE_FREQ_THRES_HIGH) for all the channels (only for continuous mode)  */
 } analog_input_config_t;	
 
+/**
+ * @brief Frame callback of the continuous mode
+ * 
+ * @param samples Packed samples of the frame (use ANALOG_SAMPLE_CH() and ANALOG_SAMPLE_RAW())
+ * @param len Number of samples
+ * @param param Callback parameter
+ */
+typedef void (*analog_frame_cb_t)(const uint16_t *samples, uint16_t len, void *param);
+
+/**
+ * @brief Continuous mode config structure
+ * 
+ */
+typedef struct {
+	uint8_t channels;		/*!< Scanned channels: ANALOG_CH_MASK(CH1) | ANALOG_CH_MASK(CH2) ... */
+	uint32_t sample_frec;	/*!< Conversion frequency (SOC_ADC_SAMPLE_FREQ_THRES_LOW - SOC_ADC_SAMPLE_FREQ_THRES_HIGH), shared by all the channels */
+	uint16_t frame_len;		/*!< Conversions per frame */
+	uint16_t n_frames;		/*!< Frames of the ring (up to ANALOG_RING_MAX_FRAMES) */
+	uint32_t *storage;		/*!< Ring storage of n_frames * frame_len words */
+	analog_frame_cb_t func_p;	/*!< Called for each frame, NULL to read the frames with AnalogContinuousRead() */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} analog_continuous_config_t;
+
+/**
+ * @brief Scan group config structure
+ * 
+ */
+typedef struct {
+	uint8_t channels;		/*!< Channels of the group: ANALOG_CH_MASK(CH1) | ANALOG_CH_MASK(CH2) ... */
+	uint32_t sample_frec;	/*!< Sample frequency of each channel */
+	uint16_t frame_len;		/*!< Conversions per frame (rounded down to whole scans) */
+	uint16_t n_frames;		/*!< Frames of the DMA ring (up to ANALOG_RING_MAX_FRAMES) */
+	uint32_t *storage;		/*!< DMA ring storage of n_frames * frame_len words */
+	uint16_t *ring_storage[4];	/*!< Sample ring storage of each channel (ring_size samples), indexed by adc_ch_t */
+	uint32_t ring_size;		/*!< Samples of each channel ring (power of 2) */
+	analog_decimator_t *decimator[4];	/*!< Initialized decimator of each channel, NULL to keep every sample */
+	void *func_p;			/*!< Pointer to callback function called after each frame is deinterleaved (from the ADC task) */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} analog_scan_config_t;
+
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -83,6 +148,9 @@ void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value);
 /**
  * @brief Start convertion for ADC module in continuous mode
  * 
+ * All the channels initialized in continuous mode with AnalogInputInit() are
+ * scanned, func_p is called at the end of each frame.
+ * 
  * @param channel Channel selected
  */
 void AnalogStartContinuous(adc_ch_t channel);
@@ -95,12 +163,133 @@ void AnalogStartContinuous(adc_ch_t channel);
 void AnalogStopContinuous(adc_ch_t channel);
 
 /**
- * @brief 
+ * @brief Read the samples of a channel from the last frame
+ * 
+ * @note Only valid inside the convertion end callback (func_p)
  * 
  * @param channel Channel selected.
- * @param values Read variable array
+ * @param values Read variable array (in mV), room for 128 samples
+ * @return Number of samples read
+ */
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+
+/**
+ * @brief Continuous mode initialization (multi-channel scan)
+ * 
+ * @note The ADC is stopped after init, also when it was running: it can be
+ * reconfigured (channels, rate, frame length) at any time, but not from the
+ * frame callback.
+ * 
+ * @param config Continuous mode config structure
+ */
+void AnalogContinuousInit(analog_continuous_config_t *config);
+
+/**
+ * @brief Start the continuous mode conversions
+ */
+void AnalogContinuousStart(void);
+
+/**
+ * @brief Stop the continuous mode conversions
+ */
+void AnalogContinuousStop(void);
+
+/**
+ * @brief Get the oldest frame of the ring (only without frame callback)
+ * 
+ * @param samples Pointer to the packed samples of the frame
+ * @return Number of samples, 0 if there are no frames available
+ */
+uint16_t AnalogContinuousRead(const uint16_t **samples);
+
+/**
+ * @brief Release the frame returned by AnalogContinuousRead()
+ */
+void AnalogContinuousRelease(void);
+
+/**
+ * @brief Number of frames lost because the ring was full
+ * 
+ * @return Frames lost
+ */
+uint32_t AnalogContinuousOverruns(void);
+
+/**
+ * @brief Scan group initialization
+ * 
+ * The ADC is stopped after init, use AnalogContinuousStart() and AnalogContinuousStop().
+ * The rings are reset with the ADC stopped, a running group can be reconfigured.
+ * At least one channel must be selected (ESP_ERR_INVALID_ARG otherwise, nothing changes).
+ * Consecutive channels of a scan are converted 1 / (sample_frec * channels) apart.
+ * 
+ * @param config Scan group config structure
+ */
+void AnalogScanGroupInit(analog_scan_config_t *config);
+
+/**
+ * @brief Drain the samples of a channel of the scan group
+ * 
+ * @note Single consumer per channel
+ * 
+ * @param channel Channel selected
+ * @param values Packed samples read (use AnalogRawToMv() to convert them), or
+ * decimated values if the channel has a decimator (use AnalogDecimatedToMv())
+ * @param n Max number of samples to read
+ * @return Number of samples read
+ */
+uint16_t AnalogScanRead(adc_ch_t channel, uint16_t *values, uint16_t n);
+
+/**
+ * @brief Samples of a channel ready to be read
+ * 
+ * @param channel Channel selected
+ * @return Number of samples
+ */
+uint16_t AnalogScanAvailable(adc_ch_t channel);
+
+/**
+ * @brief Samples of a channel lost because its ring was full
+ * 
+ * @param channel Channel selected
+ * @return Number of samples lost
+ */
+uint32_t AnalogScanDropped(adc_ch_t channel);
+
+/**
+ * @brief Convert a block of packed samples to mV
+ * 
+ * @note The conversion can be done in place (samples == mv)
+ * 
+ * @param samples Packed samples (channel + raw value)
+ * @param mv Converted values (in mV)
+ * @param len Number of samples
+ */
+void AnalogRawToMv(const uint16_t *samples, uint16_t *mv, uint16_t len);
+
+/**
+ * @brief Convert a block of raw values of a single channel to mV
+ * 
+ * @note The conversion can be done in place (raw == mv)
+ * 
+ * @param channel Channel of the values
+ * @param raw Raw values (or packed samples of the channel)
+ * @param mv Converted values (in mV)
+ * @param len Number of values
+ */
+void AnalogRawToMvChannel(adc_ch_t channel, const uint16_t *raw, uint16_t *mv, uint16_t len);
+
+/**
+ * @brief Convert a block of decimated values of a single channel to mV
+ * 
+ * @note The conversion can be done in place (values == mv)
+ * 
+ * @param channel Channel of the values
+ * @param values Decimator outputs
+ * @param extra_bits Extra bits of the decimator
+ * @param mv Converted values (in mV)
+ * @param len Number of values
  */
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+void AnalogDecimatedToMv(adc_ch_t channel, const uint16_t *values, uint8_t extra_bits, uint16_t *mv, uint16_t len);
 
 /**
  * @brief Digital-to-Analog convert.
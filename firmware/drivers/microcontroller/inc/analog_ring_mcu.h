@@ -0,0 +1,194 @@
+#ifndef ANALOG_RING_MCU_H
+#define ANALOG_RING_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Analog_IO Analog IO
+ ** @{ */
+
+/** \brief Frame ring used by the continuous mode of the analog inputs.
+ *
+ * The ADC DMA writes conversion results (4 bytes each, TYPE2 format) into the
+ * free slot of a ring of frames owned by the caller. Once a frame is committed
+ * the results are packed in place as 16 bit samples (channel + raw value), so
+ * the consumer gets a pointer and a length with no extra copy.
+ *
+ * The samples of a multi-channel scan can also be demultiplexed into one sample
+ * ring per channel, so each consumer task drains the blocks of its channel.
+ *
+ * One producer (ADC task) and one consumer are supported without locks. This
+ * module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ * | 19/10/2026 | Per channel sample rings and demultiplexer     						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define ANALOG_RESULT_BYTES		4		/*!< Bytes of each DMA conversion result */
+#define ANALOG_RING_MAX_FRAMES	16		/*!< Max number of frames in a ring */
+#define ANALOG_DEMUX_CHANNELS	8		/*!< Channels that can be tagged in a sample */
+
+#define ANALOG_SAMPLE_RAW(s)		((s) & 0x0FFF)			/*!< Raw value (12 bits) of a packed sample */
+#define ANALOG_SAMPLE_CH(s)			(((s) >> 12) & 0x07)	/*!< Channel of a packed sample */
+#define ANALOG_SAMPLE(ch, raw)		((uint16_t)(((ch) << 12) | ((raw) & 0x0FFF)))	/*!< Pack channel and raw value */
+
+#define ANALOG_RESULT_RAW(r)		((r) & 0x0FFF)			/*!< Raw value of a DMA result (TYPE2) */
+#define ANALOG_RESULT_CH(r)			(((r) >> 13) & 0x07)	/*!< Channel of a DMA result (TYPE2) */
+#define ANALOG_RESULT(ch, raw)		((uint32_t)(((ch) << 13) | ((raw) & 0x0FFF)))	/*!< Build a DMA result (TYPE2) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Ring of conversion frames
+ */
+typedef struct {
+	uint32_t *storage;			/*!< Caller owned storage: n_frames * frame_len words */
+	uint16_t frame_len;			/*!< Conversions per frame */
+	uint16_t n_frames;			/*!< Number of frames (up to ANALOG_RING_MAX_FRAMES) */
+	uint16_t length[ANALOG_RING_MAX_FRAMES];	/*!< Valid samples of each frame */
+	uint32_t head;				/*!< Frames committed (written by the producer only) */
+	uint32_t tail;				/*!< Frames released (written by the consumer only) */
+	uint32_t overruns;			/*!< Frames dropped because the ring was full */
+} analog_ring_t;
+
+/**
+ * @brief Ring of samples of a single channel
+ */
+typedef struct {
+	uint16_t *buffer;			/*!< Caller owned storage of size samples */
+	uint32_t mask;				/*!< size - 1 (size is a power of 2) */
+	uint32_t head;				/*!< Samples written (written by the producer only) */
+	uint32_t tail;				/*!< Samples read (written by the consumer only) */
+	uint32_t dropped;			/*!< Samples lost because the ring was full */
+} analog_sample_ring_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a frame ring
+ *
+ * @param ring Ring to initialize
+ * @param storage Buffer of n_frames * frame_len words (32 bits)
+ * @param frame_len Conversions per frame
+ * @param n_frames Number of frames
+ * @return true on success, false if the parameters are not valid
+ */
+bool AnalogRingInit(analog_ring_t *ring, uint32_t *storage, uint16_t frame_len, uint16_t n_frames);
+
+/**
+ * @brief Get the slot where the next frame must be written (producer side)
+ *
+ * @note Room for frame_len * ANALOG_RESULT_BYTES bytes
+ *
+ * @param ring Frame ring
+ * @return Pointer to the free slot or NULL if the ring is full (counted as overrun)
+ */
+uint32_t * AnalogRingWriteSlot(analog_ring_t *ring);
+
+/**
+ * @brief Pack the DMA results of the write slot and publish it (producer side)
+ *
+ * @param ring Frame ring
+ * @param n_bytes Bytes written by the DMA into the slot
+ * @return Number of samples of the committed frame
+ */
+uint16_t AnalogRingCommit(analog_ring_t *ring, uint32_t n_bytes);
+
+/**
+ * @brief Get the oldest committed frame (consumer side)
+ *
+ * @param ring Frame ring
+ * @param samples Pointer to the packed samples of the frame
+ * @return Number of samples, 0 if there are no frames available
+ */
+uint16_t AnalogRingPeek(analog_ring_t *ring, const uint16_t **samples);
+
+/**
+ * @brief Release the frame returned by AnalogRingPeek (consumer side)
+ *
+ * @param ring Frame ring
+ */
+void AnalogRingRelease(analog_ring_t *ring);
+
+/**
+ * @brief Number of committed frames not released yet
+ *
+ * @param ring Frame ring
+ * @return Frames available
+ */
+uint16_t AnalogRingCount(analog_ring_t *ring);
+
+/**
+ * @brief Pack DMA results (TYPE2 format) into 16 bit samples in place
+ *
+ * @param buffer DMA buffer, the samples are written from its start
+ * @param n_bytes Bytes of results in the buffer
+ * @return Number of samples
+ */
+uint16_t AnalogPackResults(uint32_t *buffer, uint32_t n_bytes);
+
+/**
+ * @brief Initialize a sample ring
+ *
+ * @param ring Ring to initialize
+ * @param buffer Buffer of size samples
+ * @param size Ring size, must be a power of 2
+ * @return true on success, false if the parameters are not valid
+ */
+bool AnalogSampleRingInit(analog_sample_ring_t *ring, uint16_t *buffer, uint32_t size);
+
+/**
+ * @brief Write a block of samples (producer side)
+ *
+ * @param ring Sample ring
+ * @param samples Samples to write
+ * @param n Number of samples
+ * @return Samples written, the rest are counted as dropped
+ */
+uint32_t AnalogSampleRingWrite(analog_sample_ring_t *ring, const uint16_t *samples, uint32_t n);
+
+/**
+ * @brief Read a block of samples (consumer side)
+ *
+ * @param ring Sample ring
+ * @param samples Destination of the samples
+ * @param n Max number of samples to read
+ * @return Samples read
+ */
+uint32_t AnalogSampleRingRead(analog_sample_ring_t *ring, uint16_t *samples, uint32_t n);
+
+/**
+ * @brief Number of samples available to read
+ *
+ * @param ring Sample ring
+ * @return Samples available
+ */
+uint32_t AnalogSampleRingCount(analog_sample_ring_t *ring);
+
+/**
+ * @brief Deinterleave a frame of a multi-channel scan (producer side)
+ *
+ * Each sample is written to the ring of its channel, samples of channels
+ * without ring are discarded. The rings are published once per frame.
+ *
+ * @param samples Packed samples of the frame
+ * @param len Number of samples
+ * @param rings Ring of each channel (indexed by ANALOG_SAMPLE_CH()), NULL to discard
+ */
+void AnalogDemux(const uint16_t *samples, uint16_t len, analog_sample_ring_t *rings[ANALOG_DEMUX_CHANNELS]);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef ANALOG_RING_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,133 @@
+#ifndef DEADLINE_QUEUE_MCU_H
+#define DEADLINE_QUEUE_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Delay Delay
+ ** @{ */
+
+/** \brief Deadlines sorted by time, for a single hardware alarm.
+ *
+ * A binary min-heap of deadlines owned by the caller (a delay on the stack of
+ * the waiting task, for delay_mcu.c): inserting and taking the earliest cost
+ * O(log n), and nothing is allocated. The heap only stores pointers to them,
+ * in a caller owned array that sets the largest number of deadlines.
+ *
+ * Times are in microseconds of a free running 64 bit count, that does not
+ * wrap. The alarm is reprogrammed when an insertion becomes the earliest
+ * deadline, and on each alarm the expired deadlines are taken one by one.
+ *
+ * The functions are not reentrant, the caller serializes them (a critical
+ * section shared by the tasks and the alarm interrupt).
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ * | 19/10/2026 | Removal of a queued deadline (DeadlineQueueRemove)					|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Deadline, owned by the caller while it is queued
+ */
+typedef struct {
+	uint64_t time;				/*!< Expiry, in us */
+	void *param_p;				/*!< Owner (task to wake, timer...) */
+	uint16_t index;				/*!< Position in the heap, while it is queued */
+} deadline_t;
+
+/**
+ * @brief Result of an insertion
+ */
+typedef enum {
+	DEADLINE_FULL,				/*!< Not queued */
+	DEADLINE_LATER,				/*!< Queued after the earliest one, the alarm stays */
+	DEADLINE_FIRST,				/*!< Queued as the earliest one, the alarm must be moved */
+} deadline_insert_t;
+
+/**
+ * @brief Statistics
+ */
+typedef struct {
+	uint32_t inserted;			/*!< Deadlines queued */
+	uint32_t expired;			/*!< Deadlines taken */
+	uint32_t full;				/*!< Deadlines not queued, the heap was full */
+	uint16_t max_depth;			/*!< Most deadlines queued at once */
+} deadline_queue_stats_t;
+
+/**
+ * @brief Deadline queue
+ */
+typedef struct {
+	deadline_t **heap;			/*!< Caller owned storage, heap[0] is the earliest */
+	uint16_t size;				/*!< Capacity */
+	uint16_t count;				/*!< Deadlines queued */
+	deadline_queue_stats_t stats;	/*!< Statistics */
+} deadline_queue_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize an empty queue
+ *
+ * @param queue Queue
+ * @param storage Array of size pointers
+ * @param size Largest number of deadlines
+ */
+void DeadlineQueueInit(deadline_queue_t *queue, deadline_t **storage, uint16_t size);
+
+/**
+ * @brief Queue a deadline
+ *
+ * @param queue Queue
+ * @param deadline Deadline with its time, it must stay valid until it is taken
+ * @return DEADLINE_FIRST if the alarm must be moved to its time
+ */
+deadline_insert_t DeadlineQueueInsert(deadline_queue_t *queue, deadline_t *deadline);
+
+/**
+ * @brief Time of the earliest deadline
+ *
+ * @param queue Queue
+ * @param time Earliest time
+ * @return false if the queue is empty
+ */
+bool DeadlineQueueNext(const deadline_queue_t *queue, uint64_t *time);
+
+/**
+ * @brief Take the earliest deadline if it has expired
+ *
+ * @param queue Queue
+ * @param now Current time
+ * @return Deadline with time <= now, NULL if there is none
+ */
+deadline_t *DeadlineQueuePop(deadline_queue_t *queue, uint64_t now);
+
+/**
+ * @brief Take a deadline out before it expires
+ *
+ * @param queue Queue
+ * @param deadline Deadline
+ * @return true if it was the earliest one (the alarm must be moved), false otherwise or if it was not queued
+ */
+bool DeadlineQueueRemove(deadline_queue_t *queue, deadline_t *deadline);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef DEADLINE_QUEUE_MCU_H */
+
+/*==================[end of file]============================================*/
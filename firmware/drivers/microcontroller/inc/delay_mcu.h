@@ -11,6 +11,19 @@
  *
  * This driver provide functions to generate delays FreeRTOS friendly, using one timer.
  * 
+ * Each delay is a one-shot software timer of timer_mcu.h, on the stack of
+ * the task, so several tasks can be delayed at the same time on the same
+ * hardware timer, each one woken by a task notification. Nothing is allocated
+ * per delay. The other notifications the task receives while it is delayed
+ * (for example from a timer of timer_mcu.h) are given back when it ends.
+ * 
+ * @warning The hardware timer is kept from the first DelayMs() up to 100 ms or
+ * DelayUs() over 50 us on (ILI9341Init() makes such calls). The ESP32-C6 has
+ * only two hardware timers: after that only one of TIMER_A, TIMER_B or TIMER_C
+ * can be initialized, TimerInit() returns false for the other one. If both
+ * were initialized before, the delays wait without yielding the CPU from then
+ * on (the allocation is not tried again).
+ * 
  * @note All delays will block the current RTOS task, with the exception of 
  * DelayUs with usec < 50.
  *
@@ -21,6 +34,9 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | Persistent timer shared by the delayed tasks							|
+ * | 19/10/2026 | Delays on the software timers of timer_mcu.h							|
+ * | 19/10/2026 | Notifications received during a delay are kept						|
  * 
  **/
 
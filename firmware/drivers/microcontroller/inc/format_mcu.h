@@ -0,0 +1,134 @@
+#ifndef FORMAT_MCU_H
+#define FORMAT_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup UART UART
+ ** @{ */
+
+/** \brief Number formatting into caller buffers.
+ *
+ * Re-entrant replacement of UartItoa(): every function writes into the buffer
+ * given by the caller, adds the '\0' and returns the length (without it).
+ * Decimal conversion emits two digits per step from a digit pair table, the
+ * divisions by 100 are done as a multiplication by the reciprocal.
+ *
+ * The buffer must have room for FORMAT_MAX_LEN characters, or for the field
+ * width plus 1 if it is larger. Fields shorter than the width are padded on the
+ * left with the pad character (when it is '0' the sign goes before the zeros).
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stddef.h>
+/*==================[macros]=================================================*/
+#define FORMAT_MAX_LEN		34		/*!< Longest output without padding (32 binary digits, sign and '\0') */
+#define FORMAT_MAX_DECIMALS	9		/*!< Max decimal places of FormatFixed() and FormatFloat() */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Format an unsigned 32 bit number (decimal)
+ *
+ * @param buf Destination buffer
+ * @param value Number
+ * @param width Minimum field width (0 for none)
+ * @param pad Padding character (' ' or '0')
+ * @return Length of the string
+ */
+size_t FormatU32(char *buf, uint32_t value, uint8_t width, char pad);
+
+/**
+ * @brief Format a signed 32 bit number (decimal)
+ *
+ * @param buf Destination buffer
+ * @param value Number
+ * @param width Minimum field width (0 for none)
+ * @param pad Padding character (' ' or '0')
+ * @return Length of the string
+ */
+size_t FormatI32(char *buf, int32_t value, uint8_t width, char pad);
+
+/**
+ * @brief Format an unsigned 64 bit number (decimal)
+ *
+ * @param buf Destination buffer
+ * @param value Number
+ * @param width Minimum field width (0 for none)
+ * @param pad Padding character (' ' or '0')
+ * @return Length of the string
+ */
+size_t FormatU64(char *buf, uint64_t value, uint8_t width, char pad);
+
+/**
+ * @brief Format a signed 64 bit number (decimal)
+ *
+ * @param buf Destination buffer
+ * @param value Number
+ * @param width Minimum field width (0 for none)
+ * @param pad Padding character (' ' or '0')
+ * @return Length of the string
+ */
+size_t FormatI64(char *buf, int64_t value, uint8_t width, char pad);
+
+/**
+ * @brief Format an unsigned number in base 2 to 16 (lowercase digits)
+ *
+ * @param buf Destination buffer
+ * @param value Number
+ * @param base Base (2: binary, 10: decimal, 16: hexadecimal)
+ * @param width Minimum field width (0 for none)
+ * @param pad Padding character (' ' or '0')
+ * @return Length of the string, 0 if the base is not valid
+ */
+size_t FormatBase(char *buf, uint32_t value, uint8_t base, uint8_t width, char pad);
+
+/**
+ * @brief Format a fixed point number: value / 10^decimals
+ *
+ * For example value 1234 with 2 decimals gives "12.34".
+ *
+ * @param buf Destination buffer
+ * @param value Number scaled by 10^decimals
+ * @param decimals Decimal places (up to FORMAT_MAX_DECIMALS)
+ * @param width Minimum field width (0 for none)
+ * @param pad Padding character (' ' or '0')
+ * @return Length of the string
+ */
+size_t FormatFixed(char *buf, int64_t value, uint8_t decimals, uint8_t width, char pad);
+
+/**
+ * @brief Format a float rounded to a number of decimal places
+ *
+ * Values of 2^63 or more (in magnitude) are written as "inf" or "-inf", and
+ * NaN as "nan". Large values keep every decimal place, they are zeros.
+ *
+ * @param buf Destination buffer
+ * @param value Number
+ * @param decimals Decimal places (up to FORMAT_MAX_DECIMALS)
+ * @param width Minimum field width (0 for none)
+ * @param pad Padding character (' ' or '0')
+ * @return Length of the string
+ */
+size_t FormatFloat(char *buf, float value, uint8_t decimals, uint8_t width, char pad);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef FORMAT_MCU_H */
+
+/*==================[end of file]============================================*/
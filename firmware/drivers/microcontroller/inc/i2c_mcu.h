@@ -14,6 +14,15 @@
  * 
  * @note ESP-EDU have 4 I2C connector in the board (J4, J5, J6 and J8), but all of them are routed to the same I2C port.
  *
+ * The reads write the register address and read the data in a single
+ * transaction, with a repeated start in between. I2C_readBurst() reads up to
+ * 65535 bytes that way, for the FIFO of a device.
+ *
+ * The I2C_ functions block the caller. I2C_initQueue() starts a task that
+ * runs the transactions of i2c_queue_mcu.h: scripts of register accesses
+ * submitted at once with I2C_submit(), with a function called when they end,
+ * or run with I2C_run() waiting for them.
+ *
  * @author Juan Ignacio Cerrudo
  * 
  * @section changelog
@@ -21,6 +30,8 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 30/01/2024 | Document creation		                         |
+ * | 19/10/2026 | Reads in a single transaction, I2C_readBurst   |
+ * | 19/10/2026 | Queue of transactions (I2C_initQueue)          |
  *
  */
 
@@ -30,6 +41,7 @@
 #include "esp_log.h"
 #include "driver/i2c.h"
 #include "gpio_mcu.h"
+#include "i2c_queue_mcu.h"
 /*==================[macros]=================================================*/
 
 /*==================[typedef]================================================*/
@@ -109,6 +121,16 @@ int8_t I2C_readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t t
  */
 int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout);
 
+/** @fn I2C_readBurst(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data)
+ * @brief Read a burst of bytes from a device register, in a single transaction.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read from (a FIFO, or the first register)
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @return Status of read operation (true = success)
+ */
+bool I2C_readBurst(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
+
 /** @fn I2C_writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
  * @brief write a single bit in an 8-bit device register.
  * @param devAddr I2C slave device address
@@ -165,6 +187,38 @@ bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *d
  */
 void I2C_SelectRegister(uint8_t devAddr, uint8_t reg);
 
+/** @fn I2C_initQueue(void)
+ * @brief Start the task that runs the queued transactions, after I2C_initialize()
+ * @return Status of operation (true = success)
+ */
+bool I2C_initQueue(void);
+
+/** @fn I2C_submit(i2c_transaction_t *transaction)
+ * @brief Add a transaction to the queue, it does not wait
+ * @param transaction Transaction, kept by the caller until its function is called
+ * @return false if the queue is full or not started
+ */
+bool I2C_submit(i2c_transaction_t *transaction);
+
+/** @fn I2C_run(i2c_transaction_t *transaction, uint32_t timeout_ms)
+ * @brief Run a transaction and wait for it to end
+ * @note Without I2C_initQueue() it runs in the caller. The queue task wakes up
+ * the caller with a task notification, the other notifications received
+ * meanwhile are given back before returning. It never returns while the
+ * transaction is queued: after the timeout it is removed if it has not
+ * started, or waited for if it is running.
+ * @param transaction Transaction
+ * @param timeout_ms Longest wait in the queue
+ * @return true if every operation ended (false if it timed out before starting)
+ */
+bool I2C_run(i2c_transaction_t *transaction, uint32_t timeout_ms);
+
+/** @fn I2C_queueStats(void)
+ * @brief Statistics of the queue
+ * @return Transactions, transfers, merged writes and shadow hits
+ */
+i2c_queue_stats_t I2C_queueStats(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
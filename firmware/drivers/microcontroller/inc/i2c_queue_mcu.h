@@ -0,0 +1,265 @@
+#ifndef I2C_QUEUE_MCU_H
+#define I2C_QUEUE_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup I2C I2C
+ ** @{ */
+
+/** \brief Queue of I2C transactions, each a script of register accesses.
+ *
+ * A transaction is a list of operations on the registers of a device (for
+ * example its whole initialization), submitted at once and run in order by
+ * the only user of the bus, with a function called when it ends:
+ * - A read writes the register address and reads the data with a repeated
+ *   start in between, in a single transfer.
+ * - Consecutive writes to consecutive registers of a device with auto
+ *   increment are merged into a single transfer.
+ * - An update (read-modify-write of some bits) takes the value of the
+ *   register from the shadow of the device, a copy of the last value written
+ *   or read for an update. It only reads the device the first time, and does
+ *   not write it if the bits do not change. Registers changed by the device
+ *   itself (self clearing bits, status) must not be updated this way, or the
+ *   shadow must be invalidated before.
+ *
+ * The bus is reached through a transfer function: i2c_mcu.c uses the I2C
+ * driver of the ESP-IDF from a task, the host tests a simulated bus.
+ * I2cQueueSubmit(), I2cQueueTake() and I2cQueueCancel() must not be called
+ * from two contexts at a time, and I2cQueueRunNext() only from one (the
+ * driver takes care of both).
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+/*==================[macros]=================================================*/
+#define I2C_QUEUE_LENGTH		16		/*!< Transactions waiting (power of 2) */
+#define I2C_QUEUE_MAX_WRITE		32		/*!< Data bytes of a write transfer */
+
+/** @brief Write a byte to a register */
+#define I2C_OP_WRITE_REG(reg, value)			{I2C_OP_WRITE, (reg), (value), 0xFF, 1, NULL}
+/** @brief Write length bytes from data, from a register on */
+#define I2C_OP_WRITE_BYTES(reg, data, length)	{I2C_OP_WRITE, (reg), 0, 0xFF, (length), (uint8_t *)(data)}
+/** @brief Write the bits of mask of a register, the others are kept */
+#define I2C_OP_UPDATE_REG(reg, mask, value)		{I2C_OP_UPDATE, (reg), (value), (mask), 1, NULL}
+/** @brief Read length bytes into data, from a register on */
+#define I2C_OP_READ_BYTES(reg, data, length)	{I2C_OP_READ, (reg), 0, 0xFF, (length), (data)}
+/** @brief Wait ms milliseconds (for example after a reset) */
+#define I2C_OP_DELAY_MS(ms)						{I2C_OP_DELAY, 0, 0, 0, (ms), NULL}
+/*==================[typedef]================================================*/
+/**
+ * @brief Operation of a transaction
+ */
+typedef enum {
+	I2C_OP_WRITE,			/*!< Write bytes from a register on */
+	I2C_OP_READ,			/*!< Read bytes from a register on */
+	I2C_OP_UPDATE,			/*!< Read-modify-write of a register, through the shadow */
+	I2C_OP_DELAY,			/*!< Wait, length is the time in ms */
+} i2c_op_type_t;
+
+/**
+ * @brief Register access (see the I2C_OP_ macros)
+ */
+typedef struct {
+	i2c_op_type_t type;		/*!< Operation */
+	uint8_t reg;			/*!< Register (the first one) */
+	uint8_t value;			/*!< Byte written, when data is NULL */
+	uint8_t mask;			/*!< Bits written by an update */
+	uint16_t length;		/*!< Bytes, or ms of a delay */
+	uint8_t *data;			/*!< Bytes written or read */
+} i2c_op_t;
+
+/**
+ * @brief Device on the bus, with the shadow of its registers
+ */
+typedef struct {
+	uint8_t address;		/*!< 7 bit address */
+	bool auto_increment;	/*!< The register address increments on each byte written */
+	uint8_t shadow[256];	/*!< Last value of each register */
+	uint8_t valid[32];		/*!< Bit of each register with a valid shadow */
+} i2c_device_t;
+
+/**
+ * @brief State of a transaction
+ */
+typedef enum {
+	I2C_TRANSACTION_IDLE,		/*!< Not submitted */
+	I2C_TRANSACTION_PENDING,	/*!< Submitted, not ended */
+	I2C_TRANSACTION_DONE,		/*!< Every operation ended */
+	I2C_TRANSACTION_ERROR,		/*!< A transfer failed (no ACK, timeout), the rest was skipped */
+} i2c_status_t;
+
+typedef struct i2c_transaction_s i2c_transaction_t;
+
+/**
+ * @brief Function called when a transaction ends
+ */
+typedef void (*i2c_done_cb_t)(i2c_transaction_t *transaction, void *param);
+
+/**
+ * @brief Transaction, kept by the caller until it ends
+ */
+struct i2c_transaction_s {
+	i2c_device_t *device;			/*!< Device */
+	const i2c_op_t *ops;			/*!< Operations, they must remain valid */
+	uint8_t n_ops;					/*!< Number of operations */
+	i2c_done_cb_t func_p;			/*!< Called when it ends (NULL if not required) */
+	void *param_p;					/*!< Parameter of func_p */
+	volatile i2c_status_t status;	/*!< State */
+	uint8_t failed_op;				/*!< Operation that failed (I2C_TRANSACTION_ERROR) */
+	void * volatile waiter_p;		/*!< Used by the driver to wake up the caller */
+};
+
+/**
+ * @brief Transfer on the bus: start, tx_len bytes written, and rx_len bytes
+ * read after a repeated start (none if rx_len is 0), stop
+ *
+ * @return false without an ACK or on timeout
+ */
+typedef bool (*i2c_transfer_t)(uint8_t address, const uint8_t *tx, uint16_t tx_len, uint8_t *rx, uint16_t rx_len,
+							   void *param);
+
+/**
+ * @brief Wait of an I2C_OP_DELAY
+ */
+typedef void (*i2c_delay_t)(uint32_t ms, void *param);
+
+/**
+ * @brief Bus of a queue
+ */
+typedef struct {
+	i2c_transfer_t transfer_p;		/*!< Transfer function */
+	i2c_delay_t delay_p;			/*!< Delay function */
+	void *param_p;					/*!< Parameter of transfer_p and delay_p */
+} i2c_queue_config_t;
+
+/**
+ * @brief Statistics of a queue
+ */
+typedef struct {
+	uint32_t transactions;		/*!< Transactions ended */
+	uint32_t errors;			/*!< Transactions ended with an error */
+	uint32_t transfers;			/*!< Transfers on the bus */
+	uint32_t merged;			/*!< Writes merged into the transfer of the previous one */
+	uint32_t shadow_hits;		/*!< Updates that did not read the device */
+	uint32_t skipped;			/*!< Updates that did not write the device (no change) */
+	uint32_t full;				/*!< Submissions rejected, the queue was full */
+} i2c_queue_stats_t;
+
+/**
+ * @brief Queue of a bus
+ */
+typedef struct {
+	i2c_queue_config_t config;						/*!< Bus */
+	i2c_transaction_t *ring[I2C_QUEUE_LENGTH];		/*!< Transactions waiting */
+	volatile uint8_t head;							/*!< Next one submitted */
+	volatile uint8_t tail;							/*!< Next one run */
+	i2c_queue_stats_t stats;						/*!< Statistics */
+} i2c_queue_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a queue, empty
+ *
+ * @param queue Queue
+ * @param config Bus
+ */
+void I2cQueueInit(i2c_queue_t *queue, const i2c_queue_config_t *config);
+
+/**
+ * @brief Initialize a device, with no valid shadow
+ *
+ * @param device Device
+ * @param address 7 bit address
+ * @param auto_increment The register address increments on each byte written
+ */
+void I2cDeviceInit(i2c_device_t *device, uint8_t address, bool auto_increment);
+
+/**
+ * @brief Forget the shadow of the registers (after a reset of the device)
+ *
+ * @param device Device
+ */
+void I2cDeviceInvalidate(i2c_device_t *device);
+
+/**
+ * @brief Shadow of a register
+ *
+ * @param device Device
+ * @param reg Register
+ * @param value Last value written, or read for an update
+ * @return false if the register has no valid shadow
+ */
+bool I2cDeviceShadow(const i2c_device_t *device, uint8_t reg, uint8_t *value);
+
+/**
+ * @brief Add a transaction at the end of the queue
+ *
+ * @param queue Queue
+ * @param transaction Transaction, its status becomes I2C_TRANSACTION_PENDING
+ * @return false if the queue is full
+ */
+bool I2cQueueSubmit(i2c_queue_t *queue, i2c_transaction_t *transaction);
+
+/**
+ * @brief Run the first transaction of the queue, its function is called from here
+ *
+ * @param queue Queue
+ * @return Transaction run, NULL if the queue was empty
+ */
+i2c_transaction_t *I2cQueueRunNext(i2c_queue_t *queue);
+
+/**
+ * @brief Remove the first transaction of the queue, without running it
+ *
+ * @param queue Queue
+ * @return Transaction, NULL if the queue was empty
+ */
+i2c_transaction_t *I2cQueueTake(i2c_queue_t *queue);
+
+/**
+ * @brief Remove a transaction that has not started
+ *
+ * @param queue Queue
+ * @param transaction Transaction, its status becomes I2C_TRANSACTION_IDLE
+ * @return false if it is not in the queue (taken, or never submitted)
+ */
+bool I2cQueueCancel(i2c_queue_t *queue, i2c_transaction_t *transaction);
+
+/**
+ * @brief Run a transaction now, without the queue (the bus must be free)
+ *
+ * @param queue Queue of the bus
+ * @param transaction Transaction, its function is called from here
+ * @return true if every operation ended
+ */
+bool I2cQueueRun(i2c_queue_t *queue, i2c_transaction_t *transaction);
+
+/**
+ * @brief Transactions waiting
+ *
+ * @param queue Queue
+ * @return Number of transactions
+ */
+uint8_t I2cQueuePending(const i2c_queue_t *queue);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* I2C_QUEUE_MCU_H */
+
+/*==================[end of file]============================================*/
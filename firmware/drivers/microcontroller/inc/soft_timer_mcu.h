@@ -0,0 +1,212 @@
+#ifndef SOFT_TIMER_MCU_H
+#define SOFT_TIMER_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Timer Timer
+ ** @{ */
+
+/** \brief Software timers multiplexed on a single hardware alarm.
+ *
+ * Any number of periodic and one-shot timers share one free running count:
+ * their next expiries are kept in a deadline queue (deadline_queue_mcu.h) and
+ * the alarm is always set to the earliest one.
+ *
+ * The expiries of a periodic timer are computed from its start and its
+ * period (start + n * period), not from the previous callback, so the
+ * interrupt latency does not add up. The timers of a group share its origin:
+ * a 2 ms and a 4 ms timer of the same group expire together every 4 ms, on
+ * the same interrupt, and never drift apart.
+ *
+ * Each timer is dispatched either from the alarm interrupt or from a task:
+ * SoftTimerExpire() calls the first ones and lists the others, that the task
+ * takes with SoftTimerTakeTask(). The delay from the expiry to the call is
+ * kept per timer; a periodic timer whose next expiry has already passed
+ * skips it and counts it as missed.
+ *
+ * The functions are not reentrant, the caller serializes them (a critical
+ * section shared by the tasks and the alarm interrupt). The callbacks of
+ * SoftTimerExpire() are called inside it; the driver takes the expired
+ * timers one by one with SoftTimerTakeIsr() instead, and calls them outside
+ * of it, so they can start and stop timers.
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "deadline_queue_mcu.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Function called on each expiry
+ */
+typedef void (*soft_timer_cb_t)(void *param);
+
+/**
+ * @brief Context of the calls
+ */
+typedef enum {
+	SOFT_TIMER_ISR,				/*!< From the alarm interrupt: short, it must not block */
+	SOFT_TIMER_TASK,			/*!< From the dispatch task */
+} soft_timer_dispatch_t;
+
+/**
+ * @brief Common timebase of several timers
+ */
+typedef struct {
+	uint64_t origin;			/*!< Time of the first period, in us */
+} soft_timer_group_t;
+
+/**
+ * @brief Timer configuration
+ */
+typedef struct {
+	uint32_t period;			/*!< Period (in us), 0 for a one-shot */
+	uint32_t delay;				/*!< First expiry after the start (in us), or after the origin of the group.
+								     With 0 a periodic timer first expires after one period */
+	soft_timer_group_t *group_p;	/*!< Group of the timer, NULL for none */
+	soft_timer_dispatch_t dispatch;	/*!< Context of the calls */
+	soft_timer_cb_t func_p;		/*!< Function called on each expiry */
+	void *param_p;				/*!< Parameter of func_p */
+} soft_timer_config_t;
+
+/**
+ * @brief Delay of the calls after the expiries
+ */
+typedef struct {
+	uint32_t calls;				/*!< Calls of the function */
+	uint32_t missed;			/*!< Expiries skipped, they had passed before the previous call */
+	uint32_t min_late;			/*!< Shortest delay (in us) */
+	uint32_t max_late;			/*!< Longest delay (in us), max_late - min_late is the jitter */
+	uint64_t sum_late;			/*!< Sum of the delays (in us), for the mean */
+} soft_timer_stats_t;
+
+/**
+ * @brief Software timer, owned by the caller while it runs
+ */
+typedef struct soft_timer_s {
+	deadline_t deadline;		/*!< Next expiry, in the queue */
+	soft_timer_config_t config;	/*!< Configuration of SoftTimerStart() */
+	uint64_t base;				/*!< Expiry number 0 */
+	uint32_t count;				/*!< Number of the next expiry */
+	volatile bool running;		/*!< Started and not stopped (one-shot: not expired) */
+	bool listed;				/*!< Waiting for the dispatch task */
+	uint64_t listed_time;		/*!< Expiry it is waiting for */
+	struct soft_timer_s *next_p;	/*!< Next timer waiting for the dispatch task */
+	soft_timer_stats_t stats;	/*!< Delay of the calls */
+} soft_timer_t;
+
+/**
+ * @brief Timers on one alarm
+ */
+typedef struct {
+	deadline_queue_t queue;		/*!< Next expiry of each running timer */
+	soft_timer_t *task_head;	/*!< Timers waiting for the dispatch task, oldest first */
+	soft_timer_t *task_tail;
+	uint32_t alarms;			/*!< Calls of SoftTimerExpire() */
+} soft_timer_mux_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a multiplexer without timers
+ *
+ * @param mux Multiplexer
+ * @param storage Array of size pointers
+ * @param size Largest number of running timers
+ */
+void SoftTimerMuxInit(soft_timer_mux_t *mux, deadline_t **storage, uint16_t size);
+
+/**
+ * @brief Set the origin of a group
+ *
+ * @param group Group
+ * @param origin Time of its first period
+ */
+void SoftTimerGroupInit(soft_timer_group_t *group, uint64_t origin);
+
+/**
+ * @brief Start a timer, or restart it with a new configuration
+ *
+ * The statistics are cleared.
+ *
+ * @param mux Multiplexer
+ * @param timer Timer, zeroed before its first start. It must stay valid until it is stopped (or a one-shot expires)
+ * @param config Configuration
+ * @param now Current time
+ * @return false if the multiplexer is full
+ */
+bool SoftTimerStart(soft_timer_mux_t *mux, soft_timer_t *timer, const soft_timer_config_t *config, uint64_t now);
+
+/**
+ * @brief Stop a timer, a call waiting for the task is not done
+ *
+ * @param mux Multiplexer
+ * @param timer Timer
+ */
+void SoftTimerStop(soft_timer_mux_t *mux, soft_timer_t *timer);
+
+/**
+ * @brief Time of the earliest expiry, for the alarm
+ *
+ * @param mux Multiplexer
+ * @param time Earliest expiry
+ * @return false if no timer is running
+ */
+bool SoftTimerNext(const soft_timer_mux_t *mux, uint64_t *time);
+
+/**
+ * @brief Handle the expired timers (alarm interrupt)
+ *
+ * Calls the SOFT_TIMER_ISR functions and lists the SOFT_TIMER_TASK ones.
+ *
+ * @param mux Multiplexer
+ * @param now Current time
+ * @return true if a timer was listed for the dispatch task
+ */
+bool SoftTimerExpire(soft_timer_mux_t *mux, uint64_t now);
+
+/**
+ * @brief Take the next expired SOFT_TIMER_ISR timer (alarm interrupt)
+ *
+ * The expired SOFT_TIMER_TASK timers found before it are listed. The caller
+ * copies its function and parameter, and calls it outside of the critical
+ * section (a one-shot timer may be started again meanwhile).
+ *
+ * @param mux Multiplexer
+ * @param now Current time
+ * @param listed Set to true if a timer was listed for the dispatch task
+ * @return Timer, NULL if no SOFT_TIMER_ISR timer has expired
+ */
+soft_timer_t *SoftTimerTakeIsr(soft_timer_mux_t *mux, uint64_t now, bool *listed);
+
+/**
+ * @brief Take the oldest timer listed for the dispatch task
+ *
+ * The caller calls its function, outside of the critical section.
+ *
+ * @param mux Multiplexer
+ * @param now Current time
+ * @return Timer, NULL if there is none
+ */
+soft_timer_t *SoftTimerTakeTask(soft_timer_mux_t *mux, uint64_t now);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef SOFT_TIMER_MCU_H */
+
+/*==================[end of file]============================================*/
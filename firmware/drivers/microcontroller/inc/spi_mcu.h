@@ -14,6 +14,14 @@
  * 
  * @note MISO: GPIO_22, MOSI: GPIO_21, SCLK: GPIO_20, CS1: GPIO_19, CS2: GPIO_18, CS3: GPIO_9
  * 
+ * Each device has a ring of SPI_QUEUE_SIZE transaction descriptors, allocated
+ * once. SpiQueue() and SpiWriteAsync() fill the next one and return while the
+ * DMA sends it, so the CPU prepares the next transfer meanwhile and the
+ * devices of the bus (display and sensors) keep it busy. Large buffers are
+ * not copied: they are sent in pieces of SPI_MAX_TRANSFER bytes from the
+ * buffer itself. SpiGetResults() takes the tags of the ended transactions in
+ * a batch.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -21,12 +29,16 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 09/02/2024 | Document creation		                         						|
+ * | 19/10/2026 | Queued DMA writes (SpiWriteAsync, SpiWaitAsync)						|
+ * | 19/10/2026 | Queued transactions with results (SpiQueue, SpiGetResults)			|
  * 
  **/
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define SPI_MAX_TRANSFER	4092	/*!< Max bytes of a single transfer (DMA) */
+#define SPI_QUEUE_SIZE		8		/*!< Descriptors of the queued transfers, per device */
 
 /*==================[typedef]================================================*/
 
@@ -75,6 +87,9 @@ typedef struct{
 /**
  * @brief Initialize SPI module with the corresponding configuration
  * 
+ * A device already initialized is removed from the bus and added again with
+ * the new configuration.
+ * 
  * @param spi Structure with the module configuration
  * @return uint8_t 
  */
@@ -83,6 +98,8 @@ uint8_t SpiInit(spi_mcu_config_t* spi);
 /**
  * @brief Read data from SPI port
  * 
+ * The blocking functions first wait for the transactions queued on the device.
+ * 
  * @param device SPI device to read from
  * @param rx_buffer pointer to buffer where data is stored
  * @param rx_buffer_size numbers of bytes to read
@@ -108,9 +125,66 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size);
  */
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size);
 
+/**
+ * @brief Queue a write from SPI port, it returns before the transfer ends
+ * 
+ * The data is sent by DMA while the CPU goes on. When SPI_QUEUE_SIZE
+ * transfers are already queued it waits for the oldest one.
+ * 
+ * @param device SPI device to write to
+ * @param tx_buffer pointer to buffer where data is stored, it must remain valid (and DMA capable) until the transfer ends,
+ * except for writes up to 4 bytes, that are copied
+ * @param tx_buffer_size numbers of bytes to write
+ */
+void SpiWriteAsync(spi_dev_t device, const uint8_t * tx_buffer, uint32_t tx_buffer_size);
+
+/**
+ * @brief Queue a transaction from SPI port, it returns before the transfer ends
+ * 
+ * As SpiWriteAsync(), with a reception and a tag to know when it has ended.
+ * 
+ * @param device SPI device
+ * @param tx_buffer pointer to buffer where data to write is stored, NULL to only read
+ * @param rx_buffer pointer to buffer where data read is stored (DMA capable), NULL to only write
+ * @param size numbers of bytes to read or write, split in transfers of SPI_MAX_TRANSFER
+ * @param user tag returned by SpiGetResults() when the whole transaction has ended, NULL for none
+ */
+void SpiQueue(spi_dev_t device, const uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t size, void *user);
+
+/**
+ * @brief Take the tags of the ended transactions, oldest first
+ * 
+ * Call it at least once every SPI_QUEUE_SIZE tagged transactions, the
+ * older tags are dropped otherwise.
+ * 
+ * @param device SPI device
+ * @param users tags of the ended transactions
+ * @param max_results size of users
+ * @param wait_ms longest wait for the first one, when none has ended
+ * @return uint8_t number of tags
+ */
+uint8_t SpiGetResults(spi_dev_t device, void **users, uint8_t max_results, uint32_t wait_ms);
+
+/**
+ * @brief Queued transfers without result
+ * 
+ * @param device SPI device
+ * @return uint8_t number of transfers
+ */
+uint8_t SpiPending(spi_dev_t device);
+
+/**
+ * @brief Wait until every transfer queued with SpiWriteAsync() or SpiQueue() has ended
+ * 
+ * @param device SPI device
+ */
+void SpiWaitAsync(spi_dev_t device);
+
 /**
  * @brief De-Initialize SPI module with the corresponding configuration
  * 
+ * Waits for the queued transfers and removes the device from the bus.
+ * 
  * @param device SPI device 
  * @return uint8_t 
  */
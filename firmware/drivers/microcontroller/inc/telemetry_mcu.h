@@ -0,0 +1,218 @@
+#ifndef TELEMETRY_MCU_H
+#define TELEMETRY_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup UART UART
+ ** @{ */
+
+/** \brief Binary telemetry frames for the UART.
+ *
+ * Each frame carries a block of samples of one channel:
+ *
+ * | Bytes | Field                                                  |
+ * |:-----:|:-------------------------------------------------------|
+ * | 1     | Channel (0 to TELEMETRY_CHANNELS - 1)                  |
+ * | 1     | Sample type (telemetry_type_t) + TELEMETRY_DELTA flag  |
+ * | 2     | Sequence number of the channel                         |
+ * | 2     | Number of samples                                      |
+ * | n     | Samples                                                |
+ * | 2     | CRC-16/CCITT-FALSE of the previous fields              |
+ *
+ * Multi-byte fields are little-endian. Plain samples are packed little-endian
+ * with the size of their type. Delta encoded samples are zigzag varints: the
+ * first sample, then the difference to the previous one (slow signals take 1
+ * or 2 bytes per sample). The frame is COBS encoded and ends with a 0x00, so
+ * the receiver resynchronizes at the next 0x00 after any error, and the
+ * sequence number lets it count the lost frames of each channel.
+ *
+ * The decoder is the same code on the host tools (firmware/tools/telemetry).
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+/*==================[macros]=================================================*/
+#define TELEMETRY_CHANNELS		16		/*!< Number of channels */
+#define TELEMETRY_MAX_SAMPLES	128		/*!< Max samples per frame */
+#define TELEMETRY_DELTA			0x80	/*!< Type flag: delta + zigzag varint encoding (integer types) */
+#define TELEMETRY_HEADER_LEN	6		/*!< Header bytes */
+#define TELEMETRY_CRC_LEN		2		/*!< CRC bytes */
+#define TELEMETRY_SAMPLE_MAX	5		/*!< Max bytes of a sample (32 bit varint) */
+/** Max length of a frame before COBS */
+#define TELEMETRY_RAW_MAX		(TELEMETRY_HEADER_LEN + TELEMETRY_MAX_SAMPLES * TELEMETRY_SAMPLE_MAX + TELEMETRY_CRC_LEN)
+/** COBS overhead of the longest frame */
+#define TELEMETRY_COBS_OVERHEAD	(1 + TELEMETRY_RAW_MAX / 254)
+/** Max length of an encoded frame, with the 0x00 delimiter */
+#define TELEMETRY_FRAME_MAX		(TELEMETRY_COBS_OVERHEAD + TELEMETRY_RAW_MAX + 1)
+/*==================[typedef]================================================*/
+/**
+ * @brief Sample types
+ */
+typedef enum {
+	TELEMETRY_U8,			/*!< uint8_t */
+	TELEMETRY_I8,			/*!< int8_t */
+	TELEMETRY_U16,			/*!< uint16_t */
+	TELEMETRY_I16,			/*!< int16_t */
+	TELEMETRY_U32,			/*!< uint32_t */
+	TELEMETRY_I32,			/*!< int32_t */
+	TELEMETRY_F32,			/*!< float (never delta encoded) */
+	TELEMETRY_TYPES
+} telemetry_type_t;
+
+/**
+ * @brief Sender state, one per task that sends frames
+ *
+ * A channel must always be sent through the same sender, which keeps its
+ * sequence number.
+ */
+typedef struct {
+	uint16_t seq[TELEMETRY_CHANNELS];		/*!< Next sequence number of each channel */
+	uint8_t frame[TELEMETRY_FRAME_MAX];		/*!< Last encoded frame */
+} telemetry_tx_t;
+
+/**
+ * @brief Decoded block of samples
+ */
+typedef struct {
+	uint8_t channel;		/*!< Channel */
+	uint8_t type;			/*!< Sample type (telemetry_type_t) */
+	bool delta;				/*!< It was delta encoded */
+	uint16_t seq;			/*!< Sequence number */
+	uint16_t count;			/*!< Number of samples */
+	const void *samples;	/*!< Samples, as an array of the sample type */
+} telemetry_block_t;
+
+/**
+ * @brief Function called for every valid frame
+ */
+typedef void (*telemetry_block_cb_t)(const telemetry_block_t *block, void *param);
+
+/**
+ * @brief Receiver statistics
+ */
+typedef struct {
+	uint32_t frames;		/*!< Valid frames */
+	uint32_t lost;			/*!< Frames lost (gaps in the sequence numbers) */
+	uint32_t crc_errors;	/*!< Frames with a wrong CRC */
+	uint32_t format_errors;	/*!< Frames with a wrong COBS encoding, length or type */
+	uint32_t overflows;		/*!< Frames longer than TELEMETRY_RAW_MAX */
+} telemetry_rx_stats_t;
+
+/**
+ * @brief Receiver state
+ */
+typedef struct {
+	telemetry_block_cb_t func_p;			/*!< Function called for every valid frame */
+	void *param_p;							/*!< Parameter of func_p */
+	uint8_t raw[TELEMETRY_FRAME_MAX];		/*!< Frame being received (COBS encoded) */
+	size_t len;								/*!< Bytes of the frame being received */
+	bool overflow;							/*!< Frame being received is too long */
+	uint16_t next_seq[TELEMETRY_CHANNELS];	/*!< Expected sequence number of each channel */
+	uint16_t seen;							/*!< Channels received at least once (bit mask) */
+	union {
+		uint32_t u32[TELEMETRY_MAX_SAMPLES];
+		float f32[TELEMETRY_MAX_SAMPLES];
+	} samples;								/*!< Samples of the last block */
+	telemetry_rx_stats_t stats;				/*!< Statistics */
+} telemetry_rx_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF)
+ *
+ * @param crc Initial value, or the result of the previous chunk
+ * @param data Data
+ * @param len Data length
+ * @return CRC
+ */
+uint16_t TelemetryCrc16(uint16_t crc, const uint8_t *data, size_t len);
+
+/**
+ * @brief COBS encoding, without the 0x00 delimiter
+ *
+ * dst may overlap src when it starts at least 1 + len / 254 bytes before it.
+ *
+ * @param src Data
+ * @param len Data length
+ * @param dst Encoded data (up to len + 1 + len / 254 bytes)
+ * @return Encoded length
+ */
+size_t TelemetryCobsEncode(const uint8_t *src, size_t len, uint8_t *dst);
+
+/**
+ * @brief COBS decoding of a frame without the 0x00 delimiter (it may be done in place)
+ *
+ * @param src Encoded data
+ * @param len Encoded length
+ * @param dst Decoded data (up to len bytes)
+ * @return Decoded length, 0 if the encoding is not valid
+ */
+size_t TelemetryCobsDecode(const uint8_t *src, size_t len, uint8_t *dst);
+
+/**
+ * @brief Initialize a sender (all the sequence numbers at 0)
+ *
+ * @param tx Sender
+ */
+void TelemetryTxInit(telemetry_tx_t *tx);
+
+/**
+ * @brief Encode a block of samples into tx->frame
+ *
+ * @param tx Sender
+ * @param channel Channel (0 to TELEMETRY_CHANNELS - 1)
+ * @param type Sample type, optionally | TELEMETRY_DELTA
+ * @param samples Array of samples of the given type
+ * @param count Number of samples (up to TELEMETRY_MAX_SAMPLES)
+ * @return Frame length (0x00 delimiter included), 0 if the parameters are not valid
+ */
+size_t TelemetryEncode(telemetry_tx_t *tx, uint8_t channel, uint8_t type, const void *samples, uint16_t count);
+
+/**
+ * @brief Initialize a receiver
+ *
+ * @param rx Receiver
+ * @param func_p Function called for every valid frame
+ * @param param_p Parameter of func_p
+ */
+void TelemetryRxInit(telemetry_rx_t *rx, telemetry_block_cb_t func_p, void *param_p);
+
+/**
+ * @brief Feed received bytes, in chunks of any length
+ *
+ * @param rx Receiver
+ * @param data Received bytes
+ * @param len Number of bytes
+ * @return Number of valid frames found
+ */
+uint32_t TelemetryRxPush(telemetry_rx_t *rx, const uint8_t *data, size_t len);
+
+/**
+ * @brief Sample of a decoded block as a double
+ *
+ * @param block Decoded block
+ * @param index Sample index
+ * @return Sample value
+ */
+double TelemetrySample(const telemetry_block_t *block, uint16_t index);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef TELEMETRY_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -9,6 +9,18 @@
  ** @{ */
 
 /** \brief Timer driver for the ESP-EDU Board.
+ * 
+ * Besides TIMER_A, TIMER_B and TIMER_C (one hardware timer each, with a single
+ * callback), any number of software timers run on one more hardware timer,
+ * that counts from TimerMuxInit() and never stops (soft_timer_mcu.h): its
+ * alarm is moved to the earliest expiry. They can be periodic or one-shot,
+ * share the timebase of a group, and call their function from the interrupt
+ * or from a task. DelayUs() and DelayMs() also use them.
+ * 
+ * @note The ESP32-C6 has two hardware timers: with the software timers in use
+ * (including any DelayMs() up to 100 ms or DelayUs() over 50 us, also from
+ * other drivers such as ILI9341Init()) only one of TIMER_A, TIMER_B or
+ * TIMER_C can be initialized. TimerInit() returns false for the other ones.
  * 
  * @author Albano Peñalva
  *
@@ -17,12 +29,17 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | Software timers on one hardware alarm (TimerMux...)					|
+ * | 19/10/2026 | TimerInit() reports a timer that could not be allocated				|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include "stdbool.h"
+#include "soft_timer_mcu.h"
 /*==================[macros]=================================================*/
+#define TIMER_MUX_SIZE		32		/*!< Software timers running at the same time */
 
 /*==================[typedef]================================================*/
 /**
@@ -50,9 +67,14 @@ typedef struct {
  * 
  * @note Timer are stopped after init
  * 
+ * @note The hardware timer is claimed for good, it is never released. The
+ * software timers (and the delays) claim another one the first time they are
+ * used: if none is free they fail from then on, and the delays busy wait.
+ * 
  * @param timer_ini Pointer to timer configuration
+ * @return false if no hardware timer is free (see the note above), the timer does not run
  */
-void TimerInit(timer_config_t *timer_ini);
+bool TimerInit(timer_config_t *timer_ini);
 
 /**
  * @brief Start timer count
@@ -98,6 +120,61 @@ void TimerReset(timer_mcu_t timer);
  */
 void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period);
 
+/**
+ * @brief Start the hardware timer and the task of the software timers
+ * 
+ * It is called by the first TimerMuxStart(), TimerMuxGroupInit() or TimerMuxNow().
+ * 
+ * @return true on success (or if it was already started), false if no
+ * hardware timer was free, then or on a previous call
+ */
+bool TimerMuxInit(void);
+
+/**
+ * @brief Start a software timer, or restart it with a new configuration
+ * 
+ * It can also be called from the function of a timer, even a SOFT_TIMER_ISR one:
+ * those are called by the alarm interrupt without the lock of the timers.
+ * 
+ * @param timer Timer, zeroed before its first start (a static one is). It must stay
+ * valid until it is stopped, or until a one-shot expires
+ * @param config Period, first expiry, group and function
+ * @return false if TIMER_MUX_SIZE timers are already running
+ */
+bool TimerMuxStart(soft_timer_t *timer, const soft_timer_config_t *config);
+
+/**
+ * @brief Stop a software timer
+ * 
+ * @param timer Timer
+ */
+void TimerMuxStop(soft_timer_t *timer);
+
+/**
+ * @brief Set the origin of a group of software timers to now
+ * 
+ * The timers started later in the group expire on its grid: a 2 ms and a 4 ms
+ * timer expire together every 4 ms.
+ * 
+ * @param group Group
+ */
+void TimerMuxGroupInit(soft_timer_group_t *group);
+
+/**
+ * @brief Time of the software timers
+ * 
+ * @return us since TimerMuxInit()
+ */
+uint64_t TimerMuxNow(void);
+
+/**
+ * @brief Delay of the calls of a software timer after its expiries
+ * 
+ * @param timer Timer
+ * @return Statistics since its start
+ */
+soft_timer_stats_t TimerMuxStats(soft_timer_t *timer);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
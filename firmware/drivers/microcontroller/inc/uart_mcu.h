@@ -9,6 +9,21 @@
  ** @{ */
 
 /** \brief UART driver for the ESP-EDU Board.
+ * 
+ * The send functions do not wait for the UART: the data is copied into a TX
+ * ring (see uart_ring_mcu.h) and a task per port sends it in large chunks.
+ * A message that does not fit in the free space of the ring is dropped
+ * whole and counted in the statistics returned by UartGetTxStats(). Only a
+ * message larger than the whole ring (4 KB), sent from a task, is queued in
+ * parts as it is sent: that task waits for the last one, and other tasks
+ * may send between the parts. UartSendInt(), UartSendFixed() and
+ * UartSendFloat() format the number straight into the TX ring (see format_mcu.h).
+ * UartSendTelemetry() sends blocks of samples as binary frames (see telemetry_mcu.h).
+ * 
+ * When a receive function or a parser is configured, a task per port moves
+ * every received byte into an RX ring on each driver event. The parser (see
+ * uart_rx_mcu.h) splits lines or packets and calls the functions of the
+ * command table from that task, then the receive function is called.
  * 
  * @author Albano Peñalva
  *
@@ -17,11 +32,20 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 02/07/2024 | Document creation		                         						|
+ * | 19/10/2026 | Asynchronous transmission through a TX ring    						|
+ * | 19/10/2026 | Re-entrant number sending, UartItoa deprecated  						|
+ * | 19/10/2026 | Binary telemetry frames                         						|
+ * | 19/10/2026 | RX ring, line/packet parser and command table   						|
+ * | 19/10/2026 | Messages larger than the TX ring, sent lengths returned				|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include "stddef.h"
+#include "uart_ring_mcu.h"
+#include "telemetry_mcu.h"
+#include "uart_rx_mcu.h"
 /*==================[macros]=================================================*/
 #define UART_NO_INT	0		/*!< Flag used when no reading interruption is required */
 /*==================[typedef]================================================*/
@@ -40,7 +64,12 @@ typedef struct {
 	uint32_t baud_rate;		/*!< baudrate (bits per second) */
 	void *func_p;			/*!< Pointer to callback function to call when receiving data (= UART_NO_INT if not requiered)*/
 	void *param_p;			/*!< Pointer to callback function parameters */
+	const uart_parser_config_t *parser_p;	/*!< Line/packet parser and command table (NULL if not requiered) */
 } serial_config_t;
+/**
+ * @brief Transmission statistics of a port
+ */
+typedef uart_ring_stats_t uart_tx_stats_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -63,6 +92,9 @@ uint8_t UartReadByte(uart_mcu_port_t port, uint8_t *data);
 /**
  * @brief Read multiple bytes from serial port
  * 
+ * Waits up to 100 ticks for them. Called from the receive function, the
+ * bytes missing in the RX ring are read from the driver.
+ * 
  * @param port Port to read from
  * @param data Pointer to array where data will be stored
  * @param nbytes Number of bytes to be readed
@@ -70,13 +102,22 @@ uint8_t UartReadByte(uart_mcu_port_t port, uint8_t *data);
  */
 uint8_t UartReadBuffer(uart_mcu_port_t port, uint8_t *data, uint16_t nbytes);
 
+/**
+ * @brief Get the reception statistics of a port
+ * 
+ * @param port Port
+ * @param stats Parser counters, line errors and bytes lost
+ */
+void UartGetRxStats(uart_mcu_port_t port, uart_rx_stats_t *stats);
+
 /**
  * @brief Send a single byte trough serial port
  * 
  * @param port Port for sending data
  * @param data Pointer to variable with data to be transmitted
+ * @return Bytes queued, 0 if it was dropped (TX ring full)
  */
-void UartSendByte(uart_mcu_port_t port, const char *data);
+size_t UartSendByte(uart_mcu_port_t port, const char *data);
 
 /**
  * @brief Send a String trough serial port
@@ -85,8 +126,9 @@ void UartSendByte(uart_mcu_port_t port, const char *data);
  * 
  * @param port Port for sending data
  * @param msg Pointer to string to be transmitted
+ * @return Bytes queued, 0 if it was dropped (TX ring full)
  */
-void UartSendString(uart_mcu_port_t port, const char *msg);
+size_t UartSendString(uart_mcu_port_t port, const char *msg);
 
 /**
  * @brief Send multiple bytes through serial port
@@ -94,12 +136,82 @@ void UartSendString(uart_mcu_port_t port, const char *msg);
  * @param port Port for sending data
  * @param data Pointer to array of data to be transmitted
  * @param nbytes Number of bytes to be sended
+ * @return Bytes queued, 0 if it was dropped (TX ring full)
  */
-void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes);
+size_t UartSendBuffer(uart_mcu_port_t port, const char *data, size_t nbytes);
+
+/**
+ * @brief Send several fragments as a single message
+ * 
+ * The fragments are queued in order without interleaving with other tasks,
+ * unless the message is larger than the whole TX ring.
+ * 
+ * @param port Port for sending data
+ * @param iov Fragments to be transmitted
+ * @param n_iov Number of fragments
+ * @return Bytes queued, 0 if the message was dropped (TX ring full)
+ */
+size_t UartSendV(uart_mcu_port_t port, const uart_iov_t *iov, size_t n_iov);
+
+/**
+ * @brief Get the transmission statistics of a port
+ * 
+ * @param port Port selected
+ * @param stats Statistics (bytes queued and dropped, highest TX ring use)
+ */
+void UartGetTxStats(uart_mcu_port_t port, uart_tx_stats_t *stats);
+
+/**
+ * @brief Send a signed integer in decimal
+ * 
+ * @param port Port for sending data
+ * @param value Number to be transmitted
+ * @return Bytes queued, 0 if it was dropped (TX ring full)
+ */
+size_t UartSendInt(uart_mcu_port_t port, int64_t value);
+
+/**
+ * @brief Send a fixed point number (value / 10^decimals, e.g. 1234 with 2 decimals: "12.34")
+ * 
+ * @param port Port for sending data
+ * @param value Number scaled by 10^decimals
+ * @param decimals Decimal places
+ * @return Bytes queued, 0 if it was dropped (TX ring full)
+ */
+size_t UartSendFixed(uart_mcu_port_t port, int64_t value, uint8_t decimals);
+
+/**
+ * @brief Send a float rounded to a number of decimal places
+ * 
+ * @param port Port for sending data
+ * @param value Number to be transmitted
+ * @param decimals Decimal places
+ * @return Bytes queued, 0 if it was dropped (TX ring full)
+ */
+size_t UartSendFloat(uart_mcu_port_t port, float value, uint8_t decimals);
+
+/**
+ * @brief Send a block of samples as a binary telemetry frame
+ * 
+ * The frame is encoded into tx->frame by the calling task and then queued.
+ * Each task that sends telemetry needs its own telemetry_tx_t.
+ * 
+ * @param port Port for sending data
+ * @param tx Sender state (keeps the sequence numbers of its channels)
+ * @param channel Channel (0 to TELEMETRY_CHANNELS - 1)
+ * @param type Sample type (telemetry_type_t), optionally | TELEMETRY_DELTA
+ * @param samples Array of samples of the given type
+ * @param count Number of samples (up to TELEMETRY_MAX_SAMPLES)
+ * @return Bytes queued, 0 if it was dropped (TX ring full or wrong parameters)
+ */
+size_t UartSendTelemetry(uart_mcu_port_t port, telemetry_tx_t *tx, uint8_t channel, uint8_t type, const void *samples, uint16_t count);
 
 /**
  * @brief Convert a number to a String (char array ended with '\0')
  * 
+ * @deprecated The string is kept in a buffer shared by every caller, it is
+ * overwritten by the next call from any task. Use UartSendInt() or FormatBase().
+ * 
  * @param val Number to be converted
  * @param base Base of the converted number (2: binary, 10: decimal, 16: hexadecimal)
  * @return uint8_t* 
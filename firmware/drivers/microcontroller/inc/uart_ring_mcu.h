@@ -0,0 +1,165 @@
+#ifndef UART_RING_MCU_H
+#define UART_RING_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup UART UART
+ ** @{ */
+
+/** \brief Byte ring used by the UART transmission.
+ *
+ * The sending tasks copy their messages into the ring and return at once, the
+ * TX task drains it in contiguous chunks. A message (or every fragment of a
+ * vectored write) is queued whole or dropped whole, drops and the highest
+ * fill level are kept as back-pressure statistics. A message larger than the
+ * free space can also be queued in parts, as the ring drains
+ * (UartRingWritePart()).
+ *
+ * The indexes are lock-free for one producer and one consumer. Several
+ * producers must serialize the write calls (the UART driver uses a critical
+ * section around the copy).
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ * | 19/10/2026 | Messages larger than the free space queued in parts					|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Fragment of a vectored write
+ */
+typedef struct {
+	const void *data;			/*!< Fragment data */
+	size_t len;					/*!< Fragment length */
+} uart_iov_t;
+
+/**
+ * @brief Back-pressure statistics
+ */
+typedef struct {
+	size_t bytes_queued;		/*!< Bytes accepted */
+	size_t bytes_dropped;		/*!< Bytes of the dropped messages */
+	size_t writes_dropped;		/*!< Messages dropped because the ring was full */
+	size_t high_water;			/*!< Highest number of bytes waiting in the ring */
+} uart_ring_stats_t;
+
+/**
+ * @brief Byte ring
+ */
+typedef struct {
+	uint8_t *buffer;			/*!< Caller owned storage */
+	size_t mask;				/*!< size - 1 (size is a power of 2) */
+	size_t head;				/*!< Bytes written (producer) */
+	size_t tail;				/*!< Bytes read (consumer) */
+	uart_ring_stats_t stats;	/*!< Back-pressure statistics */
+} uart_ring_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a byte ring
+ *
+ * @param ring Ring to initialize
+ * @param buffer Storage of size bytes
+ * @param size Ring size, must be a power of 2
+ * @return true on success, false if the parameters are not valid
+ */
+bool UartRingInit(uart_ring_t *ring, uint8_t *buffer, size_t size);
+
+/**
+ * @brief Queue a message (producer side)
+ *
+ * @param ring Byte ring
+ * @param data Message
+ * @param len Message length
+ * @return len if it was queued, 0 if it was dropped
+ */
+size_t UartRingWrite(uart_ring_t *ring, const void *data, size_t len);
+
+/**
+ * @brief Queue the fragments of a message in order (producer side)
+ *
+ * @param ring Byte ring
+ * @param iov Fragments
+ * @param n_iov Number of fragments
+ * @return Total length if it was queued, 0 if it was dropped
+ */
+size_t UartRingWriteV(uart_ring_t *ring, const uart_iov_t *iov, size_t n_iov);
+
+/**
+ * @brief Queue as much of a message as fits, from offset on (producer side)
+ *
+ * The caller calls it again with the bytes queued so far as the ring drains,
+ * until the whole message is queued. Nothing is counted as dropped.
+ *
+ * @param ring Byte ring
+ * @param iov Fragments of the message
+ * @param n_iov Number of fragments
+ * @param offset Bytes of the message already queued
+ * @return Bytes queued by this call
+ */
+size_t UartRingWritePart(uart_ring_t *ring, const uart_iov_t *iov, size_t n_iov, size_t offset);
+
+/**
+ * @brief Get the contiguous free space to write in place (producer side)
+ *
+ * @param ring Byte ring
+ * @param data Pointer to the free space
+ * @return Contiguous bytes available (may be less than the free space when it wraps)
+ */
+size_t UartRingReserve(uart_ring_t *ring, uint8_t **data);
+
+/**
+ * @brief Queue bytes written in place after UartRingReserve (producer side)
+ *
+ * @param ring Byte ring
+ * @param len Bytes written (up to the reserved length)
+ */
+void UartRingCommit(uart_ring_t *ring, size_t len);
+
+/**
+ * @brief Get the oldest contiguous queued bytes (consumer side)
+ *
+ * @param ring Byte ring
+ * @param data Pointer to the queued bytes
+ * @return Contiguous bytes available
+ */
+size_t UartRingPeek(uart_ring_t *ring, const uint8_t **data);
+
+/**
+ * @brief Release bytes returned by UartRingPeek (consumer side)
+ *
+ * @param ring Byte ring
+ * @param len Bytes sent
+ */
+void UartRingConsume(uart_ring_t *ring, size_t len);
+
+/**
+ * @brief Bytes waiting in the ring
+ *
+ * @param ring Byte ring
+ * @return Bytes queued and not consumed
+ */
+size_t UartRingUsed(uart_ring_t *ring);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef UART_RING_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,155 @@
+#ifndef UART_RX_MCU_H
+#define UART_RX_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup UART UART
+ ** @{ */
+
+/** \brief Incremental parser of the UART reception.
+ *
+ * The received bytes are fed in chunks of any length and split into:
+ * - Lines, ended by '\r' or '\n' (empty lines are ignored, so "\r\n" works).
+ *   The first word of the line is looked up in a command table through a
+ *   hash table and its function gets the rest of the line.
+ * - Packets, COBS encoded and ended by 0x00 (see telemetry_mcu.h). Every
+ *   valid packet is passed decoded to the packet function.
+ *
+ * Lines or packets longer than UART_RX_LINE_MAX are discarded up to the next
+ * delimiter. The statistics also hold the line errors counted by the driver.
+ *
+ * This module has no hardware dependencies and is also built on the host tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+/*==================[macros]=================================================*/
+#define UART_RX_LINE_MAX		128		/*!< Max length of a line or encoded packet */
+#define UART_RX_MAX_COMMANDS	32		/*!< Max commands of a table */
+#define UART_RX_HASH_SIZE		64		/*!< Hash table slots (power of 2, twice the commands) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Framing of the received bytes
+ */
+typedef enum {
+	UART_RX_LINES,			/*!< Text lines with commands */
+	UART_RX_PACKETS,		/*!< COBS packets ended by 0x00 */
+} uart_rx_mode_t;
+
+/**
+ * @brief Function of a command
+ *
+ * @param args Rest of the line after the command and the spaces ('\0' ended)
+ * @param param Parameter of the command
+ */
+typedef void (*uart_command_cb_t)(const char *args, void *param);
+
+/**
+ * @brief Function called for every packet
+ */
+typedef void (*uart_packet_cb_t)(const uint8_t *data, size_t len, void *param);
+
+/**
+ * @brief Entry of a command table
+ */
+typedef struct {
+	const char *name;			/*!< Command, first word of the line */
+	uart_command_cb_t func_p;	/*!< Function of the command */
+	void *param_p;				/*!< Parameter of func_p */
+} uart_command_t;
+
+/**
+ * @brief Parser configuration
+ */
+typedef struct {
+	uart_rx_mode_t mode;			/*!< Framing of the received bytes */
+	const uart_command_t *commands;	/*!< Command table (UART_RX_LINES), must remain valid */
+	uint8_t n_commands;				/*!< Number of commands (up to UART_RX_MAX_COMMANDS) */
+	uart_command_cb_t unknown_p;	/*!< Called with the whole line for unknown commands (NULL if not required) */
+	uart_packet_cb_t packet_p;		/*!< Function called for every packet (UART_RX_PACKETS) */
+	void *param_p;					/*!< Parameter of unknown_p and packet_p */
+} uart_parser_config_t;
+
+/**
+ * @brief Reception statistics
+ */
+typedef struct {
+	uint32_t lines;				/*!< Lines with a known command */
+	uint32_t packets;			/*!< Valid packets */
+	uint32_t unknown;			/*!< Lines with an unknown command */
+	uint32_t too_long;			/*!< Lines or packets discarded for being too long */
+	uint32_t bad_packets;		/*!< Packets with a wrong COBS encoding */
+	uint32_t overruns;			/*!< Hardware FIFO or driver buffer overflows (driver) */
+	uint32_t frame_errors;		/*!< Frame errors (driver) */
+	uint32_t parity_errors;		/*!< Parity errors (driver) */
+	uint32_t dropped;			/*!< Bytes lost because the RX ring was full (driver) */
+} uart_rx_stats_t;
+
+/**
+ * @brief Parser state
+ */
+typedef struct {
+	uart_parser_config_t config;				/*!< Configuration */
+	uint8_t hash[UART_RX_HASH_SIZE];			/*!< Command index + 1 of each slot, 0: empty */
+	char buf[UART_RX_LINE_MAX + 1];				/*!< Line or packet being received */
+	size_t len;									/*!< Bytes in buf */
+	bool discard;								/*!< Discard up to the next delimiter */
+	uart_rx_stats_t stats;						/*!< Statistics */
+} uart_parser_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a parser and build the hash table of its commands
+ *
+ * @param parser Parser
+ * @param config Configuration
+ * @return true on success, false if there are too many or repeated commands
+ */
+bool UartParserInit(uart_parser_t *parser, const uart_parser_config_t *config);
+
+/**
+ * @brief Feed received bytes, the command and packet functions are called from here
+ *
+ * @param parser Parser
+ * @param data Received bytes
+ * @param len Number of bytes
+ * @return Number of lines and packets found (unknown commands included)
+ */
+uint32_t UartParserPush(uart_parser_t *parser, const uint8_t *data, size_t len);
+
+/**
+ * @brief Discard the line or packet being received (bytes were lost)
+ *
+ * @param parser Parser
+ */
+void UartParserAbort(uart_parser_t *parser);
+
+/**
+ * @brief Look up a command
+ *
+ * @param parser Parser
+ * @param name Command name
+ * @param len Length of the name
+ * @return Command, NULL if it is not in the table
+ */
+const uart_command_t * UartParserFind(const uart_parser_t *parser, const char *name, size_t len);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef UART_RX_MCU_H */
+
+/*==================[end of file]============================================*/
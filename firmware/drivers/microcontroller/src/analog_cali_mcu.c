@@ -0,0 +1,164 @@
+/**
+ * @file analog_cali_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "analog_cali_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define N_COEF		(ANALOG_CALI_POLY_MAX_ORDER + 1)
+#define MV_MAX		UINT16_MAX
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint16_t ClampMv(int64_t mv){
+	if(mv < 0){
+		return 0;
+	}
+	return (mv > MV_MAX) ? MV_MAX : mv;
+}
+
+/**
+ * @brief Solve a * x = b (Gaussian elimination with partial pivoting)
+ */
+static bool Solve(double a[N_COEF][N_COEF], double b[N_COEF], double x[N_COEF], uint8_t n){
+	for(uint8_t col = 0; col < n; col++){
+		uint8_t pivot = col;
+		for(uint8_t row = col + 1; row < n; row++){
+			if((a[row][col] > 0 ? a[row][col] : -a[row][col]) > (a[pivot][col] > 0 ? a[pivot][col] : -a[pivot][col])){
+				pivot = row;
+			}
+		}
+		if(a[pivot][col] == 0){
+			return false;
+		}
+		if(pivot != col){
+			double tmp[N_COEF];
+			memcpy(tmp, a[col], sizeof(tmp));
+			memcpy(a[col], a[pivot], sizeof(tmp));
+			memcpy(a[pivot], tmp, sizeof(tmp));
+			double tmp_b = b[col];
+			b[col] = b[pivot];
+			b[pivot] = tmp_b;
+		}
+		for(uint8_t row = col + 1; row < n; row++){
+			double factor = a[row][col] / a[col][col];
+			for(uint8_t k = col; k < n; k++){
+				a[row][k] -= factor * a[col][k];
+			}
+			b[row] -= factor * b[col];
+		}
+	}
+	for(int8_t row = n - 1; row >= 0; row--){
+		double sum = b[row];
+		for(uint8_t k = row + 1; k < n; k++){
+			sum -= a[row][k] * x[k];
+		}
+		x[row] = sum / a[row][row];
+	}
+	return true;
+}
+/*==================[external functions definition]==========================*/
+bool AnalogCaliInitLut(analog_cali_t *cali, uint16_t *lut, analog_cali_curve_t curve, void *param){
+	if(lut == NULL || curve == NULL){
+		return false;
+	}
+	for(uint32_t raw = 0; raw < ANALOG_CALI_LUT_SIZE; raw++){
+		lut[raw] = ClampMv(curve(raw, param));
+	}
+	memset(cali, 0, sizeof(analog_cali_t));
+	cali->lut = lut;
+	return true;
+}
+
+bool AnalogCaliInitPoly(analog_cali_t *cali, uint8_t order, analog_cali_curve_t curve, void *param){
+	double ata[N_COEF][N_COEF] = {{0}};
+	double atb[N_COEF] = {0};
+	double coef[N_COEF] = {0};
+	double power[2 * N_COEF - 1];
+	uint8_t n = order + 1;
+
+	if(order < 1 || order > ANALOG_CALI_POLY_MAX_ORDER || curve == NULL){
+		return false;
+	}
+	/* Normal equations of the least squares fit over every raw value */
+	for(uint32_t raw = 0; raw < ANALOG_CALI_LUT_SIZE; raw++){
+		double x = (double)raw / ANALOG_CALI_LUT_SIZE;
+		double y = curve(raw, param);
+		power[0] = 1;
+		for(uint8_t k = 1; k < 2 * n - 1; k++){
+			power[k] = power[k - 1] * x;
+		}
+		for(uint8_t i = 0; i < n; i++){
+			for(uint8_t j = 0; j < n; j++){
+				ata[i][j] += power[i + j];
+			}
+			atb[i] += power[i] * y;
+		}
+	}
+	if(!Solve(ata, atb, coef, n)){
+		return false;
+	}
+	memset(cali, 0, sizeof(analog_cali_t));
+	cali->order = order;
+	for(uint8_t k = 0; k < n; k++){
+		double scaled = coef[k] * (1 << ANALOG_CALI_POLY_Q);
+		cali->coef[k] = (int32_t)(scaled + (scaled >= 0 ? 0.5 : -0.5));
+	}
+	return true;
+}
+
+uint16_t AnalogCaliPoly(const analog_cali_t *cali, uint16_t raw){
+	/* Horner's method, x = raw / 2^ANALOG_CALI_BITS */
+	int64_t acc = cali->coef[cali->order];
+	for(int8_t k = cali->order - 1; k >= 0; k--){
+		acc = ((acc * raw) >> ANALOG_CALI_BITS) + cali->coef[k];
+	}
+	return ClampMv((acc + (1 << (ANALOG_CALI_POLY_Q - 1))) >> ANALOG_CALI_POLY_Q);
+}
+
+void AnalogCaliConvertBlock(const analog_cali_t *cali, const uint16_t *raw, uint16_t *mv, uint32_t n){
+	const uint16_t *lut = cali->lut;
+	if(lut != NULL){
+		for(uint32_t i = 0; i < n; i++){
+			mv[i] = lut[raw[i] & ANALOG_CALI_RAW_MASK];
+		}
+	} else {
+		for(uint32_t i = 0; i < n; i++){
+			mv[i] = AnalogCaliPoly(cali, raw[i] & ANALOG_CALI_RAW_MASK);
+		}
+	}
+}
+
+void AnalogCaliConvertFrac(const analog_cali_t *cali, const uint16_t *value, uint8_t frac_bits, uint16_t *mv, uint32_t n){
+	uint32_t frac_mask = (1u << frac_bits) - 1;
+	for(uint32_t i = 0; i < n; i++){
+		uint32_t raw = value[i] >> frac_bits;
+		uint32_t frac = value[i] & frac_mask;
+		int32_t low = AnalogCaliConvert(cali, raw);
+		if(frac == 0 || raw >= ANALOG_CALI_RAW_MASK){
+			mv[i] = low;
+			continue;
+		}
+		int32_t high = AnalogCaliConvert(cali, raw + 1);
+		mv[i] = low + (((high - low) * (int32_t)frac + (1 << (frac_bits - 1))) >> frac_bits);
+	}
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
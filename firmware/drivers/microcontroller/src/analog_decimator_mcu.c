@@ -0,0 +1,114 @@
+/**
+ * @file analog_decimator_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "analog_decimator_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define RAW_MASK		0x0FFF
+#define LFSR_SEED		0x2545F491
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint32_t Xorshift(uint32_t *state){
+	uint32_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/**
+ * @brief Combs and requantization, once every ratio samples
+ */
+static uint16_t Output(analog_decimator_t *dec){
+	uint32_t value = dec->integrator[dec->order - 1];
+	uint32_t prev;
+	for(uint8_t k = 0; k < dec->order; k++){
+		prev = dec->comb[k];
+		dec->comb[k] = value;
+		value -= prev;
+	}
+	if(dec->shift == 0){
+		return value;
+	}
+	uint64_t sum = value;
+	if(dec->dither){
+		sum += Xorshift(&dec->lfsr) & ((1u << dec->shift) - 1);
+	} else {
+		sum += 1u << (dec->shift - 1);
+	}
+	return sum >> dec->shift;
+}
+/*==================[external functions definition]==========================*/
+bool AnalogDecimatorInit(analog_decimator_t *dec, uint8_t order, uint16_t ratio, uint8_t extra_bits, bool dither){
+	uint8_t log2_ratio = 0;
+	if(order < 1 || order > ANALOG_DECIMATOR_MAX_ORDER || ratio == 0 || (ratio & (ratio - 1)) != 0){
+		return false;
+	}
+	while((1u << log2_ratio) < ratio){
+		log2_ratio++;
+	}
+	if(order * log2_ratio > ANALOG_DECIMATOR_MAX_GROWTH || extra_bits > ANALOG_DECIMATOR_MAX_EXTRA
+		|| extra_bits > order * log2_ratio){
+		return false;
+	}
+	dec->order = order;
+	dec->log2_ratio = log2_ratio;
+	dec->shift = order * log2_ratio - extra_bits;
+	dec->dither = dither;
+	AnalogDecimatorReset(dec);
+	return true;
+}
+
+void AnalogDecimatorReset(analog_decimator_t *dec){
+	dec->phase = 0;
+	dec->lfsr = LFSR_SEED;
+	memset(dec->integrator, 0, sizeof(dec->integrator));
+	memset(dec->comb, 0, sizeof(dec->comb));
+}
+
+bool AnalogDecimatorPush(analog_decimator_t *dec, uint16_t sample, uint16_t *out){
+	uint32_t value = sample & RAW_MASK;
+	for(uint8_t k = 0; k < dec->order; k++){
+		dec->integrator[k] += value;
+		value = dec->integrator[k];
+	}
+	if(++dec->phase < (1u << dec->log2_ratio)){
+		return false;
+	}
+	dec->phase = 0;
+	*out = Output(dec);
+	return true;
+}
+
+uint16_t AnalogDecimatorProcess(analog_decimator_t *dec, const uint16_t *in, uint16_t n, uint16_t *out){
+	uint16_t n_out = 0;
+	uint16_t value;
+	for(uint16_t i = 0; i < n; i++){
+		if(AnalogDecimatorPush(dec, in[i], &value)){
+			out[n_out++] = value;
+		}
+	}
+	return n_out;
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -10,23 +10,40 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdlib.h>
 #include "analog_io_mcu.h"
+#include "analog_cali_mcu.h"
+#include "analog_decimator_mcu.h"
 #include "driver/gptimer.h"
 #include "driver/sdm.h"
 #include "esp_adc/adc_cali_scheme.h"
 #include "esp_adc/adc_oneshot.h"
 #include "esp_adc/adc_continuous.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 /*==================[macros and definitions]=================================*/
 #define ADC_BITWIDTH 		SOC_ADC_DIGI_MAX_BITWIDTH	// 12 bit resolution
 #define ADC_ATTENUATION		ADC_ATTEN_DB_12				// 12dB attenuation (for 0-3,3V ADC range)
+#define ADC_CHANNELS		4							// CH0 to CH3
+#define ADC_POOL_FRAMES		2							// Frames kept by the ADC driver between reads
+#define ADC_TASK_STACK		3072
+#define ADC_TASK_PRIORITY	10
+#define LEGACY_FRAME_LEN	128							// Conversions per frame (AnalogInputInit continuous mode)
+#define LEGACY_FRAMES		4
+#define CALI_POLY_ORDER		3							// Polynomial calibration (ANALOG_CALI_USE_LUT = 0 or out of memory)
 /*==================[internal data declaration]==============================*/
-adc_cali_handle_t adc_calibration_single_0, adc_calibration_single_1, adc_calibration_single_2, adc_calibration_single_3;
+adc_cali_handle_t adc_calibration[ADC_CHANNELS];
+static analog_cali_t analog_cali[ADC_CHANNELS];		/*!< raw -> mV conversion of each channel */
 adc_oneshot_unit_handle_t adc1_single; 
 adc_continuous_handle_t adc2_cont;
 sdm_channel_handle_t dac = NULL;
 bool adc1_single_used = false;
 /*==================[internal functions declaration]=========================*/
-
+static void LegacyFrame(const uint16_t *samples, uint16_t len, void *param);
+static void ScanFrame(const uint16_t *samples, uint16_t len, void *param);
+static void ContinuousInit(analog_continuous_config_t *config, void (*setup_p)(void*), void *setup_param);
 /*==================[internal data definition]===============================*/
 adc_oneshot_unit_init_cfg_t init_config_single = {
 	.unit_id = ADC_UNIT_1,
@@ -35,11 +52,233 @@ adc_oneshot_unit_init_cfg_t init_config_single = {
 adc_oneshot_chan_cfg_t adc_config_single = {
 	.bitwidth = ADC_BITWIDTH,
 	.atten = ADC_ATTENUATION,
-};					
+};
+static const adc_channel_t adc_channel[ADC_CHANNELS] = {ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3};
+
+static analog_ring_t adc_ring;						/*!< Frames of the continuous mode */
+static uint32_t frame_bytes;						/*!< Bytes of DMA results per frame */
+static uint32_t handle_frame_bytes = 0;				/*!< Frame size of the ADC driver handle */
+static SemaphoreHandle_t adc_lock = NULL;			/*!< Held by the ADC task while it moves frames, and by AnalogContinuousInit() */
+static analog_frame_cb_t frame_cb = NULL;			/*!< Per frame callback (continuous mode) */
+static void *frame_param = NULL;
+static TaskHandle_t adc_task_handle = NULL;
+static bool adc2_cont_running = false;
+
+/* Continuous mode configured through AnalogInputInit() */
+static uint32_t legacy_storage[LEGACY_FRAMES * LEGACY_FRAME_LEN];
+static analog_continuous_config_t legacy_config = {
+	.channels = 0,
+	.sample_frec = 0,
+	.frame_len = LEGACY_FRAME_LEN,
+	.n_frames = LEGACY_FRAMES,
+	.storage = legacy_storage,
+	.func_p = LegacyFrame,
+	.param_p = NULL,
+};
+static bool legacy_active = false;					/*!< The continuous mode runs legacy_config */
+static void (*legacy_func_p)(void*) = NULL;
+static void *legacy_param_p = NULL;
+static const uint16_t *legacy_samples = NULL;		/*!< Frame being handled by the legacy callback */
+static uint16_t legacy_len = 0;
+
+/* Scan group: one sample ring per channel */
+static analog_sample_ring_t scan_ring[ADC_CHANNELS];
+static analog_sample_ring_t *scan_demux[ANALOG_DEMUX_CHANNELS] = {NULL};	/*!< Ring of each ADC channel */
+static analog_decimator_t *scan_decimator[ANALOG_DEMUX_CHANNELS] = {NULL};	/*!< Decimator of each ADC channel */
+static bool scan_decimated = false;
+static void (*scan_func_p)(void*) = NULL;
+static void *scan_param_p = NULL;
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static int CalibrationCurve(uint16_t raw, void *param){
+	int voltage = 0;
+	adc_cali_raw_to_voltage((adc_cali_handle_t)param, raw, &voltage);
+	return voltage;
+}
+
+/**
+ * @brief Creates the calibration scheme of a channel and samples it once
+ * into a LUT (or a polynomial), used by every raw -> mV conversion.
+ */
+static void CalibrationInit(adc_ch_t channel){
+	if(adc_calibration[channel] != NULL){
+		return;
+	}
+	adc_cali_curve_fitting_config_t cali_config = {
+		.unit_id = ADC_UNIT_1,
+		.chan = adc_channel[channel], 
+		.atten = ADC_ATTENUATION,
+		.bitwidth = ADC_BITWIDTH,
+	};
+	ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config, &adc_calibration[channel]));
+#if ANALOG_CALI_USE_LUT
+	uint16_t *lut = malloc(ANALOG_CALI_LUT_SIZE * sizeof(uint16_t));
+	if(AnalogCaliInitLut(&analog_cali[channel], lut, CalibrationCurve, adc_calibration[channel])){
+		return;
+	}
+#endif
+	AnalogCaliInitPoly(&analog_cali[channel], CALI_POLY_ORDER, CalibrationCurve, adc_calibration[channel]);
+}
+
+static bool IRAM_ATTR AdcConvDoneIsr(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	BaseType_t task_woken = pdFALSE;
+	vTaskNotifyGiveFromISR(adc_task_handle, &task_woken);
+	return (task_woken == pdTRUE);
+}
+
+/**
+ * @brief Moves the frames of the ADC driver pool into the ring
+ * 
+ * DMA results are read straight into the free slot of the ring and packed
+ * in place. With a frame callback the frame is released after the call,
+ * otherwise it waits for AnalogContinuousRelease().
+ */
+static void AdcContinuousTask(void *param){
+	uint32_t n_bytes;
+	uint32_t *slot;
+	const uint16_t *samples;
+	uint16_t len;
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		xSemaphoreTake(adc_lock, portMAX_DELAY);
+		while((slot = AnalogRingWriteSlot(&adc_ring)) != NULL){
+			if(adc_continuous_read(adc2_cont, (uint8_t*)slot, frame_bytes, &n_bytes, 0) != ESP_OK){
+				break;
+			}
+			AnalogRingCommit(&adc_ring, n_bytes);
+			if(frame_cb != NULL){
+				len = AnalogRingPeek(&adc_ring, &samples);
+				frame_cb(samples, len, frame_param);
+				AnalogRingRelease(&adc_ring);
+			}
+		}
+		xSemaphoreGive(adc_lock);
+	}
+}
+
+static void LegacyFrame(const uint16_t *samples, uint16_t len, void *param){
+	legacy_samples = samples;
+	legacy_len = len;
+	if(legacy_func_p != NULL){
+		legacy_func_p(legacy_param_p);
+	}
+	legacy_samples = NULL;
+	legacy_len = 0;
+}
+
+static void ScanFrame(const uint16_t *samples, uint16_t len, void *param){
+	uint8_t ch;
+	uint16_t value;
+	if(!scan_decimated){
+		AnalogDemux(samples, len, scan_demux);
+	} else {
+		for(uint16_t i = 0; i < len; i++){
+			ch = ANALOG_SAMPLE_CH(samples[i]);
+			if(scan_demux[ch] == NULL){
+				continue;
+			}
+			if(scan_decimator[ch] == NULL){
+				AnalogSampleRingWrite(scan_demux[ch], &samples[i], 1);
+			} else if(AnalogDecimatorPush(scan_decimator[ch], samples[i], &value)){
+				AnalogSampleRingWrite(scan_demux[ch], &value, 1);
+			}
+		}
+	}
+	if(scan_func_p != NULL){
+		scan_func_p(scan_param_p);
+	}
+}
+
+/**
+ * @brief Rewrites the scan group state, called by ContinuousInit() under adc_lock
+ */
+static void ScanSetup(void *param){
+	analog_scan_config_t *config = param;
+	scan_decimated = false;
+	for(uint8_t ch = CH0; ch < ADC_CHANNELS; ch++){
+		scan_demux[adc_channel[ch]] = NULL;
+		scan_decimator[adc_channel[ch]] = NULL;
+		if(config->channels & ANALOG_CH_MASK(ch)){
+			if(!AnalogSampleRingInit(&scan_ring[ch], config->ring_storage[ch], config->ring_size)){
+				ESP_ERROR_CHECK(ESP_ERR_INVALID_ARG);
+			}
+			scan_demux[adc_channel[ch]] = &scan_ring[ch];
+			scan_decimator[adc_channel[ch]] = config->decimator[ch];
+			scan_decimated |= (config->decimator[ch] != NULL);
+		}
+	}
+	scan_func_p = config->func_p;
+	scan_param_p = config->param_p;
+}
+
+/**
+ * @brief Configures the continuous mode, setup_p (if any) is called with the
+ * ADC stopped and adc_lock held, before the ADC task can run again
+ */
+static void ContinuousInit(analog_continuous_config_t *config, void (*setup_p)(void*), void *setup_param){
+	adc_digi_pattern_config_t pattern[ADC_CHANNELS] = {0};
+	uint8_t n_channels = 0;
+
+	if(adc_lock == NULL){
+		adc_lock = xSemaphoreCreateMutex();
+	}
+	// the driver can not be configured while it converts, nor the ring changed under the ADC task
+	AnalogContinuousStop();
+	xSemaphoreTake(adc_lock, portMAX_DELAY);
+	if(setup_p != NULL){
+		setup_p(setup_param);
+	}
+	if(!AnalogRingInit(&adc_ring, config->storage, config->frame_len, config->n_frames)){
+		ESP_ERROR_CHECK(ESP_ERR_INVALID_ARG);
+	}
+	frame_bytes = (uint32_t)config->frame_len * ANALOG_RESULT_BYTES;
+	frame_cb = config->func_p;
+	frame_param = config->param_p;
+	legacy_active = (config == &legacy_config);
+
+	for(uint8_t ch = CH0; ch < ADC_CHANNELS; ch++){
+		if(config->channels & ANALOG_CH_MASK(ch)){
+			pattern[n_channels].atten = ADC_ATTENUATION;
+			pattern[n_channels].channel = adc_channel[ch];
+			pattern[n_channels].unit = ADC_UNIT_1;
+			pattern[n_channels].bit_width = ADC_BITWIDTH;
+			n_channels++;
+			CalibrationInit(ch);
+		}
+	}
+
+	// the frame size of the driver is fixed when its handle is created
+	if(adc2_cont != NULL && handle_frame_bytes != frame_bytes){
+		ESP_ERROR_CHECK(adc_continuous_deinit(adc2_cont));
+		adc2_cont = NULL;
+	}
+	if(adc2_cont == NULL){
+		adc_continuous_handle_cfg_t handle_config = {
+			.max_store_buf_size = frame_bytes * ADC_POOL_FRAMES,
+			.conv_frame_size = frame_bytes,
+		};
+		ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_config, &adc2_cont));
+		handle_frame_bytes = frame_bytes;
+		adc_continuous_evt_cbs_t callbacks = {
+			.on_conv_done = AdcConvDoneIsr,
+		};
+		ESP_ERROR_CHECK(adc_continuous_register_event_callbacks(adc2_cont, &callbacks, NULL));
+	}
+	if(adc_task_handle == NULL){
+		xTaskCreate(AdcContinuousTask, "adc_cont", ADC_TASK_STACK, NULL, ADC_TASK_PRIORITY, &adc_task_handle);
+	}
 
+	adc_continuous_config_t cont_config = {
+		.pattern_num = n_channels,
+		.adc_pattern = pattern,
+		.sample_freq_hz = config->sample_frec,
+		.conv_mode = ADC_CONV_SINGLE_UNIT_1,
+		.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+	};
+	ESP_ERROR_CHECK(adc_continuous_config(adc2_cont, &cont_config));
+	xSemaphoreGive(adc_lock);
+}
 /*==================[external functions definition]==========================*/
 
 void AnalogInputInit(analog_input_config_t *config){
@@ -51,70 +290,103 @@ void AnalogInputInit(analog_input_config_t *config){
 				adc_oneshot_new_unit(&init_config_single, &adc1_single);
 				adc1_single_used = true;
 			}
-			switch(config->input){
-				case CH0:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_0, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_0 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_0, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_0, &adc_calibration_single_0));
-				break;
-				case CH1:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_1, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_1 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_1, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_1, &adc_calibration_single_1));
-				break;
-				case CH2:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_2, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_2 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_2, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_2, &adc_calibration_single_2));
-				break;
-				case CH3:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_3, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_3 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_3, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_3, &adc_calibration_single_3));
-				break;
-			}
+    		adc_oneshot_config_channel(adc1_single, adc_channel[config->input], &adc_config_single);
+			// create calibration curve
+			CalibrationInit(config->input);
 		break;
 		case ADC_CONTINUOUS:
-			switch(config->input){
-				case CH0:
+			// channels are scanned together from AnalogStartContinuous()
+			legacy_config.channels |= ANALOG_CH_MASK(config->input);
+			legacy_config.sample_frec = config->sample_frec;
+			// applied by the next AnalogStartContinuous()
+			legacy_active = false;
+			legacy_func_p = config->func_p;
+			legacy_param_p = config->param_p;
+		break;
+	}
+}
 
-				break;
-				case CH1:
+void AnalogContinuousInit(analog_continuous_config_t *config){
+	ContinuousInit(config, NULL, NULL);
+}
 
-				break;
-				case CH2:
+void AnalogContinuousStart(void){
+	if(!adc2_cont_running){
+		ESP_ERROR_CHECK(adc_continuous_start(adc2_cont));
+		adc2_cont_running = true;
+	}
+}
 
-				break;
-				case CH3:
+void AnalogContinuousStop(void){
+	if(adc2_cont_running){
+		ESP_ERROR_CHECK(adc_continuous_stop(adc2_cont));
+		adc2_cont_running = false;
+	}
+}
 
-				break;
-			}
-		break;
+uint16_t AnalogContinuousRead(const uint16_t **samples){
+	return AnalogRingPeek(&adc_ring, samples);
+}
+
+void AnalogContinuousRelease(void){
+	AnalogRingRelease(&adc_ring);
+}
+
+uint32_t AnalogContinuousOverruns(void){
+	return adc_ring.overruns;
+}
+
+void AnalogScanGroupInit(analog_scan_config_t *config){
+	uint8_t n_channels = 0;
+	for(uint8_t ch = CH0; ch < ADC_CHANNELS; ch++){
+		if(config->channels & ANALOG_CH_MASK(ch)){
+			n_channels++;
+		}
 	}
+	// rejected before anything changes, a running group goes on
+	if(n_channels == 0){
+		ESP_ERROR_CHECK(ESP_ERR_INVALID_ARG);
+		return;
+	}
+
+	// whole scans in every frame
+	analog_continuous_config_t cont_config = {
+		.channels = config->channels,
+		.sample_frec = config->sample_frec * n_channels,
+		.frame_len = config->frame_len - config->frame_len % n_channels,
+		.n_frames = config->n_frames,
+		.storage = config->storage,
+		.func_p = ScanFrame,
+		.param_p = NULL,
+	};
+	// the rings are rewritten with the ADC stopped, out of the reach of ScanFrame()
+	ContinuousInit(&cont_config, ScanSetup, config);
+}
+
+uint16_t AnalogScanRead(adc_ch_t channel, uint16_t *values, uint16_t n){
+	return AnalogSampleRingRead(&scan_ring[channel], values, n);
+}
+
+uint16_t AnalogScanAvailable(adc_ch_t channel){
+	return AnalogSampleRingCount(&scan_ring[channel]);
+}
+
+uint32_t AnalogScanDropped(adc_ch_t channel){
+	return scan_ring[channel].dropped;
+}
+
+void AnalogRawToMv(const uint16_t *samples, uint16_t *mv, uint16_t len){
+	for(uint16_t i = 0; i < len; i++){
+		mv[i] = AnalogCaliConvert(&analog_cali[ANALOG_SAMPLE_CH(samples[i])], samples[i]);
+	}
+}
+
+void AnalogRawToMvChannel(adc_ch_t channel, const uint16_t *raw, uint16_t *mv, uint16_t len){
+	AnalogCaliConvertBlock(&analog_cali[channel], raw, mv, len);
+}
+
+void AnalogDecimatedToMv(adc_ch_t channel, const uint16_t *values, uint8_t extra_bits, uint16_t *mv, uint16_t len){
+	AnalogCaliConvertFrac(&analog_cali[channel], values, extra_bits, mv, len);
 }
 
 void AnalogOutputInit(void){
@@ -128,32 +400,32 @@ void AnalogOutputInit(void){
 }
 
 void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
-    switch(channel){
-		case CH0:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_0, (int*)value);
-		break;
-		case CH1:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_1, (int*)value);
-		break;
-		case CH2:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_2, (int*)value);
-		break;
-		case CH3:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_3, (int*)value);
-		break;
-	}
+	int raw = 0;
+	adc_oneshot_read(adc1_single, adc_channel[channel], &raw);
+	*value = AnalogCaliConvert(&analog_cali[channel], raw);
 }
 
 void AnalogStartContinuous(adc_ch_t channel){
-
+	// also after an AnalogContinuousInit() or AnalogScanGroupInit() with other settings
+	if(!legacy_active){
+		AnalogContinuousInit(&legacy_config);
+	}
+	AnalogContinuousStart();
 }
 
 void AnalogStopContinuous(adc_ch_t channel){
-
+	AnalogContinuousStop();
 }
 
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
-
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+	uint16_t n = 0;
+	for(uint16_t i = 0; i < legacy_len; i++){
+		if(ANALOG_SAMPLE_CH(legacy_samples[i]) == adc_channel[channel]){
+			values[n++] = legacy_samples[i];
+		}
+	}
+	AnalogRawToMv(values, values, n);
+	return n;
 }
 
 void AnalogOutputWrite(uint8_t value){
@@ -0,0 +1,182 @@
+/**
+ * @file analog_ring_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "analog_ring_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define LOAD(p)			__atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define STORE(p, v)		__atomic_store_n(p, v, __ATOMIC_RELEASE)
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint32_t * FrameSlot(analog_ring_t *ring, uint32_t index){
+	return ring->storage + (index % ring->n_frames) * ring->frame_len;
+}
+/*==================[external functions definition]==========================*/
+bool AnalogRingInit(analog_ring_t *ring, uint32_t *storage, uint16_t frame_len, uint16_t n_frames){
+	if(storage == NULL || frame_len == 0 || n_frames == 0 || n_frames > ANALOG_RING_MAX_FRAMES){
+		return false;
+	}
+	memset(ring, 0, sizeof(analog_ring_t));
+	ring->storage = storage;
+	ring->frame_len = frame_len;
+	ring->n_frames = n_frames;
+	return true;
+}
+
+uint32_t * AnalogRingWriteSlot(analog_ring_t *ring){
+	uint32_t head = ring->head;
+	if(head - LOAD(&ring->tail) >= ring->n_frames){
+		ring->overruns++;
+		return NULL;
+	}
+	return FrameSlot(ring, head);
+}
+
+uint16_t AnalogRingCommit(analog_ring_t *ring, uint32_t n_bytes){
+	uint32_t head = ring->head;
+	uint32_t max_bytes = (uint32_t)ring->frame_len * ANALOG_RESULT_BYTES;
+	if(n_bytes > max_bytes){
+		n_bytes = max_bytes;
+	}
+	uint16_t len = AnalogPackResults(FrameSlot(ring, head), n_bytes);
+	ring->length[head % ring->n_frames] = len;
+	STORE(&ring->head, head + 1);
+	return len;
+}
+
+uint16_t AnalogRingPeek(analog_ring_t *ring, const uint16_t **samples){
+	uint32_t tail = ring->tail;
+	if(LOAD(&ring->head) == tail){
+		return 0;
+	}
+	*samples = (const uint16_t *)FrameSlot(ring, tail);
+	return ring->length[tail % ring->n_frames];
+}
+
+void AnalogRingRelease(analog_ring_t *ring){
+	uint32_t tail = ring->tail;
+	if(LOAD(&ring->head) != tail){
+		STORE(&ring->tail, tail + 1);
+	}
+}
+
+uint16_t AnalogRingCount(analog_ring_t *ring){
+	return LOAD(&ring->head) - LOAD(&ring->tail);
+}
+
+uint16_t AnalogPackResults(uint32_t *buffer, uint32_t n_bytes){
+	const uint8_t *src = (const uint8_t *)buffer;
+	uint16_t *dst = (uint16_t *)buffer;
+	uint16_t n = n_bytes / ANALOG_RESULT_BYTES;
+	uint32_t result;
+	/* Every sample is written at or before the result it comes from */
+	for(uint16_t i = 0; i < n; i++){
+		memcpy(&result, src + i * ANALOG_RESULT_BYTES, ANALOG_RESULT_BYTES);
+		dst[i] = ANALOG_SAMPLE(ANALOG_RESULT_CH(result), ANALOG_RESULT_RAW(result));
+	}
+	return n;
+}
+
+bool AnalogSampleRingInit(analog_sample_ring_t *ring, uint16_t *buffer, uint32_t size){
+	if(buffer == NULL || size == 0 || (size & (size - 1)) != 0){
+		return false;
+	}
+	memset(ring, 0, sizeof(analog_sample_ring_t));
+	ring->buffer = buffer;
+	ring->mask = size - 1;
+	return true;
+}
+
+uint32_t AnalogSampleRingWrite(analog_sample_ring_t *ring, const uint16_t *samples, uint32_t n){
+	uint32_t head = ring->head;
+	uint32_t room = ring->mask + 1 - (head - LOAD(&ring->tail));
+	if(n > room){
+		ring->dropped += n - room;
+		n = room;
+	}
+	/* Copy in up to two chunks: until the end of the buffer and from its start */
+	uint32_t index = head & ring->mask;
+	uint32_t first = ring->mask + 1 - index;
+	if(first > n){
+		first = n;
+	}
+	memcpy(&ring->buffer[index], samples, first * sizeof(uint16_t));
+	memcpy(ring->buffer, samples + first, (n - first) * sizeof(uint16_t));
+	STORE(&ring->head, head + n);
+	return n;
+}
+
+uint32_t AnalogSampleRingRead(analog_sample_ring_t *ring, uint16_t *samples, uint32_t n){
+	uint32_t tail = ring->tail;
+	uint32_t count = LOAD(&ring->head) - tail;
+	if(n > count){
+		n = count;
+	}
+	uint32_t index = tail & ring->mask;
+	uint32_t first = ring->mask + 1 - index;
+	if(first > n){
+		first = n;
+	}
+	memcpy(samples, &ring->buffer[index], first * sizeof(uint16_t));
+	memcpy(samples + first, ring->buffer, (n - first) * sizeof(uint16_t));
+	STORE(&ring->tail, tail + n);
+	return n;
+}
+
+uint32_t AnalogSampleRingCount(analog_sample_ring_t *ring){
+	return LOAD(&ring->head) - LOAD(&ring->tail);
+}
+
+void AnalogDemux(const uint16_t *samples, uint16_t len, analog_sample_ring_t *rings[ANALOG_DEMUX_CHANNELS]){
+	uint32_t head[ANALOG_DEMUX_CHANNELS];
+	uint32_t limit[ANALOG_DEMUX_CHANNELS];
+	analog_sample_ring_t *ring;
+	uint8_t ch;
+
+	/* Work on local copies of the indexes, the consumers see whole frames */
+	for(ch = 0; ch < ANALOG_DEMUX_CHANNELS; ch++){
+		if(rings[ch] != NULL){
+			head[ch] = rings[ch]->head;
+			limit[ch] = LOAD(&rings[ch]->tail) + rings[ch]->mask + 1;
+		}
+	}
+	for(uint16_t i = 0; i < len; i++){
+		ch = ANALOG_SAMPLE_CH(samples[i]);
+		ring = rings[ch];
+		if(ring == NULL){
+			continue;
+		}
+		if(head[ch] == limit[ch]){
+			ring->dropped++;
+			continue;
+		}
+		ring->buffer[head[ch] & ring->mask] = samples[i];
+		head[ch]++;
+	}
+	for(ch = 0; ch < ANALOG_DEMUX_CHANNELS; ch++){
+		if(rings[ch] != NULL){
+			STORE(&rings[ch]->head, head[ch]);
+		}
+	}
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
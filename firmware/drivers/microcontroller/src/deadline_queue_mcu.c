@@ -0,0 +1,129 @@
+/**
+ * @file deadline_queue_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include <string.h>
+#include "deadline_queue_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define PARENT(i)		(((i) - 1) / 2)
+#define LEFT(i)			(2 * (i) + 1)
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Move the deadline at i up to its place, the ones above it go down
+ */
+static void SiftUp(deadline_queue_t *queue, uint16_t i){
+	deadline_t *deadline = queue->heap[i];
+
+	while(i > 0 && queue->heap[PARENT(i)]->time > deadline->time){
+		queue->heap[i] = queue->heap[PARENT(i)];
+		queue->heap[i]->index = i;
+		i = PARENT(i);
+	}
+	queue->heap[i] = deadline;
+	deadline->index = i;
+}
+
+/**
+ * @brief Move the deadline at i down to its place, the earliest child goes up
+ */
+static void SiftDown(deadline_queue_t *queue, uint16_t i){
+	deadline_t *deadline = queue->heap[i];
+	uint16_t child;
+
+	while((child = LEFT(i)) < queue->count){
+		if(child + 1 < queue->count && queue->heap[child + 1]->time < queue->heap[child]->time){
+			child++;
+		}
+		if(queue->heap[child]->time >= deadline->time){
+			break;
+		}
+		queue->heap[i] = queue->heap[child];
+		queue->heap[i]->index = i;
+		i = child;
+	}
+	queue->heap[i] = deadline;
+	deadline->index = i;
+}
+
+/**
+ * @brief Take the deadline at i, the last one takes its place
+ */
+static void RemoveAt(deadline_queue_t *queue, uint16_t i){
+	queue->count--;
+	if(i == queue->count){
+		return;
+	}
+	queue->heap[i] = queue->heap[queue->count];
+	SiftDown(queue, i);
+	SiftUp(queue, queue->heap[i]->index);
+}
+
+/*==================[external functions definition]==========================*/
+void DeadlineQueueInit(deadline_queue_t *queue, deadline_t **storage, uint16_t size){
+	memset(queue, 0, sizeof(*queue));
+	queue->heap = storage;
+	queue->size = size;
+}
+
+deadline_insert_t DeadlineQueueInsert(deadline_queue_t *queue, deadline_t *deadline){
+	if(queue->count == queue->size){
+		queue->stats.full++;
+		return DEADLINE_FULL;
+	}
+	queue->heap[queue->count] = deadline;
+	SiftUp(queue, queue->count++);
+	queue->stats.inserted++;
+	if(queue->count > queue->stats.max_depth){
+		queue->stats.max_depth = queue->count;
+	}
+	return (queue->heap[0] == deadline) ? DEADLINE_FIRST : DEADLINE_LATER;
+}
+
+bool DeadlineQueueNext(const deadline_queue_t *queue, uint64_t *time){
+	if(queue->count == 0){
+		return false;
+	}
+	*time = queue->heap[0]->time;
+	return true;
+}
+
+deadline_t *DeadlineQueuePop(deadline_queue_t *queue, uint64_t now){
+	deadline_t *earliest;
+
+	if(queue->count == 0 || queue->heap[0]->time > now){
+		return NULL;
+	}
+	earliest = queue->heap[0];
+	RemoveAt(queue, 0);
+	queue->stats.expired++;
+	return earliest;
+}
+
+bool DeadlineQueueRemove(deadline_queue_t *queue, deadline_t *deadline){
+	uint16_t i = deadline->index;
+
+	if(i >= queue->count || queue->heap[i] != deadline){
+		return false;
+	}
+	RemoveAt(queue, i);
+	return (i == 0);
+}
+
+/*==================[end of file]============================================*/
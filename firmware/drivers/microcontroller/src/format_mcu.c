@@ -0,0 +1,262 @@
+/**
+ * @file format_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "format_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define TMP_SIZE		FORMAT_MAX_LEN
+#define CHUNK			100000000u		/*!< 10^8, 8 digits per 32 bit chunk of a 64 bit number */
+#define CHUNK_DIGITS	8
+/**
+ * @brief value / 100 as a multiplication by the reciprocal (exact for any 32 bit value)
+ */
+#define DIV100(v)		((uint32_t)(((uint64_t)(v) * 0x51EB851FULL) >> 37))
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const char digit_pairs[201] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+static const char digits[] = "0123456789abcdef";
+
+static const uint32_t pow10_u32[FORMAT_MAX_DECIMALS + 1] = {
+	1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+static const float pow10_f[FORMAT_MAX_DECIMALS + 1] = {
+	1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Write the decimal digits of value backwards, ending before p
+ *
+ * @return Pointer to the first digit
+ */
+static char * WriteDigits(char *p, uint32_t value){
+	uint32_t q;
+	while(value >= 100){
+		q = DIV100(value);
+		p -= 2;
+		memcpy(p, &digit_pairs[(value - q * 100) * 2], 2);
+		value = q;
+	}
+	if(value >= 10){
+		p -= 2;
+		memcpy(p, &digit_pairs[value * 2], 2);
+	} else {
+		*--p = '0' + value;
+	}
+	return p;
+}
+
+/**
+ * @brief Number of decimal digits of value
+ */
+static uint8_t CountDigits(uint32_t value){
+	uint8_t n = 1;
+	while(n <= FORMAT_MAX_DECIMALS && value >= pow10_u32[n]){
+		n++;
+	}
+	return n;
+}
+
+/**
+ * @brief Write exactly n decimal digits of value backwards (leading zeros)
+ */
+static char * WriteDigitsFixed(char *p, uint32_t value, uint8_t n){
+	char *start = p - n;
+	p = WriteDigits(p, value);
+	while(p > start){
+		*--p = '0';
+	}
+	return p;
+}
+
+/**
+ * @brief Write the decimal digits of a 64 bit value backwards
+ */
+static char * WriteDigits64(char *p, uint64_t value){
+	while(value > UINT32_MAX){
+		uint64_t q = value / CHUNK;
+		p = WriteDigitsFixed(p, (uint32_t)(value - q * CHUNK), CHUNK_DIGITS);
+		value = q;
+	}
+	return WriteDigits(p, (uint32_t)value);
+}
+
+/**
+ * @brief Copy the sign and digits to the destination with padding
+ */
+static size_t Emit(char *buf, char sign, const char *text, size_t n, uint8_t width, char pad){
+	size_t len = n + (sign != 0);
+	size_t fill = (width > len) ? width - len : 0;
+	char *p = buf;
+	if(sign != 0 && pad == '0'){
+		*p++ = sign;
+	}
+	memset(p, pad, fill);
+	p += fill;
+	if(sign != 0 && pad != '0'){
+		*p++ = sign;
+	}
+	memcpy(p, text, n);
+	p[n] = '\0';
+	return len + fill;
+}
+/*==================[external functions definition]==========================*/
+size_t FormatU32(char *buf, uint32_t value, uint8_t width, char pad){
+	uint8_t n = CountDigits(value);
+	if(width <= n){
+		/* No padding: straight into the destination */
+		WriteDigits(buf + n, value);
+		buf[n] = '\0';
+		return n;
+	}
+	char tmp[TMP_SIZE];
+	char *end = tmp + TMP_SIZE;
+	char *start = WriteDigits(end, value);
+	return Emit(buf, 0, start, end - start, width, pad);
+}
+
+size_t FormatI32(char *buf, int32_t value, uint8_t width, char pad){
+	uint32_t abs_value = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+	uint8_t n = CountDigits(abs_value);
+	if(value < 0 && width <= n + 1){
+		buf[0] = '-';
+		return FormatU32(buf + 1, abs_value, 0, pad) + 1;
+	}
+	if(value >= 0){
+		return FormatU32(buf, abs_value, width, pad);
+	}
+	char tmp[TMP_SIZE];
+	char *end = tmp + TMP_SIZE;
+	char *start = WriteDigits(end, abs_value);
+	return Emit(buf, '-', start, end - start, width, pad);
+}
+
+size_t FormatU64(char *buf, uint64_t value, uint8_t width, char pad){
+	char tmp[TMP_SIZE];
+	char *end = tmp + TMP_SIZE;
+	char *start = WriteDigits64(end, value);
+	return Emit(buf, 0, start, end - start, width, pad);
+}
+
+size_t FormatI64(char *buf, int64_t value, uint8_t width, char pad){
+	char tmp[TMP_SIZE];
+	char *end = tmp + TMP_SIZE;
+	uint64_t abs_value = (value < 0) ? 0u - (uint64_t)value : (uint64_t)value;
+	char *start = WriteDigits64(end, abs_value);
+	return Emit(buf, (value < 0) ? '-' : 0, start, end - start, width, pad);
+}
+
+size_t FormatBase(char *buf, uint32_t value, uint8_t base, uint8_t width, char pad){
+	char tmp[TMP_SIZE];
+	char *end = tmp + TMP_SIZE;
+	char *p = end;
+	if(base < 2 || base > 16){
+		buf[0] = '\0';
+		return 0;
+	}
+	if(base == 10){
+		return FormatU32(buf, value, width, pad);
+	}
+	if((base & (base - 1)) == 0){
+		/* Powers of 2: shifts and masks */
+		uint8_t shift = (base == 2) ? 1 : (base == 4) ? 2 : (base == 8) ? 3 : 4;
+		do {
+			*--p = digits[value & (base - 1)];
+			value >>= shift;
+		} while(value != 0);
+	} else {
+		do {
+			*--p = digits[value % base];
+			value /= base;
+		} while(value != 0);
+	}
+	return Emit(buf, 0, p, end - p, width, pad);
+}
+
+size_t FormatFixed(char *buf, int64_t value, uint8_t decimals, uint8_t width, char pad){
+	char tmp[TMP_SIZE];
+	char *end = tmp + TMP_SIZE;
+	char *p;
+	uint64_t abs_value = (value < 0) ? 0u - (uint64_t)value : (uint64_t)value;
+	uint64_t integer;
+	uint32_t fraction;
+
+	if(decimals > FORMAT_MAX_DECIMALS){
+		decimals = FORMAT_MAX_DECIMALS;
+	}
+	if(decimals == 0){
+		return FormatI64(buf, value, width, pad);
+	}
+	if(abs_value <= UINT32_MAX){
+		integer = (uint32_t)abs_value / pow10_u32[decimals];
+	} else {
+		integer = abs_value / pow10_u32[decimals];
+	}
+	fraction = (uint32_t)(abs_value - integer * pow10_u32[decimals]);
+	p = WriteDigitsFixed(end, fraction, decimals);
+	*--p = '.';
+	p = WriteDigits64(p, integer);
+	return Emit(buf, (value < 0) ? '-' : 0, p, end - p, width, pad);
+}
+
+size_t FormatFloat(char *buf, float value, uint8_t decimals, uint8_t width, char pad){
+	float scaled;
+	if(decimals > FORMAT_MAX_DECIMALS){
+		decimals = FORMAT_MAX_DECIMALS;
+	}
+	if(value != value){
+		return Emit(buf, 0, "nan", 3, width, ' ');
+	}
+	/* 2^63: limit of the integer conversion */
+	if(value >= 9.2233715e18f || value <= -9.2233715e18f){
+		return Emit(buf, (value < 0) ? '-' : 0, "inf", 3, width, ' ');
+	}
+	scaled = value * pow10_f[decimals];
+	if(scaled >= 9.2233715e18f || scaled <= -9.2233715e18f){
+		/* Over 2^24 a float has no fraction: the integer part, then zeros */
+		char tmp[FORMAT_MAX_LEN];
+		size_t n = FormatU64(tmp, (uint64_t)((value < 0) ? -value : value), 0, ' ');
+		tmp[n++] = '.';
+		memset(&tmp[n], '0', decimals);
+		return Emit(buf, (value < 0) ? '-' : 0, tmp, n + decimals, width, pad);
+	}
+	/* Round half away from zero, adding 0.5 would lose the last bit above 2^23 */
+	int64_t fixed = (int64_t)scaled;
+	float fraction = scaled - (float)fixed;
+	if(fraction >= 0.5f){
+		fixed++;
+	} else if(fraction <= -0.5f){
+		fixed--;
+	}
+	return FormatFixed(buf, fixed, decimals, width, pad);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
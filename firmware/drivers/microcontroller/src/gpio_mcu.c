@@ -62,6 +62,14 @@ gpio_flex_glitch_filter_config_t filter_config = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void GPIOAddIsrHandler(gpio_t pin, void *ptr_int_func, void *args){
+	static bool isr_service_installed = false;
+	if(!isr_service_installed){	
+		gpio_install_isr_service(0);
+		isr_service_installed = true;
+	}
+    gpio_isr_handler_add(gpio_list[pin].pin, ptr_int_func, (void *)args);	
+}
 
 /*==================[external functions definition]==========================*/
 void GPIOInit(gpio_t pin, io_t io){
@@ -103,17 +111,17 @@ bool GPIORead(gpio_t pin){
 }
 
 void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args){
-	static bool isr_service_installed = false;
 	if(edge){
 		gpio_set_intr_type(gpio_list[pin].pin, GPIO_INTR_POSEDGE);
 	} else{
 		gpio_set_intr_type(gpio_list[pin].pin, GPIO_INTR_NEGEDGE);
 	}
-	if(!isr_service_installed){	
-		gpio_install_isr_service(0);
-		isr_service_installed = true;
-	}
-    gpio_isr_handler_add(gpio_list[pin].pin, ptr_int_func, (void *)args);	
+	GPIOAddIsrHandler(pin, ptr_int_func, args);
+}
+
+void GPIOActivIntBothEdges(gpio_t pin, void *ptr_int_func, void *args){
+	gpio_set_intr_type(gpio_list[pin].pin, GPIO_INTR_ANYEDGE);
+	GPIOAddIsrHandler(pin, ptr_int_func, args);
 }
 
 void GPIOInputFilter(gpio_t pin){
@@ -20,13 +20,72 @@
 /*==================[macros and definitions]=================================*/
 #define I2C_NUM I2C_NUM_0
 
+#define I2C_QUEUE_TASK_STACK    3072
+#define I2C_QUEUE_TASK_PRIORITY 10
+
 #undef ESP_ERROR_CHECK
 #define ESP_ERROR_CHECK(x)   do { esp_err_t rc = (x); if (rc != ESP_OK) { ESP_LOGE("err", "esp_err_t = %d", rc); /*assert(0 && #x);*/} } while(0);
 
 /*==================[internal data definition]===============================*/
+static i2c_queue_t i2c_queue;
+static TaskHandle_t i2c_queue_task = NULL;
+static portMUX_TYPE i2c_queue_lock = portMUX_INITIALIZER_UNLOCKED;
 
 /*==================[internal functions declaration]=========================*/
 
+/** Transfer of the queue: write, and read after a repeated start
+ */
+static bool I2C_queueTransfer(uint8_t address, const uint8_t *tx, uint16_t tx_len, uint8_t *rx, uint16_t rx_len, void *param) {
+	esp_err_t rc;
+
+	if(rx_len > 0){
+		rc = i2c_master_write_read_device(I2C_NUM, address, tx, tx_len, rx, rx_len, I2C_MASTER_TIMEOUT_MS/portTICK_PERIOD_MS);
+	} else {
+		rc = i2c_master_write_to_device(I2C_NUM, address, tx, tx_len, I2C_MASTER_TIMEOUT_MS/portTICK_PERIOD_MS);
+	}
+	return rc == ESP_OK;
+}
+
+static void I2C_queueDelay(uint32_t ms, void *param) {
+	vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+/** Runs the transactions as they are submitted, and wakes up the callers of I2C_run()
+ */
+static void I2C_queueTask(void *param) {
+	i2c_transaction_t *transaction;
+	TaskHandle_t waiter;
+
+	while(1){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		while(1){
+			/* I2C_run() may cancel a transaction that has not been taken */
+			portENTER_CRITICAL(&i2c_queue_lock);
+			transaction = I2cQueueTake(&i2c_queue);
+			portEXIT_CRITICAL(&i2c_queue_lock);
+			if(transaction == NULL){
+				break;
+			}
+			I2cQueueRun(&i2c_queue, transaction);
+			waiter = (TaskHandle_t)transaction->waiter_p;
+			if(waiter != NULL){
+				xTaskNotifyGive(waiter);
+				/* Last access to the transaction, I2C_run() returns after it */
+				transaction->waiter_p = NULL;
+			}
+		}
+	}
+}
+
+static void I2C_queueConfig(void) {
+	i2c_queue_config_t config = {
+		.transfer_p = I2C_queueTransfer,
+		.delay_p = I2C_queueDelay,
+		.param_p = NULL,
+	};
+	I2cQueueInit(&i2c_queue, &config);
+}
+
 /*==================[external functions definition]==========================*/
 
 /** Initialize I2C0
@@ -124,25 +183,25 @@ int8_t I2C_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t ti
  * @return I2C_TransferReturn_TypeDef http://downloads.energymicro.com/documentation/doxygen/group__I2C.html
  */
 int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-	i2c_cmd_handle_t cmd;
-	I2C_SelectRegister(devAddr, regAddr);
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_READ, 1));
-
-	if(length>1)
-	ESP_ERROR_CHECK(i2c_master_read(cmd, data, length-1, I2C_MASTER_ACK));
-
-	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+length-1, I2C_MASTER_NACK));
-
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
-
+	I2C_readBurst(devAddr, regAddr, length, data);
 	return length;
 }
 
+/** Read a burst of bytes from a device register.
+ * The address is written and the data read with a repeated start in between,
+ * so no other master takes the bus and the device keeps the register.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @return Status of read operation (true = success)
+ */
+bool I2C_readBurst(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+	esp_err_t rc = i2c_master_write_read_device(I2C_NUM, devAddr, &regAddr, 1, data, length, I2C_MASTER_TIMEOUT_MS/portTICK_PERIOD_MS);
+	ESP_ERROR_CHECK(rc);
+	return rc == ESP_OK;
+}
+
 bool I2C_writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data){
 
 	uint8_t data1[] = {(uint8_t)(data>>8), (uint8_t)(data & 0xff)};
@@ -264,4 +323,78 @@ int8_t I2C_readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t t
 	return 0;
 }
 
+bool I2C_initQueue(void) {
+	if(i2c_queue_task != NULL){
+		return true;
+	}
+	I2C_queueConfig();
+	return xTaskCreate(I2C_queueTask, "i2c_queue", I2C_QUEUE_TASK_STACK, NULL, I2C_QUEUE_TASK_PRIORITY, &i2c_queue_task) == pdPASS;
+}
+
+bool I2C_submit(i2c_transaction_t *transaction) {
+	bool ok;
+
+	if(i2c_queue_task == NULL){
+		return false;
+	}
+	portENTER_CRITICAL_SAFE(&i2c_queue_lock);
+	ok = I2cQueueSubmit(&i2c_queue, transaction);
+	portEXIT_CRITICAL_SAFE(&i2c_queue_lock);
+	if(ok){
+		xTaskNotifyGive(i2c_queue_task);
+	}
+	return ok;
+}
+
+bool I2C_run(i2c_transaction_t *transaction, uint32_t timeout_ms) {
+	TaskHandle_t self = xTaskGetCurrentTaskHandle();
+	TickType_t start = xTaskGetTickCount();
+	TickType_t wait = pdMS_TO_TICKS(timeout_ms);
+	uint32_t received = 0;
+	bool cancelled;
+
+	if(i2c_queue_task == NULL){
+		/* The bus is only used by the caller */
+		if(i2c_queue.config.transfer_p == NULL){
+			I2C_queueConfig();
+		}
+		transaction->waiter_p = NULL;
+		return I2cQueueRun(&i2c_queue, transaction);
+	}
+	transaction->waiter_p = self;
+	if(!I2C_submit(transaction)){
+		transaction->waiter_p = NULL;
+		return false;
+	}
+	/* Other notifications of the caller may wake it up before, they are counted */
+	while(transaction->status == I2C_TRANSACTION_PENDING && xTaskGetTickCount() - start < wait){
+		received += ulTaskNotifyTake(pdTRUE, wait - (xTaskGetTickCount() - start));
+	}
+	if(transaction->status == I2C_TRANSACTION_PENDING){
+		portENTER_CRITICAL(&i2c_queue_lock);
+		cancelled = I2cQueueCancel(&i2c_queue, transaction);
+		portEXIT_CRITICAL(&i2c_queue_lock);
+		if(cancelled){
+			transaction->waiter_p = NULL;
+		}
+	}
+	/* Taken by the task: it ends within the timeouts of its transfers */
+	while(transaction->waiter_p != NULL){
+		received += ulTaskNotifyTake(pdTRUE, 1);
+	}
+	received += ulTaskNotifyTake(pdTRUE, 0);
+	if(transaction->status != I2C_TRANSACTION_IDLE && received > 0){
+		/* The notification of the task */
+		received--;
+	}
+	while(received-- > 0){
+		xTaskNotifyGive(self);
+	}
+	return transaction->status == I2C_TRANSACTION_DONE;
+}
+
+i2c_queue_stats_t I2C_queueStats(void) {
+	return i2c_queue.stats;
+}
+
 /*==================[end of file]============================================*/
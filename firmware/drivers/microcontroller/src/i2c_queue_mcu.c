@@ -0,0 +1,234 @@
+/**
+ * @file i2c_queue_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "i2c_queue_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define QUEUE_MASK		(I2C_QUEUE_LENGTH - 1)
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static bool Transfer(i2c_queue_t *queue, uint8_t address, const uint8_t *tx, uint16_t tx_len, uint8_t *rx,
+					 uint16_t rx_len){
+	queue->stats.transfers++;
+	return queue->config.transfer_p(address, tx, tx_len, rx, rx_len, queue->config.param_p);
+}
+
+static void SetShadow(i2c_device_t *device, uint8_t reg, uint8_t value){
+	device->shadow[reg] = value;
+	device->valid[reg >> 3] |= 1 << (reg & 7);
+}
+
+static void ClearShadow(i2c_device_t *device, uint8_t reg){
+	device->valid[reg >> 3] &= ~(1 << (reg & 7));
+}
+
+static const uint8_t *WriteData(const i2c_op_t *op){
+	return (op->data != NULL) ? op->data : &op->value;
+}
+
+/**
+ * @brief Writes an operation and the ones after it that continue its registers
+ * @return Operations written, 0 on error
+ */
+static uint8_t Write(i2c_queue_t *queue, i2c_device_t *device, const i2c_op_t *ops, uint8_t n_ops){
+	uint8_t tx[I2C_QUEUE_MAX_WRITE + 1];
+	uint16_t len = ops[0].length;
+	uint8_t n = 1;
+	bool ok;
+
+	if(len == 0 || len > I2C_QUEUE_MAX_WRITE){
+		return 0;
+	}
+	tx[0] = ops[0].reg;
+	memcpy(&tx[1], WriteData(&ops[0]), len);
+	while(device->auto_increment && n < n_ops && ops[n].type == I2C_OP_WRITE &&
+		  ops[n].reg == (uint8_t)(tx[0] + len) && len + ops[n].length <= I2C_QUEUE_MAX_WRITE){
+		memcpy(&tx[1 + len], WriteData(&ops[n]), ops[n].length);
+		len += ops[n].length;
+		n++;
+		queue->stats.merged++;
+	}
+	ok = Transfer(queue, device->address, tx, len + 1, NULL, 0);
+	for(uint16_t i = 0; i < len; i++){
+		uint8_t reg = tx[0] + (device->auto_increment ? i : 0);
+		if(ok){
+			SetShadow(device, reg, tx[1 + i]);
+		}
+		else{
+			/* It is not known what was written */
+			ClearShadow(device, reg);
+		}
+	}
+	return ok ? n : 0;
+}
+
+static bool Update(i2c_queue_t *queue, i2c_device_t *device, const i2c_op_t *op){
+	uint8_t tx[2] = {op->reg, 0};
+	uint8_t value;
+
+	if(I2cDeviceShadow(device, op->reg, &value)){
+		queue->stats.shadow_hits++;
+	}
+	else if(!Transfer(queue, device->address, &op->reg, 1, &value, 1)){
+		return false;
+	}
+	tx[1] = (value & ~op->mask) | (op->value & op->mask);
+	if(tx[1] == value){
+		SetShadow(device, op->reg, value);
+		queue->stats.skipped++;
+		return true;
+	}
+	if(!Transfer(queue, device->address, tx, 2, NULL, 0)){
+		ClearShadow(device, op->reg);
+		return false;
+	}
+	SetShadow(device, op->reg, tx[1]);
+	return true;
+}
+
+/*==================[external functions definition]==========================*/
+void I2cQueueInit(i2c_queue_t *queue, const i2c_queue_config_t *config){
+	memset(queue, 0, sizeof(*queue));
+	queue->config = *config;
+}
+
+void I2cDeviceInit(i2c_device_t *device, uint8_t address, bool auto_increment){
+	device->address = address;
+	device->auto_increment = auto_increment;
+	I2cDeviceInvalidate(device);
+}
+
+void I2cDeviceInvalidate(i2c_device_t *device){
+	memset(device->valid, 0, sizeof(device->valid));
+}
+
+bool I2cDeviceShadow(const i2c_device_t *device, uint8_t reg, uint8_t *value){
+	if(!(device->valid[reg >> 3] & (1 << (reg & 7)))){
+		return false;
+	}
+	*value = device->shadow[reg];
+	return true;
+}
+
+bool I2cQueueSubmit(i2c_queue_t *queue, i2c_transaction_t *transaction){
+	if(I2cQueuePending(queue) == I2C_QUEUE_LENGTH){
+		queue->stats.full++;
+		return false;
+	}
+	transaction->status = I2C_TRANSACTION_PENDING;
+	queue->ring[queue->head & QUEUE_MASK] = transaction;
+	queue->head++;
+	return true;
+}
+
+i2c_transaction_t *I2cQueueTake(i2c_queue_t *queue){
+	i2c_transaction_t *transaction;
+
+	if(I2cQueuePending(queue) == 0){
+		return NULL;
+	}
+	transaction = queue->ring[queue->tail & QUEUE_MASK];
+	queue->tail++;
+	return transaction;
+}
+
+bool I2cQueueCancel(i2c_queue_t *queue, i2c_transaction_t *transaction){
+	uint8_t i;
+
+	for(i = queue->tail; i != queue->head; i++){
+		if(queue->ring[i & QUEUE_MASK] == transaction){
+			break;
+		}
+	}
+	if(i == queue->head){
+		return false;
+	}
+	/* The later ones move up, they keep their order */
+	for(; (uint8_t)(i + 1) != queue->head; i++){
+		queue->ring[i & QUEUE_MASK] = queue->ring[(i + 1) & QUEUE_MASK];
+	}
+	queue->head--;
+	transaction->status = I2C_TRANSACTION_IDLE;
+	return true;
+}
+
+i2c_transaction_t *I2cQueueRunNext(i2c_queue_t *queue){
+	i2c_transaction_t *transaction = I2cQueueTake(queue);
+
+	if(transaction != NULL){
+		I2cQueueRun(queue, transaction);
+	}
+	return transaction;
+}
+
+bool I2cQueueRun(i2c_queue_t *queue, i2c_transaction_t *transaction){
+	i2c_device_t *device = transaction->device;
+	const i2c_op_t *op;
+	uint8_t i = 0;
+	uint8_t n;
+	bool ok = true;
+
+	transaction->status = I2C_TRANSACTION_PENDING;
+	while(ok && i < transaction->n_ops){
+		op = &transaction->ops[i];
+		n = 1;
+		switch(op->type){
+		case I2C_OP_WRITE:
+			n = Write(queue, device, op, transaction->n_ops - i);
+			ok = (n != 0);
+			break;
+		case I2C_OP_READ:
+			ok = Transfer(queue, device->address, &op->reg, 1, op->data, op->length);
+			break;
+		case I2C_OP_UPDATE:
+			ok = Update(queue, device, op);
+			break;
+		case I2C_OP_DELAY:
+			if(queue->config.delay_p != NULL){
+				queue->config.delay_p(op->length, queue->config.param_p);
+			}
+			break;
+		default:
+			ok = false;
+			break;
+		}
+		if(ok){
+			i += n;
+		}
+	}
+	queue->stats.transactions++;
+	if(ok){
+		transaction->status = I2C_TRANSACTION_DONE;
+	}
+	else{
+		queue->stats.errors++;
+		transaction->failed_op = i;
+		transaction->status = I2C_TRANSACTION_ERROR;
+	}
+	if(transaction->func_p != NULL){
+		transaction->func_p(transaction, transaction->param_p);
+	}
+	return ok;
+}
+
+uint8_t I2cQueuePending(const i2c_queue_t *queue){
+	return (uint8_t)(queue->head - queue->tail);
+}
+
+/*==================[end of file]============================================*/
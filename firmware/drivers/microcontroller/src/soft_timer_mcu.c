@@ -0,0 +1,194 @@
+/**
+ * @file soft_timer_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include <string.h>
+#include "soft_timer_mcu.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void Record(soft_timer_t *timer, uint64_t expiry, uint64_t now){
+	uint32_t late = (now > expiry) ? (uint32_t)(now - expiry) : 0;
+
+	timer->stats.calls++;
+	timer->stats.sum_late += late;
+	if(late < timer->stats.min_late){
+		timer->stats.min_late = late;
+	}
+	if(late > timer->stats.max_late){
+		timer->stats.max_late = late;
+	}
+}
+
+static void Unlist(soft_timer_mux_t *mux, soft_timer_t *timer){
+	soft_timer_t **link = &mux->task_head;
+	soft_timer_t *previous = NULL;
+
+	while(*link != timer){
+		previous = *link;
+		link = &(*link)->next_p;
+	}
+	*link = timer->next_p;
+	if(mux->task_tail == timer){
+		mux->task_tail = previous;
+	}
+	timer->listed = false;
+}
+
+static void List(soft_timer_mux_t *mux, soft_timer_t *timer, uint64_t expiry){
+	if(timer->listed){
+		/* The task has not made the previous call yet, both are made once */
+		timer->stats.missed++;
+		return;
+	}
+	timer->listed = true;
+	timer->listed_time = expiry;
+	timer->next_p = NULL;
+	if(mux->task_tail == NULL){
+		mux->task_head = timer;
+	}
+	else{
+		mux->task_tail->next_p = timer;
+	}
+	mux->task_tail = timer;
+}
+
+/**
+ * @brief Queue the first expiry of a periodic timer after now
+ */
+static void Reschedule(soft_timer_mux_t *mux, soft_timer_t *timer, uint64_t now){
+	uint32_t skipped;
+
+	timer->count++;
+	timer->deadline.time = timer->base + (uint64_t)timer->count * timer->config.period;
+	if(timer->deadline.time <= now){
+		skipped = (now - timer->deadline.time) / timer->config.period + 1;
+		timer->count += skipped;
+		timer->stats.missed += skipped;
+		timer->deadline.time += (uint64_t)skipped * timer->config.period;
+	}
+	DeadlineQueueInsert(&mux->queue, &timer->deadline);
+}
+
+/*==================[external functions definition]==========================*/
+void SoftTimerMuxInit(soft_timer_mux_t *mux, deadline_t **storage, uint16_t size){
+	memset(mux, 0, sizeof(*mux));
+	DeadlineQueueInit(&mux->queue, storage, size);
+}
+
+void SoftTimerGroupInit(soft_timer_group_t *group, uint64_t origin){
+	group->origin = origin;
+}
+
+bool SoftTimerStart(soft_timer_mux_t *mux, soft_timer_t *timer, const soft_timer_config_t *config, uint64_t now){
+	if(timer->running || timer->listed){
+		SoftTimerStop(mux, timer);
+	}
+	timer->config = *config;
+	memset(&timer->stats, 0, sizeof(timer->stats));
+	timer->stats.min_late = UINT32_MAX;
+	timer->listed = false;
+	timer->count = 0;
+	if(config->group_p != NULL){
+		/* On the grid of the group: the first expiry after now */
+		timer->base = config->group_p->origin + config->delay;
+		if(config->period > 0 && timer->base <= now){
+			timer->count = (now - timer->base) / config->period + 1;
+		}
+	}
+	else{
+		timer->base = now + ((config->delay > 0 || config->period == 0) ? config->delay : config->period);
+	}
+	timer->deadline.time = timer->base + (uint64_t)timer->count * config->period;
+	timer->deadline.param_p = timer;
+	if(DeadlineQueueInsert(&mux->queue, &timer->deadline) == DEADLINE_FULL){
+		timer->running = false;
+		return false;
+	}
+	timer->running = true;
+	return true;
+}
+
+void SoftTimerStop(soft_timer_mux_t *mux, soft_timer_t *timer){
+	if(timer->running){
+		DeadlineQueueRemove(&mux->queue, &timer->deadline);
+		timer->running = false;
+	}
+	if(timer->listed){
+		Unlist(mux, timer);
+	}
+}
+
+bool SoftTimerNext(const soft_timer_mux_t *mux, uint64_t *time){
+	return DeadlineQueueNext(&mux->queue, time);
+}
+
+soft_timer_t *SoftTimerTakeIsr(soft_timer_mux_t *mux, uint64_t now, bool *listed){
+	deadline_t *expired;
+	soft_timer_t *timer;
+	uint64_t expiry;
+
+	while((expired = DeadlineQueuePop(&mux->queue, now)) != NULL){
+		timer = expired->param_p;
+		expiry = expired->time;
+		/* Queued again before the call, the function may stop it */
+		if(timer->config.period > 0){
+			Reschedule(mux, timer, now);
+		}
+		else{
+			timer->running = false;
+		}
+		if(timer->config.dispatch == SOFT_TIMER_ISR){
+			Record(timer, expiry, now);
+			return timer;
+		}
+		List(mux, timer, expiry);
+		*listed = true;
+	}
+	return NULL;
+}
+
+bool SoftTimerExpire(soft_timer_mux_t *mux, uint64_t now){
+	soft_timer_t *timer;
+	bool listed = false;
+
+	mux->alarms++;
+	while((timer = SoftTimerTakeIsr(mux, now, &listed)) != NULL){
+		timer->config.func_p(timer->config.param_p);
+	}
+	return listed;
+}
+
+soft_timer_t *SoftTimerTakeTask(soft_timer_mux_t *mux, uint64_t now){
+	soft_timer_t *timer = mux->task_head;
+
+	if(timer == NULL){
+		return NULL;
+	}
+	mux->task_head = timer->next_p;
+	if(mux->task_head == NULL){
+		mux->task_tail = NULL;
+	}
+	timer->listed = false;
+	Record(timer, timer->listed_time, now);
+	return timer;
+}
+
+/*==================[end of file]============================================*/
@@ -14,6 +14,8 @@
 #include <stdint.h>
 #include <string.h>
 #include "driver/spi_master.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "gpio_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define PIN_NUM_MISO	GPIO_22	/*!<  */
@@ -23,41 +25,116 @@
 #define PIN_NUM_CS2		GPIO_18	/*!<  */
 #define PIN_NUM_CS3		GPIO_9	/*!<  */
 /*==================[internal data declaration]==============================*/
-spi_device_handle_t spi_1, spi_2, spi_3;
+/**
+ * @brief State of a device of the bus
+ */
+typedef struct {
+    spi_device_handle_t handle;                 /*!< Handle, NULL until SpiInit() */
+    transfer_mode_t transfer_mode;              /*!< Transfer mode of the blocking functions */
+    void (*isr_p)(void*);                       /*!< Callback of transaction end */
+    void *user_data;                            /*!< Parameter of isr_p */
+    spi_transaction_t trans[SPI_QUEUE_SIZE];    /*!< Descriptors of the queued transactions */
+    uint8_t head;                               /*!< Next free descriptor */
+    uint8_t pending;                            /*!< Queued transactions without result */
+    void *results[SPI_QUEUE_SIZE];              /*!< Tags of the results taken to free a descriptor */
+    uint8_t results_head;                       /*!< Oldest of results */
+    uint8_t n_results;                          /*!< Tags in results */
+    uint32_t lost;                              /*!< Tags dropped, results was full */
+} spi_device_state_t;
+
 const spi_bus_config_t bus_cfg = {
     .miso_io_num = PIN_NUM_MISO,
     .mosi_io_num = PIN_NUM_MOSI,
     .sclk_io_num = PIN_NUM_CLK,
     .quadwp_io_num = -1,
     .quadhd_io_num = -1,
-    .max_transfer_sz = 4092
+    .max_transfer_sz = SPI_MAX_TRANSFER
 };
-transfer_mode_t transfer_mode_1, transfer_mode_2, transfer_mode_3;
-void (*spi_1_isr_p)(void*);	/*!<  */
-void (*spi_2_isr_p)(void*);	/*!<  */
-void (*spi_3_isr_p)(void*);	/*!<  */
-void *spi_1_user_data;	    /*!<  */
-void *spi_2_user_data;	    /*!<  */
-void *spi_3_user_data;	    /*!<  */
+static const int spi_cs_pins[] = {PIN_NUM_CS1, PIN_NUM_CS2, PIN_NUM_CS3};
+static spi_device_state_t spi_devices[3];
 /*==================[internal functions declaration]=========================*/
 static void IRAM_ATTR spi_1_isr(spi_transaction_t *t){
-	spi_1_isr_p(spi_1_user_data);
+	spi_devices[SPI_1].isr_p(spi_devices[SPI_1].user_data);
 }
 static void IRAM_ATTR spi_2_isr(spi_transaction_t *t){
-	spi_2_isr_p(spi_2_user_data);
+	spi_devices[SPI_2].isr_p(spi_devices[SPI_2].user_data);
 }
 static void IRAM_ATTR spi_3_isr(spi_transaction_t *t){
-	spi_3_isr_p(spi_3_user_data);
+	spi_devices[SPI_3].isr_p(spi_devices[SPI_3].user_data);
 }
+static const transaction_cb_t spi_isrs[] = {spi_1_isr, spi_2_isr, spi_3_isr};
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/* Frees the oldest descriptor, keeping the tag of its result for SpiGetResults() */
+static void SpiTakeResult(spi_device_state_t *dev){
+    spi_transaction_t *done;
+
+    spi_device_get_trans_result(dev->handle, &done, portMAX_DELAY);
+    dev->pending--;
+    if(done->user == NULL){
+        return;
+    }
+    if(dev->n_results == SPI_QUEUE_SIZE){
+        dev->results_head = (dev->results_head + 1) % SPI_QUEUE_SIZE;
+        dev->n_results--;
+        dev->lost++;
+    }
+    dev->results[(dev->results_head + dev->n_results) % SPI_QUEUE_SIZE] = done->user;
+    dev->n_results++;
+}
+
+/* Queues a transfer of up to SPI_MAX_TRANSFER bytes in the next descriptor */
+static void SpiQueueChunk(spi_device_state_t *dev, const uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t size, void *user){
+    spi_transaction_t *t;
+
+    /* The results come in order: the descriptor at head is free once there is room */
+    if(dev->pending == SPI_QUEUE_SIZE){
+        SpiTakeResult(dev);
+    }
+    t = &dev->trans[dev->head];
+    memset(t, 0, sizeof(spi_transaction_t));
+    t->length = size * 8;
+    t->user = user;
+    if(tx_buffer != NULL && rx_buffer == NULL && size <= sizeof(t->tx_data)){
+        /* Short writes are copied, the buffer of the caller can go away */
+        memcpy(t->tx_data, tx_buffer, size);
+        t->flags = SPI_TRANS_USE_TXDATA;
+    }
+    else{
+        t->tx_buffer = tx_buffer;
+    }
+    if(rx_buffer != NULL){
+        t->rxlength = size * 8;
+        t->rx_buffer = rx_buffer;
+    }
+    spi_device_queue_trans(dev->handle, t, portMAX_DELAY);
+    dev->pending++;
+    dev->head = (dev->head + 1) % SPI_QUEUE_SIZE;
+}
+
+static void SpiTransmit(spi_dev_t device, spi_transaction_t *t){
+    spi_device_state_t *dev = &spi_devices[device];
+
+    /* Polling and queued transactions can not be mixed */
+    SpiWaitAsync(device);
+    switch(dev->transfer_mode){
+        case SPI_POLLING:
+            spi_device_polling_transmit(dev->handle, t);
+            break;
+        case SPI_INTERRUPT:
+            spi_device_transmit(dev->handle, t);
+            break;
+    }
+}
 
 /*==================[external functions definition]==========================*/
 uint8_t SpiInit(spi_mcu_config_t* spi){
     static bool spi_initialized = false;
+    spi_device_state_t *dev = &spi_devices[spi->device];
+
     if(!spi_initialized){
 	    spi_bus_initialize(SPI2_HOST, &bus_cfg, SPI_DMA_CH_AUTO);
         spi_initialized = true;
@@ -65,40 +142,18 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
 	spi_device_interface_config_t dev_cfg = {
         .clock_speed_hz = spi->bitrate,     	
         .mode = spi->clk_mode,                  
-        .queue_size = 8,                        
+        .spics_io_num = spi_cs_pins[spi->device],
+        .queue_size = SPI_QUEUE_SIZE,           
     };
-    switch(spi->device){
-        case SPI_1:
-            dev_cfg.spics_io_num = PIN_NUM_CS1;
-            transfer_mode_1 = spi->transfer_mode;
-            if(transfer_mode_1 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_1_isr;
-            } 
-            spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_1);
-            spi_1_isr_p = spi->func_p;
-            spi_1_user_data = spi->param_p;
-            break;
-        case SPI_2:
-            dev_cfg.spics_io_num = PIN_NUM_CS2;
-            if(transfer_mode_2 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_2_isr;
-            } 
-            transfer_mode_1 = spi->transfer_mode;
-            spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_2);
-            spi_2_isr_p = spi->func_p;
-            spi_2_user_data = spi->param_p;
-            break;
-        case SPI_3:
-            dev_cfg.spics_io_num = PIN_NUM_CS3;
-            if(transfer_mode_3 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_3_isr;
-            } 
-            transfer_mode_1 = spi->transfer_mode;
-            spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_3);
-            spi_3_isr_p = spi->func_p;
-            spi_3_user_data = spi->param_p;
-            break;
+    /* A device initialized again is replaced, not added twice */
+    SpiDeInit(spi->device);
+    dev->transfer_mode = spi->transfer_mode;
+    dev->isr_p = spi->func_p;
+    dev->user_data = spi->param_p;
+    if(dev->transfer_mode == SPI_INTERRUPT && dev->isr_p != NULL){
+        dev_cfg.post_cb = spi_isrs[spi->device];
     }
+    spi_bus_add_device(SPI2_HOST, &dev_cfg, &dev->handle);
     return 0;
 }
 
@@ -108,38 +163,7 @@ void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
     t.length = rx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = rx_buffer_size * 8;
     t.rx_buffer = rx_buffer;        // Data
-    switch(device){
-        case SPI_1:
-            switch(transfer_mode_1){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
-                    break;
-            }
-            break;
-        case SPI_2:
-            switch(transfer_mode_2){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
-                    break;
-            }
-            break;
-        case SPI_3:
-            switch(transfer_mode_3){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
-                    break;
-            }
-            break;
-    }
+    SpiTransmit(device, &t);
 }
 
 void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
@@ -147,38 +171,7 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = tx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.tx_buffer = tx_buffer;        // Data
-    switch(device){
-        case SPI_1:
-            switch(transfer_mode_1){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
-                    break;
-            }
-            break;
-        case SPI_2:
-            switch(transfer_mode_2){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
-                    break;
-            }
-            break;
-        case SPI_3:
-            switch(transfer_mode_3){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
-                    break;
-            }
-            break;
-    }
+    SpiTransmit(device, &t);
 }
 
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size){
@@ -188,41 +181,80 @@ void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, ui
     t.rxlength = buffer_size * 8;
     t.tx_buffer = tx_buffer;        // Data
     t.rx_buffer = rx_buffer;        
-    switch(device){
-        case SPI_1:
-            switch(transfer_mode_1){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
-                    break;
-            }
-            break;
-        case SPI_2:
-            switch(transfer_mode_2){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
-                    break;
-            }
-            break;
-        case SPI_3:
-            switch(transfer_mode_3){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
-                    break;
-            }
+    SpiTransmit(device, &t);
+}
+
+void SpiWriteAsync(spi_dev_t device, const uint8_t * tx_buffer, uint32_t tx_buffer_size){
+    SpiQueue(device, tx_buffer, NULL, tx_buffer_size, NULL);
+}
+
+void SpiQueue(spi_dev_t device, const uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t size, void *user){
+    spi_device_state_t *dev = &spi_devices[device];
+    uint32_t len;
+
+    /* Large buffers go in several descriptors that point into them, only the last one has the tag */
+    while(size > 0){
+        len = (size > SPI_MAX_TRANSFER) ? SPI_MAX_TRANSFER : size;
+        size -= len;
+        SpiQueueChunk(dev, tx_buffer, rx_buffer, len, (size == 0) ? user : NULL);
+        if(tx_buffer != NULL){
+            tx_buffer += len;
+        }
+        if(rx_buffer != NULL){
+            rx_buffer += len;
+        }
+    }
+}
+
+uint8_t SpiGetResults(spi_dev_t device, void **users, uint8_t max_results, uint32_t wait_ms){
+    spi_device_state_t *dev = &spi_devices[device];
+    spi_transaction_t *done;
+    TickType_t start = xTaskGetTickCount();
+    TickType_t wait = pdMS_TO_TICKS(wait_ms);
+    TickType_t elapsed;
+    uint8_t n = 0;
+
+    for(; n < max_results && dev->n_results > 0; n++){
+        users[n] = dev->results[dev->results_head];
+        dev->results_head = (dev->results_head + 1) % SPI_QUEUE_SIZE;
+        dev->n_results--;
+    }
+    /* Only the first result is waited for, the rest are the ones already ended.
+       Untagged chunks before it share the same wait, not one each */
+    while(n < max_results && dev->pending > 0){
+        elapsed = xTaskGetTickCount() - start;
+        if(spi_device_get_trans_result(dev->handle, &done, (n == 0 && elapsed < wait) ? wait - elapsed : 0) != ESP_OK){
             break;
+        }
+        dev->pending--;
+        if(done->user != NULL){
+            users[n++] = done->user;
+        }
+    }
+    return n;
+}
+
+uint8_t SpiPending(spi_dev_t device){
+    return spi_devices[device].pending;
+}
+
+void SpiWaitAsync(spi_dev_t device){
+    spi_device_state_t *dev = &spi_devices[device];
+    while(dev->pending > 0){
+        SpiTakeResult(dev);
     }
 }
 
 uint8_t SpiDeInit(spi_dev_t device){
+    spi_device_state_t *dev = &spi_devices[device];
+
+    if(dev->handle != NULL){
+        SpiWaitAsync(device);
+        spi_bus_remove_device(dev->handle);
+        dev->handle = NULL;
+    }
+    dev->head = 0;
+    dev->n_results = 0;
     return 0;
 }
 
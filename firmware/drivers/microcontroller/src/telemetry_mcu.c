@@ -0,0 +1,335 @@
+/**
+ * @file telemetry_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "telemetry_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define COBS_MAX_BLOCK	0xFF
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const uint8_t type_size[TELEMETRY_TYPES] = {1, 1, 2, 2, 4, 4, 4};
+
+static const uint16_t crc_table[256] = {
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7, 0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+	0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6, 0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+	0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485, 0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+	0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4, 0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+	0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823, 0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+	0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12, 0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+	0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41, 0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+	0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70, 0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+	0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F, 0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+	0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E, 0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+	0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D, 0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+	0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C, 0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+	0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB, 0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+	0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A, 0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+	0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9, 0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+	0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8, 0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void PutU16(uint8_t *p, uint16_t value){
+	p[0] = value;
+	p[1] = value >> 8;
+}
+
+static uint16_t GetU16(const uint8_t *p){
+	return p[0] | (p[1] << 8);
+}
+
+/**
+ * @brief Sample i of an array of the given type, sign extended
+ */
+static int64_t LoadSample(const void *samples, uint8_t type, uint16_t i){
+	switch(type){
+		case TELEMETRY_U8:
+			return ((const uint8_t*)samples)[i];
+		case TELEMETRY_I8:
+			return ((const int8_t*)samples)[i];
+		case TELEMETRY_U16:
+			return ((const uint16_t*)samples)[i];
+		case TELEMETRY_I16:
+			return ((const int16_t*)samples)[i];
+		case TELEMETRY_U32:
+			return ((const uint32_t*)samples)[i];
+		case TELEMETRY_I32:
+			return ((const int32_t*)samples)[i];
+		default: {
+			uint32_t bits;
+			memcpy(&bits, &((const float*)samples)[i], sizeof(bits));
+			return bits;
+		}
+	}
+}
+
+/**
+ * @brief Store sample i into an array of the given type (truncating)
+ */
+static void StoreSample(void *samples, uint8_t type, uint16_t i, int64_t value){
+	switch(type){
+		case TELEMETRY_U8:
+		case TELEMETRY_I8:
+			((uint8_t*)samples)[i] = value;
+			break;
+		case TELEMETRY_U16:
+		case TELEMETRY_I16:
+			((uint16_t*)samples)[i] = value;
+			break;
+		default:
+			((uint32_t*)samples)[i] = value;
+			break;
+	}
+}
+
+static uint8_t * PutVarint(uint8_t *p, int64_t value){
+	/* Zigzag: small magnitudes of either sign give short varints */
+	uint64_t zz = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+	while(zz >= 0x80){
+		*p++ = zz | 0x80;
+		zz >>= 7;
+	}
+	*p++ = zz;
+	return p;
+}
+
+/**
+ * @return Pointer after the varint, NULL if it does not end before end
+ */
+static const uint8_t * GetVarint(const uint8_t *p, const uint8_t *end, int64_t *value){
+	uint64_t zz = 0;
+	for(uint8_t shift = 0; p < end && shift < 7 * TELEMETRY_SAMPLE_MAX; shift += 7){
+		uint8_t byte = *p++;
+		zz |= (uint64_t)(byte & 0x7F) << shift;
+		if((byte & 0x80) == 0){
+			*value = (int64_t)(zz >> 1) ^ -(int64_t)(zz & 1);
+			return p;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief Validate a decoded frame and call the block function
+ */
+static bool RxFrame(telemetry_rx_t *rx, const uint8_t *raw, size_t len){
+	telemetry_block_t block;
+	const uint8_t *p = raw + TELEMETRY_HEADER_LEN;
+	const uint8_t *end = raw + len - TELEMETRY_CRC_LEN;
+	uint8_t type;
+
+	if(len < TELEMETRY_HEADER_LEN + TELEMETRY_CRC_LEN){
+		rx->stats.format_errors++;
+		return false;
+	}
+	if(TelemetryCrc16(0xFFFF, raw, len - TELEMETRY_CRC_LEN) != GetU16(end)){
+		rx->stats.crc_errors++;
+		return false;
+	}
+	block.channel = raw[0];
+	block.delta = (raw[1] & TELEMETRY_DELTA) != 0;
+	block.type = type = raw[1] & ~TELEMETRY_DELTA;
+	block.seq = GetU16(&raw[2]);
+	block.count = GetU16(&raw[4]);
+	block.samples = &rx->samples;
+	if(block.channel >= TELEMETRY_CHANNELS || type >= TELEMETRY_TYPES || block.count > TELEMETRY_MAX_SAMPLES
+			|| (block.delta && type == TELEMETRY_F32)){
+		rx->stats.format_errors++;
+		return false;
+	}
+	if(block.delta){
+		int64_t value = 0;
+		for(uint16_t i = 0; i < block.count; i++){
+			int64_t delta;
+			if((p = GetVarint(p, end, &delta)) == NULL){
+				rx->stats.format_errors++;
+				return false;
+			}
+			value += delta;
+			StoreSample(&rx->samples, type, i, value);
+		}
+	} else {
+		uint8_t size = type_size[type];
+		if(end - p != (ptrdiff_t)block.count * size){
+			rx->stats.format_errors++;
+			return false;
+		}
+		for(uint16_t i = 0; i < block.count; i++, p += size){
+			int64_t value = 0;
+			for(uint8_t b = 0; b < size; b++){
+				value |= (int64_t)p[b] << (8 * b);
+			}
+			StoreSample(&rx->samples, type, i, value);
+		}
+	}
+	if(p != end){
+		rx->stats.format_errors++;
+		return false;
+	}
+	if(rx->seen & (1u << block.channel)){
+		rx->stats.lost += (uint16_t)(block.seq - rx->next_seq[block.channel]);
+	}
+	rx->seen |= 1u << block.channel;
+	rx->next_seq[block.channel] = block.seq + 1;
+	rx->stats.frames++;
+	if(rx->func_p != NULL){
+		rx->func_p(&block, rx->param_p);
+	}
+	return true;
+}
+/*==================[external functions definition]==========================*/
+uint16_t TelemetryCrc16(uint16_t crc, const uint8_t *data, size_t len){
+	while(len--){
+		crc = (crc << 8) ^ crc_table[(crc >> 8) ^ *data++];
+	}
+	return crc;
+}
+
+size_t TelemetryCobsEncode(const uint8_t *src, size_t len, uint8_t *dst){
+	uint8_t *start = dst;
+	uint8_t *code_p = dst++;
+	uint8_t code = 1;
+	for(size_t i = 0; i < len; i++){
+		uint8_t byte = src[i];
+		if(byte == 0){
+			*code_p = code;
+			code_p = dst++;
+			code = 1;
+		} else {
+			*dst++ = byte;
+			if(++code == COBS_MAX_BLOCK){
+				*code_p = code;
+				code_p = dst++;
+				code = 1;
+			}
+		}
+	}
+	*code_p = code;
+	return dst - start;
+}
+
+size_t TelemetryCobsDecode(const uint8_t *src, size_t len, uint8_t *dst){
+	size_t in = 0;
+	size_t out = 0;
+	while(in < len){
+		uint8_t code = src[in++];
+		if(code == 0 || in + code - 1 > len){
+			return 0;
+		}
+		for(uint8_t i = 1; i < code; i++){
+			uint8_t byte = src[in++];
+			if(byte == 0){
+				return 0;
+			}
+			dst[out++] = byte;
+		}
+		if(code != COBS_MAX_BLOCK && in < len){
+			dst[out++] = 0;
+		}
+	}
+	return out;
+}
+
+void TelemetryTxInit(telemetry_tx_t *tx){
+	memset(tx->seq, 0, sizeof(tx->seq));
+}
+
+size_t TelemetryEncode(telemetry_tx_t *tx, uint8_t channel, uint8_t type, const void *samples, uint16_t count){
+	/* The frame is built after the room of the COBS overhead and encoded in place */
+	uint8_t *raw = &tx->frame[TELEMETRY_COBS_OVERHEAD];
+	uint8_t *p = raw + TELEMETRY_HEADER_LEN;
+	uint8_t base = type & ~TELEMETRY_DELTA;
+	size_t len;
+
+	if(channel >= TELEMETRY_CHANNELS || base >= TELEMETRY_TYPES || count > TELEMETRY_MAX_SAMPLES){
+		return 0;
+	}
+	if(base == TELEMETRY_F32){
+		type = base;
+	}
+	raw[0] = channel;
+	raw[1] = type;
+	PutU16(&raw[2], tx->seq[channel]++);
+	PutU16(&raw[4], count);
+	if(type & TELEMETRY_DELTA){
+		int64_t previous = 0;
+		for(uint16_t i = 0; i < count; i++){
+			int64_t value = LoadSample(samples, base, i);
+			p = PutVarint(p, value - previous);
+			previous = value;
+		}
+	} else {
+		uint8_t size = type_size[base];
+		for(uint16_t i = 0; i < count; i++){
+			uint32_t value = LoadSample(samples, base, i);
+			for(uint8_t b = 0; b < size; b++){
+				*p++ = value >> (8 * b);
+			}
+		}
+	}
+	len = p - raw;
+	PutU16(p, TelemetryCrc16(0xFFFF, raw, len));
+	len = TelemetryCobsEncode(raw, len + TELEMETRY_CRC_LEN, tx->frame);
+	tx->frame[len] = 0;
+	return len + 1;
+}
+
+void TelemetryRxInit(telemetry_rx_t *rx, telemetry_block_cb_t func_p, void *param_p){
+	memset(rx, 0, sizeof(telemetry_rx_t));
+	rx->func_p = func_p;
+	rx->param_p = param_p;
+}
+
+uint32_t TelemetryRxPush(telemetry_rx_t *rx, const uint8_t *data, size_t len){
+	uint32_t frames = 0;
+	for(size_t i = 0; i < len; i++){
+		uint8_t byte = data[i];
+		if(byte != 0){
+			if(rx->len < sizeof(rx->raw)){
+				rx->raw[rx->len++] = byte;
+			} else {
+				rx->overflow = true;
+			}
+			continue;
+		}
+		/* Delimiter: empty frames are used as padding and ignored */
+		if(rx->overflow){
+			rx->stats.overflows++;
+		} else if(rx->len > 0){
+			size_t raw_len = TelemetryCobsDecode(rx->raw, rx->len, rx->raw);
+			if(raw_len == 0){
+				rx->stats.format_errors++;
+			} else if(RxFrame(rx, rx->raw, raw_len)){
+				frames++;
+			}
+		}
+		rx->len = 0;
+		rx->overflow = false;
+	}
+	return frames;
+}
+
+double TelemetrySample(const telemetry_block_t *block, uint16_t index){
+	if(block->type == TELEMETRY_F32){
+		return ((const float*)block->samples)[index];
+	}
+	return LoadSample(block->samples, block->type, index);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
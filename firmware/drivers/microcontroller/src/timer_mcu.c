@@ -14,9 +14,14 @@
 #include "driver/gptimer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_log.h"
 /*==================[macros and definitions]=================================*/
 #define US_RESOLUTION_HZ	1000000	/*!< 1usec */
 #define RESET_COUNT_VALUE	0		/*!< Reset timer count to 0 */
+#define MUX_TASK_STACK		3072
+#define MUX_TASK_PRIORITY	20		/*!< Above the application tasks */
+#define ALARM_MARGIN_US		2		/*!< Alarm of an expiry already passed, after now */
+static const char *TAG = "timer_mcu";
 /*==================[internal data declaration]==============================*/
 gptimer_handle_t timer_a = NULL;	/*!< Handle for timer A */	
 gptimer_handle_t timer_b = NULL;	/*!< Handle for timer B */			
@@ -44,6 +49,15 @@ void *timer_c_user_data;	            /*!< User data for timer C */
 gptimer_alarm_config_t alarm_config_a;  /*!< Configuration for alarm A */
 gptimer_alarm_config_t alarm_config_b;	/*!< Configuration for alarm B */
 gptimer_alarm_config_t alarm_config_c;	/*!< Configuration for alarm C */
+
+static gptimer_handle_t mux_timer = NULL;		/*!< Free running timer of the software timers */
+static TaskHandle_t mux_task = NULL;			/*!< Calls the SOFT_TIMER_TASK functions */
+static volatile bool mux_started = false;
+static volatile bool mux_starting = false;
+static volatile bool mux_failed = false;		/*!< No hardware timer was free, not tried again */
+static portMUX_TYPE mux_lock = portMUX_INITIALIZER_UNLOCKED;
+static deadline_t *mux_heap[TIMER_MUX_SIZE];
+static soft_timer_mux_t mux;					/*!< Software timers */
 /*==================[internal functions declaration]=========================*/
 static bool IRAM_ATTR timer_a_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
 	timer_a_isr_p(timer_a_user_data);
@@ -57,19 +71,101 @@ static bool IRAM_ATTR timer_c_isr(gptimer_handle_t timer, const gptimer_alarm_ev
 	timer_c_isr_p(timer_c_user_data);
 	return true;
 }
+static bool IRAM_ATTR timer_mux_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data);
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static uint64_t IRAM_ATTR TimerMuxCount(void){
+	uint64_t raw_count = 0;
+	gptimer_get_raw_count(mux_timer, &raw_count);
+	return raw_count;
+}
+
+/* Moves the alarm to the earliest expiry, or just after now if it has passed. With mux_lock taken */
+static void IRAM_ATTR TimerMuxAlarm(void){
+	gptimer_alarm_config_t alarm_config = {0};
+	uint64_t next;
+	uint64_t now;
+
+	if(!SoftTimerNext(&mux, &next)){
+		return;
+	}
+	do{
+		now = TimerMuxCount();
+		alarm_config.alarm_count = (next > now) ? next : now + ALARM_MARGIN_US;
+		gptimer_set_alarm_action(mux_timer, &alarm_config);
+		/* An alarm set in the past would not fire until the count wraps */
+	}while(alarm_config.alarm_count <= TimerMuxCount());
+}
+
+static bool IRAM_ATTR timer_mux_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	BaseType_t task_woken = pdFALSE;
+	soft_timer_t *expired;
+	soft_timer_cb_t func_p = NULL;
+	void *param_p = NULL;
+	bool listed = false;
+
+	portENTER_CRITICAL_SAFE(&mux_lock);
+	mux.alarms++;
+	portEXIT_CRITICAL_SAFE(&mux_lock);
+	do{
+		portENTER_CRITICAL_SAFE(&mux_lock);
+		expired = SoftTimerTakeIsr(&mux, TimerMuxCount(), &listed);
+		if(expired != NULL){
+			func_p = expired->config.func_p;
+			param_p = expired->config.param_p;
+		}
+		else{
+			TimerMuxAlarm();
+		}
+		portEXIT_CRITICAL_SAFE(&mux_lock);
+		/* Without the lock, the function may start and stop timers */
+		if(expired != NULL){
+			func_p(param_p);
+		}
+	}while(expired != NULL);
+	if(listed){
+		vTaskNotifyGiveFromISR(mux_task, &task_woken);
+	}
+	return true;
+}
+
+static void TimerMuxTask(void *param){
+	soft_timer_t *timer;
+	soft_timer_cb_t func_p = NULL;
+	void *param_p = NULL;
+
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		do{
+			portENTER_CRITICAL_SAFE(&mux_lock);
+			timer = SoftTimerTakeTask(&mux, TimerMuxCount());
+			if(timer != NULL){
+				func_p = timer->config.func_p;
+				param_p = timer->config.param_p;
+			}
+			portEXIT_CRITICAL_SAFE(&mux_lock);
+			if(timer != NULL){
+				func_p(param_p);
+			}
+		}while(timer != NULL);
+	}
+}
 
 /*==================[external functions definition]==========================*/
-void TimerInit(timer_config_t *timer_ini){
+bool TimerInit(timer_config_t *timer_ini){
+	esp_err_t rc = ESP_FAIL;
+
 	switch(timer_ini->timer){
 	 	case TIMER_A:
 			timer_a_isr_p = timer_ini->func_p;
 			timer_a_user_data = timer_ini->param_p;
-	 		gptimer_new_timer(&timer_config, &timer_a);
+	 		rc = gptimer_new_timer(&timer_config, &timer_a);
+			if(rc != ESP_OK){
+				break;
+			}
 			alarm_config_a.alarm_count = timer_ini->period; 
 			alarm_config_a.reload_count = RESET_COUNT_VALUE;
 			alarm_config_a.flags.auto_reload_on_alarm = true;
@@ -84,7 +180,10 @@ void TimerInit(timer_config_t *timer_ini){
 	 	case TIMER_B:
 			timer_b_isr_p = timer_ini->func_p;
 			timer_b_user_data = timer_ini->param_p;
-	 		gptimer_new_timer(&timer_config, &timer_b);
+	 		rc = gptimer_new_timer(&timer_config, &timer_b);
+			if(rc != ESP_OK){
+				break;
+			}
 			alarm_config_b.alarm_count = timer_ini->period; 
 			alarm_config_b.reload_count = RESET_COUNT_VALUE;
 			alarm_config_b.flags.auto_reload_on_alarm = true;
@@ -99,7 +198,10 @@ void TimerInit(timer_config_t *timer_ini){
 	 	case TIMER_C:
 			timer_c_isr_p = timer_ini->func_p;
 			timer_c_user_data = timer_ini->param_p;
-	 		gptimer_new_timer(&timer_config, &timer_c);
+	 		rc = gptimer_new_timer(&timer_config, &timer_c);
+			if(rc != ESP_OK){
+				break;
+			}
 			alarm_config_c.alarm_count = timer_ini->period; 
 			alarm_config_c.reload_count = RESET_COUNT_VALUE;
 			alarm_config_c.flags.auto_reload_on_alarm = true;
@@ -111,6 +213,12 @@ void TimerInit(timer_config_t *timer_ini){
 			gptimer_enable(timer_c);
 	 	break;
 	}
+	if(rc != ESP_OK){
+		/* The ESP32-C6 has two hardware timers, one of them may be used by the software timers */
+		ESP_LOGE(TAG, "Timer %d not initialized: %s", timer_ini->timer, esp_err_to_name(rc));
+		return false;
+	}
+	return true;
 }
 
 void TimerStart(timer_mcu_t timer){
@@ -188,4 +296,92 @@ void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period){
 	}
 }
 
+bool TimerMuxInit(void){
+	bool first;
+	esp_err_t rc;
+
+	if(mux_started){
+		return true;
+	}
+	if(mux_failed){
+		return false;
+	}
+	portENTER_CRITICAL_SAFE(&mux_lock);
+	first = !mux_starting;
+	mux_starting = true;
+	portEXIT_CRITICAL_SAFE(&mux_lock);
+	if(!first){
+		/* Another task is starting it */
+		while(mux_starting && !mux_started){
+			vTaskDelay(1);
+		}
+		return mux_started;
+	}
+	SoftTimerMuxInit(&mux, mux_heap, TIMER_MUX_SIZE);
+	if(mux_task == NULL && xTaskCreate(TimerMuxTask, "timer_mux", MUX_TASK_STACK, NULL, MUX_TASK_PRIORITY, &mux_task) != pdPASS){
+		mux_starting = false;
+		return false;
+	}
+	rc = gptimer_new_timer(&timer_config, &mux_timer);
+	if(rc != ESP_OK){
+		/* Every delay would retry (and log) the allocation: they busy wait from now on */
+		ESP_LOGE(TAG, "Software timers not started: %s", esp_err_to_name(rc));
+		mux_failed = true;
+		mux_starting = false;
+		return false;
+	}
+	gptimer_event_callbacks_t alarm_mux = {
+		.on_alarm = timer_mux_isr,
+	};
+	gptimer_register_event_callbacks(mux_timer, &alarm_mux, NULL);
+	gptimer_enable(mux_timer);
+	gptimer_start(mux_timer);
+	mux_started = true;
+	return true;
+}
+
+bool TimerMuxStart(soft_timer_t *timer, const soft_timer_config_t *config){
+	bool started;
+
+	if(!TimerMuxInit()){
+		return false;
+	}
+	/* Also called from the functions of the timers: the expiries are only handled by the interrupt */
+	portENTER_CRITICAL_SAFE(&mux_lock);
+	started = SoftTimerStart(&mux, timer, config, TimerMuxCount());
+	TimerMuxAlarm();
+	portEXIT_CRITICAL_SAFE(&mux_lock);
+	return started;
+}
+
+void TimerMuxStop(soft_timer_t *timer){
+	if(!mux_started){
+		return;
+	}
+	portENTER_CRITICAL_SAFE(&mux_lock);
+	SoftTimerStop(&mux, timer);
+	TimerMuxAlarm();
+	portEXIT_CRITICAL_SAFE(&mux_lock);
+}
+
+void TimerMuxGroupInit(soft_timer_group_t *group){
+	SoftTimerGroupInit(group, TimerMuxNow());
+}
+
+uint64_t TimerMuxNow(void){
+	if(!TimerMuxInit()){
+		return 0;
+	}
+	return TimerMuxCount();
+}
+
+soft_timer_stats_t TimerMuxStats(soft_timer_t *timer){
+	soft_timer_stats_t stats;
+
+	portENTER_CRITICAL_SAFE(&mux_lock);
+	stats = timer->stats;
+	portEXIT_CRITICAL_SAFE(&mux_lock);
+	return stats;
+}
+
 /*==================[end of file]============================================*/
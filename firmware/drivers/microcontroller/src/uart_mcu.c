@@ -10,98 +10,290 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdlib.h>
 #include "uart_mcu.h"
+#include "uart_ring_mcu.h"
+#include "format_mcu.h"
+#include "telemetry_mcu.h"
+#include "uart_rx_mcu.h"
 #include "gpio_mcu.h"
 #include "driver/uart.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
+#include "freertos/task.h"
 #include "esp_log.h"
 /*==================[macros and definitions]=================================*/
 #define UART_CONN_TX        GPIO_18         /*!<  */
 #define UART_CONN_RX        GPIO_19         /*!<  */
 #define TX_BUFFER_SIZE      256             /*!<  */
 #define RX_BUFFER_SIZE      256             /*!<  */
+#define RX_RING_SIZE        1024            /*!< Bytes received and not read yet (power of 2) */
+#define RX_TASK_STACK       3072
+#define RX_TASK_PRIORITY    12
 #define EVENT_QUEUE_SIZE    16              /*!<  */
 #define READ_TIMEOUT        100             /*!<  */
+#define TX_RING_SIZE        4096            /*!< Bytes queued by the sending tasks (power of 2) */
+#define TX_TASK_STACK       2048
+#define TX_TASK_PRIORITY    11
+#define UART_PORTS          2
 /*==================[internal data declaration]==============================*/
-void (*uart_pc_isr_p)(void*);	            /*!<  */
-void (*uart_conn_isr_p)(void*);	            /*!<  */
-void *uart_pc_user_data;	                /*!<  */
-void *uart_conn_user_data;	                /*!<  */
-static QueueHandle_t uart_pc_queue;         /*!<  */
-static QueueHandle_t uart_conn_queue;       /*!<  */
+/**
+ * @brief Reception state of a port
+ */
+typedef struct {
+    uart_port_t uart_num;                   /*!< ESP-IDF port */
+    QueueHandle_t queue;                    /*!< Driver events */
+    uart_ring_t ring;                       /*!< Bytes received and not read yet */
+    bool parse;                             /*!< The parser consumes the ring */
+    uart_parser_t parser;                   /*!< Line/packet parser */
+    void (*func_p)(void*);                  /*!< User function called when receiving data */
+    void *param_p;                          /*!< Parameter of func_p */
+    uart_rx_stats_t stats;                  /*!< Line errors and lost bytes */
+    TaskHandle_t task;                      /*!< Event task */
+} uart_rx_t;
+static uart_rx_t uart_rx[UART_PORTS] = {
+    {.uart_num = UART_NUM_0, .task = NULL},
+    {.uart_num = UART_NUM_1, .task = NULL},
+};
+/**
+ * @brief Transmission state of a port
+ */
+typedef struct {
+    uart_port_t uart_num;                   /*!< ESP-IDF port */
+    uart_ring_t ring;                       /*!< Bytes waiting to be sent */
+    portMUX_TYPE lock;                      /*!< Serializes the sending tasks */
+    TaskHandle_t task;                      /*!< Drain task */
+} uart_tx_t;
+static uart_tx_t uart_tx[UART_PORTS] = {
+    {.uart_num = UART_NUM_0, .lock = portMUX_INITIALIZER_UNLOCKED, .task = NULL},
+    {.uart_num = UART_NUM_1, .lock = portMUX_INITIALIZER_UNLOCKED, .task = NULL},
+};
+/**
+ * @brief Number formats of UartSendNumber()
+ */
+typedef enum {
+    NUMBER_INT,
+    NUMBER_FIXED,
+    NUMBER_FLOAT,
+} number_format_t;
 /*==================[internal functions declaration]=========================*/
+static void uart_event_task(void *pvParameters);
 
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
-static void uart_pc_event_task(void *pvParameters){
-    uart_event_t event;
-    uart_driver_install(UART_NUM_0, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 16, &uart_pc_queue, 0);
-    while(1){
-        //Waiting for UART event.
-        if (xQueueReceive(uart_pc_queue, (void *)&event, (TickType_t)portMAX_DELAY)){
-            switch(event.type) {
-                case UART_DATA:
-                    uart_pc_isr_p(uart_pc_user_data);
-                    break;
-                case UART_BREAK:
-                    break;
-                case UART_BUFFER_FULL:
-                    break;
-                case UART_FIFO_OVF:
-                    break;
-                case UART_FRAME_ERR:
-                    break;
-                case UART_PARITY_ERR:
-                    break;
-                case UART_DATA_BREAK:
-                    break;
-                case UART_PATTERN_DET:
-                    break;
-                case UART_WAKEUP:
-                    break;
-                case UART_EVENT_MAX:
-                    break;
+/**
+ * @brief Moves the bytes buffered by the driver into the RX ring (all of them
+ * in one go, in up to two contiguous reads), the bytes that do not fit are lost.
+ */
+static void UartRxDrain(uart_rx_t *rx){
+    uint8_t *data;
+    const uint8_t *chunk;
+    size_t buffered = 0;
+    size_t room;
+    int len;
+    uart_get_buffered_data_len(rx->uart_num, &buffered);
+    while(buffered > 0 && (room = UartRingReserve(&rx->ring, &data)) > 0){
+        len = uart_read_bytes(rx->uart_num, data, (buffered < room) ? buffered : room, 0);
+        if(len <= 0){
+            break;
+        }
+        UartRingCommit(&rx->ring, len);
+        buffered -= len;
+    }
+    if(UartRingReserve(&rx->ring, &data) == 0 && uart_get_buffered_data_len(rx->uart_num, &buffered) == ESP_OK && buffered > 0){
+        rx->stats.dropped += buffered;
+        uart_flush_input(rx->uart_num);
+        UartParserAbort(&rx->parser);
+    }
+    if(rx->parse){
+        while((room = UartRingPeek(&rx->ring, &chunk)) > 0){
+            UartParserPush(&rx->parser, chunk, room);
+            UartRingConsume(&rx->ring, room);
+        }
+    }
+    if(rx->func_p != NULL){
+        rx->func_p(rx->param_p);
+    }
+}
+
+/**
+ * @brief Copies up to nbytes from the RX ring, waiting up to READ_TIMEOUT
+ * ticks for them. From the user function (in the event task, the one that
+ * fills the ring) the missing bytes are read from the driver instead.
+ */
+static size_t UartRxRead(uart_rx_t *rx, uint8_t *data, size_t nbytes){
+    const uint8_t *chunk;
+    size_t read = 0;
+    size_t len;
+    int direct;
+    TickType_t start = xTaskGetTickCount();
+    TickType_t elapsed;
+    while(read < nbytes){
+        len = UartRingPeek(&rx->ring, &chunk);
+        if(len == 0){
+            elapsed = xTaskGetTickCount() - start;
+            if(elapsed >= READ_TIMEOUT){
+                break;
             }
+            if(xTaskGetCurrentTaskHandle() == rx->task){
+                // nothing refills the ring while the user function runs
+                direct = uart_read_bytes(rx->uart_num, &data[read], nbytes - read, READ_TIMEOUT - elapsed);
+                if(direct > 0){
+                    read += direct;
+                }
+                break;
+            }
+            vTaskDelay(1);
+            continue;
+        }
+        if(len > nbytes - read){
+            len = nbytes - read;
         }
+        memcpy(&data[read], chunk, len);
+        UartRingConsume(&rx->ring, len);
+        read += len;
+    }
+    return read;
+}
+
+static void UartRxInit(serial_config_t *port_config){
+    uart_rx_t *rx = &uart_rx[port_config->port];
+    rx->func_p = port_config->func_p;
+    rx->param_p = port_config->param_p;
+    rx->parse = (port_config->parser_p != NULL);
+    if(rx->parse && !UartParserInit(&rx->parser, port_config->parser_p)){
+        ESP_ERROR_CHECK(ESP_ERR_INVALID_ARG);
+    }
+    if(rx->task != NULL){
+        return;
     }
+    UartRingInit(&rx->ring, malloc(RX_RING_SIZE), RX_RING_SIZE);
+    xTaskCreate(uart_event_task, "uart_event_task", RX_TASK_STACK, rx, RX_TASK_PRIORITY, &rx->task);
 }
 
-static void uart_conn_event_task(void *pvParameters){
+/**
+ * @brief Moves every received byte into the RX ring, then runs the parser
+ * and the user function. Line errors are counted and discard the line being
+ * parsed.
+ */
+static void uart_event_task(void *pvParameters){
+    uart_rx_t *rx = pvParameters;
     uart_event_t event;
-    uart_driver_install(UART_NUM_1, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 16, &uart_conn_queue, 0);
+    uart_driver_install(rx->uart_num, RX_BUFFER_SIZE, TX_BUFFER_SIZE, EVENT_QUEUE_SIZE, &rx->queue, 0);
     while(1){
         //Waiting for UART event.
-        if(xQueueReceive(uart_conn_queue, (void *)&event, (TickType_t)portMAX_DELAY)){
+        if(xQueueReceive(rx->queue, (void *)&event, (TickType_t)portMAX_DELAY)){
             switch(event.type) {
                 case UART_DATA:
-                    uart_conn_isr_p(uart_conn_user_data);
-                    break;
-                case UART_BREAK:
+                    UartRxDrain(rx);
                     break;
                 case UART_BUFFER_FULL:
-                    break;
                 case UART_FIFO_OVF:
+                    rx->stats.overruns++;
+                    UartRxDrain(rx);
+                    UartParserAbort(&rx->parser);
                     break;
                 case UART_FRAME_ERR:
+                    rx->stats.frame_errors++;
+                    UartParserAbort(&rx->parser);
                     break;
                 case UART_PARITY_ERR:
+                    rx->stats.parity_errors++;
+                    UartParserAbort(&rx->parser);
                     break;
+                case UART_BREAK:
                 case UART_DATA_BREAK:
-                    break;
                 case UART_PATTERN_DET:
-                    break;
                 case UART_WAKEUP:
-                    break;
                 case UART_EVENT_MAX:
+                default:
                     break;
             }
         }
     }
 }
+
+/**
+ * @brief Sends the queued bytes in contiguous chunks, the only caller of
+ * uart_write_bytes() for the port.
+ */
+static void uart_tx_task(void *pvParameters){
+    uart_tx_t *tx = pvParameters;
+    const uint8_t *data;
+    size_t len;
+    // the driver may be installed by the event task
+    while(!uart_is_driver_installed(tx->uart_num)){
+        vTaskDelay(1);
+    }
+    while(1){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while((len = UartRingPeek(&tx->ring, &data)) > 0){
+            uart_write_bytes(tx->uart_num, data, len);
+            UartRingConsume(&tx->ring, len);
+        }
+    }
+}
+
+static void UartTxInit(uart_mcu_port_t port){
+    uart_tx_t *tx = &uart_tx[port];
+    if(tx->task != NULL){
+        return;
+    }
+    UartRingInit(&tx->ring, malloc(TX_RING_SIZE), TX_RING_SIZE);
+    xTaskCreate(uart_tx_task, "uart_tx_task", TX_TASK_STACK, tx, TX_TASK_PRIORITY, &tx->task);
+}
+
+static void UartTxWake(uart_tx_t *tx){
+    if(xPortInIsrContext()){
+        BaseType_t task_woken = pdFALSE;
+        vTaskNotifyGiveFromISR(tx->task, &task_woken);
+        portYIELD_FROM_ISR(task_woken);
+    } else {
+        xTaskNotifyGive(tx->task);
+    }
+}
+
+/**
+ * @brief Formats a number straight into the TX ring of the port, or through
+ * a local buffer when the contiguous room is too short (ring wrap).
+ */
+static size_t UartSendNumber(uart_mcu_port_t port, number_format_t format, int64_t value, float value_f, uint8_t decimals){
+    uart_tx_t *tx = &uart_tx[port];
+    char tmp[FORMAT_MAX_LEN];
+    uint8_t *data;
+    char *dst;
+    size_t len = 0;
+    bool in_place;
+    if(tx->task == NULL){
+        return 0;
+    }
+    portENTER_CRITICAL_SAFE(&tx->lock);
+    in_place = UartRingReserve(&tx->ring, &data) >= FORMAT_MAX_LEN;
+    dst = in_place ? (char*)data : tmp;
+    switch(format){
+        case NUMBER_INT:
+            len = FormatI64(dst, value, 0, ' ');
+            break;
+        case NUMBER_FIXED:
+            len = FormatFixed(dst, value, decimals, 0, ' ');
+            break;
+        case NUMBER_FLOAT:
+            len = FormatFloat(dst, value_f, decimals, 0, ' ');
+            break;
+    }
+    if(in_place){
+        UartRingCommit(&tx->ring, len);
+    } else {
+        len = UartRingWrite(&tx->ring, tmp, len);
+    }
+    portEXIT_CRITICAL_SAFE(&tx->lock);
+    UartTxWake(tx);
+    return len;
+}
 /*==================[external functions definition]==========================*/
 
 void UartInit(serial_config_t *port_config){
@@ -117,59 +309,33 @@ void UartInit(serial_config_t *port_config){
         case UART_PC:
             uart_param_config(UART_NUM_0, &uart_config);
             uart_set_pin(UART_NUM_0, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
-            if(port_config->func_p != UART_NO_INT){
-                uart_pc_isr_p = port_config->func_p;
-                uart_pc_queue = port_config->param_p;
-                xTaskCreate(uart_pc_event_task, "uart_pc_event_task", 2048, NULL, 12, 0);
-            }else{
-                uart_driver_install(UART_NUM_0, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 0, NULL, 0);
-            }
             break;
         case UART_CONNECTOR:
             uart_param_config(UART_NUM_1, &uart_config);
             uart_set_pin(UART_NUM_1, UART_CONN_TX, UART_CONN_RX, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
-            if(port_config->func_p != UART_NO_INT){
-                uart_conn_isr_p = port_config->func_p;
-                uart_conn_queue = port_config->param_p;
-                xTaskCreate(uart_conn_event_task, "uart_conn_event_task", 2048, NULL, 12, NULL);
-            }else{
-                uart_driver_install(UART_NUM_1, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 0, NULL, 0);
-            }
             break;
     }
+    if(port_config->func_p != UART_NO_INT || port_config->parser_p != NULL){
+        UartRxInit(port_config);
+    }else{
+        uart_driver_install(uart_rx[port_config->port].uart_num, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 0, NULL, 0);
+    }
+    UartTxInit(port_config->port);
 }
 
 uint8_t UartReadByte(uart_mcu_port_t port, uint8_t* data){
-    uart_port_t uart_num = UART_NUM_0;
-    uint16_t length = 0;
-    switch(port){
-        case UART_PC:
-                uart_num = UART_NUM_0;
-            break;
-        case UART_CONNECTOR:
-                uart_num = UART_NUM_1;
-            break;
-    }
-    length = uart_read_bytes(uart_num, data, 1, READ_TIMEOUT);
-    if(length > 0){
-        return true;
-    } else{
-        return false;
-    }
+    return UartReadBuffer(port, data, 1);
 }
 
 uint8_t UartReadBuffer(uart_mcu_port_t port, uint8_t* data, uint16_t nbytes){
-    uart_port_t uart_num = UART_NUM_0;
-    uint16_t length = 0;
-    switch(port){
-        case UART_PC:
-                uart_num = UART_NUM_0;
-            break;
-        case UART_CONNECTOR:
-                uart_num = UART_NUM_1;
-            break;
+    uart_rx_t *rx = &uart_rx[port];
+    int length = 0;
+    if(rx->task != NULL){
+        // the event task moves the received bytes into the RX ring
+        length = UartRxRead(rx, data, nbytes);
+    } else {
+        length = uart_read_bytes(rx->uart_num, data, nbytes, READ_TIMEOUT);
     }
-    length = uart_read_bytes(uart_num, data, nbytes, READ_TIMEOUT);
     if(length > 0){
         return true;
     } else{
@@ -177,59 +343,95 @@ uint8_t UartReadBuffer(uart_mcu_port_t port, uint8_t* data, uint16_t nbytes){
     }
 }
 
-void UartSendByte(uart_mcu_port_t port, const char *data){
-    uart_port_t uart_num = UART_NUM_0;
-    switch(port){
-        case UART_PC:
-                uart_num = UART_NUM_0;
-            break;
-        case UART_CONNECTOR:
-                uart_num = UART_NUM_1;
-            break;
-    }
-    uart_tx_chars(uart_num, data, 1);
+void UartGetRxStats(uart_mcu_port_t port, uart_rx_stats_t *stats){
+    uart_rx_t *rx = &uart_rx[port];
+    *stats = rx->parser.stats;
+    stats->overruns = rx->stats.overruns;
+    stats->frame_errors = rx->stats.frame_errors;
+    stats->parity_errors = rx->stats.parity_errors;
+    stats->dropped = rx->stats.dropped;
 }
 
-void UartSendString(uart_mcu_port_t port, const char *msg){
-    uart_port_t uart_num = UART_NUM_0;
-    switch(port){
-        case UART_PC:
-                uart_num = UART_NUM_0;
-            break;
-        case UART_CONNECTOR:
-                uart_num = UART_NUM_1;
-            break;
+size_t UartSendV(uart_mcu_port_t port, const uart_iov_t *iov, size_t n_iov){
+    uart_tx_t *tx = &uart_tx[port];
+    size_t total = 0;
+    size_t len;
+    bool parts;
+    if(tx->task == NULL){
+        return 0;
     }
-	while(*msg != 0){
-        uart_tx_chars(uart_num, msg, 1);
-		msg++;
-	}
+    for(size_t i = 0; i < n_iov; i++){
+        total += iov[i].len;
+    }
+    // only a message larger than the whole ring is queued in parts, from a task;
+    // any other one is queued whole or dropped and counted, without waiting
+    parts = !xPortInIsrContext() && total > TX_RING_SIZE;
+    portENTER_CRITICAL_SAFE(&tx->lock);
+    if(parts){
+        len = UartRingWritePart(&tx->ring, iov, n_iov, 0);
+    } else {
+        len = UartRingWriteV(&tx->ring, iov, n_iov);
+    }
+    portEXIT_CRITICAL_SAFE(&tx->lock);
+    UartTxWake(tx);
+    // the rest is queued as the TX task sends it
+    while(parts && len < total){
+        vTaskDelay(1);
+        portENTER_CRITICAL_SAFE(&tx->lock);
+        len += UartRingWritePart(&tx->ring, iov, n_iov, len);
+        portEXIT_CRITICAL_SAFE(&tx->lock);
+        UartTxWake(tx);
+    }
+    return len;
 }
 
-void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes){
-    uart_port_t uart_num = UART_NUM_0;
-    switch(port){
-        case UART_PC:
-                uart_num = UART_NUM_0;
-            break;
-        case UART_CONNECTOR:
-                uart_num = UART_NUM_1;
-            break;
+size_t UartSendByte(uart_mcu_port_t port, const char *data){
+    uart_iov_t iov = {.data = data, .len = 1};
+    return UartSendV(port, &iov, 1);
+}
+
+size_t UartSendString(uart_mcu_port_t port, const char *msg){
+    uart_iov_t iov = {.data = msg, .len = strlen(msg)};
+    return UartSendV(port, &iov, 1);
+}
+
+size_t UartSendBuffer(uart_mcu_port_t port, const char *data, size_t nbytes){
+    uart_iov_t iov = {.data = data, .len = nbytes};
+    return UartSendV(port, &iov, 1);
+}
+
+void UartGetTxStats(uart_mcu_port_t port, uart_tx_stats_t *stats){
+    uart_tx_t *tx = &uart_tx[port];
+    portENTER_CRITICAL_SAFE(&tx->lock);
+    *stats = tx->ring.stats;
+    portEXIT_CRITICAL_SAFE(&tx->lock);
+}
+
+size_t UartSendInt(uart_mcu_port_t port, int64_t value){
+    return UartSendNumber(port, NUMBER_INT, value, 0, 0);
+}
+
+size_t UartSendFixed(uart_mcu_port_t port, int64_t value, uint8_t decimals){
+    return UartSendNumber(port, NUMBER_FIXED, value, 0, decimals);
+}
+
+size_t UartSendFloat(uart_mcu_port_t port, float value, uint8_t decimals){
+    return UartSendNumber(port, NUMBER_FLOAT, 0, value, decimals);
+}
+
+size_t UartSendTelemetry(uart_mcu_port_t port, telemetry_tx_t *tx, uint8_t channel, uint8_t type, const void *samples, uint16_t count){
+    /* Encoded outside the lock, only the copy into the ring is serialized */
+    uart_iov_t iov = {.data = tx->frame, .len = TelemetryEncode(tx, channel, type, samples, count)};
+    if(iov.len == 0){
+        return 0;
     }
-    uart_tx_chars(uart_num, data, nbytes);
+    return UartSendV(port, &iov, 1);
 }
 
 uint8_t* UartItoa(uint32_t val, uint8_t base){
-	static uint8_t buf[32] = {0};
-	uint32_t i = 30;
-    if(val == 0){
-        return (uint8_t*)"0";
-    }else{
-        for(; val && i ; --i, val /= base){
-            buf[i] = "0123456789abcdef"[val % base];
-        }
-        return &buf[i+1];
-    }
+	static uint8_t buf[FORMAT_MAX_LEN] = {0};
+    FormatBase((char*)buf, val, base, 0, ' ');
+    return buf;
 }
 
 /*==================[end of file]============================================*/
\ No newline at end of file
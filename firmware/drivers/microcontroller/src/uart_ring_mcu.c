@@ -0,0 +1,147 @@
+/**
+ * @file uart_ring_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "uart_ring_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define LOAD(p)			__atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define STORE(p, v)		__atomic_store_n(p, v, __ATOMIC_RELEASE)
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Copy at a ring position, in two chunks if it wraps
+ */
+static void CopyIn(uart_ring_t *ring, size_t pos, const uint8_t *data, size_t len){
+	size_t index = pos & ring->mask;
+	size_t first = ring->mask + 1 - index;
+	if(first > len){
+		first = len;
+	}
+	memcpy(&ring->buffer[index], data, first);
+	memcpy(ring->buffer, data + first, len - first);
+}
+
+static void Publish(uart_ring_t *ring, size_t head, size_t len){
+	size_t used = head + len - LOAD(&ring->tail);
+	ring->stats.bytes_queued += len;
+	if(used > ring->stats.high_water){
+		ring->stats.high_water = used;
+	}
+	STORE(&ring->head, head + len);
+}
+
+static size_t Drop(uart_ring_t *ring, size_t len){
+	ring->stats.bytes_dropped += len;
+	ring->stats.writes_dropped++;
+	return 0;
+}
+/*==================[external functions definition]==========================*/
+bool UartRingInit(uart_ring_t *ring, uint8_t *buffer, size_t size){
+	if(buffer == NULL || size == 0 || (size & (size - 1)) != 0){
+		return false;
+	}
+	memset(ring, 0, sizeof(uart_ring_t));
+	ring->buffer = buffer;
+	ring->mask = size - 1;
+	return true;
+}
+
+size_t UartRingWrite(uart_ring_t *ring, const void *data, size_t len){
+	uart_iov_t iov = {.data = data, .len = len};
+	return UartRingWriteV(ring, &iov, 1);
+}
+
+size_t UartRingWriteV(uart_ring_t *ring, const uart_iov_t *iov, size_t n_iov){
+	size_t head = ring->head;
+	size_t room = ring->mask + 1 - (head - LOAD(&ring->tail));
+	size_t total = 0;
+	for(size_t i = 0; i < n_iov; i++){
+		total += iov[i].len;
+	}
+	if(total > room){
+		return Drop(ring, total);
+	}
+	size_t pos = head;
+	for(size_t i = 0; i < n_iov; i++){
+		CopyIn(ring, pos, iov[i].data, iov[i].len);
+		pos += iov[i].len;
+	}
+	Publish(ring, head, total);
+	return total;
+}
+
+size_t UartRingWritePart(uart_ring_t *ring, const uart_iov_t *iov, size_t n_iov, size_t offset){
+	size_t head = ring->head;
+	size_t room = ring->mask + 1 - (head - LOAD(&ring->tail));
+	size_t pos = head;
+	size_t len;
+	for(size_t i = 0; i < n_iov && room > 0; i++){
+		if(offset >= iov[i].len){
+			offset -= iov[i].len;
+			continue;
+		}
+		len = iov[i].len - offset;
+		if(len > room){
+			len = room;
+		}
+		CopyIn(ring, pos, (const uint8_t *)iov[i].data + offset, len);
+		pos += len;
+		room -= len;
+		offset = 0;
+	}
+	if(pos != head){
+		Publish(ring, head, pos - head);
+	}
+	return pos - head;
+}
+
+size_t UartRingReserve(uart_ring_t *ring, uint8_t **data){
+	size_t head = ring->head;
+	size_t room = ring->mask + 1 - (head - LOAD(&ring->tail));
+	size_t index = head & ring->mask;
+	size_t contiguous = ring->mask + 1 - index;
+	*data = &ring->buffer[index];
+	return (room < contiguous) ? room : contiguous;
+}
+
+void UartRingCommit(uart_ring_t *ring, size_t len){
+	Publish(ring, ring->head, len);
+}
+
+size_t UartRingPeek(uart_ring_t *ring, const uint8_t **data){
+	size_t tail = ring->tail;
+	size_t used = LOAD(&ring->head) - tail;
+	size_t index = tail & ring->mask;
+	size_t contiguous = ring->mask + 1 - index;
+	*data = &ring->buffer[index];
+	return (used < contiguous) ? used : contiguous;
+}
+
+void UartRingConsume(uart_ring_t *ring, size_t len){
+	STORE(&ring->tail, ring->tail + len);
+}
+
+size_t UartRingUsed(uart_ring_t *ring){
+	return LOAD(&ring->head) - LOAD(&ring->tail);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
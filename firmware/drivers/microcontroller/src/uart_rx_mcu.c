@@ -0,0 +1,164 @@
+/**
+ * @file uart_rx_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "uart_rx_mcu.h"
+#include "telemetry_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define FNV_OFFSET		2166136261u
+#define FNV_PRIME		16777619u
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief FNV-1a hash of a command name
+ */
+static uint32_t Hash(const char *name, size_t len){
+	uint32_t hash = FNV_OFFSET;
+	while(len--){
+		hash = (hash ^ (uint8_t)*name++) * FNV_PRIME;
+	}
+	return hash;
+}
+
+static bool IsDelimiter(const uart_parser_t *parser, uint8_t byte){
+	if(parser->config.mode == UART_RX_PACKETS){
+		return byte == 0;
+	}
+	return byte == '\r' || byte == '\n';
+}
+
+static void DispatchLine(uart_parser_t *parser){
+	char *line = parser->buf;
+	size_t len = parser->len;
+	size_t word = 0;
+	const uart_command_t *command;
+
+	line[len] = '\0';
+	while(word < len && line[word] != ' '){
+		word++;
+	}
+	command = UartParserFind(parser, line, word);
+	if(command == NULL){
+		parser->stats.unknown++;
+		if(parser->config.unknown_p != NULL){
+			parser->config.unknown_p(line, parser->config.param_p);
+		}
+		return;
+	}
+	while(word < len && line[word] == ' '){
+		word++;
+	}
+	parser->stats.lines++;
+	command->func_p(&line[word], command->param_p);
+}
+
+static void DispatchPacket(uart_parser_t *parser){
+	uint8_t *packet = (uint8_t*)parser->buf;
+	size_t len = TelemetryCobsDecode(packet, parser->len, packet);
+	if(len == 0){
+		parser->stats.bad_packets++;
+		return;
+	}
+	parser->stats.packets++;
+	if(parser->config.packet_p != NULL){
+		parser->config.packet_p(packet, len, parser->config.param_p);
+	}
+}
+/*==================[external functions definition]==========================*/
+bool UartParserInit(uart_parser_t *parser, const uart_parser_config_t *config){
+	memset(parser, 0, sizeof(uart_parser_t));
+	if(config->n_commands > UART_RX_MAX_COMMANDS){
+		return false;
+	}
+	parser->config = *config;
+	for(uint8_t i = 0; i < config->n_commands; i++){
+		const char *name = config->commands[i].name;
+		size_t len = strlen(name);
+		if(UartParserFind(parser, name, len) != NULL){
+			return false;
+		}
+		/* Open addressing with linear probing, the table is at most half full */
+		uint32_t slot = Hash(name, len) & (UART_RX_HASH_SIZE - 1);
+		while(parser->hash[slot] != 0){
+			slot = (slot + 1) & (UART_RX_HASH_SIZE - 1);
+		}
+		parser->hash[slot] = i + 1;
+	}
+	return true;
+}
+
+const uart_command_t * UartParserFind(const uart_parser_t *parser, const char *name, size_t len){
+	uint32_t slot = Hash(name, len) & (UART_RX_HASH_SIZE - 1);
+	while(parser->hash[slot] != 0){
+		const uart_command_t *command = &parser->config.commands[parser->hash[slot] - 1];
+		if(strncmp(command->name, name, len) == 0 && command->name[len] == '\0'){
+			return command;
+		}
+		slot = (slot + 1) & (UART_RX_HASH_SIZE - 1);
+	}
+	return NULL;
+}
+
+uint32_t UartParserPush(uart_parser_t *parser, const uint8_t *data, size_t len){
+	uint32_t found = 0;
+	const uint8_t *end = data + len;
+	while(data < end){
+		/* Copy up to the next delimiter in one go */
+		const uint8_t *p = data;
+		while(p < end && !IsDelimiter(parser, *p)){
+			p++;
+		}
+		size_t chunk = p - data;
+		if(!parser->discard){
+			if(parser->len + chunk > UART_RX_LINE_MAX){
+				parser->discard = true;
+				parser->stats.too_long++;
+			} else {
+				memcpy(&parser->buf[parser->len], data, chunk);
+				parser->len += chunk;
+			}
+		}
+		if(p == end){
+			break;
+		}
+		/* Delimiter */
+		if(!parser->discard && parser->len > 0){
+			if(parser->config.mode == UART_RX_PACKETS){
+				DispatchPacket(parser);
+			} else {
+				DispatchLine(parser);
+			}
+			found++;
+		}
+		parser->len = 0;
+		parser->discard = false;
+		data = p + 1;
+	}
+	return found;
+}
+
+void UartParserAbort(uart_parser_t *parser){
+	parser->len = 0;
+	parser->discard = true;
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
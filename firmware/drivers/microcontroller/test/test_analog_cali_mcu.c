@@ -0,0 +1,122 @@
+/**
+ * @file test_analog_cali_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the raw to mV conversion
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include "unity.h"
+#include "analog_cali_mcu.h"
+#include "analog_ring_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define BLOCK_SIZE	512
+/*==================[internal data definition]===============================*/
+static uint16_t lut[ANALOG_CALI_LUT_SIZE];
+/*==================[internal functions definition]==========================*/
+/* Reference curve like the ones of the curve fitting scheme: gain, offset and a slight bow (mV) */
+static int ReferenceCurve(uint16_t raw, void *param){
+	double x = raw;
+	double offset = *(double *)param;
+	return (int)lround(offset + 0.78 * x + 2.1e-5 * x * x - 3.5e-9 * x * x * x);
+}
+
+static int LinearCurve(uint16_t raw, void *param){
+	return 10 + raw / 2;
+}
+
+TEST_CASE("AnalogCali LUT matches the reference curve", "[analog_cali]")
+{
+	analog_cali_t cali;
+	double offset = 12;
+	uint16_t raw[BLOCK_SIZE], mv[BLOCK_SIZE];
+
+	TEST_ASSERT_FALSE(AnalogCaliInitLut(&cali, NULL, ReferenceCurve, &offset));
+	TEST_ASSERT_TRUE(AnalogCaliInitLut(&cali, lut, ReferenceCurve, &offset));
+	for(int r = 0; r < ANALOG_CALI_LUT_SIZE; r++){
+		TEST_ASSERT_EQUAL(ReferenceCurve(r, &offset), AnalogCaliConvert(&cali, r));
+	}
+	/* Packed samples: the channel bits are ignored, in place conversion */
+	for(int i = 0; i < BLOCK_SIZE; i++){
+		raw[i] = ANALOG_SAMPLE(i % 4, i * 8);
+		mv[i] = raw[i];
+	}
+	AnalogCaliConvertBlock(&cali, raw, mv, BLOCK_SIZE);
+	AnalogCaliConvertBlock(&cali, raw, raw, BLOCK_SIZE);
+	for(int i = 0; i < BLOCK_SIZE; i++){
+		TEST_ASSERT_EQUAL(ReferenceCurve(i * 8, &offset), mv[i]);
+		TEST_ASSERT_EQUAL(mv[i], raw[i]);
+	}
+}
+
+TEST_CASE("AnalogCali LUT clamps negative values", "[analog_cali]")
+{
+	analog_cali_t cali;
+	double offset = -40;
+	AnalogCaliInitLut(&cali, lut, ReferenceCurve, &offset);
+	TEST_ASSERT_EQUAL(0, AnalogCaliConvert(&cali, 0));
+	TEST_ASSERT_EQUAL(ReferenceCurve(100, &offset), AnalogCaliConvert(&cali, 100));
+}
+
+TEST_CASE("AnalogCali polynomial fit", "[analog_cali]")
+{
+	analog_cali_t cali;
+	double offset = 12;
+	int max_error = 0;
+
+	TEST_ASSERT_FALSE(AnalogCaliInitPoly(&cali, 0, LinearCurve, NULL));
+	TEST_ASSERT_FALSE(AnalogCaliInitPoly(&cali, ANALOG_CALI_POLY_MAX_ORDER + 1, LinearCurve, NULL));
+
+	/* A linear curve is reproduced by the linear fit */
+	TEST_ASSERT_TRUE(AnalogCaliInitPoly(&cali, 1, LinearCurve, NULL));
+	TEST_ASSERT(cali.lut == NULL);
+	for(int r = 0; r < ANALOG_CALI_LUT_SIZE; r++){
+		int error = abs(AnalogCaliConvert(&cali, r) - LinearCurve(r, NULL));
+		max_error = error > max_error ? error : max_error;
+	}
+	TEST_ASSERT_LESS_THAN(2, max_error);
+
+	/* Order 3 follows the reference curve within the LUT rounding */
+	max_error = 0;
+	TEST_ASSERT_TRUE(AnalogCaliInitPoly(&cali, 3, ReferenceCurve, &offset));
+	for(int r = 0; r < ANALOG_CALI_LUT_SIZE; r++){
+		int error = abs(AnalogCaliConvert(&cali, r) - ReferenceCurve(r, &offset));
+		max_error = error > max_error ? error : max_error;
+	}
+	TEST_ASSERT_LESS_THAN(2, max_error);
+
+	/* Order 1 leaves the bow of the curve */
+	max_error = 0;
+	TEST_ASSERT_TRUE(AnalogCaliInitPoly(&cali, 1, ReferenceCurve, &offset));
+	for(int r = 0; r < ANALOG_CALI_LUT_SIZE; r++){
+		int error = abs(AnalogCaliConvert(&cali, r) - ReferenceCurve(r, &offset));
+		max_error = error > max_error ? error : max_error;
+	}
+	TEST_ASSERT_GREATER_OR_EQUAL(2, max_error);
+	TEST_ASSERT_LESS_THAN(40, max_error);
+}
+
+TEST_CASE("AnalogCali decimated values", "[analog_cali]")
+{
+	analog_cali_t cali;
+	double offset = 12;
+	uint16_t value[4] = {100 << 4, (100 << 4) + 8, (100 << 4) + 4, 4095 << 4};
+	uint16_t mv[4];
+
+	AnalogCaliInitLut(&cali, lut, ReferenceCurve, &offset);
+	AnalogCaliConvertFrac(&cali, value, 4, mv, 4);
+	int low = ReferenceCurve(100, &offset);
+	int high = ReferenceCurve(101, &offset);
+	TEST_ASSERT_EQUAL(low, mv[0]);
+	TEST_ASSERT_EQUAL(low + (high - low + 1) / 2, mv[1]);
+	TEST_ASSERT_EQUAL(low + (high - low + 2) / 4, mv[2]);
+	TEST_ASSERT_EQUAL(ReferenceCurve(4095, &offset), mv[3]);
+	/* Without fractional bits it is the plain conversion */
+	AnalogCaliConvertFrac(&cali, value, 0, mv, 1);
+	TEST_ASSERT_EQUAL(AnalogCaliConvert(&cali, value[0]), mv[0]);
+}
@@ -0,0 +1,119 @@
+/**
+ * @file test_analog_decimator_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the oversampling and decimation stage
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include "unity.h"
+#include "analog_decimator_mcu.h"
+#include "analog_ring_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define N_SAMPLES	1024
+/*==================[internal data definition]===============================*/
+static uint16_t samples[N_SAMPLES];
+static uint16_t out[N_SAMPLES];
+/*==================[internal functions definition]==========================*/
+TEST_CASE("AnalogDecimator parameters", "[analog_decimator]")
+{
+	analog_decimator_t dec;
+	TEST_ASSERT_FALSE(AnalogDecimatorInit(&dec, 0, 16, 0, false));
+	TEST_ASSERT_FALSE(AnalogDecimatorInit(&dec, ANALOG_DECIMATOR_MAX_ORDER + 1, 16, 0, false));
+	TEST_ASSERT_FALSE(AnalogDecimatorInit(&dec, 1, 12, 0, false));
+	TEST_ASSERT_FALSE(AnalogDecimatorInit(&dec, 3, 256, 0, false));
+	TEST_ASSERT_FALSE(AnalogDecimatorInit(&dec, 1, 256, ANALOG_DECIMATOR_MAX_EXTRA + 1, false));
+	TEST_ASSERT_FALSE(AnalogDecimatorInit(&dec, 1, 2, 2, false));
+	TEST_ASSERT_TRUE(AnalogDecimatorInit(&dec, 2, 1024, 4, true));
+	TEST_ASSERT_TRUE(AnalogDecimatorInit(&dec, 1, 1, 0, false));
+}
+
+TEST_CASE("AnalogDecimator moving sum", "[analog_decimator]")
+{
+	analog_decimator_t dec;
+	uint16_t value;
+
+	/* Full scale input keeps 16 bits, the channel bits of packed samples are ignored */
+	AnalogDecimatorInit(&dec, 1, 16, 4, false);
+	for(int i = 0; i < 15; i++){
+		TEST_ASSERT_FALSE(AnalogDecimatorPush(&dec, ANALOG_SAMPLE(3, 4095), &value));
+	}
+	TEST_ASSERT_TRUE(AnalogDecimatorPush(&dec, ANALOG_SAMPLE(3, 4095), &value));
+	TEST_ASSERT_EQUAL(4095 * 16, value);
+
+	/* Half LSB between codes: resolved with 2 extra bits */
+	AnalogDecimatorInit(&dec, 1, 16, 2, false);
+	for(int i = 0; i < N_SAMPLES; i++){
+		samples[i] = 1000 + (i & 1);
+	}
+	TEST_ASSERT_EQUAL(N_SAMPLES / 16, AnalogDecimatorProcess(&dec, samples, N_SAMPLES, out));
+	for(int i = 0; i < N_SAMPLES / 16; i++){
+		TEST_ASSERT_EQUAL(4002, out[i]);
+	}
+
+	/* In place processing */
+	AnalogDecimatorReset(&dec);
+	TEST_ASSERT_EQUAL(N_SAMPLES / 16, AnalogDecimatorProcess(&dec, samples, N_SAMPLES, samples));
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(out, samples, N_SAMPLES / 16 * sizeof(uint16_t));
+}
+
+TEST_CASE("AnalogDecimator CIC step response", "[analog_decimator]")
+{
+	analog_decimator_t dec;
+	uint16_t n;
+
+	/* Order 3: the step settles after order outputs, modulo arithmetic wraps silently */
+	AnalogDecimatorInit(&dec, 3, 64, 3, false);
+	for(int i = 0; i < N_SAMPLES; i++){
+		samples[i] = 3000;
+	}
+	for(int lap = 0; lap < 100; lap++){
+		n = AnalogDecimatorProcess(&dec, samples, N_SAMPLES, out);
+		TEST_ASSERT_EQUAL(N_SAMPLES / 64, n);
+		if(lap == 0){
+			TEST_ASSERT_LESS_THAN(3000 * 8, out[0]);
+		}
+		for(int i = (lap == 0) ? 3 : 0; i < n; i++){
+			TEST_ASSERT_EQUAL(3000 * 8, out[i]);
+		}
+	}
+}
+
+TEST_CASE("AnalogDecimator dithered output", "[analog_decimator]")
+{
+	analog_decimator_t dec;
+	uint32_t sum = 0;
+	uint16_t n_out = 0;
+
+	/* Mean 1000.3: the rounded pairs are biased (1000.4), dither averages to 1000.3 */
+	for(int i = 0; i < N_SAMPLES; i++){
+		samples[i] = 1000 + ((i % 10) < 3);
+	}
+	AnalogDecimatorInit(&dec, 1, 2, 0, false);
+	for(int lap = 0; lap < 10; lap++){
+		uint16_t n = AnalogDecimatorProcess(&dec, samples, 1000, out);
+		for(int i = 0; i < n; i++){
+			TEST_ASSERT_LESS_THAN(1002, out[i]);
+			sum += out[i];
+		}
+		n_out += n;
+	}
+	TEST_ASSERT_FLOAT_WITHIN(0.001, 1000.4, (double)sum / n_out);
+
+	sum = 0;
+	n_out = 0;
+	AnalogDecimatorInit(&dec, 1, 2, 0, true);
+	for(int lap = 0; lap < 10; lap++){
+		uint16_t n = AnalogDecimatorProcess(&dec, samples, 1000, out);
+		for(int i = 0; i < n; i++){
+			sum += out[i];
+		}
+		n_out += n;
+	}
+	TEST_ASSERT_FLOAT_WITHIN(0.02, 1000.3, (double)sum / n_out);
+}
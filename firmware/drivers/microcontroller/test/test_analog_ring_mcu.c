@@ -0,0 +1,194 @@
+/**
+ * @file test_analog_ring_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the continuous mode frame ring
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "unity.h"
+#include "analog_ring_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define FRAME_LEN	32
+#define N_FRAMES	4
+#define N_CHANNELS	3
+/*==================[internal data definition]===============================*/
+static uint32_t storage[FRAME_LEN * N_FRAMES];
+static uint32_t sim_count;
+/*==================[internal functions definition]==========================*/
+/* Simulated DMA: scans channels 1..N_CHANNELS, raw value = conversion number */
+static uint32_t SimDmaFill(uint32_t *slot, uint16_t n){
+	uint8_t bytes[FRAME_LEN * ANALOG_RESULT_BYTES];
+	for(uint16_t i = 0; i < n; i++, sim_count++){
+		uint32_t result = ANALOG_RESULT(1 + sim_count % N_CHANNELS, sim_count) | (1u << 31);
+		memcpy(&bytes[i * ANALOG_RESULT_BYTES], &result, ANALOG_RESULT_BYTES);
+	}
+	memcpy(slot, bytes, n * ANALOG_RESULT_BYTES);
+	return n * ANALOG_RESULT_BYTES;
+}
+
+static void CheckFrame(const uint16_t *samples, uint16_t len, uint32_t first){
+	for(uint16_t i = 0; i < len; i++){
+		TEST_ASSERT_EQUAL(1 + (first + i) % N_CHANNELS, ANALOG_SAMPLE_CH(samples[i]));
+		TEST_ASSERT_EQUAL((first + i) & 0x0FFF, ANALOG_SAMPLE_RAW(samples[i]));
+	}
+}
+
+TEST_CASE("AnalogPackResults in place", "[analog_ring]")
+{
+	uint32_t buffer[FRAME_LEN];
+	sim_count = 4090;
+	uint32_t n_bytes = SimDmaFill(buffer, FRAME_LEN);
+	TEST_ASSERT_EQUAL(FRAME_LEN, AnalogPackResults(buffer, n_bytes));
+	CheckFrame((const uint16_t *)buffer, FRAME_LEN, 4090);
+	/* Trailing partial result is ignored */
+	TEST_ASSERT_EQUAL(2, AnalogPackResults(buffer, 2 * ANALOG_RESULT_BYTES + 3));
+}
+
+TEST_CASE("AnalogRing producer/consumer", "[analog_ring]")
+{
+	analog_ring_t ring;
+	const uint16_t *samples;
+	uint32_t *slot;
+	uint32_t expected = 0;
+
+	TEST_ASSERT_FALSE(AnalogRingInit(&ring, storage, FRAME_LEN, ANALOG_RING_MAX_FRAMES + 1));
+	TEST_ASSERT_FALSE(AnalogRingInit(&ring, storage, 0, N_FRAMES));
+	TEST_ASSERT_TRUE(AnalogRingInit(&ring, storage, FRAME_LEN, N_FRAMES));
+	TEST_ASSERT_EQUAL(0, AnalogRingPeek(&ring, &samples));
+
+	sim_count = 0;
+	/* Several laps, the consumer lags the producer by up to 3 frames */
+	for(int lap = 0; lap < 10; lap++){
+		for(int f = 0; f < 3; f++){
+			slot = AnalogRingWriteSlot(&ring);
+			TEST_ASSERT_NOT_NULL(slot);
+			/* Last frame of each lap is shorter, as a partial DMA read */
+			uint16_t n = (f == 2) ? FRAME_LEN / 2 : FRAME_LEN;
+			TEST_ASSERT_EQUAL(n, AnalogRingCommit(&ring, SimDmaFill(slot, n)));
+		}
+		TEST_ASSERT_EQUAL(3, AnalogRingCount(&ring));
+		for(int f = 0; f < 3; f++){
+			uint16_t len = AnalogRingPeek(&ring, &samples);
+			TEST_ASSERT_EQUAL((f == 2) ? FRAME_LEN / 2 : FRAME_LEN, len);
+			CheckFrame(samples, len, expected);
+			expected += len;
+			AnalogRingRelease(&ring);
+		}
+		TEST_ASSERT_EQUAL(0, AnalogRingCount(&ring));
+	}
+	TEST_ASSERT_EQUAL(0, ring.overruns);
+}
+
+TEST_CASE("AnalogRing overrun", "[analog_ring]")
+{
+	analog_ring_t ring;
+	const uint16_t *samples;
+
+	AnalogRingInit(&ring, storage, FRAME_LEN, N_FRAMES);
+	sim_count = 0;
+	for(int f = 0; f < N_FRAMES; f++){
+		AnalogRingCommit(&ring, SimDmaFill(AnalogRingWriteSlot(&ring), FRAME_LEN));
+	}
+	TEST_ASSERT(AnalogRingWriteSlot(&ring) == NULL);
+	TEST_ASSERT(AnalogRingWriteSlot(&ring) == NULL);
+	TEST_ASSERT_EQUAL(2, ring.overruns);
+
+	/* The oldest frame is kept until it is released */
+	TEST_ASSERT_EQUAL(FRAME_LEN, AnalogRingPeek(&ring, &samples));
+	CheckFrame(samples, FRAME_LEN, 0);
+	AnalogRingRelease(&ring);
+	TEST_ASSERT_NOT_NULL(AnalogRingWriteSlot(&ring));
+
+	/* Releasing an empty ring does nothing */
+	for(int f = 0; f < N_FRAMES + 2; f++){
+		AnalogRingRelease(&ring);
+	}
+	TEST_ASSERT_EQUAL(0, AnalogRingCount(&ring));
+}
+
+TEST_CASE("AnalogSampleRing wrap around", "[analog_ring]")
+{
+	analog_sample_ring_t ring;
+	uint16_t buffer[16];
+	uint16_t block[12];
+	uint16_t out[12];
+	uint16_t next_in = 0, next_out = 0;
+
+	TEST_ASSERT_FALSE(AnalogSampleRingInit(&ring, buffer, 12));
+	TEST_ASSERT_TRUE(AnalogSampleRingInit(&ring, buffer, 16));
+	/* Blocks of 12 through a ring of 16: every other block wraps */
+	for(int k = 0; k < 20; k++){
+		for(int i = 0; i < 12; i++){
+			block[i] = next_in++;
+		}
+		TEST_ASSERT_EQUAL(12, AnalogSampleRingWrite(&ring, block, 12));
+		TEST_ASSERT_EQUAL(12, AnalogSampleRingCount(&ring));
+		TEST_ASSERT_EQUAL(5, AnalogSampleRingRead(&ring, out, 5));
+		TEST_ASSERT_EQUAL(7, AnalogSampleRingRead(&ring, out + 5, 12));
+		for(int i = 0; i < 12; i++){
+			TEST_ASSERT_EQUAL(next_out++, out[i]);
+		}
+	}
+	/* Only the free room is written */
+	TEST_ASSERT_EQUAL(12, AnalogSampleRingWrite(&ring, block, 12));
+	TEST_ASSERT_EQUAL(4, AnalogSampleRingWrite(&ring, block, 12));
+	TEST_ASSERT_EQUAL(8, ring.dropped);
+	TEST_ASSERT_EQUAL(0, AnalogSampleRingWrite(&ring, block, 1));
+	TEST_ASSERT_EQUAL(16, AnalogSampleRingCount(&ring));
+}
+
+TEST_CASE("AnalogDemux scan frames", "[analog_ring]")
+{
+	analog_sample_ring_t ring_1, ring_3;
+	uint16_t buffer_1[64], buffer_3[64];
+	analog_sample_ring_t *rings[ANALOG_DEMUX_CHANNELS] = {NULL};
+	uint16_t frame[FRAME_LEN];
+	uint16_t out[64];
+	uint32_t n;
+
+	AnalogSampleRingInit(&ring_1, buffer_1, 64);
+	AnalogSampleRingInit(&ring_3, buffer_3, 64);
+	rings[1] = &ring_1;
+	rings[3] = &ring_3;
+
+	/* Scans of channels 1, 2 and 3 (channel 2 has no ring) */
+	sim_count = 0;
+	for(int f = 0; f < 4; f++){
+		n = SimDmaFill(storage, 30);
+		AnalogPackResults(storage, n);
+		memcpy(frame, storage, 30 * sizeof(uint16_t));
+		AnalogDemux(frame, 30, rings);
+		TEST_ASSERT_EQUAL(10 * (f + 1), AnalogSampleRingCount(&ring_1));
+
+		/* Channel 3 consumer drains every other frame */
+		if(f % 2 == 1){
+			TEST_ASSERT_EQUAL(20, AnalogSampleRingRead(&ring_3, out, 64));
+			for(int i = 0; i < 20; i++){
+				uint32_t conversion = (f - 1) * 30 + 3 * i + 2;
+				TEST_ASSERT_EQUAL(3, ANALOG_SAMPLE_CH(out[i]));
+				TEST_ASSERT_EQUAL(conversion, ANALOG_SAMPLE_RAW(out[i]));
+			}
+		}
+	}
+	TEST_ASSERT_EQUAL(40, AnalogSampleRingRead(&ring_1, out, 64));
+	for(int i = 0; i < 40; i++){
+		TEST_ASSERT_EQUAL(3 * i, ANALOG_SAMPLE_RAW(out[i]));
+	}
+
+	/* A slow consumer loses the newest samples of its channel only */
+	for(int f = 0; f < 7; f++){
+		n = SimDmaFill(storage, 30);
+		AnalogPackResults(storage, n);
+		AnalogDemux((const uint16_t *)storage, 30, rings);
+	}
+	TEST_ASSERT_EQUAL(64, AnalogSampleRingCount(&ring_1));
+	TEST_ASSERT_EQUAL(6, ring_1.dropped);
+	TEST_ASSERT_EQUAL(64, AnalogSampleRingCount(&ring_3));
+	TEST_ASSERT_EQUAL(6, ring_3.dropped);
+}
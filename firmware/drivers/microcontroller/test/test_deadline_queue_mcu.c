@@ -0,0 +1,132 @@
+/**
+ * @file test_deadline_queue_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the deadline queue, on a virtual clock
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include "unity.h"
+#include "deadline_queue_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define QUEUE_SIZE		16
+/*==================[internal data definition]===============================*/
+static deadline_t *storage[QUEUE_SIZE];
+static deadline_queue_t queue;
+/*==================[internal functions definition]==========================*/
+TEST_CASE("DeadlineQueue expires in time order", "[deadline_queue]")
+{
+	deadline_t delays[4] = {{.time = 300}, {.time = 100}, {.time = 200}, {.time = 100}};
+	uint64_t next;
+
+	DeadlineQueueInit(&queue, storage, QUEUE_SIZE);
+	TEST_ASSERT_FALSE(DeadlineQueueNext(&queue, &next));
+	TEST_ASSERT_TRUE(DeadlineQueuePop(&queue, 1000) == NULL);
+
+	/* The alarm only moves for an earlier deadline */
+	TEST_ASSERT_EQUAL(DEADLINE_FIRST, DeadlineQueueInsert(&queue, &delays[0]));
+	TEST_ASSERT_EQUAL(DEADLINE_FIRST, DeadlineQueueInsert(&queue, &delays[1]));
+	TEST_ASSERT_EQUAL(DEADLINE_LATER, DeadlineQueueInsert(&queue, &delays[2]));
+	TEST_ASSERT_EQUAL(DEADLINE_LATER, DeadlineQueueInsert(&queue, &delays[3]));
+	TEST_ASSERT_TRUE(DeadlineQueueNext(&queue, &next));
+	TEST_ASSERT_EQUAL(100, next);
+
+	/* Nothing before its time, the equal ones together */
+	TEST_ASSERT_TRUE(DeadlineQueuePop(&queue, 99) == NULL);
+	TEST_ASSERT_EQUAL(100, DeadlineQueuePop(&queue, 150)->time);
+	TEST_ASSERT_EQUAL(100, DeadlineQueuePop(&queue, 150)->time);
+	TEST_ASSERT_TRUE(DeadlineQueuePop(&queue, 150) == NULL);
+	TEST_ASSERT_TRUE(DeadlineQueuePop(&queue, 500) == &delays[2]);
+	TEST_ASSERT_TRUE(DeadlineQueuePop(&queue, 500) == &delays[0]);
+	TEST_ASSERT_FALSE(DeadlineQueueNext(&queue, &next));
+	TEST_ASSERT_EQUAL(4, queue.stats.inserted);
+	TEST_ASSERT_EQUAL(4, queue.stats.expired);
+	TEST_ASSERT_EQUAL(4, queue.stats.max_depth);
+}
+
+TEST_CASE("DeadlineQueue full", "[deadline_queue]")
+{
+	deadline_t delays[QUEUE_SIZE + 1];
+
+	DeadlineQueueInit(&queue, storage, QUEUE_SIZE);
+	for(int i = 0; i <= QUEUE_SIZE; i++){
+		delays[i].time = 1000 - i;
+	}
+	for(int i = 0; i < QUEUE_SIZE; i++){
+		TEST_ASSERT_EQUAL(DEADLINE_FIRST, DeadlineQueueInsert(&queue, &delays[i]));
+	}
+	TEST_ASSERT_EQUAL(DEADLINE_FULL, DeadlineQueueInsert(&queue, &delays[QUEUE_SIZE]));
+	TEST_ASSERT_EQUAL(1, queue.stats.full);
+	TEST_ASSERT_TRUE(DeadlineQueuePop(&queue, 1000) == &delays[QUEUE_SIZE - 1]);
+	TEST_ASSERT_EQUAL(DEADLINE_FIRST, DeadlineQueueInsert(&queue, &delays[QUEUE_SIZE]));
+	TEST_ASSERT_EQUAL(QUEUE_SIZE, queue.count);
+}
+
+TEST_CASE("DeadlineQueue tasks delayed on a virtual clock", "[deadline_queue]")
+{
+	/* Each task delays again as soon as it is woken, the clock jumps to each alarm */
+	deadline_t tasks[QUEUE_SIZE];
+	uint32_t wakeups[QUEUE_SIZE] = {0};
+	uint64_t now = 0;
+	uint64_t last = 0;
+	deadline_t *expired;
+
+	srand(49);
+	DeadlineQueueInit(&queue, storage, QUEUE_SIZE);
+	for(int i = 0; i < QUEUE_SIZE; i++){
+		tasks[i].time = 51 + rand() % 5000;
+		tasks[i].param_p = &wakeups[i];
+		DeadlineQueueInsert(&queue, &tasks[i]);
+	}
+	for(int n = 0; n < 10000; n++){
+		TEST_ASSERT_TRUE(DeadlineQueueNext(&queue, &now));
+		TEST_ASSERT_TRUE(now >= last);
+		last = now;
+		expired = DeadlineQueuePop(&queue, now);
+		TEST_ASSERT_TRUE(expired != NULL);
+		/* Never early, and no one left behind */
+		TEST_ASSERT_TRUE(expired->time == now);
+		(*(uint32_t*)expired->param_p)++;
+		expired->time = now + 51 + rand() % 5000;
+		TEST_ASSERT_TRUE(DeadlineQueueInsert(&queue, expired) != DEADLINE_FULL);
+	}
+	TEST_ASSERT_EQUAL(QUEUE_SIZE, queue.count);
+	for(int i = 0; i < QUEUE_SIZE; i++){
+		TEST_ASSERT_TRUE(wakeups[i] > 0);
+		TEST_ASSERT_TRUE(tasks[i].time >= now);
+	}
+}
+
+TEST_CASE("DeadlineQueue removal", "[deadline_queue]")
+{
+	deadline_t delays[10];
+	deadline_t *expired;
+	uint64_t last = 0;
+	int n = 0;
+
+	DeadlineQueueInit(&queue, storage, QUEUE_SIZE);
+	for(int i = 0; i < 10; i++){
+		delays[i].time = (i * 7) % 10 * 100;
+		DeadlineQueueInsert(&queue, &delays[i]);
+	}
+	/* delays[0] is the earliest one (0), delays[3] is 100 */
+	TEST_ASSERT_FALSE(DeadlineQueueRemove(&queue, &delays[5]));
+	TEST_ASSERT_TRUE(DeadlineQueueRemove(&queue, &delays[0]));
+	TEST_ASSERT_FALSE(DeadlineQueueRemove(&queue, &delays[0]));
+	TEST_ASSERT_EQUAL(8, queue.count);
+
+	/* The rest still comes out in order */
+	while((expired = DeadlineQueuePop(&queue, 1000)) != NULL){
+		TEST_ASSERT_TRUE(expired != &delays[0] && expired != &delays[5]);
+		TEST_ASSERT_TRUE(expired->time >= last);
+		last = expired->time;
+		n++;
+	}
+	TEST_ASSERT_EQUAL(8, n);
+	TEST_ASSERT_FALSE(DeadlineQueueRemove(&queue, &delays[3]));
+}
@@ -0,0 +1,165 @@
+/**
+ * @file test_format_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the number formatting, checked against snprintf
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "unity.h"
+#include "format_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define N_VALUES	20000
+#define CHECK_STRING(expected, actual, len) \
+	do { \
+		TEST_ASSERT_EQUAL(strlen(expected), len); \
+		TEST_ASSERT_MESSAGE(strcmp(expected, actual) == 0, actual); \
+	} while(0)
+/*==================[internal data definition]===============================*/
+static uint64_t seed = 88172645463325252ULL;
+/*==================[internal functions definition]==========================*/
+static uint64_t Random(void){
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return seed;
+}
+
+/* Random values with every number of digits */
+static uint64_t RandomDigits(void){
+	return Random() >> (Random() % 64);
+}
+
+TEST_CASE("Format integers", "[format]")
+{
+	char buf[64], expected[64];
+	size_t len;
+	static const uint32_t edges[] = {0, 1, 9, 10, 99, 100, 101, 999, 1000, 99999999, 100000000,
+									 999999999, 1000000000, 4294967295u};
+
+	for(size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++){
+		len = FormatU32(buf, edges[i], 0, ' ');
+		snprintf(expected, sizeof(expected), "%" PRIu32, edges[i]);
+		CHECK_STRING(expected, buf, len);
+	}
+	len = FormatI32(buf, INT32_MIN, 0, ' ');
+	CHECK_STRING("-2147483648", buf, len);
+	len = FormatI64(buf, INT64_MIN, 0, ' ');
+	CHECK_STRING("-9223372036854775808", buf, len);
+	len = FormatU64(buf, UINT64_MAX, 0, ' ');
+	CHECK_STRING("18446744073709551615", buf, len);
+
+	for(int i = 0; i < N_VALUES; i++){
+		uint64_t value = RandomDigits();
+		len = FormatU32(buf, (uint32_t)value, 0, ' ');
+		snprintf(expected, sizeof(expected), "%" PRIu32, (uint32_t)value);
+		CHECK_STRING(expected, buf, len);
+		len = FormatI32(buf, (int32_t)value, 0, ' ');
+		snprintf(expected, sizeof(expected), "%" PRId32, (int32_t)value);
+		CHECK_STRING(expected, buf, len);
+		len = FormatU64(buf, value, 0, ' ');
+		snprintf(expected, sizeof(expected), "%" PRIu64, value);
+		CHECK_STRING(expected, buf, len);
+		len = FormatI64(buf, (int64_t)(value * 7), 0, ' ');
+		snprintf(expected, sizeof(expected), "%" PRId64, (int64_t)(value * 7));
+		CHECK_STRING(expected, buf, len);
+	}
+}
+
+TEST_CASE("Format padding and bases", "[format]")
+{
+	char buf[64];
+	size_t len;
+
+	len = FormatI32(buf, -42, 6, ' ');
+	CHECK_STRING("   -42", buf, len);
+	len = FormatI32(buf, -42, 6, '0');
+	CHECK_STRING("-00042", buf, len);
+	len = FormatU32(buf, 123456, 3, '0');
+	CHECK_STRING("123456", buf, len);
+	len = FormatU64(buf, 7, 40, '0');
+	TEST_ASSERT_EQUAL(40, len);
+	TEST_ASSERT_EQUAL('7', buf[39]);
+	TEST_ASSERT_EQUAL('\0', buf[40]);
+
+	len = FormatBase(buf, 0xBEEF, 16, 0, ' ');
+	CHECK_STRING("beef", buf, len);
+	len = FormatBase(buf, 0xBEEF, 16, 8, '0');
+	CHECK_STRING("0000beef", buf, len);
+	len = FormatBase(buf, 5, 2, 0, ' ');
+	CHECK_STRING("101", buf, len);
+	len = FormatBase(buf, UINT32_MAX, 2, 0, ' ');
+	TEST_ASSERT_EQUAL(32, len);
+	len = FormatBase(buf, 0, 8, 0, ' ');
+	CHECK_STRING("0", buf, len);
+	len = FormatBase(buf, 35, 3, 0, ' ');
+	CHECK_STRING("1022", buf, len);
+	len = FormatBase(buf, 4096, 10, 0, ' ');
+	CHECK_STRING("4096", buf, len);
+	TEST_ASSERT_EQUAL(0, FormatBase(buf, 10, 17, 0, ' '));
+}
+
+TEST_CASE("Format fixed point and float", "[format]")
+{
+	char buf[64], expected[64];
+	size_t len;
+
+	len = FormatFixed(buf, 1234, 2, 0, ' ');
+	CHECK_STRING("12.34", buf, len);
+	len = FormatFixed(buf, -5, 3, 0, ' ');
+	CHECK_STRING("-0.005", buf, len);
+	len = FormatFixed(buf, -5, 3, 8, '0');
+	CHECK_STRING("-000.005", buf, len);
+	len = FormatFixed(buf, 42, 0, 0, ' ');
+	CHECK_STRING("42", buf, len);
+	len = FormatFixed(buf, INT64_MIN, 9, 0, ' ');
+	CHECK_STRING("-9223372036.854775808", buf, len);
+
+	for(int i = 0; i < N_VALUES; i++){
+		int64_t value = (int64_t)RandomDigits();
+		uint8_t decimals = Random() % (FORMAT_MAX_DECIMALS + 1);
+		int64_t scale = 1;
+		for(int d = 0; d < decimals; d++){
+			scale *= 10;
+		}
+		len = FormatFixed(buf, value, decimals, 0, ' ');
+		if(decimals == 0){
+			snprintf(expected, sizeof(expected), "%" PRId64, value);
+		} else {
+			snprintf(expected, sizeof(expected), "%s%" PRId64 ".%0*" PRId64, value < 0 ? "-" : "",
+					 (value < 0 ? -(value / scale) : value / scale), decimals,
+					 (value < 0 ? -(value % scale) : value % scale));
+		}
+		CHECK_STRING(expected, buf, len);
+	}
+
+	len = FormatFloat(buf, 3.14159f, 3, 0, ' ');
+	CHECK_STRING("3.142", buf, len);
+	len = FormatFloat(buf, -0.0004f, 3, 0, ' ');
+	CHECK_STRING("0.000", buf, len);
+	/* 1e10 with 9 decimals does not fit in 64 bit fixed point, only 2^63 and up is inf */
+	len = FormatFloat(buf, 1e10f, 9, 0, ' ');
+	CHECK_STRING("10000000000.000000000", buf, len);
+	len = FormatFloat(buf, -1e10f, 9, 24, '0');
+	CHECK_STRING("-0010000000000.000000000", buf, len);
+	len = FormatFloat(buf, 1e30f, 2, 0, ' ');
+	CHECK_STRING("inf", buf, len);
+	len = FormatFloat(buf, -1e30f, 2, 0, ' ');
+	CHECK_STRING("-inf", buf, len);
+	len = FormatFloat(buf, 0.0f / 0.0f, 2, 5, '0');
+	CHECK_STRING("  nan", buf, len);
+	/* Same rounding as printf for values exactly representable at 4 decimals */
+	for(int i = -20000; i <= 20000; i += 7){
+		float value = i / 16.0f;
+		len = FormatFloat(buf, value, 4, 0, ' ');
+		snprintf(expected, sizeof(expected), "%.4f", value);
+		CHECK_STRING(expected, buf, len);
+	}
+}
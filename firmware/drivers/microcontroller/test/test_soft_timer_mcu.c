@@ -0,0 +1,253 @@
+/**
+ * @file test_soft_timer_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the software timers, on a virtual clock
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "unity.h"
+#include "soft_timer_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define MUX_SIZE		8
+#define MAX_CALLS		64
+/*==================[internal data definition]===============================*/
+static deadline_t *storage[MUX_SIZE];
+static soft_timer_mux_t mux;
+static soft_timer_t timers[MUX_SIZE];
+static uint64_t now;
+static uint64_t calls[MUX_SIZE][MAX_CALLS];	/*!< Time of each call, per timer */
+static int n_calls[MUX_SIZE];
+static int alarms;
+/*==================[internal functions definition]==========================*/
+static void Call(void *param){
+	int i = (soft_timer_t*)param - timers;
+
+	if(n_calls[i] < MAX_CALLS){
+		calls[i][n_calls[i]] = now;
+	}
+	n_calls[i]++;
+}
+
+static void Setup(void){
+	SoftTimerMuxInit(&mux, storage, MUX_SIZE);
+	memset(timers, 0, sizeof(timers));
+	memset(n_calls, 0, sizeof(n_calls));
+	alarms = 0;
+	now = 0;
+}
+
+static soft_timer_config_t Config(int i, uint32_t period, uint32_t delay){
+	soft_timer_config_t config = {
+		.period = period,
+		.delay = delay,
+		.dispatch = SOFT_TIMER_ISR,
+		.func_p = Call,
+		.param_p = &timers[i],
+	};
+	return config;
+}
+
+/* The alarm interrupt: the clock jumps to each alarm, late by latency */
+static void RunUntil(uint64_t end, uint32_t latency){
+	uint64_t alarm;
+
+	while(SoftTimerNext(&mux, &alarm) && alarm <= end){
+		now = alarm + latency;
+		alarms++;
+		SoftTimerExpire(&mux, now);
+	}
+	now = end;
+}
+
+TEST_CASE("SoftTimer periodic and one-shot on one alarm", "[soft_timer]")
+{
+	soft_timer_config_t fast = Config(0, 1000, 0);
+	soft_timer_config_t slow = Config(1, 3000, 500);
+	soft_timer_config_t once = Config(2, 0, 2500);
+
+	Setup();
+	TEST_ASSERT_TRUE(SoftTimerStart(&mux, &timers[0], &fast, now));
+	TEST_ASSERT_TRUE(SoftTimerStart(&mux, &timers[1], &slow, now));
+	TEST_ASSERT_TRUE(SoftTimerStart(&mux, &timers[2], &once, now));
+	RunUntil(10000, 0);
+
+	TEST_ASSERT_EQUAL(10, n_calls[0]);
+	TEST_ASSERT_EQUAL(4, n_calls[1]);
+	TEST_ASSERT_EQUAL(1, n_calls[2]);
+	TEST_ASSERT_EQUAL(1000, calls[0][0]);
+	TEST_ASSERT_EQUAL(10000, calls[0][9]);
+	TEST_ASSERT_EQUAL(500, calls[1][0]);
+	TEST_ASSERT_EQUAL(9500, calls[1][3]);
+	TEST_ASSERT_EQUAL(2500, calls[2][0]);
+	TEST_ASSERT_FALSE(timers[2].running);
+	TEST_ASSERT_EQUAL(15, alarms);
+
+	/* Stopped, it is not called again */
+	SoftTimerStop(&mux, &timers[1]);
+	RunUntil(20000, 0);
+	TEST_ASSERT_EQUAL(20, n_calls[0]);
+	TEST_ASSERT_EQUAL(4, n_calls[1]);
+	TEST_ASSERT_EQUAL(0, timers[0].stats.max_late);
+}
+
+TEST_CASE("SoftTimer periods do not drift with latency", "[soft_timer]")
+{
+	soft_timer_config_t tick = Config(0, 1000, 0);
+
+	Setup();
+	SoftTimerStart(&mux, &timers[0], &tick, now);
+	/* Each call is 30 us late, the next expiry is still on the grid */
+	RunUntil(50000, 30);
+	TEST_ASSERT_EQUAL(50, n_calls[0]);
+	TEST_ASSERT_EQUAL(49030, calls[0][48]);
+	TEST_ASSERT_EQUAL(30, timers[0].stats.min_late);
+	TEST_ASSERT_EQUAL(30, timers[0].stats.max_late);
+	TEST_ASSERT_EQUAL(50 * 30, timers[0].stats.sum_late);
+
+	/* The interrupt of 51000 comes 2.5 periods late: 52000 and 53000 are skipped */
+	now = 53500;
+	SoftTimerExpire(&mux, now);
+	TEST_ASSERT_EQUAL(51, n_calls[0]);
+	TEST_ASSERT_EQUAL(2, timers[0].stats.missed);
+	TEST_ASSERT_EQUAL(2500, timers[0].stats.max_late);
+	RunUntil(54000, 0);
+	TEST_ASSERT_EQUAL(54000, calls[0][51]);
+}
+
+TEST_CASE("SoftTimer groups share their timebase", "[soft_timer]")
+{
+	/* ADC every 2 ms and DAC every 4 ms, started at different times */
+	soft_timer_group_t group;
+	soft_timer_config_t adc = Config(0, 2000, 0);
+	soft_timer_config_t dac = Config(1, 4000, 0);
+	soft_timer_config_t other = Config(2, 4000, 0);
+
+	Setup();
+	now = 100;
+	SoftTimerGroupInit(&group, now);
+	adc.group_p = &group;
+	dac.group_p = &group;
+	SoftTimerStart(&mux, &timers[0], &adc, now);
+	now = 1700;
+	SoftTimerStart(&mux, &timers[1], &dac, now);
+	SoftTimerStart(&mux, &timers[2], &other, now);
+	RunUntil(40100, 0);
+
+	/* On the grid of the group, the DAC on the same interrupts as the ADC */
+	TEST_ASSERT_EQUAL(20, n_calls[0]);
+	TEST_ASSERT_EQUAL(10, n_calls[1]);
+	TEST_ASSERT_EQUAL(2100, calls[0][0]);
+	TEST_ASSERT_EQUAL(4100, calls[1][0]);
+	TEST_ASSERT_EQUAL(40100, calls[1][9]);
+	/* Without the group: 9 more alarms in the same time */
+	TEST_ASSERT_EQUAL(5700, calls[2][0]);
+	TEST_ASSERT_EQUAL(9, n_calls[2]);
+	TEST_ASSERT_EQUAL(29, alarms);
+}
+
+TEST_CASE("SoftTimer task dispatch", "[soft_timer]")
+{
+	soft_timer_config_t task = Config(0, 1000, 0);
+	soft_timer_config_t isr = Config(1, 500, 0);
+	soft_timer_t *timer;
+
+	Setup();
+	task.dispatch = SOFT_TIMER_TASK;
+	SoftTimerStart(&mux, &timers[0], &task, now);
+	SoftTimerStart(&mux, &timers[1], &isr, now);
+	TEST_ASSERT_TRUE(SoftTimerTakeTask(&mux, now) == NULL);
+
+	/* The interrupt calls the ISR timer and lists the other one */
+	now = 500;
+	TEST_ASSERT_FALSE(SoftTimerExpire(&mux, now));
+	now = 1000;
+	TEST_ASSERT_TRUE(SoftTimerExpire(&mux, now));
+	TEST_ASSERT_EQUAL(2, n_calls[1]);
+	TEST_ASSERT_EQUAL(0, n_calls[0]);
+
+	/* The task runs 200 us later */
+	now = 1200;
+	timer = SoftTimerTakeTask(&mux, now);
+	TEST_ASSERT_TRUE(timer == &timers[0]);
+	TEST_ASSERT_TRUE(SoftTimerTakeTask(&mux, now) == NULL);
+	TEST_ASSERT_EQUAL(200, timer->stats.max_late);
+
+	/* A busy task: two expiries, one call */
+	now = 2000;
+	SoftTimerExpire(&mux, now);
+	now = 3000;
+	SoftTimerExpire(&mux, now);
+	TEST_ASSERT_TRUE(SoftTimerTakeTask(&mux, now) == &timers[0]);
+	TEST_ASSERT_TRUE(SoftTimerTakeTask(&mux, now) == NULL);
+	TEST_ASSERT_EQUAL(1, timers[0].stats.missed);
+	TEST_ASSERT_EQUAL(1000, timers[0].stats.max_late);
+
+	/* Stopped while listed: the call is not made */
+	now = 4000;
+	SoftTimerExpire(&mux, now);
+	SoftTimerStop(&mux, &timers[0]);
+	TEST_ASSERT_TRUE(SoftTimerTakeTask(&mux, now) == NULL);
+	TEST_ASSERT_EQUAL(2, timers[0].stats.calls);
+}
+
+TEST_CASE("SoftTimer restart and full multiplexer", "[soft_timer]")
+{
+	soft_timer_config_t config = Config(0, 1000, 0);
+	soft_timer_t extra = {0};
+
+	Setup();
+	for(int i = 0; i < MUX_SIZE; i++){
+		config.param_p = &timers[i];
+		TEST_ASSERT_TRUE(SoftTimerStart(&mux, &timers[i], &config, now));
+	}
+	TEST_ASSERT_FALSE(SoftTimerStart(&mux, &extra, &config, now));
+	TEST_ASSERT_FALSE(extra.running);
+
+	/* Restarted with a new period, it is still queued once */
+	config = Config(3, 300, 0);
+	now = 100;
+	TEST_ASSERT_TRUE(SoftTimerStart(&mux, &timers[3], &config, now));
+	RunUntil(1000, 0);
+	TEST_ASSERT_EQUAL(3, n_calls[3]);
+	TEST_ASSERT_EQUAL(400, calls[3][0]);
+	TEST_ASSERT_EQUAL(1, n_calls[0]);
+	TEST_ASSERT_EQUAL(MUX_SIZE, mux.queue.count);
+}
+
+TEST_CASE("SoftTimer expired timers taken one by one", "[soft_timer]")
+{
+	soft_timer_config_t first = Config(0, 1000, 0);
+	soft_timer_config_t task = Config(1, 1000, 0);
+	soft_timer_config_t last = Config(2, 0, 1000);
+	soft_timer_t *timer;
+	bool listed = false;
+
+	Setup();
+	task.dispatch = SOFT_TIMER_TASK;
+	SoftTimerStart(&mux, &timers[0], &first, now);
+	SoftTimerStart(&mux, &timers[1], &task, now);
+	SoftTimerStart(&mux, &timers[2], &last, now);
+	now = 1000;
+	/* The caller calls each one outside of its critical section */
+	TEST_ASSERT_TRUE(SoftTimerTakeIsr(&mux, now, &listed) == &timers[0]);
+	/* The function of the first one stops the periodic and restarts the one-shot */
+	SoftTimerStop(&mux, &timers[0]);
+	last.delay = 500;
+	SoftTimerStart(&mux, &timers[2], &last, now);
+	timer = SoftTimerTakeIsr(&mux, now, &listed);
+	TEST_ASSERT_TRUE(timer == NULL);
+	TEST_ASSERT_TRUE(listed);
+	TEST_ASSERT_TRUE(SoftTimerTakeTask(&mux, now) == &timers[1]);
+
+	RunUntil(2000, 0);
+	TEST_ASSERT_EQUAL(1, n_calls[2]);
+	TEST_ASSERT_EQUAL(1500, calls[2][0]);
+	TEST_ASSERT_EQUAL(0, n_calls[0]);
+	TEST_ASSERT_EQUAL(1, timers[0].stats.calls);
+}
@@ -0,0 +1,229 @@
+/**
+ * @file test_telemetry_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the binary telemetry frames
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "unity.h"
+#include "telemetry_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define MAX_BLOCKS	8
+/*==================[internal data definition]===============================*/
+static telemetry_tx_t tx;
+static telemetry_rx_t rx;
+static telemetry_block_t blocks[MAX_BLOCKS];
+static double values[MAX_BLOCKS][TELEMETRY_MAX_SAMPLES];
+static uint32_t n_blocks;
+/*==================[internal functions definition]==========================*/
+static void SaveBlock(const telemetry_block_t *block, void *param){
+	TEST_ASSERT(param == &n_blocks);
+	if(n_blocks < MAX_BLOCKS){
+		blocks[n_blocks] = *block;
+		for(uint16_t i = 0; i < block->count; i++){
+			values[n_blocks][i] = TelemetrySample(block, i);
+		}
+	}
+	n_blocks++;
+}
+
+static void Reset(void){
+	TelemetryTxInit(&tx);
+	TelemetryRxInit(&rx, SaveBlock, &n_blocks);
+	n_blocks = 0;
+}
+
+/* Encode and decode one block, returns the frame length */
+static size_t RoundTrip(uint8_t channel, uint8_t type, const void *samples, uint16_t count){
+	size_t len = TelemetryEncode(&tx, channel, type, samples, count);
+	TEST_ASSERT(len > 0);
+	TEST_ASSERT_EQUAL(0, tx.frame[len - 1]);
+	TEST_ASSERT(memchr(tx.frame, 0, len - 1) == NULL);
+	n_blocks = 0;
+	TEST_ASSERT_EQUAL(1, TelemetryRxPush(&rx, tx.frame, len));
+	TEST_ASSERT_EQUAL(1, n_blocks);
+	TEST_ASSERT_EQUAL(channel, blocks[0].channel);
+	TEST_ASSERT_EQUAL(count, blocks[0].count);
+	return len;
+}
+
+TEST_CASE("Telemetry CRC-16 and COBS vectors", "[telemetry]")
+{
+	const uint8_t check[] = "123456789";
+	uint8_t enc[300];
+	uint8_t dec[300];
+	uint8_t data[300];
+
+	TEST_ASSERT_EQUAL(0x29B1, TelemetryCrc16(0xFFFF, check, 9));
+	TEST_ASSERT_EQUAL(0x29B1, TelemetryCrc16(TelemetryCrc16(0xFFFF, check, 4), check + 4, 5));
+
+	const uint8_t v1[] = {0x11, 0x22, 0x00, 0x33};
+	const uint8_t e1[] = {0x03, 0x11, 0x22, 0x02, 0x33};
+	TEST_ASSERT_EQUAL(5, TelemetryCobsEncode(v1, 4, enc));
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(e1, enc, 5);
+	TEST_ASSERT_EQUAL(4, TelemetryCobsDecode(enc, 5, dec));
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(v1, dec, 4);
+
+	const uint8_t v2[] = {0x00, 0x00};
+	const uint8_t e2[] = {0x01, 0x01, 0x01};
+	TEST_ASSERT_EQUAL(3, TelemetryCobsEncode(v2, 2, enc));
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(e2, enc, 3);
+
+	/* Blocks of 254 non zero bytes and in place encoding */
+	for(int len = 250; len < 300; len++){
+		for(int i = 0; i < len; i++){
+			data[i] = (i % 97 == 5) ? 0 : 1 + i % 255;
+		}
+		size_t overhead = 1 + len / 254;
+		memcpy(&enc[overhead], data, len);
+		size_t enc_len = TelemetryCobsEncode(&enc[overhead], len, enc);
+		TEST_ASSERT(enc_len <= len + overhead);
+		TEST_ASSERT(memchr(enc, 0, enc_len) == NULL);
+		TEST_ASSERT_EQUAL(len, TelemetryCobsDecode(enc, enc_len, enc));
+		TEST_ASSERT_EQUAL_UINT8_ARRAY(data, enc, len);
+	}
+	/* A zero inside the encoded data is not valid */
+	enc[0] = 3; enc[1] = 0; enc[2] = 5;
+	TEST_ASSERT_EQUAL(0, TelemetryCobsDecode(enc, 3, dec));
+	/* A block longer than the data is not valid */
+	enc[0] = 5; enc[1] = 1; enc[2] = 2;
+	TEST_ASSERT_EQUAL(0, TelemetryCobsDecode(enc, 3, dec));
+}
+
+TEST_CASE("Telemetry round trip of every sample type", "[telemetry]")
+{
+	uint8_t u8[] = {0, 1, 127, 128, 255};
+	int8_t i8[] = {-128, -1, 0, 1, 127};
+	uint16_t u16[] = {0, 4095, 32768, 65535, 1};
+	int16_t i16[] = {-32768, -1, 0, 32767, 12};
+	uint32_t u32[] = {0, 0xFFFFFFFF, 0x80000000, 1, 123456789};
+	int32_t i32[] = {INT32_MIN, -1, 0, INT32_MAX, -123456789};
+	float f32[] = {0.0f, -1.5f, 3.25e6f, 1e-6f, -0.0f};
+	const void *arrays[] = {u8, i8, u16, i16, u32, i32, f32};
+	const double expected[][5] = {
+		{0, 1, 127, 128, 255},
+		{-128, -1, 0, 1, 127},
+		{0, 4095, 32768, 65535, 1},
+		{-32768, -1, 0, 32767, 12},
+		{0, 4294967295.0, 2147483648.0, 1, 123456789},
+		{INT32_MIN, -1, 0, INT32_MAX, -123456789},
+		{0.0, -1.5, 3.25e6, 1e-6f, -0.0},
+	};
+
+	Reset();
+	for(uint8_t type = 0; type < TELEMETRY_TYPES; type++){
+		for(uint8_t delta = 0; delta < 2; delta++){
+			RoundTrip(type, type | (delta ? TELEMETRY_DELTA : 0), arrays[type], 5);
+			TEST_ASSERT_EQUAL(type, blocks[0].type);
+			/* Floats are never delta encoded */
+			TEST_ASSERT_EQUAL(delta && type != TELEMETRY_F32, blocks[0].delta);
+			TEST_ASSERT_EQUAL(delta, blocks[0].seq);
+			for(int i = 0; i < 5; i++){
+					TEST_ASSERT(values[0][i] == expected[type][i]);
+				}
+		}
+	}
+	TEST_ASSERT_EQUAL(2 * TELEMETRY_TYPES, rx.stats.frames);
+	TEST_ASSERT_EQUAL(0, rx.stats.lost);
+	TEST_ASSERT_EQUAL(0, rx.stats.crc_errors + rx.stats.format_errors + rx.stats.overflows);
+}
+
+TEST_CASE("Telemetry delta encoding of a slow signal", "[telemetry]")
+{
+	uint16_t ecg[TELEMETRY_MAX_SAMPLES];
+	size_t plain_len, delta_len;
+
+	Reset();
+	for(int i = 0; i < TELEMETRY_MAX_SAMPLES; i++){
+		ecg[i] = 2048 + ((i * 37) % 101) - 50;
+	}
+	plain_len = RoundTrip(0, TELEMETRY_U16, ecg, TELEMETRY_MAX_SAMPLES);
+	delta_len = RoundTrip(0, TELEMETRY_U16 | TELEMETRY_DELTA, ecg, TELEMETRY_MAX_SAMPLES);
+	for(int i = 0; i < TELEMETRY_MAX_SAMPLES; i++){
+		TEST_ASSERT(values[0][i] == ecg[i]);
+	}
+	/* Steps up to +-100: 1 or 2 bytes per sample instead of 2 */
+	TEST_ASSERT_LESS_THAN(plain_len, delta_len);
+
+	/* Worst case fits in a frame */
+	uint32_t worst[TELEMETRY_MAX_SAMPLES];
+	for(int i = 0; i < TELEMETRY_MAX_SAMPLES; i++){
+		worst[i] = (i & 1) ? 0xFFFFFFFF : 0;
+	}
+	TEST_ASSERT(RoundTrip(1, TELEMETRY_U32 | TELEMETRY_DELTA, worst, TELEMETRY_MAX_SAMPLES) <= TELEMETRY_FRAME_MAX);
+	TEST_ASSERT(values[0][TELEMETRY_MAX_SAMPLES - 1] == 0xFFFFFFFF);
+
+	TEST_ASSERT_EQUAL(0, TelemetryEncode(&tx, TELEMETRY_CHANNELS, TELEMETRY_U8, worst, 1));
+	TEST_ASSERT_EQUAL(0, TelemetryEncode(&tx, 0, TELEMETRY_TYPES, worst, 1));
+	TEST_ASSERT_EQUAL(0, TelemetryEncode(&tx, 0, TELEMETRY_U8, worst, TELEMETRY_MAX_SAMPLES + 1));
+}
+
+TEST_CASE("Telemetry lost, corrupted and split frames", "[telemetry]")
+{
+	uint8_t stream[16 * TELEMETRY_FRAME_MAX];
+	size_t len = 0;
+	int16_t samples[4] = {10, -20, 30, -40};
+
+	Reset();
+	/* Channel 2: frames 0, 1, (2 lost), 3, (4 corrupted), 5 */
+	for(int i = 0; i < 6; i++){
+		size_t frame_len = TelemetryEncode(&tx, 2, TELEMETRY_I16 | TELEMETRY_DELTA, samples, 4);
+		if(i == 2){
+			continue;
+		}
+		if(i == 4){
+			tx.frame[3] ^= 0x10;
+		}
+		memcpy(&stream[len], tx.frame, frame_len);
+		len += frame_len;
+		/* Padding between frames */
+		stream[len++] = 0;
+	}
+	/* Channel 5 interleaved, it has its own sequence numbers */
+	size_t frame_len = TelemetryEncode(&tx, 5, TELEMETRY_U8, samples, 1);
+	memcpy(&stream[len], tx.frame, frame_len);
+	len += frame_len;
+	/* Garbage before a valid frame */
+	stream[len++] = 0x55;
+	stream[len++] = 0x01;
+	stream[len++] = 0;
+
+	/* Feed the stream in odd chunks */
+	for(size_t pos = 0; pos < len; ){
+		size_t chunk = (len - pos < 7) ? len - pos : 7;
+		TelemetryRxPush(&rx, &stream[pos], chunk);
+		pos += chunk;
+	}
+	TEST_ASSERT_EQUAL(5, rx.stats.frames);
+	TEST_ASSERT_EQUAL(2, rx.stats.lost);
+	/* The corrupted frame and the garbage */
+	TEST_ASSERT_EQUAL(2, rx.stats.crc_errors + rx.stats.format_errors);
+	TEST_ASSERT_EQUAL(5, blocks[4].channel);
+	TEST_ASSERT_EQUAL(3, blocks[2].seq);
+	TEST_ASSERT_EQUAL(5, blocks[3].seq);
+	TEST_ASSERT(values[3][3] == -40);
+}
+
+TEST_CASE("Telemetry frame overflow resynchronizes", "[telemetry]")
+{
+	uint8_t junk[TELEMETRY_FRAME_MAX + 10];
+	uint8_t value = 7;
+	size_t len;
+
+	Reset();
+	memset(junk, 0x42, sizeof(junk));
+	TEST_ASSERT_EQUAL(0, TelemetryRxPush(&rx, junk, sizeof(junk)));
+	len = TelemetryEncode(&tx, 0, TELEMETRY_U8, &value, 1);
+	/* The delimiter of the junk is the first byte fed */
+	junk[0] = 0;
+	TEST_ASSERT_EQUAL(0, TelemetryRxPush(&rx, junk, 1));
+	TEST_ASSERT_EQUAL(1, rx.stats.overflows);
+	TEST_ASSERT_EQUAL(1, TelemetryRxPush(&rx, tx.frame, len));
+	TEST_ASSERT(values[0][0] == 7);
+}
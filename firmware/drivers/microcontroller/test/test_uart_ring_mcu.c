@@ -0,0 +1,157 @@
+/**
+ * @file test_uart_ring_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the UART TX ring
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "uart_ring_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define RING_SIZE	64
+#define SINK_SIZE	4096
+/*==================[internal data definition]===============================*/
+static uint8_t storage[RING_SIZE];
+static char sink[SINK_SIZE];
+static size_t sink_len;
+static size_t sink_calls;
+/*==================[internal functions definition]==========================*/
+/* Fake UART: takes up to max bytes per call, as the drain task does */
+static void SinkDrain(uart_ring_t *ring, size_t max){
+	const uint8_t *data;
+	size_t len;
+	while(max > 0 && (len = UartRingPeek(ring, &data)) > 0){
+		if(len > max){
+			len = max;
+		}
+		memcpy(&sink[sink_len], data, len);
+		sink_len += len;
+		sink_calls++;
+		UartRingConsume(ring, len);
+		max -= len;
+	}
+}
+
+TEST_CASE("UartRing messages through a fake UART", "[uart_ring]")
+{
+	uart_ring_t ring;
+	char expected[SINK_SIZE];
+	size_t expected_len = 0;
+	char line[32];
+
+	TEST_ASSERT_FALSE(UartRingInit(&ring, storage, 48));
+	TEST_ASSERT_TRUE(UartRingInit(&ring, storage, RING_SIZE));
+	sink_len = 0;
+	sink_calls = 0;
+	for(int i = 0; i < 200; i++){
+		int len = snprintf(line, sizeof(line), "Peso:%d\r\n", i * 37);
+		TEST_ASSERT_EQUAL(len, UartRingWrite(&ring, line, len));
+		memcpy(&expected[expected_len], line, len);
+		expected_len += len;
+		/* The UART is slower than the producer but keeps up on average */
+		SinkDrain(&ring, 7 + i % 11);
+	}
+	SinkDrain(&ring, SIZE_MAX);
+	TEST_ASSERT_EQUAL(expected_len, sink_len);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, sink, expected_len);
+	TEST_ASSERT_EQUAL(expected_len, ring.stats.bytes_queued);
+	TEST_ASSERT_EQUAL(0, ring.stats.writes_dropped);
+	TEST_ASSERT_LESS_THAN(RING_SIZE + 1, ring.stats.high_water);
+}
+
+TEST_CASE("UartRing vectored writes are not split", "[uart_ring]")
+{
+	uart_ring_t ring;
+	const char *value = "1234";
+	uart_iov_t iov[3] = {
+		{.data = "Velocidad Maxima:", .len = 17},
+		{.data = value, .len = 4},
+		{.data = "\r\n", .len = 2},
+	};
+	const char *message = "Velocidad Maxima:1234\r\n";
+
+	UartRingInit(&ring, storage, RING_SIZE);
+	sink_len = 0;
+	TEST_ASSERT_EQUAL(23, UartRingWriteV(&ring, iov, 3));
+	TEST_ASSERT_EQUAL(23, UartRingWriteV(&ring, iov, 3));
+	/* 18 bytes free: the whole message is dropped, nothing partial is queued */
+	TEST_ASSERT_EQUAL(0, UartRingWriteV(&ring, iov, 3));
+	TEST_ASSERT_EQUAL(1, ring.stats.writes_dropped);
+	TEST_ASSERT_EQUAL(23, ring.stats.bytes_dropped);
+	TEST_ASSERT_EQUAL(46, UartRingUsed(&ring));
+	TEST_ASSERT_EQUAL(46, ring.stats.high_water);
+
+	/* After draining, the next message wraps around the end of the buffer */
+	SinkDrain(&ring, 40);
+	TEST_ASSERT_EQUAL(23, UartRingWriteV(&ring, iov, 3));
+	SinkDrain(&ring, SIZE_MAX);
+	TEST_ASSERT_EQUAL(69, sink_len);
+	for(int i = 0; i < 3; i++){
+		TEST_ASSERT_EQUAL_UINT8_ARRAY(message, &sink[23 * i], 23);
+	}
+}
+
+TEST_CASE("UartRing in place writes", "[uart_ring]")
+{
+	uart_ring_t ring;
+	uint8_t *data;
+	size_t len;
+
+	UartRingInit(&ring, storage, RING_SIZE);
+	sink_len = 0;
+	UartRingWrite(&ring, "0123456789012345678901234567890123456789012345678901234", 55);
+	SinkDrain(&ring, 50);
+	/* 59 bytes free but only 9 contiguous until the end of the buffer */
+	len = UartRingReserve(&ring, &data);
+	TEST_ASSERT_EQUAL(9, len);
+	memcpy(data, "abcdefghi", 9);
+	UartRingCommit(&ring, 9);
+	len = UartRingReserve(&ring, &data);
+	TEST_ASSERT_EQUAL(50, len);
+	TEST_ASSERT(data == storage);
+	memcpy(data, "jk", 2);
+	UartRingCommit(&ring, 2);
+	SinkDrain(&ring, SIZE_MAX);
+	TEST_ASSERT_EQUAL(66, sink_len);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY("01234abcdefghijk", &sink[50], 16);
+}
+
+TEST_CASE("UartRing messages larger than the ring, in parts", "[uart_ring]")
+{
+	uart_ring_t ring;
+	static char message[200];
+	uart_iov_t iov[2] = {
+		{.data = "Datos:", .len = 6},
+		{.data = message, .len = sizeof(message)},
+	};
+	size_t total = 6 + sizeof(message);
+	size_t queued;
+
+	UartRingInit(&ring, storage, RING_SIZE);
+	sink_len = 0;
+	for(size_t i = 0; i < sizeof(message); i++){
+		message[i] = 'a' + i % 26;
+	}
+	UartRingWrite(&ring, "0123456789", 10);
+	/* As the fake UART drains it, from the offset queued so far */
+	queued = UartRingWritePart(&ring, iov, 2, 0);
+	TEST_ASSERT_EQUAL(RING_SIZE - 10, queued);
+	TEST_ASSERT_EQUAL(0, UartRingWritePart(&ring, iov, 2, queued));
+	while(queued < total){
+		SinkDrain(&ring, 13);
+		queued += UartRingWritePart(&ring, iov, 2, queued);
+	}
+	SinkDrain(&ring, SIZE_MAX);
+	TEST_ASSERT_EQUAL(10 + total, sink_len);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY("0123456789Datos:", sink, 16);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(message, &sink[16], sizeof(message));
+	TEST_ASSERT_EQUAL(0, ring.stats.writes_dropped);
+	TEST_ASSERT_EQUAL(10 + total, ring.stats.bytes_queued);
+}
@@ -0,0 +1,163 @@
+/**
+ * @file test_uart_rx_mcu.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the UART RX parser and command table
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "uart_rx_mcu.h"
+#include "telemetry_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define LOG_SIZE	512
+/*==================[internal data definition]===============================*/
+static char log_text[LOG_SIZE];
+static uint32_t packets;
+static size_t packet_len;
+static uint8_t packet_data[UART_RX_LINE_MAX];
+/*==================[internal functions definition]==========================*/
+static void Log(const char *tag, const char *args){
+	size_t len = strlen(log_text);
+	snprintf(&log_text[len], LOG_SIZE - len, "%s(%s)", tag, args);
+}
+
+static void CommandOpen(const char *args, void *param){
+	(void)param;
+	Log("open", args);
+}
+
+static void CommandSet(const char *args, void *param){
+	Log((const char*)param, args);
+}
+
+static void Unknown(const char *line, void *param){
+	(void)param;
+	Log("?", line);
+}
+
+static void Packet(const uint8_t *data, size_t len, void *param){
+	TEST_ASSERT(param == &packets);
+	packets++;
+	packet_len = len;
+	memcpy(packet_data, data, len);
+}
+
+static const uart_command_t commands[] = {
+	{"o", CommandOpen, NULL},
+	{"open", CommandOpen, NULL},
+	{"set", CommandSet, "set"},
+	{"setpoint", CommandSet, "setpoint"},
+};
+
+static void Push(uart_parser_t *parser, const char *text){
+	UartParserPush(parser, (const uint8_t*)text, strlen(text));
+}
+
+TEST_CASE("UartParser command table lookup", "[uart_rx]")
+{
+	uart_parser_t parser;
+	uart_command_t many[UART_RX_MAX_COMMANDS + 1];
+	char names[UART_RX_MAX_COMMANDS + 1][8];
+	uart_parser_config_t config = {.mode = UART_RX_LINES, .commands = commands, .n_commands = 4};
+
+	TEST_ASSERT_TRUE(UartParserInit(&parser, &config));
+	TEST_ASSERT(UartParserFind(&parser, "open", 4) == &commands[1]);
+	TEST_ASSERT(UartParserFind(&parser, "openx", 4) == &commands[1]);
+	TEST_ASSERT(UartParserFind(&parser, "set", 3) == &commands[2]);
+	TEST_ASSERT(UartParserFind(&parser, "setpoint", 8) == &commands[3]);
+	TEST_ASSERT(UartParserFind(&parser, "setp", 4) == NULL);
+	TEST_ASSERT(UartParserFind(&parser, "", 0) == NULL);
+
+	/* Full table: every command is found through the probing */
+	for(int i = 0; i <= UART_RX_MAX_COMMANDS; i++){
+		snprintf(names[i], sizeof(names[i]), "c%d", i);
+		many[i] = (uart_command_t){names[i], CommandOpen, NULL};
+	}
+	config.commands = many;
+	config.n_commands = UART_RX_MAX_COMMANDS;
+	TEST_ASSERT_TRUE(UartParserInit(&parser, &config));
+	for(int i = 0; i < UART_RX_MAX_COMMANDS; i++){
+		TEST_ASSERT(UartParserFind(&parser, names[i], strlen(names[i])) == &many[i]);
+	}
+	TEST_ASSERT(UartParserFind(&parser, names[UART_RX_MAX_COMMANDS], strlen(names[UART_RX_MAX_COMMANDS])) == NULL);
+
+	config.n_commands = UART_RX_MAX_COMMANDS + 1;
+	TEST_ASSERT_FALSE(UartParserInit(&parser, &config));
+	/* Repeated names */
+	many[1].name = many[0].name;
+	config.n_commands = 2;
+	TEST_ASSERT_FALSE(UartParserInit(&parser, &config));
+}
+
+TEST_CASE("UartParser lines split across chunks", "[uart_rx]")
+{
+	uart_parser_t parser;
+	uart_parser_config_t config = {.mode = UART_RX_LINES, .commands = commands, .n_commands = 4, .unknown_p = Unknown};
+	char long_line[UART_RX_LINE_MAX + 20];
+
+	TEST_ASSERT_TRUE(UartParserInit(&parser, &config));
+	log_text[0] = '\0';
+	Push(&parser, "o\r\nset");
+	Push(&parser, "point  12.5\n\nse");
+	Push(&parser, "t 3\rclose now\r\nopen");
+	TEST_ASSERT_EQUAL_STRING("open()setpoint(12.5)set(3)?(close now)", log_text);
+	TEST_ASSERT_EQUAL(3, parser.stats.lines);
+	TEST_ASSERT_EQUAL(1, parser.stats.unknown);
+
+	/* Too long: discarded up to the end of the line, the next one is fine */
+	log_text[0] = '\0';
+	Push(&parser, "\n");
+	memset(long_line, 'x', sizeof(long_line) - 1);
+	long_line[sizeof(long_line) - 1] = '\0';
+	Push(&parser, "set ");
+	Push(&parser, long_line);
+	Push(&parser, long_line);
+	Push(&parser, "\nset 1\n");
+	TEST_ASSERT_EQUAL_STRING("open()set(1)", log_text);
+	TEST_ASSERT_EQUAL(1, parser.stats.too_long);
+
+	/* Bytes lost in the middle of a line */
+	log_text[0] = '\0';
+	Push(&parser, "setpo");
+	UartParserAbort(&parser);
+	Push(&parser, "int 4\no\n");
+	TEST_ASSERT_EQUAL_STRING("open()", log_text);
+}
+
+TEST_CASE("UartParser COBS packets", "[uart_rx]")
+{
+	uart_parser_t parser;
+	uart_parser_config_t config = {.mode = UART_RX_PACKETS, .packet_p = Packet, .param_p = &packets};
+	uint8_t payload[40];
+	uint8_t stream[3 * (sizeof(payload) + 4)];
+	size_t len = 0;
+
+	TEST_ASSERT_TRUE(UartParserInit(&parser, &config));
+	packets = 0;
+	for(size_t i = 0; i < sizeof(payload); i++){
+		payload[i] = i % 5;
+	}
+	len += TelemetryCobsEncode(payload, sizeof(payload), &stream[len]);
+	stream[len++] = 0;
+	stream[len++] = 0;
+	/* Bad encoding: block longer than the packet */
+	stream[len++] = 9;
+	stream[len++] = 1;
+	stream[len++] = 0;
+	len += TelemetryCobsEncode(payload, 3, &stream[len]);
+	stream[len++] = 0;
+	for(size_t i = 0; i < len; i++){
+		UartParserPush(&parser, &stream[i], 1);
+	}
+	TEST_ASSERT_EQUAL(2, packets);
+	TEST_ASSERT_EQUAL(1, parser.stats.bad_packets);
+	TEST_ASSERT_EQUAL(3, packet_len);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, packet_data, 3);
+}
@@ -0,0 +1,138 @@
+/**
+ * @file delay_bench.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Host benchmark of the deadline queue of delay_mcu.c
+ *
+ * Cost of a delay on the shared timer: one insertion and one expiry, with
+ * DEPTH other tasks already delayed (random times, the steady state of tasks
+ * that delay again as soon as they are woken). The heap of
+ * deadline_queue_mcu.c against a sorted array with linear insertion, the
+ * simplest wakeup list. Both run inside the critical section of the driver,
+ * the time is also the time the interrupts are masked: with a few tasks the
+ * array is as fast or faster, the heap bounds the time as they grow.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "deadline_queue_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define MAX_DEPTH		256
+#define N_DELAYS		1000000
+#define MAX_DELAY_US	5000
+/*==================[internal data definition]===============================*/
+static deadline_t delays[MAX_DEPTH + 1];
+static deadline_t *storage[MAX_DEPTH + 1];
+static deadline_t *sorted[MAX_DEPTH + 1];
+static uint32_t n_sorted;
+static volatile uint64_t sink;
+/*==================[internal functions definition]==========================*/
+static double Seconds(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void SortedInsert(deadline_t *deadline){
+	uint32_t i = n_sorted;
+
+	while(i > 0 && sorted[i - 1]->time > deadline->time){
+		sorted[i] = sorted[i - 1];
+		i--;
+	}
+	sorted[i] = deadline;
+	n_sorted++;
+}
+
+static deadline_t *SortedPop(uint64_t now){
+	deadline_t *earliest;
+
+	if(n_sorted == 0 || sorted[0]->time > now){
+		return NULL;
+	}
+	earliest = sorted[0];
+	memmove(sorted, &sorted[1], --n_sorted * sizeof(sorted[0]));
+	return earliest;
+}
+
+/* Time of the loop without a queue, subtracted from both */
+static double Baseline(void){
+	uint64_t now = 0;
+	double start = Seconds();
+
+	for(uint32_t n = 0; n < N_DELAYS; n++){
+		now += rand() % MAX_DELAY_US;
+	}
+	sink = now;
+	return (Seconds() - start) * 1e9 / N_DELAYS;
+}
+
+static double Heap(uint32_t depth){
+	deadline_queue_t queue;
+	deadline_t *expired;
+	uint64_t now = 0;
+	double start;
+
+	srand(depth);
+	DeadlineQueueInit(&queue, storage, MAX_DEPTH + 1);
+	for(uint32_t i = 0; i <= depth; i++){
+		delays[i].time = rand() % MAX_DELAY_US;
+		DeadlineQueueInsert(&queue, &delays[i]);
+	}
+	start = Seconds();
+	for(uint32_t n = 0; n < N_DELAYS; n++){
+		DeadlineQueueNext(&queue, &now);
+		expired = DeadlineQueuePop(&queue, now);
+		expired->time = now + rand() % MAX_DELAY_US;
+		DeadlineQueueInsert(&queue, expired);
+	}
+	sink = now;
+	return (Seconds() - start) * 1e9 / N_DELAYS;
+}
+
+static double Sorted(uint32_t depth){
+	deadline_t *expired;
+	uint64_t now = 0;
+	double start;
+
+	srand(depth);
+	n_sorted = 0;
+	for(uint32_t i = 0; i <= depth; i++){
+		delays[i].time = rand() % MAX_DELAY_US;
+		SortedInsert(&delays[i]);
+	}
+	start = Seconds();
+	for(uint32_t n = 0; n < N_DELAYS; n++){
+		now = sorted[0]->time;
+		expired = SortedPop(now);
+		expired->time = now + rand() % MAX_DELAY_US;
+		SortedInsert(expired);
+	}
+	sink = now;
+	return (Seconds() - start) * 1e9 / N_DELAYS;
+}
+
+int main(void){
+	static const uint32_t depths[] = {0, 3, 15, 63, 255};
+	double baseline = Baseline();
+	double heap;
+	double sorted;
+
+	printf("Insert + expire of a delay, ns\n");
+	printf("%-24s %10s %14s\n", "tasks already delayed", "heap", "sorted array");
+	for(uint32_t i = 0; i < sizeof(depths) / sizeof(depths[0]); i++){
+		heap = Heap(depths[i]) - baseline;
+		sorted = Sorted(depths[i]) - baseline;
+		printf("%-24u %10.1f %14.1f\n", depths[i], heap, sorted);
+	}
+	return 0;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file format_bench.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Host benchmark of format_mcu against snprintf and the former UartItoa
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "format_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define N_VALUES	4096
+#define N_LAPS		256
+/*==================[internal data definition]===============================*/
+static uint32_t values[N_VALUES];
+static float values_f[N_VALUES];
+static char out[64];
+static volatile size_t sink;
+static volatile uint8_t base = 10;		/*!< Runtime base, as in the projects calls */
+/*==================[internal functions definition]==========================*/
+/* UartItoa as it was before format_mcu (shared static buffer, % and / per digit) */
+__attribute__((noinline)) static uint8_t* UartItoaReference(uint32_t val, uint8_t base){
+	static uint8_t buf[32] = {0};
+	uint32_t i = 30;
+	if(val == 0){
+		return (uint8_t*)"0";
+	}else{
+		for(; val && i ; --i, val /= base){
+			buf[i] = "0123456789abcdef"[val % base];
+		}
+		return &buf[i+1];
+	}
+}
+
+static double Now(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+#define BENCH(name, expr) \
+	do { \
+		double start = Now(); \
+		for(int lap = 0; lap < N_LAPS; lap++){ \
+			for(int i = 0; i < N_VALUES; i++){ \
+				sink += (expr); \
+			} \
+		} \
+		printf("%-28s %8.1f ns/call\n", name, (Now() - start) / ((double)N_LAPS * N_VALUES)); \
+	} while(0)
+
+int main(void){
+	uint32_t seed = 2463534242u;
+	for(int i = 0; i < N_VALUES; i++){
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		/* Every number of digits, as telemetry values */
+		values[i] = seed >> (seed % 32);
+		values_f[i] = (int32_t)values[i] / 1000.0f;
+	}
+	BENCH("snprintf %u", (size_t)snprintf(out, sizeof(out), "%u", values[i]));
+	BENCH("UartItoa (former)", (size_t)UartItoaReference(values[i], base)[0]);
+	BENCH("FormatU32", FormatU32(out, values[i], 0, ' '));
+	BENCH("snprintf %d", (size_t)snprintf(out, sizeof(out), "%d", (int32_t)values[i]));
+	BENCH("FormatI32", FormatI32(out, (int32_t)values[i], 0, ' '));
+	BENCH("snprintf %lld", (size_t)snprintf(out, sizeof(out), "%lld", (long long)values[i] * 1000003));
+	BENCH("FormatI64", FormatI64(out, (int64_t)values[i] * 1000003, 0, ' '));
+	BENCH("snprintf %.3f", (size_t)snprintf(out, sizeof(out), "%.3f", values_f[i]));
+	BENCH("FormatFloat 3 decimals", FormatFloat(out, values_f[i], 3, 0, ' '));
+	return 0;
+}
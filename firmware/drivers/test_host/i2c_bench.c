@@ -0,0 +1,130 @@
+/**
+ * @file i2c_bench.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Host benchmark of the I2C transaction queue
+ *
+ * Time on the simulated bus (i2c_host.c) of the initialization of an MPU6050
+ * with the setters of mpu6050.c, a read-modify-write per field:
+ * - blocking, as I2C_writeBits() did before: register select with a stop,
+ *   read, and write (3 transfers per field);
+ * - blocking with the repeated start of I2C_readBytes() (2 transfers);
+ * - as a single script of i2c_queue_mcu.h, with the updates through the
+ *   shadow: the first time each register is read once, a reconfiguration
+ *   only writes the registers that change.
+ * A transfer costs its bits plus DRIVER_US of driver (command link, interrupt
+ * and task switch). The script also frees the caller, that only submits it.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include "i2c_host.h"
+/*==================[macros and definitions]=================================*/
+#define ADDRESS			0x68
+#define DRIVER_US		50		/*!< Time of the driver per transfer (assumed) */
+#define N_FIELDS		(sizeof(fields) / sizeof(fields[0]))
+
+typedef struct {
+	uint8_t reg;
+	uint8_t mask;
+	uint8_t value;
+} field_t;
+/*==================[internal data definition]===============================*/
+/* Setters of an initialization with the FIFO and the data ready interrupt */
+static const field_t fields[] = {
+	{0x6B, 0x07, 0x01},		/* setClockSource(PLL_XGYRO) */
+	{0x1B, 0x18, 0x08},		/* setFullScaleGyroRange(500) */
+	{0x1C, 0x18, 0x08},		/* setFullScaleAccelRange(4) */
+	{0x6B, 0x40, 0x00},		/* setSleepEnabled(false) */
+	{0x1A, 0x07, 0x01},		/* setDLPFMode(188) */
+	{0x23, 0x80, 0x80},		/* setTempFIFOEnabled */
+	{0x23, 0x40, 0x40},		/* setXGyroFIFOEnabled */
+	{0x23, 0x20, 0x20},		/* setYGyroFIFOEnabled */
+	{0x23, 0x10, 0x10},		/* setZGyroFIFOEnabled */
+	{0x23, 0x08, 0x08},		/* setAccelFIFOEnabled */
+	{0x37, 0x80, 0x00},		/* setInterruptMode(active high) */
+	{0x37, 0x40, 0x00},		/* setInterruptDrive(push-pull) */
+	{0x37, 0x20, 0x00},		/* setInterruptLatch(50 us) */
+	{0x38, 0x10, 0x10},		/* setIntFIFOBufferOverflowEnabled */
+	{0x38, 0x01, 0x01},		/* setIntDataReadyEnabled */
+	{0x6A, 0x40, 0x40},		/* setFIFOEnabled */
+};
+static i2c_op_t script[N_FIELDS];
+/*==================[internal functions definition]==========================*/
+static void Blocking(i2c_host_bus_t *bus, bool repeated_start){
+	uint8_t tx[2];
+	uint8_t value;
+
+	for(uint32_t i = 0; i < N_FIELDS; i++){
+		tx[0] = fields[i].reg;
+		if(repeated_start){
+			I2cHostTransfer(ADDRESS, tx, 1, &value, 1, bus);
+		}
+		else{
+			I2cHostTransfer(ADDRESS, tx, 1, NULL, 0, bus);
+			I2cHostTransfer(ADDRESS, NULL, 0, &value, 1, bus);
+		}
+		tx[1] = (value & ~fields[i].mask) | (fields[i].value & fields[i].mask);
+		I2cHostTransfer(ADDRESS, tx, 2, NULL, 0, bus);
+	}
+}
+
+static void Report(const char *name, const i2c_host_bus_t *bus){
+	printf("%-36s %4u transfers %8.2f ms\n", name, bus->transfers, bus->time_ns / 1e6);
+}
+
+static void Run(uint32_t clock_hz){
+	i2c_host_bus_t bus;
+	i2c_queue_config_t config;
+	i2c_queue_t queue;
+	i2c_device_t device;
+	i2c_transaction_t transaction = {.device = &device, .ops = script, .n_ops = N_FIELDS};
+
+	printf("MPU6050 initialization, %u kHz, %u us of driver per transfer\n", clock_hz / 1000, DRIVER_US);
+	I2cHostInit(&bus, clock_hz, DRIVER_US * 1000);
+	I2cHostAddDevice(&bus, ADDRESS);
+	Blocking(&bus, false);
+	Report("  blocking, select + read + write", &bus);
+
+	I2cHostInit(&bus, clock_hz, DRIVER_US * 1000);
+	I2cHostAddDevice(&bus, ADDRESS);
+	Blocking(&bus, true);
+	Report("  blocking, repeated start", &bus);
+
+	I2cHostInit(&bus, clock_hz, DRIVER_US * 1000);
+	I2cHostAddDevice(&bus, ADDRESS);
+	I2cHostQueueConfig(&bus, &config);
+	I2cQueueInit(&queue, &config);
+	I2cDeviceInit(&device, ADDRESS, true);
+	I2cQueueSubmit(&queue, &transaction);
+	I2cQueueRunNext(&queue);
+	Report("  script, cold shadow", &bus);
+	printf("    %u shadow hits, %u writes skipped\n", queue.stats.shadow_hits, queue.stats.skipped);
+
+	/* Same configuration again, and then a new gyroscope range */
+	bus.transfers = 0;
+	bus.time_ns = 0;
+	I2cQueueRun(&queue, &transaction);
+	Report("  script again, no changes", &bus);
+	script[1].value = 0x10;
+	bus.transfers = 0;
+	bus.time_ns = 0;
+	I2cQueueRun(&queue, &transaction);
+	Report("  script again, new gyroscope range", &bus);
+	script[1].value = fields[1].value;
+}
+
+int main(void){
+	for(uint32_t i = 0; i < N_FIELDS; i++){
+		script[i] = (i2c_op_t)I2C_OP_UPDATE_REG(fields[i].reg, fields[i].mask, fields[i].value);
+	}
+	Run(100000);
+	Run(400000);
+	return 0;
+}
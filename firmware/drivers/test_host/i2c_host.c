@@ -0,0 +1,101 @@
+/**
+ * @file i2c_host.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Simulated I2C bus with register file devices
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include <string.h>
+#include "i2c_host.h"
+/*==================[macros and definitions]=================================*/
+#define BITS_PER_BYTE		9			/*!< 8 data + ACK */
+#define START_BITS			1			/*!< Start or repeated start */
+#define STOP_BITS			1
+#define NS_PER_S			1000000000ULL
+#define NS_PER_MS			1000000ULL
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static i2c_host_device_t *Find(i2c_host_bus_t *bus, uint8_t address){
+	for(uint8_t i = 0; i < bus->n_devices; i++){
+		if(bus->devices[i].address == address){
+			return &bus->devices[i];
+		}
+	}
+	return NULL;
+}
+
+/*==================[external functions definition]==========================*/
+void I2cHostInit(i2c_host_bus_t *bus, uint32_t clock_hz, uint32_t overhead_ns){
+	memset(bus, 0, sizeof(*bus));
+	bus->clock_hz = clock_hz;
+	bus->overhead_ns = overhead_ns;
+}
+
+i2c_host_device_t *I2cHostAddDevice(i2c_host_bus_t *bus, uint8_t address){
+	i2c_host_device_t *device;
+
+	if(bus->n_devices == I2C_HOST_MAX_DEVICES){
+		return NULL;
+	}
+	device = &bus->devices[bus->n_devices++];
+	memset(device, 0, sizeof(*device));
+	device->address = address;
+	return device;
+}
+
+void I2cHostQueueConfig(i2c_host_bus_t *bus, i2c_queue_config_t *config){
+	config->transfer_p = I2cHostTransfer;
+	config->delay_p = I2cHostDelay;
+	config->param_p = bus;
+}
+
+bool I2cHostTransfer(uint8_t address, const uint8_t *tx, uint16_t tx_len, uint8_t *rx, uint16_t rx_len, void *param){
+	i2c_host_bus_t *bus = param;
+	i2c_host_device_t *device = Find(bus, address);
+	uint32_t bits = START_BITS + BITS_PER_BYTE * (1 + tx_len) + STOP_BITS;
+
+	bus->transfers++;
+	if(rx_len > 0){
+		bus->repeated_starts++;
+		bits += START_BITS + BITS_PER_BYTE * (1 + rx_len);
+	}
+	if(device == NULL){
+		/* Only the address byte is on the bus */
+		bus->nacks++;
+		bus->time_ns += bus->overhead_ns + (START_BITS + BITS_PER_BYTE + STOP_BITS) * NS_PER_S / bus->clock_hz;
+		return false;
+	}
+	bus->time_ns += bus->overhead_ns + bits * NS_PER_S / bus->clock_hz;
+	if(tx_len > 0){
+		device->pointer = tx[0];
+		for(uint16_t i = 1; i < tx_len; i++){
+			device->regs[device->pointer++] = tx[i];
+			device->writes++;
+		}
+	}
+	for(uint16_t i = 0; i < rx_len; i++){
+		rx[i] = device->regs[device->pointer++];
+		device->reads++;
+	}
+	return true;
+}
+
+void I2cHostDelay(uint32_t ms, void *param){
+	i2c_host_bus_t *bus = param;
+	bus->time_ns += ms * NS_PER_MS;
+}
+
+/*==================[end of file]============================================*/
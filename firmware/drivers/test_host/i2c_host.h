@@ -0,0 +1,107 @@
+#ifndef I2C_HOST_H
+#define I2C_HOST_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup I2C I2C
+ ** @{ */
+
+/** \brief Simulated I2C bus for the host tests of i2c_queue_mcu.h.
+ *
+ * Each device is a file of 256 registers. A transfer writes the register
+ * address and the bytes after it (auto increment), and reads after the
+ * repeated start from the last address written. Addresses without a device
+ * do not ACK.
+ *
+ * The bus counts the time each transfer would take: 9 bits per byte at the
+ * clock of the bus plus the start, the repeated start and the stop, and a
+ * fixed time per transfer for the driver (command link, interrupt, task
+ * switch). The delays of the scripts are added to it without waiting.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c_queue_mcu.h"
+/*==================[macros]=================================================*/
+#define I2C_HOST_MAX_DEVICES	4		/*!< Devices on a bus */
+/*==================[typedef]================================================*/
+/**
+ * @brief Simulated device
+ */
+typedef struct {
+	uint8_t address;			/*!< 7 bit address */
+	uint8_t regs[256];			/*!< Registers */
+	uint8_t pointer;			/*!< Register of the next byte */
+	uint32_t writes;			/*!< Register bytes written */
+	uint32_t reads;				/*!< Register bytes read */
+} i2c_host_device_t;
+
+/**
+ * @brief Simulated bus
+ */
+typedef struct {
+	uint32_t clock_hz;								/*!< SCL frequency */
+	uint32_t overhead_ns;							/*!< Time of the driver per transfer */
+	i2c_host_device_t devices[I2C_HOST_MAX_DEVICES];	/*!< Devices */
+	uint8_t n_devices;								/*!< Number of devices */
+	uint32_t transfers;								/*!< Transfers, with or without ACK */
+	uint32_t repeated_starts;						/*!< Transfers that wrote and read */
+	uint32_t nacks;									/*!< Transfers without ACK */
+	uint64_t time_ns;								/*!< Time of the bus */
+} i2c_host_bus_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a bus without devices
+ *
+ * @param bus Bus
+ * @param clock_hz SCL frequency
+ * @param overhead_ns Time of the driver per transfer
+ */
+void I2cHostInit(i2c_host_bus_t *bus, uint32_t clock_hz, uint32_t overhead_ns);
+
+/**
+ * @brief Add a device, with its registers at 0
+ *
+ * @param bus Bus
+ * @param address 7 bit address
+ * @return Device, NULL if the bus is full
+ */
+i2c_host_device_t *I2cHostAddDevice(i2c_host_bus_t *bus, uint8_t address);
+
+/**
+ * @brief Configuration of a queue on the bus
+ *
+ * @param bus Bus
+ * @param config Transfer and delay functions of the bus
+ */
+void I2cHostQueueConfig(i2c_host_bus_t *bus, i2c_queue_config_t *config);
+
+/**
+ * @brief Transfer on the bus (i2c_transfer_t), param is the bus
+ */
+bool I2cHostTransfer(uint8_t address, const uint8_t *tx, uint16_t tx_len, uint8_t *rx, uint16_t rx_len, void *param);
+
+/**
+ * @brief Delay (i2c_delay_t), added to the time of the bus
+ */
+void I2cHostDelay(uint32_t ms, void *param);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* I2C_HOST_H */
+
+/*==================[end of file]============================================*/
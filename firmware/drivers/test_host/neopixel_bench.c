@@ -0,0 +1,111 @@
+/**
+ * @file neopixel_bench.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Host benchmark of the NeoPixel frame
+ *
+ * Time per LED to encode a strip as NeoPixelSetArray() did (brightness with
+ * three multiplies and the gamma of each component) against the table of the
+ * frame (Ws2812bEncodeColors()). Also 10 pixels changed one at a time: a strip
+ * sent after each one, against a single commit, and the time on the line.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include "neopixel_frame.h"
+#include "ws2812b_encoder.h"
+/*==================[macros and definitions]=================================*/
+#define N_LEDS			300
+#define N_LAPS			20000
+#define N_CHANGES		10
+#define BIT_NS			1250		/*!< T0H + T0L, T1H + T1L */
+#define RESOLUTION		10000000
+/*==================[internal data definition]===============================*/
+static neopixel_color_t colors[N_LEDS];
+static rgb_led_t leds[N_LEDS];
+static ws2812b_symbol_t symbols[WS2812B_SYMBOLS(N_LEDS)];
+static ws2812b_encoder_t encoder;
+static neopixel_frame_t frame;
+/*==================[internal functions definition]==========================*/
+static double Now(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* NeoPixelSetArray() before the frame: brightness per LED, gamma per component */
+static uint32_t SendArray(const neopixel_color_t *color_array, uint8_t bright){
+	for(uint16_t i = 0; i < N_LEDS; i++){
+		uint16_t red = ((color_array[i] >> 16) & 0xFF) * bright;
+		uint16_t green = ((color_array[i] >> 8) & 0xFF) * bright;
+		uint16_t blue = (color_array[i] & 0xFF) * bright;
+		leds[i].red = ws2812b_gamma[red >> 8];
+		leds[i].green = ws2812b_gamma[green >> 8];
+		leds[i].blue = ws2812b_gamma[blue >> 8];
+	}
+	return Ws2812bEncode(&encoder, leds, N_LEDS, NULL, symbols);
+}
+
+int main(void){
+	double start, per_led, frame_lut, per_change, commit;
+	double line_us = (WS2812B_SYMBOLS(N_LEDS) - 1) * BIT_NS / 1e3 + WS2812B_RESET_US;
+	volatile uint32_t sink = 0;
+
+	Ws2812bEncoderInit(&encoder, RESOLUTION);
+	NeoPixelFrameInit(&frame, colors, N_LEDS);
+	NeoPixelFrameRainbow(&frame, 0, 255, 255, 2);
+	NeoPixelFrameBrightness(&frame, 128);
+	/* Warm up the caches and the table */
+	sink += SendArray(colors, 128);
+	sink += Ws2812bEncodeColors(&encoder, colors, N_LEDS, NeoPixelFrameLut(&frame), symbols);
+
+	start = Now();
+	for(int lap = 0; lap < N_LAPS; lap++){
+		colors[lap % N_LEDS]++;
+		sink += SendArray(colors, 128);
+	}
+	per_led = (Now() - start) / N_LAPS;
+	start = Now();
+	for(int lap = 0; lap < N_LAPS; lap++){
+		colors[lap % N_LEDS]++;
+		sink += Ws2812bEncodeColors(&encoder, colors, N_LEDS, NeoPixelFrameLut(&frame), symbols);
+	}
+	frame_lut = (Now() - start) / N_LAPS;
+
+	/* 10 pixels: NeoPixelSetPixel() sent the strip each time */
+	start = Now();
+	for(int lap = 0; lap < N_LAPS / N_CHANGES; lap++){
+		for(int i = 0; i < N_CHANGES; i++){
+			colors[(lap + i * 7) % N_LEDS] = lap;
+			sink += SendArray(colors, 128);
+		}
+	}
+	per_change = (Now() - start) / (N_LAPS / N_CHANGES);
+	start = Now();
+	for(int lap = 0; lap < N_LAPS / N_CHANGES; lap++){
+		for(int i = 0; i < N_CHANGES; i++){
+			NeoPixelFrameSetPixel(&frame, (lap + i * 7) % N_LEDS, lap);
+		}
+		if(frame.dirty){
+			sink += Ws2812bEncodeColors(&encoder, colors, N_LEDS, NeoPixelFrameLut(&frame), symbols);
+			frame.dirty = false;
+		}
+	}
+	commit = (Now() - start) / (N_LAPS / N_CHANGES);
+	(void)sink;
+
+	printf("%d LEDs, brightness 128\n", N_LEDS);
+	printf("Brightness and gamma per LED %8.2f us/strip %6.1f ns/LED\n", per_led / 1e3, per_led / N_LEDS);
+	printf("Frame table                  %8.2f us/strip %6.1f ns/LED\n", frame_lut / 1e3, frame_lut / N_LEDS);
+	printf("%d pixels, a strip each      %8.2f us, %8.2f us on the line\n", N_CHANGES, per_change / 1e3,
+		   N_CHANGES * line_us);
+	printf("%d pixels, one commit        %8.2f us, %8.2f us on the line\n", N_CHANGES, commit / 1e3, line_us);
+	return 0;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file raster_bench.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Host benchmark of the span rasteriser
+ *
+ * Counts the SPI writes and bytes the ILI9341 needs for some drawings, drawn
+ * pixel by pixel as before (an address window per pixel: 6 writes, 13 bytes)
+ * and by rectangles of the rasteriser (6 writes, 11 bytes + 2 per pixel, as
+ * Fill() in ili9341.c). Also reports the time to draw lines into a framebuffer.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include "raster.h"
+/*==================[macros and definitions]=================================*/
+#define WIDTH			320
+#define HEIGHT			240
+#define PIXEL_WRITES	6
+#define PIXEL_BYTES		13
+#define RECT_WRITES		6
+#define RECT_BYTES		11
+#define MAX_VALUE_SIZE	4092	/*!< Largest write of Fill() in ili9341.c */
+#define N_LAPS			200
+
+typedef struct {
+	uint32_t pixels;
+	uint32_t writes;
+	uint32_t bytes;
+} spi_count_t;
+/*==================[internal data definition]===============================*/
+static uint16_t buffer[WIDTH * HEIGHT];
+static fb_point_t chart[WIDTH / 4];
+/*==================[internal functions definition]==========================*/
+static void Count(const fb_rect_t *rect, uint16_t color, uint8_t alpha, void *param){
+	spi_count_t *count = param;
+	uint32_t pixels = (rect->x1 - rect->x0 + 1) * (rect->y1 - rect->y0 + 1);
+	(void)color;
+	(void)alpha;
+	count->pixels += pixels;
+	count->writes += RECT_WRITES + (pixels * 2 - 1) / MAX_VALUE_SIZE;
+	count->bytes += RECT_BYTES + pixels * 2;
+}
+
+static void Flush(const fb_rect_t *area, const uint16_t *pixels, uint16_t stride, void *param){
+	(void)area;
+	(void)pixels;
+	(void)stride;
+	(void)param;
+}
+
+static double Now(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void Chart(raster_t *raster){
+	for(uint8_t i = 1; i < sizeof(chart) / sizeof(chart[0]); i++){
+		RasterLine(raster, chart[i - 1].x, chart[i - 1].y, chart[i].x, chart[i].y, 0xFFFF);
+	}
+}
+
+static void Shallow(raster_t *raster){
+	for(int16_t y = 0; y < HEIGHT; y += 8){
+		RasterLine(raster, 0, y, WIDTH - 1, y + 7, 0xFFFF);
+	}
+}
+
+static void Diagonal(raster_t *raster){
+	for(int16_t x = 0; x < WIDTH - HEIGHT; x += 8){
+		RasterLine(raster, x, 0, x + HEIGHT - 1, HEIGHT - 1, 0xFFFF);
+	}
+}
+
+static void Circles(raster_t *raster){
+	for(int16_t r = 10; r < HEIGHT / 2; r += 10){
+		RasterCircle(raster, WIDTH / 2, HEIGHT / 2, r, 0xFFFF);
+	}
+}
+
+static void Report(const char *name, void (*draw)(raster_t *raster)){
+	fb_rect_t clip = {0, 0, WIDTH - 1, HEIGHT - 1};
+	spi_count_t count = {0};
+	raster_t raster;
+
+	RasterInit(&raster, &clip, Count, &count);
+	draw(&raster);
+	printf("%-22s %7u px %7u -> %6u writes %8u -> %7u bytes\n", name, count.pixels,
+		   count.pixels * PIXEL_WRITES, count.writes, count.pixels * PIXEL_BYTES, count.bytes);
+}
+
+int main(void){
+	fb_config_t config = {.width = WIDTH, .height = HEIGHT, .buffers = {buffer, NULL},
+						  .buffer_pixels = WIDTH * HEIGHT, .flush_p = Flush};
+	fb_t fb;
+	double start;
+
+	/* A signal plot: a point every 4 columns */
+	for(uint8_t i = 0; i < sizeof(chart) / sizeof(chart[0]); i++){
+		chart[i].x = i * 4;
+		chart[i].y = HEIGHT / 2 + (int16_t)(100 * sinf(i * 0.15f) * cosf(i * 0.023f));
+	}
+	printf("SPI writes and bytes, pixel by pixel -> rasteriser rectangles\n");
+	Report("chart polyline", Chart);
+	Report("shallow lines", Shallow);
+	Report("45 degree lines", Diagonal);
+	Report("circles", Circles);
+
+	FbInit(&fb, &config);
+	start = Now();
+	for(int lap = 0; lap < N_LAPS; lap++){
+		for(uint8_t i = 1; i < sizeof(chart) / sizeof(chart[0]); i++){
+			FbDrawLine(&fb, chart[i - 1].x, chart[i - 1].y, chart[i].x, chart[i].y, 0xFFFF);
+		}
+	}
+	printf("FbDrawLine             %7.1f ns/segment\n",
+		   (Now() - start) / (N_LAPS * (sizeof(chart) / sizeof(chart[0]) - 1)));
+	start = Now();
+	for(int lap = 0; lap < N_LAPS; lap++){
+		for(uint8_t i = 1; i < sizeof(chart) / sizeof(chart[0]); i++){
+			FbDrawLineAA(&fb, chart[i - 1].x, chart[i - 1].y, chart[i].x, chart[i].y, 0xFFFF);
+		}
+	}
+	printf("FbDrawLineAA           %7.1f ns/segment\n",
+		   (Now() - start) / (N_LAPS * (sizeof(chart) / sizeof(chart[0]) - 1)));
+	return 0;
+}
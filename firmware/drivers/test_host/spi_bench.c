@@ -0,0 +1,149 @@
+/**
+ * @file spi_bench.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Host benchmark of the queued SPI transactions
+ *
+ * A 320x240 RGB565 frame for the ILI9341, at the 20 MHz of ili9341.c, drawn
+ * in bands of SPI_MAX_TRANSFER bytes with RENDER_US of CPU per band (spin, as
+ * the raster of the board would take):
+ * - blocking: render a band, SpiWrite() it, as ILI9341DrawPixelArray() did;
+ * - queued: two band buffers, each band goes with SpiQueue() and the next one
+ *   is rendered while it is on the bus, SpiGetResults() says which buffer is
+ *   free again.
+ * Then the same with a sensor on another chip select read after every band:
+ * with SpiRead() its transfer waits behind the queued band, and the render
+ * with it; with SpiQueue() the read is only collected on the next band.
+ * A transfer costs its bits plus DRIVER_US (descriptor, DMA start, interrupt).
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include "spi_host.h"
+/*==================[macros and definitions]=================================*/
+#define LCD_BITRATE		20000000
+#define SENSOR_BITRATE	1000000
+#define FRAME_BYTES		(320 * 240 * 2)
+#define BAND_BYTES		SPI_MAX_TRANSFER
+#define N_BANDS			((FRAME_BYTES + BAND_BYTES - 1) / BAND_BYTES)
+#define RENDER_US		1000		/*!< CPU per band (assumed) */
+#define DRIVER_US		20			/*!< Time of the driver per transfer (assumed) */
+#define N_FRAMES		5
+
+typedef enum {
+	SENSOR_NONE,
+	SENSOR_BLOCKING,		/*!< SpiRead() */
+	SENSOR_QUEUED,			/*!< SpiQueue() */
+} sensor_read_t;
+/*==================[internal data definition]===============================*/
+static uint8_t bands[2][BAND_BYTES];
+static uint8_t sensor[6];
+/*==================[internal functions definition]==========================*/
+static double Seconds(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint32_t BandSize(uint32_t band){
+	uint32_t left = FRAME_BYTES - band * BAND_BYTES;
+	return (left < BAND_BYTES) ? left : BAND_BYTES;
+}
+
+static void Render(uint8_t *band, uint32_t size, uint32_t frame){
+	double end = Seconds() + RENDER_US / 1e6;
+
+	for(uint32_t i = 0; i < size; i++){
+		band[i] = i + frame;
+	}
+	while(Seconds() < end){
+	}
+}
+
+static void ReadSensor(sensor_read_t read){
+	void *users[SPI_QUEUE_SIZE];
+
+	switch(read){
+		case SENSOR_NONE:
+			break;
+		case SENSOR_BLOCKING:
+			SpiRead(SPI_2, sensor, sizeof(sensor));
+			break;
+		case SENSOR_QUEUED:
+			/* The previous read has ended by now, it is only collected */
+			SpiGetResults(SPI_2, users, SPI_QUEUE_SIZE, 0);
+			SpiQueue(SPI_2, NULL, sensor, sizeof(sensor), sensor);
+			break;
+	}
+}
+
+static void Blocking(uint32_t frame, sensor_read_t read){
+	for(uint32_t band = 0; band < N_BANDS; band++){
+		Render(bands[0], BandSize(band), frame);
+		SpiWrite(SPI_1, bands[0], BandSize(band));
+		ReadSensor(read);
+	}
+	SpiWaitAsync(SPI_2);
+}
+
+static void Queued(uint32_t frame, sensor_read_t read){
+	void *users[SPI_QUEUE_SIZE];
+	uint32_t sent = 0;
+
+	for(uint32_t band = 0; band < N_BANDS; band++){
+		/* The buffer of band - 2 must be on the bus already */
+		while(sent + 2 <= band){
+			sent += SpiGetResults(SPI_1, users, SPI_QUEUE_SIZE, 1000);
+		}
+		Render(bands[band % 2], BandSize(band), frame);
+		SpiQueue(SPI_1, bands[band % 2], NULL, BandSize(band), bands[band % 2]);
+		ReadSensor(read);
+	}
+	SpiWaitAsync(SPI_1);
+	SpiWaitAsync(SPI_2);
+}
+
+static void Run(const char *name, void (*draw)(uint32_t, sensor_read_t), sensor_read_t read){
+	spi_mcu_config_t lcd = {.device = SPI_1, .bitrate = LCD_BITRATE, .transfer_mode = SPI_POLLING};
+	spi_mcu_config_t sensor = {.device = SPI_2, .bitrate = SENSOR_BITRATE, .transfer_mode = SPI_POLLING};
+	spi_host_stats_t stats;
+	double start;
+	double elapsed;
+
+	SpiInit(&lcd);
+	SpiInit(&sensor);
+	start = Seconds();
+	for(uint32_t frame = 0; frame < N_FRAMES; frame++){
+		draw(frame, read);
+	}
+	elapsed = (Seconds() - start) / N_FRAMES;
+	stats = SpiHostStats(SPI_1);
+	printf("%-28s %7.2f ms/frame %6.1f fps, LCD bus %5.1f%%", name, elapsed * 1e3, 1 / elapsed,
+		   100.0 * stats.busy_ns / 1e9 / N_FRAMES / elapsed);
+	if(read != SENSOR_NONE){
+		printf(", %u sensor reads", SpiHostStats(SPI_2).transfers);
+	}
+	printf("\n");
+}
+
+int main(void){
+	spi_host_config_t bus = {.pacing = true, .overhead_ns = DRIVER_US * 1000};
+
+	SpiHostConfig(&bus);
+	printf("320x240 RGB565 frame, %u bands of %u bytes, %u us of render per band, %u MHz\n",
+		   N_BANDS, BAND_BYTES, RENDER_US, LCD_BITRATE / 1000000);
+	Run("  blocking", Blocking, SENSOR_NONE);
+	Run("  queued, two buffers", Queued, SENSOR_NONE);
+	Run("  blocking + sensor", Blocking, SENSOR_BLOCKING);
+	Run("  queued + blocking sensor", Queued, SENSOR_BLOCKING);
+	Run("  queued + queued sensor", Queued, SENSOR_QUEUED);
+	return 0;
+}
@@ -0,0 +1,379 @@
+/**
+ * @file spi_host.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Linux backend of spi_mcu.h (simulated bus shared by the devices)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+#include "spi_host.h"
+/*==================[macros and definitions]=================================*/
+#define SPI_DEVICES			3
+#define BUS_FIFO_SIZE		(SPI_DEVICES * (SPI_QUEUE_SIZE + 1))	/*!< Queued plus one blocking per device */
+#define NS_PER_S			1000000000ULL
+#define NS_PER_MS			1000000ULL
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Transfer on the bus, the spi_transaction_t of the board
+ */
+typedef struct {
+	spi_dev_t device;					/*!< Device of the transfer */
+	const uint8_t *tx;					/*!< Bytes to write, NULL for none */
+	uint8_t *rx;						/*!< Bytes read, NULL for none */
+	uint32_t length;					/*!< Bytes */
+	void *user;							/*!< Tag */
+	uint8_t tx_data[4];					/*!< Copy of the short writes */
+	bool done;							/*!< The transfer has ended */
+} host_trans_t;
+
+/**
+ * @brief State of a simulated device, the spi_device_state_t of the board
+ */
+typedef struct {
+	uint32_t bitrate;					/*!< Bitrate of SpiInit() */
+	transfer_mode_t transfer_mode;		/*!< Transfer mode */
+	void (*isr_p)(void*);				/*!< Called after each transfer in SPI_INTERRUPT */
+	void *user_data;					/*!< Parameter of isr_p */
+	host_trans_t trans[SPI_QUEUE_SIZE];	/*!< Descriptors of the queued transfers */
+	uint8_t head;						/*!< Next free descriptor */
+	uint8_t pending;					/*!< Queued transfers without result */
+	void *results[SPI_QUEUE_SIZE];		/*!< Tags taken while waiting, not returned yet */
+	uint8_t results_head;
+	uint8_t n_results;
+	uint8_t *capture;					/*!< Bytes written, for the tests */
+	uint32_t capture_size;
+	uint32_t captured;
+	uint8_t counter;					/*!< Bytes read without a write */
+	spi_host_stats_t stats;				/*!< Traffic */
+} host_device_t;
+
+/**
+ * @brief Simulated bus
+ */
+typedef struct {
+	pthread_mutex_t lock;				/*!< Protects the fifo, the descriptors and the statistics */
+	pthread_cond_t wake;				/*!< Transfer queued */
+	pthread_cond_t done;				/*!< Transfer ended */
+	pthread_t thread;
+	spi_host_config_t config;			/*!< Pacing */
+	host_trans_t *fifo[BUS_FIFO_SIZE];	/*!< Transfers of every device, in order */
+	uint8_t fifo_head;
+	uint8_t fifo_count;
+	uint64_t clock;						/*!< End of the last paced transfer (ns) */
+} host_bus_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static host_device_t spi_devices[SPI_DEVICES];
+static host_bus_t bus = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.wake = PTHREAD_COND_INITIALIZER,
+	.config = {.pacing = true},
+};
+static pthread_once_t bus_once = PTHREAD_ONCE_INIT;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint64_t Now(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * NS_PER_S + ts.tv_nsec;
+}
+
+static void SleepUntil(uint64_t ns){
+	struct timespec ts = {.tv_sec = ns / NS_PER_S, .tv_nsec = ns % NS_PER_S};
+	while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR){
+	}
+}
+
+/**
+ * @brief Bytes of a transfer: capture of the write, loopback or counter on the read
+ */
+static void Transfer(host_device_t *dev, const host_trans_t *t){
+	for(uint32_t i = 0; i < t->length; i++){
+		if(t->tx != NULL && dev->capture != NULL && dev->captured < dev->capture_size){
+			dev->capture[dev->captured++] = t->tx[i];
+		}
+		if(t->rx != NULL){
+			t->rx[i] = (t->tx != NULL) ? t->tx[i] : dev->counter++;
+		}
+	}
+}
+
+static void *BusThread(void *arg){
+	host_trans_t *t;
+	host_device_t *dev;
+	uint64_t duration;
+	uint64_t now;
+	bool pacing;
+	(void)arg;
+
+	pthread_mutex_lock(&bus.lock);
+	for(;;){
+		while(bus.fifo_count == 0){
+			pthread_cond_wait(&bus.wake, &bus.lock);
+		}
+		t = bus.fifo[bus.fifo_head];
+		dev = &spi_devices[t->device];
+		duration = bus.config.overhead_ns + (uint64_t)t->length * 8 * NS_PER_S / dev->bitrate;
+		pacing = bus.config.pacing;
+		pthread_mutex_unlock(&bus.lock);
+
+		if(pacing){
+			now = Now();
+			if(bus.clock < now){
+				bus.clock = now;
+			}
+			bus.clock += duration;
+			SleepUntil(bus.clock);
+		}
+		Transfer(dev, t);
+
+		pthread_mutex_lock(&bus.lock);
+		bus.fifo_head = (bus.fifo_head + 1) % BUS_FIFO_SIZE;
+		bus.fifo_count--;
+		dev->stats.transfers++;
+		dev->stats.bytes += t->length;
+		dev->stats.busy_ns += duration;
+		t->done = true;
+		pthread_cond_broadcast(&bus.done);
+		if(dev->transfer_mode == SPI_INTERRUPT && dev->isr_p != NULL){
+			/* The post_cb of the board, outside of the lock */
+			pthread_mutex_unlock(&bus.lock);
+			dev->isr_p(dev->user_data);
+			pthread_mutex_lock(&bus.lock);
+		}
+	}
+	return NULL;
+}
+
+static void BusStart(void){
+	pthread_condattr_t attr;
+
+	/* The timed waits of SpiGetResults() use the monotonic clock */
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&bus.done, &attr);
+	pthread_condattr_destroy(&attr);
+	pthread_create(&bus.thread, NULL, BusThread, NULL);
+	pthread_detach(bus.thread);
+}
+
+static void BusSubmit(host_trans_t *t){
+	pthread_mutex_lock(&bus.lock);
+	while(bus.fifo_count == BUS_FIFO_SIZE){
+		pthread_cond_wait(&bus.done, &bus.lock);
+	}
+	t->done = false;
+	bus.fifo[(bus.fifo_head + bus.fifo_count) % BUS_FIFO_SIZE] = t;
+	bus.fifo_count++;
+	pthread_cond_signal(&bus.wake);
+	pthread_mutex_unlock(&bus.lock);
+}
+
+/**
+ * @brief Wait for the end of a transfer, up to deadline (0 forever)
+ */
+static bool BusWait(host_trans_t *t, uint64_t deadline){
+	struct timespec ts = {.tv_sec = deadline / NS_PER_S, .tv_nsec = deadline % NS_PER_S};
+	bool done;
+
+	pthread_mutex_lock(&bus.lock);
+	while(!t->done){
+		if(deadline == 0){
+			pthread_cond_wait(&bus.done, &bus.lock);
+		}
+		else if(pthread_cond_timedwait(&bus.done, &bus.lock, &ts) == ETIMEDOUT){
+			break;
+		}
+	}
+	done = t->done;
+	pthread_mutex_unlock(&bus.lock);
+	return done;
+}
+
+static host_trans_t *Oldest(host_device_t *dev){
+	return &dev->trans[(dev->head + SPI_QUEUE_SIZE - dev->pending) % SPI_QUEUE_SIZE];
+}
+
+/* Frees the oldest descriptor, keeping the tag of its result for SpiGetResults() */
+static void TakeResult(host_device_t *dev){
+	host_trans_t *done = Oldest(dev);
+
+	BusWait(done, 0);
+	dev->pending--;
+	if(done->user == NULL){
+		return;
+	}
+	if(dev->n_results == SPI_QUEUE_SIZE){
+		dev->results_head = (dev->results_head + 1) % SPI_QUEUE_SIZE;
+		dev->n_results--;
+		dev->stats.lost++;
+	}
+	dev->results[(dev->results_head + dev->n_results) % SPI_QUEUE_SIZE] = done->user;
+	dev->n_results++;
+}
+
+static void QueueChunk(spi_dev_t device, const uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t size, void *user){
+	host_device_t *dev = &spi_devices[device];
+	host_trans_t *t;
+
+	if(dev->pending == SPI_QUEUE_SIZE){
+		TakeResult(dev);
+	}
+	t = &dev->trans[dev->head];
+	memset(t, 0, sizeof(host_trans_t));
+	t->device = device;
+	t->length = size;
+	t->user = user;
+	t->rx = rx_buffer;
+	if(tx_buffer != NULL && rx_buffer == NULL && size <= sizeof(t->tx_data)){
+		memcpy(t->tx_data, tx_buffer, size);
+		t->tx = t->tx_data;
+	}
+	else{
+		t->tx = tx_buffer;
+	}
+	BusSubmit(t);
+	dev->pending++;
+	dev->head = (dev->head + 1) % SPI_QUEUE_SIZE;
+}
+
+static void Transmit(spi_dev_t device, const uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t size){
+	host_trans_t t = {.device = device, .tx = tx_buffer, .rx = rx_buffer, .length = size};
+
+	SpiWaitAsync(device);
+	BusSubmit(&t);
+	BusWait(&t, 0);
+}
+
+/*==================[external functions definition]==========================*/
+void SpiHostConfig(const spi_host_config_t *config){
+	pthread_mutex_lock(&bus.lock);
+	bus.config = *config;
+	pthread_mutex_unlock(&bus.lock);
+}
+
+void SpiHostCapture(spi_dev_t device, uint8_t *buffer, uint32_t size){
+	host_device_t *dev = &spi_devices[device];
+
+	pthread_mutex_lock(&bus.lock);
+	dev->capture = buffer;
+	dev->capture_size = size;
+	dev->captured = 0;
+	pthread_mutex_unlock(&bus.lock);
+}
+
+spi_host_stats_t SpiHostStats(spi_dev_t device){
+	spi_host_stats_t stats;
+
+	pthread_mutex_lock(&bus.lock);
+	stats = spi_devices[device].stats;
+	pthread_mutex_unlock(&bus.lock);
+	return stats;
+}
+
+uint8_t SpiInit(spi_mcu_config_t* spi){
+	host_device_t *dev = &spi_devices[spi->device];
+
+	pthread_once(&bus_once, BusStart);
+	SpiDeInit(spi->device);
+	pthread_mutex_lock(&bus.lock);
+	dev->bitrate = spi->bitrate;
+	dev->transfer_mode = spi->transfer_mode;
+	dev->isr_p = spi->func_p;
+	dev->user_data = spi->param_p;
+	dev->counter = 0;
+	memset(&dev->stats, 0, sizeof(dev->stats));
+	pthread_mutex_unlock(&bus.lock);
+	return 0;
+}
+
+void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
+	Transmit(device, NULL, rx_buffer, rx_buffer_size);
+}
+
+void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
+	Transmit(device, tx_buffer, NULL, tx_buffer_size);
+}
+
+void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size){
+	Transmit(device, tx_buffer, rx_buffer, buffer_size);
+}
+
+void SpiWriteAsync(spi_dev_t device, const uint8_t * tx_buffer, uint32_t tx_buffer_size){
+	SpiQueue(device, tx_buffer, NULL, tx_buffer_size, NULL);
+}
+
+void SpiQueue(spi_dev_t device, const uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t size, void *user){
+	uint32_t len;
+
+	while(size > 0){
+		len = (size > SPI_MAX_TRANSFER) ? SPI_MAX_TRANSFER : size;
+		size -= len;
+		QueueChunk(device, tx_buffer, rx_buffer, len, (size == 0) ? user : NULL);
+		if(tx_buffer != NULL){
+			tx_buffer += len;
+		}
+		if(rx_buffer != NULL){
+			rx_buffer += len;
+		}
+	}
+}
+
+uint8_t SpiGetResults(spi_dev_t device, void **users, uint8_t max_results, uint32_t wait_ms){
+	host_device_t *dev = &spi_devices[device];
+	host_trans_t *done;
+	uint64_t deadline = Now() + wait_ms * NS_PER_MS;
+	uint8_t n = 0;
+
+	for(; n < max_results && dev->n_results > 0; n++){
+		users[n] = dev->results[dev->results_head];
+		dev->results_head = (dev->results_head + 1) % SPI_QUEUE_SIZE;
+		dev->n_results--;
+	}
+	/* Only the first result is waited for, the rest are the ones already ended (1 ns is a deadline passed) */
+	while(n < max_results && dev->pending > 0){
+		done = Oldest(dev);
+		if(!BusWait(done, (n == 0) ? deadline : 1)){
+			break;
+		}
+		dev->pending--;
+		if(done->user != NULL){
+			users[n++] = done->user;
+		}
+	}
+	return n;
+}
+
+uint8_t SpiPending(spi_dev_t device){
+	return spi_devices[device].pending;
+}
+
+void SpiWaitAsync(spi_dev_t device){
+	host_device_t *dev = &spi_devices[device];
+	while(dev->pending > 0){
+		TakeResult(dev);
+	}
+}
+
+uint8_t SpiDeInit(spi_dev_t device){
+	host_device_t *dev = &spi_devices[device];
+
+	SpiWaitAsync(device);
+	dev->head = 0;
+	dev->n_results = 0;
+	return 0;
+}
+
+/*==================[end of file]============================================*/
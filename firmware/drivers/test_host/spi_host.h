@@ -0,0 +1,91 @@
+#ifndef SPI_HOST_H
+#define SPI_HOST_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup SPI SPI
+ ** @{ */
+
+/** \brief Linux backend of spi_mcu.h for the host tests.
+ *
+ * The three devices share a simulated bus: a thread takes the transfers in
+ * the order they were queued, from every device, and ends each one after the
+ * time it takes at the bitrate of its device plus a fixed time per transfer
+ * (the DMA and the interrupt of the driver). The queued functions return at
+ * once, the blocking ones wait for their transfer, as on the board, so the
+ * CPU time left while the bus is busy can be measured.
+ *
+ * The bytes written to each device can be captured, and each read gets the
+ * bytes written in the same transfer (loopback), or a counter when nothing
+ * is written.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "spi_mcu.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Simulated bus
+ */
+typedef struct {
+	bool pacing;				/*!< The transfers take their time, otherwise they end at once */
+	uint32_t overhead_ns;		/*!< Time of each transfer besides its bits */
+} spi_host_config_t;
+
+/**
+ * @brief Traffic of a device
+ */
+typedef struct {
+	uint32_t transfers;			/*!< Transfers on the bus */
+	uint32_t bytes;				/*!< Bytes on the bus */
+	uint64_t busy_ns;			/*!< Time of the transfers */
+	uint32_t lost;				/*!< Tags dropped by SpiQueue() */
+} spi_host_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Configure the bus, before SpiInit()
+ *
+ * Without it the transfers are paced with no overhead.
+ *
+ * @param config Pacing and overhead
+ */
+void SpiHostConfig(const spi_host_config_t *config);
+
+/**
+ * @brief Keep the bytes written to a device
+ *
+ * @param device Device
+ * @param buffer Bytes written, in order (NULL to stop)
+ * @param size Size of buffer, the rest is not kept
+ */
+void SpiHostCapture(spi_dev_t device, uint8_t *buffer, uint32_t size);
+
+/**
+ * @brief Traffic of a device since SpiInit()
+ *
+ * @param device Device
+ * @return Statistics
+ */
+spi_host_stats_t SpiHostStats(spi_dev_t device);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SPI_HOST_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,74 @@
+/**
+ * @file test_framebuffer_ppm.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Framebuffer frames dumped to PPM images
+ *
+ * FB_PPM_DIR (environment) keeps the images to look at them, by default they
+ * are written to /tmp and removed.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "framebuffer.h"
+/*==================[macros and definitions]=================================*/
+#define WIDTH		32
+#define HEIGHT		16
+/*==================[internal data definition]===============================*/
+static uint16_t buffer[WIDTH * HEIGHT];
+/*==================[internal functions definition]==========================*/
+static void Flush(const fb_rect_t *area, const uint16_t *pixels, uint16_t stride, void *param){
+	(void)area;
+	(void)pixels;
+	(void)stride;
+	(void)param;
+}
+
+TEST_CASE("Framebuffer PPM dump", "[framebuffer]")
+{
+	fb_config_t config = {.width = WIDTH, .height = HEIGHT, .buffers = {buffer, NULL},
+						  .buffer_pixels = WIDTH * HEIGHT, .flush_p = Flush};
+	const char *dir = getenv("FB_PPM_DIR");
+	char path[256];
+	char header[32];
+	uint8_t rgb[3];
+	fb_t fb;
+	FILE *file;
+
+	snprintf(path, sizeof(path), "%s/framebuffer_test.ppm", dir != NULL ? dir : "/tmp");
+	TEST_ASSERT_TRUE(FbInit(&fb, &config));
+	FbFill(&fb, 0x0000);
+	FbFillRect(&fb, 0, 0, 15, 7, 0xF800);
+	FbDrawPixel(&fb, 31, 15, 0x07FF);
+	TEST_ASSERT_TRUE(FbWritePpm(path, buffer, WIDTH, HEIGHT, WIDTH));
+
+	file = fopen(path, "rb");
+	TEST_ASSERT_NOT_NULL(file);
+	TEST_ASSERT_NOT_NULL(fgets(header, sizeof(header), file));
+	TEST_ASSERT_EQUAL_STRING("P6\n", header);
+	TEST_ASSERT_NOT_NULL(fgets(header, sizeof(header), file));
+	TEST_ASSERT_EQUAL_STRING("32 16\n", header);
+	TEST_ASSERT_NOT_NULL(fgets(header, sizeof(header), file));
+	TEST_ASSERT_EQUAL_STRING("255\n", header);
+	TEST_ASSERT_EQUAL(3, fread(rgb, 1, 3, file));
+	TEST_ASSERT_EQUAL(255, rgb[0]);
+	TEST_ASSERT_EQUAL(0, rgb[1] + rgb[2]);
+	fseek(file, 3 * (WIDTH * HEIGHT - 2), SEEK_CUR);
+	TEST_ASSERT_EQUAL(3, fread(rgb, 1, 3, file));
+	TEST_ASSERT_EQUAL(0, rgb[0]);
+	TEST_ASSERT_EQUAL(255, rgb[1]);
+	TEST_ASSERT_EQUAL(255, rgb[2]);
+	TEST_ASSERT_EQUAL(EOF, fgetc(file));
+	fclose(file);
+	if(dir == NULL){
+		remove(path);
+	}
+}
@@ -0,0 +1,211 @@
+/**
+ * @file test_i2c_host.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Transactions of i2c_queue_mcu.h on the simulated bus
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "unity.h"
+#include "i2c_host.h"
+/*==================[macros and definitions]=================================*/
+#define ADDRESS				0x68
+#define REG_SMPLRT_DIV		0x19
+#define REG_CONFIG			0x1A
+#define REG_GYRO_CONFIG		0x1B
+#define REG_ACCEL_CONFIG	0x1C
+#define REG_PWR_MGMT_1		0x6B
+#define REG_WHO_AM_I		0x75
+#define CLOCK_HZ			400000
+/*==================[internal data definition]===============================*/
+static i2c_host_bus_t bus;
+static i2c_host_device_t *sensor;
+static i2c_queue_t queue;
+static i2c_device_t device;
+static i2c_transaction_t *done[4];
+static int n_done;
+/*==================[internal functions definition]==========================*/
+static void Done(i2c_transaction_t *transaction, void *param){
+	(void)param;
+	done[n_done++] = transaction;
+}
+
+static void Setup(void){
+	i2c_queue_config_t config;
+
+	I2cHostInit(&bus, CLOCK_HZ, 0);
+	sensor = I2cHostAddDevice(&bus, ADDRESS);
+	sensor->regs[REG_WHO_AM_I] = ADDRESS;
+	I2cHostQueueConfig(&bus, &config);
+	I2cQueueInit(&queue, &config);
+	I2cDeviceInit(&device, ADDRESS, true);
+	n_done = 0;
+}
+
+TEST_CASE("I2C script through the queue", "[i2c]")
+{
+	uint8_t who = 0;
+	uint8_t value;
+	const i2c_op_t init[] = {
+		I2C_OP_WRITE_REG(REG_PWR_MGMT_1, 0x80),
+		I2C_OP_DELAY_MS(100),
+		I2C_OP_WRITE_REG(REG_PWR_MGMT_1, 0x01),
+		I2C_OP_WRITE_REG(REG_SMPLRT_DIV, 9),
+		I2C_OP_WRITE_REG(REG_CONFIG, 0x01),
+		I2C_OP_WRITE_REG(REG_GYRO_CONFIG, 0x00),
+		I2C_OP_WRITE_REG(REG_ACCEL_CONFIG, 0x00),
+	};
+	const i2c_op_t ranges[] = {
+		I2C_OP_UPDATE_REG(REG_GYRO_CONFIG, 0x18, 0x08),
+		I2C_OP_UPDATE_REG(REG_ACCEL_CONFIG, 0x18, 0x10),
+		I2C_OP_UPDATE_REG(REG_GYRO_CONFIG, 0x18, 0x08),
+		I2C_OP_READ_BYTES(REG_WHO_AM_I, &who, 1),
+	};
+	i2c_transaction_t first = {.device = &device, .ops = init, .n_ops = 7, .func_p = Done};
+	i2c_transaction_t second = {.device = &device, .ops = ranges, .n_ops = 4, .func_p = Done};
+
+	Setup();
+	TEST_ASSERT_TRUE(I2cQueueRunNext(&queue) == NULL);
+	TEST_ASSERT_TRUE(I2cQueueSubmit(&queue, &first));
+	TEST_ASSERT_TRUE(I2cQueueSubmit(&queue, &second));
+	TEST_ASSERT_EQUAL(2, I2cQueuePending(&queue));
+	TEST_ASSERT_EQUAL(I2C_TRANSACTION_PENDING, second.status);
+	TEST_ASSERT_EQUAL(0, bus.transfers);
+
+	/* In the order submitted */
+	TEST_ASSERT_TRUE(I2cQueueRunNext(&queue) == &first);
+	TEST_ASSERT_TRUE(I2cQueueRunNext(&queue) == &second);
+	TEST_ASSERT_TRUE(I2cQueueRunNext(&queue) == NULL);
+	TEST_ASSERT_EQUAL(2, n_done);
+	TEST_ASSERT_TRUE(done[0] == &first);
+	TEST_ASSERT_EQUAL(I2C_TRANSACTION_DONE, first.status);
+	TEST_ASSERT_EQUAL(I2C_TRANSACTION_DONE, second.status);
+
+	/* SMPLRT_DIV to ACCEL_CONFIG in one transfer, the updates from the shadow */
+	TEST_ASSERT_EQUAL(0x01, sensor->regs[REG_PWR_MGMT_1]);
+	TEST_ASSERT_EQUAL(9, sensor->regs[REG_SMPLRT_DIV]);
+	TEST_ASSERT_EQUAL(0x01, sensor->regs[REG_CONFIG]);
+	TEST_ASSERT_EQUAL(0x08, sensor->regs[REG_GYRO_CONFIG]);
+	TEST_ASSERT_EQUAL(0x10, sensor->regs[REG_ACCEL_CONFIG]);
+	TEST_ASSERT_EQUAL(ADDRESS, who);
+	TEST_ASSERT_EQUAL(6, bus.transfers);
+	TEST_ASSERT_EQUAL(3, queue.stats.merged);
+	TEST_ASSERT_EQUAL(3, queue.stats.shadow_hits);
+	TEST_ASSERT_EQUAL(1, queue.stats.skipped);
+	TEST_ASSERT_EQUAL(1, sensor->reads);
+	/* The read is a single transfer, with a repeated start */
+	TEST_ASSERT_EQUAL(1, bus.repeated_starts);
+	TEST_ASSERT_TRUE(I2cDeviceShadow(&device, REG_ACCEL_CONFIG, &value));
+	TEST_ASSERT_EQUAL(0x10, value);
+	TEST_ASSERT_TRUE(bus.time_ns >= 100000000ULL);
+}
+
+TEST_CASE("I2C update through the shadow", "[i2c]")
+{
+	const i2c_op_t set[] = {I2C_OP_UPDATE_REG(REG_PWR_MGMT_1, 0x40, 0x00)};
+	const i2c_op_t clock[] = {I2C_OP_UPDATE_REG(REG_PWR_MGMT_1, 0x07, 0x01)};
+	i2c_transaction_t transaction = {.device = &device, .ops = set, .n_ops = 1};
+
+	Setup();
+	sensor->regs[REG_PWR_MGMT_1] = 0x40;
+
+	/* The first update reads the device, the next ones do not */
+	TEST_ASSERT_TRUE(I2cQueueRun(&queue, &transaction));
+	TEST_ASSERT_EQUAL(0x00, sensor->regs[REG_PWR_MGMT_1]);
+	TEST_ASSERT_EQUAL(1, sensor->reads);
+	transaction.ops = clock;
+	TEST_ASSERT_TRUE(I2cQueueRun(&queue, &transaction));
+	TEST_ASSERT_TRUE(I2cQueueRun(&queue, &transaction));
+	TEST_ASSERT_EQUAL(0x01, sensor->regs[REG_PWR_MGMT_1]);
+	TEST_ASSERT_EQUAL(1, sensor->reads);
+	TEST_ASSERT_EQUAL(3, bus.transfers);
+
+	/* Changed by the device: the shadow must be invalidated */
+	sensor->regs[REG_PWR_MGMT_1] = 0x41;
+	I2cDeviceInvalidate(&device);
+	TEST_ASSERT_TRUE(I2cQueueRun(&queue, &transaction));
+	TEST_ASSERT_EQUAL(2, sensor->reads);
+	TEST_ASSERT_EQUAL(0x41, sensor->regs[REG_PWR_MGMT_1]);
+	TEST_ASSERT_EQUAL(4, bus.transfers);
+}
+
+TEST_CASE("I2C errors and full queue", "[i2c]")
+{
+	uint8_t bytes[2] = {0x12, 0x34};
+	uint8_t value;
+	const i2c_op_t ops[] = {
+		I2C_OP_WRITE_BYTES(REG_SMPLRT_DIV, bytes, 2),
+		I2C_OP_WRITE_REG(REG_GYRO_CONFIG, 0x18),
+		I2C_OP_UPDATE_REG(REG_PWR_MGMT_1, 0x01, 0x01),
+	};
+	i2c_device_t absent;
+	i2c_transaction_t transaction = {.device = &absent, .ops = ops, .n_ops = 3, .func_p = Done};
+
+	Setup();
+	/* No ACK: the rest is skipped and the function is called anyway */
+	I2cDeviceInit(&absent, 0x50, false);
+	TEST_ASSERT_FALSE(I2cQueueRun(&queue, &transaction));
+	TEST_ASSERT_EQUAL(I2C_TRANSACTION_ERROR, transaction.status);
+	TEST_ASSERT_EQUAL(0, transaction.failed_op);
+	TEST_ASSERT_EQUAL(1, n_done);
+	TEST_ASSERT_EQUAL(1, bus.nacks);
+	TEST_ASSERT_EQUAL(1, queue.stats.errors);
+	TEST_ASSERT_FALSE(I2cDeviceShadow(&absent, REG_SMPLRT_DIV, &value));
+
+	/* Without auto increment the writes are not merged */
+	I2cDeviceInit(&device, ADDRESS, false);
+	transaction.device = &device;
+	TEST_ASSERT_TRUE(I2cQueueRun(&queue, &transaction));
+	TEST_ASSERT_EQUAL(0, queue.stats.merged);
+	TEST_ASSERT_EQUAL(0x34, sensor->regs[REG_CONFIG]);
+	TEST_ASSERT_EQUAL(0x18, sensor->regs[REG_GYRO_CONFIG]);
+	I2cDeviceInit(&device, ADDRESS, true);
+	TEST_ASSERT_TRUE(I2cQueueRun(&queue, &transaction));
+	TEST_ASSERT_EQUAL(1, queue.stats.merged);
+
+	for(int i = 0; i < I2C_QUEUE_LENGTH; i++){
+		TEST_ASSERT_TRUE(I2cQueueSubmit(&queue, &transaction));
+	}
+	TEST_ASSERT_FALSE(I2cQueueSubmit(&queue, &transaction));
+	TEST_ASSERT_EQUAL(1, queue.stats.full);
+	TEST_ASSERT_TRUE(I2cQueueRunNext(&queue) != NULL);
+	TEST_ASSERT_TRUE(I2cQueueSubmit(&queue, &transaction));
+	TEST_ASSERT_EQUAL(I2C_QUEUE_LENGTH, I2cQueuePending(&queue));
+}
+
+TEST_CASE("I2C cancel of a transaction not started", "[i2c]")
+{
+	const i2c_op_t ops[] = {
+		I2C_OP_WRITE_REG(REG_CONFIG, 0x01),
+	};
+	i2c_transaction_t transactions[3];
+
+	Setup();
+	for(int i = 0; i < 3; i++){
+		transactions[i] = (i2c_transaction_t){.device = &device, .ops = ops, .n_ops = 1, .func_p = Done};
+	}
+	/* Around the end of the ring, so the later ones move across it */
+	for(int i = 0; i < I2C_QUEUE_LENGTH - 1; i++){
+		TEST_ASSERT_TRUE(I2cQueueSubmit(&queue, &transactions[0]));
+		TEST_ASSERT_TRUE(I2cQueueTake(&queue) == &transactions[0]);
+	}
+	for(int i = 0; i < 3; i++){
+		TEST_ASSERT_TRUE(I2cQueueSubmit(&queue, &transactions[i]));
+	}
+	TEST_ASSERT_TRUE(I2cQueueCancel(&queue, &transactions[1]));
+	TEST_ASSERT_EQUAL(I2C_TRANSACTION_IDLE, transactions[1].status);
+	TEST_ASSERT_FALSE(I2cQueueCancel(&queue, &transactions[1]));
+	TEST_ASSERT_EQUAL(2, I2cQueuePending(&queue));
+
+	/* Taken, it can not be cancelled any more */
+	TEST_ASSERT_TRUE(I2cQueueTake(&queue) == &transactions[0]);
+	TEST_ASSERT_FALSE(I2cQueueCancel(&queue, &transactions[0]));
+	TEST_ASSERT_TRUE(I2cQueueRunNext(&queue) == &transactions[2]);
+	TEST_ASSERT_TRUE(I2cQueueRunNext(&queue) == NULL);
+	TEST_ASSERT_EQUAL(1, n_done);
+	TEST_ASSERT_EQUAL(1, bus.transfers);
+}
@@ -0,0 +1,117 @@
+/**
+ * @file test_raster_golden.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Framebuffer primitives compared against golden PPM images
+ *
+ * The scene is drawn with a full buffer and with strips, both frames must be
+ * equal to golden/raster_scene.ppm. On a mismatch the frame is written to
+ * FB_PPM_DIR (environment, /tmp by default) to look at it. RASTER_GOLDEN_UPDATE
+ * (environment) rewrites the golden image after an intended change.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "framebuffer.h"
+/*==================[macros and definitions]=================================*/
+#define WIDTH		96
+#define HEIGHT		64
+#define STRIP		(WIDTH * 7)
+#define PPM_SIZE	(sizeof("P6\n96 64\n255\n") - 1 + 3 * WIDTH * HEIGHT)
+/*==================[internal data definition]===============================*/
+static uint16_t full_buffer[WIDTH * HEIGHT];
+static uint16_t strips[2][STRIP];
+static uint16_t screen[WIDTH * HEIGHT];
+static uint8_t golden[PPM_SIZE + 1];
+static uint8_t actual[PPM_SIZE + 1];
+/*==================[internal functions definition]==========================*/
+static void Flush(const fb_rect_t *area, const uint16_t *pixels, uint16_t stride, void *param){
+	(void)param;
+	for(int16_t y = area->y0; y <= area->y1; y++){
+		memcpy(&screen[y * WIDTH + area->x0], &pixels[(y - area->y0) * stride],
+			   (area->x1 - area->x0 + 1) * sizeof(uint16_t));
+	}
+}
+
+static void Scene(fb_t *fb, void *param){
+	static const fb_point_t star[] = {
+		{80, 5}, {84, 15}, {94, 15}, {86, 21}, {89, 31},
+		{80, 25}, {71, 31}, {74, 21}, {66, 15}, {76, 15},
+	};
+	(void)param;
+	FbFill(fb, 0x0000);
+	FbDrawLine(fb, 2, 2, 40, 20, 0xFFFF);
+	FbDrawLine(fb, 2, 10, 12, 60, 0xFFE0);
+	FbDrawLineAA(fb, 50, 2, 92, 24, 0xFFFF);
+	FbDrawLineAA(fb, 50, 60, 60, 10, 0x07FF);
+	FbDrawCircle(fb, 25, 40, 15, 0xF800);
+	FbFillCircle(fb, 25, 40, 8, 0x07E0);
+	FbFillTriangle(fb, 60, 30, 90, 40, 70, 62, 0x001F);
+	FbDrawTriangle(fb, 60, 30, 90, 40, 70, 62, 0xFFFF);
+	FbFillPolygonAA(fb, star, 10, 0xFD20);
+	/* Partly outside the display */
+	FbFillCircle(fb, 94, 62, 6, 0xF81F);
+	FbDrawLine(fb, -20, 63, 30, 50, 0x8410);
+}
+
+static size_t ReadFile(const char *path, uint8_t *data){
+	FILE *file = fopen(path, "rb");
+	size_t size;
+	if(file == NULL){
+		return 0;
+	}
+	size = fread(data, 1, PPM_SIZE + 1, file);
+	fclose(file);
+	return size;
+}
+
+/* Compares a frame with the golden image, keeping it when it differs */
+static bool Matches(const uint16_t *pixels, const char *name){
+	const char *dir = getenv("FB_PPM_DIR");
+	char path[256];
+	bool equal;
+
+	snprintf(path, sizeof(path), "%s/%s.ppm", dir != NULL ? dir : "/tmp", name);
+	TEST_ASSERT_TRUE(FbWritePpm(path, pixels, WIDTH, HEIGHT, WIDTH));
+	TEST_ASSERT_EQUAL(PPM_SIZE, ReadFile(path, actual));
+	equal = memcmp(golden, actual, PPM_SIZE) == 0;
+	if(equal && dir == NULL){
+		remove(path);
+	}
+	if(!equal){
+		printf("  frame written to %s\n", path);
+	}
+	return equal;
+}
+
+TEST_CASE("Raster golden image", "[raster]")
+{
+	const char *golden_path = GOLDEN_DIR "/raster_scene.ppm";
+	fb_config_t config = {.width = WIDTH, .height = HEIGHT, .buffers = {full_buffer, NULL},
+						  .buffer_pixels = WIDTH * HEIGHT, .flush_p = Flush};
+	fb_t fb;
+
+	TEST_ASSERT_TRUE(FbInit(&fb, &config));
+	Scene(&fb, NULL);
+	if(getenv("RASTER_GOLDEN_UPDATE") != NULL){
+		TEST_ASSERT_TRUE(FbWritePpm(golden_path, full_buffer, WIDTH, HEIGHT, WIDTH));
+	}
+	TEST_ASSERT_MESSAGE(ReadFile(golden_path, golden) == PPM_SIZE, "missing golden image");
+	TEST_ASSERT_MESSAGE(Matches(full_buffer, "raster_full"), "full buffer differs from the golden image");
+
+	/* Strips clip the primitives at their edges: same frame */
+	config.buffers[0] = strips[0];
+	config.buffers[1] = strips[1];
+	config.buffer_pixels = STRIP;
+	TEST_ASSERT_TRUE(FbInit(&fb, &config));
+	FbRender(&fb, Scene, NULL);
+	TEST_ASSERT_MESSAGE(Matches(screen, "raster_strips"), "strips differ from the golden image");
+}
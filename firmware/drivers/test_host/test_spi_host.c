@@ -0,0 +1,125 @@
+/**
+ * @file test_spi_host.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Queued transactions of spi_mcu.h on the host backend
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "unity.h"
+#include "spi_host.h"
+/*==================[macros and definitions]=================================*/
+#define BITRATE			20000000
+#define SLOW_BITRATE	1000000
+/*==================[internal data definition]===============================*/
+static uint8_t capture[3 * SPI_MAX_TRANSFER];
+/*==================[internal functions definition]==========================*/
+static void Setup(spi_dev_t device, uint32_t bitrate, bool pacing){
+	spi_host_config_t bus = {.pacing = pacing};
+	spi_mcu_config_t spi = {.device = device, .bitrate = bitrate, .transfer_mode = SPI_POLLING};
+
+	SpiHostConfig(&bus);
+	SpiInit(&spi);
+	SpiHostCapture(device, capture, sizeof(capture));
+}
+
+TEST_CASE("SPI queued transactions and their results", "[spi]")
+{
+	uint8_t tx[3][4] = {{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}};
+	uint8_t rx[3][4];
+	uint8_t read[2];
+	int tags[3];
+	void *users[8];
+	uint8_t n = 0;
+
+	Setup(SPI_1, BITRATE, true);
+	memset(rx, 0, sizeof(rx));
+	TEST_ASSERT_EQUAL(0, SpiGetResults(SPI_1, users, 8, 0));
+	for(int i = 0; i < 3; i++){
+		SpiQueue(SPI_1, tx[i], rx[i], 4, &tags[i]);
+	}
+	SpiQueue(SPI_1, NULL, read, 2, NULL);
+	TEST_ASSERT_EQUAL(4, SpiPending(SPI_1));
+
+	/* In the order queued, without the untagged one */
+	while(n < 3){
+		n += SpiGetResults(SPI_1, &users[n], 8 - n, 1000);
+	}
+	TEST_ASSERT_TRUE(users[0] == &tags[0]);
+	TEST_ASSERT_TRUE(users[1] == &tags[1]);
+	TEST_ASSERT_TRUE(users[2] == &tags[2]);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(tx, rx, sizeof(tx));
+	SpiWaitAsync(SPI_1);
+	TEST_ASSERT_EQUAL(0, SpiPending(SPI_1));
+	TEST_ASSERT_EQUAL(0, read[0]);
+	TEST_ASSERT_EQUAL(1, read[1]);
+
+	/* Taken by SpiWaitAsync(), returned together afterwards */
+	for(int i = 0; i < 3; i++){
+		SpiQueue(SPI_1, tx[i], NULL, 4, &tags[i]);
+	}
+	SpiWaitAsync(SPI_1);
+	TEST_ASSERT_EQUAL(3, SpiGetResults(SPI_1, users, 8, 0));
+	TEST_ASSERT_TRUE(users[2] == &tags[2]);
+	TEST_ASSERT_EQUAL(7, SpiHostStats(SPI_1).transfers);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(tx, capture, sizeof(tx));
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(tx, &capture[sizeof(tx)], sizeof(tx));
+}
+
+TEST_CASE("SPI large writes are split, short ones copied", "[spi]")
+{
+	static uint8_t frame[2 * SPI_MAX_TRANSFER + 100];
+	uint8_t command[2] = {0x2A, 0x2B};
+	uint8_t data = 0x55;
+	spi_host_stats_t stats;
+
+	Setup(SPI_2, SLOW_BITRATE, true);
+	for(uint32_t i = 0; i < sizeof(frame); i++){
+		frame[i] = i * 7;
+	}
+	SpiWriteAsync(SPI_2, frame, sizeof(frame));
+	TEST_ASSERT_EQUAL(3, SpiPending(SPI_2));
+
+	/* The frame takes ~66 ms, the command is sent after it */
+	SpiWriteAsync(SPI_2, command, 2);
+	command[0] = 0;
+	command[1] = 0;
+	/* The blocking write waits for the queued ones */
+	SpiWrite(SPI_2, &data, 1);
+	TEST_ASSERT_EQUAL(0, SpiPending(SPI_2));
+
+	stats = SpiHostStats(SPI_2);
+	TEST_ASSERT_EQUAL(5, stats.transfers);
+	TEST_ASSERT_EQUAL(sizeof(frame) + 3, stats.bytes);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(frame, capture, sizeof(frame));
+	TEST_ASSERT_EQUAL(0x2A, capture[sizeof(frame)]);
+	TEST_ASSERT_EQUAL(0x2B, capture[sizeof(frame) + 1]);
+	TEST_ASSERT_EQUAL(0x55, capture[sizeof(frame) + 2]);
+}
+
+TEST_CASE("SPI tags beyond the queue are dropped", "[spi]")
+{
+	uint8_t byte = 0;
+	int tags[2 * SPI_QUEUE_SIZE + 2];
+	void *users[2 * SPI_QUEUE_SIZE];
+
+	Setup(SPI_3, BITRATE, false);
+	for(int i = 0; i < 2 * SPI_QUEUE_SIZE + 2; i++){
+		SpiQueue(SPI_3, &byte, NULL, 1, &tags[i]);
+	}
+	TEST_ASSERT_EQUAL(SPI_QUEUE_SIZE, SpiPending(SPI_3));
+	TEST_ASSERT_EQUAL(2, SpiHostStats(SPI_3).lost);
+
+	/* Only the last SPI_QUEUE_SIZE are kept */
+	SpiWaitAsync(SPI_3);
+	TEST_ASSERT_EQUAL(SPI_QUEUE_SIZE, SpiGetResults(SPI_3, users, 2 * SPI_QUEUE_SIZE, 0));
+	TEST_ASSERT_TRUE(users[0] == &tags[SPI_QUEUE_SIZE + 2]);
+	TEST_ASSERT_TRUE(users[SPI_QUEUE_SIZE - 1] == &tags[2 * SPI_QUEUE_SIZE + 1]);
+	TEST_ASSERT_EQUAL(SPI_QUEUE_SIZE + 2, SpiHostStats(SPI_3).lost);
+	TEST_ASSERT_EQUAL(0, SpiGetResults(SPI_3, users, 2 * SPI_QUEUE_SIZE, 0));
+}
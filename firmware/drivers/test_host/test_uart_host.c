@@ -0,0 +1,275 @@
+/**
+ * @file test_uart_host.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief uart_mcu.h API end to end through the host backend
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "unity.h"
+#include "uart_host.h"
+/*==================[macros and definitions]=================================*/
+#define PEER_TIMEOUT_MS		2000
+/*==================[internal data definition]===============================*/
+static volatile uint32_t set_count;
+static volatile int set_value;
+static volatile uint8_t last_byte;
+static volatile uint32_t rx_calls;
+static char pair[3];
+/*==================[internal functions definition]==========================*/
+static double Seconds(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Read exactly len bytes from the peer */
+static size_t PeerRead(int fd, char *buf, size_t len){
+	struct pollfd pfd = {.fd = fd, .events = POLLIN};
+	size_t got = 0;
+	while(got < len && poll(&pfd, 1, PEER_TIMEOUT_MS) > 0){
+		ssize_t n = read(fd, &buf[got], len - got);
+		if(n <= 0){
+			break;
+		}
+		got += n;
+	}
+	return got;
+}
+
+static void PeerWrite(int fd, const char *text){
+	size_t len = strlen(text);
+	TEST_ASSERT_EQUAL(len, write(fd, text, len));
+}
+
+/* Wait until cond becomes true (the RX thread runs asynchronously) */
+#define WAIT_FOR(cond) do { \
+		for(int wait_i = 0; wait_i < PEER_TIMEOUT_MS && !(cond); wait_i++){ \
+			usleep(1000); \
+		} \
+		TEST_ASSERT(cond); \
+	} while(0)
+
+static void CommandPing(const char *args, void *param){
+	(void)param;
+	UartSendString(UART_PC, "pong ");
+	UartSendString(UART_PC, args);
+	UartSendString(UART_PC, "\r\n");
+}
+
+static void CommandSet(const char *args, void *param){
+	(void)param;
+	set_value = atoi(args);
+	set_count++;
+}
+
+static void ReadOneByte(void *param){
+	uint8_t data;
+	(void)param;
+	if(UartReadByte(UART_CONNECTOR, &data)){
+		last_byte = data;
+		rx_calls++;
+	}
+}
+
+/* Asks for more bytes than the ring holds, from the event task */
+static void ReadTwoBytes(void *param){
+	(void)param;
+	if(UartReadBuffer(UART_PC, (uint8_t*)pair, 2)){
+		rx_calls++;
+	}
+}
+
+static const uart_command_t commands[] = {
+	{"ping", CommandPing, NULL},
+	{"set", CommandSet, NULL},
+};
+
+static const uart_parser_config_t parser = {.mode = UART_RX_LINES, .commands = commands, .n_commands = 2};
+
+TEST_CASE("UartHost commands and replies over a socketpair", "[uart_host]")
+{
+	uart_host_config_t link = {.link = UART_HOST_SOCKETPAIR, .pacing = false};
+	serial_config_t config = {.port = UART_PC, .baud_rate = 115200, .func_p = UART_NO_INT, .parser_p = &parser};
+	char reply[64];
+	uart_tx_stats_t tx_stats;
+	int peer = UartHostOpen(UART_PC, &link);
+
+	TEST_ASSERT(peer >= 0);
+	UartInit(&config);
+	for(int i = 0; i < 100; i++){
+		PeerWrite(peer, "ping 42\r\n");
+		TEST_ASSERT_EQUAL(9, PeerRead(peer, reply, 9));
+		reply[9] = '\0';
+		TEST_ASSERT_EQUAL_STRING("pong 42\r\n", reply);
+	}
+	UartSendInt(UART_PC, -1234);
+	UartSendFixed(UART_PC, 1234, 2);
+	UartHostFlush(UART_PC);
+	TEST_ASSERT_EQUAL(10, PeerRead(peer, reply, 10));
+	TEST_ASSERT(memcmp(reply, "-123412.34", 10) == 0);
+	UartGetTxStats(UART_PC, &tx_stats);
+	TEST_ASSERT_EQUAL(0, tx_stats.writes_dropped);
+	UartHostClose(UART_PC);
+}
+
+TEST_CASE("UartHost injected line errors", "[uart_host]")
+{
+	uart_host_config_t link = {.link = UART_HOST_SOCKETPAIR, .pacing = false};
+	serial_config_t config = {.port = UART_PC, .baud_rate = 115200, .func_p = UART_NO_INT, .parser_p = &parser};
+	uart_rx_stats_t stats;
+	int peer = UartHostOpen(UART_PC, &link);
+
+	UartInit(&config);
+	set_count = 0;
+	/* The first byte of the line is lost: the whole line is discarded */
+	UartHostInjectError(UART_PC, UART_HOST_FRAME_ERROR);
+	PeerWrite(peer, "set 1\n");
+	usleep(20000);
+	PeerWrite(peer, "set 2\n");
+	WAIT_FOR(set_count == 1);
+	TEST_ASSERT_EQUAL(2, set_value);
+
+	/* The end of line may be among the lost bytes: the next line is discarded too */
+	UartHostInjectError(UART_PC, UART_HOST_OVERRUN);
+	PeerWrite(peer, "set 3\n");
+	usleep(20000);
+	PeerWrite(peer, "set 4\n");
+	usleep(20000);
+	PeerWrite(peer, "set 5\n");
+	WAIT_FOR(set_count == 2);
+	TEST_ASSERT_EQUAL(5, set_value);
+
+	UartGetRxStats(UART_PC, &stats);
+	TEST_ASSERT_EQUAL(1, stats.frame_errors);
+	TEST_ASSERT_EQUAL(1, stats.overruns);
+	TEST_ASSERT_EQUAL(6, stats.dropped);
+	TEST_ASSERT_EQUAL(2, stats.lines);
+	TEST_ASSERT_EQUAL(0, stats.unknown);
+	UartHostClose(UART_PC);
+}
+
+TEST_CASE("UartHost receive function over a pty", "[uart_host]")
+{
+	uart_host_config_t link = {.link = UART_HOST_PTY, .pacing = true};
+	serial_config_t config = {.port = UART_CONNECTOR, .baud_rate = 9600, .func_p = ReadOneByte, .param_p = NULL};
+	int peer;
+
+	TEST_ASSERT(UartHostOpen(UART_CONNECTOR, &link) >= 0);
+	TEST_ASSERT(UartHostPeerName(UART_CONNECTOR) != NULL);
+	/* Any program can open the peer, as a serial port */
+	peer = open(UartHostPeerName(UART_CONNECTOR), O_RDWR | O_NOCTTY);
+	TEST_ASSERT(peer >= 0);
+	UartInit(&config);
+	rx_calls = 0;
+	PeerWrite(peer, "o");
+	WAIT_FOR(rx_calls == 1);
+	TEST_ASSERT_EQUAL('o', last_byte);
+	PeerWrite(peer, "c");
+	WAIT_FOR(rx_calls == 2);
+	TEST_ASSERT_EQUAL('c', last_byte);
+	close(peer);
+	UartHostClose(UART_CONNECTOR);
+}
+
+TEST_CASE("UartHost baud rate pacing", "[uart_host]")
+{
+	uart_host_config_t link = {.link = UART_HOST_SOCKETPAIR, .pacing = true};
+	serial_config_t config = {.port = UART_PC, .baud_rate = 921600, .func_p = UART_NO_INT};
+	static char block[4000];
+	static char sink[sizeof(block)];
+	int peer = UartHostOpen(UART_PC, &link);
+	double start, elapsed;
+
+	UartInit(&config);
+	memset(block, 'x', sizeof(block));
+	start = Seconds();
+	UartSendBuffer(UART_PC, block, sizeof(block));
+	TEST_ASSERT_EQUAL(sizeof(block), PeerRead(peer, sink, sizeof(sink)));
+	elapsed = Seconds() - start;
+	/* 4000 bytes * 10 bits / 921600 = 43.4 ms */
+	TEST_ASSERT(elapsed > 0.040);
+	TEST_ASSERT(elapsed < 0.080);
+	UartHostClose(UART_PC);
+}
+
+TEST_CASE("UartHost receive function reads more than the ring holds", "[uart_host]")
+{
+	uart_host_config_t link = {.link = UART_HOST_SOCKETPAIR, .pacing = false};
+	serial_config_t config = {.port = UART_PC, .baud_rate = 115200, .func_p = ReadTwoBytes, .param_p = NULL};
+	int peer = UartHostOpen(UART_PC, &link);
+	double start;
+
+	TEST_ASSERT(peer >= 0);
+	UartInit(&config);
+	rx_calls = 0;
+	memset(pair, 0, sizeof(pair));
+	start = Seconds();
+	PeerWrite(peer, "a");
+	usleep(20000);
+	PeerWrite(peer, "b");
+	WAIT_FOR(rx_calls == 1);
+	/* The second byte is read from the link, not after READ_TIMEOUT */
+	TEST_ASSERT_EQUAL_STRING("ab", pair);
+	TEST_ASSERT(Seconds() - start < 0.5);
+	UartHostClose(UART_PC);
+}
+
+TEST_CASE("UartHost messages larger than the TX ring", "[uart_host]")
+{
+	uart_host_config_t link = {.link = UART_HOST_SOCKETPAIR, .pacing = false};
+	serial_config_t config = {.port = UART_PC, .baud_rate = 115200, .func_p = UART_NO_INT};
+	static char block[10000];
+	static char sink[sizeof(block)];
+	uart_tx_stats_t tx_stats;
+	int peer = UartHostOpen(UART_PC, &link);
+
+	TEST_ASSERT(peer >= 0);
+	UartInit(&config);
+	for(size_t i = 0; i < sizeof(block); i++){
+		block[i] = 'a' + i % 26;
+	}
+	/* The peer reads it while it is queued in parts, as the board UART sends it */
+	TEST_ASSERT_EQUAL(sizeof(block), UartSendBuffer(UART_PC, block, sizeof(block)));
+	TEST_ASSERT_EQUAL(sizeof(block), PeerRead(peer, sink, sizeof(sink)));
+	TEST_ASSERT(memcmp(block, sink, sizeof(block)) == 0);
+	UartGetTxStats(UART_PC, &tx_stats);
+	TEST_ASSERT_EQUAL(0, tx_stats.writes_dropped);
+	UartHostClose(UART_PC);
+}
+
+TEST_CASE("UartHost task messages dropped when the TX ring is busy", "[uart_host]")
+{
+	uart_host_config_t link = {.link = UART_HOST_SOCKETPAIR, .pacing = true};
+	serial_config_t config = {.port = UART_PC, .baud_rate = 115200, .func_p = UART_NO_INT};
+	static char block[3000];
+	static char sink[sizeof(block)];
+	uart_tx_stats_t tx_stats;
+	int peer = UartHostOpen(UART_PC, &link);
+	double start;
+
+	TEST_ASSERT(peer >= 0);
+	UartInit(&config);
+	memset(block, 'x', sizeof(block));
+	/* 3000 bytes take 260 ms at 115200 baud: the second one does not fit, the task does not wait */
+	start = Seconds();
+	TEST_ASSERT_EQUAL(sizeof(block), UartSendBuffer(UART_PC, block, sizeof(block)));
+	TEST_ASSERT_EQUAL(0, UartSendBuffer(UART_PC, block, sizeof(block)));
+	TEST_ASSERT(Seconds() - start < 0.1);
+	UartGetTxStats(UART_PC, &tx_stats);
+	TEST_ASSERT_EQUAL(1, tx_stats.writes_dropped);
+	TEST_ASSERT_EQUAL(sizeof(block), tx_stats.bytes_dropped);
+	TEST_ASSERT_EQUAL(sizeof(block), PeerRead(peer, sink, sizeof(sink)));
+	UartHostClose(UART_PC);
+}
@@ -0,0 +1,108 @@
+/**
+ * @file test_uart_rx_pty.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief UART RX parser fed from a pty, as the host would send the commands
+ *
+ * The master side plays the PC and the slave side the UART of the board: the
+ * bytes are read in whatever chunks the pty returns, as the event task does
+ * with the driver buffer.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#include "unity.h"
+#include "uart_rx_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define N_LINES		5000
+/*==================[internal data definition]===============================*/
+static uint32_t count_set;
+static int64_t sum_set;
+static uint32_t count_toggle;
+/*==================[internal functions definition]==========================*/
+static void CommandSet(const char *args, void *param){
+	(void)param;
+	count_set++;
+	sum_set += atoi(args);
+}
+
+static void CommandToggle(const char *args, void *param){
+	(void)args;
+	(void)param;
+	count_toggle++;
+}
+
+/* Read what the slave has and feed the parser */
+static size_t Drain(int slave, uart_parser_t *parser, int timeout_ms){
+	uint8_t buf[256];
+	struct pollfd pfd = {.fd = slave, .events = POLLIN};
+	ssize_t len;
+	if(poll(&pfd, 1, timeout_ms) <= 0){
+		return 0;
+	}
+	len = read(slave, buf, sizeof(buf));
+	TEST_ASSERT(len > 0);
+	UartParserPush(parser, buf, len);
+	return len;
+}
+
+TEST_CASE("UartParser commands over a pty", "[uart_rx]")
+{
+	static const uart_command_t commands[] = {
+		{"set", CommandSet, NULL},
+		{"t", CommandToggle, NULL},
+	};
+	uart_parser_config_t config = {.mode = UART_RX_LINES, .commands = commands, .n_commands = 2};
+	uart_parser_t parser;
+	struct termios tio;
+	char line[32];
+	int64_t expected_sum = 0;
+	int master, slave;
+
+	master = posix_openpt(O_RDWR | O_NOCTTY);
+	TEST_ASSERT(master >= 0);
+	TEST_ASSERT(grantpt(master) == 0 && unlockpt(master) == 0);
+	slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+	TEST_ASSERT(slave >= 0);
+	TEST_ASSERT(tcgetattr(slave, &tio) == 0);
+	cfmakeraw(&tio);
+	TEST_ASSERT(tcsetattr(slave, TCSANOW, &tio) == 0);
+
+	TEST_ASSERT_TRUE(UartParserInit(&parser, &config));
+	count_set = count_toggle = 0;
+	sum_set = 0;
+	/* The host sends as fast as it can, CRLF ended */
+	for(int i = 0; i < N_LINES; i++){
+		int len = (i % 3 == 0) ? snprintf(line, sizeof(line), "t\r\n")
+				: snprintf(line, sizeof(line), "set %d\r\n", i - 2500);
+		if(i % 3 != 0){
+			expected_sum += i - 2500;
+		}
+		TEST_ASSERT(write(master, line, len) == len);
+		/* Keep the pty buffer from filling up */
+		if(i % 64 == 63){
+			while(Drain(slave, &parser, 0) > 0){
+			}
+		}
+	}
+	while(Drain(slave, &parser, 100) > 0){
+	}
+	TEST_ASSERT_EQUAL((N_LINES + 2) / 3, count_toggle);
+	TEST_ASSERT_EQUAL(N_LINES - (N_LINES + 2) / 3, count_set);
+	TEST_ASSERT_EQUAL(expected_sum, sum_set);
+	TEST_ASSERT_EQUAL(0, parser.stats.unknown + parser.stats.too_long);
+	close(slave);
+	close(master);
+}
@@ -0,0 +1,163 @@
+/**
+ * @file text_bench.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Host benchmark of the text renderer
+ *
+ * A capture stub in place of the SPI counts the writes and bytes the ILI9341
+ * gets for a string and for a live numeric readout: as before (a window per
+ * character and a write per 256 bytes) and with text.c (a window per line or
+ * per run of changed cells). A window is 5 writes and 11 bytes (column and row
+ * address set, memory write). Also reports the time to lay out a string,
+ * from the glyph cache, bit by bit from fonts.c and decoded from fonts_pack.c.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "text.h"
+#include "fonts_pack.h"
+#include "format_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define WIDTH			320
+#define HEIGHT			240
+#define WINDOW_WRITES	5
+#define WINDOW_BYTES	11
+#define CHAR_CHUNK		256		/*!< Writes of the former ILI9341DrawChar() */
+#define SPI_BITRATE		20e6	/*!< SPI_BR of ili9341.c */
+#define N_UPDATES		1000
+#define N_LAPS			2000
+
+typedef struct {
+	uint32_t writes;
+	uint32_t bytes;
+} spi_capture_t;
+/*==================[internal data definition]===============================*/
+static uint16_t cache[8192];
+static uint16_t band[2046];
+static spi_capture_t capture;
+/*==================[internal functions definition]==========================*/
+static void Window(const fb_rect_t *area, void *param){
+	(void)area;
+	(void)param;
+	capture.writes += WINDOW_WRITES;
+	capture.bytes += WINDOW_BYTES;
+}
+
+static void Write(const uint16_t *pixels, uint32_t count, void *param){
+	(void)pixels;
+	(void)param;
+	capture.writes++;
+	capture.bytes += count * 2;
+}
+
+/* SPI traffic of the former ILI9341DrawString(), a window per character */
+static void FormerString(const char *str, const Font_t *font, spi_capture_t *former){
+	for(; *str != '\0'; str++){
+		uint32_t bytes = font->info[*str - ' '].width * font->font_height * 2;
+		former->writes += WINDOW_WRITES + (bytes + CHAR_CHUNK - 1) / CHAR_CHUNK;
+		former->bytes += WINDOW_BYTES + bytes;
+	}
+}
+
+static double Now(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void Report(const char *name, const spi_capture_t *former, const spi_capture_t *now, uint32_t n){
+	printf("%-28s %6.0f -> %5.0f writes %8.0f -> %7.0f bytes %7.2f -> %6.2f ms\n", name,
+		   (double)former->writes / n, (double)now->writes / n, (double)former->bytes / n,
+		   (double)now->bytes / n, former->bytes * 8e3 / SPI_BITRATE / n, now->bytes * 8e3 / SPI_BITRATE / n);
+}
+
+static void Init(text_t *text, uint16_t *cache_memory){
+	text_config_t config = {
+		.width = WIDTH, .height = HEIGHT,
+		.cache = cache_memory, .cache_pixels = cache_memory ? sizeof(cache) / sizeof(cache[0]) : 0,
+		.band = band, .band_pixels = sizeof(band) / sizeof(band[0]),
+		.window_p = Window, .write_p = Write,
+	};
+	TextInit(text, &config);
+}
+
+int main(void){
+	const char *label = "Distance: 123.4 cm";
+	spi_capture_t former = {0};
+	text_field_t field;
+	char digits[FORMAT_MAX_LEN];
+	uint32_t weight = 12000;
+	uint32_t seed = 2463534242u;
+	text_t text;
+	double start;
+
+	printf("SPI per string, former -> text.c (writes, bytes, time at 20 MHz)\n");
+	Init(&text, cache);
+	memset(&capture, 0, sizeof(capture));
+	TextDraw(&text, 0, 0, label, &font_22, 0xFFFF, 0x0000);
+	FormerString(label, &font_22, &former);
+	Report("label, font_22", &former, &capture, 1);
+
+	/* A weight readout: 5 digits of font_59, the last ones change most */
+	memset(&former, 0, sizeof(former));
+	memset(&capture, 0, sizeof(capture));
+	TextFieldInit(&field, 0, 100, 5, &font_59, 0xFFFF, 0x0000);
+	for(int i = 0; i < N_UPDATES; i++){
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		weight += (seed % 21) - 10;
+		FormatU32(digits, weight, 5, '0');
+		FormerString(digits, &font_59, &former);
+		TextFieldDraw(&text, &field, digits);
+	}
+	Report("readout, font_59, changes", &former, &capture, N_UPDATES);
+	memset(&capture, 0, sizeof(capture));
+	for(int i = 0; i < N_UPDATES; i++){
+		TextFieldInvalidate(&field);
+		TextFieldDraw(&text, &field, "12345");
+	}
+	Report("readout, font_59, whole", &former, &capture, N_UPDATES);
+
+	/* Layout, with and without the cache (the sink does nothing) */
+	start = Now();
+	for(int lap = 0; lap < N_LAPS; lap++){
+		TextDraw(&text, 0, 0, label, &font_22, 0xFFFF, 0x0000);
+	}
+	printf("TextDraw cached              %8.1f ns/string\n", (Now() - start) / N_LAPS);
+	Init(&text, NULL);
+	start = Now();
+	for(int lap = 0; lap < N_LAPS; lap++){
+		TextDraw(&text, 0, 0, label, &font_22, 0xFFFF, 0x0000);
+	}
+	printf("TextDraw uncached            %8.1f ns/string\n", (Now() - start) / N_LAPS);
+	start = Now();
+	for(int lap = 0; lap < N_LAPS; lap++){
+		TextDrawPacked(&text, 0, 0, label, &font_pack_22, 0xFFFF, 0x0000);
+	}
+	printf("TextDrawPacked font_pack_22  %8.1f ns/string\n", (Now() - start) / N_LAPS);
+	start = Now();
+	for(int lap = 0; lap < N_LAPS; lap++){
+		TextDrawPacked(&text, 0, 0, label, &font_pack_30_aa, 0xFFFF, 0x0000);
+	}
+	printf("TextDrawPacked font_pack_30_aa %6.1f ns/string\n", (Now() - start) / N_LAPS);
+	start = Now();
+	for(int lap = 0; lap < N_LAPS; lap++){
+		TextDraw(&text, 0, 0, "12345", &font_59, 0xFFFF, 0x0000);
+	}
+	printf("TextDraw uncached font_59    %8.1f ns/5 digits\n", (Now() - start) / N_LAPS);
+	start = Now();
+	for(int lap = 0; lap < N_LAPS; lap++){
+		TextDrawPacked(&text, 0, 0, "12345", &font_pack_59_digits, 0xFFFF, 0x0000);
+	}
+	printf("TextDrawPacked 59_digits     %8.1f ns/5 digits\n", (Now() - start) / N_LAPS);
+	return 0;
+}
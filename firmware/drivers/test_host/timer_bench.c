@@ -0,0 +1,91 @@
+/**
+ * @file timer_bench.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Host benchmark of the software timers of timer_mcu.c
+ *
+ * The ADC (2 ms) and DAC (4 ms) ticks of guia2_ej4 plus N_EXTRA periodic
+ * activities (1 to 100 ms, at random phases), run on a virtual clock for
+ * SECONDS seconds. For each set: the alarm interrupts per second, with the
+ * timers started at random times or all in one group (phase aligned, the
+ * expiries that coincide share an interrupt), and the CPU time per expiry
+ * of soft_timer_mcu.c (the work of the interrupt besides the calls).
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "soft_timer_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define MAX_TIMERS		66
+#define SECONDS			100
+#define US_PER_S		1000000ULL
+/*==================[internal data definition]===============================*/
+static deadline_t *storage[MAX_TIMERS];
+static soft_timer_mux_t mux;
+static soft_timer_t timers[MAX_TIMERS];
+static volatile uint32_t sink;
+/*==================[internal functions definition]==========================*/
+static double Seconds(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void Call(void *param){
+	(void)param;
+	sink++;
+}
+
+static void Run(uint32_t n_extra, bool grouped){
+	static const uint32_t periods[] = {1000, 2000, 5000, 10000, 20000, 50000, 100000};
+	soft_timer_group_t group;
+	soft_timer_config_t config = {.dispatch = SOFT_TIMER_ISR, .func_p = Call};
+	uint64_t now = 0;
+	uint64_t alarm;
+	uint32_t expiries = 0;
+	double start;
+	double elapsed;
+
+	srand(n_extra);
+	SoftTimerMuxInit(&mux, storage, MAX_TIMERS);
+	memset(timers, 0, sizeof(timers));
+	SoftTimerGroupInit(&group, 0);
+	config.group_p = grouped ? &group : NULL;
+	for(uint32_t i = 0; i < n_extra + 2; i++){
+		config.period = (i == 0) ? 2000 : (i == 1) ? 4000 : periods[rand() % 7];
+		/* Started at random times, as the tasks that own them */
+		now = rand() % 1000;
+		SoftTimerStart(&mux, &timers[i], &config, now);
+	}
+	start = Seconds();
+	while(SoftTimerNext(&mux, &alarm) && alarm <= SECONDS * US_PER_S){
+		now = alarm;
+		SoftTimerExpire(&mux, now);
+	}
+	elapsed = Seconds() - start;
+	for(uint32_t i = 0; i < n_extra + 2; i++){
+		expiries += timers[i].stats.calls;
+	}
+	printf("%8u %-10s %12.0f %12.0f %10.1f\n", n_extra + 2, grouped ? "grouped" : "free",
+		   (double)expiries / SECONDS, (double)mux.alarms / SECONDS, elapsed * 1e9 / expiries);
+}
+
+int main(void){
+	static const uint32_t extras[] = {0, 8, 30, 64};
+
+	printf("%8s %-10s %12s %12s %10s\n", "timers", "start", "expiries/s", "alarms/s", "ns/expiry");
+	for(uint32_t i = 0; i < sizeof(extras) / sizeof(extras[0]); i++){
+		Run(extras[i], false);
+		Run(extras[i], true);
+	}
+	return 0;
+}
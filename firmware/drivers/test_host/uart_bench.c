@@ -0,0 +1,172 @@
+/**
+ * @file uart_bench.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Throughput and latency of the uart_mcu.h API over the paced host link
+ *
+ * For each baud rate:
+ * - Throughput: the board streams 256 byte messages (retrying when the TX ring
+ *   is full) and the peer measures the bytes/s received.
+ * - Latency: the peer sends "ping\n", a command of the parser answers
+ *   "pong\n", the round trip time is measured.
+ * - Telemetry: 100 sample 12 bit blocks, plain and delta encoded, samples/s.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#define _GNU_SOURCE
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "uart_host.h"
+/*==================[macros and definitions]=================================*/
+#define STREAM_BYTES	(16 * 1024)
+#define MESSAGE_LEN		256
+#define N_PINGS			200
+#define N_BLOCKS		25
+#define BLOCK_SAMPLES	100
+/*==================[internal data definition]===============================*/
+static int peer;
+static volatile size_t peer_bytes;
+/*==================[internal functions definition]==========================*/
+static double Seconds(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void CommandPing(const char *args, void *param){
+	(void)args;
+	(void)param;
+	UartSendString(UART_PC, "pong\n");
+}
+
+static const uart_command_t commands[] = {
+	{"ping", CommandPing, NULL},
+};
+
+static const uart_parser_config_t parser = {.mode = UART_RX_LINES, .commands = commands, .n_commands = 1};
+
+/* Peer side: counts the bytes until the expected amount arrives */
+static void * PeerSink(void *param){
+	size_t expected = *(size_t*)param;
+	char buf[4096];
+	struct pollfd pfd = {.fd = peer, .events = POLLIN};
+	while(peer_bytes < expected && poll(&pfd, 1, 2000) > 0){
+		ssize_t n = read(peer, buf, sizeof(buf));
+		if(n <= 0){
+			break;
+		}
+		peer_bytes += n;
+	}
+	return NULL;
+}
+
+static double Stream(size_t total, size_t (*send)(size_t sent)){
+	pthread_t sink;
+	size_t sent = 0;
+	double start;
+	peer_bytes = 0;
+	pthread_create(&sink, NULL, PeerSink, &total);
+	start = Seconds();
+	while(sent < total){
+		size_t len = send(sent);
+		if(len == 0){
+			usleep(200);
+			continue;
+		}
+		sent += len;
+	}
+	pthread_join(sink, NULL);
+	return Seconds() - start;
+}
+
+static size_t SendMessage(size_t sent){
+	static char message[MESSAGE_LEN];
+	uart_iov_t iov = {.data = message, .len = MESSAGE_LEN};
+	(void)sent;
+	return UartSendV(UART_PC, &iov, 1);
+}
+
+static telemetry_tx_t telemetry;
+static uint16_t samples[BLOCK_SAMPLES];
+static uint8_t telemetry_type;
+
+static size_t SendBlock(size_t sent){
+	for(int i = 0; i < BLOCK_SAMPLES; i++){
+		samples[i] = 2048 + (int)(sent / 7 + i * 3) % 64;
+	}
+	return UartSendTelemetry(UART_PC, &telemetry, 0, telemetry_type, samples, BLOCK_SAMPLES);
+}
+
+static int Compare(const void *a, const void *b){
+	double x = *(const double*)a;
+	double y = *(const double*)b;
+	return (x > y) - (x < y);
+}
+
+static void Latency(double *median, double *p99){
+	static double rtt[N_PINGS];
+	char reply[5];
+	for(int i = 0; i < N_PINGS; i++){
+		size_t got = 0;
+		double start = Seconds();
+		if(write(peer, "ping\n", 5) != 5){
+			break;
+		}
+		while(got < sizeof(reply)){
+			ssize_t n = read(peer, &reply[got], sizeof(reply) - got);
+			if(n <= 0){
+				break;
+			}
+			got += n;
+		}
+		rtt[i] = Seconds() - start;
+	}
+	qsort(rtt, N_PINGS, sizeof(double), Compare);
+	*median = rtt[N_PINGS / 2];
+	*p99 = rtt[N_PINGS * 99 / 100];
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	static const uint32_t bauds[] = {115200, 921600};
+	uart_host_config_t link = {.link = UART_HOST_SOCKETPAIR, .pacing = true};
+
+	printf("%-8s %12s %8s %10s %10s %14s %14s\n", "baud", "bytes/s", "of line", "rtt ms", "p99 ms",
+		   "samples/s", "delta samp/s");
+	for(size_t b = 0; b < sizeof(bauds) / sizeof(bauds[0]); b++){
+		serial_config_t config = {.port = UART_PC, .baud_rate = bauds[b], .func_p = UART_NO_INT, .parser_p = &parser};
+		double line = bauds[b] / 10.0;
+		double elapsed, median, p99, plain, delta;
+		size_t block_bytes;
+
+		peer = UartHostOpen(UART_PC, &link);
+		UartInit(&config);
+
+		elapsed = Stream(STREAM_BYTES, SendMessage);
+		Latency(&median, &p99);
+
+		TelemetryTxInit(&telemetry);
+		telemetry_type = TELEMETRY_U16;
+		block_bytes = TelemetryEncode(&telemetry, 0, telemetry_type, samples, BLOCK_SAMPLES);
+		plain = N_BLOCKS * BLOCK_SAMPLES / Stream(N_BLOCKS * block_bytes, SendBlock);
+		telemetry_type = TELEMETRY_U16 | TELEMETRY_DELTA;
+		block_bytes = TelemetryEncode(&telemetry, 0, telemetry_type, samples, BLOCK_SAMPLES);
+		delta = N_BLOCKS * BLOCK_SAMPLES / Stream(N_BLOCKS * block_bytes, SendBlock);
+
+		printf("%-8u %12.0f %7.1f%% %10.3f %10.3f %14.0f %14.0f\n", bauds[b], STREAM_BYTES / elapsed,
+			   100.0 * STREAM_BYTES / elapsed / line, median * 1e3, p99 * 1e3, plain, delta);
+		UartHostClose(UART_PC);
+	}
+	return 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,558 @@
+/**
+ * @file uart_host.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Linux backend of uart_mcu.h (pty or socketpair links)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include "uart_host.h"
+#include "format_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define TX_RING_SIZE		4096		/*!< Same as the board */
+#define RX_RING_SIZE		1024		/*!< Same as the board */
+#define READ_TIMEOUT_MS		1000		/*!< READ_TIMEOUT of the board (100 ticks) */
+#define POLL_MS				10			/*!< Period of the stop check of the RX thread */
+#define BITS_PER_BYTE		10			/*!< Start + 8 data + stop */
+#define NS_PER_S			1000000000ULL
+#define UNPACED_CHUNK		4096
+#define UART_PORTS			2
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief State of a simulated port
+ */
+typedef struct {
+	bool open;							/*!< The link exists */
+	bool started;						/*!< The threads are running */
+	volatile bool running;				/*!< Cleared to stop the threads */
+	uart_host_link_t link;				/*!< Link type */
+	bool pacing;						/*!< Limit to the baud rate */
+	uint32_t baud_rate;					/*!< Baud rate of UartInit() */
+	int fd;								/*!< Board side */
+	int peer;							/*!< Peer side */
+	char peer_name[64];					/*!< pty slave path */
+	pthread_mutex_t lock;				/*!< Serializes the sending threads (critical section of the board) */
+	pthread_cond_t wake;				/*!< Data queued */
+	pthread_cond_t idle;				/*!< TX ring empty */
+	uart_ring_t tx_ring;				/*!< Bytes waiting to be sent */
+	uint8_t tx_storage[TX_RING_SIZE];
+	uint64_t tx_clock;					/*!< End of the last paced transmission (ns) */
+	pthread_t tx_thread;
+	uart_ring_t rx_ring;				/*!< Bytes received and not read yet */
+	uint8_t rx_storage[RX_RING_SIZE];
+	uint64_t rx_clock;					/*!< End of the last paced reception (ns) */
+	pthread_t rx_thread;
+	bool parse;							/*!< The parser consumes the RX ring */
+	uart_parser_t parser;				/*!< Line/packet parser */
+	void (*func_p)(void*);				/*!< Receive function */
+	void *param_p;						/*!< Parameter of func_p */
+	uart_rx_stats_t stats;				/*!< Line errors and lost bytes */
+	int frame_errors_pending;			/*!< Injected errors */
+	int overruns_pending;
+} uart_host_t;
+
+/**
+ * @brief Number formats of UartSendNumber()
+ */
+typedef enum {
+	NUMBER_INT,
+	NUMBER_FIXED,
+	NUMBER_FLOAT,
+} number_format_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static uart_host_t uart_host[UART_PORTS] = {
+	{.fd = -1, .peer = -1, .lock = PTHREAD_MUTEX_INITIALIZER, .wake = PTHREAD_COND_INITIALIZER, .idle = PTHREAD_COND_INITIALIZER},
+	{.fd = -1, .peer = -1, .lock = PTHREAD_MUTEX_INITIALIZER, .wake = PTHREAD_COND_INITIALIZER, .idle = PTHREAD_COND_INITIALIZER},
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint64_t Now(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * NS_PER_S + ts.tv_nsec;
+}
+
+static void SleepUntil(uint64_t ns){
+	struct timespec ts = {.tv_sec = ns / NS_PER_S, .tv_nsec = ns % NS_PER_S};
+	while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR){
+	}
+}
+
+/**
+ * @brief Bytes per paced chunk: about 1 ms of the line
+ */
+static size_t Chunk(const uart_host_t *h){
+	size_t chunk;
+	if(!h->pacing || h->baud_rate == 0){
+		return UNPACED_CHUNK;
+	}
+	chunk = h->baud_rate / BITS_PER_BYTE / 1000;
+	return (chunk == 0) ? 1 : chunk;
+}
+
+/**
+ * @brief Wait until len bytes sent after the previous ones have gone through the line
+ */
+static void Pace(const uart_host_t *h, uint64_t *clock, size_t len){
+	uint64_t now;
+	if(!h->pacing || h->baud_rate == 0){
+		return;
+	}
+	now = Now();
+	if(*clock < now){
+		*clock = now;
+	}
+	*clock += (uint64_t)len * BITS_PER_BYTE * NS_PER_S / h->baud_rate;
+	SleepUntil(*clock);
+}
+
+static void WriteAll(uart_host_t *h, const uint8_t *data, size_t len){
+	struct pollfd pfd = {.fd = h->fd, .events = POLLOUT};
+	while(len > 0 && h->running){
+		ssize_t n;
+		/* A peer that does not read must not block the stop */
+		if(poll(&pfd, 1, POLL_MS) <= 0){
+			continue;
+		}
+		if(h->link == UART_HOST_SOCKETPAIR){
+			n = send(h->fd, data, len, MSG_NOSIGNAL);
+		} else {
+			n = write(h->fd, data, len);
+		}
+		if(n < 0){
+			if(errno == EINTR){
+				continue;
+			}
+			return;
+		}
+		data += n;
+		len -= n;
+	}
+}
+
+/**
+ * @brief Drain thread, the uart_tx_task of the board
+ */
+static void * TxThread(void *param){
+	uart_host_t *h = param;
+	const uint8_t *data;
+	size_t len;
+	pthread_mutex_lock(&h->lock);
+	while(h->running){
+		if(UartRingUsed(&h->tx_ring) == 0){
+			pthread_cond_broadcast(&h->idle);
+			pthread_cond_wait(&h->wake, &h->lock);
+			continue;
+		}
+		pthread_mutex_unlock(&h->lock);
+		len = UartRingPeek(&h->tx_ring, &data);
+		if(len > Chunk(h)){
+			len = Chunk(h);
+		}
+		Pace(h, &h->tx_clock, len);
+		WriteAll(h, data, len);
+		UartRingConsume(&h->tx_ring, len);
+		pthread_mutex_lock(&h->lock);
+	}
+	pthread_cond_broadcast(&h->idle);
+	pthread_mutex_unlock(&h->lock);
+	return NULL;
+}
+
+/**
+ * @brief Bytes that reached the board: injected errors, RX ring, parser and
+ * receive function, as the event task of the board does
+ */
+static void RxDeliver(uart_host_t *h, const uint8_t *data, size_t len){
+	uint8_t *room;
+	const uint8_t *chunk;
+	size_t n;
+	if(__atomic_load_n(&h->overruns_pending, __ATOMIC_ACQUIRE) > 0){
+		__atomic_fetch_sub(&h->overruns_pending, 1, __ATOMIC_ACQ_REL);
+		h->stats.overruns++;
+		h->stats.dropped += len;
+		UartParserAbort(&h->parser);
+		return;
+	}
+	if(__atomic_load_n(&h->frame_errors_pending, __ATOMIC_ACQUIRE) > 0){
+		__atomic_fetch_sub(&h->frame_errors_pending, 1, __ATOMIC_ACQ_REL);
+		h->stats.frame_errors++;
+		UartParserAbort(&h->parser);
+		data++;
+		len--;
+	}
+	while(len > 0 && (n = UartRingReserve(&h->rx_ring, &room)) > 0){
+		if(n > len){
+			n = len;
+		}
+		memcpy(room, data, n);
+		UartRingCommit(&h->rx_ring, n);
+		data += n;
+		len -= n;
+	}
+	if(len > 0){
+		h->stats.dropped += len;
+		UartParserAbort(&h->parser);
+	}
+	if(h->parse){
+		while((n = UartRingPeek(&h->rx_ring, &chunk)) > 0){
+			UartParserPush(&h->parser, chunk, n);
+			UartRingConsume(&h->rx_ring, n);
+		}
+	}
+	if(h->func_p != NULL){
+		h->func_p(h->param_p);
+	}
+}
+
+/**
+ * @brief Bytes read straight from the link until deadline (ns), the
+ * uart_read_bytes() of the board
+ */
+static size_t ReadLink(uart_host_t *h, uint8_t *data, size_t len, uint64_t deadline){
+	struct pollfd pfd = {.fd = h->fd, .events = POLLIN};
+	size_t read_len = 0;
+	uint64_t now;
+	ssize_t n;
+	while(read_len < len && (now = Now()) < deadline){
+		if(poll(&pfd, 1, (int)((deadline - now + 999999) / 1000000)) <= 0){
+			continue;
+		}
+		n = read(h->fd, &data[read_len], len - read_len);
+		if(n <= 0){
+			break;
+		}
+		Pace(h, &h->rx_clock, n);
+		read_len += n;
+	}
+	return read_len;
+}
+
+/**
+ * @brief Reception thread, the uart_event_task of the board
+ */
+static void * RxThread(void *param){
+	uart_host_t *h = param;
+	uint8_t buf[UNPACED_CHUNK];
+	struct pollfd pfd = {.fd = h->fd, .events = POLLIN};
+	ssize_t len;
+	while(h->running){
+		if(poll(&pfd, 1, POLL_MS) <= 0){
+			continue;
+		}
+		len = read(h->fd, buf, Chunk(h));
+		if(len <= 0){
+			if(len < 0 && (errno == EINTR || errno == EAGAIN)){
+				continue;
+			}
+			/* Peer closed (EIO on a pty) */
+			usleep(POLL_MS * 1000);
+			continue;
+		}
+		Pace(h, &h->rx_clock, len);
+		RxDeliver(h, buf, len);
+	}
+	return NULL;
+}
+
+static void Stop(uart_host_t *h){
+	if(!h->started){
+		return;
+	}
+	pthread_mutex_lock(&h->lock);
+	h->running = false;
+	pthread_cond_broadcast(&h->wake);
+	pthread_mutex_unlock(&h->lock);
+	pthread_join(h->tx_thread, NULL);
+	pthread_join(h->rx_thread, NULL);
+	h->started = false;
+}
+
+static void Wake(uart_host_t *h){
+	pthread_cond_signal(&h->wake);
+}
+
+static size_t UartSendNumber(uart_mcu_port_t port, number_format_t format, int64_t value, float value_f, uint8_t decimals){
+	uart_host_t *h = &uart_host[port];
+	char tmp[FORMAT_MAX_LEN];
+	uint8_t *data;
+	char *dst;
+	size_t len = 0;
+	bool in_place;
+	if(!h->started){
+		return 0;
+	}
+	pthread_mutex_lock(&h->lock);
+	in_place = UartRingReserve(&h->tx_ring, &data) >= FORMAT_MAX_LEN;
+	dst = in_place ? (char*)data : tmp;
+	switch(format){
+		case NUMBER_INT:
+			len = FormatI64(dst, value, 0, ' ');
+			break;
+		case NUMBER_FIXED:
+			len = FormatFixed(dst, value, decimals, 0, ' ');
+			break;
+		case NUMBER_FLOAT:
+			len = FormatFloat(dst, value_f, decimals, 0, ' ');
+			break;
+	}
+	if(in_place){
+		UartRingCommit(&h->tx_ring, len);
+	} else {
+		len = UartRingWrite(&h->tx_ring, tmp, len);
+	}
+	Wake(h);
+	pthread_mutex_unlock(&h->lock);
+	return len;
+}
+/*==================[external functions definition]==========================*/
+int UartHostOpen(uart_mcu_port_t port, const uart_host_config_t *config){
+	uart_host_t *h = &uart_host[port];
+	int fds[2];
+	if(h->open){
+		return h->peer;
+	}
+	h->link = config->link;
+	h->pacing = config->pacing;
+	h->peer_name[0] = '\0';
+	if(config->link == UART_HOST_PTY){
+		struct termios tio;
+		fds[0] = posix_openpt(O_RDWR | O_NOCTTY | O_CLOEXEC);
+		if(fds[0] < 0 || grantpt(fds[0]) != 0 || unlockpt(fds[0]) != 0){
+			return -1;
+		}
+		snprintf(h->peer_name, sizeof(h->peer_name), "%s", ptsname(fds[0]));
+		fds[1] = open(h->peer_name, O_RDWR | O_NOCTTY | O_CLOEXEC);
+		if(fds[1] < 0 || tcgetattr(fds[1], &tio) != 0){
+			return -1;
+		}
+		cfmakeraw(&tio);
+		tcsetattr(fds[1], TCSANOW, &tio);
+	} else if(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0){
+		return -1;
+	}
+	h->fd = fds[0];
+	h->peer = fds[1];
+	h->open = true;
+	return h->peer;
+}
+
+int UartHostPeer(uart_mcu_port_t port){
+	return uart_host[port].open ? uart_host[port].peer : -1;
+}
+
+const char * UartHostPeerName(uart_mcu_port_t port){
+	uart_host_t *h = &uart_host[port];
+	return (h->open && h->link == UART_HOST_PTY) ? h->peer_name : NULL;
+}
+
+void UartHostInjectError(uart_mcu_port_t port, uart_host_error_t error){
+	uart_host_t *h = &uart_host[port];
+	if(error == UART_HOST_FRAME_ERROR){
+		__atomic_fetch_add(&h->frame_errors_pending, 1, __ATOMIC_ACQ_REL);
+	} else {
+		__atomic_fetch_add(&h->overruns_pending, 1, __ATOMIC_ACQ_REL);
+	}
+}
+
+void UartHostFlush(uart_mcu_port_t port){
+	uart_host_t *h = &uart_host[port];
+	if(!h->started){
+		return;
+	}
+	pthread_mutex_lock(&h->lock);
+	while(h->running && UartRingUsed(&h->tx_ring) > 0){
+		pthread_cond_wait(&h->idle, &h->lock);
+	}
+	pthread_mutex_unlock(&h->lock);
+}
+
+void UartHostClose(uart_mcu_port_t port){
+	uart_host_t *h = &uart_host[port];
+	Stop(h);
+	if(h->open){
+		close(h->fd);
+		close(h->peer);
+		h->fd = h->peer = -1;
+		h->open = false;
+	}
+	h->frame_errors_pending = h->overruns_pending = 0;
+}
+
+void UartInit(serial_config_t *port_config){
+	uart_host_t *h = &uart_host[port_config->port];
+	if(!h->open){
+		uart_host_config_t config = {.link = UART_HOST_SOCKETPAIR, .pacing = true};
+		if(UartHostOpen(port_config->port, &config) < 0){
+			perror("UartHostOpen");
+			abort();
+		}
+	}
+	Stop(h);
+	h->baud_rate = port_config->baud_rate;
+	h->func_p = (port_config->func_p != UART_NO_INT) ? port_config->func_p : NULL;
+	h->param_p = port_config->param_p;
+	h->parse = (port_config->parser_p != NULL);
+	memset(&h->parser, 0, sizeof(h->parser));
+	if(h->parse && !UartParserInit(&h->parser, port_config->parser_p)){
+		fprintf(stderr, "UartInit: invalid command table\n");
+		abort();
+	}
+	memset(&h->stats, 0, sizeof(h->stats));
+	UartRingInit(&h->tx_ring, h->tx_storage, TX_RING_SIZE);
+	UartRingInit(&h->rx_ring, h->rx_storage, RX_RING_SIZE);
+	h->tx_clock = h->rx_clock = 0;
+	h->running = true;
+	pthread_create(&h->tx_thread, NULL, TxThread, h);
+	pthread_create(&h->rx_thread, NULL, RxThread, h);
+	h->started = true;
+}
+
+uint8_t UartReadByte(uart_mcu_port_t port, uint8_t *data){
+	return UartReadBuffer(port, data, 1);
+}
+
+uint8_t UartReadBuffer(uart_mcu_port_t port, uint8_t *data, uint16_t nbytes){
+	uart_host_t *h = &uart_host[port];
+	const uint8_t *chunk;
+	size_t read = 0;
+	size_t len;
+	uint64_t deadline = Now() + READ_TIMEOUT_MS * 1000000ULL;
+	if(!h->started){
+		return false;
+	}
+	while(read < nbytes){
+		len = UartRingPeek(&h->rx_ring, &chunk);
+		if(len == 0){
+			if(Now() >= deadline){
+				break;
+			}
+			if(pthread_equal(pthread_self(), h->rx_thread)){
+				/* From the receive function nothing refills the ring: read the link, as the board reads the driver */
+				read += ReadLink(h, &data[read], nbytes - read, deadline);
+				break;
+			}
+			usleep(1000);
+			continue;
+		}
+		if(len > (size_t)nbytes - read){
+			len = nbytes - read;
+		}
+		memcpy(&data[read], chunk, len);
+		UartRingConsume(&h->rx_ring, len);
+		read += len;
+	}
+	return read > 0;
+}
+
+void UartGetRxStats(uart_mcu_port_t port, uart_rx_stats_t *stats){
+	uart_host_t *h = &uart_host[port];
+	*stats = h->parser.stats;
+	stats->overruns = h->stats.overruns;
+	stats->frame_errors = h->stats.frame_errors;
+	stats->parity_errors = h->stats.parity_errors;
+	stats->dropped = h->stats.dropped;
+}
+
+size_t UartSendV(uart_mcu_port_t port, const uart_iov_t *iov, size_t n_iov){
+	uart_host_t *h = &uart_host[port];
+	size_t total = 0;
+	size_t len;
+	bool parts;
+	if(!h->started){
+		return 0;
+	}
+	for(size_t i = 0; i < n_iov; i++){
+		total += iov[i].len;
+	}
+	parts = total > TX_RING_SIZE;
+	pthread_mutex_lock(&h->lock);
+	if(parts){
+		len = UartRingWritePart(&h->tx_ring, iov, n_iov, 0);
+	} else {
+		len = UartRingWriteV(&h->tx_ring, iov, n_iov);
+	}
+	Wake(h);
+	pthread_mutex_unlock(&h->lock);
+	/* Larger than the ring: the rest as the TX thread sends it */
+	while(parts && len < total){
+		usleep(1000);
+		pthread_mutex_lock(&h->lock);
+		len += UartRingWritePart(&h->tx_ring, iov, n_iov, len);
+		Wake(h);
+		pthread_mutex_unlock(&h->lock);
+	}
+	return len;
+}
+
+size_t UartSendByte(uart_mcu_port_t port, const char *data){
+	uart_iov_t iov = {.data = data, .len = 1};
+	return UartSendV(port, &iov, 1);
+}
+
+size_t UartSendString(uart_mcu_port_t port, const char *msg){
+	uart_iov_t iov = {.data = msg, .len = strlen(msg)};
+	return UartSendV(port, &iov, 1);
+}
+
+size_t UartSendBuffer(uart_mcu_port_t port, const char *data, size_t nbytes){
+	uart_iov_t iov = {.data = data, .len = nbytes};
+	return UartSendV(port, &iov, 1);
+}
+
+void UartGetTxStats(uart_mcu_port_t port, uart_tx_stats_t *stats){
+	uart_host_t *h = &uart_host[port];
+	pthread_mutex_lock(&h->lock);
+	*stats = h->tx_ring.stats;
+	pthread_mutex_unlock(&h->lock);
+}
+
+size_t UartSendInt(uart_mcu_port_t port, int64_t value){
+	return UartSendNumber(port, NUMBER_INT, value, 0, 0);
+}
+
+size_t UartSendFixed(uart_mcu_port_t port, int64_t value, uint8_t decimals){
+	return UartSendNumber(port, NUMBER_FIXED, value, 0, decimals);
+}
+
+size_t UartSendFloat(uart_mcu_port_t port, float value, uint8_t decimals){
+	return UartSendNumber(port, NUMBER_FLOAT, 0, value, decimals);
+}
+
+size_t UartSendTelemetry(uart_mcu_port_t port, telemetry_tx_t *tx, uint8_t channel, uint8_t type, const void *samples, uint16_t count){
+	uart_iov_t iov = {.data = tx->frame, .len = TelemetryEncode(tx, channel, type, samples, count)};
+	if(iov.len == 0){
+		return 0;
+	}
+	return UartSendV(port, &iov, 1);
+}
+
+uint8_t* UartItoa(uint32_t val, uint8_t base){
+	static uint8_t buf[FORMAT_MAX_LEN] = {0};
+	FormatBase((char*)buf, val, base, 0, ' ');
+	return buf;
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,118 @@
+#ifndef UART_HOST_H
+#define UART_HOST_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup UART UART
+ ** @{ */
+
+/** \brief Linux backend of uart_mcu.h for the host tests.
+ *
+ * Each port is one end of a pty pair or a socketpair, the other end (the
+ * peer) plays the PC or the device on the J2 connector. The application code
+ * uses the same uart_mcu.h API: TX ring and drain thread, RX ring, parser and
+ * receive function called from an RX thread (the event task of the board).
+ *
+ * With pacing enabled the bytes take 10 bits of time at the baud rate of
+ * UartInit() in each direction, so throughput and latency are close to the
+ * real link. Line errors can be injected and are reported as the driver does.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_mcu.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Link between a port and its peer
+ */
+typedef enum {
+	UART_HOST_SOCKETPAIR,	/*!< AF_UNIX socketpair */
+	UART_HOST_PTY,			/*!< Pseudo-terminal, the peer is the slave side (raw mode) */
+} uart_host_link_t;
+
+/**
+ * @brief Errors that can be injected in the reception
+ */
+typedef enum {
+	UART_HOST_FRAME_ERROR,	/*!< The next received byte is lost with a frame error */
+	UART_HOST_OVERRUN,		/*!< The next received chunk is lost with an overrun */
+} uart_host_error_t;
+
+/**
+ * @brief Link configuration
+ */
+typedef struct {
+	uart_host_link_t link;	/*!< Link type */
+	bool pacing;			/*!< Limit both directions to the baud rate */
+} uart_host_config_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Create the link of a port, before UartInit()
+ *
+ * UartInit() on a port without a link creates a paced socketpair.
+ *
+ * @param port Port
+ * @param config Link configuration
+ * @return File descriptor of the peer, -1 on error
+ */
+int UartHostOpen(uart_mcu_port_t port, const uart_host_config_t *config);
+
+/**
+ * @brief File descriptor of the peer
+ *
+ * @param port Port
+ * @return File descriptor, -1 if the port has no link
+ */
+int UartHostPeer(uart_mcu_port_t port);
+
+/**
+ * @brief Path of the peer (pty slave)
+ *
+ * @param port Port
+ * @return Path, NULL if it is not a pty
+ */
+const char * UartHostPeerName(uart_mcu_port_t port);
+
+/**
+ * @brief Inject a line error in the reception of a port
+ *
+ * @param port Port
+ * @param error Error
+ */
+void UartHostInjectError(uart_mcu_port_t port, uart_host_error_t error);
+
+/**
+ * @brief Wait until every queued byte has been sent to the peer
+ *
+ * @param port Port
+ */
+void UartHostFlush(uart_mcu_port_t port);
+
+/**
+ * @brief Stop the threads of a port and close its link
+ *
+ * @param port Port
+ */
+void UartHostClose(uart_mcu_port_t port);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef UART_HOST_H */
+
+/*==================[end of file]============================================*/
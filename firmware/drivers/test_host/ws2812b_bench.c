@@ -0,0 +1,75 @@
+/**
+ * @file ws2812b_bench.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Host benchmark of the WS2812B encoder
+ *
+ * Time to encode a 300 LED strip into RMT symbols, against the CPU time the
+ * bit-banged ws2812bSend() takes (the whole time on the line, 1.25 us per
+ * bit). Also the time on the line and the frame rate it allows.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include "ws2812b_encoder.h"
+/*==================[macros and definitions]=================================*/
+#define N_LEDS			300
+#define N_LAPS			2000
+#define BIT_NS			1250		/*!< T0H + T0L, T1H + T1L */
+#define RESOLUTION		10000000
+/*==================[internal data definition]===============================*/
+static rgb_led_t leds[N_LEDS];
+static ws2812b_symbol_t symbols[WS2812B_SYMBOLS(N_LEDS)];
+static uint8_t lut[256];
+/*==================[internal functions definition]==========================*/
+static double Now(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(void){
+	ws2812b_encoder_t encoder;
+	double start, encode, lut_encode;
+	double line_us = (WS2812B_SYMBOLS(N_LEDS) - 1) * BIT_NS / 1e3 + WS2812B_RESET_US;
+	volatile uint32_t sink = 0;
+
+	for(int i = 0; i < N_LEDS; i++){
+		leds[i].green = i * 7;
+		leds[i].red = i * 13;
+		leds[i].blue = i * 29;
+	}
+	for(int i = 0; i < 256; i++){
+		lut[i] = (i * i) >> 8;
+	}
+	Ws2812bEncoderInit(&encoder, RESOLUTION);
+
+	start = Now();
+	for(int lap = 0; lap < N_LAPS; lap++){
+		leds[lap % N_LEDS].blue++;
+		sink += Ws2812bEncode(&encoder, leds, N_LEDS, NULL, symbols);
+	}
+	encode = (Now() - start) / N_LAPS;
+	start = Now();
+	for(int lap = 0; lap < N_LAPS; lap++){
+		leds[lap % N_LEDS].blue++;
+		sink += Ws2812bEncode(&encoder, leds, N_LEDS, lut, symbols);
+	}
+	lut_encode = (Now() - start) / N_LAPS;
+	(void)sink;
+
+	printf("%d LEDs, %u symbols, %u bytes per buffer\n", N_LEDS, (unsigned)WS2812B_SYMBOLS(N_LEDS),
+		   (unsigned)sizeof(symbols));
+	printf("Ws2812bEncode                %8.2f us/strip %6.1f ns/LED\n", encode / 1e3, encode / N_LEDS);
+	printf("Ws2812bEncode with LUT       %8.2f us/strip %6.1f ns/LED\n", lut_encode / 1e3, lut_encode / N_LEDS);
+	printf("ws2812bSend (bit-banged)     %8.2f us/strip of CPU\n", line_us - WS2812B_RESET_US);
+	printf("On the line                  %8.2f us/strip, up to %.0f fps\n", line_us, 1e6 / line_us);
+	return 0;
+}
@@ -18,6 +18,11 @@
 #include <stdlib.h>
 #include "esp_idf_version.h"
 
+#if CONFIG_IDF_TARGET_LINUX
+// Cycle budgets are measured on the ESP32 cores, they don't apply to the host build
+#define TEST_ASSERT_EXEC_IN_RANGE(min_exec, max_exec, actual) \
+    (void)(min_exec); (void)(max_exec); (void)(actual);
+#else
 #define TEST_ASSERT_EXEC_IN_RANGE(min_exec, max_exec, actual) \
     if (actual >= max_exec) { \
         ESP_LOGE("", "Time error. Expected max: %i, reached: %i", (int)max_exec, (int)actual);\
@@ -27,6 +32,7 @@
         ESP_LOGE("", "Time error. Expected min: %i, reached: %i", (int)min_exec, (int)actual);\
         TEST_ASSERT_MESSAGE (false, "Exec time takes less then expected!");\
     }
+#endif // CONFIG_IDF_TARGET_LINUX
 
 
 // memalign function is implemented in IDF 4.3 and later
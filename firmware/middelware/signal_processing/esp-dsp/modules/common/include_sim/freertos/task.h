@@ -0,0 +1,29 @@
+// Copyright 2018-2020 spressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This file include defenitions that are emulate FreeRTOS task calls.
+// The host tests run on a single thread, so delays are ignored.
+
+#ifndef _freertos_task_h_
+#define _freertos_task_h_
+
+#include "freertos/FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+
+#define vTaskDelay(ticks)       ((void)(ticks))
+#define vTaskDelete(handle)     ((void)(handle))
+#define vTaskSuspend(handle)    ((void)(handle))
+
+#endif // _freertos_task_h_
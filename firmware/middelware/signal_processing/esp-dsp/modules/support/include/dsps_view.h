@@ -43,6 +43,62 @@ void dsps_view(const float *data, int32_t len, int width, int height, float min,
 void dsps_view_s16(const int16_t *data, int32_t len, int width, int height, float min, float max, char view_char);
 /**@}*/
 
+/**
+ * @brief   Size of the buffer required by dsps_view_render for a width x height plot
+ */
+#define DSPS_VIEW_BUF_SIZE(width, height) (((height) + 1) * ((width) + 4))
+
+/**
+ * @brief   Output function of dsps_view_render
+ *
+ * @param line: zero terminated plot line, including the trailing '\n'
+ * @param arg: user argument given to dsps_view_render
+ */
+typedef void (*dsps_view_out_t)(const char *line, void *arg);
+
+/**
+ * @brief   Data range found by dsps_view_render
+ */
+typedef struct dsps_view_stats_s {
+    float data_min;     /*!< minimum input value */
+    float data_max;     /*!< maximum input value */
+    int32_t min_pos;    /*!< index of the minimum value */
+    int32_t max_pos;    /*!< index of the maximum value */
+} dsps_view_stats_t;
+
+/**@{*/
+/**
+ * @brief   plot render without memory allocation
+ *
+ * Same plot as dsps_view, built in a single pass over the input.
+ * Every column keeps the min/max of its samples (integer stepping over the
+ * input, no per sample multiply) and is drawn as soon as it's complete.
+ * The plot is drawn in a buffer given by the caller and delivered line by line
+ * through an output function, so it could be sent to any console.
+ *
+ * @param[in] data: array with input samples.
+ * @param len: length of the input array
+ * @param width: plot width in symbols
+ * @param height: plot height in lines
+ * @param min: minimum value that will be limited by Axis Y.
+ * @param max: maximum value that will be limited by Axis Y.
+ * @param view_char: character to draw the plot calues ('.' or '|' etc)
+ * @param buf: work buffer, at least DSPS_VIEW_BUF_SIZE(width, height) bytes
+ * @param buf_len: length of the work buffer
+ * @param out: function called with every line of the plot
+ * @param arg: user argument passed to out
+ * @param[out] stats: input data range, could be NULL
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_view_render(const float *data, int32_t len, int width, int height, float min, float max, char view_char,
+                           char *buf, int32_t buf_len, dsps_view_out_t out, void *arg, dsps_view_stats_t *stats);
+esp_err_t dsps_view_render_s16(const int16_t *data, int32_t len, int width, int height, float min, float max, char view_char,
+                               char *buf, int32_t buf_len, dsps_view_out_t out, void *arg, dsps_view_stats_t *stats);
+/**@}*/
+
 /**
  * @brief   spectrum view
  *
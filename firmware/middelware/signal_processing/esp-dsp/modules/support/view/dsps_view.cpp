@@ -1,120 +1,153 @@
 #include "dsps_view.h"
 #include <math.h>
+#include <stdio.h>
+#include <string.h>
 #include "esp_log.h"
 #include <limits>
 #include <inttypes.h>
 
+// Plot lines in the work buffer: '0'..'9' + width symbols + '|' + '\n' + '\0'
+#define VIEW_LINE_STRIDE(width) ((width) + 4)
 
-void dsps_view(const float *data, int32_t len, int width, int height, float min, float max, char view_char)
+static void view_printf_out(const char *line, void *arg)
 {
-    uint8_t *view_data = new uint8_t[width * height];
-    float *view_data_min = new float[width];
-    float *view_data_max = new float[width];
-    //
+    printf("%s", line);
+}
 
-    for (int y = 0; y < height ; y++) {
-        for (int x = 0 ; x < width ; x++) {
-            view_data[y * width + x] = ' ';
-        }
+template <typename T>
+static esp_err_t view_render(const T *data, int32_t len, float scale, int width, int height, float min, float max, char view_char,
+                             char *buf, int32_t buf_len, dsps_view_out_t out, void *arg, dsps_view_stats_t *stats)
+{
+    if ((data == NULL) || (buf == NULL) || (out == NULL) || (max <= min)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
     }
-    for (int i = 0 ; i < width ; i++) {
-        view_data_min[i] = max;
-        view_data_max[i] = min;
+    if ((len <= 0) || (width <= 0) || (height <= 0) || (buf_len < DSPS_VIEW_BUF_SIZE(width, height))) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    const int stride = VIEW_LINE_STRIDE(width);
+    for (int y = 0; y < height ; y++) {
+        char *line = &buf[y * stride];
+        line[0] = '0' + y % 10;
+        memset(&line[1], ' ', width);
+        line[width + 1] = '|';
+        line[width + 2] = '\n';
+        line[width + 3] = 0;
     }
-    float x_step = (float)(width) / (float)len;
-    float y_step = (float)(height - 1) / (max - min);
-    float data_min = std::numeric_limits<float>::max();
-    float data_max = std::numeric_limits<float>::min();
-    int min_pos = 0;
-    int max_pos = 0;
 
-    for (int i = 0 ; i < len ; i++) {
-        int x_pos = i * x_step;
-        if (data[i] < view_data_min[x_pos]) {
-            view_data_min[x_pos] = data[i];
+    float y_step = (float)(height - 1) / (max - min);
+    dsps_view_stats_t range = {std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), 0, 0};
+    int32_t i = 0;
+    for (int x = 0 ; x < width ; x++) {
+        // Samples i with i * width / len == x, one integer division per column
+        int32_t end = ((int64_t)(x + 1) * len + width - 1) / width;
+        if (end <= i) {
+            continue;
         }
-        if (data[i] > view_data_max[x_pos]) {
-            view_data_max[x_pos] = data[i];
+        T col_min = data[i];
+        T col_max = data[i];
+        int32_t col_min_pos = i;
+        int32_t col_max_pos = i;
+        for (i++; i < end; i++) {
+            T value = data[i];
+            if (value < col_min) {
+                col_min = value;
+                col_min_pos = i;
+            }
+            if (value > col_max) {
+                col_max = value;
+                col_max_pos = i;
+            }
         }
-
-        if (view_data_min[x_pos] < min) {
-            view_data_min[x_pos] = min;
+        float view_min = col_min * scale;
+        float view_max = col_max * scale;
+        if (view_min < range.data_min) {
+            range.data_min = view_min;
+            range.min_pos = col_min_pos;
         }
-        if (view_data_max[x_pos] > max) {
-            view_data_max[x_pos] = max;
+        if (view_max > range.data_max) {
+            range.data_max = view_max;
+            range.max_pos = col_max_pos;
         }
-        ESP_LOGD("view", "for i=%i, x_pos=%i,  max=%f, min=%f, data=%f", i, x_pos, view_data_min[x_pos], view_data_max[x_pos], data[i]);
-        if (data[i] > data_max) {
-            data_max = data[i];
-            max_pos = i;
+
+        if (view_min < min) {
+            view_min = min;
         }
-        if (data[i] < data_min) {
-            data_min = data[i];
-            min_pos = i;
+        if (view_max > max) {
+            view_max = max;
         }
-    }
-    ESP_LOGI("view", "Data min[%i] = %f, Data max[%i] = %f", min_pos, data_min, max_pos, data_max);
-    ESP_LOGD("view", "y_step = %f", y_step);
-    for (int x = 0 ; x < width ; x++) {
-        int y_count = (view_data_max[x] - view_data_min[x]) * y_step + 1;
-        ESP_LOGD("view", "For x= %i y_count=%i  ,min =%f, max=%f, ... ", x, y_count, view_data_min[x], view_data_max[x]);
-        for (int y = 0 ; y < y_count ; y++) {
-            int y_pos = (max - view_data_max[x]) * y_step + y;
-            ESP_LOGD("view", " %i, ", y_pos);
-            view_data[y_pos * width + x] = view_char;
+        int y_count = (view_max - view_min) * y_step + 1;
+        int y_pos = (max - view_max) * y_step;
+        for (int y = y_pos ; (y < y_pos + y_count) && (y < height) ; y++) {
+            buf[y * stride + x + 1] = view_char;
         }
-        ESP_LOGD("view", " ");
     }
 
-    // Simple output
-    // for (int i=0 ; i< len ; i++)
-    // {
-    //     float x_step = (float)(width-1)/(float)len;
-    //     float y_step = (float)(height-1)/(max - min);
-    //     int x_pos = i*x_step;
-    //     int y_pos = data[i]*y_step;
-    //     if (data[i] >= max) y_pos = 0;
-    //     if (data[i] <= min) y_pos = height-1;
-    //     view_data[y_pos*width + x_pos] = view_char;
-    //     printf("For data[%i]=%f, x_pos%i, y_pos=%i\n", i, data[i], x_pos, y_pos);
-    // }
-    // printf("\n");
-    printf(" ");
-    for (int x = 0 ; x < width ; x++) {
-        printf("_");
-    }
-    printf("\n");
+    // The line after the plot is used for the axis
+    char *axis = &buf[height * stride];
+    axis[0] = ' ';
+    memset(&axis[1], '_', width);
+    axis[width + 1] = '\n';
+    axis[width + 2] = 0;
+    out(axis, arg);
     for (int y = 0; y < height ; y++) {
-        printf("%i", y % 10);
-        for (int x = 0 ; x < width ; x++) {
-            printf("%c", view_data[y * width + x]);
-        }
-        printf("|\n");
+        out(&buf[y * stride], arg);
     }
-    printf(" ");
     for (int x = 0 ; x < width ; x++) {
-        printf("%i", x % 10);
+        axis[x + 1] = '0' + x % 10;
     }
-    printf("\n");
+    out(axis, arg);
+
+    if (stats != NULL) {
+        *stats = range;
+    }
+    return ESP_OK;
+}
+
+esp_err_t dsps_view_render(const float *data, int32_t len, int width, int height, float min, float max, char view_char,
+                           char *buf, int32_t buf_len, dsps_view_out_t out, void *arg, dsps_view_stats_t *stats)
+{
+    return view_render(data, len, 1.0f, width, height, min, max, view_char, buf, buf_len, out, arg, stats);
+}
+
+esp_err_t dsps_view_render_s16(const int16_t *data, int32_t len, int width, int height, float min, float max, char view_char,
+                               char *buf, int32_t buf_len, dsps_view_out_t out, void *arg, dsps_view_stats_t *stats)
+{
+    return view_render(data, len, 1.0f / 32768, width, height, min, max, view_char, buf, buf_len, out, arg, stats);
+}
+
+static void view_log(const dsps_view_stats_t *stats, int32_t len, float min, float max)
+{
+    ESP_LOGI("view", "Data min[%i] = %f, Data max[%i] = %f", (int)stats->min_pos, stats->data_min, (int)stats->max_pos, stats->data_max);
     ESP_LOGI("view", "Plot: Length=%i, min=%f, max=%f", (int)len, min, max);
-    delete[] view_data;
-    delete[] view_data_min;
-    delete[] view_data_max;
+}
+
+void dsps_view(const float *data, int32_t len, int width, int height, float min, float max, char view_char)
+{
+    int32_t buf_len = DSPS_VIEW_BUF_SIZE(width, height);
+    char *buf = new char[buf_len];
+    dsps_view_stats_t stats;
+    if (dsps_view_render(data, len, width, height, min, max, view_char, buf, buf_len, view_printf_out, NULL, &stats) == ESP_OK) {
+        view_log(&stats, len, min, max);
+    }
+    delete[] buf;
 }
 
 void dsps_view_s16(const int16_t *data, int32_t len, int width, int height, float min, float max, char view_char)
 {
-    float *view_data = new float[len];
-    for (size_t i = 0; i < len; i++) {
-//        view_data[i] = ((float)data[i])/32768.0f;
-        view_data[i] = data[i];
-        view_data[i] /= 32768;
+    int32_t buf_len = DSPS_VIEW_BUF_SIZE(width, height);
+    char *buf = new char[buf_len];
+    dsps_view_stats_t stats;
+    if (dsps_view_render_s16(data, len, width, height, min, max, view_char, buf, buf_len, view_printf_out, NULL, &stats) == ESP_OK) {
+        view_log(&stats, len, min, max);
     }
-    dsps_view(view_data, len, width, height, min, max, view_char);
-    delete[] view_data;
+    delete[] buf;
 }
 
 void dsps_view_spectrum(const float *data, int32_t len, float min, float max)
 {
-    dsps_view(data, len, 64, 10, min, max, '|');
+    char buf[DSPS_VIEW_BUF_SIZE(64, 10)];
+    dsps_view_stats_t stats;
+    if (dsps_view_render(data, len, 64, 10, min, max, '|', buf, sizeof(buf), view_printf_out, NULL, &stats) == ESP_OK) {
+        view_log(&stats, len, min, max);
+    }
 }
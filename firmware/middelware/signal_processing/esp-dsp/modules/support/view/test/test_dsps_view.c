@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <string.h>
+#include <stdio.h>
 #include "unity.h"
 #include "dsp_platform.h"
 #include "esp_log.h"
@@ -34,3 +35,42 @@ TEST_CASE("dsps_view functionality", "[dsps]")
 
     ESP_LOGI(TAG, "Just a check\n");
 }
+
+static char view_lines[16][80];
+static int view_n_lines;
+
+static void view_test_out(const char *line, void *arg)
+{
+    snprintf(view_lines[view_n_lines++], sizeof(view_lines[0]), "%s", line);
+}
+
+TEST_CASE("dsps_view_render functionality", "[dsps]")
+{
+    const int width = 8;
+    const int height = 5;
+    char buf[DSPS_VIEW_BUF_SIZE(8, 5)];
+    dsps_view_stats_t stats;
+
+    // Two samples per column: a ramp from -1 to 1 and a spike in the last column
+    for (int i = 0 ; i < 16 ; i++) {
+        data[i] = -1 + i / 7.5f;
+    }
+    data[15] = 10;
+    view_n_lines = 0;
+    esp_err_t ret = dsps_view_render(data, 16, width, height, -1, 1, '*', buf, sizeof(buf), view_test_out, NULL, &stats);
+    TEST_ESP_OK(ret);
+    TEST_ASSERT_EQUAL(height + 2, view_n_lines);
+    TEST_ASSERT_EQUAL(0, strcmp(view_lines[0], " ________\n"));
+    TEST_ASSERT_EQUAL(0, strcmp(view_lines[1], "0      **|\n"));
+    TEST_ASSERT_EQUAL(0, strcmp(view_lines[4], "3**      |\n"));
+    TEST_ASSERT_EQUAL(0, strcmp(view_lines[5], "4        |\n"));
+    TEST_ASSERT_EQUAL(0, strcmp(view_lines[6], " 01234567\n"));
+    TEST_ASSERT_EQUAL(0, stats.min_pos);
+    TEST_ASSERT_EQUAL(15, stats.max_pos);
+    TEST_ASSERT_EQUAL_FLOAT(-1, stats.data_min);
+    TEST_ASSERT_EQUAL_FLOAT(10, stats.data_max);
+
+    ret = dsps_view_render(data, 16, width, height, -1, 1, '*', buf, sizeof(buf) - 1, view_test_out, NULL, &stats);
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, ret);
+    ESP_LOGI(TAG, "Render check done\n");
+}
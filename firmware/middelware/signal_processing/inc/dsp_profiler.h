@@ -0,0 +1,136 @@
+#ifndef DSP_PROFILER_H_
+#define DSP_PROFILER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup DSP_Profiler DSP Profiler
+ */
+
+/** \brief Cycle count profiling of the middleware signal processing calls
+ * 
+ * Every middleware entry point (FFT, IIR filters) is wrapped with a pair of
+ * DSP_PROFILE_BEGIN / DSP_PROFILE_END macros. When DSP_PROFILER_ENABLED is 0
+ * (default) the macros expand to nothing. To enable the profiler add to the
+ * project CMakeLists.txt:
+ * 
+ *      idf_build_set_property(COMPILE_DEFINITIONS "-DDSP_PROFILER_ENABLED=1" APPEND)
+ * 
+ * Statistics are kept in a fixed size table, one entry per function. Each
+ * entry is only written by the task calling that function (the middleware
+ * functions are not reentrant) so no locks are needed. Percentiles are
+ * estimated from a logarithmic histogram with 4 bins per octave (error < 19%).
+ * 
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include "dsp_common.h"
+/*==================[macros]=================================================*/
+#ifndef DSP_PROFILER_ENABLED
+#define DSP_PROFILER_ENABLED    0
+#endif
+
+#define DSP_PROFILER_BINS       96      /*!< Histogram bins (24 octaves, 4 bins per octave) */
+
+#if DSP_PROFILER_ENABLED
+/**
+ * @brief Start measuring a call to a profiled function
+ */
+#define DSP_PROFILE_BEGIN(id)   uint32_t dsp_profile_start_##id = dsp_get_cpu_cycle_count()
+/**
+ * @brief Finish measuring a call to a profiled function and record it
+ */
+#define DSP_PROFILE_END(id)     DspProfilerRecord(id, dsp_get_cpu_cycle_count() - dsp_profile_start_##id)
+#else
+#define DSP_PROFILE_BEGIN(id)
+#define DSP_PROFILE_END(id)
+#endif
+/*==================[typedef]================================================*/
+/**
+ * @brief Profiled middleware functions
+ */
+typedef enum dsp_profiler_id {
+    DSP_PROF_FFT_INIT = 0,      /*!< FFTInit */
+    DSP_PROF_FFT_MAGNITUDE,     /*!< FFTMagnitude */
+    DSP_PROF_FFT_FREQUENCY,     /*!< FFTFrequency */
+    DSP_PROF_LOW_PASS_INIT,     /*!< LowPassInit */
+    DSP_PROF_HI_PASS_INIT,      /*!< HiPassInit */
+    DSP_PROF_LOW_PASS_FILTER,   /*!< LowPassFilter */
+    DSP_PROF_HI_PASS_FILTER,    /*!< HiPassFilter */
+    DSP_PROF_COUNT              /*!< Number of profiled functions */
+} dsp_profiler_id_t;
+
+/**
+ * @brief Summary of the calls to a profiled function
+ */
+typedef struct {
+    uint32_t calls;             /*!< Number of recorded calls */
+    uint32_t min;               /*!< Minimum cycles per call */
+    uint32_t mean;              /*!< Mean cycles per call */
+    uint32_t max;               /*!< Maximum cycles per call */
+    uint32_t p99;               /*!< 99th percentile of cycles per call (histogram bin upper bound) */
+} dsp_profiler_stats_t;
+
+/**
+ * @brief Function used to output the text report (e.g. a wrapper around UartSendString)
+ */
+typedef void (*dsp_profiler_out_t)(const char *line);
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Record a call to a profiled function
+ * 
+ * @param id        Profiled function
+ * @param cycles    CPU cycles taken by the call
+ */
+void DspProfilerRecord(dsp_profiler_id_t id, uint32_t cycles);
+
+/**
+ * @brief Get the statistics of a profiled function
+ * 
+ * @param id        Profiled function
+ * @param stats     Struct to store the statistics
+ */
+void DspProfilerGetStats(dsp_profiler_id_t id, dsp_profiler_stats_t *stats);
+
+/**
+ * @brief Clear all the recorded statistics
+ */
+void DspProfilerReset(void);
+
+/**
+ * @brief Write a text report with one line per called function
+ * 
+ * @param out       Function called with every line of the report ("\r\n" terminated)
+ */
+void DspProfilerDump(dsp_profiler_out_t out);
+
+/**
+ * @brief Export the statistics as a binary blob
+ * 
+ * @note Blob format (little endian): uint8_t DSP_PROF_COUNT, then for each function
+ * its dsp_profiler_stats_t fields as uint32_t (calls, min, mean, max, p99).
+ * 
+ * @param buf       Buffer to store the blob
+ * @param size      Size of the buffer
+ * @return size_t   Bytes written (0 if the buffer is too small)
+ */
+size_t DspProfilerExport(uint8_t *buf, size_t size);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* DSP_PROFILER_H_ */
+
+/*==================[end of file]============================================*/
@@ -16,6 +16,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 19/10/2026 | Cycle count profiling hooks (see dsp_profiler.h)						|
  * 
  **/
 
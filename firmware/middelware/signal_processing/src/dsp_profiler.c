@@ -0,0 +1,147 @@
+/**
+ * @file dsp_profiler.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief 
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "dsp_profiler.h"
+/*==================[macros and definitions]=================================*/
+#define LINE_SIZE   96
+#define PERCENTILE  99
+/*==================[internal data declaration]==============================*/
+typedef struct {
+    uint32_t calls;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t hist[DSP_PROFILER_BINS];
+} dsp_profiler_entry_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static dsp_profiler_entry_t table[DSP_PROF_COUNT];
+
+static const char * const names[DSP_PROF_COUNT] = {
+    "FFTInit",
+    "FFTMagnitude",
+    "FFTFrequency",
+    "LowPassInit",
+    "HiPassInit",
+    "LowPassFilter",
+    "HiPassFilter",
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* Bins 0-3 hold 0-3 cycles, then every octave is split in 4 bins */
+static inline uint32_t CyclesToBin(uint32_t cycles){
+    if(cycles < 4){
+        return cycles;
+    }
+    uint32_t octave = 31 - __builtin_clz(cycles);
+    uint32_t bin = 4 * (octave - 1) + ((cycles >> (octave - 2)) & 3);
+    return (bin < DSP_PROFILER_BINS) ? bin : DSP_PROFILER_BINS - 1;
+}
+
+static uint32_t BinUpperBound(uint32_t bin){
+    if(bin < 4){
+        return bin;
+    }
+    uint32_t octave = bin / 4 + 1;
+    uint32_t lower = (4 + (bin % 4)) << (octave - 2);
+    return lower + (1u << (octave - 2)) - 1;
+}
+
+static void PutU32(uint8_t *buf, uint32_t val){
+    buf[0] = val;
+    buf[1] = val >> 8;
+    buf[2] = val >> 16;
+    buf[3] = val >> 24;
+}
+/*==================[external functions definition]==========================*/
+void DspProfilerRecord(dsp_profiler_id_t id, uint32_t cycles){
+    dsp_profiler_entry_t *entry = &table[id];
+    if(entry->calls == 0 || cycles < entry->min){
+        entry->min = cycles;
+    }
+    if(cycles > entry->max){
+        entry->max = cycles;
+    }
+    entry->sum += cycles;
+    entry->hist[CyclesToBin(cycles)]++;
+    entry->calls++;
+}
+
+void DspProfilerGetStats(dsp_profiler_id_t id, dsp_profiler_stats_t *stats){
+    const dsp_profiler_entry_t *entry = &table[id];
+    memset(stats, 0, sizeof(dsp_profiler_stats_t));
+    stats->calls = entry->calls;
+    if(entry->calls == 0){
+        return;
+    }
+    stats->min = entry->min;
+    stats->max = entry->max;
+    stats->mean = entry->sum / entry->calls;
+    /* Smallest bin that leaves at most 1% of the calls above it */
+    uint32_t target = entry->calls - (entry->calls * (100 - PERCENTILE)) / 100;
+    uint32_t count = 0;
+    for(uint32_t bin = 0; bin < DSP_PROFILER_BINS; bin++){
+        count += entry->hist[bin];
+        if(count >= target){
+            stats->p99 = BinUpperBound(bin);
+            break;
+        }
+    }
+    if(stats->p99 > stats->max){
+        stats->p99 = stats->max;
+    }
+}
+
+void DspProfilerReset(void){
+    memset(table, 0, sizeof(table));
+}
+
+void DspProfilerDump(dsp_profiler_out_t out){
+    char line[LINE_SIZE];
+    dsp_profiler_stats_t stats;
+    for(uint8_t id = 0; id < DSP_PROF_COUNT; id++){
+        DspProfilerGetStats(id, &stats);
+        if(stats.calls == 0){
+            continue;
+        }
+        snprintf(line, sizeof(line), "%s: calls=%lu min=%lu mean=%lu max=%lu p99=%lu\r\n", names[id],
+                 (unsigned long)stats.calls, (unsigned long)stats.min, (unsigned long)stats.mean,
+                 (unsigned long)stats.max, (unsigned long)stats.p99);
+        out(line);
+    }
+}
+
+size_t DspProfilerExport(uint8_t *buf, size_t size){
+    const size_t entry_size = 5 * sizeof(uint32_t);
+    size_t total = 1 + DSP_PROF_COUNT * entry_size;
+    dsp_profiler_stats_t stats;
+    if(size < total){
+        return 0;
+    }
+    buf[0] = DSP_PROF_COUNT;
+    for(uint8_t id = 0; id < DSP_PROF_COUNT; id++){
+        uint8_t *p = &buf[1 + id * entry_size];
+        DspProfilerGetStats(id, &stats);
+        PutU32(&p[0], stats.calls);
+        PutU32(&p[4], stats.min);
+        PutU32(&p[8], stats.mean);
+        PutU32(&p[12], stats.max);
+        PutU32(&p[16], stats.p99);
+    }
+    return total;
+}
+
+/*==================[end of file]============================================*/
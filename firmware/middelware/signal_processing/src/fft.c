@@ -15,6 +15,7 @@
 #include "fft.h"
 #include "esp_dsp.h"
 #include "esp_log.h"
+#include "dsp_profiler.h"
 /*==================[macros and definitions]=================================*/
 #define TAG "FFT Module"
 /*==================[internal data declaration]==============================*/
@@ -30,7 +31,9 @@ static float wind[MAX_SIGNAL_LENGHT];
 
 /*==================[external functions definition]==========================*/
 bool FFTInit(void){
+    DSP_PROFILE_BEGIN(DSP_PROF_FFT_INIT);
     esp_err_t ret = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    DSP_PROFILE_END(DSP_PROF_FFT_INIT);
     if (ret != ESP_OK){
         return false;
     }
@@ -38,6 +41,7 @@ bool FFTInit(void){
 }
 
 void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
+    DSP_PROFILE_BEGIN(DSP_PROF_FFT_MAGNITUDE);
     // Generate Hann window
     dsps_wind_hann_f32(wind, signal_lenght);
     // Clear fft array
@@ -57,13 +61,16 @@ void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
     fft_complex[0] = fft_complex[0] / 2;
     // Copy result in fft array
     memcpy(fft, fft_complex, (signal_lenght / 2) * sizeof(float));
+    DSP_PROFILE_END(DSP_PROF_FFT_MAGNITUDE);
 }
 
 void FFTFrequency(float sample_freq, uint16_t signal_lenght, float * f){
+    DSP_PROFILE_BEGIN(DSP_PROF_FFT_FREQUENCY);
     float freq_step = sample_freq / (float)signal_lenght;
     for(uint16_t i=0; i<(signal_lenght/2); i++){
         f[i] = i * freq_step;
     }
+    DSP_PROFILE_END(DSP_PROF_FFT_FREQUENCY);
 }
 
 /*==================[end of file]============================================*/
\ No newline at end of file
@@ -12,6 +12,7 @@
 /*==================[inclusions]=============================================*/
 #include "iir_filter.h"
 #include "esp_dsp.h"
+#include "dsp_profiler.h"
 /*==================[macros and definitions]=================================*/
 #define N_SOS       5
 #define N_DELAY     2
@@ -58,6 +59,7 @@ float hp8_sos_coeff[N_SOS];
 /*==================[external functions definition]==========================*/
 
 void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
+    DSP_PROFILE_BEGIN(DSP_PROF_LOW_PASS_INIT);
     float f = cut_frec / sample_frec;
     lp_order = order;
     switch(lp_order){
@@ -80,9 +82,11 @@ void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
             dsps_biquad_gen_lpf_f32(lp8_sos_coeff, f, ORDER8_Q4);
         break;
     }
+    DSP_PROFILE_END(DSP_PROF_LOW_PASS_INIT);
 }
 
 void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
+    DSP_PROFILE_BEGIN(DSP_PROF_HI_PASS_INIT);
     float f = cut_frec / sample_frec;
     hp_order = order;
     switch(hp_order){
@@ -105,9 +109,11 @@ void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
             dsps_biquad_gen_hpf_f32(hp8_sos_coeff, f, ORDER8_Q4);
         break;
     }
+    DSP_PROFILE_END(DSP_PROF_HI_PASS_INIT);
 }
 
 void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
+    DSP_PROFILE_BEGIN(DSP_PROF_LOW_PASS_FILTER);
     switch(lp_order){
         case ORDER_2:
             dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
@@ -128,9 +134,11 @@ void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_l
             dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp8_sos_coeff, lp8_delay);
         break;
     }
+    DSP_PROFILE_END(DSP_PROF_LOW_PASS_FILTER);
 }
 
 void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
+    DSP_PROFILE_BEGIN(DSP_PROF_HI_PASS_FILTER);
     switch(hp_order){
         case ORDER_2:
             dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
@@ -151,6 +159,7 @@ void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_le
             dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp8_sos_coeff, hp8_delay);
         break;
     }
+    DSP_PROFILE_END(DSP_PROF_HI_PASS_FILTER);
 }
 
 /*==================[end of file]============================================*/
\ No newline at end of file
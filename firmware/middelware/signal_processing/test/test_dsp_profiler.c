@@ -0,0 +1,90 @@
+/**
+ * @file test_dsp_profiler.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Test cases of the DSP profiler
+ * @version 0.1
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "unity.h"
+#include "dsp_profiler.h"
+#include "iir_filter.h"
+#include "fft.h"
+/*==================[macros and definitions]=================================*/
+#define N_SAMPLES   256
+/*==================[internal data definition]===============================*/
+static float signal[N_SAMPLES];
+static float filtered[N_SAMPLES];
+static char report[512];
+/*==================[internal functions definition]==========================*/
+static void ReportOut(const char *line){
+    strncat(report, line, sizeof(report) - strlen(report) - 1);
+}
+
+TEST_CASE("DspProfiler statistics", "[dsp_profiler]")
+{
+    dsp_profiler_stats_t stats;
+    DspProfilerReset();
+    for (int i = 1; i <= 1000; i++) {
+        DspProfilerRecord(DSP_PROF_FFT_FREQUENCY, i);
+    }
+    DspProfilerGetStats(DSP_PROF_FFT_FREQUENCY, &stats);
+    TEST_ASSERT_EQUAL(1000, stats.calls);
+    TEST_ASSERT_EQUAL(1, stats.min);
+    TEST_ASSERT_EQUAL(1000, stats.max);
+    TEST_ASSERT_EQUAL(500, stats.mean);
+    /* Exact p99 is 990, the histogram bin error is below 19% */
+    TEST_ASSERT_GREATER_OR_EQUAL(990, stats.p99);
+    TEST_ASSERT_LESS_THAN(990 * 119 / 100, stats.p99);
+
+    DspProfilerGetStats(DSP_PROF_HI_PASS_FILTER, &stats);
+    TEST_ASSERT_EQUAL(0, stats.calls);
+}
+
+TEST_CASE("DspProfiler middleware hooks", "[dsp_profiler]")
+{
+    dsp_profiler_stats_t stats;
+    DspProfilerReset();
+    LowPassInit(1000, 50, ORDER_4);
+    for (int i = 0; i < 10; i++) {
+        LowPassFilter(signal, filtered, N_SAMPLES);
+    }
+    FFTInit();
+    FFTMagnitude(signal, filtered, N_SAMPLES);
+
+    DspProfilerGetStats(DSP_PROF_LOW_PASS_INIT, &stats);
+    TEST_ASSERT_EQUAL(1, stats.calls);
+    DspProfilerGetStats(DSP_PROF_LOW_PASS_FILTER, &stats);
+    TEST_ASSERT_EQUAL(10, stats.calls);
+    TEST_ASSERT_TRUE(stats.min <= stats.mean && stats.mean <= stats.max);
+    DspProfilerGetStats(DSP_PROF_FFT_MAGNITUDE, &stats);
+    TEST_ASSERT_EQUAL(1, stats.calls);
+
+    report[0] = 0;
+    DspProfilerDump(ReportOut);
+    TEST_ASSERT_NOT_NULL(strstr(report, "LowPassFilter: calls=10 "));
+    TEST_ASSERT_NOT_NULL(strstr(report, "FFTMagnitude: calls=1 "));
+    TEST_ASSERT_TRUE(strstr(report, "HiPassFilter") == NULL);
+}
+
+TEST_CASE("DspProfiler binary export", "[dsp_profiler]")
+{
+    uint8_t blob[1 + DSP_PROF_COUNT * 20];
+    DspProfilerReset();
+    DspProfilerRecord(DSP_PROF_HI_PASS_FILTER, 0x12345);
+    TEST_ASSERT_EQUAL(0, DspProfilerExport(blob, sizeof(blob) - 1));
+    TEST_ASSERT_EQUAL(sizeof(blob), DspProfilerExport(blob, sizeof(blob)));
+    TEST_ASSERT_EQUAL(DSP_PROF_COUNT, blob[0]);
+    const uint8_t *entry = &blob[1 + DSP_PROF_HI_PASS_FILTER * 20];
+    TEST_ASSERT_EQUAL(1, entry[0]);
+    TEST_ASSERT_EQUAL(0x45, entry[4]);
+    TEST_ASSERT_EQUAL(0x23, entry[5]);
+    TEST_ASSERT_EQUAL(0x01, entry[6]);
+}
+
+/*==================[end of file]============================================*/
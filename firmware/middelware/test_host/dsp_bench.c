@@ -0,0 +1,318 @@
+/**
+ * @file dsp_bench.c
+ * @brief Host benchmark runner for the signal processing middleware
+ *
+ * Every benchmark processes a block of samples through one middleware or
+ * esp-dsp entry point and reports the best time per sample and the throughput
+ * in MFLOP/s. Results can be stored as a JSON baseline and later runs are
+ * compared against it.
+ *
+ * Usage: dsp_host_bench [--baseline file] [--save file] [--tolerance pct] [--strict]
+ *
+ * With --strict the program exits with an error if any benchmark is slower
+ * than the baseline by more than the tolerance (25 % by default).
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "esp_dsp.h"
+#include "iir_filter.h"
+#include "fft.h"
+/*==================[macros and definitions]=================================*/
+#define BENCH_LEN           1024
+#define FIR_TAPS            64
+#define CONV_KERNEL         32
+#define MAT_SIZE            16
+#define VIEW_LEN            (1024 * 1024)
+#define VIEW_WIDTH          64
+#define VIEW_HEIGHT         10
+#define BENCH_ROUNDS        5
+#define BENCH_ROUND_NS      20000000ull
+#define DEFAULT_TOLERANCE   25.0
+
+typedef struct {
+    const char *name;
+    int samples;                    /*!< Samples processed on each call */
+    float flops_per_sample;         /*!< Floating point operations per sample */
+    void (*init)(void);
+    void (*run)(void);
+} bench_t;
+
+typedef struct {
+    float ns_per_sample;
+    float mflops;
+} bench_result_t;
+/*==================[internal data definition]===============================*/
+static float input_a[2 * BENCH_LEN];
+static float input_b[2 * BENCH_LEN];
+static float output[2 * BENCH_LEN + CONV_KERNEL];
+static float fir_coeffs[FIR_TAPS];
+static float fir_delay[FIR_TAPS];
+static fir_f32_t fir;
+static float biquad_coeffs[5];
+static float biquad_w[2];
+static float mat_a[MAT_SIZE * MAT_SIZE];
+static float mat_b[MAT_SIZE * MAT_SIZE];
+static float mat_c[MAT_SIZE * MAT_SIZE];
+static float view_input[VIEW_LEN];
+static char view_buf[DSPS_VIEW_BUF_SIZE(VIEW_WIDTH, VIEW_HEIGHT)];
+/*==================[internal functions declaration]=========================*/
+static void InitNone(void){
+}
+
+static void InitFir(void){
+    for (int i = 0; i < FIR_TAPS; i++){
+        fir_coeffs[i] = 1.0f / FIR_TAPS;
+    }
+    dsps_fir_init_f32(&fir, fir_coeffs, fir_delay, FIR_TAPS);
+}
+
+static void InitBiquad(void){
+    dsps_biquad_gen_lpf_f32(biquad_coeffs, 0.1f, 0.707f);
+}
+
+static void InitFft(void){
+    FFTInit();
+}
+
+static void InitLowPass(void){
+    LowPassInit(1000, 50, ORDER_4);
+}
+
+static void InitHiPass(void){
+    HiPassInit(1000, 50, ORDER_4);
+}
+
+static void InitView(void){
+    for (int i = 0; i < VIEW_LEN; i++){
+        view_input[i] = sinf(2 * M_PI * i / 4096.0f);
+    }
+}
+
+static void ViewOut(const char *line, void *arg){
+}
+
+static void RunAdd(void){
+    dsps_add_f32(input_a, input_b, output, BENCH_LEN, 1, 1, 1);
+}
+
+static void RunMul(void){
+    dsps_mul_f32(input_a, input_b, output, BENCH_LEN, 1, 1, 1);
+}
+
+static void RunDotprod(void){
+    dsps_dotprod_f32(input_a, input_b, output, BENCH_LEN);
+}
+
+static void RunFir(void){
+    dsps_fir_f32(&fir, input_a, output, BENCH_LEN);
+}
+
+static void RunBiquad(void){
+    dsps_biquad_f32(input_a, output, BENCH_LEN, biquad_coeffs, biquad_w);
+}
+
+static void RunConv(void){
+    dsps_conv_f32(input_a, BENCH_LEN, input_b, CONV_KERNEL, output);
+}
+
+static void RunFft2r(void){
+    memcpy(output, input_a, 2 * BENCH_LEN * sizeof(float));
+    dsps_fft2r_fc32(output, BENCH_LEN);
+    dsps_bit_rev_fc32(output, BENCH_LEN);
+}
+
+static void RunHann(void){
+    dsps_wind_hann_f32(output, BENCH_LEN);
+}
+
+static void RunMatMult(void){
+    dspm_mult_f32(mat_a, mat_b, mat_c, MAT_SIZE, MAT_SIZE, MAT_SIZE);
+}
+
+static void RunViewRender(void){
+    dsps_view_render(view_input, VIEW_LEN, VIEW_WIDTH, VIEW_HEIGHT, -1, 1, '|',
+                     view_buf, sizeof(view_buf), ViewOut, NULL, NULL);
+}
+
+static void RunLowPass(void){
+    LowPassFilter(input_a, output, BENCH_LEN);
+}
+
+static void RunHiPass(void){
+    HiPassFilter(input_a, output, BENCH_LEN);
+}
+
+static void RunFftMagnitude(void){
+    FFTMagnitude(input_a, output, BENCH_LEN);
+}
+
+static const bench_t benchs[] = {
+    {"dsps_add_f32",        BENCH_LEN,              1,   InitNone,    RunAdd},
+    {"dsps_mul_f32",        BENCH_LEN,              1,   InitNone,    RunMul},
+    {"dsps_dotprod_f32",    BENCH_LEN,              2,   InitNone,    RunDotprod},
+    {"dsps_fir_f32",        BENCH_LEN,              2 * FIR_TAPS, InitFir, RunFir},
+    {"dsps_biquad_f32",     BENCH_LEN,              9,   InitBiquad,  RunBiquad},
+    {"dsps_conv_f32",       BENCH_LEN,              2 * CONV_KERNEL, InitNone, RunConv},
+    {"dsps_fft2r_fc32",     BENCH_LEN,              50,  InitFft,     RunFft2r},    /* 5 * log2(N) */
+    {"dsps_wind_hann_f32",  BENCH_LEN,              4,   InitNone,    RunHann},
+    {"dspm_mult_f32",       MAT_SIZE * MAT_SIZE,    2 * MAT_SIZE, InitNone, RunMatMult},
+    {"dsps_view_render",    VIEW_LEN,               2,   InitView,    RunViewRender}, /* min/max compares */
+    {"LowPassFilter",       BENCH_LEN,              18,  InitLowPass, RunLowPass},
+    {"HiPassFilter",        BENCH_LEN,              18,  InitHiPass,  RunHiPass},
+    {"FFTMagnitude",        BENCH_LEN,              60,  InitFft,     RunFftMagnitude},
+};
+#define N_BENCHS    (sizeof(benchs) / sizeof(benchs[0]))
+/*==================[internal functions definition]==========================*/
+static uint64_t NowNs(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void FillInputs(void){
+    for (int i = 0; i < 2 * BENCH_LEN; i++){
+        input_a[i] = sinf(2 * M_PI * i / 64.0f);
+        input_b[i] = cosf(2 * M_PI * i / 17.0f);
+    }
+    for (int i = 0; i < MAT_SIZE * MAT_SIZE; i++){
+        mat_a[i] = i;
+        mat_b[i] = 1.0f / (i + 1);
+    }
+}
+
+static bench_result_t RunBench(const bench_t *bench){
+    bench_result_t result;
+    double best = 1e30;
+
+    bench->init();
+    bench->run();
+    for (int round = 0; round < BENCH_ROUNDS; round++){
+        uint64_t calls = 0;
+        uint64_t start = NowNs();
+        uint64_t elapsed;
+        do {
+            bench->run();
+            calls++;
+            elapsed = NowNs() - start;
+        } while (elapsed < BENCH_ROUND_NS);
+        double ns = (double)elapsed / (double)(calls * bench->samples);
+        if (ns < best){
+            best = ns;
+        }
+    }
+    result.ns_per_sample = best;
+    result.mflops = bench->flops_per_sample / best * 1000.0f;
+    return result;
+}
+
+/* Looks for "name": { "ns_per_sample": value } in a baseline file */
+static bool BaselineLookup(const char *json, const char *name, float *value){
+    char key[64];
+    snprintf(key, sizeof(key), "\"%s\"", name);
+    const char *entry = strstr(json, key);
+    if (entry == NULL){
+        return false;
+    }
+    const char *field = strstr(entry, "\"ns_per_sample\"");
+    if (field == NULL){
+        return false;
+    }
+    field = strchr(field, ':');
+    if (field == NULL){
+        return false;
+    }
+    *value = strtof(field + 1, NULL);
+    return true;
+}
+
+static char * ReadFile(const char *path){
+    FILE *f = fopen(path, "rb");
+    if (f == NULL){
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *buf = malloc(size + 1);
+    if (buf != NULL){
+        size = fread(buf, 1, size, f);
+        buf[size] = 0;
+    }
+    fclose(f);
+    return buf;
+}
+
+static void SaveBaseline(const char *path, const bench_result_t *results){
+    FILE *f = fopen(path, "w");
+    if (f == NULL){
+        printf("Can't write %s\n", path);
+        return;
+    }
+    fprintf(f, "{\n");
+    for (size_t i = 0; i < N_BENCHS; i++){
+        fprintf(f, "    \"%s\": { \"ns_per_sample\": %.4f, \"mflops\": %.1f }%s\n", benchs[i].name,
+                results[i].ns_per_sample, results[i].mflops, (i + 1 < N_BENCHS) ? "," : "");
+    }
+    fprintf(f, "}\n");
+    fclose(f);
+}
+/*==================[external functions definition]==========================*/
+int main(int argc, char **argv){
+    const char *baseline_path = NULL;
+    const char *save_path = NULL;
+    float tolerance = DEFAULT_TOLERANCE;
+    bool strict = false;
+    bench_result_t results[N_BENCHS];
+    int regressions = 0;
+
+    for (int i = 1; i < argc; i++){
+        if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc){
+            baseline_path = argv[++i];
+        } else if (strcmp(argv[i], "--save") == 0 && i + 1 < argc){
+            save_path = argv[++i];
+        } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc){
+            tolerance = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--strict") == 0){
+            strict = true;
+        } else {
+            printf("Usage: %s [--baseline file] [--save file] [--tolerance pct] [--strict]\n", argv[0]);
+            return 1;
+        }
+    }
+    char *baseline = (baseline_path != NULL) ? ReadFile(baseline_path) : NULL;
+    if (baseline_path != NULL && baseline == NULL){
+        printf("Can't read baseline %s\n", baseline_path);
+    }
+
+    FillInputs();
+    printf("%-20s %12s %10s %12s\n", "benchmark", "ns/sample", "MFLOP/s", "vs baseline");
+    for (size_t i = 0; i < N_BENCHS; i++){
+        float reference;
+        results[i] = RunBench(&benchs[i]);
+        printf("%-20s %12.3f %10.1f", benchs[i].name, results[i].ns_per_sample, results[i].mflops);
+        if (baseline != NULL && BaselineLookup(baseline, benchs[i].name, &reference) && reference > 0){
+            float change = 100.0f * (results[i].ns_per_sample - reference) / reference;
+            printf(" %+11.1f%%", change);
+            if (change > tolerance){
+                printf("  REGRESSION");
+                regressions++;
+            }
+        }
+        printf("\n");
+    }
+    free(baseline);
+
+    if (save_path != NULL){
+        SaveBaseline(save_path, results);
+    }
+    if (regressions > 0){
+        printf("%d benchmark(s) slower than baseline by more than %.0f%%\n", regressions, tolerance);
+    }
+    return (strict && regressions > 0) ? 1 : 0;
+}
+/*==================[end of file]============================================*/
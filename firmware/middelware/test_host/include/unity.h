@@ -0,0 +1,91 @@
+/**
+ * @file unity.h
+ * @brief Minimal Unity-compatible test API for the host build of esp-dsp.
+ *
+ * Only the subset of assertions used by the esp-dsp test cases is provided.
+ * TEST_CASE() registers the test through a constructor, in the same way the
+ * ESP-IDF unity component collects them, so the original test sources can be
+ * compiled unchanged.
+ */
+
+#ifndef _unity_host_h_
+#define _unity_host_h_
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef void (*unity_host_test_fn_t)(void);
+
+void unity_host_register(const char *name, const char *tags, unity_host_test_fn_t fn);
+void unity_host_fail(const char *file, int line, const char *message);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define UNITY_HOST_CAT_(a, b) a##b
+#define UNITY_HOST_CAT(a, b) UNITY_HOST_CAT_(a, b)
+#define UNITY_HOST_FN UNITY_HOST_CAT(unity_host_test_, __LINE__)
+
+#define TEST_CASE(name_, tags_)                                                   \
+    static void UNITY_HOST_FN(void);                                              \
+    __attribute__((constructor)) static void UNITY_HOST_CAT(UNITY_HOST_FN, _reg)(void) \
+    {                                                                             \
+        unity_host_register(name_, tags_, UNITY_HOST_FN);                          \
+    }                                                                             \
+    static void UNITY_HOST_FN(void)
+
+#define TEST_FAIL_MESSAGE(message)  unity_host_fail(__FILE__, __LINE__, message)
+#define TEST_FAIL()                 TEST_FAIL_MESSAGE("failed")
+
+#define TEST_ASSERT_MESSAGE(condition, message) \
+    do { if (!(condition)) { TEST_FAIL_MESSAGE(message); } } while (0)
+#define TEST_ASSERT(condition)          TEST_ASSERT_MESSAGE(condition, #condition)
+#define TEST_ASSERT_TRUE(condition)     TEST_ASSERT_MESSAGE(condition, #condition " is false")
+#define TEST_ASSERT_FALSE(condition)    TEST_ASSERT_MESSAGE(!(condition), #condition " is true")
+#define TEST_ASSERT_NOT_NULL(pointer)   TEST_ASSERT_MESSAGE((pointer) != NULL, #pointer " is NULL")
+#define TEST_ESP_OK(rc)                 TEST_ASSERT_MESSAGE((rc) == 0, #rc " != ESP_OK")
+
+/* Unity compares TEST_ASSERT_EQUAL operands as integers */
+#define TEST_ASSERT_EQUAL_INT(expected, actual) \
+    TEST_ASSERT_MESSAGE((long long)(expected) == (long long)(actual), #actual " != " #expected)
+#define TEST_ASSERT_EQUAL(expected, actual)     TEST_ASSERT_EQUAL_INT(expected, actual)
+#define TEST_ASSERT_NOT_EQUAL(expected, actual) \
+    TEST_ASSERT_MESSAGE((long long)(expected) != (long long)(actual), #actual " == " #expected)
+#define TEST_ASSERT_LESS_THAN(threshold, actual) \
+    TEST_ASSERT_MESSAGE((long long)(actual) < (long long)(threshold), #actual " >= " #threshold)
+#define TEST_ASSERT_GREATER_OR_EQUAL(threshold, actual) \
+    TEST_ASSERT_MESSAGE((long long)(actual) >= (long long)(threshold), #actual " < " #threshold)
+
+#define TEST_ASSERT_FLOAT_WITHIN(delta, expected, actual) \
+    TEST_ASSERT_MESSAGE(fabs((double)(expected) - (double)(actual)) <= (double)(delta), #actual " not within delta of " #expected)
+#define TEST_ASSERT_EQUAL_FLOAT_MESSAGE(expected, actual, message) \
+    TEST_ASSERT_MESSAGE(fabs((double)(expected) - (double)(actual)) <= fabs((double)(expected)) * 0.00001 + 1e-30, message)
+#define TEST_ASSERT_EQUAL_FLOAT(expected, actual) \
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(expected, actual, #actual " != " #expected)
+
+#define TEST_ASSERT_EQUAL_STRING(expected, actual) \
+    TEST_ASSERT_MESSAGE(strcmp((expected), (actual)) == 0, #actual " != " #expected)
+#define TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, actual, num)               \
+    do {                                                                    \
+        for (int unity_i = 0; unity_i < (int)(num); unity_i++) {            \
+            TEST_ASSERT_EQUAL_INT(((const uint8_t *)(expected))[unity_i],   \
+                                  ((const uint8_t *)(actual))[unity_i]);    \
+        }                                                                   \
+    } while (0)
+#define TEST_ASSERT_EACH_EQUAL_UINT8(expected, actual, num)                 \
+    do {                                                                    \
+        for (int unity_i = 0; unity_i < (int)(num); unity_i++) {            \
+            TEST_ASSERT_EQUAL_INT((uint8_t)(expected),                      \
+                                  ((const uint8_t *)(actual))[unity_i]);    \
+        }                                                                   \
+    } while (0)
+
+#endif // _unity_host_h_
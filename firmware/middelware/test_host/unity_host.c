@@ -0,0 +1,100 @@
+/**
+ * @file unity_host.c
+ * @brief Test registry and runner behind the host unity.h
+ *
+ * Usage: dsp_host_tests [--skip name]... [filter]
+ * Only the test cases whose name contains "filter" are executed, test cases
+ * named exactly as a --skip argument are not. More test cases than MAX_TESTS
+ * or skips than MAX_SKIPS are an error, the run fails instead of shrinking.
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include "unity.h"
+/*==================[macros and definitions]=================================*/
+#define MAX_TESTS   512
+#define MAX_SKIPS   16
+/*==================[internal data definition]===============================*/
+typedef struct {
+    const char *name;
+    const char *tags;
+    unity_host_test_fn_t fn;
+} unity_host_test_t;
+
+static unity_host_test_t tests[MAX_TESTS];
+static int n_tests = 0;
+static bool overflow = false;
+static jmp_buf test_env;
+/*==================[internal functions definition]==========================*/
+static bool IsSkipped(const char *name, const char **skips, int n_skips){
+    for (int i = 0; i < n_skips; i++){
+        if (strcmp(name, skips[i]) == 0){
+            return true;
+        }
+    }
+    return false;
+}
+/*==================[external functions definition]==========================*/
+void unity_host_register(const char *name, const char *tags, unity_host_test_fn_t fn){
+    if (n_tests < MAX_TESTS){
+        tests[n_tests].name = name;
+        tests[n_tests].tags = tags;
+        tests[n_tests].fn = fn;
+        n_tests++;
+    } else {
+        /* Called from the constructors, before main */
+        fprintf(stderr, "ERROR: more than %d test cases, %s not registered\n", MAX_TESTS, name);
+        overflow = true;
+    }
+}
+
+void unity_host_fail(const char *file, int line, const char *message){
+    printf("%s:%d: FAIL: %s\n", file, line, message);
+    longjmp(test_env, 1);
+}
+
+int main(int argc, char **argv){
+    const char *filter = "";
+    const char *skips[MAX_SKIPS];
+    int n_skips = 0;
+    int run = 0, failed = 0;
+
+    if (overflow){
+        return 1;
+    }
+    for (int i = 1; i < argc; i++){
+        if (strcmp(argv[i], "--skip") == 0 && i + 1 < argc){
+            if (n_skips == MAX_SKIPS){
+                fprintf(stderr, "ERROR: more than %d --skip arguments\n", MAX_SKIPS);
+                return 1;
+            }
+            skips[n_skips++] = argv[i + 1];
+            i++;
+        } else {
+            filter = argv[i];
+        }
+    }
+
+    for (int i = 0; i < n_tests; i++){
+        if (strstr(tests[i].name, filter) == NULL){
+            continue;
+        }
+        if (IsSkipped(tests[i].name, skips, n_skips)){
+            printf("SKIP: %s\n", tests[i].name);
+            continue;
+        }
+        run++;
+        printf("Running %s...\n", tests[i].name);
+        if (setjmp(test_env) == 0){
+            tests[i].fn();
+            printf("PASS: %s\n", tests[i].name);
+        } else {
+            failed++;
+        }
+    }
+    printf("-----------------------\n%d Tests %d Failures\n", run, failed);
+    return (failed == 0 && run > 0) ? 0 : 1;
+}
+/*==================[end of file]============================================*/
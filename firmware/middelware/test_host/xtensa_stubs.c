@@ -0,0 +1,40 @@
+/**
+ * @file xtensa_stubs.c
+ * @brief Stand-ins for the Xtensa functions referenced by generic tests
+ *
+ * The math module tests (test_dsps_*_f32_ansi.c) also hold a test case for
+ * the ae32 version. Those cases are skipped on the host (XTENSA_CASES in
+ * CMakeLists.txt), these stubs only resolve the link and fail if called.
+ */
+
+/*==================[inclusions]=============================================*/
+#include "unity.h"
+#include "dsps_math.h"
+/*==================[macros and definitions]=================================*/
+#define XTENSA_ONLY()   TEST_FAIL_MESSAGE("Xtensa only, not available on the host")
+/*==================[external functions definition]==========================*/
+esp_err_t dsps_add_f32_ae32(const float *input1, const float *input2, float *output, int len, int step1, int step2, int step_out){
+    XTENSA_ONLY();
+    return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+}
+
+esp_err_t dsps_sub_f32_ae32(const float *input1, const float *input2, float *output, int len, int step1, int step2, int step_out){
+    XTENSA_ONLY();
+    return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+}
+
+esp_err_t dsps_mul_f32_ae32(const float *input1, const float *input2, float *output, int len, int step1, int step2, int step_out){
+    XTENSA_ONLY();
+    return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+}
+
+esp_err_t dsps_addc_f32_ae32(const float *input, float *output, int len, float C, int step_in, int step_out){
+    XTENSA_ONLY();
+    return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+}
+
+esp_err_t dsps_mulc_f32_ae32(const float *input, float *output, int len, float C, int step_in, int step_out){
+    XTENSA_ONLY();
+    return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+}
+/*==================[end of file]============================================*/
@@ -189,7 +189,7 @@ static void MostrarDistanciaTasks(void *pvParameter){
 			LcdItsE0803Write(distancia);
 			}
 			
-			UartSendString(UART_PC,(char*) UartItoa(distancia, 10)); //aca tengo que mandar el valor de distancia desde la uart a la pc
+			UartSendInt(UART_PC, distancia); //aca tengo que mandar el valor de distancia desde la uart a la pc
 			UartSendString(UART_PC, " cm\r\n");
 		}
 		else {
@@ -47,11 +47,6 @@
 */
 #define CONFIG_BLINK_PERIOD_DAC_US 4000
 
-/** @def BASE_DECIMAL
- * @brief Indica la base decimal para la conversion
-*/
-#define BASE_DECIMAL 10
-
 /** @def BUFFER_SIZE
  * @brief Indica el tamaño del buffer del vector ecg
 */
@@ -192,7 +187,7 @@ static void EnviarDatosTask(void *pvParameter)
 {
 		while (true)
 		{
-			UartSendString(UART_PC, (char*) UartItoa(valores, BASE_DECIMAL));
+			UartSendInt(UART_PC, valores);
 			UartSendString(UART_PC, " \r");
 			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 		}
@@ -73,11 +73,6 @@
 */
 #define CONFIG_BLINK_PERIOD_SEND_DATA_MS 250
 
-/** @def BASE_DECIMAL
- * @brief 
-*/
-#define BASE_DECIMAL 10
-
 /*==================[internal data definition]===============================*/
 
 /** 
@@ -207,10 +202,10 @@ static void SendData(void *pvParameter)
 	while(true)
 	{	
 		UartSendString(UART_PC, "Peso:");
-		UartSendString(UART_PC, (char*) UartItoa(peso_vehiculo, BASE_DECIMAL));
+		UartSendInt(UART_PC, peso_vehiculo);
 		UartSendString(UART_PC, "\r\n");
 		UartSendString(UART_PC, "Velocidad Maxima:");
-		UartSendString(UART_PC, (char*) UartItoa(velocidad_maxima, BASE_DECIMAL));
+		UartSendInt(UART_PC, velocidad_maxima);
 		UartSendString(UART_PC, "\r\n");
 
 		vTaskDelay(CONFIG_BLINK_PERIOD_SEND_DATA_MS/ portTICK_PERIOD_MS);
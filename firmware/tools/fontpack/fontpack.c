@@ -0,0 +1,115 @@
+/**
+ * @file fontpack.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Packs fonts and icons of the drivers into C source
+ *
+ *   fontpack -s fonts_pack.c -i fonts_pack.h name=source[:bpp[:scale[:chars]]] ...
+ *
+ * The sizes of every packed font (and of the same glyphs in fonts.c and
+ * icons.c) are printed on stderr.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include "fontpack_host.h"
+/*==================[macros and definitions]=================================*/
+#define MAX_PACKS		16
+#define COMMAND_LEN		1024
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal data definition]===============================*/
+static fontpack_t packs[MAX_PACKS];
+/*==================[internal functions definition]==========================*/
+static void Usage(const char *name){
+	fprintf(stderr, "usage: %s -s source.c -i header.h name=source[:bpp[:scale[:chars]]] ...\n", name);
+}
+
+static const char * BaseName(const char *path){
+	const char *slash = strrchr(path, '/');
+	return slash ? slash + 1 : path;
+}
+
+/* Command line without the directories of the outputs, so the result does
+ * not depend on where it was generated */
+static void Command(char *command, int argc, char *argv[]){
+	size_t len = snprintf(command, COMMAND_LEN, "fontpack");
+	for(int i = 1; i < argc && len < COMMAND_LEN; i++){
+		const char *arg = (i > 1 && (strcmp(argv[i - 1], "-s") == 0 || strcmp(argv[i - 1], "-i") == 0)) ?
+						  BaseName(argv[i]) : argv[i];
+		len += snprintf(&command[len], COMMAND_LEN - len, " %s", arg);
+	}
+}
+
+static bool Write(const char *path, const char *header, const char *command, int n, bool source){
+	FILE *file = fopen(path, "w");
+	if(file == NULL){
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		return false;
+	}
+	if(source){
+		FontpackWriteSource(file, packs, n, header, command);
+	}
+	else{
+		FontpackWriteHeader(file, packs, n, header, command);
+	}
+	return fclose(file) == 0;
+}
+
+int main(int argc, char *argv[]){
+	char command[COMMAND_LEN];
+	const char *source = NULL;
+	const char *header = NULL;
+	size_t total = 0, total_source = 0;
+	int opt, n = 0;
+
+	Command(command, argc, argv);
+	while((opt = getopt(argc, argv, "s:i:")) != -1){
+		switch(opt){
+			case 's':
+				source = optarg;
+				break;
+			case 'i':
+				header = optarg;
+				break;
+			default:
+				Usage(argv[0]);
+				return 2;
+		}
+	}
+	if(source == NULL || header == NULL || optind == argc || argc - optind > MAX_PACKS){
+		Usage(argv[0]);
+		return 2;
+	}
+	for(int i = optind; i < argc; i++, n++){
+		size_t size;
+		if(!FontpackBuild(&packs[n], argv[i])){
+			return 1;
+		}
+		size = FontpackSize(&packs[n]);
+		fprintf(stderr, "%-24s %3u glyphs %6zu bytes (%zu in the source)\n",
+				packs[n].name, packs[n].n_glyphs, size, packs[n].source_size);
+		total += size;
+		total_source += packs[n].source_size;
+	}
+	fprintf(stderr, "%-24s            %6zu bytes (%zu in the source)\n", "total", total, total_source);
+
+	if(!Write(source, BaseName(header), command, n, true) || !Write(header, BaseName(header), command, n, false)){
+		return 1;
+	}
+	for(int i = 0; i < n; i++){
+		FontpackFree(&packs[i]);
+	}
+	return 0;
+}
+
+/*==================[end of file]============================================*/
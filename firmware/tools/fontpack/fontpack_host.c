@@ -0,0 +1,410 @@
+/**
+ * @file fontpack_host.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fontpack_host.h"
+/*==================[macros and definitions]=================================*/
+#define MAX_LEVELS		(255 * 255)		/*!< Pixels of the largest glyph */
+#define BYTES_PER_LINE	16
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal data definition]===============================*/
+static const fontpack_source_t sources[] = {
+	{"font_11", &font_11, NULL},
+	{"font_19", &font_19, NULL},
+	{"font_22", &font_22, NULL},
+	{"font_30", &font_30, NULL},
+	{"font_59", &font_59, NULL},
+	{"font_89", &font_89, NULL},
+	{"icon_22", NULL, &icon_22},
+	{"icon_30", NULL, &icon_30},
+	{"icon_59", NULL, &icon_59},
+	{"icon_89", NULL, &icon_89},
+};
+/*==================[internal functions definition]==========================*/
+static bool Exists(const fontpack_source_t *source, unsigned code){
+	return source->font ? (code >= ' ' && code <= '~') : code < FONTPACK_ICONS;
+}
+
+static uint8_t SourceHeight(const fontpack_source_t *source){
+	return source->font ? source->font->font_height : source->icons->height;
+}
+
+/* 1 bpp rows of a glyph in the source, as the drivers draw them */
+static const uint8_t * SourceBits(const fontpack_source_t *source, uint8_t code, uint16_t *width){
+	if(source->font){
+		const char_info_t *info = &source->font->info[code - ' '];
+		*width = info->width;
+		return &source->font->data[info->offset];
+	}
+	*width = source->icons->width;
+	return &source->icons->data[code * source->icons->offset];
+}
+
+static bool ParseChars(const fontpack_source_t *source, const char *chars, bool *wanted){
+	if(chars == NULL || *chars == '\0'){
+		for(unsigned code = 0; code < 256; code++){
+			wanted[code] = Exists(source, code);
+		}
+		return true;
+	}
+	memset(wanted, 0, 256 * sizeof(bool));
+	if(source->font){
+		/* As a regular expression class */
+		for(const char *c = chars; *c != '\0'; c++){
+			unsigned first = (uint8_t)c[0], last = first;
+			if(c[1] == '-' && c[2] != '\0'){
+				last = (uint8_t)c[2];
+				c += 2;
+			}
+			for(unsigned code = first; code <= last; code++){
+				if(!Exists(source, code)){
+					fprintf(stderr, "fontpack: %s has no character %u\n", source->name, code);
+					return false;
+				}
+				wanted[code] = true;
+			}
+		}
+		return true;
+	}
+	/* Icon numbers */
+	while(*chars != '\0'){
+		char *end;
+		unsigned first = strtoul(chars, &end, 10), last = first;
+		if(end == chars){
+			fprintf(stderr, "fontpack: wrong icon list '%s'\n", chars);
+			return false;
+		}
+		if(*end == '-'){
+			chars = end + 1;
+			last = strtoul(chars, &end, 10);
+		}
+		for(unsigned code = first; code <= last; code++){
+			if(!Exists(source, code)){
+				fprintf(stderr, "fontpack: %s has no icon %u\n", source->name, code);
+				return false;
+			}
+			wanted[code] = true;
+		}
+		chars = (*end == ',') ? end + 1 : end;
+	}
+	return true;
+}
+
+static void Append(fontpack_t *pack, const uint8_t *bytes, size_t n){
+	pack->data = realloc(pack->data, pack->size + n);
+	memcpy(&pack->data[pack->size], bytes, n);
+	pack->size += n;
+}
+
+static void Comment(FILE *file, const fontpack_t *pack, uint16_t glyph){
+	uint8_t code = pack->codes[glyph];
+	if(pack->icons){
+		fprintf(file, "\t/* icon %u, %u pixels wide */\n", code, pack->glyphs[glyph].width);
+	}
+	else{
+		fprintf(file, "\t/* '%c', %u pixels wide */\n", code, pack->glyphs[glyph].width);
+	}
+}
+/*==================[external functions definition]==========================*/
+bool FontpackFindSource(const char *name, fontpack_source_t *source){
+	for(size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); i++){
+		if(strcmp(name, sources[i].name) == 0){
+			*source = sources[i];
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FontpackLevels(const fontpack_source_t *source, uint8_t code, uint8_t scale, uint8_t bpp,
+					uint8_t *levels, uint16_t *width, uint16_t *height){
+	uint8_t max = (1 << bpp) - 1;
+	uint16_t source_width, row_bytes;
+	uint16_t source_height = SourceHeight(source);
+	const uint8_t *bits;
+
+	if(!Exists(source, code)){
+		return false;
+	}
+	bits = SourceBits(source, code, &source_width);
+	row_bytes = (source_width + 7) / 8;
+	*width = (source_width + scale - 1) / scale;
+	*height = (source_height + scale - 1) / scale;
+	for(uint16_t y = 0; y < *height; y++){
+		for(uint16_t x = 0; x < *width; x++){
+			uint32_t set = 0;
+			for(uint16_t i = y * scale; i < (y + 1) * scale && i < source_height; i++){
+				for(uint16_t j = x * scale; j < (x + 1) * scale && j < source_width; j++){
+					set += (bits[i * row_bytes + j / 8] >> (7 - j % 8)) & 1;
+				}
+			}
+			levels[y * *width + x] = (set * max * 2 + scale * scale) / (2 * scale * scale);
+		}
+	}
+	return true;
+}
+
+size_t FontpackEncodeRuns(const uint8_t *levels, uint32_t count, uint8_t bpp, uint8_t *out){
+	uint32_t max_run = 1 << (8 - bpp);
+	size_t size = 0;
+
+	for(uint32_t i = 0; i < count;){
+		uint32_t run = 1;
+		while(i + run < count && run < max_run && levels[i + run] == levels[i]){
+			run++;
+		}
+		if(out != NULL){
+			out[size] = (uint8_t)((run - 1) << bpp | levels[i]);
+		}
+		size++;
+		i += run;
+	}
+	return size;
+}
+
+size_t FontpackEncodeRaw(const uint8_t *levels, uint16_t width, uint16_t height, uint8_t bpp, uint8_t *out){
+	size_t row_bytes = (width * bpp + 7) / 8;
+
+	if(out != NULL){
+		memset(out, 0, row_bytes * height);
+		for(uint16_t y = 0; y < height; y++){
+			for(uint16_t x = 0; x < width; x++){
+				uint32_t bit = x * bpp;
+				out[y * row_bytes + bit / 8] |= levels[y * width + x] << (8 - bpp - bit % 8);
+			}
+		}
+	}
+	return row_bytes * height;
+}
+
+bool FontpackBuild(fontpack_t *pack, const char *spec){
+	static uint8_t levels[MAX_LEVELS];
+	static uint8_t stream[MAX_LEVELS];
+	char copy[sizeof(pack->spec)];
+	char *source_name, *field;
+	fontpack_source_t source;
+	bool wanted[256];
+	unsigned bpp = 1, scale = 1;
+	const char *chars = NULL;
+
+	memset(pack, 0, sizeof(fontpack_t));
+	if(strlen(spec) >= sizeof(copy)){
+		fprintf(stderr, "fontpack: specification too long '%s'\n", spec);
+		return false;
+	}
+	strcpy(pack->spec, spec);
+	strcpy(copy, spec);
+
+	/* name=source[:bpp[:scale[:chars]]] */
+	source_name = strchr(copy, '=');
+	if(source_name == NULL || source_name == copy || source_name - copy >= FONTPACK_NAME_LEN){
+		fprintf(stderr, "fontpack: expected name=source in '%s'\n", spec);
+		return false;
+	}
+	*source_name++ = '\0';
+	for(const char *c = copy; *c != '\0'; c++){
+		if(!isalnum((unsigned char)*c) && *c != '_'){
+			fprintf(stderr, "fontpack: '%s' is not a C identifier\n", copy);
+			return false;
+		}
+	}
+	strcpy(pack->name, copy);
+	field = strchr(source_name, ':');
+	if(field != NULL){
+		*field++ = '\0';
+		bpp = strtoul(field, &field, 10);
+		if(*field == ':'){
+			scale = strtoul(field + 1, &field, 10);
+			if(*field == ':'){
+				chars = field + 1;
+			}
+		}
+	}
+	if(!FontpackFindSource(source_name, &source)){
+		fprintf(stderr, "fontpack: unknown source '%s'\n", source_name);
+		return false;
+	}
+	if((bpp != 1 && bpp != 2 && bpp != 4) || scale < 1 || scale > 8){
+		fprintf(stderr, "fontpack: bpp must be 1, 2 or 4 and scale 1 to 8 in '%s'\n", spec);
+		return false;
+	}
+	if(!ParseChars(&source, chars, wanted)){
+		return false;
+	}
+	pack->icons = source.icons != NULL;
+	pack->bpp = bpp;
+	pack->height = (SourceHeight(&source) + scale - 1) / scale;
+
+	for(unsigned code = 0; code < 256; code++){
+		font_pack_glyph_t *glyph = &pack->glyphs[pack->n_glyphs];
+		font_pack_range_t *range = pack->n_ranges ? &pack->ranges[pack->n_ranges - 1] : NULL;
+		uint16_t width, height, source_width;
+		size_t runs, raw;
+
+		if(!wanted[code]){
+			continue;
+		}
+		FontpackLevels(&source, code, scale, bpp, levels, &width, &height);
+		SourceBits(&source, code, &source_width);
+		pack->source_size += (source_width + 7) / 8 * SourceHeight(&source) + (source.font ? sizeof(char_info_t) : 0);
+
+		/* Runs, unless raw rows are smaller */
+		runs = FontpackEncodeRuns(levels, width * height, bpp, NULL);
+		raw = FontpackEncodeRaw(levels, width, height, bpp, NULL);
+		if(pack->size > UINT16_MAX){
+			fprintf(stderr, "fontpack: more than 64 KB of data in '%s'\n", spec);
+			return false;
+		}
+		glyph->width = width;
+		glyph->offset = pack->size;
+		if(runs < raw){
+			glyph->flags = 0;
+			Append(pack, stream, FontpackEncodeRuns(levels, width * height, bpp, stream));
+		}
+		else{
+			glyph->flags = FONT_PACK_RAW;
+			Append(pack, stream, FontpackEncodeRaw(levels, width, height, bpp, stream));
+		}
+		pack->codes[pack->n_glyphs] = code;
+
+		if(range != NULL && range->first + range->count == code && range->count < UINT8_MAX){
+			range->count++;
+		}
+		else{
+			if(pack->n_ranges == FONTPACK_MAX_RANGES){
+				fprintf(stderr, "fontpack: more than %d ranges in '%s'\n", FONTPACK_MAX_RANGES, spec);
+				return false;
+			}
+			range = &pack->ranges[pack->n_ranges++];
+			range->first = code;
+			range->count = 1;
+			range->glyph = pack->n_glyphs;
+		}
+		pack->n_glyphs++;
+	}
+	if(pack->n_glyphs == 0){
+		fprintf(stderr, "fontpack: no glyphs in '%s'\n", spec);
+		return false;
+	}
+	return true;
+}
+
+size_t FontpackSize(const fontpack_t *pack){
+	return pack->size + pack->n_glyphs * sizeof(font_pack_glyph_t) + pack->n_ranges * sizeof(font_pack_range_t);
+}
+
+void FontpackView(const fontpack_t *pack, font_pack_t *font){
+	font->height = pack->height;
+	font->bpp = pack->bpp;
+	font->n_ranges = pack->n_ranges;
+	font->ranges = pack->ranges;
+	font->glyphs = pack->glyphs;
+	font->data = pack->data;
+}
+
+void FontpackFree(fontpack_t *pack){
+	free(pack->data);
+	pack->data = NULL;
+	pack->size = 0;
+}
+
+void FontpackWriteSource(FILE *file, const fontpack_t *packs, int n, const char *header, const char *command){
+	fprintf(file, "/**\n"
+				  " * @file %.*s.c\n"
+				  " * @brief Packed fonts and icons, generated by tools/fontpack. Do not edit.\n"
+				  " *\n"
+				  " *   %s\n"
+				  " *\n"
+				  " */\n\n", (int)(strlen(header) - 2), header, command);
+	fprintf(file, "/*==================[inclusions]=============================================*/\n");
+	fprintf(file, "#include \"%s\"\n", header);
+	fprintf(file, "/*==================[internal data definition]===============================*/\n");
+	for(int i = 0; i < n; i++){
+		const fontpack_t *pack = &packs[i];
+		size_t byte = 0;
+
+		fprintf(file, "static const uint8_t %s_data[] = {\n", pack->name);
+		for(uint16_t g = 0; g < pack->n_glyphs; g++){
+			size_t end = (g + 1 < pack->n_glyphs) ? pack->glyphs[g + 1].offset : pack->size;
+			Comment(file, pack, g);
+			while(byte < end){
+				fprintf(file, "\t");
+				for(int k = 0; k < BYTES_PER_LINE && byte < end; k++, byte++){
+					fprintf(file, "0x%02X,%s", pack->data[byte], (k + 1 < BYTES_PER_LINE && byte + 1 < end) ? " " : "");
+				}
+				fprintf(file, "\n");
+			}
+		}
+		fprintf(file, "};\n\n");
+
+		fprintf(file, "static const font_pack_glyph_t %s_glyphs[] = {\n", pack->name);
+		for(uint16_t g = 0; g < pack->n_glyphs; g++){
+			fprintf(file, "\t{%u, %u, %u},\n", pack->glyphs[g].width, pack->glyphs[g].flags,
+					(unsigned)pack->glyphs[g].offset);
+		}
+		fprintf(file, "};\n\n");
+
+		fprintf(file, "static const font_pack_range_t %s_ranges[] = {\n", pack->name);
+		for(uint8_t r = 0; r < pack->n_ranges; r++){
+			fprintf(file, "\t{%u, %u, %u},\n", pack->ranges[r].first, pack->ranges[r].count, pack->ranges[r].glyph);
+		}
+		fprintf(file, "};\n\n");
+	}
+	fprintf(file, "/*==================[external data definition]===============================*/\n");
+	for(int i = 0; i < n; i++){
+		const fontpack_t *pack = &packs[i];
+		fprintf(file, "const font_pack_t %s = {\n\t%u,\n\t%u,\n\t%u,\n\t%s_ranges,\n\t%s_glyphs,\n\t%s_data\n};\n\n",
+				pack->name, pack->height, pack->bpp, pack->n_ranges, pack->name, pack->name, pack->name);
+	}
+	fprintf(file, "/*==================[end of file]============================================*/\n");
+}
+
+void FontpackWriteHeader(FILE *file, const fontpack_t *packs, int n, const char *header, const char *command){
+	char guard[FONTPACK_NAME_LEN * 2];
+	size_t len = 0;
+
+	for(const char *c = header; *c != '\0' && len < sizeof(guard) - 2; c++){
+		guard[len++] = isalnum((unsigned char)*c) ? toupper((unsigned char)*c) : '_';
+	}
+	guard[len++] = '_';
+	guard[len] = '\0';
+
+	fprintf(file, "#ifndef %s\n#define %s\n", guard, guard);
+	fprintf(file, "/** \\addtogroup Drivers_Programable Drivers Programable\n ** @{ */\n"
+				  "/** \\addtogroup Drivers_Devices Drivers devices\n ** @{ */\n"
+				  "/** \\addtogroup Font_Pack Packed fonts\n ** @{ */\n"
+				  "/** \\brief Packed fonts and icons, generated by tools/fontpack. Do not edit.\n"
+				  " *\n"
+				  " *   %s\n"
+				  " *\n"
+				  " **/\n\n", command);
+	fprintf(file, "/*==================[inclusions]=============================================*/\n");
+	fprintf(file, "#include \"font_pack.h\"\n");
+	fprintf(file, "/*==================[external data declaration]==============================*/\n");
+	for(int i = 0; i < n; i++){
+		const fontpack_t *pack = &packs[i];
+		fprintf(file, "/**\n * @brief  Packed %s (%u pixels, %u bpp, %u glyphs, %zu bytes; %zu in the source)\n */\n"
+					  "extern const font_pack_t %s;\n\n",
+				strchr(pack->spec, '=') + 1, pack->height, pack->bpp, pack->n_glyphs, FontpackSize(pack),
+				pack->source_size, pack->name);
+	}
+	fprintf(file, "/** @} doxygen end group definition */\n"
+				  "/** @} doxygen end group definition */\n"
+				  "/** @} doxygen end group definition */\n"
+				  "#endif /* %s */\n\n", guard);
+	fprintf(file, "/*==================[end of file]============================================*/\n");
+}
+
+/*==================[end of file]============================================*/
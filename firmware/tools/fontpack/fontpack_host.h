@@ -0,0 +1,183 @@
+#ifndef FONTPACK_HOST_H
+#define FONTPACK_HOST_H
+/** \addtogroup Tools Tools
+ ** @{ */
+/** \addtogroup Fontpack_Host Font packer
+ ** @{ */
+
+/** \brief Encoder of the packed fonts and icons (see font_pack.h).
+ *
+ * Takes the 1 bpp fonts of fonts.h and icons of icons.h, optionally scaled
+ * down by an integer factor into 2 or 4 bpp coverage levels (anti-aliased
+ * glyphs), keeps the characters asked for and encodes each glyph as runs or
+ * raw rows, whichever is smaller. The result is written as C source for the
+ * drivers.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "fonts.h"
+#include "icons.h"
+#include "font_pack.h"
+/*==================[macros]=================================================*/
+#define FONTPACK_MAX_GLYPHS		256		/*!< Glyphs of a packed font */
+#define FONTPACK_MAX_RANGES		32		/*!< Ranges of a packed font */
+#define FONTPACK_NAME_LEN		32		/*!< Max length of a C identifier */
+#define FONTPACK_ICONS			(ICON_RAIN + 1)		/*!< Number of icons */
+/*==================[typedef]================================================*/
+/**
+ * @brief Font or icon set of the drivers
+ */
+typedef struct {
+	const char *name;				/*!< Name in the drivers (font_22, icon_30, ...) */
+	const Font_t *font;				/*!< Font, NULL for icons */
+	const icon_font_t *icons;		/*!< Icons, NULL for a font */
+} fontpack_source_t;
+
+/**
+ * @brief Packed font being built
+ */
+typedef struct {
+	char name[FONTPACK_NAME_LEN];						/*!< C identifier */
+	char spec[FONTPACK_NAME_LEN * 4];					/*!< Specification it was built from */
+	bool icons;											/*!< Built from icons */
+	uint8_t height;										/*!< Height in pixels */
+	uint8_t bpp;										/*!< Bits per pixel */
+	font_pack_range_t ranges[FONTPACK_MAX_RANGES];		/*!< Ranges */
+	uint8_t n_ranges;									/*!< Number of ranges */
+	font_pack_glyph_t glyphs[FONTPACK_MAX_GLYPHS];		/*!< Glyphs */
+	uint16_t n_glyphs;									/*!< Number of glyphs */
+	uint8_t codes[FONTPACK_MAX_GLYPHS];					/*!< Character of each glyph */
+	uint8_t *data;										/*!< Glyph streams */
+	size_t size;										/*!< Bytes of data */
+	size_t source_size;									/*!< Bytes of the same glyphs in the source (bitmaps and char_info_t) */
+} fontpack_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Finds a font or icon set by its name in the drivers
+ *
+ * @param name font_11 ... font_89, icon_22 ... icon_89
+ * @param source Found source
+ * @return true if it exists
+ */
+bool FontpackFindSource(const char *name, fontpack_source_t *source);
+
+/**
+ * @brief Coverage levels of a glyph, scaled down
+ *
+ * Each pixel is the share of set source pixels in a scale x scale block,
+ * rounded to 2^bpp levels.
+ *
+ * @param source Font or icons
+ * @param code Character or icon
+ * @param scale Scale down factor (1 keeps the size)
+ * @param bpp Bits per pixel (1, 2 or 4)
+ * @param levels Width x height levels, row after row
+ * @param width Width of the scaled glyph
+ * @param height Height of the scaled glyph
+ * @return false if the source does not have the glyph
+ */
+bool FontpackLevels(const fontpack_source_t *source, uint8_t code, uint8_t scale, uint8_t bpp,
+					uint8_t *levels, uint16_t *width, uint16_t *height);
+
+/**
+ * @brief Encodes levels as runs (see font_pack.h)
+ *
+ * @param levels Levels
+ * @param count Number of levels
+ * @param bpp Bits per pixel
+ * @param out Output, NULL to only get the size
+ * @return Bytes of the runs
+ */
+size_t FontpackEncodeRuns(const uint8_t *levels, uint32_t count, uint8_t bpp, uint8_t *out);
+
+/**
+ * @brief Encodes levels as raw rows (see font_pack.h)
+ *
+ * @param levels Levels
+ * @param width Width
+ * @param height Height
+ * @param bpp Bits per pixel
+ * @param out Output, NULL to only get the size
+ * @return Bytes of the rows
+ */
+size_t FontpackEncodeRaw(const uint8_t *levels, uint16_t width, uint16_t height, uint8_t bpp, uint8_t *out);
+
+/**
+ * @brief Builds a packed font from a specification
+ *
+ * The specification is name=source[:bpp[:scale[:chars]]], for example
+ * font_pack_89_digits=font_89:1:1:-0-9. or font_pack_30_aa=font_59:4:2.
+ * chars lists characters and ranges as a regular expression class (a - at
+ * the beginning or the end is a character). For icons they are numbers and
+ * ranges separated by commas (0-5,20). By default every glyph is kept.
+ *
+ * @param pack Packed font, FontpackFree() releases it
+ * @param spec Specification
+ * @return false (with a message on stderr) if the specification is wrong
+ */
+bool FontpackBuild(fontpack_t *pack, const char *spec);
+
+/**
+ * @brief Bytes of a packed font in flash: glyph streams, glyph and range tables
+ *
+ * @param pack Packed font
+ * @return Bytes
+ */
+size_t FontpackSize(const fontpack_t *pack);
+
+/**
+ * @brief Decoder view of a packed font being built
+ *
+ * @param pack Packed font
+ * @param font View, valid while pack is not changed
+ */
+void FontpackView(const fontpack_t *pack, font_pack_t *font);
+
+/**
+ * @brief Releases a packed font
+ *
+ * @param pack Packed font
+ */
+void FontpackFree(fontpack_t *pack);
+
+/**
+ * @brief Writes the C source of packed fonts
+ *
+ * @param file Output
+ * @param packs Packed fonts
+ * @param n Number of packed fonts
+ * @param header Name of the header to include
+ * @param command Command line, for the file comment
+ */
+void FontpackWriteSource(FILE *file, const fontpack_t *packs, int n, const char *header, const char *command);
+
+/**
+ * @brief Writes the C header of packed fonts
+ *
+ * @param file Output
+ * @param packs Packed fonts
+ * @param n Number of packed fonts
+ * @param header Name of the header (for the include guard)
+ * @param command Command line, for the file comment
+ */
+void FontpackWriteHeader(FILE *file, const fontpack_t *packs, int n, const char *header, const char *command);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef FONTPACK_HOST_H */
+
+/*==================[end of file]============================================*/
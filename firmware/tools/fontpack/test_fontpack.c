@@ -0,0 +1,228 @@
+/**
+ * @file test_fontpack.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Font packer against the decoder of the drivers
+ *
+ * Every glyph of every font and icon set is packed and decoded back with
+ * font_pack.c, and compared with the 1 bpp source.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fontpack_host.h"
+/*==================[macros and definitions]=================================*/
+#define CHECK(cond) do { \
+		if(!(cond)){ \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			exit(1); \
+		} \
+	} while(0)
+/*==================[internal data definition]===============================*/
+static const char *source_names[] = {
+	"font_11", "font_19", "font_22", "font_30", "font_59", "font_89",
+	"icon_22", "icon_30", "icon_59", "icon_89",
+};
+
+/* Palette mapping every level to itself, so rows hold the levels */
+static const uint16_t identity[FONT_PACK_MAX_LEVELS] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+static fontpack_t pack;
+static uint8_t levels[255 * 255];
+static uint16_t row[UINT8_MAX];
+/*==================[internal functions definition]==========================*/
+/* Decodes every glyph, whole and from its middle row, and compares with
+ * FontpackLevels() */
+static void CheckGlyphs(const fontpack_source_t *source, uint8_t scale){
+	font_pack_t font;
+
+	FontpackView(&pack, &font);
+	for(uint16_t g = 0; g < pack.n_glyphs; g++){
+		const font_pack_glyph_t *glyph = FontPackGlyph(&font, pack.codes[g]);
+		font_pack_decoder_t decoder;
+		uint16_t width, height;
+
+		CHECK(glyph == &pack.glyphs[g]);
+		CHECK(FontpackLevels(source, pack.codes[g], scale, pack.bpp, levels, &width, &height));
+		CHECK(glyph->width == width && pack.height == height);
+
+		FontPackDecoderInit(&decoder, &font, glyph, identity);
+		for(uint16_t y = 0; y < height; y++){
+			FontPackRow(&decoder, row);
+			for(uint16_t x = 0; x < width; x++){
+				CHECK(row[x] == levels[y * width + x]);
+			}
+		}
+		FontPackDecoderInit(&decoder, &font, glyph, identity);
+		FontPackSkip(&decoder, height / 2);
+		for(uint16_t y = height / 2; y < height; y++){
+			FontPackRow(&decoder, row);
+			for(uint16_t x = 0; x < width; x++){
+				CHECK(row[x] == levels[y * width + x]);
+			}
+		}
+	}
+}
+
+static void TestRoundTrip(void){
+	for(size_t i = 0; i < sizeof(source_names) / sizeof(source_names[0]); i++){
+		fontpack_source_t source;
+		char spec[64];
+
+		CHECK(FontpackFindSource(source_names[i], &source));
+		snprintf(spec, sizeof(spec), "test=%s", source_names[i]);
+		CHECK(FontpackBuild(&pack, spec));
+		CHECK(pack.n_glyphs == (source.font ? '~' - ' ' + 1 : FONTPACK_ICONS));
+		CheckGlyphs(&source, 1);
+
+		/* 1 bpp at scale 1 is the source bit for bit */
+		for(uint16_t g = 0; g < pack.n_glyphs; g++){
+			uint16_t width, height;
+			FontpackLevels(&source, pack.codes[g], 1, 1, levels, &width, &height);
+			if(source.font){
+				const char_info_t *info = &source.font->info[pack.codes[g] - ' '];
+				const uint8_t *bits = &source.font->data[info->offset];
+				for(uint16_t y = 0; y < height; y++){
+					for(uint16_t x = 0; x < width; x++){
+						CHECK(levels[y * width + x] == ((bits[y * ((width + 7) / 8) + x / 8] >> (7 - x % 8)) & 1));
+					}
+				}
+			}
+		}
+		printf("%-8s %3u glyphs %6zu bytes packed, %6zu in the source\n", source_names[i], pack.n_glyphs,
+			   FontpackSize(&pack), pack.source_size);
+		FontpackFree(&pack);
+	}
+}
+
+static void TestAntiAliased(void){
+	fontpack_source_t source;
+	font_pack_t font;
+	font_pack_decoder_t decoder;
+	const font_pack_glyph_t *glyph;
+	uint32_t count[FONT_PACK_MAX_LEVELS] = {0};
+
+	CHECK(FontpackFindSource("font_59", &source));
+	CHECK(FontpackBuild(&pack, "aa=font_59:4:2"));
+	CHECK(pack.bpp == 4 && pack.height == (source.font->font_height + 1) / 2);
+	CheckGlyphs(&source, 2);
+
+	/* Solid and empty areas are the extreme levels, edges are in between */
+	FontpackView(&pack, &font);
+	glyph = FontPackGlyph(&font, '8');
+	FontPackDecoderInit(&decoder, &font, glyph, identity);
+	for(uint8_t y = 0; y < font.height; y++){
+		FontPackRow(&decoder, row);
+		for(uint8_t x = 0; x < glyph->width; x++){
+			CHECK(row[x] < FONT_PACK_MAX_LEVELS);
+			count[row[x]]++;
+		}
+	}
+	CHECK(count[0] > 0 && count[15] > 0);
+	CHECK(count[0] + count[15] < (uint32_t)glyph->width * font.height);
+	FontpackFree(&pack);
+
+	/* 2 bpp */
+	CHECK(FontpackBuild(&pack, "aa=font_30:2:2"));
+	CHECK(pack.bpp == 2);
+	CHECK(FontpackFindSource("font_30", &source));
+	CheckGlyphs(&source, 2);
+	FontpackFree(&pack);
+}
+
+static void TestSubset(void){
+	font_pack_t font;
+
+	CHECK(FontpackBuild(&pack, "digits=font_89:1:1:-0-9."));
+	CHECK(pack.n_glyphs == 12);
+	/* '-' '.' are consecutive, '/' is not in the set */
+	CHECK(pack.n_ranges == 2);
+	FontpackView(&pack, &font);
+	CHECK(FontPackGlyph(&font, '-') != NULL);
+	CHECK(FontPackGlyph(&font, '.') != NULL);
+	CHECK(FontPackGlyph(&font, '/') == NULL);
+	CHECK(FontPackGlyph(&font, '9') != NULL);
+	CHECK(FontPackGlyph(&font, 'A') == NULL);
+	CHECK(FontPackGlyph(&font, ' ') == NULL);
+	CHECK(FontPackWidth(&font, "1A2", 3) == FontPackWidth(&font, "12", 2));
+	CHECK(pack.size < pack.source_size / 2);
+	FontpackFree(&pack);
+
+	CHECK(FontpackBuild(&pack, "batteries=icon_22:1:1:0-5,20"));
+	CHECK(pack.n_glyphs == 7 && pack.n_ranges == 2);
+	FontpackView(&pack, &font);
+	CHECK(FontPackGlyph(&font, ICON_BAT_5) != NULL);
+	CHECK(FontPackGlyph(&font, ICON_SIGNAL_0) == NULL);
+	CHECK(FontPackGlyph(&font, 20) != NULL);
+	FontpackFree(&pack);
+}
+
+static void TestRawOrRuns(void){
+	uint8_t checker[16 * 4];
+	uint8_t solid[16 * 16];
+
+	for(size_t i = 0; i < sizeof(checker); i++){
+		checker[i] = i & 1;
+	}
+	memset(solid, 1, sizeof(solid));
+	CHECK(FontpackEncodeRuns(checker, sizeof(checker), 1, NULL) == sizeof(checker));
+	CHECK(FontpackEncodeRaw(checker, 16, 4, 1, NULL) == 8);
+	/* Runs of 128 at 1 bpp, 16 at 4 bpp */
+	CHECK(FontpackEncodeRuns(solid, sizeof(solid), 1, NULL) == 2);
+	CHECK(FontpackEncodeRuns(solid, sizeof(solid), 4, NULL) == 16);
+	CHECK(FontpackEncodeRaw(solid, 16, 16, 1, NULL) == 32);
+
+	/* Every glyph takes the smaller of both */
+	CHECK(FontpackBuild(&pack, "test=font_11"));
+	for(uint16_t g = 0; g < pack.n_glyphs; g++){
+		fontpack_source_t source;
+		uint16_t width, height;
+		size_t end = (g + 1 < pack.n_glyphs) ? pack.glyphs[g + 1].offset : pack.size;
+		size_t runs, raw;
+
+		FontpackFindSource("font_11", &source);
+		FontpackLevels(&source, pack.codes[g], 1, 1, levels, &width, &height);
+		runs = FontpackEncodeRuns(levels, width * height, 1, NULL);
+		raw = FontpackEncodeRaw(levels, width, height, 1, NULL);
+		CHECK(end - pack.glyphs[g].offset == (runs < raw ? runs : raw));
+		CHECK(((pack.glyphs[g].flags & FONT_PACK_RAW) != 0) == (runs >= raw));
+	}
+	FontpackFree(&pack);
+}
+
+static void TestBadSpecs(void){
+	static const char *bad[] = {
+		"font_22",
+		"=font_22",
+		"my-font=font_22",
+		"test=font_23",
+		"test=font_22:3",
+		"test=font_22:1:0",
+		"test=font_22:1:1:\t",
+		"test=icon_22:1:1:99",
+		"test=icon_22:1:1:a",
+	};
+	for(size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++){
+		CHECK(!FontpackBuild(&pack, bad[i]));
+		FontpackFree(&pack);
+	}
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	TestRoundTrip();
+	TestAntiAliased();
+	TestSubset();
+	TestRawOrRuns();
+	TestBadSpecs();
+	printf("fontpack: OK\n");
+	return 0;
+}
+
+/*==================[end of file]============================================*/
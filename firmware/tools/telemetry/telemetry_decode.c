@@ -0,0 +1,102 @@
+/**
+ * @file telemetry_decode.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Prints the telemetry frames received on a serial port as CSV
+ *
+ *   telemetry_decode [-b baud] [-n frames] [-c channel] [-t timeout_ms] [-q] <device>
+ *
+ * Every sample is a line "channel,seq,index,value" on stdout, the receiver
+ * statistics are printed on stderr at the end (unless -q).
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include "telemetry_host.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+typedef struct {
+	int channel;			/*!< Channel to print, -1: every channel */
+	uint32_t printed;		/*!< Blocks printed */
+} decode_t;
+/*==================[internal data definition]===============================*/
+static telemetry_rx_t rx;
+/*==================[internal functions definition]==========================*/
+static void PrintBlock(const telemetry_block_t *block, void *param){
+	decode_t *decode = param;
+	if(decode->channel >= 0 && block->channel != decode->channel){
+		return;
+	}
+	TelemetryHostPrintBlock(stdout, block);
+	decode->printed++;
+}
+
+static void Usage(const char *name){
+	fprintf(stderr, "usage: %s [-b baud] [-n frames] [-c channel] [-t timeout_ms] [-q] <device>\n", name);
+}
+
+int main(int argc, char *argv[]){
+	decode_t decode = {.channel = -1, .printed = 0};
+	uint32_t baud_rate = 0;
+	uint32_t frames = 0;
+	int timeout_ms = -1;
+	int quiet = 0;
+	int opt, fd;
+
+	while((opt = getopt(argc, argv, "b:n:c:t:q")) != -1){
+		switch(opt){
+			case 'b':
+				baud_rate = strtoul(optarg, NULL, 10);
+				break;
+			case 'n':
+				frames = strtoul(optarg, NULL, 10);
+				break;
+			case 'c':
+				decode.channel = atoi(optarg);
+				break;
+			case 't':
+				timeout_ms = atoi(optarg);
+				break;
+			case 'q':
+				quiet = 1;
+				break;
+			default:
+				Usage(argv[0]);
+				return 2;
+		}
+	}
+	if(optind != argc - 1){
+		Usage(argv[0]);
+		return 2;
+	}
+	fd = TelemetryHostOpen(argv[optind], baud_rate);
+	if(fd < 0){
+		fprintf(stderr, "%s: %s\n", argv[optind], strerror(errno));
+		return 1;
+	}
+	TelemetryRxInit(&rx, PrintBlock, &decode);
+	while(frames == 0 || decode.printed < frames){
+		if(TelemetryHostPoll(fd, &rx, timeout_ms) <= 0){
+			break;
+		}
+		fflush(stdout);
+	}
+	fflush(stdout);
+	if(!quiet){
+		TelemetryHostPrintStats(stderr, &rx.stats);
+	}
+	close(fd);
+	return 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,115 @@
+/**
+ * @file telemetry_host.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#include "telemetry_host.h"
+/*==================[macros and definitions]=================================*/
+#define READ_CHUNK		4096
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const struct {
+	uint32_t baud_rate;
+	speed_t speed;
+} speeds[] = {
+	{9600, B9600}, {19200, B19200}, {38400, B38400}, {57600, B57600}, {115200, B115200},
+	{230400, B230400}, {460800, B460800}, {921600, B921600}, {1000000, B1000000},
+	{2000000, B2000000},
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int TelemetryHostRaw(int fd, uint32_t baud_rate){
+	struct termios tio;
+	if(tcgetattr(fd, &tio) != 0){
+		return -1;
+	}
+	cfmakeraw(&tio);
+	tio.c_cflag |= CLOCAL | CREAD;
+	tio.c_cflag &= ~(CSTOPB | CRTSCTS);
+	tio.c_cc[VMIN] = 1;
+	tio.c_cc[VTIME] = 0;
+	if(baud_rate != 0){
+		size_t i;
+		for(i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++){
+			if(speeds[i].baud_rate == baud_rate){
+				break;
+			}
+		}
+		if(i == sizeof(speeds) / sizeof(speeds[0])){
+			errno = EINVAL;
+			return -1;
+		}
+		cfsetispeed(&tio, speeds[i].speed);
+		cfsetospeed(&tio, speeds[i].speed);
+	}
+	return tcsetattr(fd, TCSANOW, &tio);
+}
+
+int TelemetryHostOpen(const char *path, uint32_t baud_rate){
+	int fd = open(path, O_RDWR | O_NOCTTY | O_CLOEXEC);
+	if(fd < 0){
+		return -1;
+	}
+	if(TelemetryHostRaw(fd, baud_rate) != 0){
+		int error = errno;
+		close(fd);
+		errno = error;
+		return -1;
+	}
+	return fd;
+}
+
+int TelemetryHostPoll(int fd, telemetry_rx_t *rx, int timeout_ms){
+	uint8_t buf[READ_CHUNK];
+	struct pollfd pfd = {.fd = fd, .events = POLLIN};
+	ssize_t len;
+	int ready = poll(&pfd, 1, timeout_ms);
+	if(ready < 0){
+		return (errno == EINTR) ? 0 : -1;
+	}
+	if(ready == 0){
+		return 0;
+	}
+	len = read(fd, buf, sizeof(buf));
+	if(len < 0){
+		return (errno == EINTR || errno == EAGAIN) ? 0 : -1;
+	}
+	if(len == 0){
+		return -1;
+	}
+	TelemetryRxPush(rx, buf, len);
+	return len;
+}
+
+void TelemetryHostPrintBlock(FILE *out, const telemetry_block_t *block){
+	for(uint16_t i = 0; i < block->count; i++){
+		fprintf(out, "%u,%u,%u,%.9g\n", block->channel, block->seq, i, TelemetrySample(block, i));
+	}
+}
+
+void TelemetryHostPrintStats(FILE *out, const telemetry_rx_stats_t *stats){
+	fprintf(out, "frames=%u lost=%u crc_errors=%u format_errors=%u overflows=%u\n",
+			stats->frames, stats->lost, stats->crc_errors, stats->format_errors, stats->overflows);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,81 @@
+#ifndef TELEMETRY_HOST_H
+#define TELEMETRY_HOST_H
+/** \addtogroup Tools Tools
+ ** @{ */
+/** \addtogroup Telemetry_Host Telemetry host
+ ** @{ */
+
+/** \brief Linux side of the binary telemetry (see telemetry_mcu.h).
+ *
+ * Opens a serial port (or a pty) in raw mode and feeds the received bytes to
+ * the same decoder used by the firmware tests.
+ *
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include "telemetry_mcu.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Open a serial port in raw mode (8N1, no flow control)
+ *
+ * @param path Device (/dev/ttyUSB0, /dev/pts/N, ...)
+ * @param baud_rate Baud rate, 0 to keep the current one (ptys)
+ * @return File descriptor, -1 on error (errno is set)
+ */
+int TelemetryHostOpen(const char *path, uint32_t baud_rate);
+
+/**
+ * @brief Put an open terminal in raw mode
+ *
+ * @param fd File descriptor
+ * @param baud_rate Baud rate, 0 to keep the current one
+ * @return 0 on success, -1 on error (errno is set)
+ */
+int TelemetryHostRaw(int fd, uint32_t baud_rate);
+
+/**
+ * @brief Read what is available (waiting up to timeout_ms) and decode it
+ *
+ * @param fd File descriptor
+ * @param rx Receiver, its function is called for every valid frame
+ * @param timeout_ms Max wait for the first byte (-1: forever)
+ * @return Bytes read, 0 on timeout, -1 at the end of the stream or on error
+ */
+int TelemetryHostPoll(int fd, telemetry_rx_t *rx, int timeout_ms);
+
+/**
+ * @brief Print a block as CSV lines: channel,seq,index,value
+ *
+ * @param out Output stream
+ * @param block Decoded block
+ */
+void TelemetryHostPrintBlock(FILE *out, const telemetry_block_t *block);
+
+/**
+ * @brief Print the receiver statistics in one line
+ *
+ * @param out Output stream
+ * @param stats Receiver statistics
+ */
+void TelemetryHostPrintStats(FILE *out, const telemetry_rx_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef TELEMETRY_HOST_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,161 @@
+/**
+ * @file test_telemetry_pty.c
+ * @author Franco Luznyj (francoluznyj1999@gmail.com)
+ * @brief Telemetry decoder library and CLI over a pty pair
+ *
+ * The master side plays the ESP32 (frames built with telemetry_mcu.c) and the
+ * slave side is the serial port seen by the host.
+ *
+ *   test_telemetry_pty <path of telemetry_decode>
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "telemetry_host.h"
+/*==================[macros and definitions]=================================*/
+#define CHECK(cond) do { \
+		if(!(cond)){ \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+			exit(1); \
+		} \
+	} while(0)
+#define TIMEOUT_MS		1000
+#define N_SAMPLES		100
+/*==================[internal data definition]===============================*/
+static telemetry_tx_t tx;
+static telemetry_rx_t rx;
+static uint32_t blocks;
+static double last_value;
+/*==================[internal functions definition]==========================*/
+static void CountBlock(const telemetry_block_t *block, void *param){
+	(void)param;
+	blocks++;
+	last_value = TelemetrySample(block, block->count - 1);
+}
+
+static void OpenPair(int *master, int *slave){
+	*master = posix_openpt(O_RDWR | O_NOCTTY);
+	CHECK(*master >= 0);
+	CHECK(grantpt(*master) == 0 && unlockpt(*master) == 0);
+	*slave = TelemetryHostOpen(ptsname(*master), 0);
+	CHECK(*slave >= 0);
+}
+
+static void WriteAll(int fd, const uint8_t *data, size_t len){
+	while(len > 0){
+		ssize_t n = write(fd, data, len);
+		CHECK(n > 0);
+		data += n;
+		len -= n;
+	}
+}
+
+/* Write a frame and read the slave until it is decoded (or rejected) */
+static void Send(int master, int slave, const uint8_t *frame, size_t len){
+	uint32_t seen = rx.stats.frames + rx.stats.crc_errors + rx.stats.format_errors;
+	WriteAll(master, frame, len);
+	while(rx.stats.frames + rx.stats.crc_errors + rx.stats.format_errors == seen){
+		CHECK(TelemetryHostPoll(slave, &rx, TIMEOUT_MS) > 0);
+	}
+}
+
+static void TestLibrary(void){
+	int master, slave;
+	int32_t ramp[N_SAMPLES];
+	size_t len;
+
+	OpenPair(&master, &slave);
+	TelemetryTxInit(&tx);
+	TelemetryRxInit(&rx, CountBlock, NULL);
+	for(int frame = 0; frame < 50; frame++){
+		for(int i = 0; i < N_SAMPLES; i++){
+			ramp[i] = frame * N_SAMPLES + i - 1000;
+		}
+		len = TelemetryEncode(&tx, 3, TELEMETRY_I32 | TELEMETRY_DELTA, ramp, N_SAMPLES);
+		CHECK(len > 0);
+		if(frame == 10){
+			continue;
+		}
+		if(frame == 20){
+			tx.frame[len / 2] ^= 0x01;
+		}
+		Send(master, slave, tx.frame, len);
+	}
+	CHECK(blocks == 48);
+	CHECK(rx.stats.frames == 48);
+	CHECK(rx.stats.lost == 2);
+	CHECK(rx.stats.crc_errors + rx.stats.format_errors == 1);
+	CHECK(last_value == 49 * N_SAMPLES + N_SAMPLES - 1 - 1000);
+	close(slave);
+	close(master);
+}
+
+static void TestCli(const char *decoder){
+	int master, slave, out[2], status;
+	char output[4096];
+	size_t output_len = 0;
+	ssize_t n;
+	uint16_t adc[3] = {0, 2048, 4095};
+	float temperature = 36.5f;
+	const char *expected =
+		"1,0,0,0\n1,0,1,2048\n1,0,2,4095\n"
+		"2,0,0,36.5\n"
+		"1,2,0,0\n1,2,1,2048\n1,2,2,4095\n";
+	pid_t pid;
+
+	OpenPair(&master, &slave);
+	CHECK(pipe(out) == 0);
+	pid = fork();
+	CHECK(pid >= 0);
+	if(pid == 0){
+		dup2(out[1], STDOUT_FILENO);
+		close(out[0]);
+		close(out[1]);
+		execl(decoder, decoder, "-n", "3", "-q", "-t", "5000", ptsname(master), (char*)NULL);
+		_exit(127);
+	}
+	close(out[1]);
+	TelemetryTxInit(&tx);
+	WriteAll(master, tx.frame, TelemetryEncode(&tx, 1, TELEMETRY_U16, adc, 3));
+	WriteAll(master, tx.frame, TelemetryEncode(&tx, 2, TELEMETRY_F32, &temperature, 1));
+	/* Dropped on the way: the sequence number goes from 0 to 2 */
+	TelemetryEncode(&tx, 1, TELEMETRY_U16, adc, 3);
+	WriteAll(master, tx.frame, TelemetryEncode(&tx, 1, TELEMETRY_U16 | TELEMETRY_DELTA, adc, 3));
+	while((n = read(out[0], &output[output_len], sizeof(output) - 1 - output_len)) > 0){
+		output_len += n;
+	}
+	output[output_len] = '\0';
+	CHECK(waitpid(pid, &status, 0) == pid);
+	CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+	if(strcmp(output, expected) != 0){
+		fprintf(stderr, "unexpected output:\n%s", output);
+		exit(1);
+	}
+	close(out[0]);
+	close(slave);
+	close(master);
+}
+/*==================[external functions definition]==========================*/
+int main(int argc, char *argv[]){
+	if(argc != 2){
+		fprintf(stderr, "usage: %s <telemetry_decode>\n", argv[0]);
+		return 2;
+	}
+	TestLibrary();
+	TestCli(argv[1]);
+	printf("telemetry over pty: OK\n");
+	return 0;
+}
+
+/*==================[end of file]============================================*/